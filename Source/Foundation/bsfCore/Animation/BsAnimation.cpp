@@ -6,6 +6,9 @@
 #include "Animation/BsAnimationUtility.h"
 #include "Scene/BsSceneObject.h"
 #include "Animation/BsMorphShapes.h"
+#include "Mesh/BsMeshData.h"
+#include "Mesh/BsMeshUtility.h"
+#include "Math/BsSIMD.h"
 
 namespace bs
 {
@@ -15,7 +18,9 @@ namespace bs
 
 	AnimationProxy::AnimationProxy(UINT64 id)
 		: id(id)
-	{ }
+	{
+		lodState.id = id;
+	}
 
 	AnimationProxy::~AnimationProxy()
 	{
@@ -108,6 +113,12 @@ namespace bs
 		if (skeleton != nullptr)
 			skeletonPose = LocalSkeletonPose(skeleton->getNumBones());
 
+		// Poses used for interpolation are allocated on demand, by the animation thread
+		lodFromPose = LocalSkeletonPose();
+		lodToPose = LocalSkeletonPose();
+		lodState.hasPose = false;
+		lodHasToPose = false;
+
 		numSceneObjects = (UINT32)sceneObjects.size();
 		if (numSceneObjects > 0)
 			sceneObjectPose = LocalSkeletonPose(numSceneObjects, true);
@@ -253,6 +264,7 @@ namespace bs
 			UINT32 layersSize = sizeof(AnimationStateLayer) * numLayers;
 			UINT32 clipsSize = sizeof(AnimationState) * numClips;
 			UINT32 boneMappingSize = numBoneMappings * sizeof(AnimationCurveMapping);
+			UINT32 boneTracksSize = numBoneMappings * sizeof(AnimationBoneTrack);
 			UINT32 posCacheSize = numPosCurves * sizeof(TCurveCache<Vector3>);
 			UINT32 rotCacheSize = numRotCurves * sizeof(TCurveCache<Quaternion>);
 			UINT32 scaleCacheSize = numScaleCurves * sizeof(TCurveCache<Vector3>);
@@ -263,9 +275,9 @@ namespace bs
 			UINT32 morphChannelSize = numMorphChannels * sizeof(MorphChannelInfo);
 			UINT32 morphShapeSize = numMorphShapes * sizeof(MorphShapeInfo);
 
-			UINT8* data = (UINT8*)bs_alloc(layersSize + clipsSize + boneMappingSize + posCacheSize + rotCacheSize +
-				scaleCacheSize + genCacheSize + genericCurveOutputSize + sceneObjectIdsSize + sceneObjectTransformsSize +
-				morphChannelSize + morphShapeSize);
+			UINT8* data = (UINT8*)bs_alloc(layersSize + clipsSize + boneMappingSize + boneTracksSize + posCacheSize +
+				rotCacheSize + scaleCacheSize + genCacheSize + genericCurveOutputSize + sceneObjectIdsSize +
+				sceneObjectTransformsSize + morphChannelSize + morphShapeSize);
 
 			layers = (AnimationStateLayer*)data;
 			memcpy(layers, tempLayers.data(), layersSize);
@@ -283,6 +295,12 @@ namespace bs
 
 			data += boneMappingSize;
 
+			AnimationBoneTrack* boneTracks = (AnimationBoneTrack*)data;
+			for (UINT32 i = 0; i < numBoneMappings; i++)
+				new (&boneTracks[i]) AnimationBoneTrack();
+
+			data += boneTracksSize;
+
 			TCurveCache<Vector3>* posCache = (TCurveCache<Vector3>*)data;
 			for (UINT32 i = 0; i < numPosCurves; i++)
 				new (&posCache[i]) TCurveCache<Vector3>();
@@ -467,10 +485,13 @@ namespace bs
 					if (skeleton != nullptr)
 					{
 						state.boneToCurveMapping = &boneMappings[curStateIdx * numBones];
+						state.activeTracks = &boneTracks[curStateIdx * numBones];
 
 						if (isClipValid)
 						{
 							clipInfo.clip->getBoneMapping(*skeleton, state.boneToCurveMapping);
+							state.numActiveTracks = skeleton->getActiveTracks(state.boneToCurveMapping, skeletonMask,
+								state.activeTracks);
 						}
 						else
 						{
@@ -648,6 +669,232 @@ namespace bs
 		}
 	}
 
+	/** Returns the union of two ranges of vertices in [start, end) form. Empty ranges are ignored. */
+	static void unionRange(UINT32& start, UINT32& end, UINT32 otherStart, UINT32 otherEnd)
+	{
+		if (otherStart >= otherEnd)
+			return;
+
+		if (start >= end)
+		{
+			start = otherStart;
+			end = otherEnd;
+		}
+		else
+		{
+			start = std::min(start, otherStart);
+			end = std::max(end, otherEnd);
+		}
+	}
+
+	void MorphShapeBuffers::blend(const MorphShapeInfo* shapes, UINT32 numShapes, UINT32 numVertices,
+		const SPtr<VertexDataDesc>& vertexDesc)
+	{
+		using namespace simd;
+
+		static constexpr float MIN_WEIGHT = 0.0001f;
+
+		// (Re)create the buffers if the base mesh changed. All vertices need to be written to the new buffers.
+		if (this->numVertices != numVertices || buffers[0] == nullptr)
+		{
+			this->numVertices = numVertices;
+
+			for (UINT32 i = 0; i < NUM_BUFFERS; i++)
+			{
+				buffers[i] = bs_shared_ptr_new<MeshData>(numVertices, 0, vertexDesc);
+				staleStart[i] = 0;
+				staleEnd[i] = numVertices;
+			}
+
+			activeStart = 0;
+			activeEnd = numVertices;
+		}
+
+		// Find the range of vertices modified by the currently active shapes
+		UINT32 newActiveStart = 0;
+		UINT32 newActiveEnd = 0;
+		for (UINT32 i = 0; i < numShapes; i++)
+		{
+			if (Math::abs(shapes[i].finalWeight) < MIN_WEIGHT)
+				continue;
+
+			const MorphShapeBlendData& blendData = shapes[i].shape->getBlendData();
+			unionRange(newActiveStart, newActiveEnd, blendData.minIndex, blendData.maxIndex);
+		}
+
+		// Vertices that differ from the previous version are the ones modified either by the previously active shapes,
+		// or by the currently active ones
+		UINT32 newDirtyStart = activeStart;
+		UINT32 newDirtyEnd = activeEnd;
+		unionRange(newDirtyStart, newDirtyEnd, newActiveStart, newActiveEnd);
+
+		const UINT32 bufferIdx = (current + 1) % NUM_BUFFERS;
+
+		// Other buffers keep their old contents, so they become out of date in the dirty range
+		UINT32 regionStart = staleStart[bufferIdx];
+		UINT32 regionEnd = staleEnd[bufferIdx];
+		unionRange(regionStart, regionEnd, newDirtyStart, newDirtyEnd);
+
+		for (UINT32 i = 0; i < NUM_BUFFERS; i++)
+		{
+			if (i == bufferIdx)
+			{
+				staleStart[i] = 0;
+				staleEnd[i] = 0;
+			}
+			else
+				unionRange(staleStart[i], staleEnd[i], newDirtyStart, newDirtyEnd);
+		}
+
+		regionEnd = std::min(regionEnd, numVertices);
+		if (regionStart < regionEnd)
+		{
+			const UINT32 regionSize = regionEnd - regionStart;
+
+			// Accumulate the weighted deltas for every vertex in the region, one array per component. Arrays are padded
+			// to a multiple of four so they can be read with SIMD loads.
+			const UINT32 paddedSize = (regionSize + 3) & ~3U;
+			const UINT32 accumulatorSize = paddedSize * 7 * sizeof(float);
+			float* accumulatorData = (float*)bs_stack_alloc(accumulatorSize);
+			memset(accumulatorData, 0, accumulatorSize);
+
+			float* accPositions[3] = { accumulatorData, accumulatorData + paddedSize, accumulatorData + paddedSize * 2 };
+			float* accNormals[3] = { accumulatorData + paddedSize * 3, accumulatorData + paddedSize * 4,
+				accumulatorData + paddedSize * 5 };
+			float* accWeights = accumulatorData + paddedSize * 6;
+
+			for (UINT32 i = 0; i < numShapes; i++)
+			{
+				const MorphShapeInfo& info = shapes[i];
+				const float weight = info.finalWeight;
+				const float absWeight = Math::abs(weight);
+
+				if (absWeight < MIN_WEIGHT)
+					continue;
+
+				const MorphShapeBlendData& blendData = info.shape->getBlendData();
+				const UINT32* indices = blendData.sourceIndices.data();
+				const float* deltas[6] = {
+					blendData.deltaPositions[0].data(), blendData.deltaPositions[1].data(),
+					blendData.deltaPositions[2].data(), blendData.deltaNormals[0].data(),
+					blendData.deltaNormals[1].data(), blendData.deltaNormals[2].data() };
+				float* accumulators[6] = {
+					accPositions[0], accPositions[1], accPositions[2], accNormals[0], accNormals[1], accNormals[2] };
+
+				const float32x4 weightVec = splat<float32x4>(weight);
+				const float32x4 absWeightVec = splat<float32x4>(absWeight);
+
+				const UINT32 numShapeVertices = (UINT32)blendData.sourceIndices.size();
+				UINT32 j = 0;
+				for (; (j + 4) <= numShapeVertices; j += 4)
+				{
+					float32x4 weighted[6];
+					for (UINT32 k = 0; k < 6; k++)
+						weighted[k] = mul(load_u<float32x4>(deltas[k] + j), weightVec);
+
+					// Indices are sorted, so consecutive vertices can be accumulated directly
+					const UINT32 first = indices[j];
+					if (indices[j + 1] == first + 1 && indices[j + 2] == first + 2 && indices[j + 3] == first + 3)
+					{
+						const UINT32 dst = first - regionStart;
+						for (UINT32 k = 0; k < 6; k++)
+							store_u(accumulators[k] + dst, add(load_u<float32x4>(accumulators[k] + dst), weighted[k]));
+
+						store_u(accWeights + dst, add(load_u<float32x4>(accWeights + dst), absWeightVec));
+					}
+					else
+					{
+						float scattered[6][4];
+						for (UINT32 k = 0; k < 6; k++)
+							store_u(scattered[k], weighted[k]);
+
+						for (UINT32 l = 0; l < 4; l++)
+						{
+							const UINT32 dst = indices[j + l] - regionStart;
+							for (UINT32 k = 0; k < 6; k++)
+								accumulators[k][dst] += scattered[k][l];
+
+							accWeights[dst] += absWeight;
+						}
+					}
+				}
+
+				for (; j < numShapeVertices; j++)
+				{
+					const UINT32 dst = indices[j] - regionStart;
+					for (UINT32 k = 0; k < 6; k++)
+						accumulators[k][dst] += deltas[k][j] * weight;
+
+					accWeights[dst] += absWeight;
+				}
+			}
+
+			// Write out the positions and pack the normals
+			MeshData& meshData = *buffers[bufferIdx];
+			UINT8* positions = meshData.getElementData(VES_POSITION, 1, 1);
+			UINT8* normals = meshData.getElementData(VES_NORMAL, 1, 1);
+			const UINT32 stride = vertexDesc->getVertexStride(1);
+
+			const float32x4 minWeightVec = splat<float32x4>(MIN_WEIGHT);
+			const float32x4 oneVec = splat<float32x4>(1.0f);
+			const float32x4 halfVec = splat<float32x4>(0.5f);
+			const float32x4 packScaleVec = splat<float32x4>(127.5f);
+			const float32x4 weightScaleVec = splat<float32x4>(255.999f);
+			const int32x4 zeroVec = make_zero();
+			const int32x4 maxPackedVec = splat<int32x4>(255);
+
+			for (UINT32 i = 0; i < regionSize; i += 4)
+			{
+				const UINT32 count = std::min(4U, regionSize - i);
+
+				// Accumulated normal is in range [-2, 2] but the packed normal assumes [-1, 1] range
+				const float32x4 weightVec = load_u<float32x4>(accWeights + i);
+				const float32x4 invWeightVec = div(oneVec, max(weightVec, minWeightVec));
+
+				INT32 packed[4][4];
+				for (UINT32 k = 0; k < 3; k++)
+				{
+					float32x4 normal = mul(mul(load_u<float32x4>(accNormals[k] + i), invWeightVec), halfVec);
+					normal = add(mul(normal, packScaleVec), packScaleVec);
+
+					int32x4 packedVec = to_int32(normal);
+					packedVec = min(max(packedVec, zeroVec), maxPackedVec);
+					store_u(packed[k], packedVec);
+				}
+
+				store_u(packed[3], to_int32(mul(min(weightVec, oneVec), weightScaleVec)));
+
+				for (UINT32 l = 0; l < count; l++)
+				{
+					const UINT32 vertexIdx = regionStart + i + l;
+
+					Vector3& position = *(Vector3*)(positions + vertexIdx * stride);
+					position = Vector3(accPositions[0][i + l], accPositions[1][i + l], accPositions[2][i + l]);
+
+					PackedNormal& normal = *(PackedNormal*)(normals + vertexIdx * stride);
+					if (accWeights[i + l] > MIN_WEIGHT)
+					{
+						normal.x = (UINT8)packed[0][l];
+						normal.y = (UINT8)packed[1][l];
+						normal.z = (UINT8)packed[2][l];
+						normal.w = (UINT8)packed[3][l];
+					}
+					else
+						normal = { { 127, 127, 127, 0 } };
+				}
+			}
+
+			bs_stack_free(accumulatorData);
+		}
+
+		current = bufferIdx;
+		version++;
+		dirtyStart = newDirtyStart;
+		dirtyEnd = std::min(newDirtyEnd, numVertices);
+		activeStart = newActiveStart;
+		activeEnd = newActiveEnd;
+	}
+
 	Animation::Animation()
 	{
 		mId = AnimationManager::instance().registerAnimation(this);
@@ -737,6 +984,13 @@ namespace bs
 		mDirty |= AnimDirtyStateFlag::Culling;
 	}
 
+	void Animation::setLODLevels(const Vector<AnimationLODLevel>& levels)
+	{
+		mLODLevels = levels;
+
+		mDirty |= AnimDirtyStateFlag::LOD;
+	}
+
 	void Animation::play(const HAnimationClip& clip)
 	{
 		AnimationClipInfo* clipInfo = addClip(clip, (UINT32)-1);
@@ -1336,6 +1590,13 @@ namespace bs
 			mDirty.unset(AnimDirtyStateFlag::Culling);
 		}
 
+		if (mDirty.isSet(AnimDirtyStateFlag::LOD))
+		{
+			mAnimProxy->lodLevels = mLODLevels;
+
+			mDirty.unset(AnimDirtyStateFlag::LOD);
+		}
+
 		auto getAnimatedSOList = [&]()
 		{
 			Vector<AnimatedSceneObject> animatedSO(mSceneObjects.size());
@@ -8,6 +8,7 @@
 #include "Utility/BsFlags.h"
 #include "Animation/BsSkeleton.h"
 #include "Animation/BsSkeletonMask.h"
+#include "Animation/BsAnimationLOD.h"
 #include "Math/BsVector2.h"
 #include "Math/BsAABox.h"
 
@@ -57,7 +58,8 @@ namespace bs
 		Layout = 1 << 1,
 		All = 1 << 2,
 		Culling = 1 << 3,
-		MorphWeights = 1 << 4
+		MorphWeights = 1 << 4,
+		LOD = 1 << 5
 	};
 
 	typedef Flags<AnimDirtyStateFlag> AnimDirtyState;
@@ -160,6 +162,57 @@ namespace bs
 		float finalWeight;
 	};
 
+	/**
+	 * Pool of buffers that receive blended morph shape vertices. Buffers are reused between animation updates, and only
+	 * the range of vertices that changed since a buffer was last written is recalculated.
+	 */
+	struct BS_CORE_EXPORT MorphShapeBuffers
+	{
+		/**
+		 * Number of buffers to cycle between. A buffer must not be written to while the renderer could still be reading
+		 * it, which is the case for as long as evaluated animation data is kept around by the AnimationManager.
+		 */
+		static constexpr UINT32 NUM_BUFFERS = 3;
+
+		/**
+		 * Blends the provided shapes using their final weights, and writes the result in the next buffer in the pool.
+		 *
+		 * @param[in]	shapes			Shapes to blend. Shapes with (nearly) zero weight are skipped.
+		 * @param[in]	numShapes		Number of entries in the @p shapes array.
+		 * @param[in]	numVertices		Number of vertices in the base mesh the shapes apply to.
+		 * @param[in]	vertexDesc		Layout of the blended vertices. Must contain a VET_FLOAT3 position and a
+		 *								VET_UBYTE4_NORM normal in stream 1. Normal's W component receives the total weight
+		 *								of the shapes applied to the vertex.
+		 */
+		void blend(const MorphShapeInfo* shapes, UINT32 numShapes, UINT32 numVertices,
+			const SPtr<VertexDataDesc>& vertexDesc);
+
+		/** Returns the most recently written buffer, or null if nothing was blended yet. */
+		const SPtr<MeshData>& getCurrent() const { return buffers[current]; }
+
+		SPtr<MeshData> buffers[NUM_BUFFERS];
+
+		/** Range of vertices in each buffer, [start, end), that changed since the buffer was last written. */
+		UINT32 staleStart[NUM_BUFFERS] = { };
+		UINT32 staleEnd[NUM_BUFFERS] = { };
+
+		/** Index of the most recently written buffer. */
+		UINT32 current = 0;
+
+		/** Incremented every time a buffer is written. 0 is considered an invalid version. */
+		UINT32 version = 1;
+
+		/** Range of vertices, [start, end), that differ between the most recently written buffer and the one before. */
+		UINT32 dirtyStart = 0;
+		UINT32 dirtyEnd = 0;
+
+		/** Range of vertices, [start, end), modified by the shapes blended into the most recently written buffer. */
+		UINT32 activeStart = 0;
+		UINT32 activeEnd = 0;
+
+		UINT32 numVertices = 0;
+	};
+
 	/** Contains information about a scene object that is animated by a specific animation curve. */
 	struct AnimatedSceneObjectInfo
 	{
@@ -263,11 +316,19 @@ namespace bs
 		UINT32 numMorphShapes = 0;
 		UINT32 numMorphVertices = 0;
 		bool morphChannelWeightsDirty = false;
+		MorphShapeBuffers morphBuffers;
 
 		// Culling
 		AABox mBounds;
 		bool mCullEnabled = true;
 
+		// Level of detail
+		Vector<AnimationLODLevel> lodLevels;
+		AnimationLODState lodState;
+		LocalSkeletonPose lodFromPose;
+		LocalSkeletonPose lodToPose;
+		bool lodHasToPose = false;
+
 		// Single frame sample
 		AnimSampleStep sampleStep = AnimSampleStep::None;
 
@@ -341,6 +402,16 @@ namespace bs
 		/** @copydoc setCulling */
 		bool getCulling() const { return mCull; }
 
+		/**
+		 * Determines levels of detail at which to evaluate the animation, based on the size of the animation on screen.
+		 * Size is determined from the bounds provided in setBounds(). If no level applies the animation is evaluated on
+		 * every update.
+		 */
+		void setLODLevels(const Vector<AnimationLODLevel>& levels);
+
+		/** @copydoc setLODLevels */
+		const Vector<AnimationLODLevel>& getLODLevels() const { return mLODLevels; }
+
 		/**
 		 * Plays the specified animation clip.
 		 *
@@ -537,6 +608,7 @@ namespace bs
 		float mDefaultSpeed = 1.0f;
 		AABox mBounds;
 		bool mCull = true;
+		Vector<AnimationLODLevel> mLODLevels;
 		AnimDirtyState mDirty = AnimDirtyStateFlag::All;
 
 		SPtr<Skeleton> mSkeleton;
@@ -0,0 +1,108 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#include "Animation/BsAnimationLOD.h"
+
+namespace bs
+{
+	void AnimationLODScheduler::schedule(AnimationLODState** states, UINT32 numStates)
+	{
+		mUpdateIdx++;
+
+		const UINT32 maxBones = mMaxBonesPerUpdate > 0 ? mMaxBonesPerUpdate : std::numeric_limits<UINT32>::max();
+		UINT32 numBones = 0;
+
+		// Animations without a pose have nothing to display, so they must be evaluated regardless of the limit
+		for (UINT32 i = 0; i < numStates; i++)
+		{
+			AnimationLODState& state = *states[i];
+			if (state.hasPose)
+				state.action = AnimLODAction::Reuse;
+			else
+			{
+				state.action = AnimLODAction::Evaluate;
+				numBones += state.numBones;
+			}
+		}
+
+		// Evaluate animations that are due, starting from where the last update left off so postponed animations get
+		// evaluated first
+		UINT32 lastEvaluatedIdx = (UINT32)-1;
+		for (UINT32 i = 0; i < numStates; i++)
+		{
+			UINT32 idx = (mNextIdx + i) % numStates;
+
+			AnimationLODState& state = *states[idx];
+			if (state.action == AnimLODAction::Evaluate)
+				continue;
+
+			// Updates are split into windows of one interval each, offset by the animation ID so evaluations of
+			// animations at the same level are spread across updates. An animation is due once per window, on the first
+			// update of the window, or on a later one if it was postponed.
+			const UINT32 interval = std::max(state.updateInterval, 1U);
+			const UINT32 phase = (UINT32)((mUpdateIdx + state.id) % interval);
+			if (state.updatesSinceEvaluation < phase)
+				continue;
+
+			if (numBones > 0 && (numBones + state.numBones) > maxBones)
+				continue;
+
+			state.action = AnimLODAction::Evaluate;
+			numBones += state.numBones;
+			lastEvaluatedIdx = idx;
+		}
+
+		if (lastEvaluatedIdx != (UINT32)-1)
+			mNextIdx = lastEvaluatedIdx + 1;
+
+		mNumScheduledBones = numBones;
+
+		for (UINT32 i = 0; i < numStates; i++)
+		{
+			AnimationLODState& state = *states[i];
+			const UINT32 interval = std::max(state.updateInterval, 1U);
+
+			if (state.action == AnimLODAction::Evaluate)
+			{
+				// Blending from the currently displayed pose only makes sense if there is one
+				if (state.interpolate && state.hasPose)
+					state.interpolationFactor = 1.0f / interval;
+				else
+					state.interpolationFactor = 1.0f;
+
+				state.updatesSinceEvaluation = 0;
+				state.hasPose = true;
+			}
+			else
+			{
+				state.updatesSinceEvaluation++;
+
+				// Keep interpolating until the displayed pose reaches the evaluated pose, then keep displaying it
+				if (state.interpolate && state.updatesSinceEvaluation < interval)
+				{
+					state.action = AnimLODAction::Interpolate;
+					state.interpolationFactor = (state.updatesSinceEvaluation + 1) / (float)interval;
+				}
+				else
+				{
+					state.action = AnimLODAction::Reuse;
+					state.interpolationFactor = 1.0f;
+				}
+			}
+		}
+	}
+
+	const AnimationLODLevel* AnimationLODScheduler::selectLevel(const Vector<AnimationLODLevel>& levels, float screenSize)
+	{
+		const AnimationLODLevel* output = nullptr;
+		for (auto& entry : levels)
+		{
+			if (screenSize >= entry.screenSize)
+				continue;
+
+			if (output == nullptr || entry.screenSize < output->screenSize)
+				output = &entry;
+		}
+
+		return output;
+	}
+}
@@ -0,0 +1,136 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "BsCorePrerequisites.h"
+
+namespace bs
+{
+	/** @addtogroup Animation
+	 *  @{
+	 */
+
+	/**
+	 * Describes a level of detail at which an animation is evaluated. Lower levels of detail evaluate the animation less
+	 * often, reducing the CPU cost of animations that are far away or small on screen.
+	 */
+	struct BS_SCRIPT_EXPORT(pl:true,m:Animation) AnimationLODLevel
+	{
+		AnimationLODLevel() = default;
+
+		/**
+		 * Size of the animation on screen below which this level of detail is used. Size is the projected diameter of the
+		 * animation bounding sphere, relative to the viewport height.
+		 */
+		float screenSize = 0.0f;
+
+		/**
+		 * Number of animation updates between two evaluations of the animation. 1 means the animation is evaluated on
+		 * every update.
+		 */
+		UINT32 updateInterval = 1;
+
+		/**
+		 * If true, updates in between two evaluations will interpolate from the previously displayed pose towards the
+		 * most recently evaluated pose. This results in smoother movement at the cost of the displayed pose lagging
+		 * behind by up to @p updateInterval - 1 updates. If false the last evaluated pose is displayed until the next
+		 * evaluation.
+		 */
+		bool interpolate = true;
+	};
+
+	/** @} */
+
+	/** @addtogroup Animation-Internal
+	 *  @{
+	 */
+
+	/** Determines what should happen with an animation on a particular animation update. */
+	enum class AnimLODAction
+	{
+		Evaluate, /**< Animation should be fully evaluated. */
+		Interpolate, /**< Pose should be interpolated between two previously evaluated poses. */
+		Reuse /**< Pose from the previous update should be displayed as is. */
+	};
+
+	/** Information about a single animation used by AnimationLODScheduler. */
+	struct AnimationLODState
+	{
+		/** Unique ID of the animation. Used for spreading evaluations of different animations across updates. */
+		UINT64 id = 0;
+
+		/** Number of bones evaluated by the animation. Counts towards AnimationLODScheduler::setMaxBonesPerUpdate(). */
+		UINT32 numBones = 0;
+
+		/** Number of updates between two evaluations, as determined by the active AnimationLODLevel. */
+		UINT32 updateInterval = 1;
+
+		/** Determines if the pose should be interpolated in between evaluations. See AnimationLODLevel::interpolate. */
+		bool interpolate = false;
+
+		/** True if the animation was evaluated before. Animations without a pose are always evaluated. */
+		bool hasPose = false;
+
+		/** Number of updates that passed since the animation was last evaluated. */
+		UINT32 updatesSinceEvaluation = 0;
+
+		/** Action to perform on the animation on the current update. Assigned by the scheduler. */
+		AnimLODAction action = AnimLODAction::Evaluate;
+
+		/**
+		 * Factor in range [0, 1] to interpolate the pose with, from the previously displayed pose to the most recently
+		 * evaluated pose. Assigned by the scheduler.
+		 */
+		float interpolationFactor = 1.0f;
+	};
+
+	/**
+	 * Decides which animations are to be evaluated on a particular animation update. Animations are evaluated at the
+	 * rate determined by their level of detail, with evaluations of animations at the same level spread evenly across
+	 * updates. Optionally the total number of bones evaluated per update can be limited, in which case the animations are
+	 * evaluated in round-robin order and any animations over the limit are postponed for the next update.
+	 */
+	class BS_CORE_EXPORT AnimationLODScheduler
+	{
+	public:
+		/**
+		 * Determines the maximum number of bones to evaluate in a single update. Animations without a previously evaluated
+		 * pose are evaluated regardless of the limit. Zero means no limit.
+		 */
+		void setMaxBonesPerUpdate(UINT32 maxBones) { mMaxBonesPerUpdate = maxBones; }
+
+		/** @copydoc setMaxBonesPerUpdate */
+		UINT32 getMaxBonesPerUpdate() const { return mMaxBonesPerUpdate; }
+
+		/**
+		 * Assigns an action to perform on the current update to each of the provided animations, and advances the
+		 * per-animation update counters. Should be called once per animation update.
+		 *
+		 * @param[in, out]	states		Animations to schedule. Order must be kept the same between updates for the
+		 *								round-robin scheduling to remain fair.
+		 * @param[in]		numStates	Number of entries in the @p states array.
+		 */
+		void schedule(AnimationLODState** states, UINT32 numStates);
+
+		/** Returns the number of bones scheduled for evaluation on the last call to schedule(). */
+		UINT32 getNumScheduledBones() const { return mNumScheduledBones; }
+
+		/**
+		 * Selects the level of detail to use for an animation of the specified size on screen.
+		 *
+		 * @param[in]	levels		Levels of detail to pick from.
+		 * @param[in]	screenSize	Projected diameter of the animation bounding sphere, relative to the viewport height.
+		 * @return					Level with the smallest screen size that is still larger than @p screenSize, or null
+		 *							if the animation should be evaluated at full detail.
+		 */
+		static const AnimationLODLevel* selectLevel(const Vector<AnimationLODLevel>& levels, float screenSize);
+
+	private:
+		UINT32 mMaxBonesPerUpdate = 0;
+		UINT32 mNumScheduledBones = 0;
+		UINT32 mNextIdx = 0;
+		UINT64 mUpdateIdx = 0;
+	};
+
+	/** @} */
+}
@@ -9,10 +9,12 @@
 #include "Renderer/BsCamera.h"
 #include "Animation/BsMorphShapes.h"
 #include "Mesh/BsMeshData.h"
-#include "Mesh/BsMeshUtility.h"
 
 namespace bs
 {
+	static_assert(MorphShapeBuffers::NUM_BUFFERS >= CoreThread::NUM_SYNC_BUFFERS + 1,
+		"Morph shape buffers could get overwritten while still in use by the renderer.");
+
 	AnimationManager::AnimationManager()
 	{
 		mBlendShapeVertexDesc = VertexDataDesc::create();
@@ -33,6 +35,11 @@ namespace bs
 		mUpdateRate = 1.0f / fps;
 	}
 
+	void AnimationManager::setMaxBonesPerUpdate(UINT32 maxBones)
+	{
+		mLODScheduler.setMaxBonesPerUpdate(maxBones);
+	}
+
 	const EvaluatedAnimationData* AnimationManager::update(bool async)
 	{
 		// Wait for any workers to complete
@@ -84,8 +91,9 @@ namespace bs
 			mProxies.push_back(anim.second->mAnimProxy);
 		}
 
-		// Build frustums for culling
+		// Build frustums for culling, and view information for level of detail selection
 		mCullFrustums.clear();
+		mLODViews.clear();
 
 		auto& allCameras = gSceneManager().getAllCameras();
 		for(auto& entry : allCameras)
@@ -98,8 +106,68 @@ namespace bs
 			// TODO: Not checking if camera and animation renderable's layers match. If we checked more animations could
 			// be culled.
 			mCullFrustums.push_back(entry.second->getWorldFrustum());
+
+			LODView lodView;
+			lodView.position = entry.second->getTransform().getPosition();
+			lodView.projScale = Math::abs(entry.second->getProjectionMatrixRS()[1][1]);
+			lodView.orthographic = entry.second->getProjectionType() == PT_ORTHOGRAPHIC;
+
+			mLODViews.push_back(lodView);
+		}
+
+		// Cull animations and pick the ones to evaluate this update, depending on their level of detail
+		mLODStates.clear();
+		for (auto& anim : mProxies)
+		{
+			if (anim->mCullEnabled)
+			{
+				bool isVisible = false;
+				for (auto& frustum : mCullFrustums)
+				{
+					if (frustum.intersects(anim->mBounds))
+					{
+						isVisible = true;
+						break;
+					}
+				}
+
+				if (!isVisible)
+				{
+					anim->wasCulled = true;
+					anim->lodState.hasPose = false;
+					continue;
+				}
+			}
+
+			anim->wasCulled = false;
+
+			AnimationLODState& lodState = anim->lodState;
+			lodState.numBones = anim->skeleton != nullptr ? anim->skeleton->getNumBones() : 0;
+
+			const AnimationLODLevel* lodLevel = nullptr;
+			if (!anim->lodLevels.empty())
+				lodLevel = AnimationLODScheduler::selectLevel(anim->lodLevels, getScreenSize(anim->mBounds));
+
+			if (lodLevel != nullptr)
+			{
+				lodState.updateInterval = lodLevel->updateInterval;
+				lodState.interpolate = lodLevel->interpolate;
+			}
+			else
+			{
+				lodState.updateInterval = 1;
+				lodState.interpolate = false;
+			}
+
+			// Single frame samples must always be displayed exactly
+			if (anim->sampleStep == AnimSampleStep::Frame)
+				lodState.hasPose = false;
+
+			mLODStates.push_back(&lodState);
 		}
 
+		mLODScheduler.schedule(mLODStates.data(), (UINT32)mLODStates.size());
+
 		// Prepare the write buffer
 		UINT32 totalNumBones = 0;
 		for (auto& anim : mProxies)
@@ -116,12 +184,20 @@ namespace bs
 		// Queue animation evaluation tasks
 		{
 			Lock lock(mMutex);
-			mNumActiveWorkers = (UINT32)mProxies.size();
+			mNumActiveWorkers = (UINT32)mLODStates.size();
 		}
 
 		UINT32 curBoneIdx = 0;
 		for (auto& anim : mProxies)
 		{
+			if (anim->wasCulled)
+			{
+				if (anim->skeleton != nullptr)
+					curBoneIdx += anim->skeleton->getNumBones();
+
+				continue;
+			}
+
 			auto evaluateAnimWorker = [this, anim, curBoneIdx]()
 			{
 				UINT32 boneIdx = curBoneIdx;
@@ -173,30 +249,35 @@ namespace bs
 		return output;
 	}
 
-	void AnimationManager::evaluateAnimation(AnimationProxy* anim, UINT32& curBoneIdx)
+	float AnimationManager::getScreenSize(const AABox& bounds) const
 	{
-		// Culling
-		if (anim->mCullEnabled)
+		if (mLODViews.empty())
+			return std::numeric_limits<float>::infinity();
+
+		const Vector3 center = bounds.getCenter();
+		const float radius = bounds.getSize().length() * 0.5f;
+
+		float screenSize = 0.0f;
+		for (auto& view : mLODViews)
 		{
-			bool isVisible = false;
-			for (auto& frustum : mCullFrustums)
+			if (view.orthographic)
 			{
-				if (frustum.intersects(anim->mBounds))
-				{
-					isVisible = true;
-					break;
-				}
+				screenSize = std::max(screenSize, radius * view.projScale);
+				continue;
 			}
 
-			if (!isVisible)
-			{
-				anim->wasCulled = true;
-				return;
-			}
+			const float distance = center.distance(view.position);
+			if (distance <= radius)
+				return std::numeric_limits<float>::infinity();
+
+			screenSize = std::max(screenSize, radius * view.projScale / distance);
 		}
 
-		anim->wasCulled = false;
+		return screenSize;
+	}
 
+	void AnimationManager::evaluateAnimation(AnimationProxy* anim, UINT32& curBoneIdx)
+	{
 		// Evaluation
 		EvaluatedAnimationData& renderData = mAnimData[mPoseWriteBufferIdx];
 		
@@ -206,6 +287,8 @@ namespace bs
 		EvaluatedAnimationData::AnimInfo animInfo;
 		bool hasAnimInfo = false;
 
+		AnimLODAction action = anim->lodState.action;
+
 		// Evaluate skeletal animation
 		if (anim->skeleton != nullptr)
 		{
@@ -233,8 +316,42 @@ namespace bs
 				boneTfrmIdx++;
 			}
 
-			// Animate bones
-			anim->skeleton->getPose(boneDst, anim->skeletonPose, anim->skeletonMask, anim->layers, anim->numLayers);
+			// Animate bones, fully or from previous results depending on the level of detail
+			if (action == AnimLODAction::Interpolate && !anim->lodHasToPose)
+				action = AnimLODAction::Reuse;
+
+			if (action == AnimLODAction::Reuse)
+			{
+				auto iterFind = prevRenderData.infos.find(anim->id);
+				if (iterFind != prevRenderData.infos.end() && iterFind->second.poseInfo.numBones == numBones)
+				{
+					const Matrix4* boneSrc = prevRenderData.transforms.data() + iterFind->second.poseInfo.startIdx;
+					memcpy(boneDst, boneSrc, sizeof(Matrix4) * numBones);
+				}
+				else
+					action = AnimLODAction::Evaluate;
+			}
+
+			if (action == AnimLODAction::Evaluate)
+			{
+				if (anim->lodState.interpolate)
+					evaluateInterpolatedPose(anim, boneDst);
+				else
+				{
+					anim->skeleton->getPose(boneDst, anim->skeletonPose, anim->skeletonMask, anim->layers,
+						anim->numLayers);
+					anim->lodHasToPose = false;
+				}
+			}
+			else if (action == AnimLODAction::Interpolate)
+			{
+				LocalSkeletonPose& localPose = anim->skeletonPose;
+				for (UINT32 i = 0; i < numBones; i++)
+					localPose.hasOverride[i] &= anim->lodToPose.hasOverride[i];
+
+				anim->skeleton->getPose(boneDst, localPose, anim->lodFromPose, anim->lodToPose,
+					anim->lodState.interpolationFactor);
+			}
 
 			curBoneIdx += numBones;
 			hasAnimInfo = true;
@@ -247,77 +364,81 @@ namespace bs
 			poseInfo.numBones = 0;
 		}
 
-		// Reset mapped SO transform
-		for (UINT32 i = 0; i < anim->sceneObjectPose.numBones; i++)
+		// Scene object and generic curves are only updated when the animation is fully evaluated
+		if (action == AnimLODAction::Evaluate)
 		{
-			anim->sceneObjectPose.positions[i] = Vector3::ZERO;
-			anim->sceneObjectPose.rotations[i] = Quaternion::IDENTITY;
-			anim->sceneObjectPose.scales[i] = Vector3::ONE;
-		}
+			// Reset mapped SO transform
+			for (UINT32 i = 0; i < anim->sceneObjectPose.numBones; i++)
+			{
+				anim->sceneObjectPose.positions[i] = Vector3::ZERO;
+				anim->sceneObjectPose.rotations[i] = Quaternion::IDENTITY;
+				anim->sceneObjectPose.scales[i] = Vector3::ONE;
+			}
 
-		// Update mapped scene objects
-		memset(anim->sceneObjectPose.hasOverride, 1, sizeof(bool) * 3 * anim->numSceneObjects);
+			// Update mapped scene objects
+			memset(anim->sceneObjectPose.hasOverride, 1, sizeof(bool) * 3 * anim->numSceneObjects);
 
-		// Update scene object transforms
-		for (UINT32 i = 0; i < anim->numSceneObjects; i++)
-		{
-			const AnimatedSceneObjectInfo& soInfo = anim->sceneObjectInfos[i];
+			// Update scene object transforms
+			for (UINT32 i = 0; i < anim->numSceneObjects; i++)
+			{
+				const AnimatedSceneObjectInfo& soInfo = anim->sceneObjectInfos[i];
 
-			// We already evaluated bones
-			if (soInfo.boneIdx != -1)
-				continue;
+				// We already evaluated bones
+				if (soInfo.boneIdx != -1)
+					continue;
 
-			if (soInfo.layerIdx == -1 || soInfo.stateIdx == -1)
-				continue;
+				if (soInfo.layerIdx == -1 || soInfo.stateIdx == -1)
+					continue;
 
-			const AnimationState& state = anim->layers[soInfo.layerIdx].states[soInfo.stateIdx];
-			if (state.disabled)
-				continue;
+				const AnimationState& state = anim->layers[soInfo.layerIdx].states[soInfo.stateIdx];
+				if (state.disabled)
+					continue;
 
-			{
-				UINT32 curveIdx = soInfo.curveIndices.position;
-				if (curveIdx != (UINT32)-1)
 				{
-					const TAnimationCurve<Vector3>& curve = state.curves->position[curveIdx].curve;
-					anim->sceneObjectPose.positions[curveIdx] = curve.evaluate(state.time, state.positionCaches[curveIdx], false);
-					anim->sceneObjectPose.hasOverride[i * 3 + 0] = false;
+					UINT32 curveIdx = soInfo.curveIndices.position;
+					if (curveIdx != (UINT32)-1)
+					{
+						const TAnimationCurve<Vector3>& curve = state.curves->position[curveIdx].curve;
+						anim->sceneObjectPose.positions[curveIdx] = curve.evaluate(state.time, state.positionCaches[curveIdx], false);
+						anim->sceneObjectPose.hasOverride[i * 3 + 0] = false;
+					}
 				}
-			}
 
-			{
-				UINT32 curveIdx = soInfo.curveIndices.rotation;
-				if (curveIdx != (UINT32)-1)
 				{
-					const TAnimationCurve<Quaternion>& curve = state.curves->rotation[curveIdx].curve;
-					anim->sceneObjectPose.rotations[curveIdx] = curve.evaluate(state.time, state.rotationCaches[curveIdx], false);
-					anim->sceneObjectPose.rotations[curveIdx].normalize();
-					anim->sceneObjectPose.hasOverride[i * 3 + 1] = false;
+					UINT32 curveIdx = soInfo.curveIndices.rotation;
+					if (curveIdx != (UINT32)-1)
+					{
+						const TAnimationCurve<Quaternion>& curve = state.curves->rotation[curveIdx].curve;
+						anim->sceneObjectPose.rotations[curveIdx] = curve.evaluate(state.time, state.rotationCaches[curveIdx], false);
+						anim->sceneObjectPose.rotations[curveIdx].normalize();
+						anim->sceneObjectPose.hasOverride[i * 3 + 1] = false;
+					}
 				}
-			}
 
-			{
-				UINT32 curveIdx = soInfo.curveIndices.scale;
-				if (curveIdx != (UINT32)-1)
 				{
-					const TAnimationCurve<Vector3>& curve = state.curves->scale[curveIdx].curve;
-					anim->sceneObjectPose.scales[curveIdx] = curve.evaluate(state.time, state.scaleCaches[curveIdx], false);
-					anim->sceneObjectPose.hasOverride[i * 3 + 2] = false;
+					UINT32 curveIdx = soInfo.curveIndices.scale;
+					if (curveIdx != (UINT32)-1)
+					{
+						const TAnimationCurve<Vector3>& curve = state.curves->scale[curveIdx].curve;
+						anim->sceneObjectPose.scales[curveIdx] = curve.evaluate(state.time, state.scaleCaches[curveIdx], false);
+						anim->sceneObjectPose.hasOverride[i * 3 + 2] = false;
+					}
 				}
 			}
-		}
 
-		// Update generic curves
-		// Note: No blending for generic animations, just use first animation
-		if (anim->numLayers > 0 && anim->layers[0].numStates > 0)
-		{
-			const AnimationState& state = anim->layers[0].states[0];
-			if (!state.disabled)
+			// Update generic curves
+			// Note: No blending for generic animations, just use first animation
+			if (anim->numLayers > 0 && anim->layers[0].numStates > 0)
 			{
-				UINT32 numCurves = (UINT32)state.curves->generic.size();
-				for (UINT32 i = 0; i < numCurves; i++)
+				const AnimationState& state = anim->layers[0].states[0];
+				if (!state.disabled)
 				{
-					const TAnimationCurve<float>& curve = state.curves->generic[i].curve;
-					anim->genericCurveOutputs[i] = curve.evaluate(state.time, state.genericCaches[i], false);
+					UINT32 numCurves = (UINT32)state.curves->generic.size();
+					for (UINT32 i = 0; i < numCurves; i++)
+					{
+						const TAnimationCurve<float>& curve = state.curves->generic[i].curve;
+						anim->genericCurveOutputs[i] = curve.evaluate(state.time, state.genericCaches[i], false);
+					}
 				}
 			}
 		}
@@ -325,12 +446,6 @@ namespace bs
 		// Update morph shapes
 		if (anim->numMorphShapes > 0)
 		{
-			auto iterFind = prevRenderData.infos.find(anim->id);
-			if (iterFind != prevRenderData.infos.end())
-				animInfo.morphShapeInfo = iterFind->second.morphShapeInfo;
-			else
-				animInfo.morphShapeInfo.version = 1; // 0 is considered invalid version
-
 			// Recalculate weights if curves are present
 			bool hasMorphCurves = false;
 			for (UINT32 i = 0; i < anim->numMorphChannels; i++)
@@ -440,73 +555,20 @@ namespace bs
 			}
 
 			// Generate morph shape vertices
-			if (anim->morphChannelWeightsDirty || hasMorphCurves)
+			MorphShapeBuffers& morphBuffers = anim->morphBuffers;
+			if (anim->morphChannelWeightsDirty || (hasMorphCurves && action == AnimLODAction::Evaluate))
 			{
-				SPtr<MeshData> meshData = bs_shared_ptr_new<MeshData>(anim->numMorphVertices, 0, mBlendShapeVertexDesc);
-
-				UINT8* bufferData = meshData->getData();
-				memset(bufferData, 0, meshData->getSize());
-
-				UINT32 tempDataSize = (sizeof(Vector3) + sizeof(float)) * anim->numMorphVertices;
-				UINT8* tempData = (UINT8*)bs_stack_alloc(tempDataSize);
-				memset(tempData, 0, tempDataSize);
-
-				Vector3* tempNormals = (Vector3*)tempData;
-				float* accumulatedWeight = (float*)(tempData + sizeof(Vector3) * anim->numMorphVertices);
-
-				UINT8* positions = meshData->getElementData(VES_POSITION, 1, 1);
-				UINT8* normals = meshData->getElementData(VES_NORMAL, 1, 1);
-
-				UINT32 stride = mBlendShapeVertexDesc->getVertexStride(1);
-
-				for (UINT32 i = 0; i < anim->numMorphShapes; i++)
-				{
-					const MorphShapeInfo& info = anim->morphShapeInfos[i];
-					float absWeight = Math::abs(info.finalWeight);
+				morphBuffers.blend(anim->morphShapeInfos, anim->numMorphShapes, anim->numMorphVertices,
+					mBlendShapeVertexDesc);
 
-					if (absWeight < 0.0001f)
-						continue;
-
-					const Vector<MorphVertex>& morphVertices = info.shape->getVertices();
-					UINT32 numVertices = (UINT32)morphVertices.size();
-					for (UINT32 j = 0; j < numVertices; j++)
-					{
-						const MorphVertex& vertex = morphVertices[j];
-
-						Vector3* destPos = (Vector3*)(positions + vertex.sourceIdx * stride);
-						*destPos += vertex.deltaPosition * info.finalWeight;
-
-						tempNormals[vertex.sourceIdx] += vertex.deltaNormal * info.finalWeight;
-						accumulatedWeight[vertex.sourceIdx] += absWeight;
-					}
-				}
-
-				for (UINT32 i = 0; i < anim->numMorphVertices; i++)
-				{
-					PackedNormal* destNrm = (PackedNormal*)(normals + i * stride);
-
-					if (accumulatedWeight[i] > 0.0001f)
-					{
-						Vector3 normal = tempNormals[i] / accumulatedWeight[i];
-						normal /= 2.0f; // Accumulated normal is in range [-2, 2] but our normal packing method assumes [-1, 1] range
-
-						MeshUtility::packNormals(&normal, (UINT8*)destNrm, 1, sizeof(Vector3), stride);
-						destNrm->w = (UINT8)(std::min(1.0f, accumulatedWeight[i]) * 255.999f);
-					}
-					else
-					{
-						*destNrm = { { 127, 127, 127, 0 } };
-					}
-				}
-
-				bs_stack_free(tempData);
-
-				animInfo.morphShapeInfo.meshData = meshData;
-
-				animInfo.morphShapeInfo.version++;
 				anim->morphChannelWeightsDirty = false;
 			}
 
+			animInfo.morphShapeInfo.meshData = morphBuffers.getCurrent();
+			animInfo.morphShapeInfo.version = morphBuffers.version;
+			animInfo.morphShapeInfo.dirtyStart = morphBuffers.dirtyStart;
+			animInfo.morphShapeInfo.dirtyEnd = morphBuffers.dirtyEnd;
+
 			hasAnimInfo = true;
 		}
 		else
@@ -519,6 +581,45 @@ namespace bs
 		}
 	}
 
+	void AnimationManager::evaluateInterpolatedPose(AnimationProxy* anim, Matrix4* boneDst)
+	{
+		const UINT32 numBones = anim->skeleton->getNumBones();
+		if (anim->lodToPose.numBones != numBones)
+		{
+			anim->lodFromPose = LocalSkeletonPose(numBones);
+			anim->lodToPose = LocalSkeletonPose(numBones);
+		}
+
+		LocalSkeletonPose& localPose = anim->skeletonPose;
+		LocalSkeletonPose& fromPose = anim->lodFromPose;
+		LocalSkeletonPose& toPose = anim->lodToPose;
+
+		const float t = anim->lodState.interpolationFactor;
+
+		// Continue from the currently displayed pose, so there are no discontinuities if the evaluation happens before
+		// the last interpolation finished
+		if (t < 1.0f)
+		{
+			memcpy(fromPose.positions, localPose.positions, sizeof(Vector3) * numBones);
+			memcpy(fromPose.rotations, localPose.rotations, sizeof(Quaternion) * numBones);
+			memcpy(fromPose.scales, localPose.scales, sizeof(Vector3) * numBones);
+		}
+
+		memcpy(toPose.hasOverride, localPose.hasOverride, sizeof(bool) * numBones);
+		anim->skeleton->getPose(boneDst, toPose, anim->skeletonMask, anim->layers, anim->numLayers);
+		anim->lodHasToPose = true;
+
+		memcpy(localPose.hasOverride, toPose.hasOverride, sizeof(bool) * numBones);
+		if (t < 1.0f)
+			anim->skeleton->getPose(boneDst, localPose, fromPose, toPose, t);
+		else
+		{
+			memcpy(localPose.positions, toPose.positions, sizeof(Vector3) * numBones);
+			memcpy(localPose.rotations, toPose.rotations, sizeof(Quaternion) * numBones);
+			memcpy(localPose.scales, toPose.scales, sizeof(Vector3) * numBones);
+		}
+	}
+
 	UINT64 AnimationManager::registerAnimation(Animation* anim)
 	{
 		mAnimations[mNextId] = anim;
@@ -7,6 +7,7 @@
 #include "CoreThread/BsCoreThread.h"
 #include "Math/BsConvexVolume.h"
 #include "RenderAPI/BsVertexDataDesc.h"
+#include "Animation/BsAnimationLOD.h"
 
 namespace bs
 {
@@ -32,6 +33,13 @@ namespace bs
 		{
 			SPtr<MeshData> meshData;
 			UINT32 version;
+
+			/**
+			 * Range of vertices, [start, end), that changed compared to the previous version. Only valid if the data
+			 * for the previous version was seen, otherwise all of the data must be considered changed.
+			 */
+			UINT32 dirtyStart = 0;
+			UINT32 dirtyEnd = 0;
 		};
 
 		/** Contains meta-data about where calculated animation data is stored. */
@@ -73,6 +81,13 @@ namespace bs
 		 */
 		void setUpdateRate(UINT32 fps);
 
+		/**
+		 * Determines the maximum number of skeleton bones to evaluate in a single animation update. Animations over the
+		 * limit are postponed to one of the following updates, in round-robin order, and display their previous pose in
+		 * the meantime. Zero means no limit (default).
+		 */
+		void setMaxBonesPerUpdate(UINT32 maxBones);
+
 		/**
 		 * Evaluates animations for all animated objects, and returns the evaluated skeleton bone poses and morph shape
 		 * meshes that can be passed along to the renderer.
@@ -108,6 +123,20 @@ namespace bs
 		/** Unregisters an animation with the specified ID. Must be called before an Animation is destroyed. */
 		void unregisterAnimation(UINT64 id);
 
+		/** Information about a view used for determining animation level of detail. */
+		struct LODView
+		{
+			Vector3 position;
+			float projScale;
+			bool orthographic;
+		};
+
+		/**
+		 * Returns the largest size of the provided bounds on screen, across all views. Size is the projected diameter of
+		 * the bounding sphere, relative to the viewport height.
+		 */
+		float getScreenSize(const AABox& bounds) const;
+
 		/**
 		 * Evaluates animation for a single object and writes the result in the currently active write buffer.
 		 *
@@ -117,6 +146,16 @@ namespace bs
 		 */
 		void evaluateAnimation(AnimationProxy* anim, UINT32& boneIdx);
 
+		/**
+		 * Evaluates the skeleton pose of an animation whose level of detail requires interpolation. The evaluated pose is
+		 * stored as the pose to interpolate to, while the currently displayed pose becomes the pose to interpolate from.
+		 *
+		 * @param[in]	anim		Proxy representing the animation to evaluate.
+		 * @param[out]	boneDst		Output buffer to write the interpolated bone transforms to. Must contain transforms
+		 *							for any bones overridden by scene objects.
+		 */
+		void evaluateInterpolatedPose(AnimationProxy* anim, Matrix4* boneDst);
+
 		UINT64 mNextId = 1;
 		UnorderedMap<UINT64, Animation*> mAnimations;
 		
@@ -132,6 +171,9 @@ namespace bs
 		// Animation thread
 		Vector<SPtr<AnimationProxy>> mProxies;
 		Vector<ConvexVolume> mCullFrustums;
+		Vector<LODView> mLODViews;
+		Vector<AnimationLODState*> mLODStates;
+		AnimationLODScheduler mLODScheduler;
 		EvaluatedAnimationData mAnimData[CoreThread::NUM_SYNC_BUFFERS + 1];
 
 		UINT32 mPoseReadBufferIdx = 2;
@@ -7,7 +7,9 @@ namespace bs
 {
 	MorphShape::MorphShape(const String& name, float weight, const Vector<MorphVertex>& vertices)
 		:mName(name), mWeight(weight), mVertices(vertices)
-	{ }
+	{
+		buildBlendData();
+	}
 
 	/** Creates a new morph shape from the provided set of vertices. */
 	SPtr<MorphShape> MorphShape::create(const String& name, float weight, const Vector<MorphVertex>& vertices)
@@ -15,6 +17,51 @@ namespace bs
 		return bs_shared_ptr_new<MorphShape>(name, weight, vertices);
 	}
 
+	void MorphShape::buildBlendData()
+	{
+		const UINT32 numVertices = (UINT32)mVertices.size();
+
+		Vector<UINT32> order(numVertices);
+		for(UINT32 i = 0; i < numVertices; i++)
+			order[i] = i;
+
+		std::stable_sort(order.begin(), order.end(),
+			[this](UINT32 a, UINT32 b)
+		{
+			return mVertices[a].sourceIdx < mVertices[b].sourceIdx;
+		});
+
+		mBlendData.sourceIndices.resize(numVertices);
+		for(UINT32 i = 0; i < 3; i++)
+		{
+			mBlendData.deltaPositions[i].resize(numVertices);
+			mBlendData.deltaNormals[i].resize(numVertices);
+		}
+
+		for(UINT32 i = 0; i < numVertices; i++)
+		{
+			const MorphVertex& vertex = mVertices[order[i]];
+
+			mBlendData.sourceIndices[i] = vertex.sourceIdx;
+			for(UINT32 j = 0; j < 3; j++)
+			{
+				mBlendData.deltaPositions[j][i] = vertex.deltaPosition[j];
+				mBlendData.deltaNormals[j][i] = vertex.deltaNormal[j];
+			}
+		}
+
+		if(numVertices > 0)
+		{
+			mBlendData.minIndex = mBlendData.sourceIndices.front();
+			mBlendData.maxIndex = mBlendData.sourceIndices.back() + 1;
+		}
+		else
+		{
+			mBlendData.minIndex = 0;
+			mBlendData.maxIndex = 0;
+		}
+	}
+
 	RTTITypeBase* MorphShape::getRTTIStatic()
 	{
 		return MorphShapeRTTI::instance();
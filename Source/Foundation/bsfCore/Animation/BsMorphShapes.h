@@ -25,6 +25,28 @@ namespace bs
 		UINT32 sourceIdx;
 	};
 
+	/**
+	 * Vertices of a single morph shape, stored as separate arrays for each component and sorted by the index of the
+	 * source vertex. Allows the shapes to be blended using SIMD instructions.
+	 */
+	struct MorphShapeBlendData
+	{
+		/** Indices of the base mesh vertices modified by the shape, in increasing order. */
+		Vector<UINT32> sourceIndices;
+
+		/** X, Y and Z components of the position deltas, in the same order as @p sourceIndices. */
+		Vector<float> deltaPositions[3];
+
+		/** X, Y and Z components of the normal deltas, in the same order as @p sourceIndices. */
+		Vector<float> deltaNormals[3];
+
+		/** Smallest source vertex index referenced by the shape. */
+		UINT32 minIndex = 0;
+
+		/** One past the largest source vertex index referenced by the shape. Zero if the shape has no vertices. */
+		UINT32 maxIndex = 0;
+	};
+
 	/**
 	 * @native
 	 * A set of vertices representing a single shape in a morph target animation. Vertices are represented as a difference
@@ -51,6 +73,9 @@ namespace bs
 		/** Returns a reference to all of the shape's vertices. Contains only vertices that differ from the base. */
 		const Vector<MorphVertex>& getVertices() const { return mVertices; }
 
+		/** Returns the shape's vertices in a form suitable for blending. Contains the same data as getVertices(). */
+		const MorphShapeBlendData& getBlendData() const { return mBlendData; }
+
 		/**
 		 * Creates a new morph shape from the provided set of vertices.
 		 *
@@ -63,9 +88,13 @@ namespace bs
 		static SPtr<MorphShape> create(const String& name, float weight, const Vector<MorphVertex>& vertices);
 
 	private:
+		/** Populates the blend data from the current set of vertices. */
+		void buildBlendData();
+
 		String mName;
 		float mWeight;
 		Vector<MorphVertex> mVertices;
+		MorphShapeBlendData mBlendData;
 
 		/************************************************************************/
 		/* 								SERIALIZATION                      		*/
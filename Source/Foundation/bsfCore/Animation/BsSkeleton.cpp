@@ -4,6 +4,7 @@
 #include "Animation/BsAnimationClip.h"
 #include "Animation/BsSkeletonMask.h"
 #include "Private/RTTI/BsSkeletonRTTI.h"
+#include "Math/BsSIMD.h"
 
 namespace bs
 {
@@ -83,6 +84,8 @@ namespace bs
 			mBoneInfo[i].name = bones[i].name;
 			mBoneInfo[i].parent = bones[i].parent;
 		}
+
+		buildEvaluationOrder();
 	}
 
 	Skeleton::~Skeleton()
@@ -95,6 +98,9 @@ namespace bs
 
 		if (mBoneInfo != nullptr)
 			bs_deleteN(mBoneInfo, mNumBones);
+
+		if (mEvaluationOrder != nullptr)
+			bs_free(mEvaluationOrder);
 	}
 
 	SPtr<Skeleton> Skeleton::create(BONE_DESC* bones, UINT32 numBones)
@@ -137,31 +143,87 @@ namespace bs
 
 			clip.getBoneMapping(*this, state.boneToCurveMapping);
 
+			FrameVector<AnimationBoneTrack> activeTracks(mNumBones);
+			state.activeTracks = activeTracks.data();
+			state.numActiveTracks = getActiveTracks(state.boneToCurveMapping, mask, state.activeTracks);
+
 			getPose(pose, localPose, mask, &layer, 1);
 		}
 		bs_frame_clear();
 	}
 
+	/** Multiplies two affine 4x4 matrices using vector instructions. @p output may reference either of the inputs. */
+	static void multiplyAffine(const Matrix4& lhs, const Matrix4& rhs, Matrix4& output)
+	{
+		using namespace simd;
+
+		float32x4 rhsRows[3];
+		for(UINT32 i = 0; i < 3; i++)
+			rhsRows[i] = load_u<float32x4>(&rhs[i]);
+
+		const float32x4 translation = make_float<float32x4>(0.0f, 0.0f, 0.0f, 1.0f);
+
+		float32x4 rows[3];
+		for(UINT32 i = 0; i < 3; i++)
+		{
+			float32x4 row = mul(splat<float32x4>(lhs[i][0]), rhsRows[0]);
+			row = add(row, mul(splat<float32x4>(lhs[i][1]), rhsRows[1]));
+			row = add(row, mul(splat<float32x4>(lhs[i][2]), rhsRows[2]));
+			rows[i] = add(row, mul(splat<float32x4>(lhs[i][3]), translation));
+		}
+
+		for(UINT32 i = 0; i < 3; i++)
+			store_u(&output[i], rows[i]);
+
+		output[3][0] = 0.0f; output[3][1] = 0.0f; output[3][2] = 0.0f; output[3][3] = 1.0f;
+	}
+
+	/** Builds a matrix from translation, rotation and scale, using vector instructions for applying the scale. */
+	static void composeTRS(const Vector3& position, const Quaternion& rotation, const Vector3& scale, Matrix4& output)
+	{
+		using namespace simd;
+
+		Matrix3 rot3x3;
+		rotation.toRotationMatrix(rot3x3);
+
+		const float32x4 scaleVec = make_float<float32x4>(scale.x, scale.y, scale.z, 1.0f);
+		for(UINT32 i = 0; i < 3; i++)
+		{
+			float32x4 row = make_float<float32x4>(rot3x3[i][0], rot3x3[i][1], rot3x3[i][2], position[i]);
+			store_u(&output[i], mul(row, scaleVec));
+		}
+
+		output[3][0] = 0.0f; output[3][1] = 0.0f; output[3][2] = 0.0f; output[3][3] = 1.0f;
+	}
+
 	void Skeleton::getPose(Matrix4* pose, LocalSkeletonPose& localPose, const SkeletonMask& mask,
 		const AnimationStateLayer* layers, UINT32 numLayers)
 	{
-		// Note: If more performance is required this method could be optimized with vector instructions
+		using namespace simd;
 
 		assert(localPose.numBones == mNumBones);
+		assert(mNumBones == 0 || mEvaluationOrder != nullptr);
 
+		// Positions and scales are accumulated as 4-component vectors, so all blending can use vector instructions.
+		// Rotations are accumulated directly in the local pose, as quaternions already have 4 components.
+		Vector4* positions = bs_stack_alloc<Vector4>(mNumBones);
+		Vector4* scales = bs_stack_alloc<Vector4>(mNumBones);
+		bool* hasAnimCurve = bs_stack_alloc<bool>(mNumBones);
+
+		const float32x4 zero = make_zero();
+		const float32x4 one = splat<float32x4>(1.0f);
 		for(UINT32 i = 0; i < mNumBones; i++)
 		{
-			localPose.positions[i] = Vector3::ZERO;
-			localPose.rotations[i] = Quaternion::ZERO;
-			localPose.scales[i] = Vector3::ONE;
+			store_u(&positions[i], zero);
+			store_u(&scales[i], one);
+			store_u(&localPose.rotations[i], zero);
 		}
 
-		bool* hasAnimCurve = bs_stack_alloc<bool>(mNumBones);
 		bs_zero_out(hasAnimCurve, mNumBones);
 
-		// Note: For a possible performance improvement consider keeping an array of only active (non-disabled) bones and
-		// just iterate over them without mask checks. Possibly also a list of active curve mappings to avoid those checks
-		// as well.
+		// Used for states that weren't provided with a pre-built list of active tracks
+		AnimationBoneTrack* tempTracks = nullptr;
+
 		for(UINT32 i = 0; i < numLayers; i++)
 		{
 			const AnimationStateLayer& layer = layers[i];
@@ -190,134 +252,227 @@ namespace bs
 				if (Math::approxEquals(normWeight, 0.0f))
 					continue;
 
-				for (UINT32 k = 0; k < mNumBones; k++)
+				const AnimationBoneTrack* tracks = state.activeTracks;
+				UINT32 numTracks = state.numActiveTracks;
+				if(tracks == nullptr)
+				{
+					if(tempTracks == nullptr)
+						tempTracks = bs_stack_alloc<AnimationBoneTrack>(mNumBones);
+
+					numTracks = getActiveTracks(state.boneToCurveMapping, mask, tempTracks);
+					tracks = tempTracks;
+				}
+
+				const float32x4 weight = splat<float32x4>(normWeight);
+				for (UINT32 k = 0; k < numTracks; k++)
 				{
-					if (!mask.isEnabled(k))
-						continue;
+					const AnimationBoneTrack& track = tracks[k];
+					const UINT32 boneIdx = track.boneIdx;
 
-					const AnimationCurveMapping& mapping = state.boneToCurveMapping[k];
-					UINT32 curveIdx = mapping.position;
+					UINT32 curveIdx = track.curves.position;
 					if (curveIdx != (UINT32)-1)
 					{
 						const TAnimationCurve<Vector3>& curve = state.curves->position[curveIdx].curve;
-						localPose.positions[k] += curve.evaluate(state.time, state.positionCaches[curveIdx], false) * normWeight;
+						Vector3 value = curve.evaluate(state.time, state.positionCaches[curveIdx], false);
 
-						localPose.hasOverride[k] = false;
-						hasAnimCurve[k] = true;
+						float32x4 position = load_u<float32x4>(&positions[boneIdx]);
+						position = add(position, mul(make_float<float32x4>(value.x, value.y, value.z, 0.0f), weight));
+						store_u(&positions[boneIdx], position);
 					}
 
-					curveIdx = mapping.scale;
+					curveIdx = track.curves.scale;
 					if (curveIdx != (UINT32)-1)
 					{
 						const TAnimationCurve<Vector3>& curve = state.curves->scale[curveIdx].curve;
-						localPose.scales[k] *= curve.evaluate(state.time, state.scaleCaches[curveIdx], false) * normWeight;
+						Vector3 value = curve.evaluate(state.time, state.scaleCaches[curveIdx], false);
 
-						localPose.hasOverride[k] = false;
-						hasAnimCurve[k] = true;
+						float32x4 scale = load_u<float32x4>(&scales[boneIdx]);
+						scale = mul(scale, mul(make_float<float32x4>(value.x, value.y, value.z, 1.0f), weight));
+						store_u(&scales[boneIdx], scale);
 					}
 
-					if (layer.additive)
+					curveIdx = track.curves.rotation;
+					if (curveIdx != (UINT32)-1)
 					{
-						curveIdx = mapping.rotation;
-						if (curveIdx != (UINT32)-1)
+						const TAnimationCurve<Quaternion>& curve = state.curves->rotation[curveIdx].curve;
+						Quaternion value = curve.evaluate(state.time, state.rotationCaches[curveIdx], false);
+
+						if (layer.additive)
 						{
-							bool isAssigned = localPose.rotations[k].w != 0.0f;
+							bool isAssigned = localPose.rotations[boneIdx].w != 0.0f;
 							if (!isAssigned)
-								localPose.rotations[k] = Quaternion::IDENTITY;
-
-							const TAnimationCurve<Quaternion>& curve = state.curves->rotation[curveIdx].curve;
+								localPose.rotations[boneIdx] = Quaternion::IDENTITY;
 
-							Quaternion value = curve.evaluate(state.time, state.rotationCaches[curveIdx], false);
 							value = Quaternion::lerp(normWeight, Quaternion::IDENTITY, value);
-
-							localPose.rotations[k] *= value;
-							localPose.hasOverride[k] = false;
-							hasAnimCurve[k] = true;
+							localPose.rotations[boneIdx] *= value;
 						}
-					}
-					else
-					{
-						curveIdx = mapping.rotation;
-						if (curveIdx != (UINT32)-1)
+						else
 						{
-							const TAnimationCurve<Quaternion>& curve = state.curves->rotation[curveIdx].curve;
-							Quaternion value = curve.evaluate(state.time, state.rotationCaches[curveIdx], false) * normWeight;
+							float32x4 rotation = load_u<float32x4>(&localPose.rotations[boneIdx]);
+							float32x4 weighted = mul(load_u<float32x4>(&value), weight);
 
-							if (value.dot(localPose.rotations[k]) < 0.0f)
-								value = -value;
+							// Blend along the shortest path
+							if (reduce_add(mul(weighted, rotation)) < 0.0f)
+								weighted = neg(weighted);
 
-							localPose.rotations[k] += value;
-							localPose.hasOverride[k] = false;
-							hasAnimCurve[k] = true;
+							store_u(&localPose.rotations[boneIdx], add(rotation, weighted));
 						}
 					}
+
+					localPose.hasOverride[boneIdx] = false;
+					hasAnimCurve[boneIdx] = true;
 				}
 			}
 		}
 
-		// Apply default local tranform to non-animated bones (so that any potential child bones are transformed properly)
+		// Normalize rotations. Apply default local transform to non-animated bones (so that any potential child bones are
+		// transformed properly).
 		for(UINT32 i = 0; i < mNumBones; i++)
 		{
 			if(hasAnimCurve[i])
-				continue;
+			{
+				localPose.positions[i] = Vector3(positions[i].x, positions[i].y, positions[i].z);
+				localPose.scales[i] = Vector3(scales[i].x, scales[i].y, scales[i].z);
+
+				float32x4 rotation = load_u<float32x4>(&localPose.rotations[i]);
+				float lengthSqrd = reduce_add(mul(rotation, rotation));
+
+				bool isAssigned = localPose.rotations[i].w != 0.0f;
+				if (!isAssigned || lengthSqrd <= 0.0f)
+					localPose.rotations[i] = Quaternion::IDENTITY;
+				else
+					store_u(&localPose.rotations[i], div(rotation, splat<float32x4>(std::sqrt(lengthSqrd))));
+			}
+			else
+			{
+				localPose.positions[i] = mBoneTransforms[i].getPosition();
+				localPose.rotations[i] = mBoneTransforms[i].getRotation();
+				localPose.scales[i] = mBoneTransforms[i].getScale();
 
-			localPose.positions[i] = mBoneTransforms[i].getPosition();
-			localPose.rotations[i] = mBoneTransforms[i].getRotation();
-			localPose.scales[i] = mBoneTransforms[i].getScale();
+				localPose.rotations[i].normalize();
+			}
 		}
 
-		// Calculate local pose matrices
-		UINT32 isGlobalBytes = sizeof(bool) * mNumBones;
-		bool* isGlobal = (bool*)bs_stack_alloc(isGlobalBytes);
-		memset(isGlobal, 0, isGlobalBytes);
+		calculateGlobalPose(pose, localPose);
+
+		if(tempTracks != nullptr)
+			bs_stack_free(tempTracks);
+
+		bs_stack_free(hasAnimCurve);
+		bs_stack_free(scales);
+		bs_stack_free(positions);
+	}
+
+	void Skeleton::getPose(Matrix4* pose, LocalSkeletonPose& localPose, const LocalSkeletonPose& from,
+		const LocalSkeletonPose& to, float t) const
+	{
+		assert(localPose.numBones == mNumBones && from.numBones == mNumBones && to.numBones == mNumBones);
 
 		for(UINT32 i = 0; i < mNumBones; i++)
 		{
-			bool isAssigned = localPose.rotations[i].w != 0.0f;
-			if (!isAssigned)
-				localPose.rotations[i] = Quaternion::IDENTITY;
-			else
-				localPose.rotations[i].normalize();
+			localPose.positions[i] = Vector3::lerp(t, from.positions[i], to.positions[i]);
+			localPose.rotations[i] = Quaternion::lerp(t, from.rotations[i], to.rotations[i]);
+			localPose.scales[i] = Vector3::lerp(t, from.scales[i], to.scales[i]);
+		}
 
+		calculateGlobalPose(pose, localPose);
+	}
+
+	void Skeleton::calculateGlobalPose(Matrix4* pose, const LocalSkeletonPose& localPose) const
+	{
+		for (UINT32 i = 0; i < mNumBones; i++)
+		{
 			if (localPose.hasOverride[i])
-			{
-				isGlobal[i] = true;
 				continue;
-			}
 
-			pose[i] = Matrix4::TRS(localPose.positions[i], localPose.rotations[i], localPose.scales[i]);
+			composeTRS(localPose.positions[i], localPose.rotations[i], localPose.scales[i], pose[i]);
 		}
 
-		// Calculate global poses
-		// Note: For a possible performance improvement consider sorting bones in such order so that parents (and overrides)
-		// always come before children, we no isGlobal check is needed.
-		std::function<void(UINT32)> calcGlobal = [&](UINT32 boneIdx)
+		// Calculate global poses. Bones are evaluated in an order where parents always come before their children, so the
+		// parent's global pose is always available. Overridden bones already contain their global pose.
+		for (UINT32 i = 0; i < mNumBones; i++)
 		{
+			UINT32 boneIdx = mEvaluationOrder[i];
+			if (localPose.hasOverride[boneIdx])
+				continue;
+
 			UINT32 parentBoneIdx = mBoneInfo[boneIdx].parent;
 			if (parentBoneIdx == (UINT32)-1)
-			{
-				isGlobal[boneIdx] = true;
-				return;
-			}
+				continue;
 
-			if (!isGlobal[parentBoneIdx])
-				calcGlobal(parentBoneIdx);
+			multiplyAffine(pose[parentBoneIdx], pose[boneIdx], pose[boneIdx]);
+		}
 
-			pose[boneIdx] = pose[parentBoneIdx] * pose[boneIdx];
-			isGlobal[boneIdx] = true;
-		};
+		for (UINT32 i = 0; i < mNumBones; i++)
+			multiplyAffine(pose[i], mInvBindPoses[i], pose[i]);
+	}
 
+	UINT32 Skeleton::getActiveTracks(const AnimationCurveMapping* mapping, const SkeletonMask& mask,
+		AnimationBoneTrack* tracks) const
+	{
+		UINT32 numTracks = 0;
 		for (UINT32 i = 0; i < mNumBones; i++)
 		{
-			if (!isGlobal[i])
-				calcGlobal(i);
+			if (!mask.isEnabled(i))
+				continue;
+
+			const AnimationCurveMapping& curves = mapping[i];
+			if (curves.position == (UINT32)-1 && curves.rotation == (UINT32)-1 && curves.scale == (UINT32)-1)
+				continue;
+
+			tracks[numTracks].boneIdx = i;
+			tracks[numTracks].curves = curves;
+			numTracks++;
 		}
 
+		return numTracks;
+	}
+
+	void Skeleton::buildEvaluationOrder()
+	{
+		if (mEvaluationOrder != nullptr)
+			bs_free(mEvaluationOrder);
+
+		mEvaluationOrder = (UINT32*)bs_alloc(sizeof(UINT32) * mNumBones);
+
+		// Breadth first traversal starting from the root bones, ensuring parents are always output before children
+		UINT32 numOrdered = 0;
 		for (UINT32 i = 0; i < mNumBones; i++)
-			pose[i] = pose[i] * mInvBindPoses[i];
+		{
+			if (mBoneInfo[i].parent == (UINT32)-1 || mBoneInfo[i].parent >= mNumBones)
+				mEvaluationOrder[numOrdered++] = i;
+		}
 
-		bs_stack_free(isGlobal);
-		bs_stack_free(hasAnimCurve);
+		for (UINT32 i = 0; i < numOrdered; i++)
+		{
+			UINT32 parentIdx = mEvaluationOrder[i];
+			for (UINT32 j = 0; j < mNumBones; j++)
+			{
+				if (mBoneInfo[j].parent == parentIdx)
+					mEvaluationOrder[numOrdered++] = j;
+			}
+		}
+
+		// Bones that are part of a cycle are never reached, evaluate them last
+		if (numOrdered < mNumBones)
+		{
+			BS_LOG(Warning, Animation,
+				"Skeleton bone hierarchy contains a cycle. Some bones will not animate properly.");
+
+			bool* isOrdered = bs_stack_alloc<bool>(mNumBones);
+			bs_zero_out(isOrdered, mNumBones);
+
+			for (UINT32 i = 0; i < numOrdered; i++)
+				isOrdered[mEvaluationOrder[i]] = true;
+
+			for (UINT32 i = 0; i < mNumBones; i++)
+			{
+				if (!isOrdered[i])
+					mEvaluationOrder[numOrdered++] = i;
+			}
+
+			bs_stack_free(isOrdered);
+		}
 	}
 
 	Transform Skeleton::calcBoneTransform(UINT32 idx) const
@@ -29,6 +29,16 @@ namespace bs
 		UINT32 scale;
 	};
 
+	/**
+	 * Bone animated by an animation clip, along with indices of the curves animating it. Used for evaluating only the
+	 * bones that are affected by a clip, without needing to check the mapping and skeleton mask of every bone.
+	 */
+	struct AnimationBoneTrack
+	{
+		UINT32 boneIdx; /**< Index of the bone in the skeleton. */
+		AnimationCurveMapping curves; /**< Indices of the curves animating the bone. At least one is not -1. */
+	};
+
 	/** Information about a single bone used for constructing a skeleton. */
 	struct BONE_DESC
 	{
@@ -47,6 +57,13 @@ namespace bs
 		AnimationCurveMapping* boneToCurveMapping; /**< Mapping of bone indices to curve indices for quick lookup .*/
 		AnimationCurveMapping* soToCurveMapping; /**< Mapping of scene object indices to curve indices for quick lookup. */
 
+		/**
+		 * Optional list of bones animated by the clip and enabled by the skeleton mask, as returned by
+		 * Skeleton::getActiveTracks(). If null the list is built from @p boneToCurveMapping during evaluation.
+		 */
+		AnimationBoneTrack* activeTracks = nullptr;
+		UINT32 numActiveTracks = 0; /**< Number of entries in @p activeTracks. */
+
 		TCurveCache<Vector3>* positionCaches; /**< Cache used for evaluating position curves. */
 		TCurveCache<Quaternion>* rotationCaches; /**< Cache used for evaluating rotation curves. */
 		TCurveCache<Vector3>* scaleCaches; /**< Cache used for evaluating scale curves. */
@@ -153,6 +170,37 @@ namespace bs
 		void getPose(Matrix4* pose, LocalSkeletonPose& localPose, const SkeletonMask& mask,
 			const AnimationStateLayer* layers, UINT32 numLayers);
 
+		/**
+		 * Outputs a skeleton pose by interpolating between two local poses previously output by one of the other
+		 * getPose() overloads.
+		 *
+		 * @param[out]		pose		Output pose containing the requested transforms. Must be pre-allocated with enough
+		 *								space to hold all the bone matrices of this skeleton. Transforms of bones marked as
+		 *								overridden in @p localPose are expected to already be present.
+		 * @param[in, out]	localPose	Output pose containing the interpolated local transforms. Must be pre-allocated
+		 *								with enough space to hold all the bone data of this skeleton. Determines which
+		 *								bones are overridden.
+		 * @param[in]		from		Local pose to interpolate from.
+		 * @param[in]		to			Local pose to interpolate to.
+		 * @param[in]		t			Interpolation factor in range [0, 1], where 0 yields @p from and 1 yields @p to.
+		 */
+		void getPose(Matrix4* pose, LocalSkeletonPose& localPose, const LocalSkeletonPose& from,
+			const LocalSkeletonPose& to, float t) const;
+
+		/**
+		 * Builds a list of bones that are animated by an animation clip and enabled by the skeleton mask. Providing the
+		 * list through AnimationState::activeTracks allows getPose() to skip bones that aren't animated, and avoids
+		 * checking the mask and curve mapping for each bone on every evaluation.
+		 *
+		 * @param[in]	mapping		Mapping of bones to animation curves, as returned by AnimationClip::getBoneMapping().
+		 *							Must contain an entry for each bone in the skeleton.
+		 * @param[in]	mask		Mask that filters which skeleton bones are enabled or disabled.
+		 * @param[out]	tracks		Pre-allocated array with enough room for an entry for each bone in the skeleton.
+		 * @return					Number of entries written to @p tracks.
+		 */
+		UINT32 getActiveTracks(const AnimationCurveMapping* mapping, const SkeletonMask& mask,
+			AnimationBoneTrack* tracks) const;
+
 		/** Returns the total number of bones in the skeleton. */
 		BS_SCRIPT_EXPORT(pr:getter,n:NumBones)
 		UINT32 getNumBones() const { return mNumBones; }
@@ -186,6 +234,17 @@ namespace bs
 		Matrix4* mInvBindPoses = nullptr;
 		SkeletonBoneInfo* mBoneInfo = nullptr;
 
+		/** Builds the bone evaluation order. Must be called whenever the bone hierarchy changes. */
+		void buildEvaluationOrder();
+
+		/**
+		 * Converts the local pose into the pose used for skinning, by applying the parent transforms and the inverse bind
+		 * pose to each bone. Transforms of overridden bones are expected to already be present in @p pose.
+		 */
+		void calculateGlobalPose(Matrix4* pose, const LocalSkeletonPose& localPose) const;
+
+		UINT32* mEvaluationOrder = nullptr; /**< Bone indices, ordered so that parents always come before children. */
+
 		/************************************************************************/
 		/* 								SERIALIZATION                      		*/
 		/************************************************************************/
@@ -21,6 +21,7 @@
 #include "Renderer/BsRendererManager.h"
 #include "Managers/BsGpuProgramManager.h"
 #include "Managers/BsMeshManager.h"
+#include "Managers/BsTextureStreamingManager.h"
 #include "Managers/BsRenderWindowManager.h"
 #include "Renderer/BsRenderer.h"
 #include "Utility/BsDeferredCallManager.h"
@@ -28,8 +29,10 @@
 #include "Localization/BsStringTableManager.h"
 #include "Profiling/BsProfilingManager.h"
 #include "Profiling/BsProfilerCPU.h"
+#include "Debug/BsStartupTrace.h"
 #include "Profiling/BsProfilerGPU.h"
 #include "Managers/BsQueryManager.h"
+#include "Managers/BsGpuReadbackManager.h"
 #include "Threading/BsThreadPool.h"
 #include "Threading/BsTaskScheduler.h"
 #include "Profiling/BsRenderStats.h"
@@ -67,11 +70,18 @@ namespace bs
 	BS_LOG_CATEGORY_IMPL(FreeImageImporter)
 	BS_LOG_CATEGORY_IMPL(Script)
 	BS_LOG_CATEGORY_IMPL(Importer)
+	BS_LOG_CATEGORY_IMPL(Animation)
 
 	CoreApplication::CoreApplication(START_UP_DESC desc)
 		: mPrimaryWindow(nullptr), mStartUpDesc(desc), mRendererPlugin(nullptr), mIsFrameRenderingFinished(true)
 		, mSimThreadId(BS_THREAD_CURRENT_ID), mRunMainLoop(false)
 	{
+		mFramePacer.setFrameStep(16666); // 60 times a second in microseconds
+
+		// Called before any of the modules are started, so they all get included in the trace
+		if(desc.traceStartUp)
+			StartupTrace::begin();
+
 		// Ensure all errors are reported properly
 		CrashHandler::startUp(desc.crashHandling);
 		if(desc.logCallback)
@@ -84,7 +94,9 @@ namespace bs
 		mPrimaryWindow = nullptr;
 
 		Importer::shutDown();
+		TextureStreamingManager::shutDown();
 		MeshManager::shutDown();
+		ct::GpuReadbackManager::shutDown();
 		ProfilerGPU::shutDown();
 
 		SceneManager::shutDown();
@@ -185,7 +197,9 @@ namespace bs
 		startUpRenderer();
 
 		ProfilerGPU::startUp();
+		ct::GpuReadbackManager::startUp();
 		MeshManager::startUp();
+		TextureStreamingManager::startUp();
 		Importer::startUp();
 		AudioManager::startUp(mStartUpDesc.audio);
 		AnimationManager::startUp();
@@ -197,6 +211,62 @@ namespace bs
 		// Built-in importers
 		FGAImporter* fgaImporter = bs_new<FGAImporter>();
 		Importer::instance()._registerAssetImporter(fgaImporter);
+
+		buildSimSystemGraph();
+	}
+
+	void CoreApplication::buildSimSystemGraph()
+	{
+		// Systems that run user code (component updates, plugins, callbacks) are free to touch any scene, audio or
+		// physics state and must stay on the sim thread. Systems with no conflicting state accesses may execute in any
+		// order, so particle simulation can overlap with systems that don't touch the scene.
+		mSimSystems.addSystem("Scene update", []() { gSceneManager()._update(); },
+			{ }, { "Scene", "Audio", "Physics" });
+
+		// Audio is updated right after the scene update and before plugins and post update run. Audio sources they start
+		// or move are picked up on the following frame.
+		mSimSystems.addSystem("Audio", []() { gAudio()._update(); },
+			{ }, { "Audio" });
+
+		mSimSystems.addSystem("Physics update", []() { gPhysics().update(); },
+			{ }, { "Scene", "Physics" });
+
+		mSimSystems.addSystem("Plugin update", [this]()
+		{
+			for (auto& pluginUpdateFunc : mPluginUpdateFunctions)
+				pluginUpdateFunc.second();
+		}, { }, { "Scene", "Audio", "Physics" });
+
+		mSimSystems.addSystem("Post update", [this]() { postUpdate(); },
+			{ }, { "Scene", "Audio", "Physics" });
+
+		// Evaluate animation after scene and plugin updates because the renderer will just now be displaying the
+		// animation we sent on the previous frame, and we want the scene information to match to what is displayed.
+		mSimSystems.addSystem("Animation", [this]()
+		{
+			mAnimationData = AnimationManager::instance().update(mStartUpDesc.asyncAnimation);
+		}, { }, { "Scene", "Animation" });
+
+		mSimSystems.addSystem("Particles", [this]()
+		{
+			mParticleData = ParticleManager::instance().update(*mAnimationData);
+		}, { "Scene", "Animation", "Physics" }, { "Particles" }, SystemFlags());
+
+		// Send out resource events in case any were loaded/destroyed/modified
+		mSimSystems.addSystem("Resource listeners", []() { ResourceListenerManager::instance().update(); },
+			{ }, { "Scene", "Resources" });
+
+		// Trigger any renderer task callbacks (should be done before scene object update, or core sync, so objects have
+		// a chance to respond to the callback).
+		mSimSystems.addSystem("Renderer update", []() { RendererManager::instance().getActive()->update(); },
+			{ }, { "Scene" });
+
+		// Decide which texture mip levels should be resident, based on usage reported by the renderer last frame
+		mSimSystems.addSystem("Texture streaming", []() { TextureStreamingManager::instance().update(); },
+			{ }, { "Resources" });
+
+		mSimSystems.addSystem("Core object transforms", []() { gSceneManager()._updateCoreObjectTransforms(); },
+			{ "Scene" }, { "CoreSync" });
 	}
 
 	void CoreApplication::runMainLoop()
@@ -205,33 +275,8 @@ namespace bs
 
 		while(isMainLoopRunning())
 		{
-			// Limit FPS if needed
-			if (mFrameStep > 0)
-			{
-				UINT64 currentTime = gTime().getTimePrecise();
-				UINT64 nextFrameTime = mLastFrameTime + mFrameStep;
-				while (nextFrameTime > currentTime)
-				{
-					UINT32 waitTime = (UINT32)(nextFrameTime - currentTime);
-
-					// If waiting for longer, sleep
-					if (waitTime >= 2000)
-					{
-						Platform::sleep(waitTime / 1000);
-						currentTime = gTime().getTimePrecise();
-					}
-					else
-					{
-						// Otherwise we just spin, sleep timer granularity is too low and we might end up wasting a
-						// millisecond otherwise.
-						// Note: For mobiles where power might be more important than input latency, consider using sleep.
-						while(nextFrameTime > currentTime)
-							currentTime = gTime().getTimePrecise();
-					}
-				}
-
-				mLastFrameTime = currentTime;
-			}
+			// Limit FPS if needed, and delay the frame so it finishes together with the frame being rendered
+			mFramePacer.waitForFrameStart();
 
 			runMainLoopFrame();
 		}
@@ -241,6 +286,13 @@ namespace bs
 
 	void CoreApplication::beginMainLoop()
 	{
+		// Everything up to the first frame counts as start up
+		if (StartupTrace::isRecording())
+		{
+			StartupTrace::end();
+			BS_LOG(Log, Generic, "{0}", StartupTrace::generateReport());
+		}
+
 		mRunMainLoop = true;
 	}
 
@@ -283,37 +335,23 @@ namespace bs
 			}
 		}
 
-		PROFILE_CALL(gSceneManager()._update(), "Scene update");
-		gAudio()._update();
-		gPhysics().update();
-
-		// Update plugins
-		for (auto& pluginUpdateFunc : mPluginUpdateFunctions)
-			pluginUpdateFunc.second();
-
-		postUpdate();
+		// Scene, audio, physics, plugin, animation and particle updates, with independent systems running concurrently
+		mSimSystems.execute();
 
 		PerFrameData perFrameData;
+		perFrameData.animation = mAnimationData;
+		perFrameData.particles = mParticleData;
 
-		// Evaluate animation after scene and plugin updates because the renderer will just now be displaying the
-		// animation we sent on the previous frame, and we want the scene information to match to what is displayed.
-		perFrameData.animation = AnimationManager::instance().update(mStartUpDesc.asyncAnimation);
-		perFrameData.particles = ParticleManager::instance().update(*perFrameData.animation);
-
-		// Send out resource events in case any were loaded/destroyed/modified
-		ResourceListenerManager::instance().update();
-
-		// Trigger any renderer task callbacks (should be done before scene object update, or core sync, so objects have
-		// a chance to respond to the callback).
-		RendererManager::instance().getActive()->update();
-
-		gSceneManager()._updateCoreObjectTransforms();
 		PROFILE_CALL(RendererManager::instance().getActive()->renderAll(perFrameData), "Render");
 
 		// Core and sim thread run in lockstep. This will result in a larger input latency than if I was
 		// running just a single thread. Latency becomes worse if the core thread takes longer than sim
-		// thread, in which case sim thread needs to wait. Optimal solution would be to get an average
-		// difference between sim/core thread and start the sim thread a bit later so they finish at nearly the same time.
+		// thread, in which case sim thread needs to wait. To counter this the frame pacer delays the start of the
+		// sim frame by the average difference between sim and core thread frame times, so they finish at nearly the
+		// same time.
+		mFramePacer.notifySimFrameEnd();
+
+		UINT64 frameRenderingFinishedTime;
 		{
 			Lock lock(mFrameRenderingFinishedMutex);
 
@@ -325,6 +363,7 @@ namespace bs
 			}
 
 			mIsFrameRenderingFinished = false;
+			frameRenderingFinishedTime = mFrameRenderingFinishedTime;
 		}
 
 		gCoreThread().queueCommand(std::bind(&CoreApplication::beginCoreProfiling, this), CTQF_InternalQueue);
@@ -334,9 +373,14 @@ namespace bs
 		gCoreThread().update();
 		gCoreThread().submitAll();
 
+		mFramePacer.notifyFrameSubmitted(frameRenderingFinishedTime);
+		gProfilerCPU().addSample("Input to submit latency", mFramePacer.getInputLatency() / 1000.0);
+
 		gCoreThread().queueCommand(std::bind(&CoreApplication::frameRenderingFinishedCallback, this), CTQF_InternalQueue);
 
 		gCoreThread().queueCommand(std::bind(&ct::QueryManager::_update, ct::QueryManager::instancePtr()), CTQF_InternalQueue);
+		gCoreThread().queueCommand(std::bind(&ct::GpuReadbackManager::_update, ct::GpuReadbackManager::instancePtr()),
+			CTQF_InternalQueue);
 		gCoreThread().queueCommand(std::bind(&CoreApplication::endCoreProfiling, this), CTQF_InternalQueue);
 
 		gProfilerCPU().endThread();
@@ -384,9 +428,9 @@ namespace bs
 	void CoreApplication::setFPSLimit(UINT32 limit)
 	{
 		if(limit > 0)
-			mFrameStep = (UINT64)1000000 / limit;
+			mFramePacer.setFrameStep((UINT64)1000000 / limit);
 		else
-			mFrameStep = 0;
+			mFramePacer.setFrameStep(0);
 	}
 
 	void CoreApplication::frameRenderingFinishedCallback()
@@ -394,6 +438,7 @@ namespace bs
 		Lock lock(mFrameRenderingFinishedMutex);
 
 		mIsFrameRenderingFinished = true;
+		mFrameRenderingFinishedTime = mFramePacer.getTime();
 		mFrameRenderingFinishedCondition.notify_one();
 	}
 
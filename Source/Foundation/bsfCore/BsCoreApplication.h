@@ -6,9 +6,14 @@
 #include "Utility/BsModule.h"
 #include "RenderAPI/BsRenderWindow.h"
 #include "Utility/BsEvent.h"
+#include "Utility/BsSystemGraph.h"
+#include "Utility/BsFramePacer.h"
 
 namespace bs
 {
+	struct EvaluatedAnimationData;
+	struct ParticlePerFrameData;
+
 	/** @addtogroup Application-Core
 	 *  @{
 	 */
@@ -37,6 +42,12 @@ namespace bs
 		 */
 		bool asyncAnimation = true;
 
+		/**
+		 * True if timings of module start ups and resource loads should be recorded until the first frame starts, and
+		 * logged as a report. See StartupTrace.
+		 */
+		bool traceStartUp = false;
+
 		RENDER_WINDOW_DESC primaryWindowDesc; /**< Describes the window to create during start-up. */
 
 		Vector<String> importers; /**< A list of importer plugins to load. */
@@ -81,6 +92,16 @@ namespace bs
 		/** Changes the maximum FPS the application is allowed to run in. Zero means unlimited. */
 		void setFPSLimit(UINT32 limit);
 
+		/**
+		 * Determines should the start of a frame be delayed when the core thread takes longer to render a frame than
+		 * the sim thread takes to produce one. Delaying the frame start means input is sampled closer to the point
+		 * the frame is submitted for rendering, reducing input latency. Enabled by default.
+		 */
+		void setAdaptiveFramePacing(bool enabled) { mFramePacer.setAdaptive(enabled); }
+
+		/** Returns the frame pacer used for limiting the frame rate and scheduling the start of sim thread frames. */
+		const FramePacer& getFramePacer() const { return mFramePacer; }
+
 		/**
 		 * Issues a request for the application to close. Application may choose to ignore the request depending on the
 		 * circumstances and the implementation.
@@ -153,27 +174,35 @@ namespace bs
 		/**	Called by the core thread to end profiling. */
 		void endCoreProfiling();
 
+		/**
+		 * Registers the systems updated on the sim thread every frame, along with the engine state they access. Called
+		 * once during initialization.
+		 */
+		void buildSimSystemGraph();
+
 	protected:
 		typedef void(*UpdatePluginFunc)();
 
 		SPtr<RenderWindow> mPrimaryWindow;
 		START_UP_DESC mStartUpDesc;
 
-		// Frame limiting
-		UINT64 mFrameStep = 16666; // 60 times a second in microseconds
-		UINT64 mLastFrameTime = 0; // Microseconds
+		FramePacer mFramePacer;
 
 		DynLib* mRendererPlugin;
 
 		Map<DynLib*, UpdatePluginFunc> mPluginUpdateFunctions;
 
 		bool mIsFrameRenderingFinished;
+		UINT64 mFrameRenderingFinishedTime = 0;
 		Mutex mFrameRenderingFinishedMutex;
 		Signal mFrameRenderingFinishedCondition;
 		ThreadId mSimThreadId;
 
 		volatile bool mRunMainLoop;
 
+		SystemGraph mSimSystems;
+		const EvaluatedAnimationData* mAnimationData = nullptr;
+		const ParticlePerFrameData* mParticleData = nullptr;
 	};
 
 	/**	Provides easy access to CoreApplication. */
@@ -419,6 +419,8 @@ namespace bs
 	class Resource;
 	class Resources;
 	class ResourceManifest;
+	class ResourceArchive;
+	class SavedResourceData;
 	class MeshBase;
 	class TransientMesh;
 	class MeshHeap;
@@ -479,6 +481,9 @@ namespace bs
 		class RenderWindowManager;
 		class RenderStateManager;
 		class HardwareBufferManager;
+		class GpuParamBlockArena;
+		class RenderAPICapture;
+		class RenderStateCache;
 	}
 }
 
@@ -668,6 +673,7 @@ namespace bs
 		TID_ShadowSettings = 1208,
 		TID_MotionBlurSettings = 1209,
 		TID_TemporalAASettings = 1210,
+		TID_MeshLOD = 1211,
 
 		// Moved from Engine layer
 		TID_CCamera = 30000,
@@ -909,6 +915,7 @@ namespace bs
 	BS_LOG_CATEGORY(Script, 37)
 	BS_LOG_CATEGORY(Importer, 38)
 	BS_LOG_CATEGORY(Network, 39)
+	BS_LOG_CATEGORY(Animation, 40)
 }
 
 #include "Utility/BsCommonTypes.h"
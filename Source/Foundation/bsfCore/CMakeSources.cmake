@@ -110,6 +110,8 @@ set(BS_CORE_INC_RENDERER
 	"bsfCore/Renderer/BsLightProbeVolume.h"
 	"bsfCore/Renderer/BsIBLUtility.h"
 	"bsfCore/Renderer/BsGpuResourcePool.h"
+	"bsfCore/Renderer/BsGpuParamBlockArena.h"
+	"bsfCore/Renderer/BsParallelCommandRecorder.h"
 	"bsfCore/Renderer/BsDecal.h"
 )
 
@@ -157,6 +159,8 @@ set(BS_CORE_INC_RENDERAPI
 	"bsfCore/RenderAPI/BsBlendState.h"
 	"bsfCore/RenderAPI/BsRenderAPI.h"
 	"bsfCore/RenderAPI/BsRenderAPICapabilities.h"
+	"bsfCore/RenderAPI/BsRenderAPICapture.h"
+	"bsfCore/RenderAPI/BsRenderStateCache.h"
 	"bsfCore/RenderAPI/BsViewport.h"
 	"bsfCore/RenderAPI/BsCommandBuffer.h"
 	"bsfCore/RenderAPI/BsGpuPipelineState.h"
@@ -168,6 +172,7 @@ set(BS_CORE_INC_RENDERAPI_MANAGERS
 	"bsfCore/Managers/BsRenderWindowManager.h"
 	"bsfCore/Managers/BsRenderStateManager.h"
 	"bsfCore/Managers/BsQueryManager.h"
+	"bsfCore/Managers/BsGpuReadbackManager.h"
 	"bsfCore/Managers/BsMeshManager.h"
 	"bsfCore/Managers/BsHardwareBufferManager.h"
 	"bsfCore/Managers/BsGpuProgramManager.h"
@@ -175,6 +180,7 @@ set(BS_CORE_INC_RENDERAPI_MANAGERS
 	"bsfCore/Managers/BsRenderAPIFactory.h"
 	"bsfCore/Managers/BsCommandBufferManager.h"
 	"bsfCore/Managers/BsTextureManager.h"
+	"bsfCore/Managers/BsTextureStreamingManager.h"
 	"bsfCore/Managers/BsResourceListenerManager.h"
 )
 
@@ -207,6 +213,7 @@ set(BS_CORE_INC_MATERIAL
 set(BS_CORE_INC_RESOURCES
 	"bsfCore/Resources/BsResources.h"
 	"bsfCore/Resources/BsResourceManifest.h"
+	"bsfCore/Resources/BsResourceArchive.h"
 	"bsfCore/Resources/BsResourceHandle.h"
 	"bsfCore/Resources/BsResource.h"
 	"bsfCore/Resources/BsGpuResourceData.h"
@@ -236,6 +243,8 @@ set(BS_CORE_SRC_UTILITY
 	"bsfCore/Utility/BsUtility.cpp"
 	"bsfCore/Utility/BsDeferredCallManager.cpp"
 	"bsfCore/Utility/BsIconUtility.cpp"
+	"bsfCore/Utility/BsSystemGraph.cpp"
+	"bsfCore/Utility/BsFramePacer.cpp"
 )
 
 set(BS_CORE_INC_TEXT
@@ -296,6 +305,8 @@ set(BS_CORE_INC_UTILITY
 	"bsfCore/Utility/BsUtility.h"
 	"bsfCore/Utility/BsDeferredCallManager.h"
 	"bsfCore/Utility/BsIconUtility.h"
+	"bsfCore/Utility/BsSystemGraph.h"
+	"bsfCore/Utility/BsFramePacer.h"
 )
 
 set(BS_CORE_INC_RTTI
@@ -406,6 +417,8 @@ set(BS_CORE_SRC_RENDERER
 	"bsfCore/Renderer/BsLightProbeVolume.cpp"
 	"bsfCore/Renderer/BsIBLUtility.cpp"
 	"bsfCore/Renderer/BsGpuResourcePool.cpp"
+	"bsfCore/Renderer/BsGpuParamBlockArena.cpp"
+	"bsfCore/Renderer/BsParallelCommandRecorder.cpp"
 	"bsfCore/Renderer/BsDecal.cpp"
 )
 
@@ -414,6 +427,7 @@ set(BS_CORE_SRC_RESOURCES
 	"bsfCore/Resources/BsResource.cpp"
 	"bsfCore/Resources/BsResourceHandle.cpp"
 	"bsfCore/Resources/BsResourceManifest.cpp"
+	"bsfCore/Resources/BsResourceArchive.cpp"
 	"bsfCore/Resources/BsResources.cpp"
 	"bsfCore/Resources/BsResourceMetaData.cpp"
 	"bsfCore/Resources/BsSavedResourceData.cpp"
@@ -489,6 +503,8 @@ set(BS_CORE_SRC_RENDERAPI
 	"bsfCore/RenderAPI/BsVideoModeInfo.cpp"
 	"bsfCore/RenderAPI/BsRenderAPI.cpp"
 	"bsfCore/RenderAPI/BsRenderAPICapabilities.cpp"
+	"bsfCore/RenderAPI/BsRenderAPICapture.cpp"
+	"bsfCore/RenderAPI/BsRenderStateCache.cpp"
 	"bsfCore/RenderAPI/BsViewport.cpp"
 	"bsfCore/RenderAPI/BsCommandBuffer.cpp"
 	"bsfCore/RenderAPI/BsGpuPipelineState.cpp"
@@ -502,11 +518,13 @@ set(BS_CORE_SRC_RENDERAPI_MANAGERS
 	"bsfCore/Managers/BsHardwareBufferManager.cpp"
 	"bsfCore/Managers/BsMeshManager.cpp"
 	"bsfCore/Managers/BsQueryManager.cpp"
+	"bsfCore/Managers/BsGpuReadbackManager.cpp"
 	"bsfCore/Managers/BsRenderStateManager.cpp"
 	"bsfCore/Managers/BsRenderWindowManager.cpp"
 	"bsfCore/Managers/BsRenderAPIManager.cpp"
 	"bsfCore/Managers/BsCommandBufferManager.cpp"
 	"bsfCore/Managers/BsTextureManager.cpp"
+	"bsfCore/Managers/BsTextureStreamingManager.cpp"
 	"bsfCore/Managers/BsResourceListenerManager.cpp"
 )
 
@@ -582,6 +600,7 @@ set(BS_CORE_INC_ANIMATION
 	"bsfCore/Animation/BsAnimationUtility.h"
 	"bsfCore/Animation/BsSkeletonMask.h"
 	"bsfCore/Animation/BsMorphShapes.h"
+	"bsfCore/Animation/BsAnimationLOD.h"
 )
 
 set(BS_CORE_SRC_ANIMATION
@@ -593,6 +612,7 @@ set(BS_CORE_SRC_ANIMATION
 	"bsfCore/Animation/BsAnimationUtility.cpp"
 	"bsfCore/Animation/BsSkeletonMask.cpp"
 	"bsfCore/Animation/BsMorphShapes.cpp"
+	"bsfCore/Animation/BsAnimationLOD.cpp"
 )
 
 set(BS_CORE_INC_PARTICLES
@@ -20,6 +20,7 @@ namespace bs
 		setFlag(ComponentFlag::AlwaysRun, true);
 
 		setName("Animation");
+		setFlag(ComponentFlag::NoFixedUpdate, true);
 	}
 
 	CAnimation::CAnimation(const HSceneObject& parent)
@@ -29,6 +30,7 @@ namespace bs
 		setFlag(ComponentFlag::AlwaysRun, true);
 
 		setName("Animation");
+		setFlag(ComponentFlag::NoFixedUpdate, true);
 	}
 
 	void CAnimation::setDefaultClip(const HAnimationClip& clip)
@@ -190,6 +192,14 @@ namespace bs
 			mInternal->setCulling(enable);
 	}
 
+	void CAnimation::setLODLevels(const Vector<AnimationLODLevel>& levels)
+	{
+		mLODLevels = levels;
+
+		if (mInternal != nullptr && !mPreviewMode)
+			mInternal->setLODLevels(levels);
+	}
+
 	UINT32 CAnimation::getNumClips() const
 	{
 		if (mInternal != nullptr)
@@ -317,6 +327,7 @@ namespace bs
 			mInternal->setWrapMode(mWrapMode);
 			mInternal->setSpeed(mSpeed);
 			mInternal->setCulling(mEnableCull);
+			mInternal->setLODLevels(mLODLevels);
 		}
 
 		_updateBounds();
@@ -140,6 +140,14 @@ namespace bs
 		BS_SCRIPT_EXPORT(n:Cull,pr:getter)
 		bool getEnableCull() const { return mEnableCull; }
 
+		/** @copydoc Animation::setLODLevels */
+		BS_SCRIPT_EXPORT(n:LODLevels,pr:setter)
+		void setLODLevels(const Vector<AnimationLODLevel>& levels);
+
+		/** @copydoc setLODLevels */
+		BS_SCRIPT_EXPORT(n:LODLevels,pr:getter)
+		const Vector<AnimationLODLevel>& getLODLevels() const { return mLODLevels; }
+
 		/** @copydoc Animation::getNumClips */
 		BS_SCRIPT_EXPORT(in:true)
 		UINT32 getNumClips() const;
@@ -288,6 +296,7 @@ namespace bs
 		bool mUseBounds = false;
 		bool mPreviewMode = false;
 		AABox mBounds;
+		Vector<AnimationLODLevel> mLODLevels;
 
 		Vector<SceneObjectMappingInfo> mMappingInfos;
 
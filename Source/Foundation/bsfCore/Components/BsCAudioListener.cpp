@@ -12,6 +12,7 @@ namespace bs
 	CAudioListener::CAudioListener()
 	{
 		setName("AudioListener");
+		setFlag(ComponentFlag::NoFixedUpdate, true);
 
 		mNotifyFlags = TCF_Transform;
 	}
@@ -20,6 +21,7 @@ namespace bs
 		: Component(parent)
 	{
 		setName("AudioListener");
+		setFlag(ComponentFlag::NoFixedUpdate, true);
 
 		mNotifyFlags = TCF_Transform;
 	}
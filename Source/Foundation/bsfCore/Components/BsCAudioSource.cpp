@@ -12,6 +12,7 @@ namespace bs
 	CAudioSource::CAudioSource()
 	{
 		setName("AudioSource");
+		setFlag(ComponentFlag::NoFixedUpdate, true);
 
 		mNotifyFlags = TCF_Transform;
 	}
@@ -20,6 +21,7 @@ namespace bs
 		: Component(parent)
 	{
 		setName("AudioSource");
+		setFlag(ComponentFlag::NoFixedUpdate, true);
 
 		mNotifyFlags = TCF_Transform;
 	}
@@ -12,6 +12,8 @@ namespace bs
 	CBone::CBone()
 	{
 		setName("Bone");
+		setFlag(ComponentFlag::NoUpdate, true);
+		setFlag(ComponentFlag::NoFixedUpdate, true);
 
 		mNotifyFlags = TCF_Parent;
 		setFlag(ComponentFlag::AlwaysRun, true);
@@ -21,6 +23,8 @@ namespace bs
 		: Component(parent)
 	{
 		setName("Bone");
+		setFlag(ComponentFlag::NoUpdate, true);
+		setFlag(ComponentFlag::NoFixedUpdate, true);
 
 		mNotifyFlags = TCF_Parent;
 	}
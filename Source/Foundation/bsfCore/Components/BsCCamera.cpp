@@ -12,6 +12,8 @@ namespace bs
 	{
 		setFlag(ComponentFlag::AlwaysRun, true);
 		setName("Camera");
+		setFlag(ComponentFlag::NoUpdate, true);
+		setFlag(ComponentFlag::NoFixedUpdate, true);
 	}
 
 	CCamera::CCamera(const HSceneObject& parent)
@@ -19,6 +21,8 @@ namespace bs
 	{
 		setFlag(ComponentFlag::AlwaysRun, true);
 		setName("Camera");
+		setFlag(ComponentFlag::NoUpdate, true);
+		setFlag(ComponentFlag::NoFixedUpdate, true);
 	}
 
 	ConvexVolume CCamera::getWorldFrustum() const
@@ -14,6 +14,8 @@ namespace bs
 	CCharacterController::CCharacterController()
 	{
 		setName("CharacterController");
+		setFlag(ComponentFlag::NoUpdate, true);
+		setFlag(ComponentFlag::NoFixedUpdate, true);
 
 		mNotifyFlags = TCF_Transform;
 	}
@@ -22,6 +24,8 @@ namespace bs
 		: Component(parent)
 	{
 		setName("CharacterController");
+		setFlag(ComponentFlag::NoUpdate, true);
+		setFlag(ComponentFlag::NoFixedUpdate, true);
 
 		mNotifyFlags = TCF_Transform;
 	}
@@ -13,6 +13,8 @@ namespace bs
 	CCollider::CCollider()
 	{
 		setName("Collider");
+		setFlag(ComponentFlag::NoUpdate, true);
+		setFlag(ComponentFlag::NoFixedUpdate, true);
 
 		mNotifyFlags = (TransformChangedFlags)(TCF_Parent | TCF_Transform);
 	}
@@ -21,6 +23,8 @@ namespace bs
 		: Component(parent)
 	{
 		setName("Collider");
+		setFlag(ComponentFlag::NoUpdate, true);
+		setFlag(ComponentFlag::NoFixedUpdate, true);
 
 		mNotifyFlags = (TransformChangedFlags)(TCF_Parent | TCF_Transform);
 	}
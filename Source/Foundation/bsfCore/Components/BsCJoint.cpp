@@ -13,6 +13,9 @@ namespace bs
 	CJoint::CJoint(JOINT_DESC& desc)
 		:mDesc(desc)
 	{
+		setFlag(ComponentFlag::NoUpdate, true);
+		setFlag(ComponentFlag::NoFixedUpdate, true);
+
 		mPositions[0] = Vector3::ZERO;
 		mPositions[1] = Vector3::ZERO;
 
@@ -24,6 +27,8 @@ namespace bs
 		: Component(parent), mDesc(desc)
 	{
 		setName("Joint");
+		setFlag(ComponentFlag::NoUpdate, true);
+		setFlag(ComponentFlag::NoFixedUpdate, true);
 
 		mPositions[0] = Vector3::ZERO;
 		mPositions[1] = Vector3::ZERO;
@@ -10,6 +10,8 @@ namespace bs
 	{
 		setFlag(ComponentFlag::AlwaysRun, true);
 		setName("Light");
+		setFlag(ComponentFlag::NoUpdate, true);
+		setFlag(ComponentFlag::NoFixedUpdate, true);
 	}
 
 	CLight::CLight(const HSceneObject& parent, LightType type, Color color,
@@ -19,6 +21,8 @@ namespace bs
 	{
 		setFlag(ComponentFlag::AlwaysRun, true);
 		setName("Light");
+		setFlag(ComponentFlag::NoUpdate, true);
+		setFlag(ComponentFlag::NoFixedUpdate, true);
 	}
 
 	CLight::~CLight()
@@ -10,6 +10,8 @@ namespace bs
 	{
 		setFlag(ComponentFlag::AlwaysRun, true);
 		setName("LightProbeVolume");
+		setFlag(ComponentFlag::NoUpdate, true);
+		setFlag(ComponentFlag::NoFixedUpdate, true);
 	}
 
 	CLightProbeVolume::CLightProbeVolume(const HSceneObject& parent, const AABox& volume, const Vector3I& cellCount)
@@ -17,6 +19,8 @@ namespace bs
 	{
 		setFlag(ComponentFlag::AlwaysRun, true);
 		setName("LightProbeVolume");
+		setFlag(ComponentFlag::NoUpdate, true);
+		setFlag(ComponentFlag::NoFixedUpdate, true);
 	}
 
 	CLightProbeVolume::~CLightProbeVolume()
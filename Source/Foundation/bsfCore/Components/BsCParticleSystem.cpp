@@ -13,6 +13,8 @@ namespace bs
 	CParticleSystem::CParticleSystem()
 	{
 		setName("ParticleSystem");
+		setFlag(ComponentFlag::NoUpdate, true);
+		setFlag(ComponentFlag::NoFixedUpdate, true);
 		setFlag(ComponentFlag::AlwaysRun, true);
 	}
 
@@ -20,6 +22,8 @@ namespace bs
 		: Component(parent)
 	{
 		setName("ParticleSystem");
+		setFlag(ComponentFlag::NoUpdate, true);
+		setFlag(ComponentFlag::NoFixedUpdate, true);
 		setFlag(ComponentFlag::AlwaysRun, true);
 	}
 
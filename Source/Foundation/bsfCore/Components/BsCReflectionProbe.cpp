@@ -10,6 +10,8 @@ namespace bs
 	{
 		setFlag(ComponentFlag::AlwaysRun, true);
 		setName("ReflectionProbe");
+		setFlag(ComponentFlag::NoUpdate, true);
+		setFlag(ComponentFlag::NoFixedUpdate, true);
 	}
 
 	CReflectionProbe::CReflectionProbe(const HSceneObject& parent)
@@ -17,6 +19,8 @@ namespace bs
 	{
 		setFlag(ComponentFlag::AlwaysRun, true);
 		setName("ReflectionProbe");
+		setFlag(ComponentFlag::NoUpdate, true);
+		setFlag(ComponentFlag::NoFixedUpdate, true);
 	}
 
 	CReflectionProbe::~CReflectionProbe()
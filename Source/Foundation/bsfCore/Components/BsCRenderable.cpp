@@ -14,6 +14,7 @@ namespace bs
 	CRenderable::CRenderable()
 	{
 		setName("Renderable");
+		setFlag(ComponentFlag::NoFixedUpdate, true);
 		setFlag(ComponentFlag::AlwaysRun, true);
 	}
 
@@ -21,6 +22,7 @@ namespace bs
 		:Component(parent)
 	{
 		setName("Renderable");
+		setFlag(ComponentFlag::NoFixedUpdate, true);
 		setFlag(ComponentFlag::AlwaysRun, true);
 	}
 
@@ -14,6 +14,8 @@ namespace bs
 	CRigidbody::CRigidbody()
 	{
 		setName("Rigidbody");
+		setFlag(ComponentFlag::NoUpdate, true);
+		setFlag(ComponentFlag::NoFixedUpdate, true);
 
 		mNotifyFlags = (TransformChangedFlags)(TCF_Parent | TCF_Transform);
 	}
@@ -22,6 +24,8 @@ namespace bs
 		: Component(parent)
 	{
 		setName("Rigidbody");
+		setFlag(ComponentFlag::NoUpdate, true);
+		setFlag(ComponentFlag::NoFixedUpdate, true);
 
 		mNotifyFlags = (TransformChangedFlags)(TCF_Parent | TCF_Transform);
 	}
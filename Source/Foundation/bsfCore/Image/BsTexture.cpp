@@ -9,11 +9,16 @@
 #include "Threading/BsAsyncOp.h"
 #include "Resources/BsResources.h"
 #include "Image/BsPixelUtil.h"
+#include "Managers/BsTextureStreamingManager.h"
+#include "Managers/BsGpuReadbackManager.h"
 
 namespace bs
 {
 	TEXTURE_COPY_DESC TEXTURE_COPY_DESC::DEFAULT = TEXTURE_COPY_DESC();
 
+	/** Mip levels of streamable textures larger than this size (in pixels) are loaded on demand. */
+	static constexpr UINT32 STREAMING_MIN_MIP_SIZE = 64;
+
 	TextureProperties::TextureProperties(const TEXTURE_DESC& desc)
 		:mDesc(desc)
 	{
@@ -81,6 +86,13 @@ namespace bs
 	{
 		mSize = calculateSize();
 
+		// Core object needs to know its streaming identifier, so register before it's created
+		if (isStreaming() && TextureStreamingManager::isStarted())
+		{
+			SPtr<Texture> thisPtr = std::static_pointer_cast<Texture>(getThisPtr());
+			mStreamingId = TextureStreamingManager::instance()._registerTexture(thisPtr);
+		}
+
 		// Allocate CPU buffers if needed
 		if ((mProperties.getUsage() & TU_CPUCACHED) != 0)
 		{
@@ -95,9 +107,9 @@ namespace bs
 
 	SPtr<ct::CoreObject> Texture::createCore() const
 	{
-		const TextureProperties& props = getProperties();
-
-		SPtr<ct::CoreObject> coreObj = ct::TextureManager::instance().createTextureInternal(props.mDesc, mInitData);
+		SPtr<ct::Texture> coreObj = ct::TextureManager::instance().createTextureInternal(
+			getResidentDesc(mResidentMip), mInitData);
+		coreObj->mStreamingId = mStreamingId;
 
 		if ((mProperties.getUsage() & TU_CPUCACHED) == 0)
 			mInitData = nullptr;
@@ -107,6 +119,17 @@ namespace bs
 
 	AsyncOp Texture::writeData(const SPtr<PixelData>& data, UINT32 face, UINT32 mipLevel, bool discardEntireBuffer)
 	{
+		if (mipLevel < mResidentMip)
+		{
+			BS_LOG(Warning, Texture, "Cannot write to mip level {0} as it isn't resident. Most detailed resident mip "
+				"level is {1}.", mipLevel, mResidentMip);
+
+			AsyncOp op(bs_shared_ptr_new<AsyncOpSyncData>());
+			op._completeOperation();
+
+			return op;
+		}
+
 		UINT32 subresourceIdx = mProperties.mapToSubresourceIdx(face, mipLevel);
 		updateCPUBuffers(subresourceIdx, *data);
 
@@ -122,12 +145,25 @@ namespace bs
 
 		};
 
-		return gCoreThread().queueReturnCommand(std::bind(func, getCore(), face, mipLevel,
+		return gCoreThread().queueReturnCommand(std::bind(func, getCore(), face, mipLevel - mResidentMip,
 			data, discardEntireBuffer, std::placeholders::_1));
 	}
 
 	AsyncOp Texture::readData(const SPtr<PixelData>& data, UINT32 face, UINT32 mipLevel)
 	{
+		// Mip levels that aren't resident are read directly from the streaming source
+		if (mipLevel < mResidentMip)
+		{
+			Vector<SPtr<PixelData>> mipData;
+			if (_readStreamedMips(mipLevel, mipLevel + 1, mipData) && face < (UINT32)mipData.size())
+				PixelUtil::bulkPixelConversion(*mipData[face], *data);
+
+			AsyncOp op(bs_shared_ptr_new<AsyncOpSyncData>());
+			op._completeOperation();
+
+			return op;
+		}
+
 		data->_lock();
 
 		std::function<void(const SPtr<ct::Texture>&, UINT32, UINT32, const SPtr<PixelData>&, AsyncOp&)> func =
@@ -143,7 +179,7 @@ namespace bs
 
 		};
 
-		return gCoreThread().queueReturnCommand(std::bind(func, getCore(), face, mipLevel,
+		return gCoreThread().queueReturnCommand(std::bind(func, getCore(), face, mipLevel - mResidentMip,
 			data, std::placeholders::_1));
 	}
 
@@ -151,7 +187,16 @@ namespace bs
 	{
 		TAsyncOp<SPtr<PixelData>> op;
 
-		auto func = [texture = getCore(), face, mipLevel, op]() mutable
+		if (mipLevel < mResidentMip)
+		{
+			SPtr<PixelData> output = mProperties.allocBuffer(face, mipLevel);
+			readData(output, face, mipLevel);
+
+			op._completeOperation(output);
+			return op;
+		}
+
+		auto func = [texture = getCore(), face, mipLevel = mipLevel - mResidentMip, op]() mutable
 		{
 			// Make sure any queued command start executing before reading
 			ct::RenderAPI::instance().submitCommandBuffer(nullptr);
@@ -167,12 +212,203 @@ namespace bs
 		return op;
 	}
 
+	TAsyncOp<SPtr<PixelData>> Texture::readDataDeferred(UINT32 face, UINT32 mipLevel)
+	{
+		// Non-resident mip levels don't involve the GPU, so there is nothing to defer
+		if (mipLevel < mResidentMip)
+			return readData(face, mipLevel);
+
+		TAsyncOp<SPtr<PixelData>> op;
+		auto func = [texture = getCore(), face, mipLevel = mipLevel - mResidentMip, op]()
+		{
+			ct::GpuReadbackManager::instance().readTexture(texture, face, mipLevel, op);
+		};
+
+		gCoreThread().queueCommand(func);
+		return op;
+	}
+
 	UINT32 Texture::calculateSize() const
 	{
 		return mProperties.getNumFaces() * PixelUtil::getMemorySize(mProperties.getWidth(),
 			mProperties.getHeight(), mProperties.getDepth(), mProperties.getFormat());
 	}
 
+	TEXTURE_DESC Texture::getResidentDesc(UINT32 residentMip) const
+	{
+		TEXTURE_DESC desc = mProperties.mDesc;
+		if (residentMip == 0)
+			return desc;
+
+		PixelUtil::getSizeForMipLevel(desc.width, desc.height, desc.depth, residentMip, desc.width, desc.height,
+			desc.depth);
+		desc.numMips -= residentMip;
+
+		return desc;
+	}
+
+	UINT32 Texture::calculateNumStreamedMips() const
+	{
+		if (!mStreamable)
+			return 0;
+
+		const int nonStreamableUsage = TU_CPUCACHED | TU_RENDERTARGET | TU_DEPTHSTENCIL | TU_LOADSTORE | TU_DYNAMIC;
+		if ((mProperties.getUsage() & nonStreamableUsage) != 0 || mProperties.getNumSamples() > 1)
+			return 0;
+
+		// Always keep at least the least detailed mip level resident
+		const UINT32 numMips = mProperties.getNumMipmaps();
+
+		UINT32 numStreamedMips = 0;
+		while (numStreamedMips < numMips)
+		{
+			UINT32 width, height, depth;
+			PixelUtil::getSizeForMipLevel(mProperties.getWidth(), mProperties.getHeight(), mProperties.getDepth(),
+				numStreamedMips, width, height, depth);
+
+			if (std::max(width, height) <= STREAMING_MIN_MIP_SIZE)
+				break;
+
+			numStreamedMips++;
+		}
+
+		return numStreamedMips;
+	}
+
+	UINT64 Texture::_getResidentSize(UINT32 residentMip) const
+	{
+		UINT64 size = 0;
+		for (UINT32 i = residentMip; i <= mProperties.getNumMipmaps(); i++)
+		{
+			UINT32 width, height, depth;
+			PixelUtil::getSizeForMipLevel(mProperties.getWidth(), mProperties.getHeight(), mProperties.getDepth(), i,
+				width, height, depth);
+
+			size += PixelUtil::getMemorySize(width, height, depth, mProperties.getFormat());
+		}
+
+		return size * mProperties.getNumFaces();
+	}
+
+	bool Texture::_readStreamedMips(UINT32 firstMip, UINT32 lastMip, Vector<SPtr<PixelData>>& output) const
+	{
+		Lock lock(mStreamMutex);
+
+		if (mStreamData == nullptr || lastMip > mNumStreamedMips)
+			return false;
+
+		const UINT32 numFaces = mProperties.getNumFaces();
+		auto getMipSize = [this](UINT32 mip, UINT32& width, UINT32& height, UINT32& depth)
+		{
+			PixelUtil::getSizeForMipLevel(mProperties.getWidth(), mProperties.getHeight(), mProperties.getDepth(), mip,
+				width, height, depth);
+
+			return PixelUtil::getMemorySize(width, height, depth, mStreamFormat);
+		};
+
+		// Streamed mip levels are stored in order, starting with the most detailed one
+		UINT64 offset = mStreamOffset;
+		for (UINT32 i = 0; i < firstMip; i++)
+		{
+			UINT32 width, height, depth;
+			offset += (UINT64)getMipSize(i, width, height, depth) * numFaces;
+		}
+
+		mStreamData->seek((size_t)offset);
+		for (UINT32 i = firstMip; i < lastMip; i++)
+		{
+			UINT32 width, height, depth;
+			const UINT32 size = getMipSize(i, width, height, depth);
+
+			for (UINT32 j = 0; j < numFaces; j++)
+			{
+				SPtr<PixelData> data = PixelData::create(width, height, depth, mStreamFormat);
+				if (mStreamData->read(data->getData(), size) != size)
+				{
+					BS_LOG(Error, Texture, "Unable to read streamed texture data.");
+					return false;
+				}
+
+				// Source might have been saved with a format not supported by the current render API
+				if (mStreamFormat != mProperties.getFormat())
+				{
+					SPtr<PixelData> converted = PixelData::create(width, height, depth, mProperties.getFormat());
+					PixelUtil::bulkPixelConversion(*data, *converted);
+
+					data = converted;
+				}
+
+				output.push_back(data);
+			}
+		}
+
+		return true;
+	}
+
+	void Texture::_setResidentMip(UINT32 mip, const Vector<SPtr<PixelData>>& data)
+	{
+		mip = std::min(mip, mNumStreamedMips);
+		if (mip == mResidentMip || !isStreaming() || isDestroyed())
+			return;
+
+		const UINT32 numFaces = mProperties.getNumFaces();
+		if (mip < mResidentMip && (UINT32)data.size() != (mResidentMip - mip) * numFaces)
+		{
+			BS_LOG(Error, Texture, "Unable to make mip level {0} resident. Data was provided for {1} surfaces, but {2} "
+				"are required.", mip, (UINT32)data.size(), (mResidentMip - mip) * numFaces);
+			return;
+		}
+
+		SPtr<ct::Texture> newCore = ct::TextureManager::instance().createTextureInternal(getResidentDesc(mip));
+		newCore->mStreamingId = mStreamingId;
+
+		Vector<SPtr<PixelData>> newData;
+		if (mip < mResidentMip)
+		{
+			newData = data;
+			for (auto& entry : newData)
+				entry->_lock();
+		}
+
+		// Old core object is kept alive until the command executes, and is released on the core thread
+		auto func = [oldCore = getCore(), newCore, oldMip = mResidentMip, newMip = mip, numFaces,
+			numMips = mProperties.getNumMipmaps() + 1, newData]() mutable
+		{
+			newCore->initialize();
+
+			// Copy mip levels that were already resident
+			for (UINT32 i = std::max(oldMip, newMip); i < numMips; i++)
+			{
+				for (UINT32 j = 0; j < numFaces; j++)
+				{
+					TEXTURE_COPY_DESC copyDesc;
+					copyDesc.srcFace = j;
+					copyDesc.srcMip = i - oldMip;
+					copyDesc.dstFace = j;
+					copyDesc.dstMip = i - newMip;
+
+					oldCore->copy(newCore, copyDesc);
+				}
+			}
+
+			for (UINT32 i = 0; i < (UINT32)newData.size(); i++)
+			{
+				newCore->writeData(*newData[i], i / numFaces, i % numFaces, false);
+				newData[i]->_unlock();
+			}
+
+			oldCore = nullptr;
+		};
+
+		mCoreSpecific = newCore;
+		mResidentMip = mip;
+
+		gCoreThread().queueCommand(func);
+
+		// Lets dependants (e.g. materials) know they need to start using the new core object
+		markCoreDirty();
+	}
+
 	void Texture::updateCPUBuffers(UINT32 subresourceIdx, const PixelData& pixelData)
 	{
 		if ((mProperties.getUsage() & TU_CPUCACHED) == 0)
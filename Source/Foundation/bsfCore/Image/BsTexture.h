@@ -248,6 +248,20 @@ namespace bs
 		BS_SCRIPT_EXPORT(n:GetGPUPixels)
 		TAsyncOp<SPtr<PixelData>> readData(UINT32 face = 0, UINT32 mipLevel = 0);
 
+		/**
+		 * Reads internal texture data into a newly allocated buffer, without stalling the core thread waiting on the
+		 * GPU. Data is copied into a staging texture and the operation completes once the GPU finishes the copy,
+		 * normally a few frames later. See ct::GpuReadbackManager.
+		 *
+		 * @param[in]	face		Texture face to read from.
+		 * @param[in]	mipLevel	Mipmap level to read from.
+		 * @return					Async operation object that will contain the buffer with the data once the operation
+		 *							completes.
+		 *
+		 * @note This is an @ref asyncMethod "asynchronous method".
+		 */
+		TAsyncOp<SPtr<PixelData>> readDataDeferred(UINT32 face = 0, UINT32 mipLevel = 0);
+
 		/**
 		 * Reads data from the cached system memory texture buffer into the provided buffer.
 		 * 		
@@ -267,6 +281,31 @@ namespace bs
 		/**	Returns properties that contain information about the texture. */
 		const TextureProperties& getProperties() const { return mProperties; }
 
+		/**
+		 * Determines should the texture be saved with its larger mip levels stored in separately loadable chunks. When
+		 * such a texture is loaded only its smallest mip levels are made resident, while the larger ones are loaded on
+		 * demand by the TextureStreamingManager, depending on how large the texture appears on screen.
+		 *
+		 * Only textures with mipmaps and static usage (no CPU caching, render target or load-store usage) can be
+		 * streamed. The flag only takes effect the next time the texture is saved.
+		 */
+		void setStreamable(bool streamable) { mStreamable = streamable; }
+
+		/** @copydoc setStreamable */
+		bool isStreamable() const { return mStreamable; }
+
+		/** Checks if the texture was loaded from a streamable asset and has mip levels that can be loaded on demand. */
+		bool isStreaming() const { return mStreamData != nullptr; }
+
+		/**
+		 * Returns the most detailed mip level currently resident on the GPU. Less detailed mip levels are always
+		 * resident. Always zero for textures that aren't streaming.
+		 */
+		UINT32 getResidentMip() const { return mResidentMip; }
+
+		/** Returns the number of mip levels that are loaded on demand. Zero for textures that aren't streaming. */
+		UINT32 getNumStreamedMips() const { return mNumStreamedMips; }
+
 		/**	Retrieves a core implementation of a texture usable only from the core thread. */
 		SPtr<ct::Texture> getCore() const;
 
@@ -302,6 +341,38 @@ namespace bs
 		static SPtr<Texture> _createPtr(const SPtr<PixelData>& pixelData, int usage = TU_DEFAULT,
 			bool hwGammaCorrection = false);
 
+		/**
+		 * Returns an identifier of a streaming texture, as registered with the TextureStreamingManager. Zero for
+		 * textures that aren't streaming. The same identifier is reported by ct::Texture::getStreamingId().
+		 */
+		UINT32 _getStreamingId() const { return mStreamingId; }
+
+		/**
+		 * Calculates the amount of GPU memory required by the texture if the provided mip level was the most detailed
+		 * resident mip level, in bytes.
+		 */
+		UINT64 _getResidentSize(UINT32 residentMip) const;
+
+		/**
+		 * Reads data of the specified range of streamed mip levels from the source the texture was loaded from. Data
+		 * is output in order from the most detailed mip level, with all faces of one mip level stored before the next
+		 * mip level. Returns false if the data could not be read.
+		 *
+		 * @note	Thread safe.
+		 */
+		bool _readStreamedMips(UINT32 firstMip, UINT32 lastMip, Vector<SPtr<PixelData>>& output) const;
+
+		/**
+		 * Changes the most detailed mip level resident on the GPU. This re-creates the core texture with the new mip
+		 * range, and copies over the mip levels that remain resident.
+		 *
+		 * @param[in]	mip		Most detailed mip level to keep resident. Clamped to the number of streamed mips.
+		 * @param[in]	data	Data for mip levels that are becoming resident, as returned by _readStreamedMips() for
+		 *						the range [@p mip, getResidentMip()). Must be provided when making more mip levels
+		 *						resident, and is ignored otherwise.
+		 */
+		void _setResidentMip(UINT32 mip, const Vector<SPtr<PixelData>>& data = {});
+
 		/** @} */
 
 	protected:
@@ -319,6 +390,12 @@ namespace bs
 		/** Calculates the size of the texture, in bytes. */
 		UINT32 calculateSize() const;
 
+		/** Returns the descriptor of the core texture containing only the mip levels starting with the provided one. */
+		TEXTURE_DESC getResidentDesc(UINT32 residentMip) const;
+
+		/** Returns the number of mip levels to load on demand if the texture was saved as streamable. */
+		UINT32 calculateNumStreamedMips() const;
+
 		/**
 		 * Creates buffers used for caching of CPU texture data.
 		 *
@@ -334,6 +411,15 @@ namespace bs
 		TextureProperties mProperties;
 		mutable SPtr<PixelData> mInitData;
 
+		bool mStreamable = false;
+		UINT32 mNumStreamedMips = 0;
+		UINT32 mResidentMip = 0;
+		UINT32 mStreamingId = 0;
+		PixelFormat mStreamFormat = PF_UNKNOWN;
+		SPtr<DataStream> mStreamData;
+		UINT64 mStreamOffset = 0;
+		mutable Mutex mStreamMutex;
+
 		/************************************************************************/
 		/* 								SERIALIZATION                      		*/
 		/************************************************************************/
@@ -446,6 +532,13 @@ namespace bs
 		/**	Returns properties that contain information about the texture. */
 		const TextureProperties& getProperties() const { return mProperties; }
 
+		/**
+		 * Returns an identifier of the streaming texture this texture holds the resident mip levels of, or zero if the
+		 * texture isn't streaming. Renderers report how large such textures appear on screen to the
+		 * TextureStreamingManager using this identifier.
+		 */
+		UINT32 getStreamingId() const { return mStreamingId; }
+
 		/************************************************************************/
 		/* 								STATICS		                     		*/
 		/************************************************************************/
@@ -517,9 +610,12 @@ namespace bs
 		/** Releases all internal texture view references. */
 		void clearBufferViews();
 
+		friend class bs::Texture;
+
 		UnorderedMap<TEXTURE_VIEW_DESC, SPtr<TextureView>, TextureView::HashFunction, TextureView::EqualFunction> mTextureViews;
 		TextureProperties mProperties;
 		SPtr<PixelData> mInitData;
+		UINT32 mStreamingId = 0;
 	};
 
 	/** @} */
@@ -5,6 +5,7 @@
 #include "BsCorePrerequisites.h"
 #include "Importer/BsImportOptions.h"
 #include "Animation/BsAnimationClip.h"
+#include "Mesh/BsMeshUtility.h"
 
 namespace bs
 {
@@ -125,6 +126,34 @@ namespace bs
 		BS_SCRIPT_EXPORT()
 		float importScale = 1.0f;
 
+		/**
+		 * Determines which optimizations are performed on the imported mesh geometry. Optimizations include welding of
+		 * identical vertices, removal of degenerate triangles and reordering of triangles and vertices for better GPU
+		 * vertex cache and fetch efficiency, and reduced overdraw. Disabled by default, as the optimizations change the
+		 * order of vertices and indices, which existing assets might rely on.
+		 */
+		BS_SCRIPT_EXPORT()
+		MeshOptimizationFlags optimization = MeshOptimizationFlag::None;
+
+		/**
+		 * Number of additional levels of detail to generate for the mesh, by simplifying the imported geometry. Each level
+		 * is used when the mesh gets smaller on screen than the previous one. Zero disables level of detail generation.
+		 */
+		BS_SCRIPT_EXPORT()
+		UINT32 lodCount = 0;
+
+		/** Number of triangles in each generated level of detail, relative to the previous level. In range (0, 1). */
+		BS_SCRIPT_EXPORT()
+		float lodReduction = 0.5f;
+
+		/**
+		 * Determines which vertex attributes are stored in compact, quantized formats. Positions are stored as 16-bit
+		 * integers relative to the mesh bounds, normals and tangents as 10:10:10:2 integers and texture coordinates as
+		 * 16-bit floats. Position quantization is not applied to meshes with skinning or morph shapes.
+		 */
+		BS_SCRIPT_EXPORT()
+		MeshQuantizationFlags quantization;
+
 		/**	
 		 * Determines what type (if any) of collision mesh should be imported. If enabled the collision mesh will be
 		 * available as a sub-resource returned by the importer (along with the normal mesh).
@@ -57,6 +57,13 @@ namespace bs
 		BS_SCRIPT_EXPORT()
 		CubemapSourceType cubemapSourceType = CubemapSourceType::Faces;
 
+		/**
+		 * Determines should the texture be saved so that its larger mip levels are loaded on demand, depending on how
+		 * large the texture appears on screen. Only relevant when @p generateMips is true and @p cpuCached is false.
+		 */
+		BS_SCRIPT_EXPORT()
+		bool streamable = false;
+
 		/** Creates a new import options object that allows you to customize how are textures imported. */
 		BS_SCRIPT_EXPORT(ec:T)
 		static SPtr<TextureImportOptions> create();
@@ -0,0 +1,258 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#include "Managers/BsGpuReadbackManager.h"
+#include "RenderAPI/BsGpuBuffer.h"
+#include "RenderAPI/BsEventQuery.h"
+#include "Image/BsPixelUtil.h"
+#include "FileSystem/BsDataStream.h"
+#include "Utility/BsBitwise.h"
+
+namespace bs { namespace ct
+{
+	constexpr UINT32 GpuStagingPool::MAX_UNUSED_FRAMES;
+	constexpr UINT32 GpuStagingPool::MIN_BUFFER_SIZE;
+
+	SPtr<Texture> GpuStagingPool::allocTexture(const TEXTURE_DESC& desc)
+	{
+		for (auto iter = mFreeTextures.begin(); iter != mFreeTextures.end(); ++iter)
+		{
+			const TextureProperties& props = iter->texture->getProperties();
+			if (props.getTextureType() == desc.type && props.getFormat() == desc.format &&
+				props.getWidth() == desc.width && props.getHeight() == desc.height && props.getDepth() == desc.depth &&
+				props.isHardwareGammaEnabled() == desc.hwGamma)
+			{
+				SPtr<Texture> texture = iter->texture;
+				mFreeTextures.erase(iter);
+
+				return texture;
+			}
+		}
+
+		TEXTURE_DESC stagingDesc;
+		stagingDesc.type = desc.type;
+		stagingDesc.format = desc.format;
+		stagingDesc.width = desc.width;
+		stagingDesc.height = desc.height;
+		stagingDesc.depth = desc.depth;
+		stagingDesc.hwGamma = desc.hwGamma;
+		stagingDesc.usage = TU_STATIC | TU_CPUREADABLE;
+
+		mNumAllocated++;
+		return Texture::create(stagingDesc);
+	}
+
+	SPtr<GpuBuffer> GpuStagingPool::allocBuffer(UINT32 size)
+	{
+		size = Bitwise::nextPow2(std::max(size, MIN_BUFFER_SIZE));
+
+		for (auto iter = mFreeBuffers.begin(); iter != mFreeBuffers.end(); ++iter)
+		{
+			if (iter->buffer->getSize() == size)
+			{
+				SPtr<GpuBuffer> buffer = iter->buffer;
+				mFreeBuffers.erase(iter);
+
+				return buffer;
+			}
+		}
+
+		GPU_BUFFER_DESC desc;
+		desc.type = GBT_STANDARD;
+		desc.format = BF_32X1U;
+		desc.elementCount = size / sizeof(UINT32);
+		desc.usage = GBU_DYNAMIC;
+
+		mNumAllocated++;
+		return GpuBuffer::create(desc);
+	}
+
+	void GpuStagingPool::release(const SPtr<Texture>& texture)
+	{
+		mFreeTextures.push_back({ texture, mFrameIdx });
+	}
+
+	void GpuStagingPool::release(const SPtr<GpuBuffer>& buffer)
+	{
+		mFreeBuffers.push_back({ buffer, mFrameIdx });
+	}
+
+	void GpuStagingPool::update()
+	{
+		mFrameIdx++;
+
+		for (auto iter = mFreeTextures.begin(); iter != mFreeTextures.end();)
+		{
+			if (mFrameIdx - iter->releaseFrame > MAX_UNUSED_FRAMES)
+			{
+				iter = mFreeTextures.erase(iter);
+				mNumAllocated--;
+			}
+			else
+				++iter;
+		}
+
+		for (auto iter = mFreeBuffers.begin(); iter != mFreeBuffers.end();)
+		{
+			if (mFrameIdx - iter->releaseFrame > MAX_UNUSED_FRAMES)
+			{
+				iter = mFreeBuffers.erase(iter);
+				mNumAllocated--;
+			}
+			else
+				++iter;
+		}
+	}
+
+	void GpuStagingPool::clear()
+	{
+		mNumAllocated -= getNumFree();
+
+		mFreeTextures.clear();
+		mFreeBuffers.clear();
+	}
+
+	GpuReadbackManager::~GpuReadbackManager()
+	{
+		// Readbacks can no longer complete, so notify any waiting callers
+		for (auto& readback : mPending)
+		{
+			if (readback.stagingTexture != nullptr)
+				readback.textureOp._completeOperation(nullptr);
+			else
+				readback.bufferOp._completeOperation(nullptr);
+		}
+	}
+
+	TAsyncOp<SPtr<PixelData>> GpuReadbackManager::readTexture(const SPtr<Texture>& texture, UINT32 face,
+		UINT32 mipLevel, const SPtr<CommandBuffer>& commandBuffer)
+	{
+		TAsyncOp<SPtr<PixelData>> op;
+		readTexture(texture, face, mipLevel, op, commandBuffer);
+
+		return op;
+	}
+
+	void GpuReadbackManager::readTexture(const SPtr<Texture>& texture, UINT32 face, UINT32 mipLevel,
+		const TAsyncOp<SPtr<PixelData>>& op, const SPtr<CommandBuffer>& commandBuffer)
+	{
+		const TextureProperties& props = texture->getProperties();
+		if (face >= props.getNumFaces() || mipLevel > props.getNumMipmaps())
+		{
+			BS_LOG(Error, Texture, "Invalid face or mip level for a readback: {0}, {1}. Max is {2}, {3}.", face,
+				mipLevel, props.getNumFaces() - 1, props.getNumMipmaps());
+
+			TAsyncOp<SPtr<PixelData>> failedOp = op;
+			failedOp._completeOperation(nullptr);
+			return;
+		}
+
+		TEXTURE_DESC stagingDesc;
+		stagingDesc.type = props.getTextureType();
+		stagingDesc.format = props.getFormat();
+		stagingDesc.hwGamma = props.isHardwareGammaEnabled();
+		PixelUtil::getSizeForMipLevel(props.getWidth(), props.getHeight(), props.getDepth(), mipLevel,
+			stagingDesc.width, stagingDesc.height, stagingDesc.depth);
+
+		PendingReadback readback;
+		readback.stagingTexture = mStagingPool.allocTexture(stagingDesc);
+		readback.stagingFace = props.getTextureType() == TEX_TYPE_CUBE_MAP ? face % 6 : 0;
+		readback.textureOp = op;
+
+		TEXTURE_COPY_DESC copyDesc;
+		copyDesc.srcFace = face;
+		copyDesc.srcMip = mipLevel;
+		copyDesc.dstFace = readback.stagingFace;
+
+		texture->copy(readback.stagingTexture, copyDesc, commandBuffer);
+
+		readback.query = allocQuery();
+		readback.query->begin(commandBuffer);
+
+		mPending.push_back(readback);
+	}
+
+	TAsyncOp<SPtr<MemoryDataStream>> GpuReadbackManager::readBuffer(const SPtr<GpuBuffer>& buffer, UINT32 offset,
+		UINT32 length, const SPtr<CommandBuffer>& commandBuffer)
+	{
+		TAsyncOp<SPtr<MemoryDataStream>> op;
+		readBuffer(buffer, offset, length, op, commandBuffer);
+
+		return op;
+	}
+
+	void GpuReadbackManager::readBuffer(const SPtr<GpuBuffer>& buffer, UINT32 offset, UINT32 length,
+		const TAsyncOp<SPtr<MemoryDataStream>>& op, const SPtr<CommandBuffer>& commandBuffer)
+	{
+		if (length == 0 || offset + length > buffer->getSize() || offset + length < offset)
+		{
+			BS_LOG(Error, RenderBackend, "Invalid range for a buffer readback: offset {0}, length {1}. Buffer size is "
+				"{2}.", offset, length, buffer->getSize());
+
+			TAsyncOp<SPtr<MemoryDataStream>> failedOp = op;
+			failedOp._completeOperation(nullptr);
+			return;
+		}
+
+		PendingReadback readback;
+		readback.stagingBuffer = mStagingPool.allocBuffer(length);
+		readback.length = length;
+		readback.bufferOp = op;
+
+		readback.stagingBuffer->copyData(*buffer, offset, 0, length, false, commandBuffer);
+
+		readback.query = allocQuery();
+		readback.query->begin(commandBuffer);
+
+		mPending.push_back(readback);
+	}
+
+	void GpuReadbackManager::_update()
+	{
+		mStagingPool.update();
+
+		// Command buffers can complete out of order, so every readback needs to be checked
+		for (auto iter = mPending.begin(); iter != mPending.end();)
+		{
+			if (iter->query->isReady())
+			{
+				complete(*iter);
+				iter = mPending.erase(iter);
+			}
+			else
+				++iter;
+		}
+	}
+
+	SPtr<EventQuery> GpuReadbackManager::allocQuery()
+	{
+		if (mFreeQueries.empty())
+			return EventQuery::create();
+
+		SPtr<EventQuery> query = mFreeQueries.back();
+		mFreeQueries.pop_back();
+
+		return query;
+	}
+
+	void GpuReadbackManager::complete(PendingReadback& readback)
+	{
+		if (readback.stagingTexture != nullptr)
+		{
+			SPtr<PixelData> output = readback.stagingTexture->getProperties().allocBuffer(readback.stagingFace, 0);
+			readback.stagingTexture->readData(*output, 0, readback.stagingFace);
+
+			mStagingPool.release(readback.stagingTexture);
+			readback.textureOp._completeOperation(output);
+		}
+		else
+		{
+			SPtr<MemoryDataStream> output = bs_shared_ptr_new<MemoryDataStream>(readback.length);
+			readback.stagingBuffer->readData(0, readback.length, output->data());
+
+			mStagingPool.release(readback.stagingBuffer);
+			readback.bufferOp._completeOperation(output);
+		}
+
+		mFreeQueries.push_back(readback.query);
+	}
+}}
@@ -0,0 +1,172 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "BsCorePrerequisites.h"
+#include "Utility/BsModule.h"
+#include "Image/BsTexture.h"
+
+namespace bs { namespace ct
+{
+	/** @addtogroup RenderAPI-Internal
+	 *  @{
+	 */
+
+	/**
+	 * Pool of textures and buffers used as staging memory for GPU readbacks. Released resources are reused by later
+	 * allocations with matching properties, and destroyed once they go unused for GpuStagingPool::MAX_UNUSED_FRAMES
+	 * frames.
+	 *
+	 * @note	Core thread only.
+	 */
+	class BS_CORE_EXPORT GpuStagingPool
+	{
+	public:
+		/** Number of frames a released resource is kept in the pool before it is destroyed. */
+		static constexpr UINT32 MAX_UNUSED_FRAMES = 60;
+
+		/** Smallest size of an allocated staging buffer, in bytes. */
+		static constexpr UINT32 MIN_BUFFER_SIZE = 256;
+
+		/**
+		 * Returns a staging texture with the type, format, size and gamma correction specified in @p desc, and with a
+		 * single mip level. Cubemaps have six faces, other textures a single face.
+		 */
+		SPtr<Texture> allocTexture(const TEXTURE_DESC& desc);
+
+		/**
+		 * Returns a staging buffer of at least @p size bytes. Sizes are rounded up to a power of two so buffers can be
+		 * reused by allocations of similar size.
+		 */
+		SPtr<GpuBuffer> allocBuffer(UINT32 size);
+
+		/** Returns a texture allocated by allocTexture() to the pool. */
+		void release(const SPtr<Texture>& texture);
+
+		/** Returns a buffer allocated by allocBuffer() to the pool. */
+		void release(const SPtr<GpuBuffer>& buffer);
+
+		/** Advances the frame counter and destroys resources that haven't been used recently. Call once per frame. */
+		void update();
+
+		/**
+		 * Destroys all resources held by the pool. Resources still in use are destroyed once their users release them.
+		 */
+		void clear();
+
+		/** Returns the number of staging resources currently allocated, both in use and held by the pool. */
+		UINT32 getNumAllocated() const { return mNumAllocated; }
+
+		/** Returns the number of staging resources held by the pool, available for reuse. */
+		UINT32 getNumFree() const { return (UINT32)(mFreeTextures.size() + mFreeBuffers.size()); }
+
+	private:
+		/** Staging texture available for reuse. */
+		struct FreeTexture
+		{
+			SPtr<Texture> texture;
+			UINT64 releaseFrame;
+		};
+
+		/** Staging buffer available for reuse. */
+		struct FreeBuffer
+		{
+			SPtr<GpuBuffer> buffer;
+			UINT64 releaseFrame;
+		};
+
+		Vector<FreeTexture> mFreeTextures;
+		Vector<FreeBuffer> mFreeBuffers;
+		UINT32 mNumAllocated = 0;
+		UINT64 mFrameIdx = 0;
+	};
+
+	/**
+	 * Reads data from textures and buffers on the GPU without stalling the CPU. Each readback records a copy of the
+	 * requested data into staging memory, followed by an event query. The returned operation completes during
+	 * _update() once the query reports the GPU has finished the copy, which is normally a few frames later.
+	 *
+	 * @note	Core thread only.
+	 */
+	class BS_CORE_EXPORT GpuReadbackManager : public Module<GpuReadbackManager>
+	{
+	public:
+		~GpuReadbackManager();
+
+		/**
+		 * Queues a read of a single face and mip level of a texture.
+		 *
+		 * @param[in]	texture			Texture to read from.
+		 * @param[in]	face			Face to read. This can be an entry in an array of textures, or a single face of
+		 *								a cube map.
+		 * @param[in]	mipLevel		Mip level to read.
+		 * @param[in]	commandBuffer	Command buffer to queue the copy on. If null, the main command buffer is used.
+		 *								The readback can only complete after the command buffer is submitted.
+		 * @return						Operation that completes with the pixels of the requested surface, or with null
+		 *								if the surface couldn't be read.
+		 */
+		TAsyncOp<SPtr<PixelData>> readTexture(const SPtr<Texture>& texture, UINT32 face = 0, UINT32 mipLevel = 0,
+			const SPtr<CommandBuffer>& commandBuffer = nullptr);
+
+		/** Same as readTexture() except it completes the provided operation instead of creating a new one. */
+		void readTexture(const SPtr<Texture>& texture, UINT32 face, UINT32 mipLevel,
+			const TAsyncOp<SPtr<PixelData>>& op, const SPtr<CommandBuffer>& commandBuffer = nullptr);
+
+		/**
+		 * Queues a read of a range of bytes from a buffer.
+		 *
+		 * @param[in]	buffer			Buffer to read from.
+		 * @param[in]	offset			Offset of the first byte to read.
+		 * @param[in]	length			Number of bytes to read.
+		 * @param[in]	commandBuffer	Command buffer to queue the copy on. If null, the main command buffer is used.
+		 *								The readback can only complete after the command buffer is submitted.
+		 * @return						Operation that completes with a stream of @p length bytes, or with null if the
+		 *								range couldn't be read.
+		 */
+		TAsyncOp<SPtr<MemoryDataStream>> readBuffer(const SPtr<GpuBuffer>& buffer, UINT32 offset, UINT32 length,
+			const SPtr<CommandBuffer>& commandBuffer = nullptr);
+
+		/** Same as readBuffer() except it completes the provided operation instead of creating a new one. */
+		void readBuffer(const SPtr<GpuBuffer>& buffer, UINT32 offset, UINT32 length,
+			const TAsyncOp<SPtr<MemoryDataStream>>& op, const SPtr<CommandBuffer>& commandBuffer = nullptr);
+
+		/** Returns the number of readbacks still waiting on the GPU. */
+		UINT32 getNumPending() const { return (UINT32)mPending.size(); }
+
+		/** Returns the pool the staging memory is allocated from. */
+		const GpuStagingPool& getStagingPool() const { return mStagingPool; }
+
+		/**
+		 * Completes the readbacks the GPU has finished with. Should be called once per frame, after
+		 * QueryManager::_update().
+		 */
+		void _update();
+
+	private:
+		/** Readback waiting for the GPU to finish copying the data into staging memory. */
+		struct PendingReadback
+		{
+			SPtr<EventQuery> query;
+
+			SPtr<Texture> stagingTexture;
+			UINT32 stagingFace = 0;
+			TAsyncOp<SPtr<PixelData>> textureOp = TAsyncOp<SPtr<PixelData>>(AsyncOpEmpty());
+
+			SPtr<GpuBuffer> stagingBuffer;
+			UINT32 length = 0;
+			TAsyncOp<SPtr<MemoryDataStream>> bufferOp = TAsyncOp<SPtr<MemoryDataStream>>(AsyncOpEmpty());
+		};
+
+		/** Returns an event query from the free list, or creates a new one. */
+		SPtr<EventQuery> allocQuery();
+
+		/** Reads the data out of the staging memory, completes the operation and releases the staging memory. */
+		void complete(PendingReadback& readback);
+
+		Vector<PendingReadback> mPending;
+		Vector<SPtr<EventQuery>> mFreeQueries;
+		GpuStagingPool mStagingPool;
+	};
+
+	/** @} */
+}}
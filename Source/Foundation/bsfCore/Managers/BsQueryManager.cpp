@@ -35,6 +35,8 @@ namespace bs { namespace ct
 
 	void QueryManager::_update()
 	{
+		mUpdateCount++;
+
 		for(auto& query : mEventQueries)
 		{
 			if(query->isActive() && query->isReady())
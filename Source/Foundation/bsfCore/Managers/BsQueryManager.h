@@ -49,6 +49,9 @@ namespace bs { namespace ct
 		 */
 		virtual SPtr<OcclusionQuery> createOcclusionQuery(bool binary, UINT32 deviceIdx = 0) const = 0;
 
+		/** Returns the number of times _update() has been called, which is normally equal to the number of frames. */
+		UINT64 getUpdateCount() const { return mUpdateCount; }
+
 		/** Triggers completed queries. Should be called every frame. */
 		void _update();
 
@@ -86,6 +89,8 @@ namespace bs { namespace ct
 		mutable Vector<EventQuery*> mDeletedEventQueries;
 		mutable Vector<TimerQuery*> mDeletedTimerQueries;
 		mutable Vector<OcclusionQuery*> mDeletedOcclusionQueries;
+
+		UINT64 mUpdateCount = 0;
 	};
 
 	/** @} */
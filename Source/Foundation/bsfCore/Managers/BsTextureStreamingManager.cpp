@@ -0,0 +1,258 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#include "Managers/BsTextureStreamingManager.h"
+#include "Image/BsTexture.h"
+#include "Image/BsPixelData.h"
+#include "Threading/BsTaskScheduler.h"
+#include "Math/BsMath.h"
+
+namespace bs
+{
+	TextureStreamingManager::TextureStreamingManager(const TEXTURE_STREAMING_DESC& desc)
+		:mDesc(desc)
+	{ }
+
+	TextureStreamingManager::~TextureStreamingManager()
+	{
+		// Tasks reference the texture info, so they must finish before it is destroyed
+		for (auto& entry : mTextures)
+		{
+			if (entry.second.loadTask != nullptr)
+				entry.second.loadTask->wait();
+		}
+	}
+
+	UINT32 TextureStreamingManager::_registerTexture(const SPtr<Texture>& texture)
+	{
+		Lock lock(mMutex);
+
+		const UINT32 id = mNextId++;
+		mNewTextures.push_back(std::make_pair(id, texture));
+
+		return id;
+	}
+
+	void TextureStreamingManager::notifyUsage(UINT32 streamingId, float screenSize)
+	{
+		if (streamingId == 0)
+			return;
+
+		Lock lock(mMutex);
+
+		auto iterFind = mUsage.find(streamingId);
+		if (iterFind == mUsage.end())
+			mUsage[streamingId] = screenSize;
+		else
+			iterFind->second = std::max(iterFind->second, screenSize);
+	}
+
+	UINT64 TextureStreamingManager::getResidentMemory() const
+	{
+		UINT64 total = 0;
+		for (auto& entry : mTextures)
+		{
+			SPtr<Texture> texture = entry.second.texture.lock();
+			if (texture != nullptr)
+				total += texture->_getResidentSize(texture->getResidentMip());
+		}
+
+		return total;
+	}
+
+	UINT32 TextureStreamingManager::getRequiredMip(const TextureInfo& info, const Texture& texture) const
+	{
+		const UINT32 numStreamedMips = texture.getNumStreamedMips();
+
+		// Textures that haven't been used for a while only keep the always resident mip levels
+		if (!info.used || (info.lastUsedFrame + mDesc.evictionDelay) < mFrameIdx)
+			return numStreamedMips;
+
+		const TextureProperties& props = texture.getProperties();
+		const UINT32 size = std::max(props.getWidth(), props.getHeight());
+
+		// Pick the least detailed mip level that is at least as large as the texture on screen
+		UINT32 mip = 0;
+		while (mip < numStreamedMips && (size >> (mip + 1)) >= info.screenSize)
+			mip++;
+
+		return mip;
+	}
+
+	void TextureStreamingManager::update()
+	{
+		// Gather newly registered textures and usage reported since the last update
+		{
+			Lock lock(mMutex);
+
+			for (auto& entry : mNewTextures)
+				mTextures[entry.first].texture = entry.second;
+
+			mNewTextures.clear();
+
+			for (auto& entry : mUsage)
+			{
+				auto iterFind = mTextures.find(entry.first);
+				if (iterFind == mTextures.end())
+					continue;
+
+				TextureInfo& info = iterFind->second;
+				if (info.lastUsedFrame != mFrameIdx)
+					info.screenSize = entry.second;
+				else
+					info.screenSize = std::max(info.screenSize, entry.second);
+
+				info.lastUsedFrame = mFrameIdx;
+				info.used = true;
+			}
+
+			mUsage.clear();
+		}
+
+		// Stop tracking destroyed textures, and determine the mip levels each texture requires
+		struct Request
+		{
+			UINT32 id;
+			TextureInfo* info;
+			SPtr<Texture> texture;
+			UINT32 requiredMip;
+		};
+
+		Vector<Request> requests;
+		requests.reserve(mTextures.size());
+
+		UINT64 usedMemory = 0;
+		for (auto iter = mTextures.begin(); iter != mTextures.end();)
+		{
+			TextureInfo& info = iter->second;
+			SPtr<Texture> texture = info.texture.lock();
+			if (texture == nullptr || texture->isDestroyed())
+			{
+				// Can't remove the entry while its load is still referencing it
+				if (info.loadTask == nullptr || info.loadTask->isComplete())
+				{
+					iter = mTextures.erase(iter);
+					continue;
+				}
+
+				++iter;
+				continue;
+			}
+
+			requests.push_back({ iter->first, &info, texture, getRequiredMip(info, *texture) });
+			usedMemory += texture->_getResidentSize(texture->getNumStreamedMips());
+
+			++iter;
+		}
+
+		// Distribute the budget, giving priority to textures that appear larger on screen
+		std::sort(requests.begin(), requests.end(), [](const Request& a, const Request& b)
+		{
+			if (a.info->screenSize != b.info->screenSize)
+				return a.info->screenSize > b.info->screenSize;
+
+			return a.id < b.id;
+		});
+
+		for (auto& request : requests)
+		{
+			const UINT32 numStreamedMips = request.texture->getNumStreamedMips();
+			const UINT64 baseSize = request.texture->_getResidentSize(numStreamedMips);
+
+			UINT32 targetMip = request.requiredMip;
+			while (targetMip < numStreamedMips &&
+				usedMemory + request.texture->_getResidentSize(targetMip) - baseSize > mDesc.memoryBudget)
+			{
+				targetMip++;
+			}
+
+			usedMemory += request.texture->_getResidentSize(targetMip) - baseSize;
+			request.info->targetMip = targetMip;
+		}
+
+		// Evict mip levels above the target first, so loads finishing below don't exceed the budget
+		for (auto& request : requests)
+		{
+			if (request.texture->getResidentMip() < request.info->targetMip)
+				request.texture->_setResidentMip(request.info->targetMip);
+		}
+
+		// Make finished loads resident and start new ones
+		UINT32 numLoads = 0;
+		for (auto& request : requests)
+		{
+			TextureInfo& info = *request.info;
+			if (info.loadTask != nullptr)
+			{
+				if (!info.loadTask->isComplete())
+				{
+					numLoads++;
+					continue;
+				}
+
+				finishLoad(info, *request.texture);
+			}
+
+			const UINT32 residentMip = request.texture->getResidentMip();
+			if (info.targetMip >= residentMip || numLoads >= mDesc.maxConcurrentLoads)
+				continue;
+
+			info.loadMip = info.targetMip;
+			info.loadedData.clear();
+			info.loadSucceeded = false;
+
+			// Texture pointer is held by the task, so the streaming source remains valid until the load finishes
+			TextureInfo* infoPtr = &info;
+			SPtr<Texture> texture = request.texture;
+			info.loadTask = Task::create("TextureStreaming", [infoPtr, texture, residentMip]()
+			{
+				infoPtr->loadSucceeded = texture->_readStreamedMips(infoPtr->loadMip, residentMip, infoPtr->loadedData);
+			});
+
+			TaskScheduler::instance().addTask(info.loadTask);
+			numLoads++;
+		}
+
+		mFrameIdx++;
+	}
+
+	void TextureStreamingManager::waitUntilLoaded()
+	{
+		for (auto& entry : mTextures)
+		{
+			TextureInfo& info = entry.second;
+			if (info.loadTask == nullptr)
+				continue;
+
+			info.loadTask->wait();
+
+			SPtr<Texture> texture = info.texture.lock();
+			if (texture != nullptr && !texture->isDestroyed())
+				finishLoad(info, *texture);
+			else
+			{
+				info.loadTask = nullptr;
+				info.loadedData.clear();
+			}
+		}
+	}
+
+	void TextureStreamingManager::finishLoad(TextureInfo& info, Texture& texture)
+	{
+		// Loaded data covers mip levels from the load mip up to the mip level that was resident when the load started
+		const UINT32 numFaces = texture.getProperties().getNumFaces();
+		const UINT32 loadEndMip = info.loadMip + (UINT32)info.loadedData.size() / std::max(numFaces, 1U);
+		const UINT32 residentMip = texture.getResidentMip();
+
+		// Only use the loaded data if it still connects to the resident mip levels, and only up to the target mip
+		// level, which might have changed since the load started
+		const UINT32 newMip = std::max(info.loadMip, info.targetMip);
+		if (info.loadSucceeded && loadEndMip == residentMip && newMip < residentMip)
+		{
+			const auto first = info.loadedData.begin() + (newMip - info.loadMip) * numFaces;
+			texture._setResidentMip(newMip, Vector<SPtr<PixelData>>(first, info.loadedData.end()));
+		}
+
+		info.loadTask = nullptr;
+		info.loadedData.clear();
+	}
+}
@@ -0,0 +1,135 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "BsCorePrerequisites.h"
+#include "Utility/BsModule.h"
+
+namespace bs
+{
+	/** @addtogroup Resources-Internal
+	 *  @{
+	 */
+
+	/** Settings that control the behaviour of the TextureStreamingManager. */
+	struct TEXTURE_STREAMING_DESC
+	{
+		/**
+		 * Maximum amount of GPU memory that streaming textures are allowed to use, in bytes. The smallest mip levels of
+		 * each streaming texture are always resident and count towards the budget, but are never evicted.
+		 */
+		UINT64 memoryBudget = 512 * 1024 * 1024;
+
+		/** Maximum number of textures that can be loading their mip levels at the same time. */
+		UINT32 maxConcurrentLoads = 4;
+
+		/**
+		 * Number of frames after which a texture that hasn't been reported as used by the renderer has its streamed mip
+		 * levels evicted.
+		 */
+		UINT32 evictionDelay = 60;
+	};
+
+	/**
+	 * Keeps track of textures loaded from streamable assets (see Texture::setStreamable) and decides which of their mip
+	 * levels should be resident on the GPU. The renderer reports how large each texture appears on screen, after which
+	 * the manager loads the mip levels required to display the texture at that size. When the memory budget would be
+	 * exceeded, textures that appear smaller on screen get fewer mip levels.
+	 *
+	 * Mip levels are read and decoded on worker threads and made resident during update(), so the memory used by the
+	 * resident mip levels never exceeds the budget, unless the always resident mip levels alone exceed it.
+	 */
+	class BS_CORE_EXPORT TextureStreamingManager : public Module<TextureStreamingManager>
+	{
+	public:
+		TextureStreamingManager(const TEXTURE_STREAMING_DESC& desc = TEXTURE_STREAMING_DESC());
+		~TextureStreamingManager();
+
+		/** Changes the maximum amount of GPU memory that streaming textures are allowed to use, in bytes. */
+		void setMemoryBudget(UINT64 budget) { mDesc.memoryBudget = budget; }
+
+		/** Returns the maximum amount of GPU memory that streaming textures are allowed to use, in bytes. */
+		UINT64 getMemoryBudget() const { return mDesc.memoryBudget; }
+
+		/** Returns the amount of GPU memory used by the currently resident mip levels of all streaming textures. */
+		UINT64 getResidentMemory() const;
+
+		/** Returns the number of streaming textures tracked by the manager. */
+		UINT32 getNumTextures() const { return (UINT32)mTextures.size(); }
+
+		/**
+		 * Reports how large a streaming texture appears on screen during the current frame. If reported multiple times
+		 * during a frame, the largest size is used.
+		 *
+		 * @param[in]	streamingId		Identifier of the texture, as returned by ct::Texture::getStreamingId().
+		 * @param[in]	screenSize		Size of the area the texture is displayed on, in pixels. This determines the
+		 *								resolution of the most detailed mip level required to display the texture.
+		 *
+		 * @note	Thread safe. Normally called by the renderer from the core thread.
+		 */
+		void notifyUsage(UINT32 streamingId, float screenSize);
+
+		/**
+		 * Determines which mip levels should be resident based on usage reported since the last call, evicts mip
+		 * levels that are no longer needed, makes newly loaded mip levels resident and starts loading new ones. Should
+		 * be called once per frame.
+		 *
+		 * @note	Sim thread only.
+		 */
+		void update();
+
+		/**
+		 * Blocks until all mip levels that are currently being loaded finish loading, and makes them resident.
+		 *
+		 * @note	Sim thread only.
+		 */
+		void waitUntilLoaded();
+
+		/** @name Internal
+		 *  @{
+		 */
+
+		/**
+		 * Starts tracking a newly loaded streaming texture. Returns the identifier assigned to the texture.
+		 *
+		 * @note	Thread safe.
+		 */
+		UINT32 _registerTexture(const SPtr<Texture>& texture);
+
+		/** @} */
+
+	private:
+		/** Information about a single streaming texture. */
+		struct TextureInfo
+		{
+			WeakSPtr<Texture> texture;
+
+			float screenSize = 0.0f;
+			UINT64 lastUsedFrame = 0;
+			bool used = false;
+			UINT32 targetMip = 0;
+
+			SPtr<Task> loadTask;
+			UINT32 loadMip = 0;
+			Vector<SPtr<PixelData>> loadedData;
+			bool loadSucceeded = false;
+		};
+
+		/** Makes mip levels from a finished load resident, if they are still required. */
+		void finishLoad(TextureInfo& info, Texture& texture);
+
+		/** Determines the most detailed mip level required for displaying the texture at the reported size. */
+		UINT32 getRequiredMip(const TextureInfo& info, const Texture& texture) const;
+
+		TEXTURE_STREAMING_DESC mDesc;
+		UnorderedMap<UINT32, TextureInfo> mTextures;
+		UINT64 mFrameIdx = 1;
+
+		Mutex mMutex;
+		UINT32 mNextId = 1;
+		Vector<std::pair<UINT32, WeakSPtr<Texture>>> mNewTextures;
+		UnorderedMap<UINT32, float> mUsage;
+	};
+
+	/** @} */
+}
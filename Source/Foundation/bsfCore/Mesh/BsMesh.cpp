@@ -20,7 +20,8 @@ namespace bs
 		:MeshBase(desc.numVertices, desc.numIndices, desc.subMeshes), mVertexDesc(desc.vertexDesc), mUsage(desc.usage),
 		mIndexType(desc.indexType), mSkeleton(desc.skeleton), mMorphShapes(desc.morphShapes)
 	{
-
+		mProperties.mLODs = desc.lods;
+		mProperties.mPositionQuantization = desc.positionQuantization;
 	}
 
 	Mesh::Mesh(const SPtr<MeshData>& initialMeshData, const MESH_DESC& desc)
@@ -28,7 +29,10 @@ namespace bs
 		mCPUData(initialMeshData), mVertexDesc(initialMeshData->getVertexDesc()),
 		mUsage(desc.usage), mIndexType(initialMeshData->getIndexType()), mSkeleton(desc.skeleton),
 		mMorphShapes(desc.morphShapes)
-	{ }
+	{
+		mProperties.mLODs = desc.lods;
+		mProperties.mPositionQuantization = desc.positionQuantization;
+	}
 
 	Mesh::Mesh()
 		:MeshBase(0, 0, DOT_TRIANGLE_LIST)
@@ -96,6 +100,10 @@ namespace bs
 	void Mesh::updateBounds(const MeshData& meshData)
 	{
 		mProperties.mBounds = meshData.calculateBounds();
+
+		if(!mProperties.mPositionQuantization.isIdentity())
+			mProperties.mBounds.transformAffine(mProperties.mPositionQuantization.getDecodeMatrix());
+
 		markCoreDirty();
 	}
 
@@ -111,6 +119,8 @@ namespace bs
 		desc.numIndices = mProperties.mNumIndices;
 		desc.vertexDesc = mVertexDesc;
 		desc.subMeshes = mProperties.mSubMeshes;
+		desc.lods = mProperties.mLODs;
+		desc.positionQuantization = mProperties.mPositionQuantization;
 		desc.usage = mUsage;
 		desc.indexType = mIndexType;
 		desc.skeleton = mSkeleton;
@@ -262,8 +272,10 @@ namespace bs
 		: MeshBase(desc.numVertices, desc.numIndices, desc.subMeshes), mVertexData(nullptr), mIndexBuffer(nullptr)
 		, mVertexDesc(desc.vertexDesc), mUsage(desc.usage), mIndexType(desc.indexType), mDeviceMask(deviceMask)
 		, mTempInitialMeshData(initialMeshData), mSkeleton(desc.skeleton), mMorphShapes(desc.morphShapes)
-
-	{ }
+	{
+		mProperties.mLODs = desc.lods;
+		mProperties.mPositionQuantization = desc.positionQuantization;
+	}
 
 	Mesh::~Mesh()
 	{
@@ -514,6 +526,9 @@ namespace bs
 	{
 		mProperties.mBounds = meshData.calculateBounds();
 
+		if(!mProperties.mPositionQuantization.isIdentity())
+			mProperties.mBounds.transformAffine(mProperties.mPositionQuantization.getDecodeMatrix());
+
 		// TODO - Sync this to sim-thread possibly?
 	}
 
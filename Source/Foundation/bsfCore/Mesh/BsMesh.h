@@ -39,6 +39,18 @@ namespace bs
 		 */
 		Vector<SubMesh> subMeshes;
 
+		/**
+		 * Optional additional levels of detail, in order from most to least detailed. Sub-meshes of each level reference
+		 * the same vertex and index buffers as @p subMeshes.
+		 */
+		Vector<MeshLOD> lods;
+
+		/**
+		 * Transform used for decoding vertex positions into mesh local space, if positions in @p vertexDesc use a
+		 * quantized format. See MeshUtility::quantize().
+		 */
+		PositionQuantization positionQuantization;
+
 		/** Optimizes performance depending on planned usage of the mesh. */
 		INT32 usage = MU_STATIC;
 
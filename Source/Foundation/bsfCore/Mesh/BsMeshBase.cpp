@@ -24,6 +24,11 @@ namespace bs
 		mSubMeshes = subMeshes;
 	}
 
+	MeshProperties::MeshProperties(UINT32 numVertices, UINT32 numIndices, const Vector<SubMesh>& subMeshes,
+		const Vector<MeshLOD>& lods)
+		:mSubMeshes(subMeshes), mLODs(lods), mNumVertices(numVertices), mNumIndices(numIndices)
+	{ }
+
 	const SubMesh& MeshProperties::getSubMesh(UINT32 subMeshIdx) const
 	{
 		if (subMeshIdx >= mSubMeshes.size())
@@ -40,6 +45,43 @@ namespace bs
 		return (UINT32)mSubMeshes.size();
 	}
 
+	const SubMesh& MeshProperties::getSubMesh(UINT32 subMeshIdx, UINT32 lod) const
+	{
+		if (lod == 0 || mLODs.empty())
+			return getSubMesh(subMeshIdx);
+
+		const MeshLOD& meshLOD = mLODs[std::min(lod, (UINT32)mLODs.size()) - 1];
+		if (subMeshIdx >= meshLOD.subMeshes.size())
+		{
+			BS_EXCEPT(InvalidParametersException, "Invalid sub-mesh index ("
+				+ toString(subMeshIdx) + "). Number of sub-meshes available: " + toString((int)meshLOD.subMeshes.size()));
+		}
+
+		return meshLOD.subMeshes[subMeshIdx];
+	}
+
+	float MeshProperties::getLODScreenSize(UINT32 lod) const
+	{
+		if (lod == 0 || mLODs.empty())
+			return std::numeric_limits<float>::infinity();
+
+		return mLODs[std::min(lod, (UINT32)mLODs.size()) - 1].screenSize;
+	}
+
+	UINT32 MeshProperties::selectLOD(float screenSize) const
+	{
+		UINT32 lod = 0;
+		for (UINT32 i = 0; i < (UINT32)mLODs.size(); i++)
+		{
+			if (screenSize >= mLODs[i].screenSize)
+				break;
+
+			lod = i + 1;
+		}
+
+		return lod;
+	}
+
 	MeshBase::MeshBase(UINT32 numVertices, UINT32 numIndices, DrawOperationType drawOp)
 		:mProperties(numVertices, numIndices, drawOp)
 	{ }
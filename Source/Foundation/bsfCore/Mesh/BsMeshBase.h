@@ -38,6 +38,8 @@ namespace bs
 		MeshProperties();
 		MeshProperties(UINT32 numVertices, UINT32 numIndices, DrawOperationType drawOp);
 		MeshProperties(UINT32 numVertices, UINT32 numIndices, const Vector<SubMesh>& subMeshes);
+		MeshProperties(UINT32 numVertices, UINT32 numIndices, const Vector<SubMesh>& subMeshes,
+			const Vector<MeshLOD>& lods);
 
 		/**
 		 * Retrieves a sub-mesh containing data used for rendering a certain portion of this mesh. If no sub-meshes are
@@ -48,6 +50,33 @@ namespace bs
 		/** Retrieves a total number of sub-meshes in this mesh. */
 		UINT32 getNumSubMeshes() const;
 
+		/**
+		 * Retrieves a sub-mesh used for rendering a certain portion of this mesh at the specified level of detail.
+		 *
+		 * @param[in]	subMeshIdx	Index of the sub-mesh to retrieve.
+		 * @param[in]	lod			Level of detail to retrieve the sub-mesh for. 0 is the most detailed level. If the
+		 *							mesh doesn't have as many levels, the least detailed available level is used.
+		 */
+		const SubMesh& getSubMesh(UINT32 subMeshIdx, UINT32 lod) const;
+
+		/** Returns the number of levels of detail in this mesh, including the base level. Always at least 1. */
+		UINT32 getNumLODs() const { return (UINT32)mLODs.size() + 1; }
+
+		/**
+		 * Returns the size on screen below which the specified level of detail should be used. See MeshLOD::screenSize.
+		 * Level 0 is used for all sizes larger than the size of level 1.
+		 */
+		float getLODScreenSize(UINT32 lod) const;
+
+		/**
+		 * Determines which level of detail to render the mesh with.
+		 *
+		 * @param[in]	screenSize	Projected diameter of the mesh bounding sphere, relative to the viewport height.
+		 * @return					Least detailed level whose screen size is larger than @p screenSize, or 0 if no
+		 *							such level exists.
+		 */
+		UINT32 selectLOD(float screenSize) const;
+
 		/**	Returns maximum number of vertices the mesh may store. */
 		UINT32 getNumVertices() const { return mNumVertices; }
 
@@ -57,6 +86,12 @@ namespace bs
 		/**	Returns bounds of the geometry contained in the vertex buffers for all sub-meshes. */
 		const Bounds& getBounds() const { return mBounds; }
 
+		/**
+		 * Returns the transform required for decoding vertex positions into mesh local space, if the positions are stored
+		 * in a quantized format.
+		 */
+		const PositionQuantization& getPositionQuantization() const { return mPositionQuantization; }
+
 	protected:
 		friend class MeshBase;
 		friend class ct::MeshBase;
@@ -67,9 +102,11 @@ namespace bs
 		friend class MeshBaseRTTI;
 
 		Vector<SubMesh> mSubMeshes;
+		Vector<MeshLOD> mLODs;
 		UINT32 mNumVertices;
 		UINT32 mNumIndices;
 		Bounds mBounds;
+		PositionQuantization mPositionQuantization;
 	};
 
 	/** @} */
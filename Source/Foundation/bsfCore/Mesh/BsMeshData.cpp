@@ -359,22 +359,39 @@ namespace bs
 		{
 			const VertexElement& curElement = vertexDesc->getElement(i);
 
-			if (curElement.getSemantic() != VES_POSITION || (curElement.getType() != VET_FLOAT3 && curElement.getType() != VET_FLOAT4))
+			if (curElement.getSemantic() != VES_POSITION)
+				continue;
+
+			VertexElementType type = curElement.getType();
+			if (type != VET_FLOAT3 && type != VET_FLOAT4 && type != VET_USHORT4_NORM)
 				continue;
 
 			UINT8* data = getElementData(curElement.getSemantic(), curElement.getSemanticIdx(), curElement.getStreamIdx());
 			UINT32 stride = vertexDesc->getVertexStride(curElement.getStreamIdx());
 
+			// Quantized positions are returned in normalized [0, 1] range, and need to be decoded by the caller
+			auto readPosition = [data, stride, type](UINT32 idx)
+			{
+				const UINT8* src = data + stride * idx;
+				if (type == VET_USHORT4_NORM)
+				{
+					const UINT16* quantized = (const UINT16*)src;
+					return Vector3(quantized[0], quantized[1], quantized[2]) / 65535.0f;
+				}
+
+				return *(const Vector3*)src;
+			};
+
 			if (getNumVertices() > 0)
 			{
-				Vector3 curPosition = *(Vector3*)data;
+				Vector3 curPosition = readPosition(0);
 				Vector3 accum = curPosition;
 				Vector3 min = curPosition;
 				Vector3 max = curPosition;
 
 				for (UINT32 i = 1; i < getNumVertices(); i++)
 				{
-					curPosition = *(Vector3*)(data + stride * i);
+					curPosition = readPosition(i);
 					accum += curPosition;
 					min = Vector3::min(min, curPosition);
 					max = Vector3::max(max, curPosition);
@@ -385,7 +402,7 @@ namespace bs
 
 				for (UINT32 i = 0; i < getNumVertices(); i++)
 				{
-					curPosition = *(Vector3*)(data + stride * i);
+					curPosition = readPosition(i);
 					float dist = center.squaredDistance(curPosition);
 
 					if (dist > radiusSqrd)
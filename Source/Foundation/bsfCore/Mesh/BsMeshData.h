@@ -226,7 +226,10 @@ namespace bs
 		/**	Return the size (in bytes) of the entire buffer. */
 		UINT32 getSize() const { return getInternalBufferSize(); }
 
-		/**	Calculates the bounds of all vertices stored in the internal buffer. */
+		/**
+		 * Calculates the bounds of all vertices stored in the internal buffer. If positions are stored in a quantized
+		 * format the bounds are returned in the quantized [0, 1] range.
+		 */
 		Bounds calculateBounds() const;
 
 		/**
@@ -5,6 +5,9 @@
 #include "Math/BsVector3.h"
 #include "Math/BsVector2.h"
 #include "Math/BsPlane.h"
+#include "Mesh/BsMeshData.h"
+#include "RenderAPI/BsVertexDataDesc.h"
+#include "Utility/BsBitwise.h"
 
 namespace bs
 {
@@ -724,6 +727,522 @@ namespace bs
 		bs_frame_clear();
 	}
 
+	/** Vertex data of a single vertex stream. */
+	struct VertexStreamData
+	{
+		UINT8* data;
+		UINT32 stride;
+	};
+
+	/** Reads the indices from the mesh data into a 32-bit index array, regardless of the mesh index type. */
+	static void readIndices(MeshData& meshData, Vector<UINT32>& output)
+	{
+		UINT32 numIndices = meshData.getNumIndices();
+		output.resize(numIndices);
+
+		if(meshData.getIndexType() == IT_16BIT)
+		{
+			UINT16* indices = meshData.getIndices16();
+			for(UINT32 i = 0; i < numIndices; i++)
+				output[i] = indices[i];
+		}
+		else
+			memcpy(output.data(), meshData.getIndices32(), numIndices * sizeof(UINT32));
+	}
+
+	/** Writes indices from a 32-bit index array into the mesh data, converting them to the mesh index type. */
+	static void writeIndices(const Vector<UINT32>& indices, MeshData& meshData)
+	{
+		UINT32 numIndices = std::min((UINT32)indices.size(), meshData.getNumIndices());
+
+		if(meshData.getIndexType() == IT_16BIT)
+		{
+			UINT16* output = meshData.getIndices16();
+			for(UINT32 i = 0; i < numIndices; i++)
+				output[i] = (UINT16)indices[i];
+		}
+		else
+			memcpy(meshData.getIndices32(), indices.data(), numIndices * sizeof(UINT32));
+	}
+
+	/** Symmetric matrix used for calculating the sum of squared distances from a point to a set of planes. */
+	struct ErrorQuadric
+	{
+		/** Creates a quadric measuring the squared distance to the plane with normal @p n and distance @p d. */
+		static ErrorQuadric fromPlane(const Vector3& n, float d, float weight)
+		{
+			ErrorQuadric q;
+			q.a00 = n.x * n.x * weight;
+			q.a01 = n.x * n.y * weight;
+			q.a02 = n.x * n.z * weight;
+			q.a11 = n.y * n.y * weight;
+			q.a12 = n.y * n.z * weight;
+			q.a22 = n.z * n.z * weight;
+			q.b0 = n.x * d * weight;
+			q.b1 = n.y * d * weight;
+			q.b2 = n.z * d * weight;
+			q.c = d * d * weight;
+
+			return q;
+		}
+
+		/** Returns the error of moving the vertex represented by this quadric to the provided position. */
+		float evaluate(const Vector3& p) const
+		{
+			float rx = a00 * p.x + a01 * p.y + a02 * p.z;
+			float ry = a01 * p.x + a11 * p.y + a12 * p.z;
+			float rz = a02 * p.x + a12 * p.y + a22 * p.z;
+
+			float error = p.x * rx + p.y * ry + p.z * rz + 2.0f * (b0 * p.x + b1 * p.y + b2 * p.z) + c;
+			return std::abs(error);
+		}
+
+		ErrorQuadric& operator+= (const ErrorQuadric& rhs)
+		{
+			a00 += rhs.a00; a01 += rhs.a01; a02 += rhs.a02;
+			a11 += rhs.a11; a12 += rhs.a12; a22 += rhs.a22;
+			b0 += rhs.b0; b1 += rhs.b1; b2 += rhs.b2;
+			c += rhs.c;
+
+			return *this;
+		}
+
+		float a00 = 0.0f, a01 = 0.0f, a02 = 0.0f, a11 = 0.0f, a12 = 0.0f, a22 = 0.0f;
+		float b0 = 0.0f, b1 = 0.0f, b2 = 0.0f;
+		float c = 0.0f;
+	};
+
+	/** Determines how is a vertex allowed to move during mesh simplification. */
+	enum class SimplifyVertexKind : UINT8
+	{
+		Manifold, /**< Vertex can be collapsed onto any neighbor. */
+		Border, /**< Vertex on an open border, can only be collapsed onto a neighbor along the border. */
+		Locked /**< Vertex cannot be collapsed. */
+	};
+
+	/**
+	 * Finds vertices with identical data in all streams and generates a remap table that maps each vertex to its unique
+	 * counterpart. Unique vertices are numbered in the order they first appear. Returns the number of unique vertices.
+	 */
+	static UINT32 weldVertices(const Vector<VertexStreamData>& streams, UINT32 numVertices, Vector<UINT32>& remap)
+	{
+		auto hashVertex = [&streams](UINT32 vertexIdx)
+		{
+			// FNV-1a
+			UINT64 hash = 14695981039346656037ULL;
+			for(auto& stream : streams)
+			{
+				const UINT8* data = stream.data + vertexIdx * stream.stride;
+				for(UINT32 i = 0; i < stream.stride; i++)
+				{
+					hash ^= data[i];
+					hash *= 1099511628211ULL;
+				}
+			}
+
+			return hash;
+		};
+
+		auto isEqual = [&streams](UINT32 a, UINT32 b)
+		{
+			for(auto& stream : streams)
+			{
+				if(memcmp(stream.data + a * stream.stride, stream.data + b * stream.stride, stream.stride) != 0)
+					return false;
+			}
+
+			return true;
+		};
+
+		// Open addressing hash table containing the first occurrence of each unique vertex
+		UINT32 tableSize = Bitwise::nextPow2(std::max(numVertices * 2, 2U));
+		UINT32 tableMask = tableSize - 1;
+		Vector<UINT32> table(tableSize, (UINT32)-1);
+
+		UINT32 numUnique = 0;
+		for(UINT32 i = 0; i < numVertices; i++)
+		{
+			UINT32 slot = (UINT32)(hashVertex(i) & tableMask);
+			while(true)
+			{
+				UINT32 entry = table[slot];
+				if(entry == (UINT32)-1)
+				{
+					table[slot] = i;
+					remap[i] = numUnique++;
+					break;
+				}
+
+				if(isEqual(entry, i))
+				{
+					remap[i] = remap[entry];
+					break;
+				}
+
+				slot = (slot + 1) & tableMask;
+			}
+		}
+
+		return numUnique;
+	}
+
+	/**
+	 * Simulates a FIFO post-transform vertex cache over a list of triangles and returns the number of cache misses.
+	 * Timestamps are used to determine cache residency, and are updated so the simulation can be continued over
+	 * multiple calls.
+	 */
+	static UINT32 simulateVertexCache(const UINT32* indices, UINT32 numIndices, UINT32 cacheSize,
+		Vector<UINT32>& cacheTimestamps, UINT32& timestamp)
+	{
+		UINT32 numMisses = 0;
+		for(UINT32 i = 0; i < numIndices; i++)
+		{
+			UINT32 vertexIdx = indices[i];
+			if((timestamp - cacheTimestamps[vertexIdx]) > cacheSize)
+			{
+				cacheTimestamps[vertexIdx] = timestamp++;
+				numMisses++;
+			}
+		}
+
+		return numMisses;
+	}
+
+	/**
+	 * Reorders triangles for better post-transform vertex cache utilization.
+	 *
+	 * Implementation from: https://tomforsyth1000.github.io/papers/fast_vert_cache_opt.html
+	 */
+	static void optimizeVertexCache(UINT32* indices, UINT32 numIndices, UINT32 numVertices)
+	{
+		static constexpr UINT32 CACHE_SIZE = 32;
+		static constexpr float CACHE_DECAY_POWER = 1.5f;
+		static constexpr float LAST_TRI_SCORE = 0.75f;
+		static constexpr float VALENCE_BOOST_SCALE = 2.0f;
+		static constexpr float VALENCE_BOOST_POWER = 0.5f;
+
+		struct VertexData
+		{
+			float score = 0.0f;
+			INT32 cachePos = -1;
+			UINT32 numActiveTris = 0;
+			UINT32 trisOffset = 0;
+		};
+
+		UINT32 numTris = numIndices / 3;
+		if(numTris < 2)
+			return;
+
+		auto calcScore = [](const VertexData& vertex)
+		{
+			if(vertex.numActiveTris == 0)
+				return -1.0f;
+
+			float score = 0.0f;
+			if(vertex.cachePos >= 0)
+			{
+				// Vertices used by the last triangle get a fixed score, so the triangle doesn't get chosen again
+				if(vertex.cachePos < 3)
+					score = LAST_TRI_SCORE;
+				else
+				{
+					const float scaler = 1.0f / (CACHE_SIZE - 3);
+					score = 1.0f - (vertex.cachePos - 3) * scaler;
+					score = std::pow(score, CACHE_DECAY_POWER);
+				}
+			}
+
+			// Boost vertices with few remaining triangles, so lone triangles don't get left behind
+			score += VALENCE_BOOST_SCALE * std::pow((float)vertex.numActiveTris, -VALENCE_BOOST_POWER);
+			return score;
+		};
+
+		// Build vertex to triangle adjacency
+		Vector<VertexData> vertices(numVertices);
+		for(UINT32 i = 0; i < numIndices; i++)
+			vertices[indices[i]].numActiveTris++;
+
+		UINT32 offset = 0;
+		for(auto& vertex : vertices)
+		{
+			vertex.trisOffset = offset;
+			offset += vertex.numActiveTris;
+		}
+
+		Vector<UINT32> vertexTris(numIndices);
+		Vector<UINT32> vertexTriCount(numVertices, 0);
+		for(UINT32 i = 0; i < numIndices; i++)
+		{
+			UINT32 vertexIdx = indices[i];
+			vertexTris[vertices[vertexIdx].trisOffset + vertexTriCount[vertexIdx]++] = i / 3;
+		}
+
+		for(auto& vertex : vertices)
+			vertex.score = calcScore(vertex);
+
+		Vector<float> triScores(numTris);
+		Vector<bool> triAdded(numTris, false);
+
+		UINT32 bestTri = 0;
+		for(UINT32 i = 0; i < numTris; i++)
+		{
+			const UINT32* tri = &indices[i * 3];
+			triScores[i] = vertices[tri[0]].score + vertices[tri[1]].score + vertices[tri[2]].score;
+
+			if(triScores[i] > triScores[bestTri])
+				bestTri = i;
+		}
+
+		Vector<UINT32> output(numIndices);
+		UINT32 cache[CACHE_SIZE + 3];
+		UINT32 newCache[CACHE_SIZE + 3];
+		UINT32 cacheCount = 0;
+		UINT32 scanPos = 0;
+
+		for(UINT32 i = 0; i < numTris; i++)
+		{
+			// No candidate in the cache, pick the next unprocessed triangle in order
+			if(bestTri == (UINT32)-1)
+			{
+				while(triAdded[scanPos])
+					scanPos++;
+
+				bestTri = scanPos;
+			}
+
+			const UINT32* tri = &indices[bestTri * 3];
+			triAdded[bestTri] = true;
+			memcpy(&output[i * 3], tri, sizeof(UINT32) * 3);
+
+			// Remove the triangle from the active lists of its vertices
+			for(UINT32 j = 0; j < 3; j++)
+			{
+				VertexData& vertex = vertices[tri[j]];
+				UINT32* activeTris = &vertexTris[vertex.trisOffset];
+
+				for(UINT32 k = 0; k < vertex.numActiveTris; k++)
+				{
+					if(activeTris[k] == bestTri)
+					{
+						std::swap(activeTris[k], activeTris[vertex.numActiveTris - 1]);
+						vertex.numActiveTris--;
+						break;
+					}
+				}
+			}
+
+			// Move the triangle's vertices to the front of the cache
+			UINT32 newCacheCount = 0;
+			for(UINT32 j = 0; j < 3; j++)
+			{
+				if(std::find(newCache, newCache + newCacheCount, tri[j]) == newCache + newCacheCount)
+					newCache[newCacheCount++] = tri[j];
+			}
+
+			for(UINT32 j = 0; j < cacheCount; j++)
+			{
+				if(cache[j] != tri[0] && cache[j] != tri[1] && cache[j] != tri[2])
+					newCache[newCacheCount++] = cache[j];
+			}
+
+			// Update scores of all vertices that are in the cache, or just got pushed out of it
+			for(UINT32 j = 0; j < newCacheCount; j++)
+			{
+				VertexData& vertex = vertices[newCache[j]];
+				vertex.cachePos = j < CACHE_SIZE ? (INT32)j : -1;
+				vertex.score = calcScore(vertex);
+			}
+
+			bestTri = (UINT32)-1;
+			float bestScore = -1.0f;
+			for(UINT32 j = 0; j < newCacheCount; j++)
+			{
+				const VertexData& vertex = vertices[newCache[j]];
+				const UINT32* activeTris = &vertexTris[vertex.trisOffset];
+
+				for(UINT32 k = 0; k < vertex.numActiveTris; k++)
+				{
+					UINT32 triIdx = activeTris[k];
+					const UINT32* triIndices = &indices[triIdx * 3];
+
+					float score = vertices[triIndices[0]].score + vertices[triIndices[1]].score +
+						vertices[triIndices[2]].score;
+					triScores[triIdx] = score;
+
+					if(score > bestScore)
+					{
+						bestScore = score;
+						bestTri = triIdx;
+					}
+				}
+			}
+
+			cacheCount = std::min(newCacheCount, CACHE_SIZE);
+			memcpy(cache, newCache, cacheCount * sizeof(UINT32));
+		}
+
+		memcpy(indices, output.data(), numIndices * sizeof(UINT32));
+	}
+
+	/**
+	 * Splits the triangles into clusters and sorts the clusters so that those facing outwards from the mesh center get
+	 * rendered first, reducing overdraw. The triangles are expected to be already optimized for the vertex cache.
+	 * Clusters are split at points where the vertex cache efficiency is not affected more than @p threshold.
+	 *
+	 * Implementation based on: Sander, Nehab, Barczak - Fast Triangle Reordering for Vertex Locality and Reduced
+	 * Overdraw (2007).
+	 */
+	static void optimizeOverdraw(UINT32* indices, UINT32 numIndices, const Vector<Vector3>& positions, float threshold)
+	{
+		static constexpr UINT32 CACHE_SIZE = 16;
+		static constexpr UINT32 MIN_CLUSTER_SIZE = 8;
+
+		UINT32 numTris = numIndices / 3;
+		if(numTris < MIN_CLUSTER_SIZE * 2)
+			return;
+
+		UINT32 numVertices = (UINT32)positions.size();
+		Vector<UINT32> cacheTimestamps(numVertices, 0);
+		UINT32 timestamp = CACHE_SIZE + 1;
+
+		UINT32 originalMisses = simulateVertexCache(indices, numIndices, CACHE_SIZE, cacheTimestamps, timestamp);
+
+		// Hard boundaries, where the cache optimizer had to start over (all vertices of a triangle miss the cache)
+		Vector<UINT32> hardClusters;
+		timestamp += CACHE_SIZE + 1;
+		for(UINT32 i = 0; i < numTris; i++)
+		{
+			UINT32 misses = simulateVertexCache(&indices[i * 3], 3, CACHE_SIZE, cacheTimestamps, timestamp);
+			if(i == 0 || misses == 3)
+				hardClusters.push_back(i);
+		}
+
+		hardClusters.push_back(numTris);
+
+		// Soft boundaries, split hard clusters further as long as the cache efficiency stays within the threshold
+		Vector<UINT32> clusters;
+		for(UINT32 i = 0; i < (UINT32)hardClusters.size() - 1; i++)
+		{
+			UINT32 start = hardClusters[i];
+			UINT32 end = hardClusters[i + 1];
+
+			timestamp += CACHE_SIZE + 1;
+			UINT32 clusterMisses = simulateVertexCache(&indices[start * 3], (end - start) * 3, CACHE_SIZE,
+				cacheTimestamps, timestamp);
+			float targetAcmr = (clusterMisses / (float)(end - start)) * threshold;
+
+			clusters.push_back(start);
+
+			timestamp += CACHE_SIZE + 1;
+			UINT32 misses = 0;
+			UINT32 subStart = start;
+			for(UINT32 j = start; j < end; j++)
+			{
+				misses += simulateVertexCache(&indices[j * 3], 3, CACHE_SIZE, cacheTimestamps, timestamp);
+
+				UINT32 subCount = j - subStart + 1;
+				if(subCount >= MIN_CLUSTER_SIZE && (end - j - 1) >= MIN_CLUSTER_SIZE &&
+					(misses / (float)subCount) <= targetAcmr)
+				{
+					clusters.push_back(j + 1);
+					subStart = j + 1;
+					misses = 0;
+					timestamp += CACHE_SIZE + 1;
+				}
+			}
+		}
+
+		UINT32 numClusters = (UINT32)clusters.size();
+		clusters.push_back(numTris);
+
+		if(numClusters < 2)
+			return;
+
+		// Calculate area weighted centroid and normal of each cluster
+		Vector<Vector3> clusterCentroids(numClusters, Vector3::ZERO);
+		Vector<Vector3> clusterNormals(numClusters, Vector3::ZERO);
+		Vector3 meshCentroid = Vector3::ZERO;
+		float meshArea = 0.0f;
+
+		for(UINT32 i = 0; i < numClusters; i++)
+		{
+			float clusterArea = 0.0f;
+			for(UINT32 j = clusters[i]; j < clusters[i + 1]; j++)
+			{
+				const Vector3& p0 = positions[indices[j * 3 + 0]];
+				const Vector3& p1 = positions[indices[j * 3 + 1]];
+				const Vector3& p2 = positions[indices[j * 3 + 2]];
+
+				Vector3 normal = (p1 - p0).cross(p2 - p0);
+				float area = normal.length();
+
+				clusterCentroids[i] += (p0 + p1 + p2) * (area / 3.0f);
+				clusterNormals[i] += normal;
+				clusterArea += area;
+			}
+
+			meshCentroid += clusterCentroids[i];
+			meshArea += clusterArea;
+
+			if(clusterArea > 0.0f)
+				clusterCentroids[i] /= clusterArea;
+
+			clusterNormals[i] = Vector3::normalize(clusterNormals[i]);
+		}
+
+		if(meshArea > 0.0f)
+			meshCentroid /= meshArea;
+
+		Vector<std::pair<float, UINT32>> sortKeys(numClusters);
+		for(UINT32 i = 0; i < numClusters; i++)
+			sortKeys[i] = std::make_pair(-(clusterCentroids[i] - meshCentroid).dot(clusterNormals[i]), i);
+
+		std::stable_sort(sortKeys.begin(), sortKeys.end(),
+			[](const std::pair<float, UINT32>& a, const std::pair<float, UINT32>& b) { return a.first < b.first; });
+
+		Vector<UINT32> output;
+		output.reserve(numIndices);
+		for(auto& entry : sortKeys)
+		{
+			UINT32 clusterIdx = entry.second;
+			output.insert(output.end(), &indices[clusters[clusterIdx] * 3], &indices[clusters[clusterIdx + 1] * 3]);
+		}
+
+		// Make sure the vertex cache efficiency wasn't affected too much by splits at the cluster boundaries
+		timestamp += CACHE_SIZE + 1;
+		UINT32 newMisses = simulateVertexCache(output.data(), numIndices, CACHE_SIZE, cacheTimestamps, timestamp);
+		if(newMisses > originalMisses * threshold)
+			return;
+
+		memcpy(indices, output.data(), numIndices * sizeof(UINT32));
+	}
+
+	/**
+	 * Encodes a vector with components in [-1, 1] range into 10:10:10:2 normalized format. The 2-bit component is
+	 * provided directly.
+	 */
+	static UINT32 packNormal1010102(const Vector3& value, UINT32 w)
+	{
+		auto encode = [](float v)
+		{
+			return (UINT32)Math::clamp(Math::roundToInt(v * 511.5f + 511.5f), 0, 1023);
+		};
+
+		return encode(value.x) | (encode(value.y) << 10) | (encode(value.z) << 20) | ((w & 0x3) << 30);
+	}
+
+	/** Decodes a vector from 10:10:10:2 normalized format into [-1, 1] range. */
+	static Vector4 unpackNormal1010102(UINT32 packed)
+	{
+		const float inv = 2.0f / 1023.0f;
+
+		return Vector4(
+			(packed & 0x3FF) * inv - 1.0f,
+			((packed >> 10) & 0x3FF) * inv - 1.0f,
+			((packed >> 20) & 0x3FF) * inv - 1.0f,
+			((packed >> 30) & 0x3) * (2.0f / 3.0f) - 1.0f);
+	}
+
 	void MeshUtility::calculateNormals(Vector3* vertices, UINT8* indices, UINT32 numVertices,
 		UINT32 numIndices, Vector3* normals, UINT32 indexSize)
 	{
@@ -935,4 +1454,951 @@ namespace bs
 			ptr += stride;
 		}
 	}
+
+	SPtr<MeshData> MeshUtility::optimize(const SPtr<MeshData>& meshData, Vector<SubMesh>& subMeshes,
+		MeshOptimizationFlags flags, Vector<UINT32>* vertexRemap)
+	{
+		static constexpr float OVERDRAW_THRESHOLD = 1.05f;
+
+		const SPtr<VertexDataDesc>& vertexDesc = meshData->getVertexDesc();
+		UINT32 numVertices = meshData->getNumVertices();
+		UINT32 numIndices = meshData->getNumIndices();
+		IndexType indexType = meshData->getIndexType();
+
+		Vector<UINT32> indices;
+		readIndices(*meshData, indices);
+
+		UINT32 numStreams = 0;
+		for(UINT32 i = 0; i < vertexDesc->getNumElements(); i++)
+			numStreams = std::max(numStreams, (UINT32)vertexDesc->getElement(i).getStreamIdx() + 1);
+
+		Vector<VertexStreamData> streams;
+		Vector<UINT32> streamIndices;
+		for(UINT32 i = 0; i < numStreams; i++)
+		{
+			UINT32 stride = vertexDesc->getVertexStride(i);
+			if(stride == 0)
+				continue;
+
+			streams.push_back({ meshData->getStreamData(i), stride });
+			streamIndices.push_back(i);
+		}
+
+		// Maps original vertices to vertices in the output, and output vertices to a source vertex to copy data from
+		Vector<UINT32> remap(numVertices);
+		Vector<UINT32> sourceVertices(numVertices);
+		for(UINT32 i = 0; i < numVertices; i++)
+		{
+			remap[i] = i;
+			sourceVertices[i] = i;
+		}
+
+		UINT32 numOutputVertices = numVertices;
+		if(flags.isSet(MeshOptimizationFlag::WeldVertices))
+		{
+			numOutputVertices = weldVertices(streams, numVertices, remap);
+
+			sourceVertices.resize(numOutputVertices);
+			for(UINT32 i = numVertices; i > 0; i--)
+				sourceVertices[remap[i - 1]] = i - 1;
+
+			for(auto& index : indices)
+				index = remap[index];
+		}
+
+		// Positions are only required by some operations
+		Vector<Vector3> positions;
+		const VertexElement* positionElement = vertexDesc->getElement(VES_POSITION);
+		bool hasPositions = positionElement != nullptr &&
+			(positionElement->getType() == VET_FLOAT3 || positionElement->getType() == VET_FLOAT4);
+
+		if(hasPositions && flags.isSetAny(MeshOptimizationFlag::RemoveDegenerates | MeshOptimizationFlag::Overdraw))
+		{
+			UINT8* positionData = meshData->getElementData(VES_POSITION, 0, positionElement->getStreamIdx());
+			UINT32 positionStride = vertexDesc->getVertexStride(positionElement->getStreamIdx());
+
+			positions.resize(numOutputVertices);
+			for(UINT32 i = 0; i < numOutputVertices; i++)
+				memcpy(&positions[i], positionData + sourceVertices[i] * positionStride, sizeof(Vector3));
+		}
+
+		// Process triangles within each sub-mesh
+		Vector<SubMesh> ranges = subMeshes;
+		if(ranges.empty())
+			ranges.push_back(SubMesh(0, numIndices, DOT_TRIANGLE_LIST));
+
+		Vector<UINT32> outputIndices;
+		outputIndices.reserve(numIndices);
+
+		for(auto& range : ranges)
+		{
+			UINT32 start = (UINT32)outputIndices.size();
+			const UINT32* srcIndices = indices.data() + range.indexOffset;
+
+			if(range.drawOp != DOT_TRIANGLE_LIST)
+			{
+				outputIndices.insert(outputIndices.end(), srcIndices, srcIndices + range.indexCount);
+				range.indexOffset = start;
+				continue;
+			}
+
+			UINT32 numTris = range.indexCount / 3;
+			for(UINT32 i = 0; i < numTris; i++)
+			{
+				const UINT32* tri = &srcIndices[i * 3];
+				if(flags.isSet(MeshOptimizationFlag::RemoveDegenerates))
+				{
+					if(tri[0] == tri[1] || tri[1] == tri[2] || tri[0] == tri[2])
+						continue;
+
+					if(!positions.empty())
+					{
+						const Vector3& p0 = positions[tri[0]];
+						const Vector3& p1 = positions[tri[1]];
+						const Vector3& p2 = positions[tri[2]];
+
+						if(p0 == p1 || p1 == p2 || p0 == p2)
+							continue;
+					}
+				}
+
+				outputIndices.insert(outputIndices.end(), tri, tri + 3);
+			}
+
+			UINT32 count = (UINT32)outputIndices.size() - start;
+			if(flags.isSet(MeshOptimizationFlag::VertexCache))
+				optimizeVertexCache(&outputIndices[start], count, numOutputVertices);
+
+			if(flags.isSet(MeshOptimizationFlag::Overdraw) && !positions.empty())
+				optimizeOverdraw(&outputIndices[start], count, positions, OVERDRAW_THRESHOLD);
+
+			range.indexOffset = start;
+			range.indexCount = count;
+		}
+
+		if(flags.isSet(MeshOptimizationFlag::VertexFetch))
+		{
+			Vector<UINT32> fetchRemap(numOutputVertices, (UINT32)-1);
+			UINT32 numFetchedVertices = 0;
+			for(auto& index : outputIndices)
+			{
+				if(fetchRemap[index] == (UINT32)-1)
+					fetchRemap[index] = numFetchedVertices++;
+
+				index = fetchRemap[index];
+			}
+
+			for(auto& entry : remap)
+				entry = fetchRemap[entry];
+
+			numOutputVertices = numFetchedVertices;
+		}
+
+		// Generate the output mesh data
+		UINT32 numOutputIndices = (UINT32)outputIndices.size();
+		SPtr<MeshData> output = MeshData::create(numOutputVertices, numOutputIndices, vertexDesc, indexType);
+
+		for(UINT32 i = 0; i < (UINT32)streams.size(); i++)
+		{
+			const VertexStreamData& src = streams[i];
+			UINT8* dst = output->getStreamData(streamIndices[i]);
+
+			for(UINT32 j = 0; j < numVertices; j++)
+			{
+				if(remap[j] != (UINT32)-1)
+					memcpy(dst + remap[j] * src.stride, src.data + j * src.stride, src.stride);
+			}
+		}
+
+		writeIndices(outputIndices, *output);
+
+		if(!subMeshes.empty())
+			subMeshes = ranges;
+
+		if(vertexRemap != nullptr)
+			*vertexRemap = remap;
+
+		return output;
+	}
+
+	MeshEfficiencyStats MeshUtility::calculateEfficiency(const SPtr<MeshData>& meshData, UINT32 cacheSize)
+	{
+		static constexpr UINT32 CACHE_LINE_SIZE = 64;
+		static constexpr UINT32 NUM_CACHE_LINES = 64;
+
+		UINT32 numVertices = meshData->getNumVertices();
+		UINT32 numIndices = meshData->getNumIndices();
+
+		Vector<UINT32> indices;
+		readIndices(*meshData, indices);
+
+		MeshEfficiencyStats stats;
+		if(numIndices == 0 || numVertices == 0)
+			return stats;
+
+		// Post-transform vertex cache
+		Vector<UINT32> cacheTimestamps(numVertices, 0);
+		UINT32 timestamp = cacheSize + 1;
+		UINT32 numMisses = simulateVertexCache(indices.data(), numIndices, cacheSize, cacheTimestamps, timestamp);
+
+		UINT32 numReferenced = 0;
+		for(auto& entry : cacheTimestamps)
+		{
+			if(entry != 0)
+				numReferenced++;
+		}
+
+		stats.acmr = numMisses / (float)(numIndices / 3);
+		stats.atvr = numMisses / (float)numReferenced;
+
+		// Vertex fetch, simulated as a FIFO cache of memory lines, separately for each vertex stream
+		const SPtr<VertexDataDesc>& vertexDesc = meshData->getVertexDesc();
+
+		UINT32 numStreams = 0;
+		for(UINT32 i = 0; i < vertexDesc->getNumElements(); i++)
+			numStreams = std::max(numStreams, (UINT32)vertexDesc->getElement(i).getStreamIdx() + 1);
+
+		UINT64 fetchedBytes = 0;
+		UINT64 totalBytes = 0;
+		for(UINT32 i = 0; i < numStreams; i++)
+		{
+			UINT32 stride = vertexDesc->getVertexStride(i);
+			if(stride == 0)
+				continue;
+
+			UINT32 numLines = Math::divideAndRoundUp(numVertices * stride, CACHE_LINE_SIZE);
+			Vector<UINT32> lineTimestamps(numLines, 0);
+			UINT32 lineTimestamp = NUM_CACHE_LINES + 1;
+
+			for(auto& index : indices)
+			{
+				UINT32 firstLine = (index * stride) / CACHE_LINE_SIZE;
+				UINT32 lastLine = (index * stride + stride - 1) / CACHE_LINE_SIZE;
+
+				for(UINT32 line = firstLine; line <= lastLine; line++)
+				{
+					if((lineTimestamp - lineTimestamps[line]) > NUM_CACHE_LINES)
+					{
+						lineTimestamps[line] = lineTimestamp++;
+						fetchedBytes += CACHE_LINE_SIZE;
+					}
+				}
+			}
+
+			totalBytes += numVertices * stride;
+		}
+
+		if(totalBytes > 0)
+			stats.fetchRatio = fetchedBytes / (float)totalBytes;
+
+		return stats;
+	}
+
+	void MeshUtility::simplify(const SPtr<MeshData>& meshData, const Vector<UINT32>& indices, UINT32 targetNumTriangles,
+		Vector<UINT32>& output)
+	{
+		static constexpr float BORDER_WEIGHT = 10.0f;
+
+		output = indices;
+
+		const SPtr<VertexDataDesc>& vertexDesc = meshData->getVertexDesc();
+		const VertexElement* positionElement = vertexDesc->getElement(VES_POSITION);
+		if(positionElement == nullptr ||
+			(positionElement->getType() != VET_FLOAT3 && positionElement->getType() != VET_FLOAT4))
+		{
+			BS_LOG(Warning, Mesh, "Unable to simplify mesh, it doesn't contain 32-bit float positions.");
+			return;
+		}
+
+		UINT32 numVertices = meshData->getNumVertices();
+		UINT8* positionData = meshData->getElementData(VES_POSITION, 0, positionElement->getStreamIdx());
+		UINT32 positionStride = vertexDesc->getVertexStride(positionElement->getStreamIdx());
+
+		Vector<Vector3> positions(numVertices);
+		for(UINT32 i = 0; i < numVertices; i++)
+			memcpy(&positions[i], positionData + i * positionStride, sizeof(Vector3));
+
+		// Vertices sharing a position (e.g. on UV or normal seams) are welded together when deciding which collapses to
+		// perform, so seams don't prevent the mesh from simplifying. Each group of welded vertices is represented by one
+		// of its vertices, and its vertices are linked in a circular list.
+		Vector<UINT32> sortedVertices(numVertices);
+		for(UINT32 i = 0; i < numVertices; i++)
+			sortedVertices[i] = i;
+
+		std::sort(sortedVertices.begin(), sortedVertices.end(), [&positions](UINT32 a, UINT32 b)
+		{
+			const Vector3& pa = positions[a];
+			const Vector3& pb = positions[b];
+
+			if(pa.x != pb.x) return pa.x < pb.x;
+			if(pa.y != pb.y) return pa.y < pb.y;
+			return pa.z < pb.z;
+		});
+
+		Vector<UINT32> weldRep(numVertices);
+		Vector<UINT32> weldNext(numVertices);
+		for(UINT32 i = 0; i < numVertices;)
+		{
+			UINT32 groupEnd = i + 1;
+			while(groupEnd < numVertices && positions[sortedVertices[groupEnd]] == positions[sortedVertices[i]])
+				groupEnd++;
+
+			for(UINT32 j = i; j < groupEnd; j++)
+			{
+				weldRep[sortedVertices[j]] = sortedVertices[i];
+				weldNext[sortedVertices[j]] = sortedVertices[j + 1 < groupEnd ? j + 1 : i];
+			}
+
+			i = groupEnd;
+		}
+
+		// Edges and vertex classification below operate on the welded vertices
+		auto edgeKey = [](UINT32 a, UINT32 b) { return ((UINT64)a << 32) | b; };
+
+		UnorderedMap<UINT64, UINT32> edges;
+		auto findEdges = [&edges, &edgeKey, &weldRep](const Vector<UINT32>& triIndices)
+		{
+			edges.clear();
+			for(UINT32 i = 0; i < (UINT32)triIndices.size(); i += 3)
+			{
+				for(UINT32 j = 0; j < 3; j++)
+					edges[edgeKey(weldRep[triIndices[i + j]], weldRep[triIndices[i + (j + 1) % 3]])]++;
+			}
+		};
+
+		auto isBorderEdge = [&edges, &edgeKey](UINT32 a, UINT32 b)
+		{
+			return edges.find(edgeKey(a, b)) == edges.end() || edges.find(edgeKey(b, a)) == edges.end();
+		};
+
+		// Classify vertices
+		Vector<SimplifyVertexKind> vertexKinds(numVertices, SimplifyVertexKind::Manifold);
+
+		findEdges(output);
+
+		Vector<UINT32> numBorderEdges(numVertices, 0);
+		for(auto& entry : edges)
+		{
+			UINT32 a = (UINT32)(entry.first >> 32);
+			UINT32 b = (UINT32)(entry.first & 0xFFFFFFFF);
+
+			// Non-manifold edge
+			if(entry.second > 1)
+			{
+				vertexKinds[a] = SimplifyVertexKind::Locked;
+				vertexKinds[b] = SimplifyVertexKind::Locked;
+			}
+
+			if(edges.find(edgeKey(b, a)) == edges.end())
+			{
+				numBorderEdges[a]++;
+				numBorderEdges[b]++;
+			}
+		}
+
+		for(UINT32 i = 0; i < numVertices; i++)
+		{
+			if(vertexKinds[i] == SimplifyVertexKind::Locked || numBorderEdges[i] == 0)
+				continue;
+
+			// Vertices where multiple borders meet cannot be moved without changing the border shape
+			vertexKinds[i] = numBorderEdges[i] == 2 ? SimplifyVertexKind::Border : SimplifyVertexKind::Locked;
+		}
+
+		// Calculate error quadrics from the triangle planes, and planes perpendicular to the border edges
+		Vector<ErrorQuadric> quadrics(numVertices);
+		for(UINT32 i = 0; i < (UINT32)output.size(); i += 3)
+		{
+			const UINT32 tri[3] = { weldRep[output[i + 0]], weldRep[output[i + 1]], weldRep[output[i + 2]] };
+			const Vector3& p0 = positions[tri[0]];
+
+			Vector3 normal = (positions[tri[1]] - p0).cross(positions[tri[2]] - p0);
+			float length = normal.length();
+			if(length == 0.0f)
+				continue;
+
+			normal /= length;
+
+			ErrorQuadric quadric = ErrorQuadric::fromPlane(normal, -normal.dot(p0), length * 0.5f);
+			for(UINT32 j = 0; j < 3; j++)
+				quadrics[tri[j]] += quadric;
+
+			for(UINT32 j = 0; j < 3; j++)
+			{
+				UINT32 a = tri[j];
+				UINT32 b = tri[(j + 1) % 3];
+
+				if(edges.find(edgeKey(b, a)) != edges.end())
+					continue;
+
+				Vector3 edge = positions[b] - positions[a];
+				float edgeLength = edge.length();
+				if(edgeLength == 0.0f)
+					continue;
+
+				Vector3 edgeNormal = Vector3::normalize(edge.cross(normal));
+				ErrorQuadric borderQuadric = ErrorQuadric::fromPlane(edgeNormal, -edgeNormal.dot(positions[a]),
+					edgeLength * edgeLength * BORDER_WEIGHT);
+
+				quadrics[a] += borderQuadric;
+				quadrics[b] += borderQuadric;
+			}
+		}
+
+		struct Collapse
+		{
+			UINT32 from;
+			UINT32 to;
+			float cost;
+		};
+
+		Vector<Collapse> collapses;
+		Vector<UINT32> remap(numVertices);
+		Vector<bool> touched(numVertices);
+		Vector<UINT32> vertexTriOffsets(numVertices + 1);
+		Vector<UINT32> vertexTris;
+
+		auto canCollapse = [&vertexKinds, &isBorderEdge](UINT32 from, UINT32 to)
+		{
+			switch(vertexKinds[from])
+			{
+			case SimplifyVertexKind::Manifold:
+				return true;
+			case SimplifyVertexKind::Border:
+				return vertexKinds[to] != SimplifyVertexKind::Manifold && isBorderEdge(from, to);
+			default:
+				return false;
+			}
+		};
+
+		// Finds a vertex welded to @p to that shares a triangle with the unwelded vertex @p from, or -1 if none
+		auto findCollapseTarget = [&](UINT32 from, UINT32 to)
+		{
+			for(UINT32 i = vertexTriOffsets[from]; i < vertexTriOffsets[from + 1]; i++)
+			{
+				const UINT32* tri = &output[vertexTris[i] * 3];
+				for(UINT32 j = 0; j < 3; j++)
+				{
+					if(weldRep[tri[j]] == to)
+						return tri[j];
+				}
+			}
+
+			return (UINT32)-1;
+		};
+
+		// Checks if every used vertex welded to @p from can move onto a vertex welded to @p to along one of its own
+		// triangle edges. Otherwise the collapse would move a seam, stretching the attributes across it.
+		auto canCollapseSeams = [&](UINT32 from, UINT32 to)
+		{
+			UINT32 vertex = from;
+			do
+			{
+				bool isUsed = vertexTriOffsets[vertex] != vertexTriOffsets[vertex + 1];
+				if(isUsed && findCollapseTarget(vertex, to) == (UINT32)-1)
+					return false;
+
+				vertex = weldNext[vertex];
+			} while(vertex != from);
+
+			return true;
+		};
+
+		// Checks if moving a welded vertex would flip any of its triangles
+		auto flipsTriangles = [&](UINT32 from, UINT32 to)
+		{
+			const Vector3& newPosition = positions[to];
+
+			UINT32 vertex = from;
+			do
+			{
+				for(UINT32 i = vertexTriOffsets[vertex]; i < vertexTriOffsets[vertex + 1]; i++)
+				{
+					const UINT32* tri = &output[vertexTris[i] * 3];
+					if(weldRep[tri[0]] == to || weldRep[tri[1]] == to || weldRep[tri[2]] == to)
+						continue;
+
+					UINT32 idx = tri[0] == vertex ? 0 : (tri[1] == vertex ? 1 : 2);
+					const Vector3& p0 = positions[tri[idx]];
+					const Vector3& p1 = positions[tri[(idx + 1) % 3]];
+					const Vector3& p2 = positions[tri[(idx + 2) % 3]];
+
+					Vector3 oldNormal = (p1 - p0).cross(p2 - p0);
+					Vector3 newNormal = (p1 - newPosition).cross(p2 - newPosition);
+
+					if(oldNormal.dot(newNormal) <= 0.0f)
+						return true;
+				}
+
+				vertex = weldNext[vertex];
+			} while(vertex != from);
+
+			return false;
+		};
+
+		UINT32 numTris = (UINT32)output.size() / 3;
+		while(numTris > targetNumTriangles)
+		{
+			// Build vertex to triangle adjacency
+			std::fill(vertexTriOffsets.begin(), vertexTriOffsets.end(), 0);
+			for(auto& index : output)
+				vertexTriOffsets[index + 1]++;
+
+			for(UINT32 i = 0; i < numVertices; i++)
+				vertexTriOffsets[i + 1] += vertexTriOffsets[i];
+
+			vertexTris.resize(output.size());
+			Vector<UINT32> vertexTriCount(numVertices, 0);
+			for(UINT32 i = 0; i < (UINT32)output.size(); i++)
+			{
+				UINT32 vertexIdx = output[i];
+				vertexTris[vertexTriOffsets[vertexIdx] + vertexTriCount[vertexIdx]++] = i / 3;
+			}
+
+			// Find collapse candidates, one per edge
+			collapses.clear();
+			for(UINT32 i = 0; i < (UINT32)output.size(); i += 3)
+			{
+				for(UINT32 j = 0; j < 3; j++)
+				{
+					UINT32 a = weldRep[output[i + j]];
+					UINT32 b = weldRep[output[i + (j + 1) % 3]];
+
+					// Interior edges are present in two triangles, only process them once
+					if(a == b || (a > b && !isBorderEdge(a, b)))
+						continue;
+
+					Collapse collapse = { 0, 0, std::numeric_limits<float>::max() };
+					if(canCollapse(a, b))
+						collapse = { a, b, quadrics[a].evaluate(positions[b]) + quadrics[b].evaluate(positions[b]) };
+
+					if(canCollapse(b, a))
+					{
+						float cost = quadrics[a].evaluate(positions[a]) + quadrics[b].evaluate(positions[a]);
+						if(cost < collapse.cost)
+							collapse = { b, a, cost };
+					}
+
+					if(collapse.cost != std::numeric_limits<float>::max())
+						collapses.push_back(collapse);
+				}
+			}
+
+			std::sort(collapses.begin(), collapses.end(),
+				[](const Collapse& a, const Collapse& b) { return a.cost < b.cost; });
+
+			// Perform the collapses with the lowest error. Vertices around each collapsed vertex are locked for the rest
+			// of the pass, so the checks performed for the remaining collapses stay valid.
+			for(UINT32 i = 0; i < numVertices; i++)
+				remap[i] = i;
+
+			std::fill(touched.begin(), touched.end(), false);
+
+			UINT32 numTrisToRemove = numTris - targetNumTriangles;
+			UINT32 numRemoved = 0;
+			UINT32 numCollapsed = 0;
+			for(auto& collapse : collapses)
+			{
+				if(numRemoved >= numTrisToRemove)
+					break;
+
+				if(touched[collapse.from] || touched[collapse.to])
+					continue;
+
+				if(!canCollapseSeams(collapse.from, collapse.to) || flipsTriangles(collapse.from, collapse.to))
+					continue;
+
+				quadrics[collapse.to] += quadrics[collapse.from];
+
+				// Move each of the welded vertices onto the matching vertex on its side of the seam
+				UINT32 vertex = collapse.from;
+				do
+				{
+					if(vertexTriOffsets[vertex] != vertexTriOffsets[vertex + 1])
+						remap[vertex] = findCollapseTarget(vertex, collapse.to);
+
+					for(UINT32 i = vertexTriOffsets[vertex]; i < vertexTriOffsets[vertex + 1]; i++)
+					{
+						const UINT32* tri = &output[vertexTris[i] * 3];
+						if(weldRep[tri[0]] == collapse.to || weldRep[tri[1]] == collapse.to ||
+							weldRep[tri[2]] == collapse.to)
+						{
+							numRemoved++;
+						}
+
+						for(UINT32 j = 0; j < 3; j++)
+							touched[weldRep[tri[j]]] = true;
+					}
+
+					vertex = weldNext[vertex];
+				} while(vertex != collapse.from);
+
+				numCollapsed++;
+			}
+
+			if(numCollapsed == 0)
+				break;
+
+			// Apply the collapses and remove the triangles that became degenerate
+			UINT32 numOutputIndices = 0;
+			for(UINT32 i = 0; i < (UINT32)output.size(); i += 3)
+			{
+				UINT32 a = remap[output[i + 0]];
+				UINT32 b = remap[output[i + 1]];
+				UINT32 c = remap[output[i + 2]];
+
+				if(weldRep[a] == weldRep[b] || weldRep[b] == weldRep[c] || weldRep[a] == weldRep[c])
+					continue;
+
+				output[numOutputIndices++] = a;
+				output[numOutputIndices++] = b;
+				output[numOutputIndices++] = c;
+			}
+
+			output.resize(numOutputIndices);
+			numTris = numOutputIndices / 3;
+
+			findEdges(output);
+		}
+	}
+
+	SPtr<MeshData> MeshUtility::generateLODs(const SPtr<MeshData>& meshData, const Vector<SubMesh>& subMeshes,
+		UINT32 numLODs, float reduction, Vector<MeshLOD>& lods)
+	{
+		static constexpr float FIRST_LOD_SCREEN_SIZE = 0.5f;
+
+		lods.clear();
+
+		Vector<UINT32> indices;
+		readIndices(*meshData, indices);
+
+		Vector<SubMesh> ranges = subMeshes;
+		if(ranges.empty())
+			ranges.push_back(SubMesh(0, meshData->getNumIndices(), DOT_TRIANGLE_LIST));
+
+		Vector<Vector<UINT32>> rangeIndices(ranges.size());
+		for(UINT32 i = 0; i < (UINT32)ranges.size(); i++)
+		{
+			const UINT32* start = indices.data() + ranges[i].indexOffset;
+			rangeIndices[i].assign(start, start + ranges[i].indexCount);
+		}
+
+		// Screen area falls off with the square of the screen size, scale the size by the square root of the triangle
+		// reduction so triangle density on screen remains the same when switching levels
+		float screenSize = FIRST_LOD_SCREEN_SIZE;
+		float screenSizeScale = std::sqrt(reduction);
+
+		UINT32 numVertices = meshData->getNumVertices();
+		for(UINT32 i = 0; i < numLODs; i++)
+		{
+			MeshLOD lod;
+			lod.screenSize = screenSize;
+
+			for(UINT32 j = 0; j < (UINT32)ranges.size(); j++)
+			{
+				if(ranges[j].drawOp != DOT_TRIANGLE_LIST)
+				{
+					lod.subMeshes.push_back(ranges[j]);
+					continue;
+				}
+
+				UINT32 numTris = (UINT32)rangeIndices[j].size() / 3;
+				UINT32 targetNumTris = (UINT32)(numTris * reduction);
+
+				Vector<UINT32> simplified;
+				simplify(meshData, rangeIndices[j], targetNumTris, simplified);
+
+				optimizeVertexCache(simplified.data(), (UINT32)simplified.size(), numVertices);
+
+				lod.subMeshes.push_back(SubMesh((UINT32)indices.size(), (UINT32)simplified.size(), DOT_TRIANGLE_LIST));
+				indices.insert(indices.end(), simplified.begin(), simplified.end());
+
+				rangeIndices[j] = std::move(simplified);
+			}
+
+			lods.push_back(lod);
+			screenSize *= screenSizeScale;
+		}
+
+		const SPtr<VertexDataDesc>& vertexDesc = meshData->getVertexDesc();
+		SPtr<MeshData> output = MeshData::create(numVertices, (UINT32)indices.size(), vertexDesc,
+			meshData->getIndexType());
+
+		UINT32 numStreams = 0;
+		for(UINT32 i = 0; i < vertexDesc->getNumElements(); i++)
+			numStreams = std::max(numStreams, (UINT32)vertexDesc->getElement(i).getStreamIdx() + 1);
+
+		for(UINT32 i = 0; i < numStreams; i++)
+		{
+			UINT32 stride = vertexDesc->getVertexStride(i);
+			if(stride > 0)
+				memcpy(output->getStreamData(i), meshData->getStreamData(i), numVertices * stride);
+		}
+
+		writeIndices(indices, *output);
+		return output;
+	}
+
+	SPtr<MeshData> MeshUtility::quantize(const SPtr<MeshData>& meshData, MeshQuantizationFlags flags,
+		PositionQuantization& positionQuantization)
+	{
+		positionQuantization = PositionQuantization();
+
+		const SPtr<VertexDataDesc>& vertexDesc = meshData->getVertexDesc();
+		UINT32 numVertices = meshData->getNumVertices();
+		UINT32 numElements = vertexDesc->getNumElements();
+
+		// Determine which elements can be quantized
+		SPtr<VertexDataDesc> outputDesc = VertexDataDesc::create();
+		Vector<VertexElementType> outputTypes(numElements);
+		for (UINT32 i = 0; i < numElements; i++)
+		{
+			const VertexElement& element = vertexDesc->getElement(i);
+			VertexElementType type = element.getType();
+
+			VertexElementType outputType = type;
+			switch (element.getSemantic())
+			{
+			case VES_POSITION:
+				if (flags.isSet(MeshQuantizationFlag::Position) && (type == VET_FLOAT3 || type == VET_FLOAT4))
+					outputType = VET_USHORT4_NORM;
+				break;
+			case VES_NORMAL:
+			case VES_TANGENT:
+			case VES_BITANGENT:
+				if (flags.isSet(MeshQuantizationFlag::Normal) &&
+					(type == VET_FLOAT3 || type == VET_FLOAT4 || type == VET_UBYTE4_NORM))
+					outputType = VET_UINT_10_10_10_2_NORM;
+				break;
+			case VES_TEXCOORD:
+				if (flags.isSet(MeshQuantizationFlag::TexCoord) && type == VET_FLOAT2)
+					outputType = VET_HALF2;
+				break;
+			default:
+				break;
+			}
+
+			outputTypes[i] = outputType;
+			outputDesc->addVertElem(outputType, element.getSemantic(), element.getSemanticIdx(), element.getStreamIdx(),
+				element.getInstanceStepRate());
+		}
+
+		SPtr<MeshData> output = MeshData::create(numVertices, meshData->getNumIndices(), outputDesc,
+			meshData->getIndexType());
+
+		Vector<UINT32> indices;
+		readIndices(*meshData, indices);
+		writeIndices(indices, *output);
+
+		for (UINT32 i = 0; i < numElements; i++)
+		{
+			const VertexElement& element = vertexDesc->getElement(i);
+			VertexElementSemantic semantic = element.getSemantic();
+			UINT32 semanticIdx = element.getSemanticIdx();
+			UINT32 streamIdx = element.getStreamIdx();
+
+			UINT8* src = meshData->getElementData(semantic, semanticIdx, streamIdx);
+			UINT8* dst = output->getElementData(semantic, semanticIdx, streamIdx);
+			UINT32 srcStride = vertexDesc->getVertexStride(streamIdx);
+			UINT32 dstStride = outputDesc->getVertexStride(streamIdx);
+
+			VertexElementType srcType = element.getType();
+			VertexElementType dstType = outputTypes[i];
+
+			switch (dstType)
+			{
+			case VET_USHORT4_NORM:
+			{
+				// Quantize relative to the bounds, so the full 16-bit range is used along each axis
+				Vector3 min = Vector3::INF;
+				Vector3 max = -Vector3::INF;
+				for (UINT32 j = 0; j < numVertices; j++)
+				{
+					const Vector3& position = *(Vector3*)(src + j * srcStride);
+					min = Vector3::min(min, position);
+					max = Vector3::max(max, position);
+				}
+
+				if (numVertices == 0)
+				{
+					min = Vector3::ZERO;
+					max = Vector3::ZERO;
+				}
+
+				Vector3 scale = max - min;
+				for (UINT32 j = 0; j < 3; j++)
+				{
+					// Degenerate axes still need a valid scale, so the decode transform remains invertible
+					if (scale[j] <= 0.0f)
+						scale[j] = 1.0f;
+				}
+
+				positionQuantization.scale = scale;
+				positionQuantization.offset = min;
+
+				Vector3 invScale(1.0f / scale.x, 1.0f / scale.y, 1.0f / scale.z);
+				for (UINT32 j = 0; j < numVertices; j++)
+				{
+					const Vector3& position = *(Vector3*)(src + j * srcStride);
+					Vector3 normalized = (position - min) * invScale;
+
+					UINT16* quantized = (UINT16*)(dst + j * dstStride);
+					for (UINT32 k = 0; k < 3; k++)
+						quantized[k] = (UINT16)Math::clamp(Math::roundToInt(normalized[k] * 65535.0f), 0, 65535);
+
+					quantized[3] = 65535;
+				}
+			}
+				break;
+			case VET_UINT_10_10_10_2_NORM:
+				for (UINT32 j = 0; j < numVertices; j++)
+				{
+					UINT8* srcData = src + j * srcStride;
+
+					// The 2-bit component only needs to preserve the sign, as used by the tangent
+					Vector3 value;
+					bool negative = false;
+					if (srcType == VET_UBYTE4_NORM)
+					{
+						value = unpackNormal(srcData);
+						negative = ((PackedNormal*)srcData)->w < 128;
+					}
+					else
+					{
+						value = *(Vector3*)srcData;
+
+						if (srcType == VET_FLOAT4)
+							negative = ((Vector4*)srcData)->w < 0.0f;
+					}
+
+					*(UINT32*)(dst + j * dstStride) = packNormal1010102(value, negative ? 0 : 3);
+				}
+				break;
+			case VET_HALF2:
+				for (UINT32 j = 0; j < numVertices; j++)
+				{
+					const Vector2& value = *(Vector2*)(src + j * srcStride);
+
+					UINT16* half = (UINT16*)(dst + j * dstStride);
+					half[0] = Bitwise::floatToHalf(value.x);
+					half[1] = Bitwise::floatToHalf(value.y);
+				}
+				break;
+			default:
+			{
+				UINT32 size = element.getSize();
+				for (UINT32 j = 0; j < numVertices; j++)
+					memcpy(dst + j * dstStride, src + j * srcStride, size);
+			}
+				break;
+			}
+		}
+
+		return output;
+	}
+
+	SPtr<MeshData> MeshUtility::dequantize(const SPtr<MeshData>& meshData,
+		const PositionQuantization& positionQuantization)
+	{
+		const SPtr<VertexDataDesc>& vertexDesc = meshData->getVertexDesc();
+		UINT32 numVertices = meshData->getNumVertices();
+		UINT32 numElements = vertexDesc->getNumElements();
+
+		SPtr<VertexDataDesc> outputDesc = VertexDataDesc::create();
+		for (UINT32 i = 0; i < numElements; i++)
+		{
+			const VertexElement& element = vertexDesc->getElement(i);
+
+			VertexElementType outputType = element.getType();
+			switch (outputType)
+			{
+			case VET_USHORT4_NORM:
+				outputType = element.getSemantic() == VES_POSITION ? VET_FLOAT3 : VET_FLOAT4;
+				break;
+			case VET_UINT_10_10_10_2_NORM:
+				outputType = element.getSemantic() == VES_TANGENT ? VET_FLOAT4 : VET_FLOAT3;
+				break;
+			case VET_USHORT2_NORM:
+			case VET_HALF2:
+				outputType = VET_FLOAT2;
+				break;
+			case VET_HALF4:
+				outputType = VET_FLOAT4;
+				break;
+			default:
+				break;
+			}
+
+			outputDesc->addVertElem(outputType, element.getSemantic(), element.getSemanticIdx(), element.getStreamIdx(),
+				element.getInstanceStepRate());
+		}
+
+		SPtr<MeshData> output = MeshData::create(numVertices, meshData->getNumIndices(), outputDesc,
+			meshData->getIndexType());
+
+		Vector<UINT32> indices;
+		readIndices(*meshData, indices);
+		writeIndices(indices, *output);
+
+		for (UINT32 i = 0; i < numElements; i++)
+		{
+			const VertexElement& element = vertexDesc->getElement(i);
+			VertexElementSemantic semantic = element.getSemantic();
+			UINT32 semanticIdx = element.getSemanticIdx();
+			UINT32 streamIdx = element.getStreamIdx();
+
+			UINT8* src = meshData->getElementData(semantic, semanticIdx, streamIdx);
+			UINT8* dst = output->getElementData(semantic, semanticIdx, streamIdx);
+			UINT32 srcStride = vertexDesc->getVertexStride(streamIdx);
+			UINT32 dstStride = outputDesc->getVertexStride(streamIdx);
+
+			VertexElementType srcType = element.getType();
+			UINT32 dstSize = outputDesc->getElement(i).getSize();
+
+			for (UINT32 j = 0; j < numVertices; j++)
+			{
+				UINT8* srcData = src + j * srcStride;
+				UINT8* dstData = dst + j * dstStride;
+
+				Vector4 value;
+				switch (srcType)
+				{
+				case VET_USHORT2_NORM:
+				case VET_USHORT4_NORM:
+				{
+					UINT32 numComponents = VertexElement::getTypeCount(srcType);
+					for (UINT32 k = 0; k < numComponents; k++)
+						value[k] = ((UINT16*)srcData)[k] / 65535.0f;
+
+					if (semantic == VES_POSITION)
+					{
+						Vector3 position = Vector3(value.x, value.y, value.z) * positionQuantization.scale +
+							positionQuantization.offset;
+
+						value = Vector4(position.x, position.y, position.z, 1.0f);
+					}
+				}
+					break;
+				case VET_UINT_10_10_10_2_NORM:
+					value = unpackNormal1010102(*(UINT32*)srcData);
+					break;
+				case VET_HALF2:
+				case VET_HALF4:
+				{
+					UINT32 numComponents = VertexElement::getTypeCount(srcType);
+					for (UINT32 k = 0; k < numComponents; k++)
+						value[k] = Bitwise::halfToFloat(((UINT16*)srcData)[k]);
+				}
+					break;
+				default:
+					memcpy(dstData, srcData, dstSize);
+					continue;
+				}
+
+				memcpy(dstData, &value, dstSize);
+			}
+		}
+
+		return output;
+	}
 }
@@ -4,6 +4,7 @@
 
 #include "BsCorePrerequisites.h"
 #include "Math/BsVector3.h"
+#include "RenderAPI/BsSubMesh.h"
 
 namespace bs
 {
@@ -25,6 +26,66 @@ namespace bs
 		UINT32 packed;
 	};
 
+	/** Operations that may be performed when optimizing mesh data for rendering. */
+	enum class BS_SCRIPT_EXPORT(m:Importer,n:MeshOptimizationFlags,api:bsf,api:bed) MeshOptimizationFlag
+	{
+		/** No optimizations are performed. */
+		None = 0,
+		/** Merges vertices whose data is identical in all vertex streams. */
+		WeldVertices = 1 << 0,
+		/** Removes triangles that reference the same vertex, or the same position, more than once. */
+		RemoveDegenerates = 1 << 1,
+		/** Reorders triangles so vertices get reused from the post-transform vertex cache more often. */
+		VertexCache = 1 << 2,
+		/**
+		 * Reorders clusters of triangles so outward facing ones are rendered first, reducing overdraw. Vertex cache
+		 * efficiency is preserved within a small threshold.
+		 */
+		Overdraw = 1 << 3,
+		/** Reorders vertices in the order they are referenced by the index buffer, and removes unused vertices. */
+		VertexFetch = 1 << 4,
+		/** Helper entry that includes all optimizations. */
+		All = WeldVertices | RemoveDegenerates | VertexCache | Overdraw | VertexFetch
+	};
+
+	using MeshOptimizationFlags = Flags<MeshOptimizationFlag>;
+	BS_FLAGS_OPERATORS(MeshOptimizationFlag)
+
+	/** Vertex attributes that may be converted into a more compact format when quantizing mesh data. */
+	enum class BS_SCRIPT_EXPORT(m:Importer,n:MeshQuantizationFlags,api:bsf,api:bed) MeshQuantizationFlag
+	{
+		/** Stores positions as 16-bit normalized integers, relative to the mesh bounds. */
+		Position = 1 << 0,
+		/** Stores normals and tangents as 10:10:10:2 normalized integers. */
+		Normal = 1 << 1,
+		/** Stores texture coordinates as 16-bit floats. */
+		TexCoord = 1 << 2,
+		/** Helper entry that includes all attributes. */
+		All = Position | Normal | TexCoord
+	};
+
+	using MeshQuantizationFlags = Flags<MeshQuantizationFlag>;
+	BS_FLAGS_OPERATORS(MeshQuantizationFlag)
+
+	/** Statistics describing how efficiently can the GPU process mesh index and vertex data. */
+	struct MeshEfficiencyStats
+	{
+		/**
+		 * Average cache miss ratio, the average number of vertices that need to be transformed per triangle. Ranges from
+		 * 3 (no reuse) to around 0.5 for large regular meshes. Lower is better.
+		 */
+		float acmr = 0.0f;
+
+		/**
+		 * Average transform to vertex ratio, the number of vertex transforms divided by the number of unique vertices
+		 * referenced. 1 is optimal.
+		 */
+		float atvr = 0.0f;
+
+		/** Number of bytes fetched from the vertex buffers, divided by the total size of the vertex buffers. 1 is optimal. */
+		float fetchRatio = 0.0f;
+	};
+
 	/** Performs various operations on mesh geometry. */
 	class BS_CORE_EXPORT MeshUtility
 	{
@@ -179,6 +240,107 @@ namespace bs
 		 */
 		static void unpackNormals(UINT8* source, Vector4* destination, UINT32 count, UINT32 stride);
 
+		/**
+		 * Optimizes mesh data for rendering by removing redundant geometry and reordering triangles and vertices for
+		 * better GPU cache utilization. Triangles are only reordered within their own sub-mesh, and only sub-meshes
+		 * using triangle lists are affected by the triangle operations.
+		 *
+		 * @param[in]		meshData		Mesh data to optimize. Must contain 32-bit float positions if
+		 *									MeshOptimizationFlag::RemoveDegenerates or MeshOptimizationFlag::Overdraw is
+		 *									requested, otherwise those operations are skipped.
+		 * @param[in, out]	subMeshes		Sub-meshes referencing the index buffer of @p meshData. Index ranges will be
+		 *									updated to reference the returned mesh data. If empty, the entire index buffer
+		 *									is treated as a single triangle list.
+		 * @param[in]		flags			Operations to perform.
+		 * @param[out]		vertexRemap		Optional array that will contain an entry for every vertex in @p meshData,
+		 *									containing the vertex's index in the returned mesh data, or -1 if the vertex
+		 *									was removed.
+		 * @return							New mesh data object containing the optimized vertices and indices. Uses the
+		 *									same vertex description and index type as @p meshData.
+		 */
+		static SPtr<MeshData> optimize(const SPtr<MeshData>& meshData, Vector<SubMesh>& subMeshes,
+			MeshOptimizationFlags flags = MeshOptimizationFlag::All, Vector<UINT32>* vertexRemap = nullptr);
+
+		/**
+		 * Calculates how efficiently can the GPU process the provided mesh data, by simulating a FIFO post-transform
+		 * vertex cache and a cache of vertex buffer memory.
+		 *
+		 * @param[in]	meshData		Mesh data to analyze. All indices are assumed to form a triangle list.
+		 * @param[in]	cacheSize		Number of entries in the simulated post-transform vertex cache.
+		 * @return						Calculated statistics.
+		 */
+		static MeshEfficiencyStats calculateEfficiency(const SPtr<MeshData>& meshData, UINT32 cacheSize = 16);
+
+		/**
+		 * Reduces the number of triangles in a triangle list by iteratively collapsing the edges that introduce the least
+		 * geometric error, as measured by the vertex error quadrics. Vertices on open borders are only allowed to slide
+		 * along the border. Vertices sharing a position (e.g. on UV or normal seams) are collapsed together, and only
+		 * along edges that exist on both sides of the seam, so the simplified mesh doesn't develop holes or texture
+		 * discontinuities.
+		 *
+		 * @param[in]	meshData			Mesh data containing the vertices referenced by @p indices. Must contain 32-bit
+		 *									float positions.
+		 * @param[in]	indices				Indices of the triangle list to simplify.
+		 * @param[in]	targetNumTriangles	Number of triangles to simplify the mesh to. The actual number of triangles
+		 *									can be larger if further simplification is not possible without damaging the
+		 *									mesh, or slightly lower since collapses are performed in batches.
+		 * @param[out]	output				Indices of the simplified triangle list. Reference the same vertices as
+		 *									@p indices.
+		 */
+		static void simplify(const SPtr<MeshData>& meshData, const Vector<UINT32>& indices, UINT32 targetNumTriangles,
+			Vector<UINT32>& output);
+
+		/**
+		 * Generates a chain of progressively simpler levels of detail for a mesh. Each level of detail is simplified from
+		 * the previous one using simplify(). All levels of detail share the vertex data of the original mesh, and their
+		 * indices are appended after the indices of the original mesh.
+		 *
+		 * @param[in]	meshData		Mesh data to generate the levels of detail for. Must contain 32-bit float
+		 *								positions.
+		 * @param[in]	subMeshes		Sub-meshes referencing the index buffer of @p meshData. If empty, the entire index
+		 *								buffer is treated as a single triangle list. Sub-meshes not using triangle lists
+		 *								are used as is for all levels of detail.
+		 * @param[in]	numLODs			Number of levels of detail to generate, not counting the original mesh.
+		 * @param[in]	reduction		Number of triangles in each level of detail, relative to the previous level.
+		 * @param[out]	lods			Generated levels of detail, in order from most to least detailed. Screen sizes
+		 *								are assigned so the on-screen triangle density stays roughly constant when
+		 *								switching between levels.
+		 * @return						New mesh data object containing the original vertices and indices, followed by
+		 *								the indices of all generated levels of detail.
+		 */
+		static SPtr<MeshData> generateLODs(const SPtr<MeshData>& meshData, const Vector<SubMesh>& subMeshes,
+			UINT32 numLODs, float reduction, Vector<MeshLOD>& lods);
+
+		/**
+		 * Converts vertex attributes into more compact formats. Positions are converted to VET_USHORT4_NORM, normals and
+		 * tangents to VET_UINT_10_10_10_2_NORM and texture coordinates to VET_HALF2. Attributes not stored in a supported
+		 * source format, and attributes not present in @p flags, are copied over unchanged.
+		 *
+		 * @param[in]	meshData				Mesh data to quantize. Positions must be 32-bit floats, normals and
+		 *										tangents 32-bit floats or VET_UBYTE4_NORM, and texture coordinates 2D
+		 *										32-bit floats.
+		 * @param[in]	flags					Attributes to quantize.
+		 * @param[out]	positionQuantization	Transform required for decoding quantized positions into mesh local space.
+		 *										Should be provided to the mesh through MESH_DESC::positionQuantization.
+		 *										Identity if positions weren't quantized.
+		 * @return								New mesh data object using the quantized vertex description, with the
+		 *										same indices as @p meshData.
+		 */
+		static SPtr<MeshData> quantize(const SPtr<MeshData>& meshData, MeshQuantizationFlags flags,
+			PositionQuantization& positionQuantization);
+
+		/**
+		 * Performs the opposite of quantize(), converting quantized vertex attributes back into 32-bit float formats.
+		 * Normals are converted to VET_FLOAT3, tangents to VET_FLOAT4 and other attributes to float vectors with the
+		 * same number of components.
+		 *
+		 * @param[in]	meshData				Mesh data to convert.
+		 * @param[in]	positionQuantization	Transform used for decoding quantized positions into mesh local space.
+		 * @return								New mesh data object using 32-bit float attributes.
+		 */
+		static SPtr<MeshData> dequantize(const SPtr<MeshData>& meshData,
+			const PositionQuantization& positionQuantization);
+
 		/** Decodes a normal from 4D 8-bit packed format into a 32-bit float format. */
 		static Vector3 unpackNormal(const UINT8* source)
 		{
@@ -15,6 +15,8 @@ namespace bs
 	 *  @{
 	 */
 
+	BS_ALLOW_MEMCPY_SERIALIZATION(AnimationLODLevel)
+
 	class BS_CORE_EXPORT CAnimationRTTI : public RTTIType<CAnimation, Component, CAnimationRTTI>
 	{
 		BS_BEGIN_RTTI_MEMBERS
@@ -24,6 +26,7 @@ namespace bs
 			BS_RTTI_MEMBER_PLAIN(mEnableCull, 3)
 			BS_RTTI_MEMBER_PLAIN(mUseBounds, 4)
 			BS_RTTI_MEMBER_PLAIN(mBounds, 5)
+			BS_RTTI_MEMBER_PLAIN_ARRAY(mLODLevels, 6)
 		BS_END_RTTI_MEMBERS
 	public:
 		const String& getRTTIName() override
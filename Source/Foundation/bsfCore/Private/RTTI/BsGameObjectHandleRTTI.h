@@ -21,12 +21,8 @@ namespace bs
 	private:
 		UINT64& getInstanceId(GameObjectHandleBase* obj)
 		{
-			static UINT64 invalidId = 0;
-
-			if (obj->mData->mPtr != nullptr)
-				return obj->mData->mPtr->mInstanceId;
-
-			return invalidId;
+			mInstanceId = obj->getInstanceId();
+			return mInstanceId;
 		}
 
 		void setInstanceId(GameObjectHandleBase* obj, UINT64& value) { mOriginalInstanceId = value; }
@@ -69,6 +65,7 @@ namespace bs
 		}
 
 	private:
+		UINT64 mInstanceId = 0;
 		UINT64 mOriginalInstanceId;
 	};
 
@@ -5,6 +5,7 @@
 #include "BsCorePrerequisites.h"
 #include "Reflection/BsRTTIType.h"
 #include "Reflection/BsRTTIPlain.h"
+#include "RTTI/BsStdRTTI.h"
 #include "Mesh/BsMeshBase.h"
 #include "Error/BsException.h"
 
@@ -16,6 +17,62 @@ namespace bs
 	 */
 
 	BS_ALLOW_MEMCPY_SERIALIZATION(SubMesh);
+	BS_ALLOW_MEMCPY_SERIALIZATION(PositionQuantization);
+
+	template<> struct RTTIPlainType<MeshLOD>
+	{
+		enum { id = TID_MeshLOD }; enum { hasDynamicSize = 1 };
+
+		/** @copydoc RTTIPlainType::toMemory */
+		static BitLength toMemory(const MeshLOD& data, Bitstream& stream, const RTTIFieldInfo& fieldInfo, bool compress)
+		{
+			static constexpr uint32_t VERSION = 0; // In case the data structure changes
+
+			return rtti_write_with_size_header(stream, data, compress, [&data, &stream]()
+			{
+				BitLength size = 0;
+				size += rtti_write(VERSION, stream);
+				size += rtti_write(data.subMeshes, stream);
+				size += rtti_write(data.screenSize, stream);
+
+				return size;
+			});
+		}
+
+		/** @copydoc RTTIPlainType::fromMemory */
+		static BitLength fromMemory(MeshLOD& data, Bitstream& stream, const RTTIFieldInfo& fieldInfo, bool compress)
+		{
+			BitLength size;
+			rtti_read_size_header(stream, compress, size);
+
+			uint32_t version;
+			rtti_read(version, stream);
+
+			switch(version)
+			{
+			case 0:
+				rtti_read(data.subMeshes, stream);
+				rtti_read(data.screenSize, stream);
+				break;
+			default:
+				BS_LOG(Error, RTTI, "Unknown version of MeshLOD data. Unable to deserialize.");
+				break;
+			}
+
+			return size;
+		}
+
+		/** @copydoc RTTIPlainType::getSize */
+		static BitLength getSize(const MeshLOD& data, const RTTIFieldInfo& fieldInfo, bool compress)
+		{
+			BitLength dataSize = sizeof(uint32_t);
+			dataSize += rtti_size(data.subMeshes);
+			dataSize += rtti_size(data.screenSize);
+
+			rtti_add_header_size(dataSize, compress);
+			return dataSize;
+		}
+	};
 
 	class MeshBaseRTTI : public RTTIType<MeshBase, Resource, MeshBaseRTTI>
 	{
@@ -30,6 +87,14 @@ namespace bs
 		UINT32& getNumIndices(MeshBase* obj) { return obj->mProperties.mNumIndices; }
 		void setNumIndices(MeshBase* obj, UINT32& value) { obj->mProperties.mNumIndices = value; }
 
+		MeshLOD& getLOD(MeshBase* obj, UINT32 arrayIdx) { return obj->mProperties.mLODs[arrayIdx]; }
+		void setLOD(MeshBase* obj, UINT32 arrayIdx, MeshLOD& value) { obj->mProperties.mLODs[arrayIdx] = value; }
+		UINT32 getNumLODs(MeshBase* obj) { return (UINT32)obj->mProperties.mLODs.size(); }
+		void setNumLODs(MeshBase* obj, UINT32 numElements) { obj->mProperties.mLODs.resize(numElements); }
+
+		PositionQuantization& getPositionQuantization(MeshBase* obj) { return obj->mProperties.mPositionQuantization; }
+		void setPositionQuantization(MeshBase* obj, PositionQuantization& value) { obj->mProperties.mPositionQuantization = value; }
+
 	public:
 		MeshBaseRTTI()
 		{
@@ -38,6 +103,12 @@ namespace bs
 
 			addPlainArrayField("mSubMeshes", 2, &MeshBaseRTTI::getSubMesh,
 				&MeshBaseRTTI::getNumSubmeshes, &MeshBaseRTTI::setSubMesh, &MeshBaseRTTI::setNumSubmeshes);
+
+			addPlainArrayField("mLODs", 3, &MeshBaseRTTI::getLOD,
+				&MeshBaseRTTI::getNumLODs, &MeshBaseRTTI::setLOD, &MeshBaseRTTI::setNumLODs);
+
+			addPlainField("mPositionQuantization", 4, &MeshBaseRTTI::getPositionQuantization,
+				&MeshBaseRTTI::setPositionQuantization);
 		}
 
 		SPtr<IReflectable> newRTTIObject() override
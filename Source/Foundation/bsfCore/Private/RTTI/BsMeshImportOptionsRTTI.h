@@ -6,6 +6,7 @@
 #include "Reflection/BsRTTIType.h"
 #include "RTTI/BsStringRTTI.h"
 #include "RTTI/BsStdRTTI.h"
+#include "RTTI/BsFlagsRTTI.h"
 #include "Importer/BsMeshImportOptions.h"
 #include "Private/RTTI/BsAnimationClipRTTI.h"
 
@@ -32,6 +33,10 @@ namespace bs
 			BS_RTTI_MEMBER_PLAIN(reduceKeyFrames, 9)
 			BS_RTTI_MEMBER_REFL_ARRAY(animationEvents, 10)
 			BS_RTTI_MEMBER_PLAIN(importRootMotion, 11)
+			BS_RTTI_MEMBER_PLAIN(optimization, 12)
+			BS_RTTI_MEMBER_PLAIN(lodCount, 13)
+			BS_RTTI_MEMBER_PLAIN(lodReduction, 14)
+			BS_RTTI_MEMBER_PLAIN(quantization, 15)
 		BS_END_RTTI_MEMBERS
 	public:
 		const String& getRTTIName() override
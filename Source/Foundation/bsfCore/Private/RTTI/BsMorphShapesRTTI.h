@@ -24,6 +24,12 @@ namespace bs
 		BS_END_RTTI_MEMBERS
 
 	public:
+		void onDeserializationEnded(IReflectable* obj, SerializationContext* context) override
+		{
+			MorphShape* shape = static_cast<MorphShape*>(obj);
+			shape->buildBlendData();
+		}
+
 		const String& getRTTIName() override
 		{
 			static String name = "MorphShape";
@@ -62,6 +62,12 @@ namespace bs
 				&SkeletonRTTI::setBoneTransform, &SkeletonRTTI::setNumBoneTransforms);
 		}
 
+		void onDeserializationEnded(IReflectable* obj, SerializationContext* context) override
+		{
+			Skeleton* skeleton = static_cast<Skeleton*>(obj);
+			skeleton->buildEvaluationOrder();
+		}
+
 		const String& getRTTIName() override
 		{
 			static String name = "Skeleton";
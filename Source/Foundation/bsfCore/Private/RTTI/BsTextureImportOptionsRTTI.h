@@ -25,6 +25,7 @@ namespace bs
 			BS_RTTI_MEMBER_PLAIN(sRGB, 4)
 			BS_RTTI_MEMBER_PLAIN(cubemap, 5)
 			BS_RTTI_MEMBER_PLAIN(cubemapSourceType, 6)
+			BS_RTTI_MEMBER_PLAIN(streamable, 7)
 		BS_END_RTTI_MEMBERS
 
 	public:
@@ -11,6 +11,7 @@
 #include "RenderAPI/BsRenderAPI.h"
 #include "Managers/BsTextureManager.h"
 #include "Image/BsPixelData.h"
+#include "FileSystem/BsDataStream.h"
 
 namespace bs
 {
@@ -34,6 +35,7 @@ namespace bs
 			BS_RTTI_MEMBER_PLAIN_NAMED(numSamples, mProperties.mDesc.numSamples, 7)
 			BS_RTTI_MEMBER_PLAIN_NAMED(type, mProperties.mDesc.type, 9)
 			BS_RTTI_MEMBER_PLAIN_NAMED(format, mProperties.mDesc.format, 10)
+			BS_RTTI_MEMBER_PLAIN(mStreamable, 13)
 		BS_END_RTTI_MEMBERS
 
 		INT32& getUsage(Texture* obj) { return obj->mProperties.mDesc.usage; }
@@ -52,8 +54,11 @@ namespace bs
 
 		SPtr<PixelData> getPixelData(Texture* obj, UINT32 idx)
 		{
-			UINT32 face = (size_t)Math::floor(idx / (float)(obj->mProperties.getNumMipmaps() + 1));
-			UINT32 mipmap = idx % (obj->mProperties.getNumMipmaps() + 1);
+			// Only mip levels that aren't streamed are stored in the array
+			const UINT32 numMips = obj->mProperties.getNumMipmaps() + 1 - mNumStreamedMips;
+
+			UINT32 face = idx / numMips;
+			UINT32 mipmap = mNumStreamedMips + idx % numMips;
 
 			SPtr<PixelData> pixelData = obj->mProperties.allocBuffer(face, mipmap);
 
@@ -70,7 +75,7 @@ namespace bs
 
 		UINT32 getPixelDataArraySize(Texture* obj)
 		{
-			return obj->mProperties.getNumFaces() * (obj->mProperties.getNumMipmaps() + 1);
+			return obj->mProperties.getNumFaces() * (obj->mProperties.getNumMipmaps() + 1 - mNumStreamedMips);
 		}
 
 		void setPixelDataArraySize(Texture* obj, UINT32 size)
@@ -78,6 +83,51 @@ namespace bs
 			mPixelData.resize(size);
 		}
 
+		UINT32& getNumStreamedMips(Texture* obj) { return mNumStreamedMips; }
+		void setNumStreamedMips(Texture* obj, UINT32& val) { mNumStreamedMips = val; }
+
+		SPtr<DataStream> getStreamedData(Texture* obj, UINT32& size)
+		{
+			const UINT32 numFaces = obj->mProperties.getNumFaces();
+
+			size = 0;
+			for (UINT32 i = 0; i < mNumStreamedMips; i++)
+			{
+				SPtr<PixelData> pixelData = obj->mProperties.allocBuffer(0, i);
+				size += pixelData->getSize() * numFaces;
+			}
+
+			SPtr<MemoryDataStream> stream = bs_shared_ptr_new<MemoryDataStream>(size);
+
+			// Streamed mip levels are stored in order from the most detailed one, with all faces of a mip level stored
+			// together, so each mip level can be read individually
+			for (UINT32 i = 0; i < mNumStreamedMips; i++)
+			{
+				for (UINT32 j = 0; j < numFaces; j++)
+				{
+					SPtr<PixelData> pixelData = obj->mProperties.allocBuffer(j, i);
+
+					obj->readData(pixelData, j, i);
+					gCoreThread().submitAll(true);
+
+					stream->write(pixelData->getData(), pixelData->getSize());
+				}
+			}
+
+			stream->seek(0);
+			return stream;
+		}
+
+		void setStreamedData(Texture* obj, const SPtr<DataStream>& val, UINT32 size)
+		{
+			if (size == 0)
+				return;
+
+			// Making sure that the texture cannot modify the source stream, which is still used by the deserializer
+			obj->mStreamData = val->clone();
+			obj->mStreamOffset = val->tell();
+		}
+
 	public:
 		TextureRTTI()
 		{
@@ -85,6 +135,21 @@ namespace bs
 
 			addReflectablePtrArrayField("mPixelData", 12, &TextureRTTI::getPixelData, &TextureRTTI::getPixelDataArraySize,
 				&TextureRTTI::setPixelData, &TextureRTTI::setPixelDataArraySize, RTTIFieldInfo(RTTIFieldFlag::SkipInReferenceSearch));
+
+			addDataBlockField("mStreamedData", 14, &TextureRTTI::getStreamedData, &TextureRTTI::setStreamedData);
+			addPlainField("mNumStreamedMips", 15, &TextureRTTI::getNumStreamedMips, &TextureRTTI::setNumStreamedMips);
+		}
+
+		void onSerializationStarted(IReflectable* obj, SerializationContext* context) override
+		{
+			Texture* texture = static_cast<Texture*>(obj);
+			mNumStreamedMips = texture->calculateNumStreamedMips();
+
+			if (texture->mResidentMip > 0 && texture->isStreaming() && texture->mStreamData->isFile())
+			{
+				BS_LOG(Warning, RTTI, "Saving a Texture which uses streaming data. Streaming data might not be "
+					"available if saving to the same file.");
+			}
 		}
 
 		void onDeserializationEnded(IReflectable* obj, SerializationContext* context) override
@@ -112,14 +177,21 @@ namespace bs
 				}
 			}
 
+			// Only the mip levels that aren't streamed are made resident, streamed mip levels are read from the source
+			// stream on demand, and converted to the valid format then
+			texture->mStreamFormat = originalFormat;
+			texture->mNumStreamedMips = mNumStreamedMips;
+			texture->mResidentMip = mNumStreamedMips;
+
 			// A bit clumsy initializing with already set values, but I feel its better than complicating things and storing the values
 			// in mRTTIData.
 			texture->initialize();
 
-			for(size_t i = 0; i < mPixelData.size(); i++)
+			const UINT32 numMips = texProps.getNumMipmaps() + 1 - mNumStreamedMips;
+			for(UINT32 i = 0; i < (UINT32)mPixelData.size(); i++)
 			{
-				UINT32 face = (size_t)Math::floor(i / (float)(texProps.getNumMipmaps() + 1));
-				UINT32 mipmap = i % (texProps.getNumMipmaps() + 1);
+				UINT32 face = i / numMips;
+				UINT32 mipmap = mNumStreamedMips + i % numMips;
 
 				texture->writeData(mPixelData[i], face, mipmap, false);
 			}
@@ -143,6 +215,7 @@ namespace bs
 
 	private:
 		Vector<SPtr<PixelData>> mPixelData;
+		UINT32 mNumStreamedMips = 0;
 	};
 
 	/** @} */
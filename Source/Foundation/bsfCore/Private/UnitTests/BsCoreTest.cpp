@@ -4,6 +4,66 @@
 #include "Testing/BsTestSuite.h"
 #include "Animation/BsAnimationCurve.h"
 #include "Particles/BsParticleDistribution.h"
+#include "Mesh/BsMeshData.h"
+#include "Mesh/BsMeshUtility.h"
+#include "Mesh/BsMeshBase.h"
+#include "RenderAPI/BsVertexDataDesc.h"
+#include "Math/BsRandom.h"
+#include "Animation/BsSkeleton.h"
+#include "Animation/BsSkeletonMask.h"
+#include "Animation/BsAnimationClip.h"
+#include "Animation/BsAnimationLOD.h"
+#include "Animation/BsAnimation.h"
+#include "Animation/BsMorphShapes.h"
+#include "Utility/BsTimer.h"
+#include "Utility/BsSystemGraph.h"
+#include "Utility/BsFramePacer.h"
+#include "Threading/BsThreadPool.h"
+#include "Threading/BsTaskScheduler.h"
+#include "Scene/BsSceneManager.h"
+#include "Scene/BsSceneObject.h"
+#include "Scene/BsComponent.h"
+#include "Scene/BsGameObjectManager.h"
+#include "Scene/BsPrefab.h"
+#include "Scene/BsPrefabUtility.h"
+#include "Reflection/BsRTTIType.h"
+#include "Serialization/BsBinarySerializer.h"
+#include "Utility/BsUtility.h"
+#include "RTTI/BsStringRTTI.h"
+#include "Resources/BsResources.h"
+#include "Resources/BsResource.h"
+#include "Resources/BsResourceArchive.h"
+#include "Resources/BsResourceManifest.h"
+#include "CoreThread/BsCoreObjectManager.h"
+#include "FileSystem/BsFileSystem.h"
+#include "FileSystem/BsDataStream.h"
+#include "CoreThread/BsCoreThread.h"
+#include "Image/BsTexture.h"
+#include "Managers/BsTextureManager.h"
+#include "Managers/BsTextureStreamingManager.h"
+#include "RenderAPI/BsGpuParamBlockBuffer.h"
+#include "Renderer/BsGpuParamBlockArena.h"
+#include "Renderer/BsGpuResourcePool.h"
+#include "Renderer/BsParallelCommandRecorder.h"
+#include "RenderAPI/BsCommandBuffer.h"
+#include "RenderAPI/BsRenderAPICapture.h"
+#include "RenderAPI/BsGpuParams.h"
+#include "RenderAPI/BsGpuParamDesc.h"
+#include "RenderAPI/BsGpuPipelineParamInfo.h"
+#include "Managers/BsRenderStateManager.h"
+#include "Managers/BsGpuReadbackManager.h"
+#include "RenderAPI/BsVertexBuffer.h"
+#include "RenderAPI/BsIndexBuffer.h"
+#include "Math/BsConvexVolume.h"
+#include "Profiling/BsRenderStats.h"
+#include "Profiling/BsProfilerGPU.h"
+#include "Renderer/BsRenderer.h"
+#include "Utility/BsTime.h"
+#include "BsNullRenderAPI.h"
+#include "BsNullTexture.h"
+#include "BsNullBuffers.h"
+#include "BsNullCommandBuffer.h"
+#include "BsNullQueries.h"
 
 namespace bs
 {
@@ -17,20 +77,329 @@ namespace bs
 		return acceleration * time;
 	}
 
+	enum
+	{
+		TID_UpdateTestComponentA = 200000,
+		TID_UpdateTestComponentB = 200001,
+		TID_ArchiveTestResource = 200002,
+		TID_CloneTestComponent = 200003
+	};
+
+	/** Component that counts the update calls it receives, and optionally logs the order of the update() calls. */
+	template<UINT32 TypeId>
+	class UpdateTestComponent : public Component
+	{
+	public:
+		UpdateTestComponent(const HSceneObject& parent, ComponentFlags flags, Vector<UINT32>* updateLog = nullptr)
+			:Component(parent), mUpdateLog(updateLog)
+		{
+			mFlags = flags;
+		}
+
+		void update() override
+		{
+			// Some work, so the update isn't entirely dominated by call overhead
+			for(UINT32 i = 0; i < 8; i++)
+				value = value * 0.5f + (float)i;
+
+			numUpdates++;
+
+			if(mUpdateLog)
+				mUpdateLog->push_back(TypeId);
+		}
+
+		void fixedUpdate() override { numFixedUpdates++; }
+
+		UINT32 numUpdates = 0;
+		UINT32 numFixedUpdates = 0;
+		float value = 0.0f;
+
+		static RTTITypeBase* getRTTIStatic();
+		RTTITypeBase* getRTTI() const override { return getRTTIStatic(); }
+
+	private:
+		Vector<UINT32>* mUpdateLog;
+	};
+
+	template<UINT32 TypeId>
+	class UpdateTestComponentRTTI :
+		public RTTIType<UpdateTestComponent<TypeId>, Component, UpdateTestComponentRTTI<TypeId>>
+	{
+	public:
+		const String& getRTTIName() override
+		{
+			static String name = "UpdateTestComponent" + toString(TypeId);
+			return name;
+		}
+
+		UINT32 getRTTIId() override { return TypeId; }
+		SPtr<IReflectable> newRTTIObject() override { return nullptr; }
+	};
+
+	template<UINT32 TypeId>
+	RTTITypeBase* UpdateTestComponent<TypeId>::getRTTIStatic()
+	{
+		return UpdateTestComponentRTTI<TypeId>::instance();
+	}
+
+	using UpdateTestComponentA = UpdateTestComponent<TID_UpdateTestComponentA>;
+	using UpdateTestComponentB = UpdateTestComponent<TID_UpdateTestComponentB>;
+
+	/** Component referencing other game objects, used for testing handle resolution when cloning. */
+	class CloneTestComponent : public Component
+	{
+	public:
+		CloneTestComponent() = default; // Serialization only
+
+		CloneTestComponent(const HSceneObject& parent)
+			:Component(parent)
+		{ }
+
+		HSceneObject target;
+		HComponent targetComponent;
+		HSceneObject external;
+
+		static RTTITypeBase* getRTTIStatic();
+		RTTITypeBase* getRTTI() const override { return getRTTIStatic(); }
+	};
+
+	class CloneTestComponentRTTI : public RTTIType<CloneTestComponent, Component, CloneTestComponentRTTI>
+	{
+	private:
+		BS_BEGIN_RTTI_MEMBERS
+			BS_RTTI_MEMBER_REFL(target, 0)
+			BS_RTTI_MEMBER_REFL(targetComponent, 1)
+			BS_RTTI_MEMBER_REFL(external, 2)
+		BS_END_RTTI_MEMBERS
+
+	public:
+		const String& getRTTIName() override
+		{
+			static String name = "CloneTestComponent";
+			return name;
+		}
+
+		UINT32 getRTTIId() override { return TID_CloneTestComponent; }
+		SPtr<IReflectable> newRTTIObject() override { return SceneObject::createEmptyComponent<CloneTestComponent>(); }
+	};
+
+	RTTITypeBase* CloneTestComponent::getRTTIStatic()
+	{
+		return CloneTestComponentRTTI::instance();
+	}
+
+	/** Resource containing a string of data, used for testing resource loading. */
+	class ArchiveTestResource : public Resource
+	{
+	public:
+		ArchiveTestResource()
+			:Resource(false)
+		{ }
+
+		/** Creates a new resource with the provided data and registers it with the resource system. */
+		static HResource create(const String& data)
+		{
+			SPtr<ArchiveTestResource> resource = _createPtr();
+			resource->data = data;
+
+			return gResources()._createResourceHandle(resource);
+		}
+
+		/** Creates a new resource without registering it with the resource system. */
+		static SPtr<ArchiveTestResource> _createPtr()
+		{
+			SPtr<ArchiveTestResource> resource = bs_core_ptr<ArchiveTestResource>(
+				new (bs_alloc<ArchiveTestResource>()) ArchiveTestResource());
+			resource->_setThisPtr(resource);
+			resource->initialize();
+
+			return resource;
+		}
+
+		String data;
+
+		static RTTITypeBase* getRTTIStatic();
+		RTTITypeBase* getRTTI() const override { return getRTTIStatic(); }
+	};
+
+	class ArchiveTestResourceRTTI : public RTTIType<ArchiveTestResource, Resource, ArchiveTestResourceRTTI>
+	{
+	private:
+		String& getData(ArchiveTestResource* obj) { return obj->data; }
+		void setData(ArchiveTestResource* obj, String& val) { obj->data = val; }
+
+	public:
+		ArchiveTestResourceRTTI()
+		{
+			addPlainField("data", 0, &ArchiveTestResourceRTTI::getData, &ArchiveTestResourceRTTI::setData);
+		}
+
+		const String& getRTTIName() override
+		{
+			static String name = "ArchiveTestResource";
+			return name;
+		}
+
+		UINT32 getRTTIId() override { return TID_ArchiveTestResource; }
+		SPtr<IReflectable> newRTTIObject() override { return ArchiveTestResource::_createPtr(); }
+	};
+
+	RTTITypeBase* ArchiveTestResource::getRTTIStatic()
+	{
+		return ArchiveTestResourceRTTI::instance();
+	}
+
+	/** Renderer that doesn't render anything, used for executing renderer tasks. */
+	class TaskTestRenderer : public ct::Renderer
+	{
+	public:
+		const StringID& getName() const override
+		{
+			static StringID name = "TaskTestRenderer";
+			return name;
+		}
+
+		void renderAll(PerFrameData perFrameData) override { }
+
+		void captureSceneCubeMap(const SPtr<ct::Texture>& cubemap, const Vector3& position,
+			const ct::CaptureSettings& settings) override { }
+
+		using Renderer::processTasks;
+	};
+
 	class CoreTestSuite : public TestSuite
 	{
 	public:
 		CoreTestSuite();
 
 	private:
+		void startUp() override;
+		void shutDown() override;
+
 		void testAnimCurveIntegration();
 		void testLookupTable();
+		void testMeshOptimization();
+		void testMeshLOD();
+		void testMeshQuantization();
+		void testSkeletonPose();
+		void testAnimationLOD();
+		void testMorphShapeBlending();
+		void testSystemGraph();
+		void testFramePacing();
+		void testComponentUpdates();
+		void testGameObjectSlots();
+		void testCloneMultiple();
+		void testResourceArchive();
+		void testTextureStreaming();
+		void testParamBlockArena();
+		void testResourcePoolAliasing();
+		void testParallelCommandRecording();
+		void testRenderAPICapture();
+		void testRenderStateCache();
+		void testRendererTaskTimeSlicing();
+		void testGpuReadback();
 	};
 
 	CoreTestSuite::CoreTestSuite()
 	{
 		BS_ADD_TEST(CoreTestSuite::testAnimCurveIntegration);
 		BS_ADD_TEST(CoreTestSuite::testLookupTable);
+		BS_ADD_TEST(CoreTestSuite::testMeshOptimization);
+		BS_ADD_TEST(CoreTestSuite::testMeshLOD);
+		BS_ADD_TEST(CoreTestSuite::testMeshQuantization);
+		BS_ADD_TEST(CoreTestSuite::testSkeletonPose);
+		BS_ADD_TEST(CoreTestSuite::testAnimationLOD);
+		BS_ADD_TEST(CoreTestSuite::testMorphShapeBlending);
+		BS_ADD_TEST(CoreTestSuite::testSystemGraph);
+		BS_ADD_TEST(CoreTestSuite::testFramePacing);
+		BS_ADD_TEST(CoreTestSuite::testComponentUpdates);
+		BS_ADD_TEST(CoreTestSuite::testGameObjectSlots);
+		BS_ADD_TEST(CoreTestSuite::testCloneMultiple);
+		BS_ADD_TEST(CoreTestSuite::testResourceArchive);
+		BS_ADD_TEST(CoreTestSuite::testTextureStreaming);
+		BS_ADD_TEST(CoreTestSuite::testParamBlockArena);
+		BS_ADD_TEST(CoreTestSuite::testResourcePoolAliasing);
+		BS_ADD_TEST(CoreTestSuite::testParallelCommandRecording);
+		BS_ADD_TEST(CoreTestSuite::testRenderAPICapture);
+		BS_ADD_TEST(CoreTestSuite::testRenderStateCache);
+		BS_ADD_TEST(CoreTestSuite::testRendererTaskTimeSlicing);
+		BS_ADD_TEST(CoreTestSuite::testGpuReadback);
+	}
+
+	void CoreTestSuite::startUp()
+	{
+		// Modules can't be restarted once shut down, so they are shared between all tests
+		ThreadPool::startUp<TThreadPool<ThreadDefaultPolicy>>(BS_THREAD_HARDWARE_CONCURRENCY + 4);
+		TaskScheduler::startUp();
+		Time::startUp();
+		RenderStats::startUp();
+		GameObjectManager::startUp();
+		SceneManager::startUp();
+		CoreThread::startUp();
+		CoreObjectManager::startUp();
+		Resources::startUp();
+
+		// Null render API doesn't store any texture data, but is enough for tracking which mip levels are resident
+		ct::RenderAPI::startUp<ct::NullRenderAPI>();
+		TextureManager::startUp<NullTextureManager>();
+		gCoreThread().queueCommand([]() { ct::TextureManager::startUp<ct::NullTextureManager>(); },
+			CTQF_InternalQueue | CTQF_BlockUntilComplete);
+
+		HardwareBufferManager::startUp();
+		gCoreThread().queueCommand([]() { ct::HardwareBufferManager::startUp<ct::NullHardwareBufferManager>(); },
+			CTQF_InternalQueue | CTQF_BlockUntilComplete);
+
+		gCoreThread().queueCommand([]() { ct::CommandBufferManager::startUp<ct::NullCommandBufferManager>(); },
+			CTQF_InternalQueue | CTQF_BlockUntilComplete);
+
+		gCoreThread().queueCommand([]() { ct::RenderStateManager::startUp(); },
+			CTQF_InternalQueue | CTQF_BlockUntilComplete);
+
+		gCoreThread().queueCommand([]() { ct::QueryManager::startUp<ct::NullQueryManager>(); },
+			CTQF_InternalQueue | CTQF_BlockUntilComplete);
+		gCoreThread().queueCommand([]() { ct::GpuReadbackManager::startUp(); },
+			CTQF_InternalQueue | CTQF_BlockUntilComplete);
+		ProfilerGPU::startUp();
+
+		TEXTURE_STREAMING_DESC streamingDesc;
+		streamingDesc.evictionDelay = 5;
+		TextureStreamingManager::startUp(streamingDesc);
+	}
+
+	void CoreTestSuite::shutDown()
+	{
+		TextureStreamingManager::shutDown();
+		Resources::shutDown();
+
+		ProfilerGPU::shutDown();
+		gCoreThread().queueCommand([]() { ct::GpuReadbackManager::shutDown(); },
+			CTQF_InternalQueue | CTQF_BlockUntilComplete);
+		gCoreThread().queueCommand([]() { ct::QueryManager::shutDown(); },
+			CTQF_InternalQueue | CTQF_BlockUntilComplete);
+
+		gCoreThread().queueCommand([]() { ct::RenderStateManager::shutDown(); },
+			CTQF_InternalQueue | CTQF_BlockUntilComplete);
+
+		gCoreThread().queueCommand([]() { ct::CommandBufferManager::shutDown(); },
+			CTQF_InternalQueue | CTQF_BlockUntilComplete);
+
+		gCoreThread().queueCommand([]() { ct::HardwareBufferManager::shutDown(); },
+			CTQF_InternalQueue | CTQF_BlockUntilComplete);
+		HardwareBufferManager::shutDown();
+
+		gCoreThread().queueCommand([]() { ct::TextureManager::shutDown(); },
+			CTQF_InternalQueue | CTQF_BlockUntilComplete);
+		TextureManager::shutDown();
+		ct::RenderAPI::shutDown();
+
+		CoreObjectManager::shutDown();
+		CoreThread::shutDown();
+		SceneManager::shutDown();
+		GameObjectManager::shutDown();
+		RenderStats::shutDown();
+		Time::shutDown();
+		TaskScheduler::shutDown();
+		ThreadPool::shutDown();
 	}
 
 	void CoreTestSuite::testAnimCurveIntegration()
@@ -143,6 +512,3249 @@ namespace bs
 				BS_TEST_ASSERT(Math::approxEquals(valueLookup[j], valueCurve[j], EPSILON));
 		}
 	}
+
+	void CoreTestSuite::testMeshOptimization()
+	{
+		static constexpr UINT32 GRID_SIZE = 64;
+		static constexpr UINT32 NUM_DEGENERATES = 60;
+
+		// Grid where each quad has its own vertices, with the triangles in random order
+		UINT32 numQuads = GRID_SIZE * GRID_SIZE;
+		UINT32 numTris = numQuads * 2 + NUM_DEGENERATES;
+		UINT32 numVertices = numQuads * 4;
+
+		SPtr<VertexDataDesc> vertexDesc = VertexDataDesc::create();
+		vertexDesc->addVertElem(VET_FLOAT3, VES_POSITION);
+		vertexDesc->addVertElem(VET_FLOAT2, VES_TEXCOORD);
+
+		SPtr<MeshData> meshData = MeshData::create(numVertices, numTris * 3, vertexDesc, IT_32BIT);
+		auto positionIter = meshData->getVec3DataIter(VES_POSITION);
+		auto uvIter = meshData->getVec2DataIter(VES_TEXCOORD);
+
+		for(UINT32 y = 0; y < GRID_SIZE; y++)
+		{
+			for(UINT32 x = 0; x < GRID_SIZE; x++)
+			{
+				for(UINT32 i = 0; i < 4; i++)
+				{
+					float posX = (float)(x + (i & 1));
+					float posY = (float)(y + (i >> 1));
+
+					positionIter.addValue(Vector3(posX, posY, 0.0f));
+					uvIter.addValue(Vector2(posX / GRID_SIZE, posY / GRID_SIZE));
+				}
+			}
+		}
+
+		Vector<UINT32> triangles;
+		for(UINT32 i = 0; i < numQuads; i++)
+		{
+			UINT32 base = i * 4;
+			triangles.insert(triangles.end(), { base + 0, base + 2, base + 1 });
+			triangles.insert(triangles.end(), { base + 1, base + 2, base + 3 });
+		}
+
+		// Degenerate triangles, either sharing an index or a position with another vertex
+		for(UINT32 i = 0; i < NUM_DEGENERATES; i++)
+		{
+			UINT32 base = i * 4;
+			if(i % 2 == 0)
+				triangles.insert(triangles.end(), { base + 0, base + 0, base + 1 });
+			else
+				triangles.insert(triangles.end(), { base + 1, base + 4, base + 2 });
+		}
+
+		Random random(1234);
+		for(UINT32 i = numTris - 1; i > 0; i--)
+		{
+			UINT32 j = random.getRange(0, i);
+			for(UINT32 k = 0; k < 3; k++)
+				std::swap(triangles[i * 3 + k], triangles[j * 3 + k]);
+		}
+
+		memcpy(meshData->getIndices32(), triangles.data(), triangles.size() * sizeof(UINT32));
+
+		MeshEfficiencyStats before = MeshUtility::calculateEfficiency(meshData);
+
+		Vector<SubMesh> subMeshes = { SubMesh(0, numTris * 3, DOT_TRIANGLE_LIST) };
+		Vector<UINT32> vertexRemap;
+		SPtr<MeshData> optimized = MeshUtility::optimize(meshData, subMeshes, MeshOptimizationFlag::All, &vertexRemap);
+
+		MeshEfficiencyStats after = MeshUtility::calculateEfficiency(optimized);
+
+		BS_LOG(Info, Generic, "Mesh optimization - ACMR: {0} -> {1}, ATVR: {2} -> {3}, fetch ratio: {4} -> {5}",
+			before.acmr, after.acmr, before.atvr, after.atvr, before.fetchRatio, after.fetchRatio);
+
+		// Welding should leave a single vertex per grid point
+		BS_TEST_ASSERT(optimized->getNumVertices() == (GRID_SIZE + 1) * (GRID_SIZE + 1));
+		BS_TEST_ASSERT(vertexRemap.size() == numVertices);
+
+		// Degenerates should be removed
+		BS_TEST_ASSERT(optimized->getNumIndices() == numQuads * 2 * 3);
+		BS_TEST_ASSERT(subMeshes.size() == 1);
+		BS_TEST_ASSERT(subMeshes[0].indexOffset == 0 && subMeshes[0].indexCount == numQuads * 2 * 3);
+
+		BS_TEST_ASSERT(after.acmr < before.acmr);
+		BS_TEST_ASSERT(after.acmr < 1.0f);
+		BS_TEST_ASSERT(after.atvr < 1.5f);
+		BS_TEST_ASSERT(after.fetchRatio <= before.fetchRatio);
+
+		// Make sure the optimized triangles reference the same positions as the original ones
+		UINT32* indices = optimized->getIndices32();
+		auto optimizedPositionIter = optimized->getVec3DataIter(VES_POSITION);
+
+		Vector<Vector3> positions(optimized->getNumVertices());
+		for(UINT32 i = 0; i < optimized->getNumVertices(); i++)
+		{
+			positions[i] = optimizedPositionIter.getValue();
+			optimizedPositionIter.moveNext();
+		}
+
+		float area = 0.0f;
+		for(UINT32 i = 0; i < optimized->getNumIndices(); i += 3)
+		{
+			const Vector3& p0 = positions[indices[i + 0]];
+			const Vector3& p1 = positions[indices[i + 1]];
+			const Vector3& p2 = positions[indices[i + 2]];
+
+			Vector3 normal = (p1 - p0).cross(p2 - p0);
+			BS_TEST_ASSERT(normal.z < 0.0f);
+
+			area += normal.length() * 0.5f;
+		}
+
+		BS_TEST_ASSERT(Math::approxEquals(area, (float)numQuads));
+	}
+
+	void CoreTestSuite::testMeshLOD()
+	{
+		static constexpr UINT32 NUM_LODS = 3;
+
+		auto readPositions = [](const SPtr<MeshData>& meshData)
+		{
+			Vector<Vector3> positions(meshData->getNumVertices());
+
+			auto iter = meshData->getVec3DataIter(VES_POSITION);
+			for(UINT32 i = 0; i < meshData->getNumVertices(); i++)
+			{
+				positions[i] = iter.getValue();
+				iter.moveNext();
+			}
+
+			return positions;
+		};
+
+		auto calcArea = [](const Vector<Vector3>& positions, const UINT32* indices, const SubMesh& subMesh)
+		{
+			float area = 0.0f;
+			for(UINT32 i = subMesh.indexOffset; i < subMesh.indexOffset + subMesh.indexCount; i += 3)
+			{
+				const Vector3& p0 = positions[indices[i + 0]];
+				const Vector3& p1 = positions[indices[i + 1]];
+				const Vector3& p2 = positions[indices[i + 2]];
+
+				area += (p1 - p0).cross(p2 - p0).length() * 0.5f;
+			}
+
+			return area;
+		};
+
+		SPtr<VertexDataDesc> vertexDesc = VertexDataDesc::create();
+		vertexDesc->addVertElem(VET_FLOAT3, VES_POSITION);
+
+		// Closed sphere, with shared vertices along the seam and at the poles
+		{
+			static constexpr UINT32 NUM_RINGS = 48;
+			static constexpr UINT32 NUM_SEGMENTS = 64;
+
+			UINT32 numVertices = (NUM_RINGS - 1) * NUM_SEGMENTS + 2;
+			UINT32 numTris = NUM_SEGMENTS * 2 + (NUM_RINGS - 2) * NUM_SEGMENTS * 2;
+
+			SPtr<MeshData> meshData = MeshData::create(numVertices, numTris * 3, vertexDesc, IT_32BIT);
+			auto positionIter = meshData->getVec3DataIter(VES_POSITION);
+
+			for(UINT32 ring = 1; ring < NUM_RINGS; ring++)
+			{
+				Radian theta(Math::PI * ring / (float)NUM_RINGS);
+				for(UINT32 segment = 0; segment < NUM_SEGMENTS; segment++)
+				{
+					Radian phi(Math::TWO_PI * segment / (float)NUM_SEGMENTS);
+					positionIter.addValue(Vector3(Math::sin(theta) * Math::cos(phi), Math::cos(theta),
+						Math::sin(theta) * Math::sin(phi)));
+				}
+			}
+
+			UINT32 topPole = numVertices - 2;
+			UINT32 bottomPole = numVertices - 1;
+			positionIter.addValue(Vector3(0.0f, 1.0f, 0.0f));
+			positionIter.addValue(Vector3(0.0f, -1.0f, 0.0f));
+
+			auto vertexIdx = [](UINT32 ring, UINT32 segment) { return ring * NUM_SEGMENTS + segment % NUM_SEGMENTS; };
+
+			UINT32* indices = meshData->getIndices32();
+			for(UINT32 segment = 0; segment < NUM_SEGMENTS; segment++)
+			{
+				*indices++ = topPole;
+				*indices++ = vertexIdx(0, segment + 1);
+				*indices++ = vertexIdx(0, segment);
+
+				*indices++ = bottomPole;
+				*indices++ = vertexIdx(NUM_RINGS - 2, segment);
+				*indices++ = vertexIdx(NUM_RINGS - 2, segment + 1);
+			}
+
+			for(UINT32 ring = 0; ring < NUM_RINGS - 2; ring++)
+			{
+				for(UINT32 segment = 0; segment < NUM_SEGMENTS; segment++)
+				{
+					*indices++ = vertexIdx(ring, segment);
+					*indices++ = vertexIdx(ring, segment + 1);
+					*indices++ = vertexIdx(ring + 1, segment);
+
+					*indices++ = vertexIdx(ring + 1, segment);
+					*indices++ = vertexIdx(ring, segment + 1);
+					*indices++ = vertexIdx(ring + 1, segment + 1);
+				}
+			}
+
+			Vector<SubMesh> subMeshes = { SubMesh(0, numTris * 3, DOT_TRIANGLE_LIST) };
+			Vector<MeshLOD> lods;
+			SPtr<MeshData> output = MeshUtility::generateLODs(meshData, subMeshes, NUM_LODS, 0.5f, lods);
+
+			BS_TEST_ASSERT(lods.size() == NUM_LODS);
+			BS_TEST_ASSERT(output->getNumVertices() == numVertices);
+
+			Vector<Vector3> positions = readPositions(output);
+			float baseArea = calcArea(positions, output->getIndices32(), subMeshes[0]);
+
+			UINT32 prevNumTris = numTris;
+			float prevScreenSize = std::numeric_limits<float>::infinity();
+			for(UINT32 i = 0; i < NUM_LODS; i++)
+			{
+				BS_TEST_ASSERT(lods[i].subMeshes.size() == 1);
+
+				// Triangle budget must be respected, within the granularity of a single pass of collapses
+				const SubMesh& subMesh = lods[i].subMeshes[0];
+				UINT32 lodNumTris = subMesh.indexCount / 3;
+				UINT32 targetNumTris = prevNumTris / 2;
+
+				BS_TEST_ASSERT(lodNumTris <= targetNumTris);
+				BS_TEST_ASSERT(lodNumTris >= targetNumTris * 9 / 10);
+				BS_TEST_ASSERT(subMesh.indexOffset + subMesh.indexCount <= output->getNumIndices());
+
+				// Sphere shape should be preserved
+				float area = calcArea(positions, output->getIndices32(), subMesh);
+				BS_TEST_ASSERT(area > baseArea * 0.9f && area <= baseArea * 1.001f);
+
+				BS_TEST_ASSERT(lods[i].screenSize < prevScreenSize);
+
+				BS_LOG(Info, Generic, "Sphere LOD {0}: {1} triangles, surface area {2}% of original", i + 1, lodNumTris,
+					area / baseArea * 100.0f);
+
+				prevNumTris = lodNumTris;
+				prevScreenSize = lods[i].screenSize;
+			}
+
+			// Base indices must remain untouched
+			BS_TEST_ASSERT(memcmp(output->getIndices32(), meshData->getIndices32(), numTris * 3 * sizeof(UINT32)) == 0);
+		}
+
+		// Sphere with UV seams, with separate vertices on each side of the seam and for each triangle at the poles
+		{
+			static constexpr UINT32 NUM_RINGS = 48;
+			static constexpr UINT32 NUM_SEGMENTS = 64;
+
+			SPtr<VertexDataDesc> uvVertexDesc = VertexDataDesc::create();
+			uvVertexDesc->addVertElem(VET_FLOAT3, VES_POSITION);
+			uvVertexDesc->addVertElem(VET_FLOAT2, VES_TEXCOORD);
+
+			UINT32 numVertices = (NUM_RINGS + 1) * (NUM_SEGMENTS + 1);
+			UINT32 numTris = NUM_SEGMENTS * 2 + (NUM_RINGS - 2) * NUM_SEGMENTS * 2;
+
+			SPtr<MeshData> meshData = MeshData::create(numVertices, numTris * 3, uvVertexDesc, IT_32BIT);
+			auto positionIter = meshData->getVec3DataIter(VES_POSITION);
+			auto uvIter = meshData->getVec2DataIter(VES_TEXCOORD);
+
+			for(UINT32 ring = 0; ring <= NUM_RINGS; ring++)
+			{
+				Radian theta(Math::PI * ring / (float)NUM_RINGS);
+				for(UINT32 segment = 0; segment <= NUM_SEGMENTS; segment++)
+				{
+					// Avoid round-off so the vertices on both sides of the seam end up in the same position
+					Radian phi(Math::TWO_PI * (segment % NUM_SEGMENTS) / (float)NUM_SEGMENTS);
+					if(ring == 0 || ring == NUM_RINGS)
+						positionIter.addValue(Vector3(0.0f, ring == 0 ? 1.0f : -1.0f, 0.0f));
+					else
+					{
+						positionIter.addValue(Vector3(Math::sin(theta) * Math::cos(phi), Math::cos(theta),
+							Math::sin(theta) * Math::sin(phi)));
+					}
+
+					uvIter.addValue(Vector2(segment / (float)NUM_SEGMENTS, ring / (float)NUM_RINGS));
+				}
+			}
+
+			auto vertexIdx = [](UINT32 ring, UINT32 segment) { return ring * (NUM_SEGMENTS + 1) + segment; };
+
+			UINT32* indices = meshData->getIndices32();
+			for(UINT32 ring = 0; ring < NUM_RINGS; ring++)
+			{
+				for(UINT32 segment = 0; segment < NUM_SEGMENTS; segment++)
+				{
+					if(ring != 0)
+					{
+						*indices++ = vertexIdx(ring, segment);
+						*indices++ = vertexIdx(ring, segment + 1);
+						*indices++ = vertexIdx(ring + 1, segment);
+					}
+
+					if(ring != NUM_RINGS - 1)
+					{
+						*indices++ = vertexIdx(ring + 1, segment);
+						*indices++ = vertexIdx(ring, segment + 1);
+						*indices++ = vertexIdx(ring + 1, segment + 1);
+					}
+				}
+			}
+
+			Vector<SubMesh> subMeshes = { SubMesh(0, numTris * 3, DOT_TRIANGLE_LIST) };
+			Vector<MeshLOD> lods;
+			SPtr<MeshData> output = MeshUtility::generateLODs(meshData, subMeshes, NUM_LODS, 0.5f, lods);
+
+			Vector<Vector3> positions = readPositions(output);
+			float baseArea = calcArea(positions, output->getIndices32(), subMeshes[0]);
+
+			auto isSeamVertex = [](UINT32 vertexIdx) { return vertexIdx % (NUM_SEGMENTS + 1) == NUM_SEGMENTS; };
+
+			// Maps all the vertices sharing a position to the same index
+			auto weldedIdx = [&vertexIdx](UINT32 idx)
+			{
+				UINT32 ring = idx / (NUM_SEGMENTS + 1);
+				if(ring == 0 || ring == NUM_RINGS)
+					return vertexIdx(ring, 0);
+
+				return vertexIdx(ring, idx % (NUM_SEGMENTS + 1) % NUM_SEGMENTS);
+			};
+
+			UINT32 prevNumTris = numTris;
+			UINT32 prevNumSeamVertices = NUM_RINGS - 1;
+			for(UINT32 i = 0; i < NUM_LODS; i++)
+			{
+				// Seams must not prevent the mesh from being simplified
+				const SubMesh& subMesh = lods[i].subMeshes[0];
+				UINT32 lodNumTris = subMesh.indexCount / 3;
+				UINT32 targetNumTris = prevNumTris / 2;
+
+				BS_TEST_ASSERT(lodNumTris <= targetNumTris);
+				BS_TEST_ASSERT(lodNumTris >= targetNumTris * 9 / 10);
+
+				float area = calcArea(positions, output->getIndices32(), subMesh);
+				BS_TEST_ASSERT(area > baseArea * 0.9f && area <= baseArea * 1.001f);
+
+				// Seam must be simplified along with the rest of the mesh, but remain closed
+				const UINT32* lodIndices = output->getIndices32() + subMesh.indexOffset;
+
+				UnorderedSet<UINT32> seamVertices;
+				UnorderedMap<UINT64, INT32> edges;
+				for(UINT32 j = 0; j < subMesh.indexCount; j += 3)
+				{
+					for(UINT32 k = 0; k < 3; k++)
+					{
+						UINT32 a = lodIndices[j + k];
+						UINT32 b = lodIndices[j + (k + 1) % 3];
+
+						if(isSeamVertex(a))
+							seamVertices.insert(a);
+
+						edges[((UINT64)weldedIdx(a) << 32) | weldedIdx(b)]++;
+						edges[((UINT64)weldedIdx(b) << 32) | weldedIdx(a)]--;
+					}
+				}
+
+				bool isClosed = true;
+				for(auto& entry : edges)
+					isClosed &= entry.second == 0;
+
+				BS_TEST_ASSERT(isClosed);
+				BS_TEST_ASSERT((UINT32)seamVertices.size() < prevNumSeamVertices);
+
+				BS_LOG(Info, Generic, "UV sphere LOD {0}: {1} triangles, {2} seam vertices", i + 1, lodNumTris,
+					(UINT32)seamVertices.size());
+
+				prevNumTris = lodNumTris;
+				prevNumSeamVertices = (UINT32)seamVertices.size();
+			}
+		}
+
+		// Flat grid, border must be preserved
+		{
+			static constexpr UINT32 GRID_SIZE = 32;
+
+			UINT32 numVertices = (GRID_SIZE + 1) * (GRID_SIZE + 1);
+			UINT32 numTris = GRID_SIZE * GRID_SIZE * 2;
+
+			SPtr<MeshData> meshData = MeshData::create(numVertices, numTris * 3, vertexDesc, IT_16BIT);
+			auto positionIter = meshData->getVec3DataIter(VES_POSITION);
+
+			for(UINT32 y = 0; y <= GRID_SIZE; y++)
+			{
+				for(UINT32 x = 0; x <= GRID_SIZE; x++)
+					positionIter.addValue(Vector3((float)x, (float)y, 0.0f));
+			}
+
+			UINT16* indices = meshData->getIndices16();
+			for(UINT32 y = 0; y < GRID_SIZE; y++)
+			{
+				for(UINT32 x = 0; x < GRID_SIZE; x++)
+				{
+					UINT16 base = (UINT16)(y * (GRID_SIZE + 1) + x);
+
+					*indices++ = base;
+					*indices++ = base + GRID_SIZE + 1;
+					*indices++ = base + 1;
+
+					*indices++ = base + 1;
+					*indices++ = base + GRID_SIZE + 1;
+					*indices++ = base + GRID_SIZE + 2;
+				}
+			}
+
+			Vector<MeshLOD> lods;
+			SPtr<MeshData> output = MeshUtility::generateLODs(meshData, {}, NUM_LODS, 0.25f, lods);
+
+			Vector<Vector3> positions = readPositions(output);
+			Vector<UINT32> outputIndices(output->getNumIndices());
+			for(UINT32 i = 0; i < output->getNumIndices(); i++)
+				outputIndices[i] = output->getIndices16()[i];
+
+			UINT32 prevNumTris = numTris;
+			for(UINT32 i = 0; i < NUM_LODS; i++)
+			{
+				const SubMesh& subMesh = lods[i].subMeshes[0];
+				BS_TEST_ASSERT(subMesh.indexCount / 3 <= prevNumTris / 4);
+
+				float area = calcArea(positions, outputIndices.data(), subMesh);
+				BS_TEST_ASSERT(Math::approxEquals(area, (float)(GRID_SIZE * GRID_SIZE), 0.01f));
+
+				for(UINT32 j = subMesh.indexOffset; j < subMesh.indexOffset + subMesh.indexCount; j += 3)
+				{
+					const Vector3& p0 = positions[outputIndices[j + 0]];
+					const Vector3& p1 = positions[outputIndices[j + 1]];
+					const Vector3& p2 = positions[outputIndices[j + 2]];
+
+					BS_TEST_ASSERT((p1 - p0).cross(p2 - p0).z < 0.0f);
+				}
+
+				prevNumTris = subMesh.indexCount / 3;
+			}
+		}
+
+		// Level of detail selection
+		{
+			Vector<SubMesh> subMeshes = { SubMesh(0, 300, DOT_TRIANGLE_LIST) };
+			Vector<MeshLOD> lods(NUM_LODS);
+			lods[0].subMeshes = { SubMesh(300, 150, DOT_TRIANGLE_LIST) };
+			lods[0].screenSize = 0.5f;
+			lods[1].subMeshes = { SubMesh(450, 75, DOT_TRIANGLE_LIST) };
+			lods[1].screenSize = 0.25f;
+			lods[2].subMeshes = { SubMesh(525, 36, DOT_TRIANGLE_LIST) };
+			lods[2].screenSize = 0.125f;
+
+			MeshProperties props(100, 561, subMeshes, lods);
+			BS_TEST_ASSERT(props.getNumLODs() == NUM_LODS + 1);
+
+			BS_TEST_ASSERT(props.selectLOD(std::numeric_limits<float>::infinity()) == 0);
+			BS_TEST_ASSERT(props.selectLOD(1.0f) == 0);
+			BS_TEST_ASSERT(props.selectLOD(0.5f) == 0);
+			BS_TEST_ASSERT(props.selectLOD(0.49f) == 1);
+			BS_TEST_ASSERT(props.selectLOD(0.25f) == 1);
+			BS_TEST_ASSERT(props.selectLOD(0.2f) == 2);
+			BS_TEST_ASSERT(props.selectLOD(0.1f) == 3);
+			BS_TEST_ASSERT(props.selectLOD(0.0f) == 3);
+
+			BS_TEST_ASSERT(props.getSubMesh(0, 0).indexOffset == 0);
+			BS_TEST_ASSERT(props.getSubMesh(0, 2).indexOffset == 450);
+			BS_TEST_ASSERT(props.getSubMesh(0, 10).indexOffset == 525);
+			BS_TEST_ASSERT(props.getLODScreenSize(1) == 0.5f);
+
+			MeshProperties noLODProps(100, 300, subMeshes);
+			BS_TEST_ASSERT(noLODProps.getNumLODs() == 1);
+			BS_TEST_ASSERT(noLODProps.selectLOD(0.0f) == 0);
+			BS_TEST_ASSERT(noLODProps.getSubMesh(0, 2).indexOffset == 0);
+		}
+	}
+
+	void CoreTestSuite::testMeshQuantization()
+	{
+		static constexpr UINT32 NUM_VERTICES = 4096;
+
+		SPtr<VertexDataDesc> vertexDesc = VertexDataDesc::create();
+		vertexDesc->addVertElem(VET_FLOAT3, VES_POSITION);
+		vertexDesc->addVertElem(VET_FLOAT3, VES_NORMAL);
+		vertexDesc->addVertElem(VET_FLOAT4, VES_TANGENT);
+		vertexDesc->addVertElem(VET_FLOAT2, VES_TEXCOORD);
+
+		SPtr<MeshData> meshData = MeshData::create(NUM_VERTICES, NUM_VERTICES, vertexDesc, IT_32BIT);
+
+		// Mesh placed away from the origin, with a different extent along each axis
+		const Vector3 boundsMin(100.0f, -20.0f, 5.0f);
+		const Vector3 boundsExtent(50.0f, 3.0f, 0.25f);
+
+		Random random(1234);
+		auto positionIter = meshData->getVec3DataIter(VES_POSITION);
+		auto normalIter = meshData->getVec3DataIter(VES_NORMAL);
+		auto tangentIter = meshData->getVec4DataIter(VES_TANGENT);
+		auto uvIter = meshData->getVec2DataIter(VES_TEXCOORD);
+		UINT32* indices = meshData->getIndices32();
+		for(UINT32 i = 0; i < NUM_VERTICES; i++)
+		{
+			positionIter.addValue(boundsMin + Vector3(random.getUNorm(), random.getUNorm(), random.getUNorm()) *
+				boundsExtent);
+			normalIter.addValue(random.getUnitVector());
+
+			Vector3 tangent = random.getUnitVector();
+			tangentIter.addValue(Vector4(tangent.x, tangent.y, tangent.z, random.getUNorm() < 0.5f ? -1.0f : 1.0f));
+			uvIter.addValue(Vector2(random.getUNorm() * 4.0f, random.getSNorm()));
+
+			indices[i] = NUM_VERTICES - i - 1;
+		}
+
+		PositionQuantization positionQuantization;
+		SPtr<MeshData> quantized = MeshUtility::quantize(meshData, MeshQuantizationFlag::All, positionQuantization);
+
+		SPtr<VertexDataDesc> quantizedDesc = quantized->getVertexDesc();
+		BS_TEST_ASSERT(quantizedDesc->getElement(VES_POSITION)->getType() == VET_USHORT4_NORM);
+		BS_TEST_ASSERT(quantizedDesc->getElement(VES_NORMAL)->getType() == VET_UINT_10_10_10_2_NORM);
+		BS_TEST_ASSERT(quantizedDesc->getElement(VES_TANGENT)->getType() == VET_UINT_10_10_10_2_NORM);
+		BS_TEST_ASSERT(quantizedDesc->getElement(VES_TEXCOORD)->getType() == VET_HALF2);
+		BS_TEST_ASSERT(quantizedDesc->getVertexStride() == 20 && vertexDesc->getVertexStride() == 48);
+		BS_TEST_ASSERT(memcmp(quantized->getIndices32(), indices, NUM_VERTICES * sizeof(UINT32)) == 0);
+
+		// Bounds calculated from the quantized data must match the original bounds once decoded
+		Bounds bounds = quantized->calculateBounds();
+		bounds.transformAffine(positionQuantization.getDecodeMatrix());
+
+		Bounds originalBounds = meshData->calculateBounds();
+		const AABox& originalBox = originalBounds.getBox();
+		BS_TEST_ASSERT(bounds.getBox().getMin().distance(originalBox.getMin()) < 1e-3f);
+		BS_TEST_ASSERT(bounds.getBox().getMax().distance(originalBox.getMax()) < 1e-3f);
+
+		SPtr<MeshData> decoded = MeshUtility::dequantize(quantized, positionQuantization);
+
+		float maxPositionError = 0.0f;
+		float maxNormalError = 0.0f;
+		float maxTangentError = 0.0f;
+		float maxUVError = 0.0f;
+		bool tangentSignsMatch = true;
+
+		auto srcPositionIter = meshData->getVec3DataIter(VES_POSITION);
+		auto srcNormalIter = meshData->getVec3DataIter(VES_NORMAL);
+		auto srcTangentIter = meshData->getVec4DataIter(VES_TANGENT);
+		auto srcUVIter = meshData->getVec2DataIter(VES_TEXCOORD);
+		auto dstPositionIter = decoded->getVec3DataIter(VES_POSITION);
+		auto dstNormalIter = decoded->getVec3DataIter(VES_NORMAL);
+		auto dstTangentIter = decoded->getVec4DataIter(VES_TANGENT);
+		auto dstUVIter = decoded->getVec2DataIter(VES_TEXCOORD);
+		for(UINT32 i = 0; i < NUM_VERTICES; i++)
+		{
+			// Position error relative to the mesh extent along each axis
+			Vector3 positionError = (srcPositionIter.getValue() - dstPositionIter.getValue()) / boundsExtent;
+			for(UINT32 j = 0; j < 3; j++)
+				maxPositionError = std::max(maxPositionError, Math::abs(positionError[j]));
+
+			// Angular error in degrees
+			auto angleBetween = [](const Vector3& a, const Vector3& b)
+			{
+				return Math::acos(Math::clamp(a.dot(b), -1.0f, 1.0f)).valueDegrees();
+			};
+
+			Vector3 normal = Vector3::normalize(dstNormalIter.getValue());
+			maxNormalError = std::max(maxNormalError, angleBetween(srcNormalIter.getValue(), normal));
+
+			Vector4 srcTangent = srcTangentIter.getValue();
+			Vector4 dstTangent = dstTangentIter.getValue();
+			Vector3 tangent = Vector3::normalize(Vector3(dstTangent.x, dstTangent.y, dstTangent.z));
+			maxTangentError = std::max(maxTangentError,
+				angleBetween(Vector3(srcTangent.x, srcTangent.y, srcTangent.z), tangent));
+			tangentSignsMatch &= srcTangent.w == dstTangent.w;
+
+			// UV error relative to the coordinate magnitude
+			Vector2 srcUV = srcUVIter.getValue();
+			Vector2 uvError = srcUV - dstUVIter.getValue();
+			for(UINT32 j = 0; j < 2; j++)
+				maxUVError = std::max(maxUVError, Math::abs(uvError[j]) / std::max(Math::abs(srcUV[j]), 1.0f));
+
+			srcPositionIter.moveNext(); dstPositionIter.moveNext();
+			srcNormalIter.moveNext(); dstNormalIter.moveNext();
+			srcTangentIter.moveNext(); dstTangentIter.moveNext();
+			srcUVIter.moveNext(); dstUVIter.moveNext();
+		}
+
+		BS_LOG(Info, Generic, "Mesh quantization - vertex size: {0} -> {1} bytes, max position error: {2}, max normal "
+			"error: {3} deg, max tangent error: {4} deg, max UV error: {5}", vertexDesc->getVertexStride(),
+			quantizedDesc->getVertexStride(), maxPositionError, maxNormalError, maxTangentError, maxUVError);
+
+		// Half of the quantization step, with some leeway for float rounding
+		BS_TEST_ASSERT(maxPositionError < 0.55f / 65535.0f);
+		BS_TEST_ASSERT(maxNormalError < 0.2f);
+		BS_TEST_ASSERT(maxTangentError < 0.2f);
+		BS_TEST_ASSERT(tangentSignsMatch);
+
+		// Half floats store 10 mantissa bits
+		BS_TEST_ASSERT(maxUVError < 1.0f / 1024.0f);
+
+		// Unsupported and unrequested attributes must be left as is
+		SPtr<MeshData> partial = MeshUtility::quantize(meshData, MeshQuantizationFlag::TexCoord, positionQuantization);
+		BS_TEST_ASSERT(positionQuantization.isIdentity());
+		BS_TEST_ASSERT(partial->getVertexDesc()->getElement(VES_POSITION)->getType() == VET_FLOAT3);
+		BS_TEST_ASSERT(partial->getVertexDesc()->getElement(VES_NORMAL)->getType() == VET_FLOAT3);
+		BS_TEST_ASSERT(partial->getVertexDesc()->getElement(VES_TEXCOORD)->getType() == VET_HALF2);
+		BS_TEST_ASSERT(memcmp(partial->getElementData(VES_POSITION), meshData->getElementData(VES_POSITION),
+			sizeof(Vector3)) == 0);
+	}
+
+	/**
+	 * Reference pose evaluation that iterates over all bones of every state and checks the mask and curve mappings per
+	 * bone, used for validating and benchmarking Skeleton::getPose().
+	 */
+	void evaluateReferencePose(const BONE_DESC* bones, UINT32 numBones, Matrix4* pose, LocalSkeletonPose& localPose,
+		const SkeletonMask& mask, const AnimationStateLayer* layers, UINT32 numLayers)
+	{
+		Vector<bool> hasAnimCurve(numBones, false);
+		for(UINT32 i = 0; i < numBones; i++)
+		{
+			localPose.positions[i] = Vector3::ZERO;
+			localPose.rotations[i] = Quaternion::ZERO;
+			localPose.scales[i] = Vector3::ONE;
+		}
+
+		for(UINT32 i = 0; i < numLayers; i++)
+		{
+			const AnimationStateLayer& layer = layers[i];
+
+			float invLayerWeight = 1.0f;
+			if (layer.additive)
+			{
+				float weightSum = 0.0f;
+				for (UINT32 j = 0; j < layer.numStates; j++)
+					weightSum += layer.states[j].weight;
+
+				invLayerWeight = 1.0f / weightSum;
+			}
+
+			for (UINT32 j = 0; j < layer.numStates; j++)
+			{
+				const AnimationState& state = layer.states[j];
+				float normWeight = state.weight * invLayerWeight;
+
+				for (UINT32 k = 0; k < numBones; k++)
+				{
+					if (!mask.isEnabled(k))
+						continue;
+
+					const AnimationCurveMapping& mapping = state.boneToCurveMapping[k];
+					if (mapping.position != (UINT32)-1)
+					{
+						const TAnimationCurve<Vector3>& curve = state.curves->position[mapping.position].curve;
+						Vector3 value = curve.evaluate(state.time, state.positionCaches[mapping.position], false);
+						localPose.positions[k] += value * normWeight;
+						hasAnimCurve[k] = true;
+					}
+
+					if (mapping.scale != (UINT32)-1)
+					{
+						const TAnimationCurve<Vector3>& curve = state.curves->scale[mapping.scale].curve;
+						Vector3 value = curve.evaluate(state.time, state.scaleCaches[mapping.scale], false);
+						localPose.scales[k] *= value * normWeight;
+						hasAnimCurve[k] = true;
+					}
+
+					if (mapping.rotation != (UINT32)-1)
+					{
+						const TAnimationCurve<Quaternion>& curve = state.curves->rotation[mapping.rotation].curve;
+						Quaternion value = curve.evaluate(state.time, state.rotationCaches[mapping.rotation], false);
+
+						if (layer.additive)
+						{
+							if (localPose.rotations[k].w == 0.0f)
+								localPose.rotations[k] = Quaternion::IDENTITY;
+
+							localPose.rotations[k] *= Quaternion::lerp(normWeight, Quaternion::IDENTITY, value);
+						}
+						else
+						{
+							value = value * normWeight;
+							if (value.dot(localPose.rotations[k]) < 0.0f)
+								value = -value;
+
+							localPose.rotations[k] += value;
+						}
+
+						hasAnimCurve[k] = true;
+					}
+				}
+			}
+		}
+
+		for(UINT32 i = 0; i < numBones; i++)
+		{
+			if(!hasAnimCurve[i])
+			{
+				localPose.positions[i] = bones[i].localTfrm.getPosition();
+				localPose.rotations[i] = bones[i].localTfrm.getRotation();
+				localPose.scales[i] = bones[i].localTfrm.getScale();
+			}
+
+			if (localPose.rotations[i].w == 0.0f)
+				localPose.rotations[i] = Quaternion::IDENTITY;
+			else
+				localPose.rotations[i].normalize();
+
+			pose[i] = Matrix4::TRS(localPose.positions[i], localPose.rotations[i], localPose.scales[i]);
+		}
+
+		Vector<bool> isGlobal(numBones, false);
+		std::function<void(UINT32)> calcGlobal = [&](UINT32 boneIdx)
+		{
+			UINT32 parentBoneIdx = bones[boneIdx].parent;
+			if (parentBoneIdx != (UINT32)-1)
+			{
+				if (!isGlobal[parentBoneIdx])
+					calcGlobal(parentBoneIdx);
+
+				pose[boneIdx] = pose[parentBoneIdx] * pose[boneIdx];
+			}
+
+			isGlobal[boneIdx] = true;
+		};
+
+		for (UINT32 i = 0; i < numBones; i++)
+		{
+			if (!isGlobal[i])
+				calcGlobal(i);
+		}
+
+		for (UINT32 i = 0; i < numBones; i++)
+			pose[i] = pose[i] * bones[i].invBindPose;
+	}
+
+	void CoreTestSuite::testSkeletonPose()
+	{
+		static constexpr UINT32 NUM_BONES = 255;
+		static constexpr UINT32 NUM_STATES = 3;
+		static constexpr UINT32 NUM_KEYS = 8;
+		static constexpr UINT32 NUM_ITERATIONS = 200;
+
+		Random random(1234);
+
+		// Binary tree stored in reverse, so that children come before their parents
+		Vector<BONE_DESC> bones(NUM_BONES);
+		Vector<Matrix4> bindPoses(NUM_BONES);
+		for(UINT32 i = 0; i < NUM_BONES; i++)
+		{
+			UINT32 boneIdx = NUM_BONES - 1 - i;
+			UINT32 parentIdx = i == 0 ? (UINT32)-1 : NUM_BONES - 1 - (i - 1) / 2;
+
+			Quaternion rotation(random.getUnitVector(), Radian(random.getUNorm() * Math::TWO_PI));
+			Vector3 scale(0.5f + random.getUNorm(), 0.5f + random.getUNorm(), 0.5f + random.getUNorm());
+
+			BONE_DESC& bone = bones[boneIdx];
+			bone.name = "Bone" + toString(boneIdx);
+			bone.parent = parentIdx;
+			bone.localTfrm = Transform(random.getUnitVector(), rotation, scale);
+
+			bindPoses[boneIdx] = bone.localTfrm.getMatrix();
+			if(parentIdx != (UINT32)-1)
+				bindPoses[boneIdx] = bindPoses[parentIdx] * bindPoses[boneIdx];
+
+			bone.invBindPose = bindPoses[boneIdx].inverseAffine();
+		}
+
+		SPtr<Skeleton> skeleton = Skeleton::create(bones.data(), NUM_BONES);
+
+		// Every third bone disabled by the mask
+		SkeletonMaskBuilder maskBuilder(skeleton);
+		for(UINT32 i = 0; i < NUM_BONES; i += 3)
+			maskBuilder.setBoneState(bones[i].name, false);
+
+		SkeletonMask mask = maskBuilder.getMask();
+
+		// Two blended states in a normal layer, and an additive layer animating rotations only. Some bones are left
+		// without curves so they fall back to the bind pose.
+		AnimationState states[NUM_STATES];
+		Vector<AnimationCurveMapping> mappings[NUM_STATES];
+		Vector<TCurveCache<Vector3>> positionCaches[NUM_STATES];
+		Vector<TCurveCache<Quaternion>> rotationCaches[NUM_STATES];
+		Vector<TCurveCache<Vector3>> scaleCaches[NUM_STATES];
+		for(UINT32 i = 0; i < NUM_STATES; i++)
+		{
+			bool additive = i == NUM_STATES - 1;
+
+			SPtr<AnimationCurves> curves = bs_shared_ptr_new<AnimationCurves>();
+			mappings[i].resize(NUM_BONES, { (UINT32)-1, (UINT32)-1, (UINT32)-1 });
+
+			for(UINT32 j = 0; j < NUM_BONES; j++)
+			{
+				if(j % 7 == i)
+					continue;
+
+				Vector<TKeyframe<Vector3>> positionKeys(NUM_KEYS);
+				Vector<TKeyframe<Quaternion>> rotationKeys(NUM_KEYS);
+				Vector<TKeyframe<Vector3>> scaleKeys(NUM_KEYS);
+				for(UINT32 k = 0; k < NUM_KEYS; k++)
+				{
+					float time = k / (float)(NUM_KEYS - 1);
+
+					positionKeys[k] = { random.getUnitVector(), Vector3::ZERO, Vector3::ZERO, time };
+					rotationKeys[k] = { Quaternion(random.getUnitVector(), Radian(random.getUNorm() * Math::TWO_PI)),
+						Quaternion::ZERO, Quaternion::ZERO, time };
+					scaleKeys[k] = { Vector3(1.0f + random.getUNorm(), 1.0f, 1.0f), Vector3::ZERO, Vector3::ZERO, time };
+				}
+
+				AnimationCurveMapping& mapping = mappings[i][j];
+				mapping.rotation = (UINT32)curves->rotation.size();
+				curves->rotation.push_back(TNamedAnimationCurve<Quaternion>(bones[j].name,
+					TAnimationCurve<Quaternion>(rotationKeys)));
+
+				if(additive)
+					continue;
+
+				mapping.position = (UINT32)curves->position.size();
+				curves->position.push_back(TNamedAnimationCurve<Vector3>(bones[j].name,
+					TAnimationCurve<Vector3>(positionKeys)));
+
+				mapping.scale = (UINT32)curves->scale.size();
+				curves->scale.push_back(TNamedAnimationCurve<Vector3>(bones[j].name,
+					TAnimationCurve<Vector3>(scaleKeys)));
+			}
+
+			positionCaches[i].resize(curves->position.size());
+			rotationCaches[i].resize(curves->rotation.size());
+			scaleCaches[i].resize(curves->scale.size());
+
+			AnimationState& state = states[i];
+			state.curves = curves;
+			state.length = 1.0f;
+			state.boneToCurveMapping = mappings[i].data();
+			state.soToCurveMapping = nullptr;
+			state.positionCaches = positionCaches[i].data();
+			state.rotationCaches = rotationCaches[i].data();
+			state.scaleCaches = scaleCaches[i].data();
+			state.genericCaches = nullptr;
+			state.time = 0.35f;
+			state.weight = additive ? 0.5f : (i == 0 ? 0.7f : 0.3f);
+			state.loop = false;
+			state.disabled = false;
+		}
+
+		AnimationStateLayer layers[2];
+		layers[0].states = &states[0];
+		layers[0].numStates = NUM_STATES - 1;
+		layers[0].index = 0;
+		layers[0].additive = false;
+
+		layers[1].states = &states[NUM_STATES - 1];
+		layers[1].numStates = 1;
+		layers[1].index = 1;
+		layers[1].additive = true;
+
+		Vector<Matrix4> referencePose(NUM_BONES);
+		LocalSkeletonPose referenceLocalPose(NUM_BONES);
+		evaluateReferencePose(bones.data(), NUM_BONES, referencePose.data(), referenceLocalPose, mask, layers, 2);
+
+		Vector<Matrix4> pose(NUM_BONES);
+		LocalSkeletonPose localPose(NUM_BONES);
+		bs_zero_out(localPose.hasOverride, NUM_BONES);
+		skeleton->getPose(pose.data(), localPose, mask, layers, 2);
+
+		float maxError = 0.0f;
+		for(UINT32 i = 0; i < NUM_BONES; i++)
+		{
+			for(UINT32 j = 0; j < 4; j++)
+			{
+				for(UINT32 k = 0; k < 4; k++)
+				{
+					float error = Math::abs(pose[i][j][k] - referencePose[i][j][k]);
+					maxError = std::max(maxError, error / std::max(Math::abs(referencePose[i][j][k]), 1.0f));
+				}
+			}
+		}
+
+		BS_TEST_ASSERT(maxError < 1e-3f);
+
+		// Pre-built active track lists, as provided by the animation proxy, must produce the same result
+		Vector<AnimationBoneTrack> activeTracks[NUM_STATES];
+		UINT32 numActiveTracks = 0;
+		for(UINT32 i = 0; i < NUM_STATES; i++)
+		{
+			activeTracks[i].resize(NUM_BONES);
+			states[i].numActiveTracks = skeleton->getActiveTracks(mappings[i].data(), mask, activeTracks[i].data());
+			states[i].activeTracks = activeTracks[i].data();
+
+			numActiveTracks += states[i].numActiveTracks;
+		}
+
+		BS_TEST_ASSERT(numActiveTracks < NUM_STATES * NUM_BONES);
+
+		Vector<Matrix4> trackPose(NUM_BONES);
+		skeleton->getPose(trackPose.data(), localPose, mask, layers, 2);
+		BS_TEST_ASSERT(memcmp(trackPose.data(), pose.data(), NUM_BONES * sizeof(Matrix4)) == 0);
+
+		Timer timer;
+		for(UINT32 i = 0; i < NUM_ITERATIONS; i++)
+			evaluateReferencePose(bones.data(), NUM_BONES, referencePose.data(), referenceLocalPose, mask, layers, 2);
+
+		UINT64 referenceTime = std::max(timer.getMicroseconds(), (UINT64)1);
+
+		timer.reset();
+		for(UINT32 i = 0; i < NUM_ITERATIONS; i++)
+			skeleton->getPose(pose.data(), localPose, mask, layers, 2);
+
+		UINT64 time = std::max(timer.getMicroseconds(), (UINT64)1);
+
+		float numBones = (float)(NUM_BONES * NUM_ITERATIONS);
+		BS_LOG(Info, Generic, "Skeleton pose evaluation - per-bone: {0} bones/ms, active tracks: {1} bones/ms, "
+			"max error: {2}", numBones / (referenceTime / 1000.0f), numBones / (time / 1000.0f), maxError);
+	}
+
+	void CoreTestSuite::testAnimationLOD()
+	{
+		static constexpr UINT32 NUM_BONES = 64;
+		static constexpr UINT32 NUM_ANIMATIONS = 1000;
+		static constexpr UINT32 NUM_UPDATES = 60;
+		static constexpr UINT32 NUM_KEYS = 8;
+
+		// Level selection picks the smallest level that still covers the screen size
+		Vector<AnimationLODLevel> levels(3);
+		levels[0].screenSize = 0.5f;
+		levels[0].updateInterval = 2;
+		levels[1].screenSize = 0.1f;
+		levels[1].updateInterval = 8;
+		levels[1].interpolate = false;
+		levels[2].screenSize = 0.25f;
+		levels[2].updateInterval = 4;
+
+		BS_TEST_ASSERT(AnimationLODScheduler::selectLevel(levels, 1.0f) == nullptr);
+		BS_TEST_ASSERT(AnimationLODScheduler::selectLevel(levels, 0.3f) == &levels[0]);
+		BS_TEST_ASSERT(AnimationLODScheduler::selectLevel(levels, 0.2f) == &levels[2]);
+		BS_TEST_ASSERT(AnimationLODScheduler::selectLevel(levels, 0.05f) == &levels[1]);
+
+		// Animations at the same level are spread evenly across updates, and each is evaluated once per interval
+		{
+			Vector<AnimationLODState> states(100);
+			Vector<AnimationLODState*> statePtrs(states.size());
+			for(UINT32 i = 0; i < (UINT32)states.size(); i++)
+			{
+				states[i].id = i;
+				states[i].numBones = NUM_BONES;
+				states[i].updateInterval = 4;
+				states[i].interpolate = true;
+				statePtrs[i] = &states[i];
+			}
+
+			AnimationLODScheduler scheduler;
+			scheduler.schedule(statePtrs.data(), (UINT32)statePtrs.size());
+			BS_TEST_ASSERT(scheduler.getNumScheduledBones() == 100 * NUM_BONES);
+
+			Vector<UINT32> numEvaluations(states.size(), 0);
+			for(UINT32 i = 0; i < 8; i++)
+			{
+				scheduler.schedule(statePtrs.data(), (UINT32)statePtrs.size());
+
+				UINT32 numEvaluated = 0;
+				for(UINT32 j = 0; j < (UINT32)states.size(); j++)
+				{
+					if(states[j].action == AnimLODAction::Evaluate)
+					{
+						numEvaluations[j]++;
+						numEvaluated++;
+					}
+					else
+						BS_TEST_ASSERT(states[j].action == AnimLODAction::Interpolate);
+				}
+
+				BS_TEST_ASSERT(numEvaluated == 25);
+			}
+
+			for(auto& entry : numEvaluations)
+				BS_TEST_ASSERT(entry == 2);
+		}
+
+		// Bone limit is respected and postponed animations are evaluated on the following updates
+		{
+			Vector<AnimationLODState> states(100);
+			Vector<AnimationLODState*> statePtrs(states.size());
+			for(UINT32 i = 0; i < (UINT32)states.size(); i++)
+			{
+				states[i].id = i;
+				states[i].numBones = NUM_BONES;
+				states[i].hasPose = true;
+				statePtrs[i] = &states[i];
+			}
+
+			AnimationLODScheduler scheduler;
+			scheduler.setMaxBonesPerUpdate(NUM_BONES * 30);
+
+			UINT32 maxUpdatesSinceEvaluation = 0;
+			for(UINT32 i = 0; i < 20; i++)
+			{
+				scheduler.schedule(statePtrs.data(), (UINT32)statePtrs.size());
+				BS_TEST_ASSERT(scheduler.getNumScheduledBones() == NUM_BONES * 30);
+
+				for(auto& entry : states)
+					maxUpdatesSinceEvaluation = std::max(maxUpdatesSinceEvaluation, entry.updatesSinceEvaluation);
+			}
+
+			// 100 animations at 30 per update, in round-robin order
+			BS_TEST_ASSERT(maxUpdatesSinceEvaluation <= 3);
+		}
+
+		// Animations postponed by the bone limit are still evaluated at most once per interval
+		{
+			static constexpr UINT32 INTERVAL = 4;
+
+			Vector<AnimationLODState> states(100);
+			Vector<AnimationLODState*> statePtrs(states.size());
+			for(UINT32 i = 0; i < (UINT32)states.size(); i++)
+			{
+				states[i].id = i;
+				states[i].numBones = NUM_BONES;
+				states[i].updateInterval = INTERVAL;
+				states[i].hasPose = true;
+				statePtrs[i] = &states[i];
+			}
+
+			AnimationLODScheduler scheduler;
+			scheduler.setMaxBonesPerUpdate(NUM_BONES * 20);
+
+			// Index of the last interval-long window each animation was evaluated in, offset the same way as the
+			// scheduler offsets them (it advances its update counter before scheduling)
+			Vector<UINT32> lastWindow(states.size(), (UINT32)-1);
+			for(UINT32 i = 0; i < 40; i++)
+			{
+				scheduler.schedule(statePtrs.data(), (UINT32)statePtrs.size());
+				BS_TEST_ASSERT(scheduler.getNumScheduledBones() <= NUM_BONES * 20);
+
+				for(UINT32 j = 0; j < (UINT32)states.size(); j++)
+				{
+					if(states[j].action != AnimLODAction::Evaluate)
+						continue;
+
+					const UINT32 window = (i + 1 + j) / INTERVAL;
+					BS_TEST_ASSERT(lastWindow[j] != window);
+					lastWindow[j] = window;
+				}
+			}
+		}
+
+		// Stress test evaluating a crowd of animated skeletons, comparing evaluation on every update against evaluation
+		// with levels of detail and a bone limit
+		Random random(1234);
+
+		Vector<BONE_DESC> bones(NUM_BONES);
+		for(UINT32 i = 0; i < NUM_BONES; i++)
+		{
+			BONE_DESC& bone = bones[i];
+			bone.name = "Bone" + toString(i);
+			bone.parent = i == 0 ? (UINT32)-1 : (i - 1) / 2;
+			bone.localTfrm = Transform(Vector3(0.0f, 0.1f, 0.0f), Quaternion::IDENTITY, Vector3::ONE);
+			bone.invBindPose = Matrix4::IDENTITY;
+		}
+
+		SPtr<Skeleton> skeleton = Skeleton::create(bones.data(), NUM_BONES);
+		SkeletonMask mask;
+
+		SPtr<AnimationCurves> curves = bs_shared_ptr_new<AnimationCurves>();
+		Vector<AnimationCurveMapping> mapping(NUM_BONES);
+		for(UINT32 i = 0; i < NUM_BONES; i++)
+		{
+			Vector<TKeyframe<Vector3>> positionKeys(NUM_KEYS);
+			Vector<TKeyframe<Quaternion>> rotationKeys(NUM_KEYS);
+			for(UINT32 j = 0; j < NUM_KEYS; j++)
+			{
+				float time = j / (float)(NUM_KEYS - 1);
+				Vector3 position = Vector3(0.0f, 0.1f, 0.0f) + random.getUnitVector() * 0.01f;
+				Quaternion rotation(random.getUnitVector(), Degree(random.getSNorm() * 30.0f));
+
+				positionKeys[j] = { position, Vector3::ZERO, Vector3::ZERO, time };
+				rotationKeys[j] = { rotation, Quaternion::ZERO, Quaternion::ZERO, time };
+			}
+
+			mapping[i] = { (UINT32)curves->position.size(), (UINT32)curves->rotation.size(), (UINT32)-1 };
+			curves->position.push_back(TNamedAnimationCurve<Vector3>(bones[i].name,
+				TAnimationCurve<Vector3>(positionKeys)));
+			curves->rotation.push_back(TNamedAnimationCurve<Quaternion>(bones[i].name,
+				TAnimationCurve<Quaternion>(rotationKeys)));
+		}
+
+		Vector<AnimationBoneTrack> activeTracks(NUM_BONES);
+		UINT32 numActiveTracks = skeleton->getActiveTracks(mapping.data(), mask, activeTracks.data());
+
+		struct CrowdMember
+		{
+			AnimationState state;
+			AnimationStateLayer layer;
+			Vector<TCurveCache<Vector3>> positionCaches;
+			Vector<TCurveCache<Quaternion>> rotationCaches;
+			LocalSkeletonPose localPose;
+			LocalSkeletonPose fromPose;
+			LocalSkeletonPose toPose;
+			AnimationLODState lodState;
+			float screenSize;
+		};
+
+		Vector<CrowdMember> crowd(NUM_ANIMATIONS);
+		Vector<AnimationLODState*> lodStates(NUM_ANIMATIONS);
+		for(UINT32 i = 0; i < NUM_ANIMATIONS; i++)
+		{
+			CrowdMember& member = crowd[i];
+			member.positionCaches.resize(NUM_BONES);
+			member.rotationCaches.resize(NUM_BONES);
+			member.localPose = LocalSkeletonPose(NUM_BONES);
+			member.fromPose = LocalSkeletonPose(NUM_BONES);
+			member.toPose = LocalSkeletonPose(NUM_BONES);
+			bs_zero_out(member.localPose.hasOverride, NUM_BONES);
+			bs_zero_out(member.toPose.hasOverride, NUM_BONES);
+
+			AnimationState& state = member.state;
+			state.curves = curves;
+			state.length = 1.0f;
+			state.boneToCurveMapping = mapping.data();
+			state.soToCurveMapping = nullptr;
+			state.activeTracks = activeTracks.data();
+			state.numActiveTracks = numActiveTracks;
+			state.positionCaches = member.positionCaches.data();
+			state.rotationCaches = member.rotationCaches.data();
+			state.scaleCaches = nullptr;
+			state.genericCaches = nullptr;
+			state.time = random.getUNorm();
+			state.weight = 1.0f;
+			state.loop = true;
+			state.disabled = false;
+
+			member.layer.states = &member.state;
+			member.layer.numStates = 1;
+			member.layer.index = 0;
+			member.layer.additive = false;
+
+			// Crowd spread evenly over a disc with a 100m radius around the viewer, each member roughly 1m in size
+			float distance = 2.0f + 98.0f * std::sqrt(random.getUNorm());
+			member.screenSize = 1.0f / distance;
+			member.lodState.id = i;
+			member.lodState.numBones = NUM_BONES;
+
+			lodStates[i] = &member.lodState;
+		}
+
+		// Only the closest reduced level interpolates, as it is the one where the lower update rate is most noticeable
+		levels[1].screenSize = 0.1f;
+		levels[1].updateInterval = 4;
+		levels[1].interpolate = false;
+		levels[2].screenSize = 0.02f;
+		levels[2].updateInterval = 8;
+		levels[2].interpolate = false;
+
+		Vector<Matrix4> poses[2];
+		poses[0].resize(NUM_ANIMATIONS * NUM_BONES);
+		poses[1].resize(NUM_ANIMATIONS * NUM_BONES);
+
+		const float timeDelta = 1.0f / 60.0f;
+		auto advanceTime = [&crowd, timeDelta]()
+		{
+			for(auto& entry : crowd)
+				entry.state.time = Math::repeat(entry.state.time + timeDelta, 1.0f);
+		};
+
+		Timer timer;
+		for(UINT32 i = 0; i < NUM_UPDATES; i++)
+		{
+			advanceTime();
+
+			for(UINT32 j = 0; j < NUM_ANIMATIONS; j++)
+			{
+				CrowdMember& member = crowd[j];
+				skeleton->getPose(&poses[0][j * NUM_BONES], member.localPose, mask, &member.layer, 1);
+			}
+		}
+
+		UINT64 fullRateTime = timer.getMicroseconds();
+
+		AnimationLODScheduler scheduler;
+		scheduler.setMaxBonesPerUpdate(NUM_ANIMATIONS * NUM_BONES / 4);
+
+		UINT32 numEvaluatedBones = 0;
+		timer.reset();
+		for(UINT32 i = 0; i < NUM_UPDATES; i++)
+		{
+			advanceTime();
+
+			for(auto& member : crowd)
+			{
+				const AnimationLODLevel* level = AnimationLODScheduler::selectLevel(levels, member.screenSize);
+				member.lodState.updateInterval = level != nullptr ? level->updateInterval : 1;
+				member.lodState.interpolate = level != nullptr ? level->interpolate : false;
+			}
+
+			scheduler.schedule(lodStates.data(), NUM_ANIMATIONS);
+			numEvaluatedBones += scheduler.getNumScheduledBones();
+
+			const UINT32 readIdx = i % 2;
+			const UINT32 writeIdx = (i + 1) % 2;
+			for(UINT32 j = 0; j < NUM_ANIMATIONS; j++)
+			{
+				CrowdMember& member = crowd[j];
+				Matrix4* pose = &poses[writeIdx][j * NUM_BONES];
+
+				switch(member.lodState.action)
+				{
+				case AnimLODAction::Evaluate:
+					if(member.lodState.interpolate && member.lodState.interpolationFactor < 1.0f)
+					{
+						memcpy(member.fromPose.positions, member.localPose.positions, sizeof(Vector3) * NUM_BONES);
+						memcpy(member.fromPose.rotations, member.localPose.rotations, sizeof(Quaternion) * NUM_BONES);
+						memcpy(member.fromPose.scales, member.localPose.scales, sizeof(Vector3) * NUM_BONES);
+
+						skeleton->getPose(pose, member.toPose, mask, &member.layer, 1);
+						skeleton->getPose(pose, member.localPose, member.fromPose, member.toPose,
+							member.lodState.interpolationFactor);
+					}
+					else
+					{
+						skeleton->getPose(pose, member.toPose, mask, &member.layer, 1);
+						memcpy(member.localPose.positions, member.toPose.positions, sizeof(Vector3) * NUM_BONES);
+						memcpy(member.localPose.rotations, member.toPose.rotations, sizeof(Quaternion) * NUM_BONES);
+						memcpy(member.localPose.scales, member.toPose.scales, sizeof(Vector3) * NUM_BONES);
+					}
+					break;
+				case AnimLODAction::Interpolate:
+					skeleton->getPose(pose, member.localPose, member.fromPose, member.toPose,
+						member.lodState.interpolationFactor);
+					break;
+				case AnimLODAction::Reuse:
+					memcpy(pose, &poses[readIdx][j * NUM_BONES], sizeof(Matrix4) * NUM_BONES);
+					break;
+				}
+			}
+		}
+
+		UINT64 lodTime = timer.getMicroseconds();
+
+		// Fully interpolated pose must match the evaluated one
+		{
+			CrowdMember& member = crowd[0];
+			Vector<Matrix4> evaluated(NUM_BONES);
+			Vector<Matrix4> interpolated(NUM_BONES);
+
+			skeleton->getPose(evaluated.data(), member.toPose, mask, &member.layer, 1);
+			skeleton->getPose(interpolated.data(), member.localPose, member.fromPose, member.toPose, 1.0f);
+
+			float maxError = 0.0f;
+			for(UINT32 i = 0; i < NUM_BONES; i++)
+			{
+				for(UINT32 j = 0; j < 16; j++)
+				{
+					float error = Math::abs(evaluated[i][j / 4][j % 4] - interpolated[i][j / 4][j % 4]);
+					maxError = std::max(maxError, error);
+				}
+			}
+
+			BS_TEST_ASSERT(maxError < 1e-4f);
+		}
+
+		BS_TEST_ASSERT(numEvaluatedBones < NUM_UPDATES * NUM_ANIMATIONS * NUM_BONES / 2);
+
+		BS_LOG(Info, Generic, "Animation LOD - {0} skeletons, {1} bones each: {2} ms per update at full rate, {3} ms per "
+			"update with LOD, {4}% of bones evaluated", NUM_ANIMATIONS, NUM_BONES,
+			fullRateTime / (1000.0f * NUM_UPDATES), lodTime / (1000.0f * NUM_UPDATES),
+			numEvaluatedBones * 100.0f / (NUM_UPDATES * NUM_ANIMATIONS * NUM_BONES));
+	}
+
+	/** Blends morph shapes into a newly allocated buffer, one vertex at a time. Used as a reference for the optimized path. */
+	SPtr<MeshData> blendReferenceMorphShapes(const MorphShapeInfo* shapes, UINT32 numShapes, UINT32 numVertices,
+		const SPtr<VertexDataDesc>& vertexDesc)
+	{
+		SPtr<MeshData> meshData = bs_shared_ptr_new<MeshData>(numVertices, 0, vertexDesc);
+
+		UINT8* bufferData = meshData->getData();
+		memset(bufferData, 0, meshData->getSize());
+
+		Vector<Vector3> tempNormals(numVertices, Vector3::ZERO);
+		Vector<float> accumulatedWeight(numVertices, 0.0f);
+
+		UINT8* positions = meshData->getElementData(VES_POSITION, 1, 1);
+		UINT8* normals = meshData->getElementData(VES_NORMAL, 1, 1);
+		UINT32 stride = vertexDesc->getVertexStride(1);
+
+		for (UINT32 i = 0; i < numShapes; i++)
+		{
+			const MorphShapeInfo& info = shapes[i];
+			float absWeight = Math::abs(info.finalWeight);
+
+			if (absWeight < 0.0001f)
+				continue;
+
+			for (auto& vertex : info.shape->getVertices())
+			{
+				Vector3* destPos = (Vector3*)(positions + vertex.sourceIdx * stride);
+				*destPos += vertex.deltaPosition * info.finalWeight;
+
+				tempNormals[vertex.sourceIdx] += vertex.deltaNormal * info.finalWeight;
+				accumulatedWeight[vertex.sourceIdx] += absWeight;
+			}
+		}
+
+		for (UINT32 i = 0; i < numVertices; i++)
+		{
+			PackedNormal* destNrm = (PackedNormal*)(normals + i * stride);
+
+			if (accumulatedWeight[i] > 0.0001f)
+			{
+				Vector3 normal = tempNormals[i] / accumulatedWeight[i];
+				normal /= 2.0f;
+
+				MeshUtility::packNormals(&normal, (UINT8*)destNrm, 1, sizeof(Vector3), stride);
+				destNrm->w = (UINT8)(std::min(1.0f, accumulatedWeight[i]) * 255.999f);
+			}
+			else
+				*destNrm = { { 127, 127, 127, 0 } };
+		}
+
+		return meshData;
+	}
+
+	void CoreTestSuite::testMorphShapeBlending()
+	{
+		static constexpr UINT32 NUM_VERTICES = 20000;
+		static constexpr UINT32 NUM_SHAPES = 16;
+		static constexpr UINT32 SHAPE_REGION_SIZE = 2000;
+		static constexpr UINT32 NUM_UPDATES = 200;
+
+		Random random(4321);
+
+		SPtr<VertexDataDesc> vertexDesc = VertexDataDesc::create();
+		vertexDesc->addVertElem(VET_FLOAT3, VES_POSITION, 1, 1);
+		vertexDesc->addVertElem(VET_UBYTE4_NORM, VES_NORMAL, 1, 1);
+
+		const UINT32 stride = vertexDesc->getVertexStride(1);
+
+		// Shapes each affect a localized region within the first quarter of the mesh (e.g. a face on a character), with
+		// some vertices within the region left untouched. Vertices are provided in random order.
+		Vector<MorphShapeInfo> shapes(NUM_SHAPES);
+		for(UINT32 i = 0; i < NUM_SHAPES; i++)
+		{
+			UINT32 regionStart = (UINT32)(random.getUNorm() * (NUM_VERTICES / 4 - SHAPE_REGION_SIZE));
+
+			Vector<MorphVertex> vertices;
+			for(UINT32 j = 0; j < SHAPE_REGION_SIZE; j++)
+			{
+				if(random.getUNorm() < 0.1f)
+					continue;
+
+				Vector3 deltaPosition = random.getUnitVector() * random.getUNorm() * 0.1f;
+				Vector3 deltaNormal = random.getUnitVector() * random.getUNorm();
+				vertices.push_back(MorphVertex(deltaPosition, deltaNormal, regionStart + j));
+			}
+
+			for(UINT32 j = (UINT32)vertices.size() - 1; j > 0; j--)
+				std::swap(vertices[j], vertices[random.getRange(0, j)]);
+
+			shapes[i].shape = MorphShape::create("Shape" + toString(i), 1.0f, vertices);
+			shapes[i].frameWeight = 1.0f;
+			shapes[i].finalWeight = 0.0f;
+		}
+
+		// Only a few shapes are active at a time, as with facial animation
+		auto randomizeWeights = [&random, &shapes]()
+		{
+			for(auto& entry : shapes)
+			{
+				if(random.getUNorm() < 0.25f)
+					entry.finalWeight = random.getSNorm();
+				else
+					entry.finalWeight = 0.0f;
+			}
+		};
+
+		// Blended buffers must match the reference after every update, including when the pooled buffers are reused.
+		// Applying only the dirty ranges of consecutive versions must result in the same data as a full upload.
+		MorphShapeBuffers buffers;
+		Vector<UINT8> uploaded;
+		UINT32 uploadedVersion = 0;
+		UINT64 numUploadedBytes = 0;
+		float maxPositionError = 0.0f;
+		UINT32 maxNormalError = 0;
+		bool uploadedMatches = true;
+
+		for(UINT32 i = 0; i < 30; i++)
+		{
+			randomizeWeights();
+
+			buffers.blend(shapes.data(), NUM_SHAPES, NUM_VERTICES, vertexDesc);
+			SPtr<MeshData> reference = blendReferenceMorphShapes(shapes.data(), NUM_SHAPES, NUM_VERTICES, vertexDesc);
+
+			const SPtr<MeshData>& output = buffers.getCurrent();
+			BS_TEST_ASSERT(output->getSize() == reference->getSize());
+
+			for(UINT32 j = 0; j < NUM_VERTICES; j++)
+			{
+				const UINT8* outputVertex = output->getData() + j * stride;
+				const UINT8* referenceVertex = reference->getData() + j * stride;
+
+				const Vector3& outputPosition = *(const Vector3*)outputVertex;
+				const Vector3& referencePosition = *(const Vector3*)referenceVertex;
+				for(UINT32 k = 0; k < 3; k++)
+					maxPositionError = std::max(maxPositionError, Math::abs(outputPosition[k] - referencePosition[k]));
+
+				for(UINT32 k = 0; k < 4; k++)
+				{
+					UINT32 error = (UINT32)std::abs((INT32)outputVertex[sizeof(Vector3) + k] -
+						(INT32)referenceVertex[sizeof(Vector3) + k]);
+					maxNormalError = std::max(maxNormalError, error);
+				}
+			}
+
+			// Skip an occasional version, which must trigger a full upload
+			if(i % 7 == 6)
+				continue;
+
+			if(uploadedVersion != 0 && (uploadedVersion + 1) == buffers.version)
+			{
+				UINT32 offset = buffers.dirtyStart * stride;
+				UINT32 size = (buffers.dirtyEnd - buffers.dirtyStart) * stride;
+
+				if(buffers.dirtyStart < buffers.dirtyEnd)
+					memcpy(uploaded.data() + offset, output->getData() + offset, size);
+
+				numUploadedBytes += size;
+			}
+			else
+			{
+				uploaded.assign(output->getData(), output->getData() + output->getSize());
+				numUploadedBytes += output->getSize();
+			}
+
+			uploadedVersion = buffers.version;
+			uploadedMatches &= memcmp(uploaded.data(), output->getData(), output->getSize()) == 0;
+		}
+
+		BS_TEST_ASSERT(maxPositionError < 1e-5f);
+		BS_TEST_ASSERT(maxNormalError == 0);
+		BS_TEST_ASSERT(uploadedMatches);
+
+		// Benchmark the reference path allocating and blending the entire buffer on every update, against blending
+		// into the pooled buffers
+		Timer timer;
+		for(UINT32 i = 0; i < NUM_UPDATES; i++)
+		{
+			randomizeWeights();
+
+			SPtr<MeshData> reference = blendReferenceMorphShapes(shapes.data(), NUM_SHAPES, NUM_VERTICES, vertexDesc);
+			BS_TEST_ASSERT(reference != nullptr);
+		}
+
+		UINT64 referenceTime = timer.getMicroseconds();
+
+		UINT64 numDirtyVertices = 0;
+		timer.reset();
+		for(UINT32 i = 0; i < NUM_UPDATES; i++)
+		{
+			randomizeWeights();
+
+			buffers.blend(shapes.data(), NUM_SHAPES, NUM_VERTICES, vertexDesc);
+			numDirtyVertices += buffers.dirtyEnd - buffers.dirtyStart;
+		}
+
+		UINT64 time = timer.getMicroseconds();
+
+		BS_LOG(Info, Generic, "Morph shape blending - {0} vertices, {1} shapes: {2} ms per update for reference, {3} ms "
+			"per update pooled, {4}% of vertices uploaded", NUM_VERTICES, NUM_SHAPES,
+			referenceTime / (1000.0f * NUM_UPDATES), time / (1000.0f * NUM_UPDATES),
+			numDirtyVertices * 100.0f / (NUM_UPDATES * (UINT64)NUM_VERTICES));
+	}
+
+	void CoreTestSuite::testSystemGraph()
+	{
+		static constexpr UINT32 NUM_BUSY_SYSTEMS = 4;
+		static constexpr UINT64 BUSY_TIME = 5000; // Microseconds
+
+		// Dependencies follow the declared accesses and the order systems were added in
+		{
+			SystemGraph graph;
+			graph.addSystem("A", []() { }, { }, { "X" });
+			graph.addSystem("B", []() { }, { "X" }, { });
+			graph.addSystem("C", []() { }, { "X" }, { }, SystemFlags());
+			graph.addSystem("D", []() { }, { }, { "Y" }, SystemFlags());
+			graph.addSystem("E", []() { }, { "Y" }, { "X" });
+
+			BS_TEST_ASSERT(graph.getDependencies(0).empty());
+			BS_TEST_ASSERT(graph.getDependencies(1) == Vector<UINT32>({ 0 }));
+			BS_TEST_ASSERT(graph.getDependencies(2) == Vector<UINT32>({ 0 }));
+			BS_TEST_ASSERT(graph.getDependencies(3).empty());
+			BS_TEST_ASSERT(graph.getDependencies(4) == Vector<UINT32>({ 0, 1, 2, 3 }));
+		}
+
+		// Systems only start after their dependencies finish, and main thread systems stay on the calling thread.
+		// Systems without dependencies between them run concurrently.
+		{
+			Mutex mutex;
+			Vector<UINT32> completionOrder;
+			std::atomic<UINT32> numReaderStarted(0);
+			std::atomic<bool> readersOverlapped(false);
+			bool mainThreadValid = true;
+			const ThreadId mainThreadId = BS_THREAD_CURRENT_ID;
+
+			auto complete = [&mutex, &completionOrder](UINT32 idx)
+			{
+				Lock lock(mutex);
+				completionOrder.push_back(idx);
+			};
+
+			// Both readers wait for each other to start, which can only succeed if they run at the same time
+			auto reader = [&numReaderStarted, &readersOverlapped]()
+			{
+				numReaderStarted++;
+
+				Timer timer;
+				while(numReaderStarted < 2 && timer.getMilliseconds() < 1000)
+					std::this_thread::yield();
+
+				if(numReaderStarted == 2)
+					readersOverlapped = true;
+			};
+
+			SystemGraph graph;
+			graph.addSystem("Writer", [&]()
+			{
+				mainThreadValid &= BS_THREAD_CURRENT_ID == mainThreadId;
+				complete(0);
+			}, { }, { "X" });
+
+			graph.addSystem("Reader A", [&]() { reader(); complete(1); }, { "X" }, { }, SystemFlags());
+			graph.addSystem("Reader B", [&]() { reader(); complete(2); }, { "X" }, { }, SystemFlags());
+
+			graph.addSystem("Final", [&]()
+			{
+				mainThreadValid &= BS_THREAD_CURRENT_ID == mainThreadId;
+				complete(3);
+			}, { "X" }, { "X" });
+
+			for(UINT32 i = 0; i < 3; i++)
+			{
+				completionOrder.clear();
+				numReaderStarted = 0;
+				readersOverlapped = false;
+
+				graph.execute();
+
+				BS_TEST_ASSERT(completionOrder.size() == 4);
+				BS_TEST_ASSERT(completionOrder.front() == 0);
+				BS_TEST_ASSERT(completionOrder.back() == 3);
+				BS_TEST_ASSERT(readersOverlapped);
+			}
+
+			BS_TEST_ASSERT(mainThreadValid);
+		}
+
+		// Independent systems overlap, so the frame takes about as long as the longest system
+		{
+			auto busyWork = []()
+			{
+				Timer timer;
+				while(timer.getMicroseconds() < BUSY_TIME)
+					std::this_thread::yield();
+			};
+
+			SystemGraph graph;
+			for(UINT32 i = 0; i < NUM_BUSY_SYSTEMS; i++)
+				graph.addSystem("Busy " + toString(i), busyWork, { }, { "State" + toString(i) }, SystemFlags());
+
+			graph.addSystem("Main thread", busyWork, { }, { "MainState" });
+
+			Timer timer;
+			graph.execute();
+			UINT64 time = timer.getMicroseconds();
+
+			UINT64 serialTime = 0;
+			for(UINT32 i = 0; i < graph.getNumSystems(); i++)
+				serialTime += graph.getLastDuration(i);
+
+			BS_TEST_ASSERT(time < serialTime);
+
+			BS_LOG(Info, Generic, "System graph - {0} independent systems: {1} ms when executed serially, {2} ms in the "
+				"graph", graph.getNumSystems(), serialTime / 1000.0f, time / 1000.0f);
+		}
+	}
+
+	void CoreTestSuite::testFramePacing()
+	{
+		static constexpr UINT32 SIM_TIME_MS = 2;
+		static constexpr UINT32 CORE_TIME_MS = 10;
+		static constexpr UINT32 NUM_FRAMES = 40;
+		static constexpr UINT32 NUM_WARMUP_FRAMES = 10;
+
+		// Emulates the sim and core thread lockstep from CoreApplication::runMainLoopFrame(), with a core thread that
+		// takes longer to render a frame than the sim thread takes to produce one. Returns the average input to submit
+		// latency, in microseconds.
+		auto runFrames = [](FramePacer& pacer)
+		{
+			Mutex mutex;
+			Signal signal;
+			bool frameSubmitted = false;
+			bool frameFinished = true;
+			bool quit = false;
+			UINT64 frameFinishedTime = 0;
+
+			Thread coreThread([&]()
+			{
+				while(true)
+				{
+					{
+						Lock lock(mutex);
+						while(!frameSubmitted && !quit)
+							signal.wait(lock);
+
+						if(quit)
+							break;
+
+						frameSubmitted = false;
+					}
+
+					BS_THREAD_SLEEP(CORE_TIME_MS);
+
+					Lock lock(mutex);
+					frameFinished = true;
+					frameFinishedTime = pacer.getTime();
+					signal.notify_all();
+				}
+			});
+
+			UINT64 totalLatency = 0;
+			for(UINT32 i = 0; i < NUM_FRAMES; i++)
+			{
+				pacer.waitForFrameStart();
+				BS_THREAD_SLEEP(SIM_TIME_MS);
+				pacer.notifySimFrameEnd();
+
+				UINT64 finishedTime;
+				{
+					Lock lock(mutex);
+					while(!frameFinished)
+						signal.wait(lock);
+
+					frameFinished = false;
+					finishedTime = frameFinishedTime;
+
+					frameSubmitted = true;
+					signal.notify_all();
+				}
+
+				pacer.notifyFrameSubmitted(finishedTime);
+
+				if(i >= NUM_WARMUP_FRAMES)
+					totalLatency += pacer.getInputLatency();
+			}
+
+			{
+				Lock lock(mutex);
+				while(!frameFinished)
+					signal.wait(lock);
+
+				quit = true;
+				signal.notify_all();
+			}
+
+			coreThread.join();
+			return totalLatency / (NUM_FRAMES - NUM_WARMUP_FRAMES);
+		};
+
+		FramePacer unpaced;
+		unpaced.setAdaptive(false);
+		UINT64 unpacedLatency = runFrames(unpaced);
+
+		FramePacer paced;
+		UINT64 pacedLatency = runFrames(paced);
+
+		BS_TEST_ASSERT(paced.getFrameStartDelay() > 0);
+		BS_TEST_ASSERT(paced.getAverageCoreTime() > paced.getAverageSimTime());
+		BS_TEST_ASSERT(pacedLatency < unpacedLatency);
+
+		BS_LOG(Info, Generic, "Frame pacing - sim {0} ms, core {1} ms: input latency {2} ms without pacing, {3} ms with "
+			"adaptive pacing", SIM_TIME_MS, CORE_TIME_MS, unpacedLatency / 1000.0f, pacedLatency / 1000.0f);
+
+		// Waiting for a specific time point shouldn't return early, nor overshoot it by the whole sleep granularity
+		{
+			static constexpr UINT64 WAIT_TIME = 5500;
+
+			FramePacer pacer;
+			UINT64 maxError = 0;
+			for(UINT32 i = 0; i < 10; i++)
+			{
+				UINT64 target = pacer.getTime() + WAIT_TIME;
+				pacer.waitUntil(target);
+
+				UINT64 time = pacer.getTime();
+				BS_TEST_ASSERT(time >= target);
+				maxError = std::max(maxError, time - target);
+			}
+
+			BS_LOG(Info, Generic, "Frame pacing - maximum wait overshoot: {0} us", maxError);
+		}
+	}
+
+	void CoreTestSuite::testComponentUpdates()
+	{
+		static constexpr UINT32 NUM_COMPONENTS = 100000;
+		static constexpr UINT32 NUM_ITERATIONS = 10;
+
+		// Types are updated in order of priority, and then by type id. Opted out components don't receive updates.
+		{
+			Vector<UINT32> updateLog;
+
+			HSceneObject so = SceneObject::create("Test");
+			auto compA = so->addComponent<UpdateTestComponentA>(ComponentFlags(), &updateLog);
+			auto compB = so->addComponent<UpdateTestComponentB>(ComponentFlags(), &updateLog);
+			auto compNoUpdate = so->addComponent<UpdateTestComponentA>(ComponentFlag::NoUpdate, &updateLog);
+			auto compNoFixed = so->addComponent<UpdateTestComponentB>(ComponentFlag::NoFixedUpdate, &updateLog);
+
+			gSceneManager()._update();
+			gSceneManager()._fixedUpdate();
+
+			BS_TEST_ASSERT(updateLog.size() == 3);
+			BS_TEST_ASSERT(updateLog[0] == TID_UpdateTestComponentA);
+			BS_TEST_ASSERT(updateLog[1] == TID_UpdateTestComponentB && updateLog[2] == TID_UpdateTestComponentB);
+
+			BS_TEST_ASSERT(compNoUpdate->numUpdates == 0 && compNoUpdate->numFixedUpdates == 1);
+			BS_TEST_ASSERT(compNoFixed->numUpdates == 1 && compNoFixed->numFixedUpdates == 0);
+
+			updateLog.clear();
+			gSceneManager().setComponentUpdatePriority<UpdateTestComponentB>(-1);
+			gSceneManager()._update();
+
+			BS_TEST_ASSERT(updateLog.size() == 3);
+			BS_TEST_ASSERT(updateLog[0] == TID_UpdateTestComponentB && updateLog[1] == TID_UpdateTestComponentB);
+			BS_TEST_ASSERT(updateLog[2] == TID_UpdateTestComponentA);
+
+			gSceneManager().setComponentUpdatePriority<UpdateTestComponentB>(0);
+
+			// Destroyed and deactivated components stop receiving updates
+			compB->destroy();
+			gSceneManager()._update();
+
+			HSceneObject inactiveSO = SceneObject::create("Inactive");
+			auto compInactive = inactiveSO->addComponent<UpdateTestComponentA>(ComponentFlags());
+			inactiveSO->setActive(false);
+
+			updateLog.clear();
+			gSceneManager()._update();
+
+			BS_TEST_ASSERT(compB.isDestroyed());
+			BS_TEST_ASSERT(updateLog.size() == 2);
+			BS_TEST_ASSERT(compInactive->numUpdates == 0);
+			BS_TEST_ASSERT(compA->numUpdates == 4);
+
+			so->destroy();
+			inactiveSO->destroy();
+			gSceneManager()._update();
+		}
+
+		// Updates of 100k components, half of which don't implement update()
+		{
+			HSceneObject so = SceneObject::create("Test");
+
+			Vector<HComponent> components;
+			for(UINT32 i = 0; i < NUM_COMPONENTS / 2; i++)
+			{
+				auto updated = so->addComponent<UpdateTestComponentA>(ComponentFlags());
+				auto notUpdated = so->addComponent<UpdateTestComponentB>(ComponentFlag::NoUpdate);
+
+				components.push_back(static_object_cast<Component>(updated));
+				components.push_back(static_object_cast<Component>(notUpdated));
+			}
+
+			gSceneManager()._update();
+
+			// Updating each component through its handle, regardless of whether it implements update() or not
+			Timer timer;
+			for(UINT32 i = 0; i < NUM_ITERATIONS; i++)
+			{
+				for(auto& entry : components)
+					entry->update();
+			}
+
+			const UINT64 handleTime = timer.getMicroseconds() / NUM_ITERATIONS;
+
+			timer.reset();
+			for(UINT32 i = 0; i < NUM_ITERATIONS; i++)
+				gSceneManager()._update();
+
+			const UINT64 bucketTime = timer.getMicroseconds() / NUM_ITERATIONS;
+
+			BS_TEST_ASSERT(static_object_cast<UpdateTestComponentB>(components[1])->numUpdates == NUM_ITERATIONS);
+			BS_TEST_ASSERT(static_object_cast<UpdateTestComponentA>(components[0])->numUpdates == NUM_ITERATIONS * 2 + 1);
+
+			BS_LOG(Info, Generic, "Component update - {0} components, half opted out: {1} ms when updating all through "
+				"handles, {2} ms with per-type buckets", NUM_COMPONENTS, handleTime / 1000.0f, bucketTime / 1000.0f);
+
+			so->destroy();
+			gSceneManager()._update();
+		}
+
+		// Parallel updates of 100k thread-safe components
+		{
+			HSceneObject so = SceneObject::create("Test");
+
+			Vector<HComponent> components;
+			for(UINT32 i = 0; i < NUM_COMPONENTS; i++)
+			{
+				auto component = so->addComponent<UpdateTestComponentA>(ComponentFlag::ParallelUpdate);
+				components.push_back(static_object_cast<Component>(component));
+			}
+
+			gSceneManager()._update();
+
+			Timer timer;
+			for(UINT32 i = 0; i < NUM_ITERATIONS; i++)
+				gSceneManager()._update();
+
+			const UINT64 parallelTime = timer.getMicroseconds() / NUM_ITERATIONS;
+
+			bool allUpdated = true;
+			for(auto& entry : components)
+				allUpdated &= static_object_cast<UpdateTestComponentA>(entry)->numUpdates == NUM_ITERATIONS + 1;
+
+			BS_TEST_ASSERT(allUpdated);
+
+			BS_LOG(Info, Generic, "Component update - {0} thread-safe components on {1} threads: {2} ms",
+				NUM_COMPONENTS, BS_THREAD_HARDWARE_CONCURRENCY, parallelTime / 1000.0f);
+
+			so->destroy();
+			gSceneManager()._update();
+		}
+	}
+
+	void CoreTestSuite::testGameObjectSlots()
+	{
+		static constexpr UINT32 NUM_OBJECTS = 100000;
+		static constexpr UINT32 NUM_ITERATIONS = 10;
+
+		HSceneObject so = SceneObject::create("Test");
+
+		// Destroyed objects can no longer be found, even if a new object reuses the same slot
+		{
+			auto component = so->addComponent<UpdateTestComponentA>(ComponentFlags());
+			BS_TEST_ASSERT(GameObjectManager::instance().getObject(component->getInstanceId()).get() == component.get());
+
+			UINT64 instanceId = component->getInstanceId();
+			HComponent componentCopy = static_object_cast<Component>(component);
+			component->destroy(true);
+
+			BS_TEST_ASSERT(component.isDestroyed() && componentCopy.isDestroyed());
+			BS_TEST_ASSERT(!GameObjectManager::instance().objectExists(instanceId));
+
+			auto newComponent = so->addComponent<UpdateTestComponentA>(ComponentFlags());
+			UINT64 newInstanceId = newComponent->getInstanceId();
+
+			// Slot generation changed, so old handles don't see the new object
+			BS_TEST_ASSERT(component.isDestroyed() && componentCopy.isDestroyed());
+			BS_TEST_ASSERT(component.getInstanceId() == instanceId);
+			BS_TEST_ASSERT(componentCopy != newComponent);
+			BS_TEST_ASSERT(!GameObjectManager::instance().objectExists(instanceId));
+			BS_TEST_ASSERT(GameObjectManager::instance().getObject(newInstanceId).get() == newComponent.get());
+
+			newComponent->destroy(true);
+			BS_TEST_ASSERT(!GameObjectManager::instance().objectExists(newInstanceId));
+		}
+
+		// Transferring instance data to another object makes handles to either of the objects reference it
+		{
+			HSceneObject original = SceneObject::create("Original");
+			HSceneObject replacement = SceneObject::create("Replacement");
+
+			const UINT64 originalId = original->getInstanceId();
+			const UINT64 replacementId = replacement->getInstanceId();
+
+			GameObjectInstanceDataPtr instanceData = original->_getInstanceData();
+			original->destroy(true);
+			BS_TEST_ASSERT(original.isDestroyed());
+
+			replacement->_setInstanceData(instanceData);
+			instanceData = nullptr;
+
+			BS_TEST_ASSERT(!original.isDestroyed() && original.get() == replacement.get());
+			BS_TEST_ASSERT(replacement->getInstanceId() == originalId && replacement.getInstanceId() == originalId);
+			BS_TEST_ASSERT(GameObjectManager::instance().getObject(originalId).get() == replacement.get());
+			BS_TEST_ASSERT(!GameObjectManager::instance().objectExists(replacementId));
+
+			replacement->destroy(true);
+			BS_TEST_ASSERT(original.isDestroyed() && replacement.isDestroyed());
+			BS_TEST_ASSERT(!GameObjectManager::instance().objectExists(originalId));
+		}
+
+		// Updating a prefab instance rebuilds its objects, but handles to the old objects reference the new ones
+		{
+			HSceneObject prefabRoot = SceneObject::create("PrefabRoot");
+			HSceneObject prefabChild = SceneObject::create("PrefabChild");
+			prefabChild->setParent(prefabRoot);
+
+			GameObjectHandle<CloneTestComponent> prefabComponent = prefabChild->addComponent<CloneTestComponent>();
+			prefabComponent->target = prefabRoot;
+
+			HPrefab prefab = Prefab::create(prefabRoot, false);
+
+			HSceneObject instance = prefab->instantiate();
+			HSceneObject instanceChild = instance->getChild(0);
+			GameObjectHandle<CloneTestComponent> instanceComponent = instanceChild->getComponent<CloneTestComponent>();
+			const UINT64 childId = instanceChild->getInstanceId();
+
+			HSceneObject external = SceneObject::create("External");
+			GameObjectHandle<CloneTestComponent> externalComponent = external->addComponent<CloneTestComponent>();
+			externalComponent->target = instanceChild;
+			externalComponent->targetComponent = static_object_cast<Component>(instanceComponent);
+
+			prefabChild->setName("PrefabChildModified");
+			prefab->update(prefabRoot);
+			PrefabUtility::updateFromPrefab(instance);
+
+			HSceneObject newChild = instance->getChild(0);
+			GameObjectHandle<CloneTestComponent> newComponent = newChild->getComponent<CloneTestComponent>();
+
+			BS_TEST_ASSERT(newChild->getName() == "PrefabChildModified");
+			BS_TEST_ASSERT(!instanceChild.isDestroyed() && instanceChild.get() == newChild.get());
+			BS_TEST_ASSERT(!instanceComponent.isDestroyed() && instanceComponent.get() == newComponent.get());
+			BS_TEST_ASSERT(newChild->getInstanceId() == childId);
+			BS_TEST_ASSERT(newComponent->target.get() == instance.get());
+			BS_TEST_ASSERT(externalComponent->target.get() == newChild.get());
+			BS_TEST_ASSERT(externalComponent->targetComponent.get() == newComponent.get());
+
+			instance->destroy(true);
+			BS_TEST_ASSERT(instanceChild.isDestroyed() && newChild.isDestroyed() && externalComponent->target == nullptr);
+
+			external->destroy(true);
+			prefabRoot->destroy(true);
+		}
+
+		// Benchmark object registration and destruction, and handle accesses
+		{
+			const UINT32 numObjectsBefore = GameObjectManager::instance().getNumObjects();
+
+			Vector<HComponent> handles;
+			handles.reserve(NUM_OBJECTS);
+
+			Timer timer;
+			for(UINT32 i = 0; i < NUM_OBJECTS; i++)
+			{
+				SPtr<UpdateTestComponentA> component = bs_shared_ptr_new<UpdateTestComponentA>(so, ComponentFlags());
+				GameObjectHandleBase handle = GameObjectManager::instance().registerObject(component);
+
+				handles.push_back(static_object_cast<Component>(handle));
+			}
+
+			const UINT64 registerTime = timer.getMicroseconds();
+
+			BS_TEST_ASSERT(GameObjectManager::instance().getNumObjects() == numObjectsBefore + NUM_OBJECTS);
+
+			timer.reset();
+			bool allFound = true;
+			for(auto& entry : handles)
+				allFound &= GameObjectManager::instance().objectExists(entry->getInstanceId());
+
+			const UINT64 lookupTime = timer.getMicroseconds();
+			BS_TEST_ASSERT(allFound);
+
+			UINT32 numLinked = 0;
+			timer.reset();
+			for(UINT32 i = 0; i < NUM_ITERATIONS; i++)
+			{
+				for(auto& entry : handles)
+					numLinked += entry->getLinkId() != (UINT32)-1 ? 1 : 0;
+			}
+
+			const UINT64 accessTime = timer.getMicroseconds();
+			BS_TEST_ASSERT(numLinked == 0);
+
+			timer.reset();
+			Vector<HComponent> handleCopies(handles);
+			const UINT64 copyTime = timer.getMicroseconds();
+
+			timer.reset();
+			for(auto& entry : handles)
+				GameObjectManager::instance().unregisterObject(entry);
+
+			const UINT64 unregisterTime = timer.getMicroseconds();
+
+			bool allDestroyed = true;
+			for(auto& entry : handleCopies)
+				allDestroyed &= entry.isDestroyed();
+
+			BS_TEST_ASSERT(allDestroyed);
+			BS_TEST_ASSERT(GameObjectManager::instance().getNumObjects() == numObjectsBefore);
+
+			// New objects reuse the freed slots, but handles to the destroyed objects must remain invalid
+			Vector<HComponent> newHandles;
+			newHandles.reserve(NUM_OBJECTS);
+
+			for(UINT32 i = 0; i < NUM_OBJECTS; i++)
+			{
+				SPtr<UpdateTestComponentA> component = bs_shared_ptr_new<UpdateTestComponentA>(so, ComponentFlags());
+				GameObjectHandleBase handle = GameObjectManager::instance().registerObject(component);
+
+				newHandles.push_back(static_object_cast<Component>(handle));
+			}
+
+			allDestroyed = true;
+			for(auto& entry : handleCopies)
+				allDestroyed &= entry.isDestroyed();
+
+			bool allAlive = true;
+			for(auto& entry : newHandles)
+				allAlive &= !entry.isDestroyed();
+
+			BS_TEST_ASSERT(allDestroyed && allAlive);
+
+			for(auto& entry : newHandles)
+				GameObjectManager::instance().unregisterObject(entry);
+
+			BS_TEST_ASSERT(GameObjectManager::instance().getNumObjects() == numObjectsBefore);
+
+			BS_LOG(Info, Generic, "Game object slots - {0} objects: register {1} ms, lookup {2} ms, unregister {3} ms, "
+				"handle access {4} ns, handle copy {5} ns", NUM_OBJECTS, registerTime / 1000.0f, lookupTime / 1000.0f,
+				unregisterTime / 1000.0f, accessTime * 1000.0f / (NUM_OBJECTS * (float)NUM_ITERATIONS),
+				copyTime * 1000.0f / NUM_OBJECTS);
+		}
+
+		so->destroy(true);
+	}
+
+	void CoreTestSuite::testCloneMultiple()
+	{
+		static constexpr UINT32 NUM_COPIES = 4;
+
+		// Hierarchy with references between its own objects, and to an object outside of it
+		HSceneObject external = SceneObject::create("External");
+		HSceneObject root = SceneObject::create("Root");
+		HSceneObject child = SceneObject::create("Child");
+		child->setParent(root);
+
+		HSceneObject grandChild = SceneObject::create("GrandChild");
+		grandChild->setParent(child);
+
+		GameObjectHandle<CloneTestComponent> rootComponent = root->addComponent<CloneTestComponent>();
+		GameObjectHandle<CloneTestComponent> childComponent = child->addComponent<CloneTestComponent>();
+
+		rootComponent->target = grandChild;
+		rootComponent->targetComponent = static_object_cast<Component>(childComponent);
+		rootComponent->external = external;
+		childComponent->target = root;
+		childComponent->targetComponent = static_object_cast<Component>(rootComponent);
+
+		Vector<HSceneObject> copies = root->cloneMultiple(NUM_COPIES);
+		BS_TEST_ASSERT(copies.size() == NUM_COPIES);
+
+		UnorderedSet<UINT64> targetIds;
+		for(auto& copy : copies)
+		{
+			BS_TEST_ASSERT(copy != root);
+			BS_TEST_ASSERT(copy->getNumChildren() == 1);
+
+			HSceneObject copyChild = copy->getChild(0);
+			BS_TEST_ASSERT(copyChild->getNumChildren() == 1);
+
+			HSceneObject copyGrandChild = copyChild->getChild(0);
+			GameObjectHandle<CloneTestComponent> copyRootComponent = copy->getComponent<CloneTestComponent>();
+			GameObjectHandle<CloneTestComponent> copyChildComponent = copyChild->getComponent<CloneTestComponent>();
+
+			BS_TEST_ASSERT(copyRootComponent != nullptr && copyChildComponent != nullptr);
+			BS_TEST_ASSERT(copyRootComponent != rootComponent && copyChildComponent != childComponent);
+
+			// References within the hierarchy must point into the same copy
+			BS_TEST_ASSERT(copyRootComponent->target == copyGrandChild);
+			BS_TEST_ASSERT(copyRootComponent->targetComponent.get() == copyChildComponent.get());
+			BS_TEST_ASSERT(copyChildComponent->target == copy);
+			BS_TEST_ASSERT(copyChildComponent->targetComponent.get() == copyRootComponent.get());
+
+			// References outside of the hierarchy are kept
+			BS_TEST_ASSERT(copyRootComponent->external == external);
+			BS_TEST_ASSERT(copyChildComponent->external == nullptr);
+
+			targetIds.insert(copyRootComponent->target->getInstanceId());
+		}
+
+		BS_TEST_ASSERT(targetIds.size() == NUM_COPIES);
+
+		// Original hierarchy must remain unchanged
+		BS_TEST_ASSERT(rootComponent->target == grandChild);
+		BS_TEST_ASSERT(childComponent->targetComponent.get() == rootComponent.get());
+
+		for(auto& copy : copies)
+			copy->destroy(true);
+
+		root->destroy(true);
+		external->destroy(true);
+
+		// Compare batched cloning against cloning each copy separately, and against cloning through serialization
+		static constexpr UINT32 NUM_TIMED_COPIES = 500;
+		static constexpr UINT32 NUM_TIMED_CHILDREN = 10;
+
+		HSceneObject timedRoot = SceneObject::create("Root");
+		GameObjectHandle<CloneTestComponent> timedRootComponent = timedRoot->addComponent<CloneTestComponent>();
+		for(UINT32 i = 0; i < NUM_TIMED_CHILDREN; i++)
+		{
+			HSceneObject timedChild = SceneObject::create("Child");
+			timedChild->setParent(timedRoot);
+
+			GameObjectHandle<CloneTestComponent> timedComponent = timedChild->addComponent<CloneTestComponent>();
+			timedComponent->target = timedRoot;
+			timedComponent->targetComponent = static_object_cast<Component>(timedRootComponent);
+			timedRootComponent->target = timedChild;
+		}
+
+		Vector<HSceneObject> timedCopies;
+		timedCopies.reserve(NUM_TIMED_COPIES * 3);
+
+		Timer timer;
+		Vector<HSceneObject> batchCopies = timedRoot->cloneMultiple(NUM_TIMED_COPIES);
+		const UINT64 batchTime = timer.getMicroseconds();
+		timedCopies.insert(timedCopies.end(), batchCopies.begin(), batchCopies.end());
+
+		timer.reset();
+		for(UINT32 i = 0; i < NUM_TIMED_COPIES; i++)
+			timedCopies.push_back(timedRoot->clone());
+
+		const UINT64 cloneTime = timer.getMicroseconds();
+
+		// Serializes the hierarchy and decodes it for each copy, same as BinaryCloner
+		timer.reset();
+		for(UINT32 i = 0; i < NUM_TIMED_COPIES; i++)
+		{
+			SPtr<MemoryDataStream> stream = bs_shared_ptr_new<MemoryDataStream>();
+			BinarySerializer serializer;
+			serializer.encode(timedRoot.get(), stream);
+
+			CoreSerializationContext serzContext;
+			serzContext.goState = bs_shared_ptr_new<GameObjectDeserializationState>(
+				GODM_RestoreExternal | GODM_UseNewIds | GODM_UseNewUUID);
+
+			stream->seek(0);
+			SPtr<SceneObject> copy = std::static_pointer_cast<SceneObject>(
+				serializer.decode(stream, (UINT32)stream->size(), BinarySerializerFlag::None, &serzContext));
+			timedCopies.push_back(copy->getHandle());
+		}
+
+		const UINT64 serializedTime = timer.getMicroseconds();
+
+		BS_TEST_ASSERT(batchCopies.size() == NUM_TIMED_COPIES);
+		BS_TEST_ASSERT(batchCopies.back()->getNumChildren() == NUM_TIMED_CHILDREN);
+
+		BS_LOG(Info, Generic, "Clone - {0} copies of {1} objects: cloneMultiple() {2} ms, clone() {3} ms, "
+			"serialization {4} ms", NUM_TIMED_COPIES, NUM_TIMED_CHILDREN + 1, batchTime / 1000.0f, cloneTime / 1000.0f,
+			serializedTime / 1000.0f);
+
+		for(auto& copy : timedCopies)
+			copy->destroy(true);
+
+		timedRoot->destroy(true);
+	}
+
+	void CoreTestSuite::testResourceArchive()
+	{
+		static constexpr UINT32 NUM_RESOURCES = 10000;
+
+		const Path folder = FileSystem::getTempDirectoryPath() + "bsfResourceArchiveTest/";
+		const Path archivePath = folder + "Resources.pak";
+		FileSystem::createDir(folder);
+
+		// Save each resource in its own file, registered in the default manifest
+		Vector<UUID> uuids(NUM_RESOURCES);
+		Vector<Path> paths(NUM_RESOURCES);
+		Vector<String> data(NUM_RESOURCES);
+		{
+			Random random(1234);
+			for(UINT32 i = 0; i < NUM_RESOURCES; i++)
+			{
+				const UINT32 length = random.getRange(64, 512);
+				data[i].resize(length);
+
+				// Mix of repeated and random characters, so some of the data is compressible
+				for(UINT32 j = 0; j < length; j++)
+					data[i][j] = (char)('a' + ((j % 16) < 8 ? i % 26 : random.getRange(0, 25)));
+
+				paths[i] = folder + ("Resource" + toString(i) + ".asset");
+
+				HResource resource = ArchiveTestResource::create(data[i]);
+				gResources().save(resource, paths[i], true);
+				uuids[i] = resource.getUUID();
+			}
+		}
+
+		// Archive entries contain the same data as the resource files, and can be partially read
+		{
+			ResourceArchiveWriter writer(true, 64, 128);
+			for(UINT32 i = 0; i < 10; i++)
+				writer.addFile(uuids[i], paths[i]);
+
+			const Path smallArchivePath = folder + "Small.pak";
+			BS_TEST_ASSERT(writer.write(smallArchivePath));
+
+			SPtr<ResourceArchive> archive = ResourceArchive::open(smallArchivePath);
+			BS_TEST_ASSERT(archive != nullptr && archive->getNumEntries() == 10);
+
+			if(archive)
+			{
+				for(UINT32 i = 0; i < 10; i++)
+				{
+					SPtr<MemoryDataStream> fileData = bs_shared_ptr_new<MemoryDataStream>(FileSystem::openFile(paths[i]));
+					SPtr<MemoryDataStream> entryData = archive->read(uuids[i]);
+					SPtr<MemoryDataStream> partialData = archive->read(uuids[i], 16);
+
+					BS_TEST_ASSERT(archive->contains(uuids[i]));
+					BS_TEST_ASSERT(entryData != nullptr && entryData->size() == fileData->size());
+					BS_TEST_ASSERT(partialData != nullptr && partialData->size() == std::min((size_t)128, fileData->size()));
+
+					if(entryData && partialData)
+					{
+						BS_TEST_ASSERT(memcmp(entryData->data(), fileData->data(), fileData->size()) == 0);
+						BS_TEST_ASSERT(memcmp(partialData->data(), fileData->data(), partialData->size()) == 0);
+					}
+				}
+
+				BS_TEST_ASSERT(!archive->contains(uuids[10]));
+			}
+		}
+
+		// Load all resources from loose files
+		UINT32 numValid = 0;
+		Timer timer;
+		{
+			Vector<HResource> resources(NUM_RESOURCES);
+			for(UINT32 i = 0; i < NUM_RESOURCES; i++)
+				resources[i] = gResources().loadFromUUID(uuids[i], false, ResourceLoadFlag::LoadDependencies);
+
+			for(UINT32 i = 0; i < NUM_RESOURCES; i++)
+			{
+				auto resource = static_resource_cast<ArchiveTestResource>(resources[i]);
+				numValid += resource.isLoaded() && resource->data == data[i] ? 1 : 0;
+			}
+		}
+
+		const UINT64 looseTime = timer.getMicroseconds();
+		BS_TEST_ASSERT(numValid == NUM_RESOURCES);
+
+		// Pack the resources and remove them from the manifest, so they can only be found in the archive
+		timer.reset();
+		{
+			ResourceArchiveWriter writer;
+			for(UINT32 i = 0; i < NUM_RESOURCES; i++)
+				writer.addFile(uuids[i], paths[i]);
+
+			BS_TEST_ASSERT(writer.write(archivePath));
+		}
+
+		const UINT64 packTime = timer.getMicroseconds();
+
+		SPtr<ResourceManifest> manifest = gResources().getResourceManifest("Default");
+		for(auto& uuid : uuids)
+			manifest->unregisterResource(uuid);
+
+		SPtr<ResourceArchive> archive = gResources().mountArchive(archivePath);
+		BS_TEST_ASSERT(archive != nullptr && archive->getNumEntries() == NUM_RESOURCES);
+
+		// Load all resources from the archive
+		numValid = 0;
+		timer.reset();
+		{
+			Vector<HResource> resources(NUM_RESOURCES);
+			for(UINT32 i = 0; i < NUM_RESOURCES; i++)
+				resources[i] = gResources().loadFromUUID(uuids[i], false, ResourceLoadFlag::LoadDependencies);
+
+			for(UINT32 i = 0; i < NUM_RESOURCES; i++)
+			{
+				auto resource = static_resource_cast<ArchiveTestResource>(resources[i]);
+				numValid += resource.isLoaded() && resource->data == data[i] ? 1 : 0;
+			}
+		}
+
+		const UINT64 archiveTime = timer.getMicroseconds();
+		BS_TEST_ASSERT(numValid == NUM_RESOURCES);
+
+		gResources().unmountArchive(archive);
+		BS_TEST_ASSERT(!gResources().loadFromUUID(uuids[0], false, ResourceLoadFlag::LoadDependencies).isLoaded());
+
+		archive = nullptr;
+		FileSystem::remove(folder);
+
+		BS_LOG(Info, Generic, "Resource archive - loading {0} resources: {1} ms from loose files, {2} ms from archive "
+			"(packed in {3} ms)", NUM_RESOURCES, looseTime / 1000.0f, archiveTime / 1000.0f, packTime / 1000.0f);
+	}
+
+	void CoreTestSuite::testTextureStreaming()
+	{
+		const Path folder = FileSystem::getTempDirectoryPath() + "bsfTextureStreamingTest/";
+		FileSystem::createDir(folder);
+
+		// 512x512 textures with a full mip chain, out of which the 512, 256 and 128 pixel mips are streamed
+		const auto createTexture = [&folder](const String& name, bool streamable)
+		{
+			TEXTURE_DESC desc;
+			desc.width = 512;
+			desc.height = 512;
+			desc.numMips = 9;
+			desc.format = PF_RGBA8;
+
+			const Path path = folder + (name + ".asset");
+			{
+				HTexture texture = Texture::create(desc);
+				texture->setStreamable(streamable);
+
+				gResources().save(texture, path, true);
+			}
+
+			gResources().unloadAllUnused();
+			return gResources().load<Texture>(path);
+		};
+
+		TextureStreamingManager& streaming = TextureStreamingManager::instance();
+
+		// Non-streamable textures are fully resident
+		HTexture staticTexture = createTexture("Static", false);
+		BS_TEST_ASSERT(staticTexture.isLoaded());
+		if (!staticTexture.isLoaded())
+			return;
+
+		BS_TEST_ASSERT(!staticTexture->isStreaming());
+		BS_TEST_ASSERT(staticTexture->getResidentMip() == 0);
+		BS_TEST_ASSERT(staticTexture->getCore()->getProperties().getWidth() == 512);
+
+		// Only the least detailed mips are resident after load
+		HTexture textureA = createTexture("A", true);
+		HTexture textureB = createTexture("B", true);
+		BS_TEST_ASSERT(textureA.isLoaded() && textureB.isLoaded());
+		if (!textureA.isLoaded() || !textureB.isLoaded())
+			return;
+
+		BS_TEST_ASSERT(textureA->isStreaming());
+		BS_TEST_ASSERT(textureA->getNumStreamedMips() == 3);
+		BS_TEST_ASSERT(textureA->getResidentMip() == 3);
+		BS_TEST_ASSERT(textureA->getCore()->getProperties().getWidth() == 64);
+		BS_TEST_ASSERT(textureA->getCore()->getProperties().getNumMipmaps() == 6);
+		BS_TEST_ASSERT(textureA->getCore()->getStreamingId() == textureA->_getStreamingId());
+
+		streaming.update();
+		BS_TEST_ASSERT(streaming.getNumTextures() == 2);
+		BS_TEST_ASSERT(textureA->getResidentMip() == 3);
+		BS_TEST_ASSERT(streaming.getResidentMemory() == textureA->_getResidentSize(3) * 2);
+
+		// Mips get loaded depending on the on-screen size
+		streaming.notifyUsage(textureA->_getStreamingId(), 512.0f);
+		streaming.notifyUsage(textureB->_getStreamingId(), 100.0f);
+		streaming.update();
+		streaming.waitUntilLoaded();
+
+		BS_TEST_ASSERT(textureA->getResidentMip() == 0);
+		BS_TEST_ASSERT(textureA->getCore()->getProperties().getWidth() == 512);
+		BS_TEST_ASSERT(textureA->getCore()->getProperties().getNumMipmaps() == 9);
+		BS_TEST_ASSERT(textureB->getResidentMip() == 2);
+		BS_TEST_ASSERT(textureB->getCore()->getProperties().getWidth() == 128);
+
+		// Mips no longer required are evicted
+		streaming.notifyUsage(textureA->_getStreamingId(), 200.0f);
+		streaming.notifyUsage(textureB->_getStreamingId(), 100.0f);
+		streaming.update();
+		BS_TEST_ASSERT(textureA->getResidentMip() == 1);
+		BS_TEST_ASSERT(textureB->getResidentMip() == 2);
+
+		// Textures appearing larger on screen get priority when over budget, and the budget is never exceeded
+		const UINT64 budget = textureA->_getResidentSize(0) + textureB->_getResidentSize(3) + 1024;
+		streaming.setMemoryBudget(budget);
+
+		for (UINT32 i = 0; i < 3; i++)
+		{
+			streaming.notifyUsage(textureA->_getStreamingId(), 1024.0f);
+			streaming.notifyUsage(textureB->_getStreamingId(), 512.0f);
+			streaming.update();
+			streaming.waitUntilLoaded();
+
+			BS_TEST_ASSERT(streaming.getResidentMemory() <= budget);
+		}
+
+		BS_TEST_ASSERT(textureA->getResidentMip() == 0);
+		BS_TEST_ASSERT(textureB->getResidentMip() == 3);
+
+		// Swapping priorities evicts the mips of the first texture before loading the mips of the second
+		for (UINT32 i = 0; i < 3; i++)
+		{
+			streaming.notifyUsage(textureA->_getStreamingId(), 512.0f);
+			streaming.notifyUsage(textureB->_getStreamingId(), 1024.0f);
+			streaming.update();
+			streaming.waitUntilLoaded();
+
+			BS_TEST_ASSERT(streaming.getResidentMemory() <= budget);
+		}
+
+		BS_TEST_ASSERT(textureA->getResidentMip() == 3);
+		BS_TEST_ASSERT(textureB->getResidentMip() == 0);
+
+		// Unused textures have their streamed mips evicted
+		streaming.setMemoryBudget(512 * 1024 * 1024);
+		for (UINT32 i = 0; i < 10; i++)
+			streaming.update();
+
+		streaming.waitUntilLoaded();
+
+		BS_TEST_ASSERT(textureA->getResidentMip() == 3);
+		BS_TEST_ASSERT(textureB->getResidentMip() == 3);
+
+		// Unloaded textures are no longer tracked
+		gResources().release(textureA);
+		gResources().release(textureB);
+		gResources().release(staticTexture);
+		textureA = nullptr;
+		textureB = nullptr;
+		staticTexture = nullptr;
+		gResources().unloadAllUnused();
+
+		streaming.update();
+		BS_TEST_ASSERT(streaming.getNumTextures() == 0);
+
+		CoreObjectManager::instance().syncToCore();
+		gCoreThread().submitAll(true);
+
+		FileSystem::remove(folder);
+	}
+
+	void CoreTestSuite::testParamBlockArena()
+	{
+		static constexpr UINT32 NUM_BUFFERS = 100;
+		static constexpr UINT32 BUFFER_SIZE = 200;
+		static constexpr UINT32 ALIGNMENT = 256;
+
+		auto test = [this]()
+		{
+			const RenderStatsData& stats = RenderStats::instance().getData();
+
+			Vector<SPtr<ct::GpuParamBlockBuffer>> buffers(NUM_BUFFERS);
+			for (UINT32 i = 0; i < NUM_BUFFERS; i++)
+			{
+				buffers[i] = ct::GpuParamBlockBuffer::create(BUFFER_SIZE);
+
+				UINT8 data[BUFFER_SIZE];
+				memset(data, (int)i, sizeof(data));
+				buffers[i]->write(0, data, sizeof(data));
+			}
+
+			// Flushing buffers individually writes each one separately
+			UINT64 numWrites = stats.numResourceWrites;
+			for (auto& entry : buffers)
+				entry->flushToGPU();
+
+			BS_TEST_ASSERT(stats.numResourceWrites - numWrites == NUM_BUFFERS);
+
+			// Allocating them from an arena uploads all of them in a single write, once the first one gets flushed
+			ct::GpuParamBlockArena arena(64 * 1024, ALIGNMENT, true);
+
+			const UINT64 numCreated = stats.numObjectsCreated;
+			for (UINT32 frame = 0; frame < 3; frame++)
+			{
+				arena.begin();
+				for (auto& entry : buffers)
+					BS_TEST_ASSERT(arena.allocate(entry));
+
+				numWrites = stats.numResourceWrites;
+				for (auto& entry : buffers)
+					entry->flushToGPU();
+
+				BS_TEST_ASSERT(stats.numResourceWrites - numWrites == 1);
+			}
+
+			// Pages are reused between frames
+			BS_TEST_ASSERT(arena.getNumPages() == 1);
+			BS_TEST_ASSERT(stats.numObjectsCreated - numCreated == 1);
+
+			const ct::GpuParamBlockBuffer* page = buffers[0]->getBindBuffer();
+			for (UINT32 i = 0; i < NUM_BUFFERS; i++)
+			{
+				BS_TEST_ASSERT(buffers[i]->getBindBuffer() == page);
+				BS_TEST_ASSERT(buffers[i]->getBindOffset() == i * ALIGNMENT);
+				BS_TEST_ASSERT(page->getCachedData()[buffers[i]->getBindOffset()] == (UINT8)i);
+			}
+
+			// Buffers modified after allocation fall back to writing their own contents
+			const UINT8 value = 0xFF;
+			buffers[0]->write(0, &value, sizeof(value));
+
+			numWrites = stats.numResourceWrites;
+			buffers[0]->flushToGPU();
+
+			BS_TEST_ASSERT(stats.numResourceWrites - numWrites == 1);
+			BS_TEST_ASSERT(buffers[0]->getBindBuffer() == buffers[0].get());
+			BS_TEST_ASSERT(buffers[0]->getBindOffset() == 0);
+
+			// Allocations made after a flush only upload the new range, and are placed after the previous ones
+			BS_TEST_ASSERT(arena.allocate(buffers[0]));
+			BS_TEST_ASSERT(buffers[0]->getBindOffset() == NUM_BUFFERS * ALIGNMENT);
+
+			numWrites = stats.numResourceWrites;
+			buffers[0]->flushToGPU();
+			buffers[1]->flushToGPU();
+			BS_TEST_ASSERT(stats.numResourceWrites - numWrites == 1);
+			BS_TEST_ASSERT(arena.getAllocatedSize() == NUM_BUFFERS * ALIGNMENT + BUFFER_SIZE);
+
+			arena.begin();
+
+			// Allocations spill over into new pages once a page is full
+			ct::GpuParamBlockArena smallArena(16 * ALIGNMENT, ALIGNMENT, true);
+			smallArena.begin();
+			for (auto& entry : buffers)
+				smallArena.allocate(entry);
+
+			numWrites = stats.numResourceWrites;
+			smallArena.flush();
+
+			const UINT32 numPages = Math::divideAndRoundUp(NUM_BUFFERS, 16U);
+			BS_TEST_ASSERT(smallArena.getNumPages() == numPages);
+			BS_TEST_ASSERT(stats.numResourceWrites - numWrites == numPages);
+
+			// New frame releases the allocations, and buffers write their own contents again
+			smallArena.begin();
+			BS_TEST_ASSERT(buffers[0]->getBindBuffer() == buffers[0].get());
+
+			numWrites = stats.numResourceWrites;
+			for (auto& entry : buffers)
+				entry->flushToGPU();
+
+			BS_TEST_ASSERT(stats.numResourceWrites - numWrites == NUM_BUFFERS);
+
+			// Without sub-range support buffers are flushed normally
+			ct::GpuParamBlockArena unsupportedArena(64 * 1024, ALIGNMENT, false);
+			unsupportedArena.begin();
+
+			buffers[0]->write(0, &value, sizeof(value));
+			numWrites = stats.numResourceWrites;
+			BS_TEST_ASSERT(!unsupportedArena.allocate(buffers[0]));
+			BS_TEST_ASSERT(stats.numResourceWrites - numWrites == 1);
+			BS_TEST_ASSERT(buffers[0]->getBindBuffer() == buffers[0].get());
+			BS_TEST_ASSERT(unsupportedArena.getNumPages() == 0);
+		};
+
+		gCoreThread().queueCommand(test, CTQF_InternalQueue | CTQF_BlockUntilComplete);
+	}
+
+	void CoreTestSuite::testResourcePoolAliasing()
+	{
+		static constexpr UINT32 NUM_PASSES = 4;
+		static constexpr UINT32 SIZE = 256;
+		static constexpr UINT64 TEX_SIZE = SIZE * SIZE * 4;
+
+		auto test = [this]()
+		{
+			ct::GpuResourcePool pool;
+			const ct::GpuResourcePoolStats& stats = pool.getStats();
+
+			const auto texDesc = ct::POOLED_RENDER_TEXTURE_DESC::create2D(PF_RGBA8, SIZE, SIZE, TU_RENDERTARGET);
+			const auto bufferDesc = ct::POOLED_STORAGE_BUFFER_DESC::createStructured(16, 1024);
+
+			// Chain of passes where each pass reads the output of the previous one, which is released right after. Only
+			// two outputs are ever alive at the same time, so the passes share two textures.
+			auto renderChain = [&pool]()
+			{
+				Vector<SPtr<ct::Texture>> textures;
+
+				SPtr<ct::PooledRenderTexture> previous;
+				for (UINT32 i = 0; i < NUM_PASSES; i++)
+				{
+					SPtr<ct::PooledRenderTexture> output = pool.get(
+						ct::POOLED_RENDER_TEXTURE_DESC::create2D(PF_RGBA8, SIZE, SIZE, TU_RENDERTARGET));
+
+					textures.push_back(output->texture);
+					previous = output;
+				}
+
+				return textures;
+			};
+
+			for (UINT32 frame = 0; frame < 3; frame++)
+			{
+				pool.resetStats();
+
+				Vector<SPtr<ct::Texture>> textures = renderChain();
+				BS_TEST_ASSERT(textures[0] != textures[1]);
+				BS_TEST_ASSERT(textures[0] == textures[2]);
+				BS_TEST_ASSERT(textures[1] == textures[3]);
+
+				BS_TEST_ASSERT(stats.peakUsedMemory - stats.baseUsedMemory == 2 * TEX_SIZE);
+				BS_TEST_ASSERT(stats.requestedMemory == NUM_PASSES * TEX_SIZE);
+				BS_TEST_ASSERT(stats.numAliased == NUM_PASSES - 2);
+
+				// Pooled textures are kept between frames rather than allocated again
+				BS_TEST_ASSERT(stats.allocatedMemory == 2 * TEX_SIZE);
+				pool.update();
+			}
+
+			// Resources with overlapping lifetimes, or different parameters, don't share memory
+			pool.resetStats();
+			{
+				SPtr<ct::PooledRenderTexture> texA = pool.get(texDesc);
+				SPtr<ct::PooledRenderTexture> texB = pool.get(texDesc);
+				SPtr<ct::PooledRenderTexture> texC = pool.get(texDesc);
+				SPtr<ct::PooledStorageBuffer> buffer = pool.get(bufferDesc);
+
+				BS_TEST_ASSERT(texA->texture != texB->texture && texB->texture != texC->texture);
+				BS_TEST_ASSERT(stats.peakUsedMemory == 3 * TEX_SIZE + 16 * 1024);
+				BS_TEST_ASSERT(pool.getUsedMemory() == stats.peakUsedMemory);
+				BS_TEST_ASSERT(stats.numAliased == 0);
+			}
+
+			// Released buffers are shared with later requests
+			{
+				SPtr<ct::PooledStorageBuffer> buffer = pool.get(bufferDesc);
+				BS_TEST_ASSERT(stats.numAliased == 1);
+				BS_TEST_ASSERT(stats.allocatedMemory == 3 * TEX_SIZE + 16 * 1024);
+			}
+
+			// The most recently used texture is preferred, so the remaining ones age out of the pool
+			for (UINT32 frame = 0; frame < 3; frame++)
+			{
+				pool.update();
+				SPtr<ct::PooledRenderTexture> tex = pool.get(texDesc);
+			}
+
+			BS_TEST_ASSERT(pool.getUsedMemory() == 0);
+			BS_TEST_ASSERT(stats.allocatedMemory == TEX_SIZE);
+
+			pool.prune(0);
+			BS_TEST_ASSERT(stats.allocatedMemory == 0);
+		};
+
+		gCoreThread().queueCommand(test, CTQF_InternalQueue | CTQF_BlockUntilComplete);
+	}
+
+	void CoreTestSuite::testParallelCommandRecording()
+	{
+		static constexpr UINT32 NUM_WORK = 8;
+		static constexpr UINT32 NUM_LIGHTS = 256;
+		static constexpr UINT32 NUM_OBJECTS = 4096;
+
+		auto test = [this]()
+		{
+			// Each piece of work records into its own command buffer, which is reused on later frames
+			ct::ParallelCommandRecorder recorder("Test", true);
+
+			Vector<ct::CommandBuffer*> firstFrameBuffers;
+			for (UINT32 frame = 0; frame < 3; frame++)
+			{
+				Vector<ct::CommandBuffer*> buffers(NUM_WORK, nullptr);
+				for (UINT32 i = 0; i < NUM_WORK; i++)
+				{
+					ct::CommandBuffer** output = &buffers[i];
+					recorder.record([output]() { *output = ct::RenderAPI::_getThreadCommandBuffer().get(); });
+				}
+
+				recorder.submit();
+
+				std::sort(buffers.begin(), buffers.end());
+				BS_TEST_ASSERT(buffers[0] != nullptr);
+				BS_TEST_ASSERT(std::unique(buffers.begin(), buffers.end()) == buffers.end());
+				BS_TEST_ASSERT(recorder.getNumCommandBuffers() == NUM_WORK);
+
+				if (frame == 0)
+					firstFrameBuffers = buffers;
+				else
+					BS_TEST_ASSERT(buffers == firstFrameBuffers);
+			}
+
+			BS_TEST_ASSERT(ct::RenderAPI::_getThreadCommandBuffer() == nullptr);
+
+			// Without parallel recording work executes immediately, recording into the main command buffer
+			ct::ParallelCommandRecorder serialRecorder("Test", false);
+
+			bool executed = false;
+			bool usedThreadBuffer = true;
+			serialRecorder.record([&executed, &usedThreadBuffer]()
+			{
+				executed = true;
+				usedThreadBuffer = ct::RenderAPI::_getThreadCommandBuffer() != nullptr;
+			});
+
+			BS_TEST_ASSERT(executed);
+			BS_TEST_ASSERT(!usedThreadBuffer);
+			BS_TEST_ASSERT(serialRecorder.getNumCommandBuffers() == 0);
+			serialRecorder.submit();
+
+			// Shadow map rendering for many lights, each culling the scene against its frustum and drawing the visible
+			// objects
+			Random random(7);
+
+			Vector<Sphere> objects(NUM_OBJECTS);
+			for (auto& entry : objects)
+				entry = Sphere(random.getPointInSphere() * 500.0f, 1.0f + random.getUNorm() * 4.0f);
+
+			const ConvexVolume localFrustum(Matrix4::projectionPerspective(Degree(60.0f), 1.0f, 0.05f, 200.0f));
+
+			Vector<ConvexVolume> lightFrustums(NUM_LIGHTS);
+			for (auto& entry : lightFrustums)
+			{
+				const Quaternion rotation(random.getUnitVector(), Degree(random.getUNorm() * 360.0f));
+				const Matrix4 worldMatrix = Matrix4::TRS(random.getPointInSphere() * 500.0f, rotation, Vector3::ONE);
+
+				Vector<Plane> planes;
+				for (auto& plane : localFrustum.getPlanes())
+					planes.push_back(worldMatrix.multiplyAffine(plane));
+
+				entry = ConvexVolume(planes);
+			}
+
+			Vector<UINT32> numVisible(NUM_LIGHTS);
+			auto renderLights = [&objects, &lightFrustums, &numVisible](UINT32 start, UINT32 end)
+			{
+				ct::RenderAPI& rapi = ct::RenderAPI::instance();
+				for (UINT32 i = start; i < end; i++)
+				{
+					numVisible[i] = 0;
+					rapi.clearRenderTarget(FBT_DEPTH);
+
+					for (auto& object : objects)
+					{
+						if (!lightFrustums[i].intersects(object))
+							continue;
+
+						rapi.drawIndexed(0, 36, 0, 24);
+						numVisible[i]++;
+					}
+				}
+			};
+
+			auto renderShadows = [&renderLights](ct::ParallelCommandRecorder& recorder)
+			{
+				UINT32 numBatches = 1;
+				if (recorder.isParallel())
+					numBatches = std::max(TaskScheduler::instance().getNumWorkers(), 1U);
+
+				const UINT32 batchSize = Math::divideAndRoundUp(NUM_LIGHTS, numBatches);
+				for (UINT32 i = 0; i < numBatches; i++)
+				{
+					const UINT32 start = std::min(i * batchSize, NUM_LIGHTS);
+					const UINT32 end = std::min(start + batchSize, NUM_LIGHTS);
+
+					recorder.record([&renderLights, start, end]() { renderLights(start, end); });
+				}
+
+				recorder.submit();
+			};
+
+			ct::ParallelCommandRecorder parallelRecorder("Test", true);
+
+			Timer timer;
+			renderShadows(serialRecorder);
+			const UINT64 serialTime = std::max(timer.getMicroseconds(), (UINT64)1);
+			const Vector<UINT32> serialNumVisible = numVisible;
+
+			timer.reset();
+			renderShadows(parallelRecorder);
+			const UINT64 parallelTime = std::max(timer.getMicroseconds(), (UINT64)1);
+
+			BS_TEST_ASSERT(numVisible == serialNumVisible);
+
+			UINT32 totalVisible = 0;
+			for (auto& entry : numVisible)
+				totalVisible += entry;
+
+			BS_TEST_ASSERT(totalVisible > 0);
+
+			BS_LOG(Info, Generic, "Parallel command recording - {0} shadowed lights, {1} objects, {2} draws: {3} ms "
+				"serial, {4} ms parallel ({5} workers)", NUM_LIGHTS, NUM_OBJECTS, totalVisible, serialTime / 1000.0f,
+				parallelTime / 1000.0f, TaskScheduler::instance().getNumWorkers());
+		};
+
+		gCoreThread().queueCommand(test, CTQF_InternalQueue | CTQF_BlockUntilComplete);
+	}
+
+	void CoreTestSuite::testRenderAPICapture()
+	{
+		static constexpr UINT32 NUM_DRAWS = 10;
+		static constexpr UINT32 PARAM_BLOCK_SIZE = 64;
+
+		auto test = [this]()
+		{
+			ct::RenderAPI& rapi = ct::RenderAPI::instance();
+
+			VERTEX_BUFFER_DESC vbDesc;
+			vbDesc.vertexSize = sizeof(Vector3);
+			vbDesc.numVerts = 24;
+
+			INDEX_BUFFER_DESC ibDesc;
+			ibDesc.indexType = IT_16BIT;
+			ibDesc.numIndices = 36;
+
+			SPtr<ct::VertexBuffer> vertexBuffer = ct::VertexBuffer::create(vbDesc);
+			SPtr<ct::IndexBuffer> indexBuffer = ct::IndexBuffer::create(ibDesc);
+			SPtr<ct::GpuParamBlockBuffer> paramBuffer = ct::GpuParamBlockBuffer::create(PARAM_BLOCK_SIZE);
+
+			// Forget any state bound by the previous tests
+			rapi.submitCommandBuffer(rapi.getMainCommandBuffer());
+
+			const UINT64 numRedundantBinds = RenderStats::instance().getData().numRedundantBinds;
+
+			SPtr<ct::RenderAPICapture> capture = bs_shared_ptr_new<ct::RenderAPICapture>();
+			rapi._setCapture(capture);
+
+			rapi.setRenderTarget(nullptr, 0);
+			rapi.setViewport(Rect2(0.0f, 0.0f, 1.0f, 1.0f));
+			rapi.setViewport(Rect2(0.0f, 0.0f, 1.0f, 1.0f)); // Redundant
+			rapi.clearViewport(FBT_COLOR | FBT_DEPTH);
+
+			rapi.setVertexBuffers(0, &vertexBuffer, 1);
+			rapi.setIndexBuffer(indexBuffer);
+			rapi.setDrawOperation(DOT_TRIANGLE_LIST);
+
+			const UINT8 paramData[PARAM_BLOCK_SIZE] = { };
+			paramBuffer->write(0, paramData, PARAM_BLOCK_SIZE);
+			paramBuffer->flushToGPU();
+
+			for (UINT32 i = 0; i < NUM_DRAWS; i++)
+			{
+				rapi.setVertexBuffers(0, &vertexBuffer, 1); // Redundant
+				rapi.setIndexBuffer(indexBuffer); // Redundant
+				rapi.setStencilRef(i % 2);
+				rapi.drawIndexed(0, 36, 0, 24);
+			}
+
+			// Changing the render target resets the viewport
+			rapi.setRenderTarget(nullptr, 0, RT_COLOR0);
+			rapi.setViewport(Rect2(0.0f, 0.0f, 1.0f, 1.0f));
+			rapi.dispatchCompute(4, 4);
+
+			rapi._setCapture(nullptr);
+			rapi.draw(0, 3);
+
+			const ct::RenderAPICaptureStats stats = capture->getStats();
+			BS_TEST_ASSERT(stats.numDrawCalls == NUM_DRAWS);
+			BS_TEST_ASSERT(stats.numComputeCalls == 1);
+			BS_TEST_ASSERT(stats.numClears == 1);
+			BS_TEST_ASSERT(stats.numStateChanges == 7 + NUM_DRAWS);
+			BS_TEST_ASSERT(stats.numBufferWrites == 1);
+			BS_TEST_ASSERT(stats.bytesUploaded == PARAM_BLOCK_SIZE);
+
+			// Calls are captured before the backend filters out redundant binds, so both report the same binds
+			BS_TEST_ASSERT(stats.numRedundantBinds == 1 + NUM_DRAWS * 2);
+			BS_TEST_ASSERT(stats.numCommands == 11 + NUM_DRAWS * 4);
+			const UINT64 numFilteredBinds = RenderStats::instance().getData().numRedundantBinds - numRedundantBinds;
+			BS_TEST_ASSERT(numFilteredBinds == stats.numRedundantBinds);
+			BS_TEST_ASSERT(capture->getNumObjects() == 2);
+
+			// Replaying re-issues the same calls, except for buffer writes whose contents aren't recorded
+			SPtr<ct::RenderAPICapture> replayCapture = bs_shared_ptr_new<ct::RenderAPICapture>();
+			rapi._setCapture(replayCapture);
+
+			// Captures can't be replayed into themselves
+			replayCapture->replay();
+			BS_TEST_ASSERT(replayCapture->getSize() == 0);
+
+			rapi.submitCommandBuffer(rapi.getMainCommandBuffer());
+			capture->replay();
+			rapi._setCapture(nullptr);
+			rapi.submitCommandBuffer(rapi.getMainCommandBuffer());
+
+			const ct::RenderAPICaptureStats replayStats = replayCapture->getStats();
+			BS_TEST_ASSERT(replayStats.numDrawCalls == stats.numDrawCalls);
+			BS_TEST_ASSERT(replayStats.numComputeCalls == stats.numComputeCalls);
+			BS_TEST_ASSERT(replayStats.numClears == stats.numClears);
+			BS_TEST_ASSERT(replayStats.numRedundantBinds == stats.numRedundantBinds);
+			BS_TEST_ASSERT(replayStats.numStateChanges == stats.numStateChanges);
+			BS_TEST_ASSERT(replayStats.numBufferWrites == 0);
+			BS_TEST_ASSERT(replayStats.numCommands == stats.numCommands - 1);
+			BS_TEST_ASSERT(replayCapture->getSize() == capture->getSize() - sizeof(UINT8) - sizeof(UINT32));
+
+			// Saved captures recreate the objects they reference, so they can be replayed on a different backend
+			SPtr<MemoryDataStream> savedCapture = bs_shared_ptr_new<MemoryDataStream>();
+			capture->save(savedCapture);
+			savedCapture->seek(0);
+
+			SPtr<ct::RenderAPICapture> loadedCapture = ct::RenderAPICapture::load(savedCapture);
+			BS_TEST_ASSERT(loadedCapture != nullptr);
+			BS_TEST_ASSERT(loadedCapture->getSize() == capture->getSize());
+			BS_TEST_ASSERT(loadedCapture->getNumObjects() == capture->getNumObjects());
+			BS_TEST_ASSERT(loadedCapture->getStats().numCommands == stats.numCommands);
+			BS_TEST_ASSERT(loadedCapture->getStats().numDrawCalls == stats.numDrawCalls);
+
+			SPtr<ct::RenderAPICapture> loadedReplayCapture = bs_shared_ptr_new<ct::RenderAPICapture>();
+			rapi._setCapture(loadedReplayCapture);
+			loadedCapture->replay();
+			rapi._setCapture(nullptr);
+			rapi.submitCommandBuffer(rapi.getMainCommandBuffer());
+
+			BS_TEST_ASSERT(loadedReplayCapture->getSize() == replayCapture->getSize());
+			BS_TEST_ASSERT(loadedReplayCapture->getStats().numCommands == replayStats.numCommands);
+			BS_TEST_ASSERT(loadedReplayCapture->getStats().numStateChanges == replayStats.numStateChanges);
+
+			// Streams that don't contain a capture are rejected
+			SPtr<MemoryDataStream> invalidCapture = bs_shared_ptr_new<MemoryDataStream>(16);
+			memset(invalidCapture->data(), 0, 16);
+			BS_TEST_ASSERT(ct::RenderAPICapture::load(invalidCapture) == nullptr);
+
+			// Parameter block contents are restored by parameter name
+			GpuParamDataDesc dataDesc;
+			dataDesc.name = "value";
+			dataDesc.elementSize = 4;
+			dataDesc.arraySize = 1;
+			dataDesc.arrayElementStride = 4;
+			dataDesc.type = GPDT_FLOAT4;
+			dataDesc.paramBlockSlot = 0;
+			dataDesc.paramBlockSet = 0;
+			dataDesc.gpuMemOffset = 4;
+			dataDesc.cpuMemOffset = 4;
+
+			GpuParamBlockDesc blockDesc;
+			blockDesc.name = "Block";
+			blockDesc.slot = 0;
+			blockDesc.set = 0;
+			blockDesc.blockSize = PARAM_BLOCK_SIZE / 4;
+			blockDesc.isShareable = true;
+
+			SPtr<GpuParamDesc> paramDesc = bs_shared_ptr_new<GpuParamDesc>();
+			paramDesc->paramBlocks["Block"] = blockDesc;
+			paramDesc->params["value"] = dataDesc;
+
+			GPU_PIPELINE_PARAMS_DESC pipelineParamsDesc;
+			pipelineParamsDesc.vertexParams = paramDesc;
+
+			SPtr<ct::GpuPipelineParamInfo> paramInfo = ct::GpuPipelineParamInfo::create(pipelineParamsDesc);
+			SPtr<ct::GpuParams> gpuParams = ct::GpuParams::create(paramInfo);
+			gpuParams->setParamBlockBuffer(GPT_VERTEX_PROGRAM, "Block", paramBuffer);
+
+			const Vector4 value(1.0f, 2.0f, 3.0f, 4.0f);
+			paramBuffer->write(dataDesc.cpuMemOffset * sizeof(UINT32), &value, sizeof(value));
+
+			SPtr<ct::RenderAPICapture> paramsCapture = bs_shared_ptr_new<ct::RenderAPICapture>();
+			rapi._setCapture(paramsCapture);
+			rapi.setGpuParams(gpuParams);
+			rapi._setCapture(nullptr);
+			rapi.submitCommandBuffer(rapi.getMainCommandBuffer());
+
+			SPtr<MemoryDataStream> savedParamsCapture = bs_shared_ptr_new<MemoryDataStream>();
+			paramsCapture->save(savedParamsCapture);
+			savedParamsCapture->seek(0);
+
+			SPtr<ct::RenderAPICapture> loadedParamsCapture = ct::RenderAPICapture::load(savedParamsCapture);
+			BS_TEST_ASSERT(loadedParamsCapture != nullptr);
+			BS_TEST_ASSERT(loadedParamsCapture->getNumObjects() == 1);
+
+			// Re-capturing the loaded parameters saves the same descriptions and contents as the original ones
+			SPtr<ct::RenderAPICapture> replayedParamsCapture = bs_shared_ptr_new<ct::RenderAPICapture>();
+			rapi._setCapture(replayedParamsCapture);
+			loadedParamsCapture->replay();
+			rapi._setCapture(nullptr);
+			rapi.submitCommandBuffer(rapi.getMainCommandBuffer());
+
+			SPtr<MemoryDataStream> savedReplayedParamsCapture = bs_shared_ptr_new<MemoryDataStream>();
+			replayedParamsCapture->save(savedReplayedParamsCapture);
+
+			const size_t savedSize = savedParamsCapture->size();
+			BS_TEST_ASSERT(savedReplayedParamsCapture->tell() == savedSize);
+			BS_TEST_ASSERT(memcmp(savedReplayedParamsCapture->data(), savedParamsCapture->data(), savedSize) == 0);
+
+			capture->clear();
+			BS_TEST_ASSERT(capture->getSize() == 0);
+			BS_TEST_ASSERT(capture->getNumObjects() == 0);
+			BS_TEST_ASSERT(capture->getStats().numCommands == 0);
+
+			// Calls recorded on other command buffers become part of the capture once the command buffer is submitted
+			SPtr<ct::CommandBuffer> commandBuffer = ct::CommandBuffer::create(GQT_GRAPHICS);
+			SPtr<ct::CommandBuffer> secondary = ct::CommandBuffer::create(GQT_GRAPHICS, 0, 0, true);
+			rapi._setCapture(capture);
+
+			rapi.draw(0, 3, 0, commandBuffer);
+			rapi.dispatchCompute(1);
+
+			ct::RenderAPI::_setThreadCommandBuffer(&commandBuffer);
+			rapi.draw(0, 3);
+			ct::RenderAPI::_setThreadCommandBuffer(nullptr);
+			BS_TEST_ASSERT(capture->getStats().numCommands == 0);
+
+			rapi.submitCommandBuffer(commandBuffer);
+			BS_TEST_ASSERT(capture->getStats().numDrawCalls == 2);
+			BS_TEST_ASSERT(capture->getStats().numComputeCalls == 0);
+
+			// Secondary command buffers become part of the command buffer they are added to
+			rapi.setStencilRef(1, secondary);
+			rapi.setStencilRef(1, secondary); // Redundant
+			rapi.addCommands(rapi.getMainCommandBuffer(), secondary);
+			BS_TEST_ASSERT(capture->getStats().numCommands == 2);
+
+			// State bound by the secondary command buffer isn't known to the main one
+			rapi.setStencilRef(1);
+			rapi._setCapture(nullptr);
+
+			const ct::RenderAPICaptureStats splicedStats = capture->getStats();
+			BS_TEST_ASSERT(splicedStats.numCommands == 6);
+			BS_TEST_ASSERT(splicedStats.numComputeCalls == 1);
+			BS_TEST_ASSERT(splicedStats.numStateChanges == 2);
+			BS_TEST_ASSERT(splicedStats.numRedundantBinds == 1);
+
+			rapi.submitCommandBuffer(rapi.getMainCommandBuffer());
+			capture->clear();
+		};
+
+		gCoreThread().queueCommand(test, CTQF_InternalQueue | CTQF_BlockUntilComplete);
+	}
+
+	void CoreTestSuite::testRenderStateCache()
+	{
+		static constexpr UINT32 PARAM_BLOCK_SIZE = 64;
+		static constexpr UINT32 NUM_TIMED_BINDS = 100000;
+
+		auto test = [this]()
+		{
+			ct::RenderAPI& rapi = ct::RenderAPI::instance();
+			RenderStatsData& renderStats = RenderStats::instance().getData();
+
+			GpuParamBlockDesc blockDesc;
+			blockDesc.name = "Block";
+			blockDesc.slot = 0;
+			blockDesc.set = 0;
+			blockDesc.blockSize = PARAM_BLOCK_SIZE / 4;
+			blockDesc.isShareable = true;
+
+			SPtr<GpuParamDesc> paramDesc = bs_shared_ptr_new<GpuParamDesc>();
+			paramDesc->paramBlocks["Block"] = blockDesc;
+
+			GPU_PIPELINE_PARAMS_DESC pipelineParamsDesc;
+			pipelineParamsDesc.vertexParams = paramDesc;
+
+			SPtr<ct::GpuPipelineParamInfo> paramInfo = ct::GpuPipelineParamInfo::create(pipelineParamsDesc);
+			SPtr<ct::GpuParamBlockBuffer> paramBuffer = ct::GpuParamBlockBuffer::create(PARAM_BLOCK_SIZE);
+			SPtr<ct::GpuParams> gpuParams = ct::GpuParams::create(paramInfo);
+			gpuParams->setParamBlockBuffer(GPT_VERTEX_PROGRAM, "Block", paramBuffer);
+
+			SPtr<ct::CommandBuffer> commandBuffer = ct::CommandBuffer::create(GQT_GRAPHICS);
+			const UINT64 numRedundantBinds = renderStats.numRedundantBinds;
+
+			// Binding the same parameters twice issues a single bind
+			rapi.setGpuParams(gpuParams, commandBuffer);
+			rapi.setGpuParams(gpuParams, commandBuffer);
+			BS_TEST_ASSERT(renderStats.numRedundantBinds == numRedundantBinds + 1);
+
+			// Modifying a parameter block used by the parameters requires them to be bound again
+			const UINT8 paramData[PARAM_BLOCK_SIZE] = { };
+			paramBuffer->write(0, paramData, PARAM_BLOCK_SIZE);
+			rapi.setGpuParams(gpuParams, commandBuffer);
+			rapi.setGpuParams(gpuParams, commandBuffer);
+			BS_TEST_ASSERT(renderStats.numRedundantBinds == numRedundantBinds + 2);
+
+			// As does assigning a different parameter block
+			const UINT64 version = gpuParams->getVersion();
+			SPtr<ct::GpuParamBlockBuffer> otherParamBuffer = ct::GpuParamBlockBuffer::create(PARAM_BLOCK_SIZE);
+			gpuParams->setParamBlockBuffer(GPT_VERTEX_PROGRAM, "Block", otherParamBuffer);
+			BS_TEST_ASSERT(gpuParams->getVersion() > version);
+			rapi.setGpuParams(gpuParams, commandBuffer);
+			BS_TEST_ASSERT(renderStats.numRedundantBinds == numRedundantBinds + 2);
+
+			// Changing the pipeline requires the parameters to be bound again
+			rapi.setGraphicsPipeline(nullptr, commandBuffer);
+			rapi.setGpuParams(gpuParams, commandBuffer);
+			rapi.setGraphicsPipeline(nullptr, commandBuffer);
+			rapi.setGpuParams(gpuParams, commandBuffer);
+			BS_TEST_ASSERT(renderStats.numRedundantBinds == numRedundantBinds + 4);
+
+			// State is tracked separately for each command buffer
+			rapi.setGpuParams(gpuParams);
+			BS_TEST_ASSERT(renderStats.numRedundantBinds == numRedundantBinds + 4);
+
+			// Submitted command buffers no longer have any bound state
+			rapi.submitCommandBuffer(commandBuffer);
+			rapi.setGraphicsPipeline(nullptr, commandBuffer);
+			rapi.setGpuParams(gpuParams, commandBuffer);
+			BS_TEST_ASSERT(renderStats.numRedundantBinds == numRedundantBinds + 4);
+
+			Timer timer;
+			for (UINT32 i = 0; i < NUM_TIMED_BINDS; i++)
+			{
+				rapi.setGpuParams(gpuParams, commandBuffer);
+				rapi.setStencilRef(0, commandBuffer);
+			}
+
+			const UINT64 filterTime = timer.getMicroseconds();
+			BS_TEST_ASSERT(renderStats.numRedundantBinds == numRedundantBinds + 4 + NUM_TIMED_BINDS * 2 - 1);
+
+			BS_LOG(Info, Generic, "Render state cache - {0} redundant binds filtered in {1} ms", NUM_TIMED_BINDS * 2,
+				filterTime / 1000.0f);
+
+			rapi.submitCommandBuffer(commandBuffer);
+			rapi.submitCommandBuffer(rapi.getMainCommandBuffer());
+		};
+
+		gCoreThread().queueCommand(test, CTQF_InternalQueue | CTQF_BlockUntilComplete);
+	}
+
+	void CoreTestSuite::testRendererTaskTimeSlicing()
+	{
+		auto test = [this]()
+		{
+			TaskTestRenderer renderer;
+			Vector<UINT32> executed;
+
+			// Creates a task that completes after the provided number of worker calls, logging each call
+			auto createTask = [&executed](UINT32 id, UINT32 numSteps)
+			{
+				auto worker = [&executed, id, numSteps, step = 0U]() mutable
+				{
+					executed.push_back(id);
+					return ++step == numSteps;
+				};
+
+				return ct::RendererTask::create("TimeSlicingTest", worker);
+			};
+
+			auto processTasks = [&renderer](UINT32 budget, const Vector<Vector3>& viewOrigins)
+			{
+				gProfilerGPU().beginFrame();
+				renderer.processTasks(false, std::numeric_limits<UINT64>::max(), budget, viewOrigins);
+				gProfilerGPU().endFrame(true);
+			};
+
+			SPtr<ct::RendererTask> regular = createTask(0, 2);
+
+			SPtr<ct::RendererTask> farTask = createTask(1, 2);
+			farTask->setTimeSliced(Vector3(100.0f, 0.0f, 0.0f));
+
+			SPtr<ct::RendererTask> nearTask = createTask(2, 3);
+			nearTask->setTimeSliced(Vector3(10.0f, 0.0f, 0.0f));
+
+			SPtr<ct::RendererTask> globalTask = createTask(3, 1);
+			globalTask->setTimeSliced();
+
+			renderer.addTask(regular);
+			renderer.addTask(farTask);
+			renderer.addTask(nearTask);
+			renderer.addTask(globalTask);
+
+			// Distance to the closest view determines the priority, so the second view makes the far task the closest
+			const Vector<Vector3> viewOrigins = { Vector3(-50.0f, 0.0f, 0.0f), Vector3(95.0f, 0.0f, 0.0f) };
+
+			// Regular tasks aren't limited by the budget. Tasks without a position execute first, and each task keeps
+			// executing until it completes or the budget runs out.
+			processTasks(3, viewOrigins);
+			BS_TEST_ASSERT((executed == Vector<UINT32>{ 0, 3, 1, 1 }));
+			BS_TEST_ASSERT(globalTask->isComplete() && farTask->isComplete());
+			BS_TEST_ASSERT(!nearTask->isComplete() && !regular->isComplete());
+
+			executed.clear();
+			processTasks(3, viewOrigins);
+			BS_TEST_ASSERT((executed == Vector<UINT32>{ 0, 2, 2, 2 }));
+			BS_TEST_ASSERT(nearTask->isComplete() && regular->isComplete());
+
+			executed.clear();
+			processTasks(3, viewOrigins);
+			BS_TEST_ASSERT(executed.empty());
+
+			// Canceled tasks never execute, and with no budget limit all time-sliced tasks complete at once
+			SPtr<ct::RendererTask> canceledTask = createTask(4, 1);
+			canceledTask->setTimeSliced(Vector3::ZERO);
+
+			SPtr<ct::RendererTask> longTask = createTask(5, 20);
+			longTask->setTimeSliced(Vector3::ZERO);
+
+			renderer.addTask(canceledTask);
+			renderer.addTask(longTask);
+			canceledTask->cancel();
+
+			processTasks(0, viewOrigins);
+			BS_TEST_ASSERT(executed.size() == 20 && executed[0] == 5);
+			BS_TEST_ASSERT(longTask->isComplete() && !canceledTask->isComplete());
+		};
+
+		gCoreThread().queueCommand(test, CTQF_InternalQueue | CTQF_BlockUntilComplete);
+	}
+
+	void CoreTestSuite::testGpuReadback()
+	{
+		auto test = [this]()
+		{
+			auto& queryManager = static_cast<ct::NullQueryManager&>(ct::QueryManager::instance());
+			auto& readbackManager = ct::GpuReadbackManager::instance();
+			const ct::GpuStagingPool& stagingPool = readbackManager.getStagingPool();
+
+			auto advanceFrame = [&queryManager, &readbackManager]()
+			{
+				queryManager._update();
+				readbackManager._update();
+			};
+
+			// The null backend completes event queries after a fixed number of frames
+			constexpr UINT32 LATENCY = 3;
+			queryManager.setEventQueryLatency(LATENCY);
+
+			TEXTURE_DESC texDesc;
+			texDesc.type = TEX_TYPE_CUBE_MAP;
+			texDesc.format = PF_RGBA8;
+			texDesc.width = 32;
+			texDesc.height = 32;
+			texDesc.numMips = 3;
+			SPtr<ct::Texture> texture = ct::Texture::create(texDesc);
+
+			GPU_BUFFER_DESC bufferDesc;
+			bufferDesc.type = GBT_STANDARD;
+			bufferDesc.format = BF_32X1U;
+			bufferDesc.elementCount = 64;
+			SPtr<ct::GpuBuffer> buffer = ct::GpuBuffer::create(bufferDesc);
+
+			TAsyncOp<SPtr<PixelData>> textureOp = readbackManager.readTexture(texture, 4, 2);
+			TAsyncOp<SPtr<MemoryDataStream>> bufferOp = readbackManager.readBuffer(buffer, 16, 100);
+			BS_TEST_ASSERT(readbackManager.getNumPending() == 2);
+			BS_TEST_ASSERT(stagingPool.getNumAllocated() == 2);
+
+			// Operations stay pending until the GPU catches up, without blocking the caller
+			for (UINT32 i = 0; i < LATENCY - 1; i++)
+			{
+				advanceFrame();
+				BS_TEST_ASSERT(!textureOp.hasCompleted() && !bufferOp.hasCompleted());
+			}
+
+			advanceFrame();
+			BS_TEST_ASSERT(textureOp.hasCompleted() && bufferOp.hasCompleted());
+			BS_TEST_ASSERT(readbackManager.getNumPending() == 0);
+
+			SPtr<PixelData> pixels = textureOp.getReturnValue();
+			BS_TEST_ASSERT(pixels != nullptr);
+			BS_TEST_ASSERT(pixels->getWidth() == 8 && pixels->getHeight() == 8 && pixels->getFormat() == PF_RGBA8);
+
+			SPtr<MemoryDataStream> bytes = bufferOp.getReturnValue();
+			BS_TEST_ASSERT(bytes != nullptr && bytes->size() == 100);
+
+			// Staging memory returns to the pool, and is reused by readbacks with matching properties
+			BS_TEST_ASSERT(stagingPool.getNumFree() == 2);
+
+			textureOp = readbackManager.readTexture(texture, 1, 2);
+			bufferOp = readbackManager.readBuffer(buffer, 0, 200);
+			BS_TEST_ASSERT(stagingPool.getNumAllocated() == 2 && stagingPool.getNumFree() == 0);
+
+			// A different mip level needs a differently sized staging texture
+			TAsyncOp<SPtr<PixelData>> mip0Op = readbackManager.readTexture(texture, 0, 0);
+			BS_TEST_ASSERT(stagingPool.getNumAllocated() == 3);
+
+			// Invalid requests complete immediately, with no data
+			TAsyncOp<SPtr<PixelData>> invalidTextureOp = readbackManager.readTexture(texture, 6, 0);
+			TAsyncOp<SPtr<MemoryDataStream>> invalidBufferOp = readbackManager.readBuffer(buffer, 200, 100);
+			BS_TEST_ASSERT(invalidTextureOp.hasCompleted() && invalidTextureOp.getReturnValue() == nullptr);
+			BS_TEST_ASSERT(invalidBufferOp.hasCompleted() && invalidBufferOp.getReturnValue() == nullptr);
+			BS_TEST_ASSERT(readbackManager.getNumPending() == 3);
+
+			for (UINT32 i = 0; i < LATENCY; i++)
+				advanceFrame();
+
+			BS_TEST_ASSERT(textureOp.hasCompleted() && bufferOp.hasCompleted() && mip0Op.hasCompleted());
+			BS_TEST_ASSERT(mip0Op.getReturnValue()->getWidth() == 32);
+			BS_TEST_ASSERT(stagingPool.getNumFree() == 3);
+
+			// Unused staging memory is eventually released
+			for (UINT32 i = 0; i < ct::GpuStagingPool::MAX_UNUSED_FRAMES + 1; i++)
+				advanceFrame();
+
+			BS_TEST_ASSERT(stagingPool.getNumAllocated() == 0 && stagingPool.getNumFree() == 0);
+
+			queryManager.setEventQueryLatency(2);
+		};
+
+		gCoreThread().queueCommand(test, CTQF_InternalQueue | CTQF_BlockUntilComplete);
+	}
 }
 
 using namespace bs;
@@ -270,6 +270,15 @@ namespace bs
 		 */
 		void endSample(const char* name);
 
+		/**
+		 * Records a sample whose time was measured externally, for example for work performed on a different thread.
+		 * The sample is added as a child of the currently active sample.
+		 *
+		 * @param[in]	name	Unique name for the sample you can later use to find the sampling data.
+		 * @param[in]	time	Duration of the sample, in milliseconds.
+		 */
+		void addSample(const char* name, double time);
+
 		/**
 		 * Begins precise sample measurement. Must be followed by endSamplePrecise().
 		 *
@@ -33,6 +33,7 @@ namespace bs
 		UINT32 numGpuParamBinds; /**< How many times were GPU parameters bound. */
 		UINT32 numVertexBufferBinds; /**< How many times was a vertex buffer bound. */
 		UINT32 numIndexBufferBinds; /**< How many times was an index buffer bound. */
+		UINT32 numRedundantBinds; /**< How many binds were skipped because the state was already bound. */
 
 		UINT32 numResourceWrites; /**< How many times were GPU resources written to. */
 		UINT32 numResourceReads; /**< How many times were GPU resources read from. */
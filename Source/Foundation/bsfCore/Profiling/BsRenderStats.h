@@ -43,6 +43,8 @@ namespace bs
 		UINT64 numVertexBufferBinds = 0;
 		UINT64 numIndexBufferBinds = 0;
 
+		UINT64 numRedundantBinds = 0;
+
 		UINT64 numResourceWrites;
 		UINT64 numResourceReads;
 
@@ -94,6 +96,12 @@ namespace bs
 		/** Increments index buffer change counter indicating how many times was a index buffer bound to the pipeline. */
 		void incNumIndexBufferBinds() { mData.numIndexBufferBinds++; }
 
+		/**
+		 * Increments redundant bind counter indicating how many times was a bind skipped because the same state was
+		 * already bound.
+		 */
+		void incNumRedundantBinds() { mData.numRedundantBinds++; }
+
 		/**
 		 * Increments created GPU resource counter.
 		 *
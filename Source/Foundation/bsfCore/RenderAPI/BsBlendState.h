@@ -139,6 +139,9 @@ namespace bs
 		/** Returns the hash value generated from the blend state properties. */
 		UINT64 getHash() const { return mHash; }
 
+		/**	Returns the descriptor originally used for creating the blend state. */
+		BLEND_STATE_DESC getDesc() const { return mData; }
+
 	protected:
 		friend class BlendState;
 		friend class ct::BlendState;
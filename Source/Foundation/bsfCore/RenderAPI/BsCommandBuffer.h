@@ -3,6 +3,7 @@
 #pragma once
 
 #include "BsCorePrerequisites.h"
+#include "RenderAPI/BsRenderStateCache.h"
 
 namespace bs { namespace ct
 {
@@ -107,6 +108,12 @@ namespace bs { namespace ct
 		 */
 		virtual void reset() = 0;
 
+		/**
+		 * Returns the cache of state bound on this command buffer, used by render API backends for skipping redundant
+		 * binds.
+		 */
+		RenderStateCache& _getStateCache() { return mStateCache; }
+
 	protected:
 		CommandBuffer(GpuQueueType type, UINT32 deviceIdx, UINT32 queueIdx, bool secondary);
 
@@ -114,6 +121,8 @@ namespace bs { namespace ct
 		UINT32 mDeviceIdx;
 		UINT32 mQueueIdx;
 		bool mIsSecondary;
+
+		RenderStateCache mStateCache;
 	};
 
 	/** @} */
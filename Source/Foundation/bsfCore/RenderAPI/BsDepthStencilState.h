@@ -131,6 +131,9 @@ namespace bs
 		/** Returns the hash value generated from the depth-stencil state properties. */
 		UINT64 getHash() const { return mHash; }
 
+		/**	Returns the descriptor originally used for creating the depth-stencil state. */
+		DEPTH_STENCIL_STATE_DESC getDesc() const { return mData; }
+
 	protected:
 		friend class DepthStencilState;
 		friend class ct::DepthStencilState;
@@ -5,6 +5,8 @@
 #include "RenderAPI/BsRenderAPI.h"
 #include "Managers/BsHardwareBufferManager.h"
 #include "Profiling/BsRenderStats.h"
+#include "Managers/BsGpuReadbackManager.h"
+#include "CoreThread/BsCoreThread.h"
 
 namespace bs
 {
@@ -37,6 +39,19 @@ namespace bs
 		return std::static_pointer_cast<ct::GpuBuffer>(mCoreSpecific);
 	}
 
+	TAsyncOp<SPtr<MemoryDataStream>> GpuBuffer::readData(UINT32 offset, UINT32 length)
+	{
+		TAsyncOp<SPtr<MemoryDataStream>> op;
+
+		auto func = [buffer = getCore(), offset, length, op]()
+		{
+			ct::GpuReadbackManager::instance().readBuffer(buffer, offset, length, op);
+		};
+
+		gCoreThread().queueCommand(func);
+		return op;
+	}
+
 	SPtr<ct::CoreObject> GpuBuffer::createCore() const
 	{
 		return ct::HardwareBufferManager::instance().createGpuBufferInternal(mProperties.mDesc);
@@ -149,6 +164,9 @@ namespace bs
 		}
 #endif
 
+		if (options != GBL_READ_ONLY)
+			RenderAPI::_notifyBufferWrite(length);
+
 		return mBuffer->lock(offset, length, options, deviceIdx, queueIdx);
 	}
 
@@ -170,6 +188,7 @@ namespace bs
 		BS_INC_RENDER_STAT_CAT(ResWrite, RenderStatObject_GpuBuffer);
 
 		mBuffer->writeData(offset, length, source, writeFlags, queueIdx);
+		RenderAPI::_notifyBufferWrite(length);
 	}
 
 	void GpuBuffer::copyData(HardwareBuffer& srcBuffer, UINT32 srcOffset, UINT32 dstOffset, UINT32 length,
@@ -84,6 +84,19 @@ namespace bs
 		/** Retrieves a core implementation of a GPU buffer usable only from the core thread. */
 		SPtr<ct::GpuBuffer> getCore() const;
 
+		/**
+		 * Reads a range of bytes from the buffer into a newly allocated stream. The read doesn't stall the core thread
+		 * waiting on the GPU, and the operation normally completes a few frames later. See ct::GpuReadbackManager.
+		 *
+		 * @param[in]	offset		Offset of the first byte to read.
+		 * @param[in]	length		Number of bytes to read.
+		 * @return					Async operation object that will contain the stream with the data once the operation
+		 *							completes, or null if the range couldn't be read.
+		 *
+		 * @note This is an @ref asyncMethod "asynchronous method".
+		 */
+		TAsyncOp<SPtr<MemoryDataStream>> readData(UINT32 offset, UINT32 length);
+
 		/** Returns the size of a single element in the buffer, of the provided format, in bytes. */
 		static UINT32 getFormatSize(GpuBufferFormat format);
 
@@ -4,6 +4,8 @@
 #include "RenderAPI/BsHardwareBuffer.h"
 #include "Managers/BsHardwareBufferManager.h"
 #include "Profiling/BsRenderStats.h"
+#include "RenderAPI/BsRenderAPI.h"
+#include "Renderer/BsGpuParamBlockArena.h"
 
 namespace bs
 {
@@ -130,6 +132,7 @@ namespace bs
 
 		memcpy(mCachedData + offset, data, size);
 		mGPUBufferDirty = true;
+		mVersion++;
 	}
 
 	void GpuParamBlockBuffer::read(UINT32 offset, void* data, UINT32 size)
@@ -159,10 +162,24 @@ namespace bs
 
 		memset(mCachedData + offset, 0, size);
 		mGPUBufferDirty = true;
+		mVersion++;
 	}
 
 	void GpuParamBlockBuffer::flushToGPU(UINT32 queueIdx)
 	{
+		if (mArena != nullptr)
+		{
+			// Contents are still valid in the arena, make sure they were uploaded
+			if (!mGPUBufferDirty)
+			{
+				mArena->flush(queueIdx);
+				return;
+			}
+
+			// Contents were modified after allocation, fall back to writing to the buffer itself
+			_clearArenaAllocation();
+		}
+
 		if (mGPUBufferDirty)
 		{
 			writeToGPU(mCachedData, queueIdx);
@@ -173,10 +190,42 @@ namespace bs
 	void GpuParamBlockBuffer::writeToGPU(const UINT8* data, UINT32 queueIdx)
 	{
 		mBuffer->writeData(0, mSize, data, BWT_DISCARD, queueIdx);
+		RenderAPI::_notifyBufferWrite(mSize);
 
 		BS_INC_RENDER_STAT_CAT(ResWrite, RenderStatObject_GpuParamBuffer);
 	}
 
+	void GpuParamBlockBuffer::writeRangeToGPU(UINT32 offset, UINT32 size, BufferWriteType writeFlags, UINT32 queueIdx)
+	{
+		mBuffer->writeData(offset, size, mCachedData + offset, writeFlags, queueIdx);
+		RenderAPI::_notifyBufferWrite(size);
+
+		BS_INC_RENDER_STAT_CAT(ResWrite, RenderStatObject_GpuParamBuffer);
+	}
+
+	void GpuParamBlockBuffer::_setArenaAllocation(GpuParamBlockArena* arena, GpuParamBlockBuffer* page, UINT32 offset)
+	{
+		mArena = arena;
+		mArenaPage = page;
+		mArenaOffset = offset;
+		mGPUBufferDirty = false;
+		mVersion++;
+	}
+
+	void GpuParamBlockBuffer::_clearArenaAllocation()
+	{
+		if (mArena == nullptr)
+			return;
+
+		mArena = nullptr;
+		mArenaPage = nullptr;
+		mArenaOffset = 0;
+
+		// The buffer itself wasn't written to while the contents were in the arena
+		mGPUBufferDirty = true;
+		mVersion++;
+	}
+
 	void GpuParamBlockBuffer::syncToCore(const CoreSyncData& data)
 	{
 		assert(mSize == data.getBufferSize());
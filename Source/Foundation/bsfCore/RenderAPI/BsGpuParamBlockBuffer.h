@@ -100,7 +100,18 @@ namespace bs
 		void writeToGPU(const UINT8* data, UINT32 queueIdx = 0);
 
 		/**
-		 * Flushes any cached data into the actual GPU buffer.
+		 * Writes a range of the cached data to the GPU buffer.
+		 *
+		 * @param[in]	offset		Offset of the range to write, in bytes.
+		 * @param[in]	size		Size of the range to write, in bytes.
+		 * @param[in]	writeFlags	Determines what happens to the rest of the buffer contents. See BufferWriteType.
+		 * @param[in]	queueIdx	Device queue to perform the write operation on. See @ref queuesDoc.
+		 */
+		void writeRangeToGPU(UINT32 offset, UINT32 size, BufferWriteType writeFlags, UINT32 queueIdx = 0);
+
+		/**
+		 * Flushes any cached data into the actual GPU buffer. If the buffer contents were allocated from a
+		 * GpuParamBlockArena this instead makes sure the arena contents are flushed.
 		 *
 		 * @param[in]	queueIdx	Device queue to perform the write operation on. See @ref queuesDoc.
 		 */
@@ -129,13 +140,49 @@ namespace bs
 		 */
 		void zeroOut(UINT32 offset, UINT32 size);
 
+		/** Returns internal cached data of the buffer. */
+		const UINT8* getCachedData() const { return mCachedData; }
+
 		/**	Returns the size of the buffer in bytes. */
 		UINT32 getSize() const { return mSize; }
 
+		/**
+		 * Returns the buffer that should be bound to GPU programs when this buffer is used. This is the buffer itself,
+		 * unless its contents were allocated from a GpuParamBlockArena, in which case the arena page holding them is
+		 * returned. Contents start at getBindOffset() in the returned buffer.
+		 */
+		const GpuParamBlockBuffer* getBindBuffer() const { return mArenaPage != nullptr ? mArenaPage : this; }
+
+		/** Returns the offset of the buffer contents in the buffer returned by getBindBuffer(), in bytes. */
+		UINT32 getBindOffset() const { return mArenaOffset; }
+
+		/**
+		 * Returns a counter that increments whenever the buffer contents are modified, or the location the contents are
+		 * bound from changes.
+		 */
+		UINT32 getVersion() const { return mVersion; }
+
 		/** @copydoc HardwareBufferManager::createGpuParamBlockBuffer */
 		static SPtr<GpuParamBlockBuffer> create(UINT32 size, GpuBufferUsage usage = GBU_DYNAMIC,
 			GpuDeviceFlags deviceMask = GDF_DEFAULT);
 
+		/** @name Internal
+		 *  @{
+		 */
+
+		/**
+		 * Notifies the buffer its current contents were copied to a page of a GpuParamBlockArena, and that the page
+		 * should be bound instead of the buffer, until the buffer contents change.
+		 */
+		void _setArenaAllocation(GpuParamBlockArena* arena, GpuParamBlockBuffer* page, UINT32 offset);
+
+		/**
+		 * Notifies the buffer its arena allocation is no longer valid. Contents will be written to the buffer itself on
+		 * the next flush.
+		 */
+		void _clearArenaAllocation();
+
+		/** @} */
 	protected:
 		friend class HardwareBufferManager;
 
@@ -152,6 +199,12 @@ namespace bs
 
 		UINT8* mCachedData;
 		bool mGPUBufferDirty;
+
+		GpuParamBlockArena* mArena = nullptr;
+		GpuParamBlockBuffer* mArenaPage = nullptr;
+		UINT32 mArenaOffset = 0;
+
+		UINT32 mVersion = 0;
 	};
 
 	/** @} */
@@ -817,6 +817,13 @@ namespace bs
 			mSamplerStates[i] = samplers[i];
 			samplers[i].~SPtr<SamplerState>();
 		}
+
+		mVersion++;
+	}
+
+	UINT32 GpuParams::_getNumParamBlockBuffers() const
+	{
+		return mParamInfo->getNumElements(GpuPipelineParamInfo::ParamType::ParamBlock);
 	}
 
 	SPtr<GpuParams> GpuParams::create(const SPtr<GraphicsPipelineState>& pipelineState, GpuDeviceFlags deviceMask)
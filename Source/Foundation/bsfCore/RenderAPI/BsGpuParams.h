@@ -350,6 +350,28 @@ namespace bs
 		static SPtr<GpuParams> create(const SPtr<GpuPipelineParamInfo>& paramInfo,
 										  GpuDeviceFlags deviceMask = GDF_DEFAULT);
 
+		/**
+		 * Returns a counter that increments whenever a different object is assigned to one of the parameters. Changes
+		 * to the contents of the assigned parameter block buffers aren't included, see
+		 * GpuParamBlockBuffer::getVersion().
+		 */
+		UINT64 getVersion() const { return mVersion; }
+
+		/** Returns the number of parameter block buffer slots, across all sets and GPU programs. */
+		UINT32 _getNumParamBlockBuffers() const;
+
+		/**
+		 * Returns the parameter block buffer at the provided sequential index, in range
+		 * [0, _getNumParamBlockBuffers()).
+		 */
+		const SPtr<GpuParamBlockBuffer>& _getParamBlockBuffer(UINT32 sequentialIdx) const
+		{
+			return mParamBlockBuffers[sequentialIdx];
+		}
+
+		/** @copydoc GpuParamsBase::_markCoreDirty */
+		void _markCoreDirty() override { mVersion++; }
+
 	protected:
 		friend class bs::GpuParams;
 		friend class HardwareBufferManager;
@@ -361,6 +383,8 @@ namespace bs
 
 		/** @copydoc CoreObject::syncToCore */
 		void syncToCore(const CoreSyncData& data) override;
+
+		UINT64 mVersion = 0;
 	};
 
 	/** @} */
@@ -87,8 +87,8 @@ namespace bs
 	namespace ct
 	{
 	GpuProgram::GpuProgram(const GPU_PROGRAM_DESC& desc, GpuDeviceFlags deviceMask)
-		: mNeedsAdjacencyInfo(desc.requiresAdjacency), mType(desc.type), mEntryPoint(desc.entryPoint), mSource(desc.source)
-		, mBytecode(desc.bytecode)
+		: mNeedsAdjacencyInfo(desc.requiresAdjacency), mType(desc.type), mLanguage(desc.language)
+		, mEntryPoint(desc.entryPoint), mSource(desc.source), mBytecode(desc.bytecode)
 	{
 		mParametersDesc = bs_shared_ptr_new<GpuParamDesc>();
 	}
@@ -101,6 +101,18 @@ namespace bs
 		return true;
 	}
 
+	GPU_PROGRAM_DESC GpuProgram::getDesc() const
+	{
+		GPU_PROGRAM_DESC desc;
+		desc.source = mSource;
+		desc.entryPoint = mEntryPoint;
+		desc.language = mLanguage;
+		desc.type = mType;
+		desc.requiresAdjacency = mNeedsAdjacencyInfo;
+
+		return desc;
+	}
+
 	SPtr<GpuProgram> GpuProgram::create(const GPU_PROGRAM_DESC& desc, GpuDeviceFlags deviceMask)
 	{
 		return GpuProgramManager::instance().create(desc, deviceMask);
@@ -195,6 +195,13 @@ namespace bs
 		/** Returns the compiled bytecode of this program. */
 		SPtr<GpuProgramBytecode> getBytecode() const { return mBytecode; }
 
+		/**
+		 * Returns a descriptor that can be used for creating a copy of this program. The descriptor references the
+		 * program source and not its bytecode, so the copy can also be created on a different render backend, as long as
+		 * it supports the program's language.
+		 */
+		GPU_PROGRAM_DESC getDesc() const;
+
 		/**
 		 * @copydoc bs::GpuProgram::create(const GPU_PROGRAM_DESC&)
 		 * @param[in]	deviceMask		Mask that determines on which GPU devices should the object be created on.
@@ -221,6 +228,7 @@ namespace bs
 		SPtr<VertexDeclaration> mInputDeclaration;
 
 		GpuProgramType mType;
+		String mLanguage;
 		String mEntryPoint;
 		String mSource;
 
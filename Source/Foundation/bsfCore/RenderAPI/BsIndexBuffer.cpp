@@ -97,6 +97,9 @@ namespace bs
 		}
 #endif
 
+		if (options != GBL_READ_ONLY)
+			RenderAPI::_notifyBufferWrite(length);
+
 		return mBuffer->lock(offset, length, options, deviceIdx, queueIdx);
 	}
 
@@ -116,6 +119,7 @@ namespace bs
 		UINT32 queueIdx)
 	{
 		mBuffer->writeData(offset, length, source, writeFlags, queueIdx);
+		RenderAPI::_notifyBufferWrite(length);
 
 		BS_INC_RENDER_STAT_CAT(ResWrite, RenderStatObject_IndexBuffer);
 	}
@@ -112,6 +112,9 @@ namespace bs
 		/** Returns the hash value generated from the rasterizer state properties. */
 		UINT64 getHash() const { return mHash; }
 
+		/**	Returns the descriptor originally used for creating the rasterizer state. */
+		RASTERIZER_STATE_DESC getDesc() const { return mData; }
+
 	protected:
 		friend class RasterizerState;
 		friend class ct::RasterizerState;
@@ -12,6 +12,7 @@
 #include "RenderAPI/BsRasterizerState.h"
 #include "RenderAPI/BsGpuBuffer.h"
 #include "RenderAPI/BsGpuPipelineState.h"
+#include "RenderAPI/BsRenderAPICapture.h"
 
 using namespace std::placeholders;
 
@@ -141,6 +142,9 @@ namespace bs
 
 	namespace ct
 	{
+	/** Command buffer that render API calls on the current thread queue their commands on, if not main. */
+	static BS_THREADLOCAL const SPtr<CommandBuffer>* sThreadCommandBuffer = nullptr;
+
 	RenderAPI::RenderAPI()
 		: mCurrentCapabilities(nullptr), mNumDevices(0)
 	{
@@ -190,6 +194,162 @@ namespace bs
 	void RenderAPI::destroyCore()
 	{
 		mActiveRenderTarget = nullptr;
+		mCapture = nullptr;
+	}
+
+	void RenderAPI::setGpuParams(const SPtr<GpuParams>& gpuParams, const SPtr<CommandBuffer>& commandBuffer)
+	{
+		if (mCapture != nullptr)
+			mCapture->setGpuParams(gpuParams, commandBuffer);
+
+		setGpuParamsImpl(gpuParams, commandBuffer);
+	}
+
+	void RenderAPI::setGraphicsPipeline(const SPtr<GraphicsPipelineState>& pipelineState,
+		const SPtr<CommandBuffer>& commandBuffer)
+	{
+		if (mCapture != nullptr)
+			mCapture->setGraphicsPipeline(pipelineState, commandBuffer);
+
+		setGraphicsPipelineImpl(pipelineState, commandBuffer);
+	}
+
+	void RenderAPI::setComputePipeline(const SPtr<ComputePipelineState>& pipelineState,
+		const SPtr<CommandBuffer>& commandBuffer)
+	{
+		if (mCapture != nullptr)
+			mCapture->setComputePipeline(pipelineState, commandBuffer);
+
+		setComputePipelineImpl(pipelineState, commandBuffer);
+	}
+
+	void RenderAPI::setViewport(const Rect2& area, const SPtr<CommandBuffer>& commandBuffer)
+	{
+		if (mCapture != nullptr)
+			mCapture->setViewport(area, commandBuffer);
+
+		setViewportImpl(area, commandBuffer);
+	}
+
+	void RenderAPI::setScissorRect(UINT32 left, UINT32 top, UINT32 right, UINT32 bottom,
+		const SPtr<CommandBuffer>& commandBuffer)
+	{
+		if (mCapture != nullptr)
+			mCapture->setScissorRect(left, top, right, bottom, commandBuffer);
+
+		setScissorRectImpl(left, top, right, bottom, commandBuffer);
+	}
+
+	void RenderAPI::setStencilRef(UINT32 value, const SPtr<CommandBuffer>& commandBuffer)
+	{
+		if (mCapture != nullptr)
+			mCapture->setStencilRef(value, commandBuffer);
+
+		setStencilRefImpl(value, commandBuffer);
+	}
+
+	void RenderAPI::setVertexBuffers(UINT32 index, SPtr<VertexBuffer>* buffers, UINT32 numBuffers,
+		const SPtr<CommandBuffer>& commandBuffer)
+	{
+		if (mCapture != nullptr)
+			mCapture->setVertexBuffers(index, buffers, numBuffers, commandBuffer);
+
+		setVertexBuffersImpl(index, buffers, numBuffers, commandBuffer);
+	}
+
+	void RenderAPI::setIndexBuffer(const SPtr<IndexBuffer>& buffer, const SPtr<CommandBuffer>& commandBuffer)
+	{
+		if (mCapture != nullptr)
+			mCapture->setIndexBuffer(buffer, commandBuffer);
+
+		setIndexBufferImpl(buffer, commandBuffer);
+	}
+
+	void RenderAPI::setVertexDeclaration(const SPtr<VertexDeclaration>& vertexDeclaration,
+		const SPtr<CommandBuffer>& commandBuffer)
+	{
+		if (mCapture != nullptr)
+			mCapture->setVertexDeclaration(vertexDeclaration, commandBuffer);
+
+		setVertexDeclarationImpl(vertexDeclaration, commandBuffer);
+	}
+
+	void RenderAPI::setDrawOperation(DrawOperationType op, const SPtr<CommandBuffer>& commandBuffer)
+	{
+		if (mCapture != nullptr)
+			mCapture->setDrawOperation(op, commandBuffer);
+
+		setDrawOperationImpl(op, commandBuffer);
+	}
+
+	void RenderAPI::draw(UINT32 vertexOffset, UINT32 vertexCount, UINT32 instanceCount,
+		const SPtr<CommandBuffer>& commandBuffer)
+	{
+		if (mCapture != nullptr)
+			mCapture->draw(vertexOffset, vertexCount, instanceCount, commandBuffer);
+
+		drawImpl(vertexOffset, vertexCount, instanceCount, commandBuffer);
+	}
+
+	void RenderAPI::drawIndexed(UINT32 startIndex, UINT32 indexCount, UINT32 vertexOffset, UINT32 vertexCount,
+		UINT32 instanceCount, const SPtr<CommandBuffer>& commandBuffer)
+	{
+		if (mCapture != nullptr)
+			mCapture->drawIndexed(startIndex, indexCount, vertexOffset, vertexCount, instanceCount, commandBuffer);
+
+		drawIndexedImpl(startIndex, indexCount, vertexOffset, vertexCount, instanceCount, commandBuffer);
+	}
+
+	void RenderAPI::dispatchCompute(UINT32 numGroupsX, UINT32 numGroupsY, UINT32 numGroupsZ,
+		const SPtr<CommandBuffer>& commandBuffer)
+	{
+		if (mCapture != nullptr)
+			mCapture->dispatchCompute(numGroupsX, numGroupsY, numGroupsZ, commandBuffer);
+
+		dispatchComputeImpl(numGroupsX, numGroupsY, numGroupsZ, commandBuffer);
+	}
+
+	void RenderAPI::setRenderTarget(const SPtr<RenderTarget>& target, UINT32 readOnlyFlags,
+		RenderSurfaceMask loadMask, const SPtr<CommandBuffer>& commandBuffer)
+	{
+		if (mCapture != nullptr)
+			mCapture->setRenderTarget(target, readOnlyFlags, loadMask, commandBuffer);
+
+		setRenderTargetImpl(target, readOnlyFlags, loadMask, commandBuffer);
+	}
+
+	void RenderAPI::clearRenderTarget(UINT32 buffers, const Color& color, float depth, UINT16 stencil,
+		UINT8 targetMask, const SPtr<CommandBuffer>& commandBuffer)
+	{
+		if (mCapture != nullptr)
+			mCapture->clearRenderTarget(buffers, color, depth, stencil, targetMask, commandBuffer);
+
+		clearRenderTargetImpl(buffers, color, depth, stencil, targetMask, commandBuffer);
+	}
+
+	void RenderAPI::clearViewport(UINT32 buffers, const Color& color, float depth, UINT16 stencil,
+		UINT8 targetMask, const SPtr<CommandBuffer>& commandBuffer)
+	{
+		if (mCapture != nullptr)
+			mCapture->clearViewport(buffers, color, depth, stencil, targetMask, commandBuffer);
+
+		clearViewportImpl(buffers, color, depth, stencil, targetMask, commandBuffer);
+	}
+
+	void RenderAPI::addCommands(const SPtr<CommandBuffer>& commandBuffer, const SPtr<CommandBuffer>& secondary)
+	{
+		if (mCapture != nullptr)
+			mCapture->addCommands(commandBuffer, secondary);
+
+		addCommandsImpl(commandBuffer, secondary);
+	}
+
+	void RenderAPI::submitCommandBuffer(const SPtr<CommandBuffer>& commandBuffer, UINT32 syncMask)
+	{
+		if (mCapture != nullptr)
+			mCapture->submitCommandBuffer(commandBuffer);
+
+		submitCommandBufferImpl(commandBuffer, syncMask);
 	}
 
 	const RenderAPICapabilities& RenderAPI::getCapabilities(UINT32 deviceIdx) const
@@ -204,6 +364,41 @@ namespace bs
 		return mCurrentCapabilities[deviceIdx];
 	}
 
+	void RenderAPI::_setThreadCommandBuffer(const SPtr<CommandBuffer>* commandBuffer)
+	{
+		sThreadCommandBuffer = commandBuffer;
+	}
+
+	const SPtr<CommandBuffer>& RenderAPI::_getThreadCommandBuffer()
+	{
+		static const SPtr<CommandBuffer> EMPTY;
+
+		if (sThreadCommandBuffer != nullptr)
+			return *sThreadCommandBuffer;
+
+		return EMPTY;
+	}
+
+	void RenderAPI::_setCapture(const SPtr<RenderAPICapture>& capture)
+	{
+		// Calls on the main command buffer are usually submitted implicitly (e.g. on buffer swap), possibly after the
+		// capture is removed, so make sure the calls recorded so far become part of the capture
+		if (mCapture != nullptr)
+			mCapture->submitCommandBuffer(nullptr);
+
+		mCapture = capture;
+	}
+
+	void RenderAPI::_notifyBufferWrite(UINT32 length)
+	{
+		if (!isStarted())
+			return;
+
+		const SPtr<RenderAPICapture>& capture = instance().mCapture;
+		if (capture != nullptr)
+			capture->writeBuffer(length);
+	}
+
 	UINT32 RenderAPI::vertexCountToPrimCount(DrawOperationType type, UINT32 elementCount)
 	{
 		UINT32 primCount = 0;
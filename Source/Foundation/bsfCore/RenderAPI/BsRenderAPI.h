@@ -202,8 +202,8 @@ namespace bs
 		 * like textures, samplers, or uniform buffers. Caller is expected to ensure the provided parameters actually
 		 * match the currently bound programs.
 		 */
-		virtual void setGpuParams(const SPtr<GpuParams>& gpuParams,
-			const SPtr<CommandBuffer>& commandBuffer = nullptr) = 0;
+		void setGpuParams(const SPtr<GpuParams>& gpuParams,
+			const SPtr<CommandBuffer>& commandBuffer = nullptr);
 
 		/**
 		 * Sets a pipeline state that controls how will subsequent draw commands render primitives.
@@ -215,8 +215,8 @@ namespace bs
 		 *
 		 * @see		GraphicsPipelineState
 		 */
-		virtual void setGraphicsPipeline(const SPtr<GraphicsPipelineState>& pipelineState,
-			const SPtr<CommandBuffer>& commandBuffer = nullptr) = 0;
+		void setGraphicsPipeline(const SPtr<GraphicsPipelineState>& pipelineState,
+			const SPtr<CommandBuffer>& commandBuffer = nullptr);
 
 		/**
 		 * Sets a pipeline state that controls how will subsequent dispatch commands execute.
@@ -226,8 +226,8 @@ namespace bs
 		 *									is executed immediately. Otherwise it is executed when executeCommands() is
 		 *									called. Buffer must support graphics operations.
 		 */
-		virtual void setComputePipeline(const SPtr<ComputePipelineState>& pipelineState,
-			const SPtr<CommandBuffer>& commandBuffer = nullptr) = 0;
+		void setComputePipeline(const SPtr<ComputePipelineState>& pipelineState,
+			const SPtr<CommandBuffer>& commandBuffer = nullptr);
 
 		/**
 		 * Sets the active viewport that will be used for all render operations.
@@ -237,7 +237,7 @@ namespace bs
 		 *								is executed immediately. Otherwise it is executed when executeCommands() is called.
 		 *								Buffer must support graphics operations.
 		 */
-		virtual void setViewport(const Rect2& area, const SPtr<CommandBuffer>& commandBuffer = nullptr) = 0;
+		void setViewport(const Rect2& area, const SPtr<CommandBuffer>& commandBuffer = nullptr);
 
 		/**
 		 * Allows you to set up a region in which rendering can take place. Coordinates are in pixels. No rendering will be
@@ -251,8 +251,8 @@ namespace bs
 		 *								is executed immediately. Otherwise it is executed when executeCommands() is called.
 		 *								Buffer must support graphics operations.
 		 */
-		virtual void setScissorRect(UINT32 left, UINT32 top, UINT32 right, UINT32 bottom,
-			const SPtr<CommandBuffer>& commandBuffer = nullptr) = 0;
+		void setScissorRect(UINT32 left, UINT32 top, UINT32 right, UINT32 bottom,
+			const SPtr<CommandBuffer>& commandBuffer = nullptr);
 
 		/**
 		 * Sets a reference value that will be used for stencil compare operations.
@@ -262,7 +262,7 @@ namespace bs
 		 *								is executed immediately. Otherwise it is executed when executeCommands() is called.
 		 *								Buffer must support graphics operations.
 		 */
-		virtual void setStencilRef(UINT32 value, const SPtr<CommandBuffer>& commandBuffer = nullptr) = 0;
+		void setStencilRef(UINT32 value, const SPtr<CommandBuffer>& commandBuffer = nullptr);
 
 		/**
 		 * Sets the provided vertex buffers starting at the specified source index.	Set buffer to nullptr to clear the
@@ -275,8 +275,8 @@ namespace bs
 		 *								is executed immediately. Otherwise it is executed when executeCommands() is called.
 		 *								Buffer must support graphics operations.
 		 */
-		virtual void setVertexBuffers(UINT32 index, SPtr<VertexBuffer>* buffers, UINT32 numBuffers,
-			const SPtr<CommandBuffer>& commandBuffer = nullptr) = 0;
+		void setVertexBuffers(UINT32 index, SPtr<VertexBuffer>* buffers, UINT32 numBuffers,
+			const SPtr<CommandBuffer>& commandBuffer = nullptr);
 
 		/**
 		 * Sets an index buffer to use when drawing. Indices in an index buffer reference vertices in the vertex buffer,
@@ -287,8 +287,8 @@ namespace bs
 		 *								is executed immediately. Otherwise it is executed when executeCommands() is called.
 		 *								Buffer must support graphics operations.
 		 */
-		virtual void setIndexBuffer(const SPtr<IndexBuffer>& buffer,
-			const SPtr<CommandBuffer>& commandBuffer = nullptr) = 0;
+		void setIndexBuffer(const SPtr<IndexBuffer>& buffer,
+			const SPtr<CommandBuffer>& commandBuffer = nullptr);
 
 		/**
 		 * Sets the vertex declaration to use when drawing. Vertex declaration is used to decode contents of a single
@@ -299,8 +299,8 @@ namespace bs
 		 *									is executed immediately. Otherwise it is executed when executeCommands() is
 		 *									called. Buffer must support graphics operations.
 		 */
-		virtual void setVertexDeclaration(const SPtr<VertexDeclaration>& vertexDeclaration,
-			const SPtr<CommandBuffer>& commandBuffer = nullptr) = 0;
+		void setVertexDeclaration(const SPtr<VertexDeclaration>& vertexDeclaration,
+			const SPtr<CommandBuffer>& commandBuffer = nullptr);
 
 		/**
 		 * Sets the draw operation that determines how to interpret the elements of the index or vertex buffers.
@@ -310,8 +310,8 @@ namespace bs
 		 *								is executed immediately. Otherwise it is executed when executeCommands() is called.
 		 *								Buffer must support graphics operations.
 		 */
-		virtual void setDrawOperation(DrawOperationType op,
-			const SPtr<CommandBuffer>& commandBuffer = nullptr) = 0;
+		void setDrawOperation(DrawOperationType op,
+			const SPtr<CommandBuffer>& commandBuffer = nullptr);
 
 		/**
 		 * Draw an object based on currently bound GPU programs, vertex declaration and vertex buffers. Draws directly from
@@ -325,8 +325,8 @@ namespace bs
 		 *								is executed immediately. Otherwise it is executed when executeCommands() is called.
 		 *								Buffer must support graphics operations.
 		 */
-		virtual void draw(UINT32 vertexOffset, UINT32 vertexCount, UINT32 instanceCount = 0,
-			const SPtr<CommandBuffer>& commandBuffer = nullptr) = 0;
+		void draw(UINT32 vertexOffset, UINT32 vertexCount, UINT32 instanceCount = 0,
+			const SPtr<CommandBuffer>& commandBuffer = nullptr);
 
 		/**
 		 * Draw an object based on currently bound GPU programs, vertex declaration, vertex and index buffers.
@@ -341,8 +341,8 @@ namespace bs
 		 *								is executed immediately. Otherwise it is executed when executeCommands() is called.
 		 *								Buffer must support graphics operations.
 		 */
-		virtual void drawIndexed(UINT32 startIndex, UINT32 indexCount, UINT32 vertexOffset, UINT32 vertexCount,
-			UINT32 instanceCount = 0, const SPtr<CommandBuffer>& commandBuffer = nullptr) = 0;
+		void drawIndexed(UINT32 startIndex, UINT32 indexCount, UINT32 vertexOffset, UINT32 vertexCount,
+			UINT32 instanceCount = 0, const SPtr<CommandBuffer>& commandBuffer = nullptr);
 
 		/**
 		 * Executes the currently bound compute shader.
@@ -354,8 +354,8 @@ namespace bs
 		 *								is executed immediately. Otherwise it is executed when executeCommands() is called.
 		 *								Buffer must support compute or graphics operations.
 		 */
-		virtual void dispatchCompute(UINT32 numGroupsX, UINT32 numGroupsY = 1, UINT32 numGroupsZ = 1,
-			const SPtr<CommandBuffer>& commandBuffer = nullptr) = 0;
+		void dispatchCompute(UINT32 numGroupsX, UINT32 numGroupsY = 1, UINT32 numGroupsZ = 1,
+			const SPtr<CommandBuffer>& commandBuffer = nullptr);
 
 		/**
 		 * Swap the front and back buffer of the specified render target.
@@ -388,8 +388,8 @@ namespace bs
 		 *										is executed immediately. Otherwise it is executed when executeCommands() is
 		 *										called. Buffer must support graphics operations.
 		 */
-		virtual void setRenderTarget(const SPtr<RenderTarget>& target, UINT32 readOnlyFlags = 0,
-			RenderSurfaceMask loadMask = RT_NONE, const SPtr<CommandBuffer>& commandBuffer = nullptr) = 0;
+		void setRenderTarget(const SPtr<RenderTarget>& target, UINT32 readOnlyFlags = 0,
+			RenderSurfaceMask loadMask = RT_NONE, const SPtr<CommandBuffer>& commandBuffer = nullptr);
 
 		/**
 		 * Clears the currently active render target.
@@ -405,8 +405,8 @@ namespace bs
 		 *								is executed immediately. Otherwise it is executed when executeCommands() is called.
 		 *								Buffer must support graphics operations.
 		 */
-		virtual void clearRenderTarget(UINT32 buffers, const Color& color = Color::Black, float depth = 1.0f,
-			UINT16 stencil = 0, UINT8 targetMask = 0xFF, const SPtr<CommandBuffer>& commandBuffer = nullptr) = 0;
+		void clearRenderTarget(UINT32 buffers, const Color& color = Color::Black, float depth = 1.0f,
+			UINT16 stencil = 0, UINT8 targetMask = 0xFF, const SPtr<CommandBuffer>& commandBuffer = nullptr);
 
 		/**
 		 * Clears the currently active viewport (meaning it clears just a sub-area of a render-target that is covered by the
@@ -423,11 +423,11 @@ namespace bs
 		 *								is executed immediately. Otherwise it is executed when executeCommands() is called.
 		 *								Buffer must support graphics operations.
 		 */
-		virtual void clearViewport(UINT32 buffers, const Color& color = Color::Black, float depth = 1.0f,
-			UINT16 stencil = 0, UINT8 targetMask = 0xFF, const SPtr<CommandBuffer>& commandBuffer = nullptr) = 0;
+		void clearViewport(UINT32 buffers, const Color& color = Color::Black, float depth = 1.0f,
+			UINT16 stencil = 0, UINT8 targetMask = 0xFF, const SPtr<CommandBuffer>& commandBuffer = nullptr);
 
 		/** Appends all commands from the provided secondary command buffer into the primary command buffer. */
-		virtual void addCommands(const SPtr<CommandBuffer>& commandBuffer, const SPtr<CommandBuffer>& secondary) = 0;
+		void addCommands(const SPtr<CommandBuffer>& commandBuffer, const SPtr<CommandBuffer>& secondary);
 
 		/**
 		 * Executes all commands in the provided command buffer. Command buffer cannot be secondary.
@@ -445,13 +445,48 @@ namespace bs
 		 *
 		 * @note	Core thread only.
 		 */
-		virtual void submitCommandBuffer(const SPtr<CommandBuffer>& commandBuffer, UINT32 syncMask = 0xFFFFFFFF) = 0;
+		void submitCommandBuffer(const SPtr<CommandBuffer>& commandBuffer, UINT32 syncMask = 0xFFFFFFFF);
 
 		/**
 		 * Returns the currently active main command buffer instance. All commands queues without a user-provided command
 		 * buffer will be queued on this command buffer. The command buffer instance will change after it has been submitted.
 		 */
 		virtual SPtr<CommandBuffer> getMainCommandBuffer() const = 0;
+
+		/**
+		 * Makes all render API calls on the calling thread that don't provide a command buffer queue their commands
+		 * on the provided command buffer, instead of the main command buffer. This allows code that doesn't accept a
+		 * command buffer (e.g. renderer materials and utility methods) to record into a secondary command buffer on a
+		 * worker thread. Provide null to revert back to the main command buffer.
+		 *
+		 * @param[in]	commandBuffer	Pointer to the command buffer to record to. The pointer must remain valid
+		 *								until the method is called again.
+		 *
+		 * @note	Thread safe. Recording on threads other than the core thread requires RSC_SECONDARY_CB.
+		 */
+		static void _setThreadCommandBuffer(const SPtr<CommandBuffer>* commandBuffer);
+
+		/**
+		 * Returns the command buffer set by _setThreadCommandBuffer() for the calling thread, or null if commands are
+		 * queued on the main command buffer.
+		 */
+		static const SPtr<CommandBuffer>& _getThreadCommandBuffer();
+
+		/**
+		 * Starts recording all subsequent render API calls into the provided capture, which can then be analyzed or
+		 * replayed. Provide null to stop recording. Calls on the main command buffer that weren't submitted yet are
+		 * added to the previously set capture.
+		 */
+		void _setCapture(const SPtr<RenderAPICapture>& capture);
+
+		/** Returns the capture set by _setCapture(), if any. */
+		const SPtr<RenderAPICapture>& _getCapture() const { return mCapture; }
+
+		/**
+		 * Notifies the active capture, if any, that @p length bytes were written to a GPU buffer. Called by buffers
+		 * whenever their contents are written to.
+		 */
+		static void _notifyBufferWrite(UINT32 length);
 		
 		/**
 		 * Gets the capabilities of a specific GPU.
@@ -530,6 +565,71 @@ namespace bs
 		/** Converts the number of vertices to number of primitives based on the specified draw operation. */
 		UINT32 vertexCountToPrimCount(DrawOperationType type, UINT32 elementCount);
 
+		/** @copydoc setGpuParams */
+		virtual void setGpuParamsImpl(const SPtr<GpuParams>& gpuParams, const SPtr<CommandBuffer>& commandBuffer) = 0;
+
+		/** @copydoc setGraphicsPipeline */
+		virtual void setGraphicsPipelineImpl(const SPtr<GraphicsPipelineState>& pipelineState,
+			const SPtr<CommandBuffer>& commandBuffer) = 0;
+
+		/** @copydoc setComputePipeline */
+		virtual void setComputePipelineImpl(const SPtr<ComputePipelineState>& pipelineState,
+			const SPtr<CommandBuffer>& commandBuffer) = 0;
+
+		/** @copydoc setViewport */
+		virtual void setViewportImpl(const Rect2& area, const SPtr<CommandBuffer>& commandBuffer) = 0;
+
+		/** @copydoc setScissorRect */
+		virtual void setScissorRectImpl(UINT32 left, UINT32 top, UINT32 right, UINT32 bottom,
+			const SPtr<CommandBuffer>& commandBuffer) = 0;
+
+		/** @copydoc setStencilRef */
+		virtual void setStencilRefImpl(UINT32 value, const SPtr<CommandBuffer>& commandBuffer) = 0;
+
+		/** @copydoc setVertexBuffers */
+		virtual void setVertexBuffersImpl(UINT32 index, SPtr<VertexBuffer>* buffers, UINT32 numBuffers,
+			const SPtr<CommandBuffer>& commandBuffer) = 0;
+
+		/** @copydoc setIndexBuffer */
+		virtual void setIndexBufferImpl(const SPtr<IndexBuffer>& buffer, const SPtr<CommandBuffer>& commandBuffer) = 0;
+
+		/** @copydoc setVertexDeclaration */
+		virtual void setVertexDeclarationImpl(const SPtr<VertexDeclaration>& vertexDeclaration,
+			const SPtr<CommandBuffer>& commandBuffer) = 0;
+
+		/** @copydoc setDrawOperation */
+		virtual void setDrawOperationImpl(DrawOperationType op, const SPtr<CommandBuffer>& commandBuffer) = 0;
+
+		/** @copydoc draw */
+		virtual void drawImpl(UINT32 vertexOffset, UINT32 vertexCount, UINT32 instanceCount,
+			const SPtr<CommandBuffer>& commandBuffer) = 0;
+
+		/** @copydoc drawIndexed */
+		virtual void drawIndexedImpl(UINT32 startIndex, UINT32 indexCount, UINT32 vertexOffset, UINT32 vertexCount,
+			UINT32 instanceCount, const SPtr<CommandBuffer>& commandBuffer) = 0;
+
+		/** @copydoc dispatchCompute */
+		virtual void dispatchComputeImpl(UINT32 numGroupsX, UINT32 numGroupsY, UINT32 numGroupsZ,
+			const SPtr<CommandBuffer>& commandBuffer) = 0;
+
+		/** @copydoc setRenderTarget */
+		virtual void setRenderTargetImpl(const SPtr<RenderTarget>& target, UINT32 readOnlyFlags,
+			RenderSurfaceMask loadMask, const SPtr<CommandBuffer>& commandBuffer) = 0;
+
+		/** @copydoc clearRenderTarget */
+		virtual void clearRenderTargetImpl(UINT32 buffers, const Color& color, float depth,
+			UINT16 stencil, UINT8 targetMask, const SPtr<CommandBuffer>& commandBuffer) = 0;
+
+		/** @copydoc clearViewport */
+		virtual void clearViewportImpl(UINT32 buffers, const Color& color, float depth,
+			UINT16 stencil, UINT8 targetMask, const SPtr<CommandBuffer>& commandBuffer) = 0;
+
+		/** @copydoc addCommands */
+		virtual void addCommandsImpl(const SPtr<CommandBuffer>& commandBuffer, const SPtr<CommandBuffer>& secondary) = 0;
+
+		/** @copydoc submitCommandBuffer */
+		virtual void submitCommandBufferImpl(const SPtr<CommandBuffer>& commandBuffer, UINT32 syncMask) = 0;
+
 		/************************************************************************/
 		/* 								INTERNAL DATA					       	*/
 		/************************************************************************/
@@ -542,6 +642,8 @@ namespace bs
 		RenderAPICapabilities* mCurrentCapabilities;
 		UINT32 mNumDevices;
 		SPtr<VideoModeInfo> mVideoModeInfo;
+
+		SPtr<RenderAPICapture> mCapture;
 	};
 
 	/** Shorthand for RenderAPI::getCapabilities(). */
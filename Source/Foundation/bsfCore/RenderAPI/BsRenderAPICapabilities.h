@@ -59,6 +59,16 @@ namespace bs
 		RSC_RENDER_TARGET_LAYERS		= BS_CAPS_VALUE(CAPS_CATEGORY_COMMON, 10),
 		/** Has native support for command buffers that can be populated from secondary threads. */
 		RSC_MULTI_THREADED_CB			= BS_CAPS_VALUE(CAPS_CATEGORY_COMMON, 11),
+		/**
+		 * Supports binding a sub-range of a parameter block buffer, starting at an offset that is a multiple of
+		 * RenderAPICapabilities::paramBlockOffsetAlignment.
+		 */
+		RSC_PARAM_BLOCK_OFFSETS			= BS_CAPS_VALUE(CAPS_CATEGORY_COMMON, 12),
+		/**
+		 * Supports recording secondary command buffers on worker threads (see RenderAPI::_setThreadCommandBuffer()) and
+		 * appending them to a primary command buffer through RenderAPI::addCommands().
+		 */
+		RSC_SECONDARY_CB				= BS_CAPS_VALUE(CAPS_CATEGORY_COMMON, 13),
 	};
 
 	/** Conventions used for a specific render backend. */
@@ -158,6 +168,12 @@ namespace bs
 		/** Total number of parameter block buffers available. */
 		UINT16 numCombinedParamBlockBuffers = 0;
 
+		/**
+		 * Alignment required for offsets of parameter block buffer sub-ranges, in bytes. Only relevant if
+		 * RSC_PARAM_BLOCK_OFFSETS is supported.
+		 */
+		UINT32 paramBlockOffsetAlignment = 256;
+
 		/** The number of load-store texture unitss available per stage. */
 		UINT16 numLoadStoreTextureUnitsPerStage[GPT_COUNT] { 0 };
 
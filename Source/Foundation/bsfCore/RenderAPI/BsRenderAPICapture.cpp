@@ -0,0 +1,1450 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#include "RenderAPI/BsRenderAPICapture.h"
+#include "RenderAPI/BsRenderAPI.h"
+#include "RenderAPI/BsGpuParams.h"
+#include "RenderAPI/BsGpuPipelineState.h"
+#include "RenderAPI/BsVertexBuffer.h"
+#include "RenderAPI/BsIndexBuffer.h"
+#include "RenderAPI/BsVertexDeclaration.h"
+#include "RenderAPI/BsRenderTarget.h"
+#include "RenderAPI/BsRenderTexture.h"
+#include "RenderAPI/BsGpuProgram.h"
+#include "RenderAPI/BsGpuBuffer.h"
+#include "RenderAPI/BsGpuParamBlockBuffer.h"
+#include "RenderAPI/BsGpuParamDesc.h"
+#include "RenderAPI/BsGpuPipelineParamInfo.h"
+#include "RenderAPI/BsBlendState.h"
+#include "RenderAPI/BsRasterizerState.h"
+#include "RenderAPI/BsDepthStencilState.h"
+#include "RenderAPI/BsSamplerState.h"
+#include "Image/BsTexture.h"
+#include "Managers/BsGpuProgramManager.h"
+#include "Managers/BsHardwareBufferManager.h"
+#include "Serialization/BsBinarySerializer.h"
+#include "FileSystem/BsDataStream.h"
+
+namespace bs { namespace ct
+{
+	/** Identifies a stream containing a saved capture. */
+	static constexpr UINT32 CAPTURE_FILE_ID = 0x43415242; // "BRAC"
+
+	/** Version of the saved capture format. Captures saved with a different version can't be loaded. */
+	static constexpr UINT32 CAPTURE_FILE_VERSION = 1;
+
+	/** Appends values to a buffer, in the format expected by CaptureReader. */
+	class CaptureWriter
+	{
+	public:
+		CaptureWriter(Vector<UINT8>& data)
+			:mData(data)
+		{ }
+
+		/** Appends the raw bytes of @p value. */
+		template<class T>
+		void write(const T& value)
+		{
+			static_assert(std::is_trivially_copyable<T>::value, "Only trivially copyable values can be written.");
+			writeBytes(&value, sizeof(T));
+		}
+
+		/** Appends the length of the string, followed by its characters. */
+		void writeString(const String& value)
+		{
+			write((UINT32)value.size());
+			writeBytes(value.data(), (UINT32)value.size());
+		}
+
+		/** Appends @p size bytes from @p data. */
+		void writeBytes(const void* data, UINT32 size)
+		{
+			const UINT32 offset = (UINT32)mData.size();
+			mData.resize(offset + size);
+
+			if (size > 0)
+				memcpy(mData.data() + offset, data, size);
+		}
+
+	private:
+		Vector<UINT8>& mData;
+	};
+
+	/**
+	 * Reads values written by CaptureWriter or RenderAPICapture::write(). Reads past the end of the data return
+	 * default values and set the error flag, so saved captures that were truncated can be detected.
+	 */
+	class CaptureReader
+	{
+	public:
+		CaptureReader(const Vector<UINT8>& data)
+			:mData(data)
+		{ }
+
+		/** Reads the next value from the stream. */
+		template<class T>
+		T read()
+		{
+			static_assert(std::is_trivially_copyable<T>::value, "Only trivially copyable values can be read.");
+
+			T value = T();
+			readBytes(&value, sizeof(T));
+
+			return value;
+		}
+
+		/** Reads a string written by CaptureWriter::writeString(). */
+		String readString()
+		{
+			const UINT32 length = read<UINT32>();
+			if (!canRead(length))
+				return String();
+
+			String value((const char*)mData.data() + mOffset, length);
+			mOffset += length;
+
+			return value;
+		}
+
+		/** Reads the next @p size bytes into @p data. */
+		void readBytes(void* data, UINT32 size)
+		{
+			if (!canRead(size))
+				return;
+
+			if (size > 0)
+				memcpy(data, mData.data() + mOffset, size);
+
+			mOffset += size;
+		}
+
+		/** Checks are there any more values left to read. */
+		bool eof() const { return mOffset >= (UINT32)mData.size(); }
+
+		/** Returns true if a read went past the end of the data. */
+		bool hasError() const { return mError; }
+
+	private:
+		/** Checks can @p size more bytes be read, and sets the error flag if not. */
+		bool canRead(UINT32 size)
+		{
+			if ((UINT64)mOffset + size <= (UINT64)mData.size())
+				return true;
+
+			mOffset = (UINT32)mData.size();
+			mError = true;
+
+			return false;
+		}
+
+		const Vector<UINT8>& mData;
+		UINT32 mOffset = 0;
+		bool mError = false;
+	};
+
+	template<class T>
+	void RenderAPICapture::write(Stream& stream, const T& value)
+	{
+		CaptureWriter(stream.data).write(value);
+	}
+
+	UINT32 RenderAPICapture::ObjectTable::add(const SPtr<CoreObject>& object, ObjectType type)
+	{
+		if (object == nullptr)
+			return (UINT32)-1;
+
+		const auto iterFind = lookup.find(object.get());
+		if (iterFind != lookup.end())
+			return iterFind->second;
+
+		const UINT32 idx = (UINT32)objects.size();
+		objects.push_back(object);
+		types.push_back(type);
+		lookup[object.get()] = idx;
+
+		return idx;
+	}
+
+	SPtr<CoreObject> RenderAPICapture::ObjectTable::get(UINT32 idx) const
+	{
+		return idx < (UINT32)objects.size() ? objects[idx] : nullptr;
+	}
+
+	template<class T>
+	void RenderAPICapture::updateState(Stream& stream, StateSlot slot, T& current, const T& value)
+	{
+		const UINT32 mask = 1 << slot;
+		if ((stream.boundState.known & mask) != 0 && current == value)
+			stream.stats.numRedundantBinds++;
+		else
+			stream.stats.numStateChanges++;
+
+		current = value;
+		stream.boundState.known |= mask;
+	}
+
+	RenderAPICapture::Stream& RenderAPICapture::getStream(const SPtr<CommandBuffer>& commandBuffer)
+	{
+		SPtr<CommandBuffer> target = commandBuffer;
+		if (target == nullptr)
+			target = RenderAPI::_getThreadCommandBuffer();
+
+		// Calls on the main command buffer can also be made by passing it explicitly
+		if (target == nullptr || target == RenderAPI::instance().getMainCommandBuffer())
+			return mMainStream;
+
+		Stream& stream = mPendingStreams[target.get()];
+		stream.commandBuffer = target;
+
+		return stream;
+	}
+
+	void RenderAPICapture::append(Stream& dest, Stream& source)
+	{
+		dest.data.insert(dest.data.end(), source.data.begin(), source.data.end());
+
+		dest.stats.numCommands += source.stats.numCommands;
+		dest.stats.numDrawCalls += source.stats.numDrawCalls;
+		dest.stats.numComputeCalls += source.stats.numComputeCalls;
+		dest.stats.numClears += source.stats.numClears;
+		dest.stats.numStateChanges += source.stats.numStateChanges;
+		dest.stats.numRedundantBinds += source.stats.numRedundantBinds;
+		dest.stats.numParamBinds += source.stats.numParamBinds;
+		dest.stats.numBufferWrites += source.stats.numBufferWrites;
+		dest.stats.bytesUploaded += source.stats.bytesUploaded;
+
+		source.data.clear();
+		source.boundState = BoundState();
+		source.stats = RenderAPICaptureStats();
+	}
+
+	void RenderAPICapture::setGraphicsPipeline(const SPtr<GraphicsPipelineState>& pipelineState,
+		const SPtr<CommandBuffer>& commandBuffer)
+	{
+		Lock lock(mMutex);
+		Stream& stream = getStream(commandBuffer);
+
+		write(stream, Command::SetGraphicsPipeline);
+		write(stream, mObjects.add(pipelineState, ObjectType::GraphicsPipeline));
+
+		updateState(stream, SS_GraphicsPipeline, stream.boundState.graphicsPipeline, (const void*)pipelineState.get());
+		stream.stats.numCommands++;
+	}
+
+	void RenderAPICapture::setComputePipeline(const SPtr<ComputePipelineState>& pipelineState,
+		const SPtr<CommandBuffer>& commandBuffer)
+	{
+		Lock lock(mMutex);
+		Stream& stream = getStream(commandBuffer);
+
+		write(stream, Command::SetComputePipeline);
+		write(stream, mObjects.add(pipelineState, ObjectType::ComputePipeline));
+
+		updateState(stream, SS_ComputePipeline, stream.boundState.computePipeline, (const void*)pipelineState.get());
+		stream.stats.numCommands++;
+	}
+
+	void RenderAPICapture::setGpuParams(const SPtr<GpuParams>& gpuParams, const SPtr<CommandBuffer>& commandBuffer)
+	{
+		Lock lock(mMutex);
+		Stream& stream = getStream(commandBuffer);
+
+		write(stream, Command::SetGpuParams);
+		write(stream, mObjects.add(gpuParams, ObjectType::GpuParams));
+
+		stream.stats.numParamBinds++;
+		stream.stats.numCommands++;
+	}
+
+	void RenderAPICapture::setViewport(const Rect2& area, const SPtr<CommandBuffer>& commandBuffer)
+	{
+		Lock lock(mMutex);
+		Stream& stream = getStream(commandBuffer);
+
+		write(stream, Command::SetViewport);
+		write(stream, area);
+
+		updateState(stream, SS_Viewport, stream.boundState.viewport, area);
+		stream.stats.numCommands++;
+	}
+
+	void RenderAPICapture::setScissorRect(UINT32 left, UINT32 top, UINT32 right, UINT32 bottom,
+		const SPtr<CommandBuffer>& commandBuffer)
+	{
+		Lock lock(mMutex);
+		Stream& stream = getStream(commandBuffer);
+		BoundState& state = stream.boundState;
+
+		write(stream, Command::SetScissorRect);
+		write(stream, left);
+		write(stream, top);
+		write(stream, right);
+		write(stream, bottom);
+
+		const UINT32 mask = 1 << SS_ScissorRect;
+		UINT32* current = state.scissorRect;
+		if ((state.known & mask) != 0 && current[0] == left && current[1] == top && current[2] == right &&
+			current[3] == bottom)
+		{
+			stream.stats.numRedundantBinds++;
+		}
+		else
+			stream.stats.numStateChanges++;
+
+		current[0] = left;
+		current[1] = top;
+		current[2] = right;
+		current[3] = bottom;
+		state.known |= mask;
+
+		stream.stats.numCommands++;
+	}
+
+	void RenderAPICapture::setStencilRef(UINT32 value, const SPtr<CommandBuffer>& commandBuffer)
+	{
+		Lock lock(mMutex);
+		Stream& stream = getStream(commandBuffer);
+
+		write(stream, Command::SetStencilRef);
+		write(stream, value);
+
+		updateState(stream, SS_StencilRef, stream.boundState.stencilRef, value);
+		stream.stats.numCommands++;
+	}
+
+	void RenderAPICapture::setVertexBuffers(UINT32 index, SPtr<VertexBuffer>* buffers, UINT32 numBuffers,
+		const SPtr<CommandBuffer>& commandBuffer)
+	{
+		Lock lock(mMutex);
+		Stream& stream = getStream(commandBuffer);
+		BoundState& state = stream.boundState;
+
+		write(stream, Command::SetVertexBuffers);
+		write(stream, index);
+		write(stream, numBuffers);
+
+		bool redundant = true;
+		for (UINT32 i = 0; i < numBuffers; i++)
+		{
+			write(stream, mObjects.add(buffers[i], ObjectType::VertexBuffer));
+
+			const UINT32 slot = index + i;
+			if (slot >= BS_MAX_BOUND_VERTEX_BUFFERS)
+			{
+				redundant = false;
+				continue;
+			}
+
+			const UINT32 mask = 1 << slot;
+			if ((state.vertexBuffersKnown & mask) == 0 || state.vertexBuffers[slot] != buffers[i].get())
+				redundant = false;
+
+			state.vertexBuffers[slot] = buffers[i].get();
+			state.vertexBuffersKnown |= mask;
+		}
+
+		if (redundant && numBuffers > 0)
+			stream.stats.numRedundantBinds++;
+		else
+			stream.stats.numStateChanges++;
+
+		stream.stats.numCommands++;
+	}
+
+	void RenderAPICapture::setIndexBuffer(const SPtr<IndexBuffer>& buffer, const SPtr<CommandBuffer>& commandBuffer)
+	{
+		Lock lock(mMutex);
+		Stream& stream = getStream(commandBuffer);
+
+		write(stream, Command::SetIndexBuffer);
+		write(stream, mObjects.add(buffer, ObjectType::IndexBuffer));
+
+		updateState(stream, SS_IndexBuffer, stream.boundState.indexBuffer, (const void*)buffer.get());
+		stream.stats.numCommands++;
+	}
+
+	void RenderAPICapture::setVertexDeclaration(const SPtr<VertexDeclaration>& vertexDeclaration,
+		const SPtr<CommandBuffer>& commandBuffer)
+	{
+		Lock lock(mMutex);
+		Stream& stream = getStream(commandBuffer);
+
+		write(stream, Command::SetVertexDeclaration);
+		write(stream, mObjects.add(vertexDeclaration, ObjectType::VertexDeclaration));
+
+		const void* declaration = vertexDeclaration.get();
+		updateState(stream, SS_VertexDeclaration, stream.boundState.vertexDeclaration, declaration);
+		stream.stats.numCommands++;
+	}
+
+	void RenderAPICapture::setDrawOperation(DrawOperationType op, const SPtr<CommandBuffer>& commandBuffer)
+	{
+		Lock lock(mMutex);
+		Stream& stream = getStream(commandBuffer);
+
+		write(stream, Command::SetDrawOperation);
+		write(stream, op);
+
+		updateState(stream, SS_DrawOperation, stream.boundState.drawOp, op);
+		stream.stats.numCommands++;
+	}
+
+	void RenderAPICapture::setRenderTarget(const SPtr<RenderTarget>& target, UINT32 readOnlyFlags,
+		RenderSurfaceMask loadMask, const SPtr<CommandBuffer>& commandBuffer)
+	{
+		Lock lock(mMutex);
+		Stream& stream = getStream(commandBuffer);
+		BoundState& state = stream.boundState;
+
+		write(stream, Command::SetRenderTarget);
+		write(stream, mObjects.add(target, ObjectType::RenderTarget));
+		write(stream, readOnlyFlags);
+		write(stream, (UINT32)loadMask);
+
+		const UINT32 mask = 1 << SS_RenderTarget;
+		const bool known = (state.known & mask) != 0;
+
+		// Loading the existing contents is an explicit request, so such binds are never redundant
+		if (known && state.renderTarget == target.get() && state.renderTargetFlags == readOnlyFlags &&
+			loadMask == RT_NONE)
+		{
+			stream.stats.numRedundantBinds++;
+		}
+		else
+		{
+			stream.stats.numStateChanges++;
+
+			// Backends are allowed to reset the viewport and scissor rectangle when the render target changes
+			state.known &= ~((1 << SS_Viewport) | (1 << SS_ScissorRect));
+		}
+
+		state.renderTarget = target.get();
+		state.renderTargetFlags = readOnlyFlags;
+		state.known |= mask;
+
+		stream.stats.numCommands++;
+	}
+
+	void RenderAPICapture::clearRenderTarget(UINT32 buffers, const Color& color, float depth, UINT16 stencil,
+		UINT8 targetMask, const SPtr<CommandBuffer>& commandBuffer)
+	{
+		Lock lock(mMutex);
+		Stream& stream = getStream(commandBuffer);
+
+		write(stream, Command::ClearRenderTarget);
+		write(stream, buffers);
+		write(stream, color);
+		write(stream, depth);
+		write(stream, stencil);
+		write(stream, targetMask);
+
+		stream.stats.numClears++;
+		stream.stats.numCommands++;
+	}
+
+	void RenderAPICapture::clearViewport(UINT32 buffers, const Color& color, float depth, UINT16 stencil,
+		UINT8 targetMask, const SPtr<CommandBuffer>& commandBuffer)
+	{
+		Lock lock(mMutex);
+		Stream& stream = getStream(commandBuffer);
+
+		write(stream, Command::ClearViewport);
+		write(stream, buffers);
+		write(stream, color);
+		write(stream, depth);
+		write(stream, stencil);
+		write(stream, targetMask);
+
+		stream.stats.numClears++;
+		stream.stats.numCommands++;
+	}
+
+	void RenderAPICapture::draw(UINT32 vertexOffset, UINT32 vertexCount, UINT32 instanceCount,
+		const SPtr<CommandBuffer>& commandBuffer)
+	{
+		Lock lock(mMutex);
+		Stream& stream = getStream(commandBuffer);
+
+		write(stream, Command::Draw);
+		write(stream, vertexOffset);
+		write(stream, vertexCount);
+		write(stream, instanceCount);
+
+		stream.stats.numDrawCalls++;
+		stream.stats.numCommands++;
+	}
+
+	void RenderAPICapture::drawIndexed(UINT32 startIndex, UINT32 indexCount, UINT32 vertexOffset, UINT32 vertexCount,
+		UINT32 instanceCount, const SPtr<CommandBuffer>& commandBuffer)
+	{
+		Lock lock(mMutex);
+		Stream& stream = getStream(commandBuffer);
+
+		write(stream, Command::DrawIndexed);
+		write(stream, startIndex);
+		write(stream, indexCount);
+		write(stream, vertexOffset);
+		write(stream, vertexCount);
+		write(stream, instanceCount);
+
+		stream.stats.numDrawCalls++;
+		stream.stats.numCommands++;
+	}
+
+	void RenderAPICapture::dispatchCompute(UINT32 numGroupsX, UINT32 numGroupsY, UINT32 numGroupsZ,
+		const SPtr<CommandBuffer>& commandBuffer)
+	{
+		Lock lock(mMutex);
+		Stream& stream = getStream(commandBuffer);
+
+		write(stream, Command::DispatchCompute);
+		write(stream, numGroupsX);
+		write(stream, numGroupsY);
+		write(stream, numGroupsZ);
+
+		stream.stats.numComputeCalls++;
+		stream.stats.numCommands++;
+	}
+
+	void RenderAPICapture::addCommands(const SPtr<CommandBuffer>& commandBuffer, const SPtr<CommandBuffer>& secondary)
+	{
+		Lock lock(mMutex);
+
+		const auto iterFind = mPendingStreams.find(secondary.get());
+		if (iterFind == mPendingStreams.end())
+			return;
+
+		Stream& stream = getStream(commandBuffer);
+		append(stream, iterFind->second);
+		mPendingStreams.erase(iterFind);
+
+		// State bound by the secondary command buffer isn't tracked by the primary one
+		stream.boundState = BoundState();
+	}
+
+	void RenderAPICapture::submitCommandBuffer(const SPtr<CommandBuffer>& commandBuffer)
+	{
+		Lock lock(mMutex);
+
+		// Unlike other calls, a null command buffer always refers to the main command buffer
+		if (commandBuffer == nullptr || commandBuffer == RenderAPI::instance().getMainCommandBuffer())
+		{
+			append(mStream, mMainStream);
+			return;
+		}
+
+		const auto iterFind = mPendingStreams.find(commandBuffer.get());
+		if (iterFind == mPendingStreams.end())
+			return;
+
+		append(mStream, iterFind->second);
+		mPendingStreams.erase(iterFind);
+	}
+
+	void RenderAPICapture::writeBuffer(UINT32 length)
+	{
+		Lock lock(mMutex);
+
+		write(mStream, Command::WriteBuffer);
+		write(mStream, length);
+
+		mStream.stats.numBufferWrites++;
+		mStream.stats.bytesUploaded += length;
+		mStream.stats.numCommands++;
+	}
+
+	void RenderAPICapture::replay(const SPtr<CommandBuffer>& commandBuffer) const
+	{
+		Lock lock(mMutex);
+
+		RenderAPI& rapi = RenderAPI::instance();
+		if (rapi._getCapture().get() == this)
+		{
+			BS_LOG(Error, RenderBackend, "Cannot replay a capture while it is being recorded to.");
+			return;
+		}
+
+		const auto getObject = [this](UINT32 idx)
+		{
+			return mObjects.get(idx);
+		};
+
+		CaptureReader reader(mStream.data);
+		while (!reader.eof() && !reader.hasError())
+		{
+			const Command command = reader.read<Command>();
+			switch (command)
+			{
+			case Command::SetGraphicsPipeline:
+			{
+				const SPtr<CoreObject> object = getObject(reader.read<UINT32>());
+				rapi.setGraphicsPipeline(std::static_pointer_cast<GraphicsPipelineState>(object), commandBuffer);
+			}
+				break;
+			case Command::SetComputePipeline:
+			{
+				const SPtr<CoreObject> object = getObject(reader.read<UINT32>());
+				rapi.setComputePipeline(std::static_pointer_cast<ComputePipelineState>(object), commandBuffer);
+			}
+				break;
+			case Command::SetGpuParams:
+			{
+				const SPtr<CoreObject> object = getObject(reader.read<UINT32>());
+				rapi.setGpuParams(std::static_pointer_cast<GpuParams>(object), commandBuffer);
+			}
+				break;
+			case Command::SetViewport:
+				rapi.setViewport(reader.read<Rect2>(), commandBuffer);
+				break;
+			case Command::SetScissorRect:
+			{
+				const UINT32 left = reader.read<UINT32>();
+				const UINT32 top = reader.read<UINT32>();
+				const UINT32 right = reader.read<UINT32>();
+				const UINT32 bottom = reader.read<UINT32>();
+
+				rapi.setScissorRect(left, top, right, bottom, commandBuffer);
+			}
+				break;
+			case Command::SetStencilRef:
+				rapi.setStencilRef(reader.read<UINT32>(), commandBuffer);
+				break;
+			case Command::SetVertexBuffers:
+			{
+				const UINT32 index = reader.read<UINT32>();
+				const UINT32 numBuffers = reader.read<UINT32>();
+
+				SPtr<VertexBuffer> buffers[BS_MAX_BOUND_VERTEX_BUFFERS];
+				for (UINT32 i = 0; i < numBuffers; i++)
+				{
+					const SPtr<CoreObject> object = getObject(reader.read<UINT32>());
+					if (i < BS_MAX_BOUND_VERTEX_BUFFERS)
+						buffers[i] = std::static_pointer_cast<VertexBuffer>(object);
+				}
+
+				rapi.setVertexBuffers(index, buffers, std::min(numBuffers, (UINT32)BS_MAX_BOUND_VERTEX_BUFFERS),
+					commandBuffer);
+			}
+				break;
+			case Command::SetIndexBuffer:
+			{
+				const SPtr<CoreObject> object = getObject(reader.read<UINT32>());
+				rapi.setIndexBuffer(std::static_pointer_cast<IndexBuffer>(object), commandBuffer);
+			}
+				break;
+			case Command::SetVertexDeclaration:
+			{
+				const SPtr<CoreObject> object = getObject(reader.read<UINT32>());
+				rapi.setVertexDeclaration(std::static_pointer_cast<VertexDeclaration>(object), commandBuffer);
+			}
+				break;
+			case Command::SetDrawOperation:
+				rapi.setDrawOperation(reader.read<DrawOperationType>(), commandBuffer);
+				break;
+			case Command::SetRenderTarget:
+			{
+				const SPtr<CoreObject> object = getObject(reader.read<UINT32>());
+				const UINT32 readOnlyFlags = reader.read<UINT32>();
+				const RenderSurfaceMask loadMask(reader.read<UINT32>());
+
+				rapi.setRenderTarget(std::static_pointer_cast<RenderTarget>(object), readOnlyFlags, loadMask,
+					commandBuffer);
+			}
+				break;
+			case Command::ClearRenderTarget:
+			case Command::ClearViewport:
+			{
+				const UINT32 buffers = reader.read<UINT32>();
+				const Color color = reader.read<Color>();
+				const float depth = reader.read<float>();
+				const UINT16 stencil = reader.read<UINT16>();
+				const UINT8 targetMask = reader.read<UINT8>();
+
+				if (command == Command::ClearRenderTarget)
+					rapi.clearRenderTarget(buffers, color, depth, stencil, targetMask, commandBuffer);
+				else
+					rapi.clearViewport(buffers, color, depth, stencil, targetMask, commandBuffer);
+			}
+				break;
+			case Command::Draw:
+			{
+				const UINT32 vertexOffset = reader.read<UINT32>();
+				const UINT32 vertexCount = reader.read<UINT32>();
+				const UINT32 instanceCount = reader.read<UINT32>();
+
+				rapi.draw(vertexOffset, vertexCount, instanceCount, commandBuffer);
+			}
+				break;
+			case Command::DrawIndexed:
+			{
+				const UINT32 startIndex = reader.read<UINT32>();
+				const UINT32 indexCount = reader.read<UINT32>();
+				const UINT32 vertexOffset = reader.read<UINT32>();
+				const UINT32 vertexCount = reader.read<UINT32>();
+				const UINT32 instanceCount = reader.read<UINT32>();
+
+				rapi.drawIndexed(startIndex, indexCount, vertexOffset, vertexCount, instanceCount, commandBuffer);
+			}
+				break;
+			case Command::DispatchCompute:
+			{
+				const UINT32 numGroupsX = reader.read<UINT32>();
+				const UINT32 numGroupsY = reader.read<UINT32>();
+				const UINT32 numGroupsZ = reader.read<UINT32>();
+
+				rapi.dispatchCompute(numGroupsX, numGroupsY, numGroupsZ, commandBuffer);
+			}
+				break;
+			case Command::WriteBuffer:
+				// Only the size of the write is recorded, so there is nothing to replay
+				reader.read<UINT32>();
+				break;
+			default:
+				BS_LOG(Error, RenderBackend, "Unable to replay the capture. Command stream is corrupt.");
+				return;
+			}
+		}
+	}
+
+	void RenderAPICapture::save(const SPtr<DataStream>& stream) const
+	{
+		Lock lock(mMutex);
+
+		// Objects referenced by the recorded calls keep their indices, and objects they depend on are appended
+		ObjectTable objects = mObjects;
+		const UINT32 numCommandObjects = (UINT32)objects.objects.size();
+
+		Vector<UINT8> objectData;
+		CaptureWriter objectWriter(objectData);
+
+		Vector<bool> written;
+		for (UINT32 i = 0; i < numCommandObjects; i++)
+			writeObject(objectWriter, objects, written, i);
+
+		Vector<UINT8> data;
+		CaptureWriter writer(data);
+		writer.write(CAPTURE_FILE_ID);
+		writer.write(CAPTURE_FILE_VERSION);
+		writer.write(numCommandObjects);
+		writer.write((UINT32)objects.objects.size());
+		writer.writeBytes(objectData.data(), (UINT32)objectData.size());
+		writer.write((UINT32)mStream.data.size());
+		writer.writeBytes(mStream.data.data(), (UINT32)mStream.data.size());
+		writer.write(mStream.stats);
+
+		stream->write(data.data(), data.size());
+	}
+
+	SPtr<RenderAPICapture> RenderAPICapture::load(const SPtr<DataStream>& stream)
+	{
+		Vector<UINT8> data(stream->size() - stream->tell());
+		stream->read(data.data(), data.size());
+
+		CaptureReader reader(data);
+		if (reader.read<UINT32>() != CAPTURE_FILE_ID || reader.read<UINT32>() != CAPTURE_FILE_VERSION)
+		{
+			BS_LOG(Error, RenderBackend, "Unable to load the capture. Stream doesn't contain a capture, or the capture "
+				"was saved with a different version of the framework.");
+			return nullptr;
+		}
+
+		const UINT32 numCommandObjects = reader.read<UINT32>();
+		const UINT32 numObjects = reader.read<UINT32>();
+		if (numCommandObjects > numObjects || numObjects > (UINT32)data.size())
+		{
+			BS_LOG(Error, RenderBackend, "Unable to load the capture. Capture data is corrupt.");
+			return nullptr;
+		}
+
+		// Objects are written after the objects they depend on, so they can be created in order
+		ObjectTable objects;
+		objects.objects.resize(numObjects);
+		objects.types.resize(numObjects);
+
+		for (UINT32 i = 0; i < numObjects; i++)
+		{
+			const UINT32 idx = reader.read<UINT32>();
+			const ObjectType type = reader.read<ObjectType>();
+			if (reader.hasError() || idx >= numObjects)
+			{
+				BS_LOG(Error, RenderBackend, "Unable to load the capture. Capture data is corrupt.");
+				return nullptr;
+			}
+
+			SPtr<CoreObject> object = readObject(reader, type, objects);
+			if (object == nullptr)
+			{
+				// Objects that failed to be created for other reasons log their own error
+				if (reader.hasError())
+					BS_LOG(Error, RenderBackend, "Unable to load the capture. Capture data is corrupt.");
+
+				return nullptr;
+			}
+
+			objects.objects[idx] = object;
+			objects.types[idx] = type;
+		}
+
+		SPtr<RenderAPICapture> capture = bs_shared_ptr_new<RenderAPICapture>();
+
+		const UINT32 streamSize = reader.read<UINT32>();
+		if (!reader.hasError() && streamSize <= (UINT32)data.size())
+		{
+			capture->mStream.data.resize(streamSize);
+			reader.readBytes(capture->mStream.data.data(), streamSize);
+		}
+
+		capture->mStream.stats = reader.read<RenderAPICaptureStats>();
+		if (reader.hasError())
+		{
+			BS_LOG(Error, RenderBackend, "Unable to load the capture. Capture data is corrupt.");
+			return nullptr;
+		}
+
+		// Objects only referenced by other objects are kept alive by them
+		for (UINT32 i = 0; i < numCommandObjects; i++)
+			capture->mObjects.add(objects.objects[i], objects.types[i]);
+
+		return capture;
+	}
+
+	void RenderAPICapture::writeObject(CaptureWriter& output, ObjectTable& objects, Vector<bool>& written, UINT32 idx)
+	{
+		if (idx == (UINT32)-1)
+			return;
+
+		if (written.size() <= idx)
+			written.resize(idx + 1, false);
+
+		if (written[idx])
+			return;
+
+		written[idx] = true;
+
+		// Description is written to a separate buffer, as descriptions of referenced objects must be output first
+		Vector<UINT8> data;
+		CaptureWriter writer(data);
+
+		const auto writeDependency = [&](const SPtr<CoreObject>& object, ObjectType type)
+		{
+			const UINT32 dependencyIdx = objects.add(object, type);
+			writeObject(output, objects, written, dependencyIdx);
+			writer.write(dependencyIdx);
+		};
+
+		const SPtr<CoreObject> object = objects.objects[idx];
+		const ObjectType type = objects.types[idx];
+		switch (type)
+		{
+		case ObjectType::GraphicsPipeline:
+		{
+			const auto pipeline = std::static_pointer_cast<GraphicsPipelineState>(object);
+			writeDependency(pipeline->getBlendState(), ObjectType::BlendState);
+			writeDependency(pipeline->getRasterizerState(), ObjectType::RasterizerState);
+			writeDependency(pipeline->getDepthStencilState(), ObjectType::DepthStencilState);
+			writeDependency(pipeline->getVertexProgram(), ObjectType::GpuProgram);
+			writeDependency(pipeline->getFragmentProgram(), ObjectType::GpuProgram);
+			writeDependency(pipeline->getGeometryProgram(), ObjectType::GpuProgram);
+			writeDependency(pipeline->getHullProgram(), ObjectType::GpuProgram);
+			writeDependency(pipeline->getDomainProgram(), ObjectType::GpuProgram);
+		}
+			break;
+		case ObjectType::ComputePipeline:
+		{
+			const auto pipeline = std::static_pointer_cast<ComputePipelineState>(object);
+			writeDependency(pipeline->getProgram(), ObjectType::GpuProgram);
+		}
+			break;
+		case ObjectType::GpuParams:
+		{
+			const auto params = std::static_pointer_cast<GpuParams>(object);
+			const SPtr<GpuPipelineParamInfoBase> paramInfo = params->getParamInfo();
+
+			// Parameters created from a captured pipeline reuse its layout, so they stay compatible with it
+			UINT32 pipelineIdx = (UINT32)-1;
+			for (UINT32 i = 0; i < (UINT32)objects.objects.size(); i++)
+			{
+				const SPtr<CoreObject>& other = objects.objects[i];
+
+				SPtr<GpuPipelineParamInfoBase> pipelineParamInfo;
+				if (objects.types[i] == ObjectType::GraphicsPipeline)
+					pipelineParamInfo = std::static_pointer_cast<GraphicsPipelineState>(other)->getParamInfo();
+				else if (objects.types[i] == ObjectType::ComputePipeline)
+					pipelineParamInfo = std::static_pointer_cast<ComputePipelineState>(other)->getParamInfo();
+
+				if (pipelineParamInfo != nullptr && pipelineParamInfo == paramInfo)
+				{
+					pipelineIdx = i;
+					break;
+				}
+			}
+
+			writeObject(output, objects, written, pipelineIdx);
+			writer.write(pipelineIdx);
+
+			// Parameters are matched by name when loaded, as backends can assign them different bind locations
+			for (UINT32 i = 0; i < GPT_COUNT; i++)
+			{
+				const SPtr<GpuParamDesc> paramDesc = params->getParamDesc((GpuProgramType)i);
+				writer.write(paramDesc != nullptr);
+
+				if (paramDesc == nullptr)
+					continue;
+
+				SPtr<MemoryDataStream> descData = bs_shared_ptr_new<MemoryDataStream>();
+				BinarySerializer serializer;
+				serializer.encode(paramDesc.get(), descData);
+
+				const UINT32 descSize = (UINT32)descData->tell();
+				writer.write(descSize);
+				writer.writeBytes(descData->data(), descSize);
+			}
+
+			using ParamType = GpuPipelineParamInfoBase::ParamType;
+			for (UINT32 i = 0; i < (UINT32)ParamType::Count; i++)
+			{
+				const ParamType paramType = (ParamType)i;
+				const UINT32 numElements = paramInfo->getNumElements(paramType);
+				writer.write(numElements);
+
+				for (UINT32 j = 0; j < numElements; j++)
+				{
+					UINT32 set, slot;
+					paramInfo->getBinding(paramType, j, set, slot);
+
+					writer.write(set);
+					writer.write(slot);
+
+					switch (paramType)
+					{
+					case ParamType::ParamBlock:
+					{
+						const SPtr<GpuParamBlockBuffer> buffer = params->getParamBlockBuffer(set, slot);
+						if (buffer == nullptr)
+						{
+							writer.write(0U);
+							break;
+						}
+
+						writer.write(buffer->getSize());
+						writer.writeBytes(buffer->getCachedData(), buffer->getSize());
+					}
+						break;
+					case ParamType::Texture:
+						writeDependency(params->getTexture(set, slot), ObjectType::Texture);
+						writer.write(params->getTextureSurface(set, slot));
+						break;
+					case ParamType::LoadStoreTexture:
+						writeDependency(params->getLoadStoreTexture(set, slot), ObjectType::Texture);
+						writer.write(params->getLoadStoreSurface(set, slot));
+						break;
+					case ParamType::Buffer:
+						writeDependency(params->getBuffer(set, slot), ObjectType::GpuBuffer);
+						break;
+					case ParamType::SamplerState:
+						writeDependency(params->getSamplerState(set, slot), ObjectType::SamplerState);
+						break;
+					default:
+						break;
+					}
+				}
+			}
+		}
+			break;
+		case ObjectType::VertexBuffer:
+		{
+			const VertexBufferProperties& props = std::static_pointer_cast<VertexBuffer>(object)->getProperties();
+			writer.write(props.getVertexSize());
+			writer.write(props.getNumVertices());
+		}
+			break;
+		case ObjectType::IndexBuffer:
+		{
+			const IndexBufferProperties& props = std::static_pointer_cast<IndexBuffer>(object)->getProperties();
+			writer.write(props.getType());
+			writer.write(props.getNumIndices());
+		}
+			break;
+		case ObjectType::VertexDeclaration:
+		{
+			const auto declaration = std::static_pointer_cast<VertexDeclaration>(object);
+			const Vector<VertexElement>& elements = declaration->getProperties().getElements();
+
+			writer.write((UINT32)elements.size());
+			for (auto& element : elements)
+			{
+				writer.write(element.getStreamIdx());
+				writer.write(element.getOffset());
+				writer.write(element.getType());
+				writer.write(element.getSemantic());
+				writer.write(element.getSemanticIdx());
+				writer.write(element.getInstanceStepRate());
+			}
+		}
+			break;
+		case ObjectType::RenderTarget:
+		{
+			const auto target = std::static_pointer_cast<RenderTarget>(object);
+			const RenderTargetProperties& props = target->getProperties();
+
+			writer.write(props.isWindow);
+			if (props.isWindow)
+			{
+				writer.write(props.width);
+				writer.write(props.height);
+				writer.write(props.hwGamma);
+				writer.write(props.multisampleCount);
+				break;
+			}
+
+			const RENDER_TEXTURE_DESC& desc = std::static_pointer_cast<RenderTexture>(target)->getDesc();
+			const auto writeSurface = [&](const RENDER_SURFACE_DESC& surface)
+			{
+				writeDependency(surface.texture, ObjectType::Texture);
+				writer.write(surface.face);
+				writer.write(surface.numFaces);
+				writer.write(surface.mipLevel);
+			};
+
+			for (UINT32 i = 0; i < BS_MAX_MULTIPLE_RENDER_TARGETS; i++)
+				writeSurface(desc.colorSurfaces[i]);
+
+			writeSurface(desc.depthStencilSurface);
+		}
+			break;
+		case ObjectType::GpuProgram:
+		{
+			const GPU_PROGRAM_DESC desc = std::static_pointer_cast<GpuProgram>(object)->getDesc();
+			writer.write(desc.type);
+			writer.write(desc.requiresAdjacency);
+			writer.writeString(desc.language);
+			writer.writeString(desc.entryPoint);
+			writer.writeString(desc.source);
+		}
+			break;
+		case ObjectType::BlendState:
+			writer.write(std::static_pointer_cast<BlendState>(object)->getProperties().getDesc());
+			break;
+		case ObjectType::RasterizerState:
+			writer.write(std::static_pointer_cast<RasterizerState>(object)->getProperties().getDesc());
+			break;
+		case ObjectType::DepthStencilState:
+			writer.write(std::static_pointer_cast<DepthStencilState>(object)->getProperties().getDesc());
+			break;
+		case ObjectType::SamplerState:
+			writer.write(std::static_pointer_cast<SamplerState>(object)->getProperties().getDesc());
+			break;
+		case ObjectType::Texture:
+		{
+			const TextureProperties& props = std::static_pointer_cast<Texture>(object)->getProperties();
+
+			TEXTURE_DESC desc;
+			desc.type = props.getTextureType();
+			desc.format = props.getFormat();
+			desc.width = props.getWidth();
+			desc.height = props.getHeight();
+			desc.depth = props.getDepth();
+			desc.numMips = props.getNumMipmaps();
+			desc.usage = props.getUsage();
+			desc.hwGamma = props.isHardwareGammaEnabled();
+			desc.numSamples = props.getNumSamples();
+			desc.numArraySlices = props.getNumArraySlices();
+
+			writer.write(desc);
+		}
+			break;
+		case ObjectType::GpuBuffer:
+		{
+			const GpuBufferProperties& props = std::static_pointer_cast<GpuBuffer>(object)->getProperties();
+
+			GPU_BUFFER_DESC desc;
+			desc.type = props.getType();
+			desc.format = props.getFormat();
+			desc.usage = props.getUsage();
+			desc.elementCount = props.getElementCount();
+
+			// Element size of standard buffers is determined by their format
+			desc.elementSize = props.getType() == GBT_STANDARD ? 0 : props.getElementSize();
+
+			writer.write(desc);
+		}
+			break;
+		}
+
+		output.write(idx);
+		output.write(type);
+		output.writeBytes(data.data(), (UINT32)data.size());
+	}
+
+	SPtr<CoreObject> RenderAPICapture::readObject(CaptureReader& reader, ObjectType type, const ObjectTable& objects)
+	{
+		const auto readDependency = [&reader, &objects](auto* typeTag)
+		{
+			using Type = std::remove_pointer_t<decltype(typeTag)>;
+			return std::static_pointer_cast<Type>(objects.get(reader.read<UINT32>()));
+		};
+
+		switch (type)
+		{
+		case ObjectType::GraphicsPipeline:
+		{
+			PIPELINE_STATE_DESC desc;
+			desc.blendState = readDependency((BlendState*)nullptr);
+			desc.rasterizerState = readDependency((RasterizerState*)nullptr);
+			desc.depthStencilState = readDependency((DepthStencilState*)nullptr);
+			desc.vertexProgram = readDependency((GpuProgram*)nullptr);
+			desc.fragmentProgram = readDependency((GpuProgram*)nullptr);
+			desc.geometryProgram = readDependency((GpuProgram*)nullptr);
+			desc.hullProgram = readDependency((GpuProgram*)nullptr);
+			desc.domainProgram = readDependency((GpuProgram*)nullptr);
+
+			return GraphicsPipelineState::create(desc);
+		}
+		case ObjectType::ComputePipeline:
+		{
+			SPtr<GpuProgram> program = readDependency((GpuProgram*)nullptr);
+			if (program == nullptr)
+				return nullptr;
+
+			return ComputePipelineState::create(program);
+		}
+		case ObjectType::GpuParams:
+			return readGpuParams(reader, objects);
+		case ObjectType::VertexBuffer:
+		{
+			VERTEX_BUFFER_DESC desc;
+			desc.vertexSize = reader.read<UINT32>();
+			desc.numVerts = reader.read<UINT32>();
+
+			return VertexBuffer::create(desc);
+		}
+		case ObjectType::IndexBuffer:
+		{
+			INDEX_BUFFER_DESC desc;
+			desc.indexType = reader.read<IndexType>();
+			desc.numIndices = reader.read<UINT32>();
+
+			return IndexBuffer::create(desc);
+		}
+		case ObjectType::VertexDeclaration:
+		{
+			const UINT32 numElements = reader.read<UINT32>();
+
+			Vector<VertexElement> elements;
+			for (UINT32 i = 0; i < numElements && !reader.hasError(); i++)
+			{
+				const UINT16 source = reader.read<UINT16>();
+				const UINT32 offset = reader.read<UINT32>();
+				const VertexElementType elementType = reader.read<VertexElementType>();
+				const VertexElementSemantic semantic = reader.read<VertexElementSemantic>();
+				const UINT16 semanticIdx = reader.read<UINT16>();
+				const UINT32 instanceStepRate = reader.read<UINT32>();
+
+				elements.push_back(VertexElement(source, offset, elementType, semantic, semanticIdx, instanceStepRate));
+			}
+
+			return HardwareBufferManager::instance().createVertexDeclaration(elements);
+		}
+		case ObjectType::RenderTarget:
+		{
+			RENDER_TEXTURE_DESC desc;
+			if (reader.read<bool>())
+			{
+				// Windows can't be recreated, so an off-screen target of the same size is rendered to instead
+				TEXTURE_DESC colorDesc;
+				colorDesc.width = reader.read<UINT32>();
+				colorDesc.height = reader.read<UINT32>();
+				colorDesc.hwGamma = reader.read<bool>();
+				colorDesc.numSamples = reader.read<UINT32>();
+				colorDesc.usage = TU_RENDERTARGET;
+
+				TEXTURE_DESC depthDesc = colorDesc;
+				depthDesc.format = PF_D32_S8X24;
+				depthDesc.hwGamma = false;
+				depthDesc.usage = TU_DEPTHSTENCIL;
+
+				desc.colorSurfaces[0].texture = Texture::create(colorDesc);
+				desc.depthStencilSurface.texture = Texture::create(depthDesc);
+			}
+			else
+			{
+				const auto readSurface = [&](RENDER_SURFACE_DESC& surface)
+				{
+					surface.texture = readDependency((Texture*)nullptr);
+					surface.face = reader.read<UINT32>();
+					surface.numFaces = reader.read<UINT32>();
+					surface.mipLevel = reader.read<UINT32>();
+				};
+
+				for (UINT32 i = 0; i < BS_MAX_MULTIPLE_RENDER_TARGETS; i++)
+					readSurface(desc.colorSurfaces[i]);
+
+				readSurface(desc.depthStencilSurface);
+			}
+
+			if (reader.hasError())
+				return nullptr;
+
+			return RenderTexture::create(desc);
+		}
+		case ObjectType::GpuProgram:
+		{
+			GPU_PROGRAM_DESC desc;
+			desc.type = reader.read<GpuProgramType>();
+			desc.requiresAdjacency = reader.read<bool>();
+			desc.language = reader.readString();
+			desc.entryPoint = reader.readString();
+			desc.source = reader.readString();
+
+			if (reader.hasError())
+				return nullptr;
+
+			if (!GpuProgramManager::instance().isLanguageSupported(desc.language))
+			{
+				BS_LOG(Error, RenderBackend, "Unable to load the capture. Active render API doesn't support GPU "
+					"programs written in '{0}'.", desc.language);
+				return nullptr;
+			}
+
+			SPtr<GpuProgram> program = GpuProgram::create(desc);
+			if (!program->isCompiled())
+			{
+				BS_LOG(Warning, RenderBackend, "Captured GPU program failed to compile: {0}",
+					program->getCompileErrorMessage());
+			}
+
+			return program;
+		}
+		case ObjectType::BlendState:
+			return BlendState::create(reader.read<BLEND_STATE_DESC>());
+		case ObjectType::RasterizerState:
+			return RasterizerState::create(reader.read<RASTERIZER_STATE_DESC>());
+		case ObjectType::DepthStencilState:
+			return DepthStencilState::create(reader.read<DEPTH_STENCIL_STATE_DESC>());
+		case ObjectType::SamplerState:
+			return SamplerState::create(reader.read<SAMPLER_STATE_DESC>());
+		case ObjectType::Texture:
+			return Texture::create(reader.read<TEXTURE_DESC>());
+		case ObjectType::GpuBuffer:
+			return GpuBuffer::create(reader.read<GPU_BUFFER_DESC>());
+		}
+
+		return nullptr;
+	}
+
+	SPtr<GpuParams> RenderAPICapture::readGpuParams(CaptureReader& reader, const ObjectTable& objects)
+	{
+		using ParamType = GpuPipelineParamInfoBase::ParamType;
+
+		const UINT32 pipelineIdx = reader.read<UINT32>();
+		const SPtr<CoreObject> pipeline = objects.get(pipelineIdx);
+
+		GPU_PIPELINE_PARAMS_DESC sourceDesc;
+		SPtr<GpuParamDesc>* sourceDescs[GPT_COUNT];
+		sourceDescs[GPT_VERTEX_PROGRAM] = &sourceDesc.vertexParams;
+		sourceDescs[GPT_FRAGMENT_PROGRAM] = &sourceDesc.fragmentParams;
+		sourceDescs[GPT_GEOMETRY_PROGRAM] = &sourceDesc.geometryParams;
+		sourceDescs[GPT_HULL_PROGRAM] = &sourceDesc.hullParams;
+		sourceDescs[GPT_DOMAIN_PROGRAM] = &sourceDesc.domainParams;
+		sourceDescs[GPT_COMPUTE_PROGRAM] = &sourceDesc.computeParams;
+
+		for (UINT32 i = 0; i < GPT_COUNT; i++)
+		{
+			if (!reader.read<bool>())
+				continue;
+
+			const UINT32 size = reader.read<UINT32>();
+			if (reader.hasError())
+				return nullptr;
+
+			SPtr<MemoryDataStream> descData = bs_shared_ptr_new<MemoryDataStream>(size);
+			reader.readBytes(descData->data(), size);
+			if (reader.hasError())
+				return nullptr;
+
+			BinarySerializer serializer;
+			*sourceDescs[i] = std::static_pointer_cast<GpuParamDesc>(serializer.decode(descData, size));
+		}
+
+		/** Contents of a single parameter bind location, as captured. */
+		struct CapturedParam
+		{
+			UINT32 set;
+			UINT32 slot;
+			Vector<UINT8> data;
+			SPtr<CoreObject> object;
+			TextureSurface surface;
+		};
+
+		Vector<CapturedParam> capturedParams[(UINT32)ParamType::Count];
+		for (UINT32 i = 0; i < (UINT32)ParamType::Count; i++)
+		{
+			const UINT32 numElements = reader.read<UINT32>();
+			for (UINT32 j = 0; j < numElements && !reader.hasError(); j++)
+			{
+				CapturedParam param;
+				param.set = reader.read<UINT32>();
+				param.slot = reader.read<UINT32>();
+
+				switch ((ParamType)i)
+				{
+				case ParamType::ParamBlock:
+				{
+					const UINT32 size = reader.read<UINT32>();
+					if (reader.hasError())
+						return nullptr;
+
+					param.data.resize(size);
+					reader.readBytes(param.data.data(), size);
+				}
+					break;
+				case ParamType::Texture:
+				case ParamType::LoadStoreTexture:
+					param.object = objects.get(reader.read<UINT32>());
+					param.surface = reader.read<TextureSurface>();
+					break;
+				default:
+					param.object = objects.get(reader.read<UINT32>());
+					break;
+				}
+
+				capturedParams[i].push_back(param);
+			}
+		}
+
+		if (reader.hasError())
+			return nullptr;
+
+		const auto findCaptured = [&capturedParams](ParamType type, UINT32 set, UINT32 slot) -> CapturedParam*
+		{
+			for (auto& entry : capturedParams[(UINT32)type])
+			{
+				if (entry.set == set && entry.slot == slot)
+					return &entry;
+			}
+
+			return nullptr;
+		};
+
+		SPtr<GpuPipelineParamInfo> paramInfo;
+		if (pipeline != nullptr && objects.types[pipelineIdx] == ObjectType::GraphicsPipeline)
+			paramInfo = std::static_pointer_cast<GraphicsPipelineState>(pipeline)->getParamInfo();
+		else if (pipeline != nullptr && objects.types[pipelineIdx] == ObjectType::ComputePipeline)
+			paramInfo = std::static_pointer_cast<ComputePipelineState>(pipeline)->getParamInfo();
+		else
+			paramInfo = GpuPipelineParamInfo::create(sourceDesc);
+
+		SPtr<GpuParams> params = GpuParams::create(paramInfo);
+		for (UINT32 i = 0; i < GPT_COUNT; i++)
+		{
+			const SPtr<GpuParamDesc>& source = *sourceDescs[i];
+			const SPtr<GpuParamDesc> dest = params->getParamDesc((GpuProgramType)i);
+			if (source == nullptr || dest == nullptr)
+				continue;
+
+			for (auto& entry : dest->paramBlocks)
+			{
+				const GpuParamBlockDesc& blockDesc = entry.second;
+				if (params->getParamBlockBuffer(blockDesc.set, blockDesc.slot) != nullptr)
+					continue;
+
+				SPtr<GpuParamBlockBuffer> buffer = GpuParamBlockBuffer::create(blockDesc.blockSize * sizeof(UINT32));
+				params->setParamBlockBuffer(blockDesc.set, blockDesc.slot, buffer);
+			}
+
+			for (auto& entry : source->params)
+			{
+				const GpuParamDataDesc& sourceParam = entry.second;
+				const auto iterFind = dest->params.find(entry.first);
+				if (iterFind == dest->params.end())
+					continue;
+
+				const GpuParamDataDesc& destParam = iterFind->second;
+				const CapturedParam* captured = findCaptured(ParamType::ParamBlock, sourceParam.paramBlockSet,
+					sourceParam.paramBlockSlot);
+				const SPtr<GpuParamBlockBuffer> buffer = params->getParamBlockBuffer(destParam.paramBlockSet,
+					destParam.paramBlockSlot);
+
+				if (captured == nullptr || buffer == nullptr)
+					continue;
+
+				// Backends can pad elements differently, so each element is copied separately
+				const UINT32 numElements = std::min(sourceParam.arraySize, destParam.arraySize);
+				const UINT32 elementSize = std::min(sourceParam.elementSize, destParam.elementSize) * sizeof(UINT32);
+				for (UINT32 j = 0; j < std::max(numElements, 1U); j++)
+				{
+					const UINT32 sourceOffset = (sourceParam.cpuMemOffset + j * sourceParam.arrayElementStride) *
+						sizeof(UINT32);
+					const UINT32 destOffset = (destParam.cpuMemOffset + j * destParam.arrayElementStride) *
+						sizeof(UINT32);
+
+					if (sourceOffset + elementSize > (UINT32)captured->data.size() ||
+						destOffset + elementSize > buffer->getSize())
+					{
+						break;
+					}
+
+					buffer->write(destOffset, captured->data.data() + sourceOffset, elementSize);
+				}
+			}
+
+			const auto copyObjects = [&](const Map<String, GpuParamObjectDesc>& sourceParams,
+				const Map<String, GpuParamObjectDesc>& destParams, ParamType type, auto assign)
+			{
+				for (auto& entry : sourceParams)
+				{
+					const auto iterFind = destParams.find(entry.first);
+					if (iterFind == destParams.end())
+						continue;
+
+					const CapturedParam* captured = findCaptured(type, entry.second.set, entry.second.slot);
+					if (captured != nullptr && captured->object != nullptr)
+						assign(iterFind->second.set, iterFind->second.slot, *captured);
+				}
+			};
+
+			copyObjects(source->textures, dest->textures, ParamType::Texture,
+				[&params](UINT32 set, UINT32 slot, const CapturedParam& captured)
+			{
+				params->setTexture(set, slot, std::static_pointer_cast<Texture>(captured.object), captured.surface);
+			});
+
+			copyObjects(source->loadStoreTextures, dest->loadStoreTextures, ParamType::LoadStoreTexture,
+				[&params](UINT32 set, UINT32 slot, const CapturedParam& captured)
+			{
+				auto texture = std::static_pointer_cast<Texture>(captured.object);
+				params->setLoadStoreTexture(set, slot, texture, captured.surface);
+			});
+
+			copyObjects(source->buffers, dest->buffers, ParamType::Buffer,
+				[&params](UINT32 set, UINT32 slot, const CapturedParam& captured)
+			{
+				params->setBuffer(set, slot, std::static_pointer_cast<GpuBuffer>(captured.object));
+			});
+
+			copyObjects(source->samplers, dest->samplers, ParamType::SamplerState,
+				[&params](UINT32 set, UINT32 slot, const CapturedParam& captured)
+			{
+				params->setSamplerState(set, slot, std::static_pointer_cast<SamplerState>(captured.object));
+			});
+		}
+
+		return params;
+	}
+
+	void RenderAPICapture::clear()
+	{
+		Lock lock(mMutex);
+
+		mStream = Stream();
+		mMainStream = Stream();
+		mPendingStreams.clear();
+
+		mObjects = ObjectTable();
+	}
+
+	RenderAPICaptureStats RenderAPICapture::getStats() const
+	{
+		Lock lock(mMutex);
+		return mStream.stats;
+	}
+}}
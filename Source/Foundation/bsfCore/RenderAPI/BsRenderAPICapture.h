@@ -0,0 +1,335 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "BsCorePrerequisites.h"
+#include "Math/BsRect2.h"
+#include "Image/BsColor.h"
+#include "RenderAPI/BsRenderAPICapabilities.h"
+
+namespace bs { namespace ct
+{
+	/** @addtogroup RenderAPI-Internal
+	 *  @{
+	 */
+
+	/** Statistics about render API calls recorded by a RenderAPICapture. */
+	struct RenderAPICaptureStats
+	{
+		/** Total number of recorded calls. */
+		UINT32 numCommands = 0;
+
+		/** Number of draw calls. */
+		UINT32 numDrawCalls = 0;
+
+		/** Number of compute dispatch calls. */
+		UINT32 numComputeCalls = 0;
+
+		/** Number of render target and viewport clears. */
+		UINT32 numClears = 0;
+
+		/** Number of calls that changed the bound pipeline, render target, buffers or fixed function state. */
+		UINT32 numStateChanges = 0;
+
+		/**
+		 * Number of calls that bound a pipeline, render target, buffer or fixed function state that was already bound.
+		 * Such calls can be removed without changing the rendered output.
+		 */
+		UINT32 numRedundantBinds = 0;
+
+		/**
+		 * Number of GPU parameter binds. Not counted as state changes or redundant binds, since contents of the
+		 * parameters can change between binds of the same object.
+		 */
+		UINT32 numParamBinds = 0;
+
+		/** Number of writes to GPU buffers. */
+		UINT32 numBufferWrites = 0;
+
+		/** Total number of bytes written to GPU buffers. */
+		UINT64 bytesUploaded = 0;
+	};
+
+	class CaptureReader;
+	class CaptureWriter;
+
+	/**
+	 * Records render API calls into a compact binary stream, allowing them to be analyzed (see getStats()) and
+	 * re-issued later (see replay()). Objects referenced by the calls are kept alive by the capture, and are referenced
+	 * from the stream by index. Captures can be saved along with descriptions of the referenced objects (see save()),
+	 * and loaded on a different render API backend (see load()).
+	 *
+	 * Calls are recorded by RenderAPI after the capture is set through RenderAPI::_setCapture(), before they reach the
+	 * render API backend, so any backend can be captured and replayed. Each command buffer is recorded into its own
+	 * stream. A stream becomes part of the capture once its command buffer is submitted, or is appended to the stream of
+	 * another command buffer through RenderAPI::addCommands(). This way the capture follows the order in which the GPU
+	 * executes the calls, even if command buffers are recorded in parallel. Calls on the main command buffer that
+	 * weren't submitted yet are added when the capture is removed from the render API.
+	 *
+	 * @note	Recording methods are thread safe, allowing calls made from worker threads to be recorded. replay(),
+	 *			save() and load() are core thread only.
+	 */
+	class BS_CORE_EXPORT RenderAPICapture
+	{
+	public:
+		/** Records a call to RenderAPI::setGraphicsPipeline(). */
+		void setGraphicsPipeline(const SPtr<GraphicsPipelineState>& pipelineState,
+			const SPtr<CommandBuffer>& commandBuffer);
+
+		/** Records a call to RenderAPI::setComputePipeline(). */
+		void setComputePipeline(const SPtr<ComputePipelineState>& pipelineState,
+			const SPtr<CommandBuffer>& commandBuffer);
+
+		/** Records a call to RenderAPI::setGpuParams(). */
+		void setGpuParams(const SPtr<GpuParams>& gpuParams, const SPtr<CommandBuffer>& commandBuffer);
+
+		/** Records a call to RenderAPI::setViewport(). */
+		void setViewport(const Rect2& area, const SPtr<CommandBuffer>& commandBuffer);
+
+		/** Records a call to RenderAPI::setScissorRect(). */
+		void setScissorRect(UINT32 left, UINT32 top, UINT32 right, UINT32 bottom,
+			const SPtr<CommandBuffer>& commandBuffer);
+
+		/** Records a call to RenderAPI::setStencilRef(). */
+		void setStencilRef(UINT32 value, const SPtr<CommandBuffer>& commandBuffer);
+
+		/** Records a call to RenderAPI::setVertexBuffers(). */
+		void setVertexBuffers(UINT32 index, SPtr<VertexBuffer>* buffers, UINT32 numBuffers,
+			const SPtr<CommandBuffer>& commandBuffer);
+
+		/** Records a call to RenderAPI::setIndexBuffer(). */
+		void setIndexBuffer(const SPtr<IndexBuffer>& buffer, const SPtr<CommandBuffer>& commandBuffer);
+
+		/** Records a call to RenderAPI::setVertexDeclaration(). */
+		void setVertexDeclaration(const SPtr<VertexDeclaration>& vertexDeclaration,
+			const SPtr<CommandBuffer>& commandBuffer);
+
+		/** Records a call to RenderAPI::setDrawOperation(). */
+		void setDrawOperation(DrawOperationType op, const SPtr<CommandBuffer>& commandBuffer);
+
+		/** Records a call to RenderAPI::setRenderTarget(). */
+		void setRenderTarget(const SPtr<RenderTarget>& target, UINT32 readOnlyFlags, RenderSurfaceMask loadMask,
+			const SPtr<CommandBuffer>& commandBuffer);
+
+		/** Records a call to RenderAPI::clearRenderTarget(). */
+		void clearRenderTarget(UINT32 buffers, const Color& color, float depth, UINT16 stencil, UINT8 targetMask,
+			const SPtr<CommandBuffer>& commandBuffer);
+
+		/** Records a call to RenderAPI::clearViewport(). */
+		void clearViewport(UINT32 buffers, const Color& color, float depth, UINT16 stencil, UINT8 targetMask,
+			const SPtr<CommandBuffer>& commandBuffer);
+
+		/** Records a call to RenderAPI::draw(). */
+		void draw(UINT32 vertexOffset, UINT32 vertexCount, UINT32 instanceCount,
+			const SPtr<CommandBuffer>& commandBuffer);
+
+		/** Records a call to RenderAPI::drawIndexed(). */
+		void drawIndexed(UINT32 startIndex, UINT32 indexCount, UINT32 vertexOffset, UINT32 vertexCount,
+			UINT32 instanceCount, const SPtr<CommandBuffer>& commandBuffer);
+
+		/** Records a call to RenderAPI::dispatchCompute(). */
+		void dispatchCompute(UINT32 numGroupsX, UINT32 numGroupsY, UINT32 numGroupsZ,
+			const SPtr<CommandBuffer>& commandBuffer);
+
+		/**
+		 * Records a call to RenderAPI::addCommands(), appending the calls recorded on @p secondary to the calls
+		 * recorded on @p commandBuffer.
+		 */
+		void addCommands(const SPtr<CommandBuffer>& commandBuffer, const SPtr<CommandBuffer>& secondary);
+
+		/**
+		 * Records a call to RenderAPI::submitCommandBuffer(), making the calls recorded on @p commandBuffer part of the
+		 * capture.
+		 */
+		void submitCommandBuffer(const SPtr<CommandBuffer>& commandBuffer);
+
+		/**
+		 * Records a write of @p length bytes to a GPU buffer. Writes aren't queued on command buffers, so they become
+		 * part of the capture immediately. Only the size of the write is recorded, so writes aren't replayed.
+		 */
+		void writeBuffer(UINT32 length);
+
+		/**
+		 * Re-issues all recorded calls on the active render API, in the order they were recorded. Referenced objects
+		 * are live render API objects, so the calls must be replayed on the backend that created them. Use save() and
+		 * load() to replay the calls on a different backend. The capture can't be replayed while it is set as the
+		 * active capture.
+		 *
+		 * @param[in]	commandBuffer	Optional command buffer to queue the calls on. If not provided the calls are
+		 *								queued on the main command buffer.
+		 */
+		void replay(const SPtr<CommandBuffer>& commandBuffer = nullptr) const;
+
+		/**
+		 * Saves the recorded calls into the provided stream, along with descriptions of all objects referenced by the
+		 * calls. GPU programs are saved as source code, and GPU parameters are saved by name, so the capture can be
+		 * loaded by a backend other than the one it was captured with. Contents of textures and buffers other than GPU
+		 * parameter blocks aren't saved.
+		 */
+		void save(const SPtr<DataStream>& stream) const;
+
+		/**
+		 * Loads a capture saved with save(), recreating all objects referenced by the recorded calls on the active
+		 * render API. Render windows are recreated as render textures of the same size. Returns null if the stream
+		 * doesn't contain a valid capture, or if the render API doesn't support the language of a GPU program used by
+		 * the capture.
+		 */
+		static SPtr<RenderAPICapture> load(const SPtr<DataStream>& stream);
+
+		/** Removes all recorded calls and releases all referenced objects. */
+		void clear();
+
+		/** Returns statistics about the calls that are part of the capture. */
+		RenderAPICaptureStats getStats() const;
+
+		/** Returns the size of the command stream that is part of the capture, in bytes. */
+		UINT32 getSize() const { return (UINT32)mStream.data.size(); }
+
+		/** Returns the number of unique objects referenced by the recorded calls. */
+		UINT32 getNumObjects() const { return (UINT32)mObjects.objects.size(); }
+
+	private:
+		/** Types of recorded calls. */
+		enum class Command : UINT8
+		{
+			SetGraphicsPipeline,
+			SetComputePipeline,
+			SetGpuParams,
+			SetViewport,
+			SetScissorRect,
+			SetStencilRef,
+			SetVertexBuffers,
+			SetIndexBuffer,
+			SetVertexDeclaration,
+			SetDrawOperation,
+			SetRenderTarget,
+			ClearRenderTarget,
+			ClearViewport,
+			Draw,
+			DrawIndexed,
+			DispatchCompute,
+			WriteBuffer
+		};
+
+		/** Types of objects referenced by the recorded calls, or by other referenced objects. */
+		enum class ObjectType : UINT8
+		{
+			GraphicsPipeline,
+			ComputePipeline,
+			GpuParams,
+			VertexBuffer,
+			IndexBuffer,
+			VertexDeclaration,
+			RenderTarget,
+			GpuProgram,
+			BlendState,
+			RasterizerState,
+			DepthStencilState,
+			SamplerState,
+			Texture,
+			GpuBuffer
+		};
+
+		/** Objects referenced by a capture, along with their types. Objects are referenced by their index. */
+		struct ObjectTable
+		{
+			/** Registers the object if needed, and returns its index. Returns -1 for null objects. */
+			UINT32 add(const SPtr<CoreObject>& object, ObjectType type);
+
+			/** Returns the object at the provided index, or null if the index is out of range. */
+			SPtr<CoreObject> get(UINT32 idx) const;
+
+			Vector<SPtr<CoreObject>> objects;
+			Vector<ObjectType> types;
+			UnorderedMap<CoreObject*, UINT32> lookup;
+		};
+
+		/** Types of bound state tracked for detecting redundant binds. */
+		enum StateSlot
+		{
+			SS_GraphicsPipeline,
+			SS_ComputePipeline,
+			SS_Viewport,
+			SS_ScissorRect,
+			SS_StencilRef,
+			SS_IndexBuffer,
+			SS_VertexDeclaration,
+			SS_DrawOperation,
+			SS_RenderTarget
+		};
+
+		/** Bound state as of the last call recorded in a stream. */
+		struct BoundState
+		{
+			/** Bitmask of StateSlot values that were bound at least once since the stream started. */
+			UINT32 known = 0;
+
+			const void* graphicsPipeline = nullptr;
+			const void* computePipeline = nullptr;
+			Rect2 viewport;
+			UINT32 scissorRect[4] = { 0, 0, 0, 0 };
+			UINT32 stencilRef = 0;
+			const void* indexBuffer = nullptr;
+			const void* vertexDeclaration = nullptr;
+			DrawOperationType drawOp = DOT_TRIANGLE_LIST;
+			const void* renderTarget = nullptr;
+			UINT32 renderTargetFlags = 0;
+			const void* vertexBuffers[BS_MAX_BOUND_VERTEX_BUFFERS] = { };
+			UINT32 vertexBuffersKnown = 0;
+		};
+
+		/** Calls recorded on a single command buffer, along with the bound state and statistics of those calls. */
+		struct Stream
+		{
+			SPtr<CommandBuffer> commandBuffer;
+			Vector<UINT8> data;
+			BoundState boundState;
+			RenderAPICaptureStats stats;
+		};
+
+		/**
+		 * Returns the stream that records calls on the provided command buffer. If null, the command buffer set by
+		 * RenderAPI::_setThreadCommandBuffer() is used, or the main command buffer if none is set.
+		 */
+		Stream& getStream(const SPtr<CommandBuffer>& commandBuffer);
+
+		/** Appends the calls recorded in @p source to @p dest and resets @p source. */
+		static void append(Stream& dest, Stream& source);
+
+		/** Appends the raw bytes of @p value to the command stream. */
+		template<class T>
+		static void write(Stream& stream, const T& value);
+
+		/**
+		 * Writes the description of the object at index @p idx in @p objects to @p output, after writing descriptions
+		 * of any objects it references that weren't written yet. Referenced objects are added to @p objects.
+		 */
+		static void writeObject(CaptureWriter& output, ObjectTable& objects, Vector<bool>& written, UINT32 idx);
+
+		/**
+		 * Creates an object of the provided type from a description written by writeObject(). Objects referenced by the
+		 * description must already be in @p objects. Returns null if the object can't be created.
+		 */
+		static SPtr<CoreObject> readObject(CaptureReader& reader, ObjectType type, const ObjectTable& objects);
+
+		/** Creates GPU parameters from the description written by writeObject(). */
+		static SPtr<GpuParams> readGpuParams(CaptureReader& reader, const ObjectTable& objects);
+
+		/**
+		 * Assigns @p value to the tracked bound state in @p current and counts the bind either as a state change or
+		 * as a redundant bind.
+		 */
+		template<class T>
+		static void updateState(Stream& stream, StateSlot slot, T& current, const T& value);
+
+		Stream mStream;
+		Stream mMainStream;
+		UnorderedMap<CommandBuffer*, Stream> mPendingStreams;
+
+		ObjectTable mObjects;
+
+		mutable Mutex mMutex;
+	};
+
+	/** @} */
+}}
@@ -0,0 +1,197 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#include "RenderAPI/BsRenderStateCache.h"
+#include "RenderAPI/BsGpuParams.h"
+#include "RenderAPI/BsGpuParamBlockBuffer.h"
+#include "RenderAPI/BsGpuPipelineState.h"
+#include "RenderAPI/BsVertexBuffer.h"
+#include "RenderAPI/BsIndexBuffer.h"
+#include "RenderAPI/BsVertexDeclaration.h"
+#include "Profiling/BsRenderStats.h"
+
+namespace bs { namespace ct
+{
+	template<class T>
+	bool RenderStateCache::update(StateSlot slot, T& current, const T& value)
+	{
+		if ((mBound & slot) != 0 && current == value)
+		{
+			BS_INC_RENDER_STAT(NumRedundantBinds);
+			return false;
+		}
+
+		current = value;
+		mBound |= slot;
+
+		return true;
+	}
+
+	bool RenderStateCache::setGraphicsPipeline(const SPtr<GraphicsPipelineState>& pipelineState)
+	{
+		if (!update(SS_GraphicsPipeline, mGraphicsPipeline, pipelineState))
+			return false;
+
+		// Some backends bind parameters and programs differently depending on the active pipeline, so the parameters
+		// and the other pipeline type need to be bound again
+		mBound &= ~(SS_GpuParams | SS_ComputePipeline);
+		return true;
+	}
+
+	bool RenderStateCache::setComputePipeline(const SPtr<ComputePipelineState>& pipelineState)
+	{
+		if (!update(SS_ComputePipeline, mComputePipeline, pipelineState))
+			return false;
+
+		mBound &= ~(SS_GpuParams | SS_GraphicsPipeline);
+		return true;
+	}
+
+	bool RenderStateCache::setGpuParams(const SPtr<GpuParams>& gpuParams)
+	{
+		if ((mBound & SS_GpuParams) != 0 && mGpuParams == gpuParams && !isGpuParamsModified())
+		{
+			BS_INC_RENDER_STAT(NumRedundantBinds);
+			return false;
+		}
+
+		mGpuParams = gpuParams;
+		mGpuParamsVersion = gpuParams != nullptr ? gpuParams->getVersion() : 0;
+		mBound |= SS_GpuParams;
+
+		mParamBlockVersions.clear();
+		if (gpuParams != nullptr)
+		{
+			const UINT32 numParamBlocks = gpuParams->_getNumParamBlockBuffers();
+			for (UINT32 i = 0; i < numParamBlocks; i++)
+			{
+				const SPtr<GpuParamBlockBuffer>& buffer = gpuParams->_getParamBlockBuffer(i);
+				mParamBlockVersions.add(buffer != nullptr ? buffer->getVersion() : 0);
+			}
+		}
+
+		return true;
+	}
+
+	bool RenderStateCache::isGpuParamsModified() const
+	{
+		if (mGpuParams == nullptr)
+			return false;
+
+		if (mGpuParams->getVersion() != mGpuParamsVersion)
+			return true;
+
+		// Assigning a different buffer increments the parameter version, so only the buffer contents need checking
+		for (UINT32 i = 0; i < mParamBlockVersions.size(); i++)
+		{
+			const SPtr<GpuParamBlockBuffer>& buffer = mGpuParams->_getParamBlockBuffer(i);
+			if (buffer != nullptr && buffer->getVersion() != mParamBlockVersions[i])
+				return true;
+		}
+
+		return false;
+	}
+
+	bool RenderStateCache::setVertexBuffers(UINT32 index, SPtr<VertexBuffer>* buffers, UINT32 numBuffers)
+	{
+		bool redundant = numBuffers > 0;
+		for (UINT32 i = 0; i < numBuffers; i++)
+		{
+			const UINT32 slot = index + i;
+			if (slot >= BS_MAX_BOUND_VERTEX_BUFFERS)
+			{
+				redundant = false;
+				break;
+			}
+
+			if ((mBoundVertexBuffers & (1 << slot)) == 0 || mVertexBuffers[slot] != buffers[i])
+			{
+				redundant = false;
+				break;
+			}
+		}
+
+		if (redundant)
+		{
+			BS_INC_RENDER_STAT(NumRedundantBinds);
+			return false;
+		}
+
+		for (UINT32 i = 0; i < numBuffers; i++)
+		{
+			const UINT32 slot = index + i;
+			if (slot >= BS_MAX_BOUND_VERTEX_BUFFERS)
+				break;
+
+			mVertexBuffers[slot] = buffers[i];
+			mBoundVertexBuffers |= 1 << slot;
+		}
+
+		return true;
+	}
+
+	bool RenderStateCache::setIndexBuffer(const SPtr<IndexBuffer>& buffer)
+	{
+		return update(SS_IndexBuffer, mIndexBuffer, buffer);
+	}
+
+	bool RenderStateCache::setVertexDeclaration(const SPtr<VertexDeclaration>& vertexDeclaration)
+	{
+		return update(SS_VertexDeclaration, mVertexDeclaration, vertexDeclaration);
+	}
+
+	bool RenderStateCache::setDrawOperation(DrawOperationType op)
+	{
+		return update(SS_DrawOperation, mDrawOp, op);
+	}
+
+	bool RenderStateCache::setViewport(const Rect2& area)
+	{
+		return update(SS_Viewport, mViewport, area);
+	}
+
+	bool RenderStateCache::setScissorRect(UINT32 left, UINT32 top, UINT32 right, UINT32 bottom)
+	{
+		if ((mBound & SS_ScissorRect) != 0 && mScissorRect[0] == left && mScissorRect[1] == top &&
+			mScissorRect[2] == right && mScissorRect[3] == bottom)
+		{
+			BS_INC_RENDER_STAT(NumRedundantBinds);
+			return false;
+		}
+
+		mScissorRect[0] = left;
+		mScissorRect[1] = top;
+		mScissorRect[2] = right;
+		mScissorRect[3] = bottom;
+		mBound |= SS_ScissorRect;
+
+		return true;
+	}
+
+	bool RenderStateCache::setStencilRef(UINT32 value)
+	{
+		return update(SS_StencilRef, mStencilRef, value);
+	}
+
+	void RenderStateCache::notifyRenderTargetChanged()
+	{
+		// Parameters are bound again as well, so backends can track the use of resources that might have been bound
+		// as render targets in the meantime
+		mBound &= ~(SS_Viewport | SS_ScissorRect | SS_GpuParams);
+	}
+
+	void RenderStateCache::invalidate()
+	{
+		mBound = 0;
+		mBoundVertexBuffers = 0;
+
+		mGraphicsPipeline = nullptr;
+		mComputePipeline = nullptr;
+		mGpuParams = nullptr;
+		mParamBlockVersions.clear();
+		mIndexBuffer = nullptr;
+		mVertexDeclaration = nullptr;
+
+		for (auto& entry : mVertexBuffers)
+			entry = nullptr;
+	}
+}}
@@ -0,0 +1,117 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "BsCorePrerequisites.h"
+#include "Math/BsRect2.h"
+#include "RenderAPI/BsRenderAPICapabilities.h"
+
+namespace bs { namespace ct
+{
+	/** @addtogroup RenderAPI-Internal
+	 *  @{
+	 */
+
+	/**
+	 * Keeps a copy of the state bound on a command buffer, allowing render API backends to skip binds of state that is
+	 * already bound. Each set method records the new state and returns true if the bind needs to be issued, or returns
+	 * false and increments the redundant bind counter in RenderStats if the same state is already bound.
+	 *
+	 * Bound objects are referenced until they are replaced or the cache is invalidated, so a new object allocated at
+	 * the address of a released one is never mistaken for it. Must be invalidated whenever the backend loses track of
+	 * the bound state, such as when the command buffer is submitted or reset.
+	 */
+	class BS_CORE_EXPORT RenderStateCache
+	{
+	public:
+		/** Records a graphics pipeline bind. Returns true if the pipeline isn't already bound. */
+		bool setGraphicsPipeline(const SPtr<GraphicsPipelineState>& pipelineState);
+
+		/** Records a compute pipeline bind. Returns true if the pipeline isn't already bound. */
+		bool setComputePipeline(const SPtr<ComputePipelineState>& pipelineState);
+
+		/**
+		 * Records a GPU parameter bind. Returns true if different parameters are bound, if a different object was
+		 * assigned to the parameters or the contents of one of their parameter block buffers were modified since they
+		 * were bound, or if a pipeline or a render target was bound in the meantime.
+		 */
+		bool setGpuParams(const SPtr<GpuParams>& gpuParams);
+
+		/** Records a vertex buffer bind. Returns true if any of the buffers isn't already bound to its slot. */
+		bool setVertexBuffers(UINT32 index, SPtr<VertexBuffer>* buffers, UINT32 numBuffers);
+
+		/** Records an index buffer bind. Returns true if the buffer isn't already bound. */
+		bool setIndexBuffer(const SPtr<IndexBuffer>& buffer);
+
+		/** Records a vertex declaration bind. Returns true if the declaration isn't already bound. */
+		bool setVertexDeclaration(const SPtr<VertexDeclaration>& vertexDeclaration);
+
+		/** Records a draw operation change. Returns true if a different operation is set. */
+		bool setDrawOperation(DrawOperationType op);
+
+		/** Records a viewport change. Returns true if a different viewport is set. */
+		bool setViewport(const Rect2& area);
+
+		/** Records a scissor rectangle change. Returns true if a different rectangle is set. */
+		bool setScissorRect(UINT32 left, UINT32 top, UINT32 right, UINT32 bottom);
+
+		/** Records a stencil reference value change. Returns true if a different value is set. */
+		bool setStencilRef(UINT32 value);
+
+		/**
+		 * Notifies the cache that a render target was bound. Render target binds are never skipped, but the viewport,
+		 * scissor rectangle and GPU parameters are no longer considered bound after the change.
+		 */
+		void notifyRenderTargetChanged();
+
+		/** Forgets all bound state, ensuring the next bind of every type is issued. */
+		void invalidate();
+
+	private:
+		/** Types of tracked state. */
+		enum StateSlot
+		{
+			SS_GraphicsPipeline = 1 << 0,
+			SS_ComputePipeline = 1 << 1,
+			SS_GpuParams = 1 << 2,
+			SS_IndexBuffer = 1 << 3,
+			SS_VertexDeclaration = 1 << 4,
+			SS_DrawOperation = 1 << 5,
+			SS_Viewport = 1 << 6,
+			SS_ScissorRect = 1 << 7,
+			SS_StencilRef = 1 << 8
+		};
+
+		/**
+		 * Assigns @p value to @p current unless the slot is bound with the same value already. Returns true if the
+		 * value was assigned.
+		 */
+		template<class T>
+		bool update(StateSlot slot, T& current, const T& value);
+
+		/**
+		 * Checks if the bound GPU parameters, or the contents of their parameter block buffers, were modified since
+		 * they were bound.
+		 */
+		bool isGpuParamsModified() const;
+
+		UINT32 mBound = 0;
+
+		SPtr<GraphicsPipelineState> mGraphicsPipeline;
+		SPtr<ComputePipelineState> mComputePipeline;
+		SPtr<GpuParams> mGpuParams;
+		UINT64 mGpuParamsVersion = 0;
+		SmallVector<UINT32, 8> mParamBlockVersions;
+		SPtr<IndexBuffer> mIndexBuffer;
+		SPtr<VertexDeclaration> mVertexDeclaration;
+		DrawOperationType mDrawOp = DOT_TRIANGLE_LIST;
+		Rect2 mViewport;
+		UINT32 mScissorRect[4] = { 0, 0, 0, 0 };
+		UINT32 mStencilRef = 0;
+
+		SPtr<VertexBuffer> mVertexBuffers[BS_MAX_BOUND_VERTEX_BUFFERS];
+		UINT32 mBoundVertexBuffers = 0;
+	};
+
+	/** @} */
+}}
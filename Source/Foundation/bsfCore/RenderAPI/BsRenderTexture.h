@@ -158,6 +158,9 @@ namespace bs
 		/**	Returns properties that describe the render texture. */
 		const RenderTextureProperties& getProperties() const;
 
+		/** Returns the descriptor the render texture was created with. */
+		const RENDER_TEXTURE_DESC& getDesc() const { return mDesc; }
+
 	protected:
 		/** @copydoc CoreObject::syncToCore */
 		void syncToCore(const CoreSyncData& data) override;
@@ -3,6 +3,8 @@
 #pragma once
 
 #include "BsCorePrerequisites.h"
+#include "Math/BsVector3.h"
+#include "Math/BsMatrix4.h"
 
 namespace bs
 {
@@ -24,5 +26,41 @@ namespace bs
 		DrawOperationType drawOp = DOT_TRIANGLE_LIST;
 	};
 
+	/** Describes a single level of detail of a mesh, as an alternative set of sub-meshes. */
+	struct BS_CORE_EXPORT MeshLOD
+	{
+		/** Sub-meshes to render at this level of detail. One entry for each sub-mesh of the mesh, in the same order. */
+		Vector<SubMesh> subMeshes;
+
+		/**
+		 * Size of the mesh on screen below which this level of detail is used. Size is the projected diameter of the mesh
+		 * bounding sphere, relative to the viewport height.
+		 */
+		float screenSize = 0.0f;
+	};
+
+	/**
+	 * Describes how to decode vertex positions stored in a quantized format (e.g. VET_USHORT4_NORM) back into mesh local
+	 * space, as: position = stored * scale + offset.
+	 */
+	struct BS_CORE_EXPORT PositionQuantization
+	{
+		Vector3 scale = Vector3::ONE;
+		Vector3 offset = Vector3::ZERO;
+
+		/** Checks are positions stored unquantized, in which case they don't require decoding. */
+		bool isIdentity() const { return scale == Vector3::ONE && offset == Vector3::ZERO; }
+
+		/** Returns a matrix that transforms quantized positions into mesh local space. */
+		Matrix4 getDecodeMatrix() const
+		{
+			return Matrix4(
+				scale.x, 0.0f, 0.0f, offset.x,
+				0.0f, scale.y, 0.0f, offset.y,
+				0.0f, 0.0f, scale.z, offset.z,
+				0.0f, 0.0f, 0.0f, 1.0f);
+		}
+	};
+
 	/** @} */
 }
@@ -3,6 +3,7 @@
 #include "RenderAPI/BsVertexBuffer.h"
 #include "Managers/BsHardwareBufferManager.h"
 #include "Profiling/BsRenderStats.h"
+#include "RenderAPI/BsRenderAPI.h"
 #include "RenderAPI/BsGpuBuffer.h"
 
 namespace bs
@@ -87,6 +88,9 @@ namespace bs
 		}
 #endif
 
+		if (options != GBL_READ_ONLY)
+			RenderAPI::_notifyBufferWrite(length);
+
 		return mBuffer->lock(offset, length, options, deviceIdx, queueIdx);
 	}
 
@@ -105,6 +109,7 @@ namespace bs
 		UINT32 queueIdx)
 	{
 		mBuffer->writeData(offset, length, source, writeFlags, queueIdx);
+		RenderAPI::_notifyBufferWrite(length);
 		BS_INC_RENDER_STAT_CAT(ResWrite, RenderStatObject_VertexBuffer);
 	}
 
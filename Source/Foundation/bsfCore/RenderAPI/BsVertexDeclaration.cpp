@@ -28,7 +28,16 @@ namespace bs
 		case VET_COLOR_ARGB:
 			return sizeof(RGBA);
 		case VET_UBYTE4_NORM:
+		case VET_UINT_10_10_10_2_NORM:
 			return sizeof(UINT32);
+		case VET_HALF2:
+			return sizeof(UINT16) * 2;
+		case VET_HALF4:
+			return sizeof(UINT16) * 4;
+		case VET_USHORT2_NORM:
+			return sizeof(UINT16) * 2;
+		case VET_USHORT4_NORM:
+			return sizeof(UINT16) * 4;
 		case VET_FLOAT1:
 			return sizeof(float);
 		case VET_FLOAT2:
@@ -93,6 +102,8 @@ namespace bs
 		case VET_USHORT2:
 		case VET_INT2:
 		case VET_UINT2:
+		case VET_HALF2:
+		case VET_USHORT2_NORM:
 			return 2;
 		case VET_FLOAT3:
 		case VET_INT3:
@@ -105,6 +116,9 @@ namespace bs
 		case VET_UINT4:
 		case VET_UBYTE4:
 		case VET_UBYTE4_NORM:
+		case VET_HALF4:
+		case VET_USHORT4_NORM:
+		case VET_UINT_10_10_10_2_NORM:
 			return 4;
 		default:
 			break;
@@ -53,6 +53,15 @@ namespace bs
 		VET_UINT2 = 22,  /**< 2D 32-bit signed integer value */
 		VET_UINT3 = 23,  /**< 3D 32-bit signed integer value */
 		VET_UBYTE4_NORM = 24, /**< 4D 8-bit unsigned integer interpreted as a normalized value in [0, 1] range. */
+		VET_HALF2 = 25, /**< 2D 16-bit floating point value */
+		VET_HALF4 = 26, /**< 4D 16-bit floating point value */
+		VET_USHORT2_NORM = 27, /**< 2D 16-bit unsigned integer interpreted as a normalized value in [0, 1] range. */
+		VET_USHORT4_NORM = 28, /**< 4D 16-bit unsigned integer interpreted as a normalized value in [0, 1] range. */
+		/**
+		 * 4D value packed in 32-bits, 10 bits for each of the first three components and 2 bits for the last, interpreted
+		 * as a normalized value in [0, 1] range.
+		 */
+		VET_UINT_10_10_10_2_NORM = 29,
 		VET_COUNT, // Keep at end before VET_UNKNOWN
 		VET_UNKNOWN = 0xffff
 	};
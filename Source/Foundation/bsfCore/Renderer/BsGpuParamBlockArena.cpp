@@ -0,0 +1,114 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#include "Renderer/BsGpuParamBlockArena.h"
+#include "RenderAPI/BsGpuParamBlockBuffer.h"
+#include "RenderAPI/BsRenderAPI.h"
+#include "Math/BsMath.h"
+
+namespace bs { namespace ct
+{
+	GpuParamBlockArena::GpuParamBlockArena(UINT32 pageSize)
+		:GpuParamBlockArena(pageSize, gCaps().paramBlockOffsetAlignment, gCaps().hasCapability(RSC_PARAM_BLOCK_OFFSETS))
+	{ }
+
+	GpuParamBlockArena::GpuParamBlockArena(UINT32 pageSize, UINT32 alignment, bool supported)
+		:mPageSize(pageSize), mAlignment(std::max(alignment, 1U)), mSupported(supported)
+	{ }
+
+	GpuParamBlockArena::~GpuParamBlockArena()
+	{
+		for (auto& entry : mAllocations)
+			entry->_clearArenaAllocation();
+	}
+
+	void GpuParamBlockArena::begin()
+	{
+		for (auto& entry : mAllocations)
+			entry->_clearArenaAllocation();
+
+		mAllocations.clear();
+
+		for (auto& page : mPages)
+		{
+			page.used = 0;
+			page.flushed = 0;
+		}
+
+		mActivePage = 0;
+		mDirty = false;
+	}
+
+	bool GpuParamBlockArena::allocate(const SPtr<GpuParamBlockBuffer>& buffer)
+	{
+		const UINT32 size = buffer->getSize();
+		if (!mSupported || size == 0 || size > mPageSize)
+		{
+			buffer->flushToGPU();
+			return false;
+		}
+
+		// Find the first page with enough space left, starting from the page used by the previous allocation
+		UINT32 offset = 0;
+		while (true)
+		{
+			if (mActivePage == (UINT32)mPages.size())
+			{
+				Page page;
+				page.buffer = GpuParamBlockBuffer::create(mPageSize);
+
+				mPages.push_back(page);
+			}
+
+			const Page& page = mPages[mActivePage];
+			offset = Math::divideAndRoundUp(page.used, mAlignment) * mAlignment;
+			if (offset + size <= mPageSize)
+				break;
+
+			mActivePage++;
+		}
+
+		Page& page = mPages[mActivePage];
+		page.buffer->write(offset, buffer->getCachedData(), size);
+		page.used = offset + size;
+
+		// Buffers allocated multiple times during a frame (e.g. once per view) only need to be released once
+		if (buffer->getBindBuffer() == buffer.get())
+			mAllocations.push_back(buffer);
+
+		buffer->_setArenaAllocation(this, page.buffer.get(), offset);
+		mDirty = true;
+
+		return true;
+	}
+
+	void GpuParamBlockArena::flush(UINT32 queueIdx)
+	{
+		if (!mDirty)
+			return;
+
+		for (UINT32 i = 0; i <= mActivePage && i < (UINT32)mPages.size(); i++)
+		{
+			Page& page = mPages[i];
+			if (page.used == page.flushed)
+				continue;
+
+			// Ranges flushed earlier during the frame might still be in use by the GPU, so the first write discards the
+			// previous contents and later ones only append to them
+			const BufferWriteType writeFlags = page.flushed == 0 ? BWT_DISCARD : BTW_NO_OVERWRITE;
+			page.buffer->writeRangeToGPU(page.flushed, page.used - page.flushed, writeFlags, queueIdx);
+
+			page.flushed = page.used;
+		}
+
+		mDirty = false;
+	}
+
+	UINT32 GpuParamBlockArena::getAllocatedSize() const
+	{
+		UINT32 total = 0;
+		for (auto& page : mPages)
+			total += page.used;
+
+		return total;
+	}
+}}
@@ -0,0 +1,98 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "BsCorePrerequisites.h"
+#include "Utility/BsModule.h"
+
+namespace bs { namespace ct
+{
+	/** @addtogroup Renderer-Internal
+	 *  @{
+	 */
+
+	/**
+	 * Transient memory used for uploading the contents of parameter block buffers that change every frame (e.g.
+	 * per-object and per-draw data). Instead of each buffer being written to the GPU separately, allocate() copies
+	 * the buffer contents into a large page, and the page is written to the GPU with a single copy the first time one
+	 * of its buffers is bound. Buffers are then bound as a sub-range of the page.
+	 *
+	 * Allocations are valid until the next call to begin(), or until the contents of the allocated buffer change. Pages
+	 * are kept between frames and reused.
+	 *
+	 * If the render API doesn't support binding sub-ranges of parameter block buffers (see RSC_PARAM_BLOCK_OFFSETS),
+	 * allocate() just flushes the buffer normally.
+	 *
+	 * @note	Core thread only.
+	 */
+	class BS_CORE_EXPORT GpuParamBlockArena : public Module<GpuParamBlockArena>
+	{
+	public:
+		/**
+		 * Creates an arena that uses sub-ranges if the active render API supports them.
+		 *
+		 * @param[in]	pageSize	Size of a single page, in bytes.
+		 */
+		GpuParamBlockArena(UINT32 pageSize = 256 * 1024);
+
+		/**
+		 * Creates an arena with explicitly provided settings, rather than ones queried from the active render API.
+		 *
+		 * @param[in]	pageSize	Size of a single page, in bytes.
+		 * @param[in]	alignment	Alignment of allocation offsets, in bytes.
+		 * @param[in]	supported	True if the render API supports binding sub-ranges of parameter block buffers. If
+		 *							false allocate() always flushes buffers normally.
+		 */
+		GpuParamBlockArena(UINT32 pageSize, UINT32 alignment, bool supported);
+		~GpuParamBlockArena();
+
+		/** Starts a new frame, releasing all allocations made during the previous frame. */
+		void begin();
+
+		/**
+		 * Copies the current contents of the buffer into the arena. Until the buffer contents change or the next frame
+		 * begins, the buffer is bound as a sub-range of an arena page.
+		 *
+		 * @param[in]	buffer	Buffer whose contents to allocate.
+		 * @return				True if the contents were allocated in the arena. False if the buffer was flushed
+		 *						normally instead, because sub-ranges aren't supported by the render API or the buffer is
+		 *						larger than a page.
+		 */
+		bool allocate(const SPtr<GpuParamBlockBuffer>& buffer);
+
+		/**
+		 * Writes all allocations made since the last flush to the GPU. Called automatically when an allocated buffer is
+		 * flushed, which the render API does before binding it.
+		 *
+		 * @param[in]	queueIdx	Device queue to perform the write operation on. See @ref queuesDoc.
+		 */
+		void flush(UINT32 queueIdx = 0);
+
+		/** Returns the number of pages created by the arena. */
+		UINT32 getNumPages() const { return (UINT32)mPages.size(); }
+
+		/** Returns the number of bytes allocated since the start of the frame. */
+		UINT32 getAllocatedSize() const;
+
+	private:
+		/** A single buffer from which allocations are made. */
+		struct Page
+		{
+			SPtr<GpuParamBlockBuffer> buffer;
+			UINT32 used = 0;
+			UINT32 flushed = 0;
+		};
+
+		UINT32 mPageSize;
+		UINT32 mAlignment;
+		bool mSupported;
+
+		Vector<Page> mPages;
+		UINT32 mActivePage = 0;
+		bool mDirty = false;
+
+		Vector<SPtr<GpuParamBlockBuffer>> mAllocations;
+	};
+
+	/** @} */
+}}
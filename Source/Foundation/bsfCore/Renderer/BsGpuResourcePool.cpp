@@ -9,6 +9,9 @@ namespace bs { namespace ct
 {
 	SPtr<PooledRenderTexture> GpuResourcePool::get(const POOLED_RENDER_TEXTURE_DESC& desc)
 	{
+		// Prefer the most recently used texture, so the same textures keep getting shared between requests and the
+		// ones no longer needed age out
+		SPtr<PooledRenderTexture> found;
 		for (auto& entry : mTextures)
 		{
 			bool isFree = entry.use_count() == 1;
@@ -18,11 +21,19 @@ namespace bs { namespace ct
 			if (entry->texture == nullptr)
 				continue;
 
-			if (matches(entry->texture, desc))
-			{
-				entry->mLastUsedFrame = mCurrentFrame;
-				return entry;
-			}
+			if (!matches(entry->texture, desc))
+				continue;
+
+			if (found == nullptr || entry->mLastUsedFrame > found->mLastUsedFrame)
+				found = entry;
+		}
+
+		if (found != nullptr)
+		{
+			found->mLastUsedFrame = mCurrentFrame;
+			notifyUsed(found->mMemorySize, found->mLastUsedScope);
+
+			return found;
 		}
 
 		SPtr<PooledRenderTexture> newTexture = bs_shared_ptr_new<PooledRenderTexture>(mCurrentFrame);
@@ -67,6 +78,10 @@ namespace bs { namespace ct
 			newTexture->renderTexture = RenderTexture::create(rtDesc);
 		}
 
+		newTexture->mMemorySize = getMemorySize(newTexture->texture);
+		mStats.allocatedMemory += newTexture->mMemorySize;
+		notifyUsed(newTexture->mMemorySize, newTexture->mLastUsedScope);
+
 		return newTexture;
 	}
 
@@ -80,6 +95,7 @@ namespace bs { namespace ct
 
 	SPtr<PooledStorageBuffer> GpuResourcePool::get(const POOLED_STORAGE_BUFFER_DESC& desc)
 	{
+		SPtr<PooledStorageBuffer> found;
 		for (auto& entry : mBuffers)
 		{
 			bool isFree = entry.use_count() == 1;
@@ -89,11 +105,19 @@ namespace bs { namespace ct
 			if (entry->buffer == nullptr)
 				continue;
 
-			if (matches(entry->buffer, desc))
-			{
-				entry->mLastUsedFrame = mCurrentFrame;
-				return entry;
-			}
+			if (!matches(entry->buffer, desc))
+				continue;
+
+			if (found == nullptr || entry->mLastUsedFrame > found->mLastUsedFrame)
+				found = entry;
+		}
+
+		if (found != nullptr)
+		{
+			found->mLastUsedFrame = mCurrentFrame;
+			notifyUsed(found->mMemorySize, found->mLastUsedScope);
+
+			return found;
 		}
 
 		SPtr<PooledStorageBuffer> newBuffer = bs_shared_ptr_new<PooledStorageBuffer>(mCurrentFrame);
@@ -108,6 +132,10 @@ namespace bs { namespace ct
 
 		newBuffer->buffer = GpuBuffer::create(bufferDesc);
 
+		newBuffer->mMemorySize = getMemorySize(newBuffer->buffer);
+		mStats.allocatedMemory += newBuffer->mMemorySize;
+		notifyUsed(newBuffer->mMemorySize, newBuffer->mLastUsedScope);
+
 		return newBuffer;
 	}
 
@@ -143,7 +171,10 @@ namespace bs { namespace ct
 
 			UINT32 entryAge = mCurrentFrame - entry->mLastUsedFrame;
 			if(entryAge >= age)
+			{
+				mStats.allocatedMemory -= entry->mMemorySize;
 				mTextures.swapAndErase(iter);
+			}
 			else
 				++iter;
 		}
@@ -161,12 +192,79 @@ namespace bs { namespace ct
 
 			UINT32 entryAge = mCurrentFrame - entry->mLastUsedFrame;
 			if(entryAge >= age)
+			{
+				mStats.allocatedMemory -= entry->mMemorySize;
 				mBuffers.swapAndErase(iter);
+			}
 			else
 				++iter;
 		}
 	}
 
+	UINT64 GpuResourcePool::getUsedMemory() const
+	{
+		UINT64 total = 0;
+		for (auto& entry : mTextures)
+		{
+			if (entry.use_count() > 1)
+				total += entry->mMemorySize;
+		}
+
+		for (auto& entry : mBuffers)
+		{
+			if (entry.use_count() > 1)
+				total += entry->mMemorySize;
+		}
+
+		return total;
+	}
+
+	void GpuResourcePool::resetStats()
+	{
+		mCurrentScope++;
+
+		mStats.baseUsedMemory = getUsedMemory();
+		mStats.peakUsedMemory = mStats.baseUsedMemory;
+		mStats.requestedMemory = 0;
+		mStats.numAliased = 0;
+	}
+
+	void GpuResourcePool::notifyUsed(UINT64 size, UINT32& lastUsedScope)
+	{
+		// Resources are only released by dropping their references, so the used memory can only grow (and the peak
+		// change) when a resource is given out
+		mStats.peakUsedMemory = std::max(mStats.peakUsedMemory, getUsedMemory());
+		mStats.requestedMemory += size;
+
+		if (lastUsedScope == mCurrentScope)
+			mStats.numAliased++;
+
+		lastUsedScope = mCurrentScope;
+	}
+
+	UINT64 GpuResourcePool::getMemorySize(const SPtr<Texture>& texture)
+	{
+		const TextureProperties& texProps = texture->getProperties();
+
+		UINT64 size = 0;
+		for (UINT32 i = 0; i <= texProps.getNumMipmaps(); i++)
+		{
+			UINT32 width, height, depth;
+			PixelUtil::getSizeForMipLevel(texProps.getWidth(), texProps.getHeight(), texProps.getDepth(), i,
+				width, height, depth);
+
+			size += PixelUtil::getMemorySize(width, height, depth, texProps.getFormat());
+		}
+
+		return size * texProps.getNumFaces() * std::max(texProps.getNumSamples(), 1U);
+	}
+
+	UINT64 GpuResourcePool::getMemorySize(const SPtr<GpuBuffer>& buffer)
+	{
+		const GpuBufferProperties& props = buffer->getProperties();
+		return (UINT64)props.getElementSize() * props.getElementCount();
+	}
+
 	bool GpuResourcePool::matches(const SPtr<Texture>& texture, const POOLED_RENDER_TEXTURE_DESC& desc)
 	{
 		const TextureProperties& texProps = texture->getProperties();
@@ -32,6 +32,8 @@ namespace bs { namespace ct
 		friend class GpuResourcePool;
 
 		UINT32 mLastUsedFrame = 0;
+		UINT32 mLastUsedScope = 0;
+		UINT64 mMemorySize = 0;
 	};
 
 	/**	Contains data about a single storage buffer in the GPU resource pool. */
@@ -47,11 +49,45 @@ namespace bs { namespace ct
 		friend class GpuResourcePool;
 
 		UINT32 mLastUsedFrame = 0;
+		UINT32 mLastUsedScope = 0;
+		UINT64 mMemorySize = 0;
+	};
+
+	/** Information about the memory used by resources in the GpuResourcePool. All sizes are in bytes. */
+	struct BS_CORE_EXPORT GpuResourcePoolStats
+	{
+		/** Memory used by all resources in the pool, whether they are currently in use or not. */
+		UINT64 allocatedMemory = 0;
+
+		/** Largest amount of memory in use at the same time, since the last call to GpuResourcePool::resetStats(). */
+		UINT64 peakUsedMemory = 0;
+
+		/**
+		 * Memory used by resources that were in use when GpuResourcePool::resetStats() was last called. Subtract it from
+		 * @p peakUsedMemory to get the peak memory of resources requested since then.
+		 */
+		UINT64 baseUsedMemory = 0;
+
+		/**
+		 * Sum of the memory of all resources requested since the last call to GpuResourcePool::resetStats(). This is the
+		 * amount of memory that would be required if no two requests shared the same resource.
+		 */
+		UINT64 requestedMemory = 0;
+
+		/**
+		 * Number of requests since the last call to GpuResourcePool::resetStats() that were given a resource already
+		 * given to and released by an earlier request since then.
+		 */
+		UINT32 numAliased = 0;
 	};
 
 	/**
 	 * Contains a pool of textures and buffers meant to accommodate reuse of such resources for the main purpose of using
 	 * them as write targets on the GPU.
+	 *
+	 * Resources are meant to be held only for as long as they are needed. Once released, a resource can be handed out to
+	 * a later request with the same parameters, during the same frame. This way requests whose lifetimes don't overlap
+	 * share the same memory.
 	 */
 	class BS_CORE_EXPORT GpuResourcePool : public Module<GpuResourcePool>
 	{
@@ -106,7 +142,33 @@ namespace bs { namespace ct
 		 * unreferenced resources.
 		 */
 		void prune(UINT32 age);
+
+		/** Returns the amount of memory used by the resources currently in use, in bytes. */
+		UINT64 getUsedMemory() const;
+
+		/** Returns information about the memory used by the pooled resources. */
+		const GpuResourcePoolStats& getStats() const { return mStats; }
+
+		/**
+		 * Starts a new measurement scope for the statistics reported by getStats(), resetting the peak memory and
+		 * request counters.
+		 */
+		void resetStats();
 	private:
+		/**
+		 * Updates statistics after a resource was given out by the pool.
+		 *
+		 * @param[in]	size			Size of the resource, in bytes.
+		 * @param[in]	lastUsedScope	Scope in which the resource was last given out. Updated to the current scope.
+		 */
+		void notifyUsed(UINT64 size, UINT32& lastUsedScope);
+
+		/** Calculates the amount of GPU memory used by the provided texture, in bytes. */
+		static UINT64 getMemorySize(const SPtr<Texture>& texture);
+
+		/** Calculates the amount of GPU memory used by the provided buffer, in bytes. */
+		static UINT64 getMemorySize(const SPtr<GpuBuffer>& buffer);
+
 		/**
 		 * Checks does the provided texture match the parameters.
 		 *
@@ -129,6 +191,8 @@ namespace bs { namespace ct
 		DynArray<SPtr<PooledStorageBuffer>> mBuffers;
 
 		UINT32 mCurrentFrame = 0;
+		UINT32 mCurrentScope = 1;
+		GpuResourcePoolStats mStats;
 	};
 
 	/** Structure used for creating a new pooled render texture. */
@@ -2,12 +2,29 @@
 //*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
 #include "Renderer/BsIBLUtility.h"
 #include "Math/BsVector2I.h"
+#include "Image/BsTexture.h"
+#include "Image/BsPixelUtil.h"
 
 namespace bs { namespace ct
 {
 	const UINT32 IBLUtility::REFLECTION_CUBEMAP_SIZE = 256;
 	const UINT32 IBLUtility::IRRADIANCE_CUBEMAP_SIZE = 32;
 
+	SPtr<Texture> IBLUtility::createScratchCubemap(const SPtr<Texture>& cubemap)
+	{
+		auto& props = cubemap->getProperties();
+
+		TEXTURE_DESC cubemapDesc;
+		cubemapDesc.type = TEX_TYPE_CUBE_MAP;
+		cubemapDesc.format = props.getFormat();
+		cubemapDesc.width = props.getWidth();
+		cubemapDesc.height = props.getHeight();
+		cubemapDesc.numMips = PixelUtil::getMaxMipmaps(cubemapDesc.width, cubemapDesc.height, 1, cubemapDesc.format);
+		cubemapDesc.usage = TU_STATIC | TU_RENDERTARGET;
+
+		return Texture::create(cubemapDesc);
+	}
+
 	/** Returns the size of the texture required to store the provided number of SH coefficients. */
 	Vector2I IBLUtility::getSHCoeffTextureSize(UINT32 numCoeffSets, UINT32 shOrder)
 	{
@@ -26,6 +26,20 @@ namespace bs { namespace ct
 		 */
 		virtual void filterCubemapForSpecular(const SPtr<Texture>& cubemap, const SPtr<Texture>& scratch) const = 0;
 
+		/**
+		 * Performs a single step of the filtering done by filterCubemapForSpecular(const SPtr<Texture>&,
+		 * const SPtr<Texture>&), allowing the filtering to be spread over multiple frames. The first step prepares the
+		 * scratch cubemap, and each following step filters a single mip level. The number of steps is equal to the
+		 * number of mip levels in the cubemap.
+		 *
+		 * @param[in, out]	cubemap		Cubemap to filter. Its mip level 0 must not change until all steps are done.
+		 * @param[in]		scratch		Temporary cubemap texture to use for the filtering process, created with
+		 *								createScratchCubemap(). The same texture must be provided for all steps.
+		 * @param[in]		step		Index of the step to perform.
+		 */
+		virtual void filterCubemapForSpecular(const SPtr<Texture>& cubemap, const SPtr<Texture>& scratch,
+			UINT32 step) const = 0;
+
 		/**
 		 * Performs filtering on the cubemap, populating the output cubemap with values that can be used for evaluating
 		 * irradiance for use in diffuse lighting. Uses order-5 SH (25 coefficients) and outputs the values in the form of
@@ -61,6 +75,9 @@ namespace bs { namespace ct
 		virtual void scaleCubemap(const SPtr<Texture>& src, UINT32 srcMip, const SPtr<Texture>& dst, UINT32 dstMip) const = 0;
 
 
+		/** Creates a cubemap that can be used as scratch texture when filtering the provided cubemap for specular. */
+		static SPtr<Texture> createScratchCubemap(const SPtr<Texture>& cubemap);
+
 		/** Returns the size of the texture required to store the provided number of SH coefficient sets. */
 		static Vector2I getSHCoeffTextureSize(UINT32 numCoeffSets, UINT32 shOrder);
 		
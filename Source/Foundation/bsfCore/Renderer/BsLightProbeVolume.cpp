@@ -226,10 +226,11 @@ namespace bs
 		SPtr<ct::LightProbeVolume> coreProbeVolume = getCore();
 		auto renderProbes = [coreProbeVolume]()
 		{
-			return coreProbeVolume->renderProbes(3);
+			return coreProbeVolume->renderProbeStep();
 		};
 
 		mRendererTask = ct::RendererTask::create("RenderLightProbes", renderProbes);
+		mRendererTask->setTimeSliced(getTransform().getPosition());
 
 		mRendererTask->onComplete.connect(renderComplete);
 		ct::gRenderer()->addTask(mRendererTask);
@@ -439,19 +440,24 @@ namespace bs
 		CoreObject::initialize();
 	}
 
-	bool LightProbeVolume::renderProbes(UINT32 maxProbes)
+	bool LightProbeVolume::renderProbeStep()
 	{
 		// Probe map only contains active probes
 		UINT32 numUsedProbes = (UINT32)mProbeMap.size();
 		if(numUsedProbes > mCoeffBufferSize)
 			resizeCoefficientTexture(std::max(32U, numUsedProbes * 2));
 
-		UINT32 numProbeUpdates = 0;
-		for (; mFirstDirtyProbe < (UINT32)mProbeInfos.size(); ++mFirstDirtyProbe)
-		{
-			LightProbeInfo& probeInfo = mProbeInfos[mFirstDirtyProbe];
+		const auto numProbes = (UINT32)mProbeInfos.size();
+		while (mFirstDirtyProbe < numProbes && mProbeInfos[mFirstDirtyProbe].flags != LightProbeFlags::Dirty)
+			++mFirstDirtyProbe;
+
+		if (mFirstDirtyProbe == numProbes)
+			return true;
 
-			if(probeInfo.flags == LightProbeFlags::Dirty)
+		LightProbeInfo& probeInfo = mProbeInfos[mFirstDirtyProbe];
+		if (mCaptureFace < 6)
+		{
+			if (mCaptureCubemap == nullptr)
 			{
 				TEXTURE_DESC cubemapDesc;
 				cubemapDesc.type = TEX_TYPE_CUBE_MAP;
@@ -460,29 +466,42 @@ namespace bs
 				cubemapDesc.height = 256;
 				cubemapDesc.usage = TU_STATIC | TU_RENDERTARGET;
 
-				SPtr<Texture> cubemap = Texture::create(cubemapDesc);
+				mCaptureCubemap = Texture::create(cubemapDesc);
+			}
 
-				Vector3 localPos = mProbePositions[mFirstDirtyProbe];
+			Vector3 localPos = mProbePositions[mFirstDirtyProbe];
 
-				const Transform& tfrm = getTransform();
-				const Vector3& position = tfrm.getPosition();
-				const Quaternion& rotation = tfrm.getRotation();
-				Vector3 transformedPos = rotation.rotate(localPos) + position;
+			const Transform& tfrm = getTransform();
+			const Vector3& position = tfrm.getPosition();
+			const Quaternion& rotation = tfrm.getRotation();
+			Vector3 transformedPos = rotation.rotate(localPos) + position;
 
-				gRenderer()->captureSceneCubeMap(cubemap, transformedPos, CaptureSettings());
-				gIBLUtility().filterCubemapForIrradiance(cubemap, mCoefficients, probeInfo.bufferIdx);
+			CaptureSettings settings;
+			settings.firstFace = mCaptureFace;
+			settings.numFaces = 1;
 
-				probeInfo.flags = LightProbeFlags::Clean;
-				numProbeUpdates++;
-			}
+			gRenderer()->captureSceneCubeMap(mCaptureCubemap, transformedPos, settings);
+			mCaptureFace++;
 
-			if (maxProbes != 0 && numProbeUpdates >= maxProbes)
-				break;
+			return false;
 		}
 
+		gIBLUtility().filterCubemapForIrradiance(mCaptureCubemap, mCoefficients, probeInfo.bufferIdx);
+
+		probeInfo.flags = LightProbeFlags::Clean;
+		mCaptureFace = 0;
+
 		gRenderer()->notifyLightProbeVolumeUpdated(this);
 
-		return mFirstDirtyProbe == (UINT32)mProbeInfos.size();
+		while (mFirstDirtyProbe < numProbes && mProbeInfos[mFirstDirtyProbe].flags != LightProbeFlags::Dirty)
+			++mFirstDirtyProbe;
+
+		if (mFirstDirtyProbe < numProbes)
+			return false;
+
+		// Release the capture cubemap until more probes need to be rendered
+		mCaptureCubemap = nullptr;
+		return true;
 	}
 
 	void LightProbeVolume::syncToCore(const CoreSyncData& data)
@@ -497,6 +516,10 @@ namespace bs
 		rtti_read(numDirtyProbes, stream);
 		rtti_read(numRemovedProbes, stream);
 
+		// Probes might have moved, restart the render of the probe that was partially rendered
+		if (numDirtyProbes > 0 || numRemovedProbes > 0)
+			mCaptureFace = 0;
+
 		for (UINT32 i = 0; i < numDirtyProbes; ++i)
 		{
 			UINT32 handle;
@@ -270,13 +270,13 @@ namespace bs
 		void syncToCore(const CoreSyncData& data) override;
 
 		/**
-		 * Renders dirty probes and updates their SH coefficients in the local GPU buffer.
+		 * Performs a single step of rendering the dirty probes and updating their SH coefficients in the local GPU
+		 * buffer. Each step either renders a single cubemap face of the first dirty probe, or filters the probe once all
+		 * of its faces are rendered, allowing the rendering to be distributed over multiple frames.
 		 *
-		 * @param[in]	maxProbes	Maximum number of probes to render. Set to zero to render all dirty probes. Limiting the
-		 *							number of probes allows the rendering to be distributed over multiple frames.
-		 * @return					True if there are no more dirty probes to process.
+		 * @return		True if there are no more dirty probes to process.
 		 */
-		bool renderProbes(UINT32 maxProbes);
+		bool renderProbeStep();
 
 		/**
 		 * Resizes the internal texture that stores light probe SH coefficients, to the specified size (in the number
@@ -288,6 +288,10 @@ namespace bs
 		UnorderedMap<UINT32, UINT32> mProbeMap; // Map from static indices to compact list of probes
 		UINT32 mFirstDirtyProbe = 0;
 
+		// Cubemap of the dirty probe currently being rendered, and the next face to render into it
+		SPtr<Texture> mCaptureCubemap;
+		UINT32 mCaptureFace = 0;
+
 		Vector<Vector3> mProbePositions;
 		Vector<LightProbeInfo> mProbeInfos;
 
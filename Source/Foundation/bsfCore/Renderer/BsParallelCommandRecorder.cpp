@@ -0,0 +1,70 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#include "Renderer/BsParallelCommandRecorder.h"
+#include "RenderAPI/BsRenderAPI.h"
+#include "RenderAPI/BsCommandBuffer.h"
+#include "Threading/BsTaskScheduler.h"
+
+namespace bs { namespace ct
+{
+	ParallelCommandRecorder::ParallelCommandRecorder(const String& name)
+		:ParallelCommandRecorder(name, gCaps().hasCapability(RSC_SECONDARY_CB))
+	{ }
+
+	ParallelCommandRecorder::ParallelCommandRecorder(const String& name, bool parallel)
+		:mName(name), mParallel(parallel)
+	{ }
+
+	ParallelCommandRecorder::~ParallelCommandRecorder()
+	{
+		// Work might reference data owned by the caller, so it must not outlive the recorder
+		for (auto& entry : mTasks)
+			entry->wait();
+	}
+
+	void ParallelCommandRecorder::record(std::function<void()> work)
+	{
+		if (!mParallel)
+		{
+			work();
+			return;
+		}
+
+		// Command buffers can only be created on the core thread, so they're created here and reused between submits
+		const UINT32 idx = (UINT32)mTasks.size();
+		if (idx == (UINT32)mCommandBuffers.size())
+			mCommandBuffers.push_back(CommandBuffer::create(GQT_GRAPHICS, 0, 0, true));
+		else if (mCommandBuffers[idx]->getState() == CommandBufferState::Executing)
+			mCommandBuffers[idx] = CommandBuffer::create(GQT_GRAPHICS, 0, 0, true);
+		else
+			mCommandBuffers[idx]->reset();
+
+		SPtr<CommandBuffer> commandBuffer = mCommandBuffers[idx];
+		SPtr<Task> task = Task::create(mName, [work, commandBuffer]()
+		{
+			RenderAPI::_setThreadCommandBuffer(&commandBuffer);
+			work();
+			RenderAPI::_setThreadCommandBuffer(nullptr);
+		});
+
+		TaskScheduler::instance().addTask(task);
+		mTasks.push_back(task);
+	}
+
+	void ParallelCommandRecorder::submit(const SPtr<CommandBuffer>& commandBuffer)
+	{
+		if (mTasks.empty())
+			return;
+
+		RenderAPI& rapi = RenderAPI::instance();
+		SPtr<CommandBuffer> primary = commandBuffer != nullptr ? commandBuffer : rapi.getMainCommandBuffer();
+
+		for (UINT32 i = 0; i < (UINT32)mTasks.size(); i++)
+		{
+			mTasks[i]->wait();
+			rapi.addCommands(primary, mCommandBuffers[i]);
+		}
+
+		mTasks.clear();
+	}
+}}
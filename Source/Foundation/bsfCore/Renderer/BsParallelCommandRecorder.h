@@ -0,0 +1,78 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "BsCorePrerequisites.h"
+
+namespace bs { namespace ct
+{
+	/** @addtogroup Renderer-Internal
+	 *  @{
+	 */
+
+	/**
+	 * Records independent pieces of rendering work on worker threads, each into its own secondary command buffer, and
+	 * appends the command buffers to a primary command buffer in the order the work was queued. While the work executes
+	 * all render API calls that don't provide a command buffer are queued on the secondary command buffer, so the work
+	 * can use renderer materials and utility methods normally.
+	 *
+	 * Work is expected to only read shared state, or to use state (e.g. material instances) not used by any other work
+	 * queued at the same time.
+	 *
+	 * If the render API doesn't support secondary command buffers (see RSC_SECONDARY_CB) the work instead executes
+	 * immediately on the calling thread, recording into the main command buffer. Currently only the null render API
+	 * reports the capability, so the renderer doesn't use the recorder yet and records all views serially.
+	 *
+	 * @note	Core thread only.
+	 */
+	class BS_CORE_EXPORT ParallelCommandRecorder
+	{
+	public:
+		/**
+		 * Creates a recorder that records in parallel if the active render API supports it.
+		 *
+		 * @param[in]	name	Name used for identifying the worker tasks.
+		 */
+		ParallelCommandRecorder(const String& name = "CommandRecording");
+
+		/**
+		 * Creates a recorder that explicitly records in parallel or not, rather than checking if the active render API
+		 * supports it.
+		 *
+		 * @param[in]	name		Name used for identifying the worker tasks.
+		 * @param[in]	parallel	True if work should be recorded on worker threads.
+		 */
+		ParallelCommandRecorder(const String& name, bool parallel);
+		~ParallelCommandRecorder();
+
+		/** Returns true if queued work is recorded on worker threads, or false if it executes immediately. */
+		bool isParallel() const { return mParallel; }
+
+		/**
+		 * Queues work that records rendering commands. If recording in parallel the work starts executing on a worker
+		 * thread, otherwise it executes before the method returns.
+		 */
+		void record(std::function<void()> work);
+
+		/**
+		 * Waits until all work queued since the last call finishes, and appends the recorded command buffers to the
+		 * provided command buffer, in the order the work was queued.
+		 *
+		 * @param[in]	commandBuffer	Primary command buffer to append the commands to. If null the main command
+		 *								buffer is used.
+		 */
+		void submit(const SPtr<CommandBuffer>& commandBuffer = nullptr);
+
+		/** Returns the number of secondary command buffers created by the recorder. */
+		UINT32 getNumCommandBuffers() const { return (UINT32)mCommandBuffers.size(); }
+
+	private:
+		String mName;
+		bool mParallel;
+
+		Vector<SPtr<CommandBuffer>> mCommandBuffers;
+		Vector<SPtr<Task>> mTasks;
+	};
+
+	/** @} */
+}}
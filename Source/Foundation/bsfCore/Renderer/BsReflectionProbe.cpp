@@ -103,25 +103,51 @@ namespace bs
 		SPtr<ct::ReflectionProbe> coreProbe = getCore();
 		SPtr<ct::Texture> coreTexture = mFilteredTexture->getCore();
 
+		// Filters a single mip level per call. Returns true once all mip levels have been filtered.
+		auto filterStep = [coreTexture, coreProbe](SPtr<ct::Texture>& scratch, UINT32 step)
+		{
+			if (scratch == nullptr)
+				scratch = ct::IBLUtility::createScratchCubemap(coreTexture);
+
+			ct::gIBLUtility().filterCubemapForSpecular(coreTexture, scratch, step);
+
+			const UINT32 numSteps = coreTexture->getProperties().getNumMipmaps() + 1;
+			if ((step + 1) < numSteps)
+				return false;
+
+			coreProbe->mFilteredTexture = coreTexture;
+			ct::gRenderer()->notifyReflectionProbeUpdated(coreProbe.get(), true);
+
+			return true;
+		};
+
+		// Tasks perform a single step per call (capture a face, or filter a mip level), allowing the renderer to spread
+		// the update over multiple frames
 		if (mCustomTexture == nullptr)
 		{
-			auto renderReflProbe = [coreTexture, coreProbe]()
+			auto renderReflProbe = [coreTexture, coreProbe, filterStep, scratch = SPtr<ct::Texture>(), step = 0U]()
+				mutable
 			{
-				float radius = coreProbe->mType == ReflectionProbeType::Sphere ? coreProbe->mRadius :
-					coreProbe->mExtents.length();
+				if (step < 6)
+				{
+					float radius = coreProbe->mType == ReflectionProbeType::Sphere ? coreProbe->mRadius :
+						coreProbe->mExtents.length();
 
-				ct::CaptureSettings settings;
-				settings.encodeDepth = true;
-				settings.depthEncodeNear = radius;
-				settings.depthEncodeFar = radius + 1; // + 1 arbitrary, make it a customizable value?
+					ct::CaptureSettings settings;
+					settings.encodeDepth = true;
+					settings.depthEncodeNear = radius;
+					settings.depthEncodeFar = radius + 1; // + 1 arbitrary, make it a customizable value?
+					settings.firstFace = step;
+					settings.numFaces = 1;
 
-				ct::gRenderer()->captureSceneCubeMap(coreTexture, coreProbe->getTransform().getPosition(), settings);
-				ct::gIBLUtility().filterCubemapForSpecular(coreTexture, nullptr);
+					ct::gRenderer()->captureSceneCubeMap(coreTexture, coreProbe->getTransform().getPosition(),
+						settings);
 
-				coreProbe->mFilteredTexture = coreTexture;
-				ct::gRenderer()->notifyReflectionProbeUpdated(coreProbe.get(), true);
+					step++;
+					return false;
+				}
 
-				return true;
+				return filterStep(scratch, step++ - 6);
 			};
 
 			mRendererTask = ct::RendererTask::create("ReflProbeRender", renderReflProbe);
@@ -129,20 +155,24 @@ namespace bs
 		else
 		{
 			SPtr<ct::Texture> coreCustomTex = mCustomTexture->getCore();
-			auto filterReflProbe = [coreCustomTex, coreTexture, coreProbe]()
+			auto filterReflProbe = [coreCustomTex, coreTexture, filterStep, scratch = SPtr<ct::Texture>(), step = 0U]()
+				mutable
 			{
-				ct::gIBLUtility().scaleCubemap(coreCustomTex, 0, coreTexture, 0);
-				ct::gIBLUtility().filterCubemapForSpecular(coreTexture, nullptr);
+				if (step == 0)
+				{
+					ct::gIBLUtility().scaleCubemap(coreCustomTex, 0, coreTexture, 0);
 
-				coreProbe->mFilteredTexture = coreTexture;
-				ct::gRenderer()->notifyReflectionProbeUpdated(coreProbe.get(), true);
+					step++;
+					return false;
+				}
 
-				return true;
+				return filterStep(scratch, step++ - 1);
 			};
 
 			mRendererTask = ct::RendererTask::create("ReflProbeRender", filterReflProbe);
 		}
 
+		mRendererTask->setTimeSliced(getTransform().getPosition());
 		mRendererTask->onComplete.connect(renderComplete);
 		ct::gRenderer()->addTask(mRendererTask);
 	}
@@ -635,15 +635,31 @@ namespace bs
 
 		if (mAnimType == RenderableAnimType::Morph || mAnimType == RenderableAnimType::SkinnedMorph)
 		{
-			if (mMorphShapeVersion != animInfo->morphShapeInfo.version)
+			const EvaluatedAnimationData::MorphShapeInfo& morphShapeInfo = animInfo->morphShapeInfo;
+			if (mMorphShapeVersion != morphShapeInfo.version)
 			{
-				SPtr<MeshData> meshData = animInfo->morphShapeInfo.meshData;
-
-				UINT32 bufferSize = meshData->getSize();
+				SPtr<MeshData> meshData = morphShapeInfo.meshData;
 				UINT8* data = meshData->getData();
 
-				mMorphShapeBuffer->writeData(0, bufferSize, data, BWT_DISCARD);
-				mMorphShapeVersion = animInfo->morphShapeInfo.version;
+				// If the buffer holds the previous version, only the vertices that changed since need to be uploaded
+				if (mMorphShapeVersion != 0 && (mMorphShapeVersion + 1) == morphShapeInfo.version)
+				{
+					if (morphShapeInfo.dirtyStart < morphShapeInfo.dirtyEnd)
+					{
+						UINT32 stride = meshData->getVertexDesc()->getVertexStride(1);
+						UINT32 offset = morphShapeInfo.dirtyStart * stride;
+						UINT32 size = (morphShapeInfo.dirtyEnd - morphShapeInfo.dirtyStart) * stride;
+
+						mMorphShapeBuffer->writeData(offset, size, data + offset, BWT_NORMAL);
+					}
+				}
+				else
+				{
+					UINT32 bufferSize = meshData->getSize();
+					mMorphShapeBuffer->writeData(0, bufferSize, data, BWT_DISCARD);
+				}
+
+				mMorphShapeVersion = morphShapeInfo.version;
 			}
 		}
 	}
@@ -78,7 +78,8 @@ namespace bs { namespace ct
 		mUnresolvedTasks.push_back(task);
 	}
 
-	void Renderer::processTasks(bool forceAll, UINT64 upToFrame)
+	void Renderer::processTasks(bool forceAll, UINT64 upToFrame, UINT32 timeSlicedBudget,
+		const Vector<Vector3>& viewOrigins)
 	{
 		// Move all tasks to the core thread queue
 		{
@@ -105,23 +106,84 @@ namespace bs { namespace ct
 				if (entry->isCanceled() || entry->isComplete())
 					continue;
 
-				entry->mState.store(1);
-
-				const bool complete = [&entry]()
+				// Time-sliced tasks are executed below, within the budget
+				if (entry->mTimeSliced && !forceAll)
 				{
-					ProfileGPUBlock sampleBlock("Renderer task: " + ProfilerString(entry->mName.data(), entry->mName.size()));
-					return entry->mTaskWorker();
-				}();
+					mRemainingTasks.push_back(entry);
+					continue;
+				}
 
-				if (!complete)
+				if (!executeTaskStep(*entry))
 					mRemainingTasks.push_back(entry);
-				else
-					entry->mState.store(2);
 			}
 
 			mRunningTasks.clear();
 			std::swap(mRemainingTasks, mRunningTasks);
 		} while (forceAll && !mRunningTasks.empty());
+
+		if (forceAll)
+			return;
+
+		// Sort time-sliced tasks so the ones closest to the views execute first. Tasks without a position go before
+		// all others, and tasks at the same distance keep the order they were queued in.
+		for (auto& entry : mRunningTasks)
+		{
+			if (!entry->mTimeSliced)
+				continue;
+
+			float distance = 0.0f;
+			if (!entry->mHasPosition)
+				distance = -1.0f;
+			else if (!viewOrigins.empty())
+			{
+				distance = std::numeric_limits<float>::max();
+				for (auto& origin : viewOrigins)
+					distance = std::min(distance, entry->mPosition.squaredDistance(origin));
+			}
+
+			mTimeSlicedTasks.push_back({ entry.get(), distance });
+		}
+
+		std::stable_sort(mTimeSlicedTasks.begin(), mTimeSlicedTasks.end(),
+			[](const RendererTaskTimeSlicedInfo& a, const RendererTaskTimeSlicedInfo& b)
+		{
+			return a.distance < b.distance;
+		});
+
+		// Spend the budget on the most important task until it completes, before moving to the next one. Completed
+		// tasks are removed from the running list on the next call.
+		UINT32 numSteps = 0;
+		for (auto& entry : mTimeSlicedTasks)
+		{
+			if (timeSlicedBudget != 0 && numSteps >= timeSlicedBudget)
+				break;
+
+			while (timeSlicedBudget == 0 || numSteps < timeSlicedBudget)
+			{
+				numSteps++;
+
+				if (executeTaskStep(*entry.task))
+					break;
+			}
+		}
+
+		mTimeSlicedTasks.clear();
+	}
+
+	bool Renderer::executeTaskStep(RendererTask& task)
+	{
+		task.mState.store(1);
+
+		const bool complete = [&task]()
+		{
+			ProfileGPUBlock sampleBlock("Renderer task: " + ProfilerString(task.mName.data(), task.mName.size()));
+			return task.mTaskWorker();
+		}();
+
+		if (complete)
+			task.mState.store(2);
+
+		return complete;
 	}
 
 	void Renderer::processTask(RendererTask& task, bool forceAll)
@@ -212,4 +274,17 @@ namespace bs { namespace ct
 	{
 		mState.store(3);
 	}
+
+	void RendererTask::setTimeSliced(const Vector3& position)
+	{
+		mTimeSliced = true;
+		mHasPosition = true;
+		mPosition = position;
+	}
+
+	void RendererTask::setTimeSliced()
+	{
+		mTimeSliced = true;
+		mHasPosition = false;
+	}
 }}
@@ -6,6 +6,7 @@
 #include "String/BsStringID.h"
 #include "Renderer/BsRendererMeshData.h"
 #include "Material/BsShaderVariation.h"
+#include "Math/BsVector3.h"
 
 namespace bs
 {
@@ -98,6 +99,15 @@ namespace bs
 		 * Depth will be linearly interpolated between @p depthEncodeNear and this value.
 		 */
 		float depthEncodeFar = 0.0f;
+
+		/**
+		 * Index of the first cubemap face to capture. Together with @p numFaces allows the capture of a cubemap to be
+		 * spread over multiple calls, rendering only a subset of the faces in each.
+		 */
+		UINT32 firstFace = 0;
+
+		/** Number of cubemap faces to capture, starting at @p firstFace. */
+		UINT32 numFaces = 6;
 	};
 
 	/**
@@ -422,16 +432,36 @@ namespace bs
 			UINT64 frameIdx;
 		};
 
+		/** Information about a time-sliced renderer task waiting for its turn to execute. */
+		struct RendererTaskTimeSlicedInfo
+		{
+			RendererTask* task;
+			float distance;
+		};
+
 		/**
 		 * Executes all renderer tasks queued for this frame.
 		 *
-		 * @param[in]	forceAll	If true, multi-frame tasks will be forced to execute fully within this call.
-		 * @param[in]	upToFrame	Only tasks that were queued before or during the frame with the provided index will
-		 *							be processed.
+		 * @param[in]	forceAll			If true, multi-frame tasks will be forced to execute fully within this call.
+		 * @param[in]	upToFrame			Only tasks that were queued before or during the frame with the provided
+		 *									index will be processed.
+		 * @param[in]	timeSlicedBudget	Maximum number of worker calls to make for time-sliced tasks (see
+		 *									RendererTask::setTimeSliced()). Zero for no limit, in which case all
+		 *									time-sliced tasks execute fully. Ignored if @p forceAll is true.
+		 * @param[in]	viewOrigins			Positions of the views that are being rendered. Time-sliced tasks with a
+		 *									position closer to any of the views are executed first.
 		 *
 		 * @note	Core thread.
 		 */
-		void processTasks(bool forceAll, UINT64 upToFrame = std::numeric_limits<UINT64>::max());
+		void processTasks(bool forceAll, UINT64 upToFrame = std::numeric_limits<UINT64>::max(),
+			UINT32 timeSlicedBudget = 0, const Vector<Vector3>& viewOrigins = Vector<Vector3>());
+
+		/**
+		 * Calls the worker of the provided task once. Returns true if the task completed.
+		 *
+		 * @note	Core thread.
+		 */
+		bool executeTaskStep(RendererTask& task);
 
 		/**
 		 * Executes the provided renderer task.
@@ -453,6 +483,7 @@ namespace bs
 		Vector<SPtr<RendererTask>> mRemainingUnresolvedTasks; // Sim thread
 		Vector<SPtr<RendererTask>> mRunningTasks; // Core thread
 		Vector<SPtr<RendererTask>> mRemainingTasks; // Core thread
+		Vector<RendererTaskTimeSlicedInfo> mTimeSlicedTasks; // Core thread
 		Mutex mTaskMutex;
 	};
 
@@ -494,6 +525,24 @@ namespace bs
 		/** Cancels the task and removes it from the Renderer's queue. */
 		void cancel();
 
+		/**
+		 * Marks the task as time-sliced. Each call to the worker of a time-sliced task is expected to perform a small,
+		 * bounded amount of work (e.g. render a single cubemap face) and return false until all of the work is done.
+		 * Instead of calling the worker once per frame, the renderer distributes a fixed number of worker calls per
+		 * frame over all time-sliced tasks, executing the tasks closest to the rendered views first.
+		 *
+		 * Must be called before the task is provided to the Renderer.
+		 *
+		 * @param[in]	position	World position of the content updated by the task, used for prioritizing the task.
+		 */
+		void setTimeSliced(const Vector3& position);
+
+		/**
+		 * Marks the task as time-sliced, without a position. Such tasks execute before the time-sliced tasks that have a
+		 * position. See setTimeSliced(const Vector3&).
+		 */
+		void setTimeSliced();
+
 		/**
 		 * Callback triggered on the sim thread, when the task completes. Is not triggered if the task is cancelled.
 		 *
@@ -507,6 +556,9 @@ namespace bs
 		String mName;
 		std::function<bool()> mTaskWorker;
 		std::atomic<UINT32> mState{0}; /**< 0 - Inactive, 1 - In progress, 2 - Completed, 3 - Canceled */
+		bool mTimeSliced = false;
+		bool mHasPosition = false;
+		Vector3 mPosition = Vector3::ZERO;
 	};
 
 	/** @} */
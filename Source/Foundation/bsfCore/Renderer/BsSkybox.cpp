@@ -75,22 +75,44 @@ namespace bs
 		SPtr<ct::Texture> coreFilteredRadiance = mFilteredRadiance->getCore();
 		SPtr<ct::Texture> coreIrradiance = mIrradiance->getCore();
 
-		auto filterSkybox = [coreFilteredRadiance, coreIrradiance, coreSkybox]()
+		// Performs a single step per call (scale, filter a radiance mip level or generate irradiance), allowing the
+		// renderer to spread the filtering over multiple frames
+		auto filterSkybox = [coreFilteredRadiance, coreIrradiance, coreSkybox, scratch = SPtr<ct::Texture>(),
+			step = 0U]() mutable
 		{
-			// Filter radiance
-			ct::gIBLUtility().scaleCubemap(coreSkybox->getTexture(), 0, coreFilteredRadiance, 0);
-			ct::gIBLUtility().filterCubemapForSpecular(coreFilteredRadiance, nullptr);
+			const UINT32 numRadianceSteps = coreFilteredRadiance->getProperties().getNumMipmaps() + 1;
 
-			coreSkybox->mFilteredRadiance = coreFilteredRadiance;
+			if (step == 0)
+			{
+				ct::gIBLUtility().scaleCubemap(coreSkybox->getTexture(), 0, coreFilteredRadiance, 0);
+				scratch = ct::IBLUtility::createScratchCubemap(coreFilteredRadiance);
+			}
+			else if (step <= numRadianceSteps)
+			{
+				// Filter radiance
+				ct::gIBLUtility().filterCubemapForSpecular(coreFilteredRadiance, scratch, step - 1);
+
+				if (step == numRadianceSteps)
+				{
+					coreSkybox->mFilteredRadiance = coreFilteredRadiance;
+					scratch = nullptr;
+				}
+			}
+			else
+			{
+				// Generate irradiance
+				ct::gIBLUtility().filterCubemapForIrradiance(coreSkybox->getTexture(), coreIrradiance);
+				coreSkybox->mIrradiance = coreIrradiance;
 
-			// Generate irradiance
-			ct::gIBLUtility().filterCubemapForIrradiance(coreSkybox->getTexture(), coreIrradiance);
-			coreSkybox->mIrradiance = coreIrradiance;
+				return true;
+			}
 
-			return true;
+			step++;
+			return false;
 		};
 
 		mRendererTask = ct::RendererTask::create("SkyboxFilter", filterSkybox);
+		mRendererTask->setTimeSliced();
 
 		mRendererTask->onComplete.connect(renderComplete);
 		ct::gRenderer()->addTask(mRendererTask);
@@ -0,0 +1,285 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#include "Resources/BsResourceArchive.h"
+#include "Resources/BsResourceManifest.h"
+#include "FileSystem/BsFileSystem.h"
+#include "FileSystem/BsDataStream.h"
+#include "Utility/BsCompression.h"
+#include "Debug/BsDebug.h"
+#include "Math/BsMath.h"
+#include "Utility/BsBitwise.h"
+
+namespace bs
+{
+	constexpr UINT32 ResourceArchive::MAGIC;
+	constexpr UINT32 ResourceArchive::VERSION;
+
+	ResourceArchive::ResourceArchive(const PrivatelyConstruct& dummy, const Path& path)
+		:mPath(path)
+	{ }
+
+	SPtr<ResourceArchive> ResourceArchive::open(const Path& path)
+	{
+		if (!FileSystem::isFile(path))
+		{
+			BS_LOG(Warning, Resources, "Cannot open resource archive. Specified file: '{0}' doesn't exist.", path);
+			return nullptr;
+		}
+
+		SPtr<DataStream> stream = FileSystem::openFile(path, true);
+		if (stream == nullptr)
+			return nullptr;
+
+		Header header;
+		if (stream->read(&header, sizeof(header)) != sizeof(header) || header.magic != MAGIC)
+		{
+			BS_LOG(Error, Resources, "Cannot open resource archive. File '{0}' is not a valid archive.", path);
+			return nullptr;
+		}
+
+		if (header.version != VERSION)
+		{
+			BS_LOG(Error, Resources, "Cannot open resource archive '{0}'. Unsupported version {1}, expected {2}.", path,
+				header.version, VERSION);
+			return nullptr;
+		}
+
+		SPtr<ResourceArchive> archive = bs_shared_ptr_new<ResourceArchive>(PrivatelyConstruct(), path);
+		archive->mChunkSize = header.chunkSize;
+		archive->mEntries.resize(header.numEntries);
+		archive->mChunks.resize(header.numChunks);
+
+		const size_t entriesSize = header.numEntries * sizeof(Entry);
+		const size_t chunksSize = header.numChunks * sizeof(Chunk);
+		if (stream->read(archive->mEntries.data(), entriesSize) != entriesSize ||
+			stream->read(archive->mChunks.data(), chunksSize) != chunksSize)
+		{
+			BS_LOG(Error, Resources, "Cannot open resource archive. Table of contents in '{0}' is truncated.", path);
+			return nullptr;
+		}
+
+		archive->mStream = stream;
+		return archive;
+	}
+
+	const ResourceArchive::Entry* ResourceArchive::findEntry(const UUID& uuid) const
+	{
+		auto iterFind = std::lower_bound(mEntries.begin(), mEntries.end(), uuid,
+			[](const Entry& entry, const UUID& value) { return entry.uuid < value; });
+
+		if (iterFind == mEntries.end() || iterFind->uuid != uuid)
+			return nullptr;
+
+		return &*iterFind;
+	}
+
+	UINT64 ResourceArchive::getSize(const UUID& uuid) const
+	{
+		const Entry* entry = findEntry(uuid);
+		if (entry == nullptr)
+			return 0;
+
+		return entry->size;
+	}
+
+	SPtr<MemoryDataStream> ResourceArchive::read(const UUID& uuid, UINT64 maxSize) const
+	{
+		const Entry* entry = findEntry(uuid);
+		if (entry == nullptr)
+			return nullptr;
+
+		// Determine which chunks cover the requested range
+		UINT32 numChunks = 0;
+		UINT64 readSize = 0;
+		UINT64 storedSize = 0;
+		bool anyCompressed = false;
+		while (numChunks < entry->numChunks && readSize < std::min(maxSize, entry->size))
+		{
+			const Chunk& chunk = mChunks[entry->firstChunk + numChunks];
+			readSize += chunk.size;
+			storedSize += chunk.storedSize;
+			anyCompressed |= chunk.storedSize < chunk.size;
+
+			numChunks++;
+		}
+
+		SPtr<MemoryDataStream> output = bs_shared_ptr_new<MemoryDataStream>((size_t)readSize);
+
+		// Uncompressed data can be read directly into the output, otherwise read into a staging buffer and decompress
+		UINT8* storedData = anyCompressed ? (UINT8*)bs_alloc((UINT32)storedSize) : output->data();
+		bool readFailed;
+		{
+			Lock lock(mMutex);
+
+			mStream->seek((size_t)entry->offset);
+			readFailed = mStream->read(storedData, (size_t)storedSize) != storedSize;
+		}
+
+		if (!readFailed && anyCompressed)
+		{
+			UINT8* dst = output->data();
+			UINT8* src = storedData;
+			for (UINT32 i = 0; i < numChunks; i++)
+			{
+				const Chunk& chunk = mChunks[entry->firstChunk + i];
+				if (chunk.storedSize < chunk.size)
+				{
+					auto chunkStream = bs_shared_ptr_new<MemoryDataStream>(src, chunk.storedSize);
+					SPtr<MemoryDataStream> decompressed = Compression::decompress(chunkStream);
+					if (decompressed == nullptr || decompressed->size() != chunk.size)
+					{
+						readFailed = true;
+						break;
+					}
+
+					memcpy(dst, decompressed->data(), chunk.size);
+				}
+				else
+					memcpy(dst, src, chunk.size);
+
+				src += chunk.storedSize;
+				dst += chunk.size;
+			}
+		}
+
+		if (anyCompressed)
+			bs_free(storedData);
+
+		if (readFailed)
+		{
+			BS_LOG(Error, Resources, "Failed reading resource '{0}' from archive '{1}'. The archive is corrupt.", uuid,
+				mPath);
+			return nullptr;
+		}
+
+		return output;
+	}
+
+	ResourceArchiveWriter::ResourceArchiveWriter(bool compress, UINT32 alignment, UINT32 chunkSize)
+		:mCompress(compress), mAlignment(std::max(alignment, 1U)), mChunkSize(chunkSize)
+	{
+		assert(Bitwise::isPow2(mAlignment));
+	}
+
+	void ResourceArchiveWriter::addFile(const UUID& uuid, const Path& filePath)
+	{
+		mFiles[uuid] = filePath;
+	}
+
+	void ResourceArchiveWriter::addManifest(const SPtr<ResourceManifest>& manifest)
+	{
+		for (auto& entry : manifest->getEntries())
+			addFile(entry.first, entry.second);
+	}
+
+	bool ResourceArchiveWriter::write(const Path& path) const
+	{
+		// Chunk counts are known from file sizes alone, so the tables can be sized before any data is compressed. Tables
+		// are written last, once the compressed chunk sizes are known.
+		Vector<std::pair<ResourceArchive::Entry, Path>> entries;
+		entries.reserve(mFiles.size());
+
+		UINT32 numChunks = 0;
+		for (auto& file : mFiles) // Map is ordered, so entries end up sorted by UUID
+		{
+			if (!FileSystem::isFile(file.second))
+			{
+				BS_LOG(Warning, Resources, "Skipping resource '{0}' while writing archive. File '{1}' doesn't exist.",
+					file.first, file.second);
+				continue;
+			}
+
+			ResourceArchive::Entry entry;
+			entry.uuid = file.first;
+			entry.offset = 0;
+			entry.size = FileSystem::getFileSize(file.second);
+			entry.firstChunk = numChunks;
+			entry.numChunks = (UINT32)Math::divideAndRoundUp(entry.size, (UINT64)mChunkSize);
+
+			numChunks += entry.numChunks;
+			entries.push_back(std::make_pair(entry, file.second));
+		}
+
+		SPtr<DataStream> output = FileSystem::createAndOpenFile(path);
+		if (output == nullptr)
+		{
+			BS_LOG(Error, Resources, "Cannot write resource archive. Failed creating file '{0}'.", path);
+			return false;
+		}
+
+		ResourceArchive::Header header;
+		header.magic = ResourceArchive::MAGIC;
+		header.version = ResourceArchive::VERSION;
+		header.numEntries = (UINT32)entries.size();
+		header.numChunks = numChunks;
+		header.chunkSize = mChunkSize;
+		header.alignment = mAlignment;
+
+		UINT64 offset = sizeof(header) + header.numEntries * sizeof(ResourceArchive::Entry) +
+			numChunks * sizeof(ResourceArchive::Chunk);
+
+		Vector<ResourceArchive::Chunk> chunks(numChunks);
+		SPtr<MemoryDataStream> chunkData = bs_shared_ptr_new<MemoryDataStream>(mChunkSize);
+		const UINT8 padding[256] = { };
+
+		for (auto& entry : entries)
+		{
+			// Pad up to the aligned start of the entry data
+			const UINT64 alignedOffset = Math::divideAndRoundUp(offset, (UINT64)mAlignment) * mAlignment;
+			output->seek((size_t)offset);
+			for (UINT64 paddingSize = alignedOffset - offset; paddingSize > 0; )
+			{
+				const size_t writeSize = (size_t)std::min(paddingSize, (UINT64)sizeof(padding));
+				output->write(padding, writeSize);
+				paddingSize -= writeSize;
+			}
+
+			offset = alignedOffset;
+			entry.first.offset = offset;
+
+			SPtr<DataStream> stream = FileSystem::openFile(entry.second, true);
+			for (UINT32 i = 0; i < entry.first.numChunks; i++)
+			{
+				const UINT32 size = (UINT32)std::min(entry.first.size - (UINT64)i * mChunkSize, (UINT64)mChunkSize);
+				if (stream == nullptr || stream->read(chunkData->data(), size) != size)
+				{
+					BS_LOG(Error, Resources, "Cannot write resource archive. Failed reading file '{0}'.", entry.second);
+					output->close();
+					return false;
+				}
+
+				const UINT8* data = chunkData->data();
+				UINT32 storedSize = size;
+
+				SPtr<MemoryDataStream> compressed;
+				if (mCompress)
+				{
+					compressed = Compression::compress(bs_shared_ptr_new<MemoryDataStream>(chunkData->data(), size));
+					if (compressed->size() < size)
+					{
+						data = compressed->data();
+						storedSize = (UINT32)compressed->size();
+					}
+				}
+
+				output->write(data, storedSize);
+				chunks[entry.first.firstChunk + i] = { storedSize, size };
+				offset += storedSize;
+			}
+
+			if (stream != nullptr)
+				stream->close();
+		}
+
+		output->seek(0);
+		output->write(&header, sizeof(header));
+
+		for (auto& entry : entries)
+			output->write(&entry.first, sizeof(entry.first));
+
+		output->write(chunks.data(), chunks.size() * sizeof(ResourceArchive::Chunk));
+		output->close();
+
+		return true;
+	}
+}
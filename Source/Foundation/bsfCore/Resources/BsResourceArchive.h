@@ -0,0 +1,163 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "BsCorePrerequisites.h"
+#include "Utility/BsUUID.h"
+
+namespace bs
+{
+	/** @addtogroup Resources-Internal
+	 *  @{
+	 */
+
+	/**
+	 * Read-only archive containing data of multiple resources packed in a single file. Each entry contains the same
+	 * data as a resource file saved through Resources::save, and is identified by the resource's UUID.
+	 *
+	 * The archive starts with a header, followed by a table of contents sorted by UUID and a table of chunks. Entry data
+	 * is split into chunks of a fixed uncompressed size, each of which can be individually compressed. This allows parts
+	 * of an entry to be read without decompressing the entire entry. Data of each entry starts at an offset aligned to
+	 * the alignment specified when the archive was written, and entries with no compressed chunks are stored contiguously
+	 * so they can be read (or mapped) directly.
+	 *
+	 * Archives are created with ResourceArchiveWriter, and are usually mounted through Resources::mountArchive, after
+	 * which resources stored within are loaded transparently when requested by UUID.
+	 *
+	 * @note	Thread safe.
+	 */
+	class BS_CORE_EXPORT ResourceArchive
+	{
+		struct PrivatelyConstruct {};
+
+		/** Entry in the archive's table of contents. */
+		struct Entry
+		{
+			UUID uuid;
+			UINT64 offset;
+			UINT64 size;
+			UINT32 firstChunk;
+			UINT32 numChunks;
+		};
+
+		/** Information about a single chunk of entry data. */
+		struct Chunk
+		{
+			/** Size of the chunk as stored in the archive. Chunk is compressed if this is smaller than @p size. */
+			UINT32 storedSize;
+
+			/** Size of the chunk's data once decompressed. */
+			UINT32 size;
+		};
+
+	public:
+		/** Identifier written at the start of every archive file. */
+		static constexpr UINT32 MAGIC = 0x41525342; // "BSRA"
+
+		/** Version of the archive format, incremented whenever the layout changes. */
+		static constexpr UINT32 VERSION = 1;
+
+		ResourceArchive(const PrivatelyConstruct& dummy, const Path& path);
+
+		/**
+		 * Opens an archive at the specified path and reads its table of contents. Returns null if the file doesn't exist
+		 * or isn't a valid archive.
+		 */
+		static SPtr<ResourceArchive> open(const Path& path);
+
+		/** Checks does the archive contain an entry for a resource with the specified UUID. */
+		bool contains(const UUID& uuid) const { return findEntry(uuid) != nullptr; }
+
+		/**
+		 * Reads the data of the entry with the provided UUID, decompressing it if required.
+		 *
+		 * @param[in]	uuid		UUID of the resource whose data to read.
+		 * @param[in]	maxSize		Maximum number of bytes to read from the start of the entry. Only the chunks required
+		 *							for the requested range will be read and decompressed. The returned stream might
+		 *							contain more data than requested, up to the end of the last read chunk.
+		 * @return					Stream containing the entry data, or null if the entry doesn't exist or the data is
+		 *							corrupt.
+		 */
+		SPtr<MemoryDataStream> read(const UUID& uuid, UINT64 maxSize = std::numeric_limits<UINT64>::max()) const;
+
+		/** Returns the uncompressed size of the entry with the provided UUID, or 0 if the entry doesn't exist. */
+		UINT64 getSize(const UUID& uuid) const;
+
+		/** Returns the number of entries in the archive. */
+		UINT32 getNumEntries() const { return (UINT32)mEntries.size(); }
+
+		/** Returns the UUID of the entry at the specified index. Entries are sorted by their UUID. */
+		const UUID& getUUID(UINT32 idx) const { return mEntries[idx].uuid; }
+
+		/** Returns the path of the archive file. */
+		const Path& getPath() const { return mPath; }
+
+	private:
+		friend class ResourceArchiveWriter;
+
+		/** Header at the start of an archive file. */
+		struct Header
+		{
+			UINT32 magic;
+			UINT32 version;
+			UINT32 numEntries;
+			UINT32 numChunks;
+			UINT32 chunkSize;
+			UINT32 alignment;
+		};
+
+		/** Finds the entry with the provided UUID using a binary search on the table of contents. */
+		const Entry* findEntry(const UUID& uuid) const;
+
+		Path mPath;
+		Vector<Entry> mEntries;
+		Vector<Chunk> mChunks;
+		UINT32 mChunkSize = 0;
+
+		mutable Mutex mMutex;
+		SPtr<DataStream> mStream;
+	};
+
+	/** Builds a ResourceArchive from a set of resource files. */
+	class BS_CORE_EXPORT ResourceArchiveWriter
+	{
+	public:
+		/**
+		 * Constructs a new archive writer.
+		 *
+		 * @param[in]	compress	If true, chunks of entry data will be compressed, unless compression fails to make them
+		 *							smaller.
+		 * @param[in]	alignment	Alignment of each entry's data in the archive file, in bytes. Must be a power of two.
+		 *							Use the system page size if the archive is to be memory mapped.
+		 * @param[in]	chunkSize	Size of the uncompressed chunks entry data is split in, in bytes. Smaller chunks allow
+		 *							finer grained partial reads, at a cost of compression ratio.
+		 */
+		ResourceArchiveWriter(bool compress = true, UINT32 alignment = 16, UINT32 chunkSize = 64 * 1024);
+
+		/**
+		 * Registers a resource file to be stored in the archive. The file is expected to be saved with Resources::save.
+		 * If an entry with the same UUID was already registered, it is replaced.
+		 */
+		void addFile(const UUID& uuid, const Path& filePath);
+
+		/** Registers all the resources in the provided manifest to be stored in the archive. */
+		void addManifest(const SPtr<ResourceManifest>& manifest);
+
+		/** Returns the number of registered entries. */
+		UINT32 getNumEntries() const { return (UINT32)mFiles.size(); }
+
+		/**
+		 * Writes the archive containing all the registered resources to the specified path, overwriting any existing
+		 * file. Returns false if the archive couldn't be written. Files that can't be read are skipped with a warning.
+		 */
+		bool write(const Path& path) const;
+
+	private:
+		bool mCompress;
+		UINT32 mAlignment;
+		UINT32 mChunkSize;
+		Map<UUID, Path> mFiles;
+	};
+
+	/** @} */
+}
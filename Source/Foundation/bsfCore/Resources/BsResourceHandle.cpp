@@ -42,7 +42,8 @@ namespace bs
 				ResourceListenerManager::instance().notifyListeners(mData->mUUID);
 		}
 
-		if (waitForDependencies)
+		// Resource might have failed to load, in which case there are no dependencies to wait on
+		if (waitForDependencies && mData->mPtr != nullptr)
 		{
 			bs_frame_mark();
 
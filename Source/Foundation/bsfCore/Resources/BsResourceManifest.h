@@ -62,6 +62,9 @@ namespace bs
 		BS_SCRIPT_EXPORT()
 		bool filePathExists(const Path& filePath) const;
 
+		/**	Returns all the UUID to file path mappings registered in the manifest. */
+		const UnorderedMap<UUID, Path>& getEntries() const { return mUUIDToFilePath; }
+
 		/**
 		 * Saves the resource manifest to the specified location.
 		 *
@@ -0,0 +1,78 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#include "BsCorePrerequisites.h"
+#include "Resources/BsResourceArchive.h"
+#include "Resources/BsResourceManifest.h"
+#include "FileSystem/BsFileSystem.h"
+#include "Allocators/BsStackAlloc.h"
+#include "Utility/BsBitwise.h"
+
+/**
+ * Packs all resources registered in one or multiple resource manifests into a single resource archive.
+ *
+ * Usage: bsfPackTool <output archive> <manifest>... [--no-compress] [--alignment <bytes>] [--chunk-size <bytes>]
+ *
+ * File paths in the manifests are expected to be relative to the folder containing the manifest, as saved by the
+ * builtin resource importer.
+ */
+int main(int argc, char * argv[])
+{
+	using namespace bs;
+
+	if(argc < 3)
+	{
+		printf("Usage: bsfPackTool <output archive> <manifest>... [--no-compress] [--alignment <bytes>] "
+			"[--chunk-size <bytes>]\n");
+		return 2;
+	}
+
+	MemStack::beginThread();
+
+	Path outputPath = argv[1];
+	Vector<Path> manifestPaths;
+	bool compress = true;
+	UINT32 alignment = 16;
+	UINT32 chunkSize = 64 * 1024;
+
+	for(int i = 2; i < argc; i++)
+	{
+		if(strcmp(argv[i], "--no-compress") == 0)
+			compress = false;
+		else if(strcmp(argv[i], "--alignment") == 0 && i + 1 < argc)
+			alignment = (UINT32)atoi(argv[++i]);
+		else if(strcmp(argv[i], "--chunk-size") == 0 && i + 1 < argc)
+			chunkSize = (UINT32)atoi(argv[++i]);
+		else
+			manifestPaths.push_back(argv[i]);
+	}
+
+	if(alignment == 0 || !Bitwise::isPow2(alignment) || chunkSize == 0)
+	{
+		printf("Alignment must be a power of two, and chunk size must be non-zero.\n");
+
+		MemStack::endThread();
+		return 2;
+	}
+
+	ResourceArchiveWriter writer(compress, alignment, chunkSize);
+	for(auto& manifestPath : manifestPaths)
+	{
+		if(!FileSystem::isFile(manifestPath))
+		{
+			printf("Manifest %s doesn't exist.\n", manifestPath.toString().c_str());
+
+			MemStack::endThread();
+			return 1;
+		}
+
+		SPtr<ResourceManifest> manifest = ResourceManifest::load(manifestPath, manifestPath.getParent());
+		writer.addManifest(manifest);
+	}
+
+	const bool success = writer.write(outputPath);
+	if(success)
+		printf("Packed %u resources into %s.\n", writer.getNumEntries(), outputPath.toString().c_str());
+
+	MemStack::endThread();
+	return success ? 0 : 1;
+}
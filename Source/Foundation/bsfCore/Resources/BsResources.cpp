@@ -3,6 +3,7 @@
 #include "Resources/BsResources.h"
 #include "Resources/BsResource.h"
 #include "Resources/BsResourceManifest.h"
+#include "Resources/BsResourceArchive.h"
 #include "Error/BsException.h"
 #include "Serialization/BsFileSerializer.h"
 #include "FileSystem/BsFileSystem.h"
@@ -16,10 +17,20 @@
 #include "FileSystem/BsDataStream.h"
 #include "Serialization/BsBinarySerializer.h"
 #include "Reflection/BsRTTIType.h"
+#include "Debug/BsStartupTrace.h"
 #include "BsCoreApplication.h"
 
 namespace bs
 {
+	/**
+	 * Checks if the calling thread is the sim thread. Always false if there is no running application, in which case
+	 * there is nothing to notify of loaded resources.
+	 */
+	static bool isSimThread()
+	{
+		return CoreApplication::isStarted() && BS_THREAD_CURRENT_ID == gCoreApplication().getSimThreadId();
+	}
+
 	Resources::Resources()
 	{
 		{
@@ -95,6 +106,7 @@ namespace bs
 		bool loadFailed = false;
 		bool initiateLoad = false;
 		Vector<UUID> dependenciesToLoad;
+		SPtr<ResourceArchive> archive;
 		{
 			bool alreadyLoading = false;
 
@@ -156,28 +168,42 @@ namespace bs
 				}
 			}
 
+			// Resources with no file on disk can still be provided by a mounted archive
+			const bool fileExists = !filePath.isEmpty() && FileSystem::isFile(filePath);
+			if (!fileExists)
+				archive = findArchive(uuid);
+
 			// If we have nowhere to load from, warn and complete load if a file path was provided, otherwise pass through
 			// as we might just want to complete a previously queued load
-			if (filePath.isEmpty())
+			if (archive == nullptr)
 			{
-				if (!alreadyLoading)
+				if (filePath.isEmpty())
 				{
-					BS_LOG(Verbose, Resources, "Cannot load resource. Resource with UUID '{0}' doesn't exist.", uuid);
+					if (!alreadyLoading)
+					{
+						BS_LOG(Verbose, Resources, "Cannot load resource. Resource with UUID '{0}' doesn't exist.", uuid);
+						loadFailed = true;
+					}
+				}
+				else if (!fileExists)
+				{
+					BS_LOG(Verbose, Resources, "Cannot load resource. Specified file: '{0}' doesn't exist.", filePath);
 					loadFailed = true;
 				}
 			}
-			else if (!FileSystem::isFile(filePath))
-			{
-				BS_LOG(Verbose, Resources, "Cannot load resource. Specified file: '{0}' doesn't exist.", filePath);
-				loadFailed = true;
-			}
 
 			bool loadDependencies = loadFlags.isSet(ResourceLoadFlag::LoadDependencies);
 			if(!loadFailed)
 			{
 				// Load dependency data if a file path is provided
 				SPtr<SavedResourceData> savedResourceData;
-				if (!filePath.isEmpty())
+				SPtr<DataStream> archiveData;
+				if (archive != nullptr)
+				{
+					savedResourceData = readArchiveMetaData(*archive, uuid, archiveData);
+					output.size = (UINT32)archive->getSize(uuid);
+				}
+				else if (!filePath.isEmpty())
 				{
 					// Note: Ideally this data gets cached eventually (e.g. as part of the manifest). When loading objects
 					// with a lot of dependencies (e.g. scenes) this will get called for every dependency, synchronously,
@@ -203,9 +229,10 @@ namespace bs
 
 					loadData->remainingDependencies = 1; // Self
 					loadData->progress.store(0.0f, std::memory_order_relaxed);
+					loadData->archiveData = archiveData;
 
 					// Make resource listener trigger before exit if loading synchronously on the main thread
-					loadData->notifyImmediately = synchronous && BS_THREAD_CURRENT_ID == gCoreApplication().getSimThreadId();
+					loadData->notifyImmediately = synchronous && isSimThread();
 
 					// Register dependencies and count them so we know when the resource is fully loaded
 					if (loadDependencies && savedResourceData != nullptr)
@@ -237,7 +264,7 @@ namespace bs
 							loadData->progress.store(0.0f, std::memory_order_relaxed);
 
 							// Make resource listener trigger before exit if loading synchronously
-							loadData->notifyImmediately = synchronous && BS_THREAD_CURRENT_ID == gCoreApplication().getSimThreadId();
+							loadData->notifyImmediately = synchronous && isSimThread();
 						}
 						else
 							loadData = mInProgressResources[uuid];
@@ -287,7 +314,7 @@ namespace bs
 					}
 				}
 
-				initiateLoad = !alreadyLoading && !filePath.isEmpty();
+				initiateLoad = !alreadyLoading && (!filePath.isEmpty() || archive != nullptr);
 
 				if(savedResourceData != nullptr)
 					synchronous = synchronous || !savedResourceData->allowAsyncLoading();
@@ -387,16 +414,16 @@ namespace bs
 			// Synchronous or the resource doesn't support async, read the file immediately
 			if (synchronous)
 			{
-				loadCallback(filePath, output.resource, loadFlags.isSet(ResourceLoadFlag::KeepSourceData));
+				loadCallback(filePath, archive, output.resource, loadFlags.isSet(ResourceLoadFlag::KeepSourceData));
 			}
 			else // Asynchronous, read the file on a worker thread
 			{
-				String fileName = filePath.getFilename();
+				String fileName = archive != nullptr ? uuid.toString() : filePath.getFilename();
 				String taskName = "Resource load: " + fileName;
 
 				bool keepSourceData = loadFlags.isSet(ResourceLoadFlag::KeepSourceData);
 				SPtr<Task> task = Task::create(taskName,
-					std::bind(&Resources::loadCallback, this, filePath, output.resource, keepSourceData));
+					std::bind(&Resources::loadCallback, this, filePath, archive, output.resource, keepSourceData));
 
 				// Register the task
 				{
@@ -432,6 +459,17 @@ namespace bs
 		if (stream == nullptr)
 			return nullptr;
 
+		SPtr<Resource> resource = deserialize(stream, loadWithSaveData, progress);
+		if (resource == nullptr)
+			BS_LOG(Error, Resources, "Unable to load resource at path \"{0}\"", filePath);
+
+		return resource;
+	}
+
+	SPtr<Resource> Resources::deserialize(const SPtr<DataStream>& dataStream, bool loadWithSaveData,
+		std::atomic<float>& progress)
+	{
+		SPtr<DataStream> stream = dataStream;
 		if (stream->size() > std::numeric_limits<UINT32>::max())
 		{
 			BS_EXCEPT(InternalErrorException,
@@ -488,13 +526,8 @@ namespace bs
 			}
 		}
 
-		if (loadedData == nullptr)
-			BS_LOG(Error, Resources, "Unable to load resource at path \"{0}\"", filePath);
-		else
-		{
-			if (!loadedData->isDerivedFrom(Resource::getRTTIStatic()))
-				BS_EXCEPT(InternalErrorException, "Loaded class doesn't derive from Resource.");
-		}
+		if (loadedData != nullptr && !loadedData->isDerivedFrom(Resource::getRTTIStatic()))
+			BS_EXCEPT(InternalErrorException, "Loaded class doesn't derive from Resource.");
 
 		SPtr<Resource> resource = std::static_pointer_cast<Resource>(loadedData);
 		return resource;
@@ -988,6 +1021,72 @@ namespace bs
 		return false;
 	}
 
+	SPtr<ResourceArchive> Resources::mountArchive(const Path& path)
+	{
+		SPtr<ResourceArchive> archive = ResourceArchive::open(path);
+		if (archive == nullptr)
+			return nullptr;
+
+		Lock lock(mArchivesMutex);
+		mArchives.push_back(archive);
+
+		return archive;
+	}
+
+	void Resources::unmountArchive(const SPtr<ResourceArchive>& archive)
+	{
+		Lock lock(mArchivesMutex);
+
+		auto iterFind = std::find(mArchives.begin(), mArchives.end(), archive);
+		if (iterFind != mArchives.end())
+			mArchives.erase(iterFind);
+	}
+
+	SPtr<ResourceArchive> Resources::findArchive(const UUID& uuid) const
+	{
+		Lock lock(mArchivesMutex);
+
+		for (auto iter = mArchives.rbegin(); iter != mArchives.rend(); ++iter)
+		{
+			if ((*iter)->contains(uuid))
+				return *iter;
+		}
+
+		return nullptr;
+	}
+
+	SPtr<SavedResourceData> Resources::readArchiveMetaData(const ResourceArchive& archive, const UUID& uuid,
+		SPtr<DataStream>& entryData)
+	{
+		// Meta-data is stored at the start of the entry, and usually fits in the first chunk
+		SPtr<MemoryDataStream> stream = archive.read(uuid, sizeof(UINT32));
+		if (stream == nullptr)
+			return nullptr;
+
+		UINT32 objectSize = 0;
+		stream->read(&objectSize, sizeof(objectSize));
+
+		if (stream->size() < sizeof(objectSize) + objectSize)
+		{
+			stream = archive.read(uuid, sizeof(objectSize) + objectSize);
+			if (stream == nullptr)
+				return nullptr;
+
+			stream->skip(sizeof(objectSize));
+		}
+
+		BinarySerializer bs;
+		SPtr<IReflectable> metaData = bs.decode(stream, objectSize);
+
+		if (stream->size() == archive.getSize(uuid))
+		{
+			stream->seek(0);
+			entryData = stream;
+		}
+
+		return std::static_pointer_cast<SavedResourceData>(metaData);
+	}
+
 	bool Resources::getUUIDFromFilePath(const Path& path, UUID& uuid) const
 	{
 		Path manifestPath = path;
@@ -1070,7 +1169,8 @@ namespace bs
 		}
 	}
 
-	void Resources::loadCallback(const Path& filePath, HResource& resource, bool loadWithSaveData)
+	void Resources::loadCallback(const Path& filePath, const SPtr<ResourceArchive>& archive, HResource& resource,
+		bool loadWithSaveData)
 	{
 		ResourceLoadData* myLoadData;
 		{
@@ -1078,7 +1178,39 @@ namespace bs
 			myLoadData = mInProgressResources[resource.getUUID()];
 		}
 
-		SPtr<Resource> rawResource = loadFromDiskAndDeserialize(filePath, loadWithSaveData, myLoadData->progress);
+		const UINT64 startTime = StartupTrace::getTime();
+
+		SPtr<Resource> rawResource;
+		if (archive != nullptr)
+		{
+			const UUID& uuid = resource.getUUID();
+
+			// Reuse the entry data if it was fully read along with the meta-data
+			SPtr<DataStream> stream = myLoadData->archiveData;
+			myLoadData->archiveData = nullptr;
+
+			if (stream == nullptr)
+				stream = archive->read(uuid);
+
+			if (stream != nullptr)
+				rawResource = deserialize(stream, loadWithSaveData, myLoadData->progress);
+
+			if (rawResource == nullptr)
+				BS_LOG(Error, Resources, "Unable to load resource '{0}' from archive \"{1}\"", uuid, archive->getPath());
+		}
+		else
+			rawResource = loadFromDiskAndDeserialize(filePath, loadWithSaveData, myLoadData->progress);
+
+		if (StartupTrace::isRecording())
+		{
+			String name;
+			if (archive != nullptr)
+				name = archive->getPath().getFilename() + ":" + resource.getUUID().toString();
+			else
+				name = filePath.toString();
+
+			StartupTrace::record(StartupEventType::Resource, name, startTime);
+		}
 
 		{
 			Lock lock(mInProgressResourcesMutex);
@@ -74,6 +74,9 @@ namespace bs
 			bool loadStarted = false;
 			SPtr<Task> task;
 
+			// Entry data already read from a resource archive, if any
+			SPtr<DataStream> archiveData;
+
 			// Progress reporting
 			UINT32 dependencySize = 0;
 			UINT32 dependencyLoadedAmount = 0;
@@ -306,6 +309,20 @@ namespace bs
 		BS_SCRIPT_EXPORT()
 		bool getUUIDFromFilePath(const Path& path, UUID& uuid) const;
 
+		/**
+		 * Mounts a resource archive, allowing the resources stored within to be loaded by their UUID, either directly
+		 * through loadFromUUID() or as dependencies of other resources. Resources registered in a manifest whose files
+		 * exist on disk are still loaded from those files. If multiple mounted archives contain the same resource, the
+		 * most recently mounted archive is used.
+		 *
+		 * @param[in]	path	Path to an archive created with ResourceArchiveWriter.
+		 * @return				Mounted archive, or null if the archive couldn't be opened.
+		 */
+		SPtr<ResourceArchive> mountArchive(const Path& path);
+
+		/** Unmounts an archive previously mounted with mountArchive(). Already loaded resources remain loaded. */
+		void unmountArchive(const SPtr<ResourceArchive>& archive);
+
 		/**
 		 * Called when the resource has been successfully loaded.
 		 *
@@ -374,11 +391,29 @@ namespace bs
 		/** Performs actually reading and deserializing of the resource file. Called from various worker threads. */
 		SPtr<Resource> loadFromDiskAndDeserialize(const Path& filePath, bool loadWithSaveData, std::atomic<float>& progress);
 
+		/**
+		 * Deserializes a resource from a stream containing the same data as a resource file. Returns null if the data
+		 * is invalid.
+		 */
+		SPtr<Resource> deserialize(const SPtr<DataStream>& stream, bool loadWithSaveData, std::atomic<float>& progress);
+
+		/**
+		 * Reads resource meta-data from the start of an archive entry. Only the part of the entry containing the
+		 * meta-data is read. If that happens to be the entire entry, the read data is returned in @p entryData so it can
+		 * be reused when loading the resource.
+		 */
+		SPtr<SavedResourceData> readArchiveMetaData(const ResourceArchive& archive, const UUID& uuid,
+			SPtr<DataStream>& entryData);
+
+		/** Returns the most recently mounted archive containing the resource with the provided UUID, if any. */
+		SPtr<ResourceArchive> findArchive(const UUID& uuid) const;
+
 		/**	Triggered when individual resource has finished loading. */
 		void loadComplete(HResource& resource, bool notifyProgress);
 
 		/**	Callback triggered when the task manager is ready to process the loading task. */
-		void loadCallback(const Path& filePath, HResource& resource, bool loadWithSaveData);
+		void loadCallback(const Path& filePath, const SPtr<ResourceArchive>& archive, HResource& resource,
+			bool loadWithSaveData);
 
 		/**	Destroys a resource, freeing its memory. */
 		void destroy(ResourceHandleBase& resource);
@@ -386,10 +421,12 @@ namespace bs
 	private:
 		Vector<SPtr<ResourceManifest>> mResourceManifests;
 		SPtr<ResourceManifest> mDefaultResourceManifest;
+		Vector<SPtr<ResourceArchive>> mArchives;
 
 		Mutex mInProgressResourcesMutex;
 		Mutex mLoadedResourceMutex;
 		Mutex mDefaultManifestMutex;
+		mutable Mutex mArchivesMutex;
 		RecursiveMutex mDestroyMutex;
 
 		UnorderedMap<UUID, WeakResourceHandle<Resource>> mHandles;
@@ -20,7 +20,27 @@ namespace bs
 		 * Note that this flag must be specified on component creation, in its constructor and any later changes
 		 * to the flag could be ignored.
 		 */
-		AlwaysRun = 1
+		AlwaysRun = 1 << 0,
+
+		/**
+		 * Disables calls to update() for the component. Set this on components that don't implement update() so the scene
+		 * manager can skip them entirely. Must be specified in the component constructor.
+		 */
+		NoUpdate = 1 << 1,
+
+		/**
+		 * Disables calls to fixedUpdate() for the component. Set this on components that don't implement fixedUpdate() so
+		 * the scene manager can skip them entirely. Must be specified in the component constructor.
+		 */
+		NoFixedUpdate = 1 << 2,
+
+		/**
+		 * Allows update() and fixedUpdate() to be called on worker threads, concurrently with other components of the
+		 * same type that also have this flag set. Such components must only modify state they own, and must not create,
+		 * destroy, enable or disable any scene objects or components from those methods. Must be specified in the
+		 * component constructor.
+		 */
+		ParallelUpdate = 1 << 3
 	};
 
 	typedef Flags<ComponentFlag> ComponentFlags;
@@ -165,6 +185,17 @@ namespace bs
 		/** Returns an index that unique identifies a component with the SceneManager. */
 		UINT32 getSceneManagerId() const { return mSceneManagerId; }
 
+		/**
+		 * Sets an index that identifies a component within one of the SceneManager's per-type update lists.
+		 *
+		 * @param[in]	list	0 for the update() list, 1 for the fixedUpdate() list.
+		 * @param[in]	id		Identifier assigned by the SceneManager.
+		 */
+		void setUpdateListId(UINT32 list, UINT32 id) { mUpdateListIds[list] = id; }
+
+		/** Returns an index set by setUpdateListId(). */
+		UINT32 getUpdateListId(UINT32 list) const { return mUpdateListIds[list]; }
+
 		/**
 		 * Destroys this component.
 		 *
@@ -183,6 +214,7 @@ namespace bs
 		TransformChangedFlags mNotifyFlags = TCF_None;
 		ComponentFlags mFlags;
 		UINT32 mSceneManagerId = 0;
+		UINT32 mUpdateListIds[2] = { (UINT32)-1, (UINT32)-1 };
 
 	private:
 		HSceneObject mParent;
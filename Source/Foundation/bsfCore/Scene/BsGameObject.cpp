@@ -15,13 +15,15 @@ namespace bs
 
 	void GameObject::_setInstanceData(GameObjectInstanceDataPtr& other)
 	{
-		SPtr<GameObject> myPtr = mInstanceData->object;
-		UINT64 oldId = mInstanceData->mInstanceId;
+		if (other == mInstanceData)
+			return;
 
-		mInstanceData = other;
-		mInstanceData->object = myPtr;
+		// Object moves to the slot of the other instance data, and its current slot forwards to it, so both handles
+		// referencing the other instance data and handles referencing this object remain valid
+		GameObjectManager::instance()._transferObject(*mInstanceData, *other);
 
-		GameObjectManager::instance().remapId(oldId, mInstanceData->mInstanceId);
+		other->object = mInstanceData->object;
+		mInstanceData = other;
 	}
 	
 	RTTITypeBase* GameObject::getRTTIStatic()
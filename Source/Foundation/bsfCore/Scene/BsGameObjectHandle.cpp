@@ -3,34 +3,53 @@
 #include "BsCorePrerequisites.h"
 #include "Scene/BsGameObject.h"
 #include "Scene/BsGameObjectHandle.h"
+#include "Scene/BsGameObjectManager.h"
 #include "Error/BsException.h"
-#include "Scene/BsGameObject.h"
 #include "Private/RTTI/BsGameObjectHandleRTTI.h"
 
 namespace bs
 {
+	GameObjectSlot* const* GameObjectHandleBase::sSlotBlocks = nullptr;
+	UINT32 GameObjectHandleBase::sNumSlots = 0;
+
+	GameObjectInstanceData::~GameObjectInstanceData()
+	{
+		if(mSlot != (UINT32)-1 && GameObjectManager::isStarted())
+			GameObjectManager::instance()._releaseSlot(*this);
+	}
+
 	GameObjectHandleBase::GameObjectHandleBase(const SPtr<GameObject>& ptr)
 	{
-		mData = bs_shared_ptr_new<GameObjectHandleData>(ptr->mInstanceData);
+		_setHandleData(ptr);
 	}
 
 	bool GameObjectHandleBase::isDestroyed(bool checkQueued) const
 	{
-		return mData->mPtr == nullptr || mData->mPtr->object == nullptr
-			|| (checkQueued && mData->mPtr->object->_getIsDestroyed());
+		GameObject* object = tryGet();
+		return object == nullptr || (checkQueued && object->_getIsDestroyed());
+	}
+
+	SPtr<GameObject> GameObjectHandleBase::getInternalPtr() const
+	{
+		const GameObjectSlot* slot = findSlot();
+		if(slot == nullptr || slot->object == nullptr)
+			throwDestroyed();
+
+		return slot->instanceData->object;
 	}
 
 	void GameObjectHandleBase::_setHandleData(const SPtr<GameObject>& object)
 	{
-		mData->mPtr = object->mInstanceData;
+		const GameObjectInstanceDataPtr& instanceData = object->mInstanceData;
+
+		mSlot = instanceData->mSlot;
+		mGeneration = mSlot < sNumSlots ? sSlotBlocks[mSlot / SLOTS_PER_BLOCK][mSlot % SLOTS_PER_BLOCK].generation : 0;
+		mInstanceId = instanceData->mInstanceId;
 	}
 
-	void GameObjectHandleBase::throwIfDestroyed() const
+	void GameObjectHandleBase::throwDestroyed()
 	{
-		if(isDestroyed())
-		{
-			BS_EXCEPT(InternalErrorException, "Trying to access an object that has been destroyed.");
-		}
+		BS_EXCEPT(InternalErrorException, "Trying to access an object that has been destroyed.");
 	}
 
 	RTTITypeBase* GameObjectHandleBase::getRTTIStatic()
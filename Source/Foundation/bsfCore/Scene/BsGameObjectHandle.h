@@ -13,34 +13,61 @@ namespace bs
 	template <typename T>
 	class GameObjectHandle;
 
-	/**	Contains instance data that is held by all GameObject handles. */
-	struct GameObjectInstanceData
+	/**
+	 * Identity of a GameObject, shared between the object and anything that needs to restore the identity to another
+	 * object later (e.g. prefab instance updates). The identity owns a slot in the GameObjectManager's object table,
+	 * which is released when the identity is destroyed.
+	 */
+	struct BS_CORE_EXPORT GameObjectInstanceData
 	{
 		GameObjectInstanceData()
 			:object(nullptr), mInstanceId(0)
 		{ }
 
+		~GameObjectInstanceData();
+
 		SPtr<GameObject> object;
 		UINT64 mInstanceId;
+
+		/** Index of the slot in GameObjectManager's object table the object is registered in. */
+		UINT32 mSlot = (UINT32)-1;
 	};
 
 	typedef SPtr<GameObjectInstanceData> GameObjectInstanceDataPtr;
 
-	/**	Internal data shared between GameObject handles. */
-	struct BS_CORE_EXPORT GameObjectHandleData
+	/**
+	 * Entry in the GameObjectManager's object table, referenced by game object handles. A slot either belongs to an
+	 * object identity, or forwards to a slot that does (when an identity was transferred to another object, or for
+	 * handles created during deserialization).
+	 */
+	struct GameObjectSlot
 	{
-		GameObjectHandleData() = default;
+		/** Object the slot references, null if the object was destroyed. Unused for forwarding slots. */
+		GameObject* object = nullptr;
 
-		GameObjectHandleData(SPtr<GameObjectInstanceData> ptr)
-			:mPtr(std::move(ptr))
-		{ }
+		/** Identity owning the slot. Null for forwarding slots. */
+		GameObjectInstanceData* instanceData = nullptr;
+
+		/** Incremented every time the slot is freed, invalidating handles that reference it. */
+		UINT32 generation = 0;
+
+		/** Slot this slot forwards to, or -1 if not a forwarding slot. Never points to another forwarding slot. */
+		UINT32 target = (UINT32)-1;
+
+		/** First slot in the list of slots forwarding to this slot, or -1 if none. */
+		UINT32 firstForward = (UINT32)-1;
 
-		SPtr<GameObjectInstanceData> mPtr;
+		/** Next slot in the list of slots forwarding to the same target, or -1 if last. */
+		UINT32 nextForward = (UINT32)-1;
 	};
 
 	/**
 	 * A handle that can point to various types of game objects. It primarily keeps track if the object is still alive,
 	 * so anything still referencing it doesn't accidentally use it.
+	 *
+	 * Handles reference a slot in the GameObjectManager's object table, along with the slot's generation at the time
+	 * the handle was created. Once the object is destroyed and its slot freed the generation changes and the handle is
+	 * no longer valid, even if the slot is reused by another object. Handles hold no references and are cheap to copy.
 	 * 			
 	 * @note	
 	 * This class exists because references between game objects should be quite loose. For example one game object should
@@ -50,9 +77,10 @@ namespace bs
 	class BS_CORE_EXPORT GameObjectHandleBase : public IReflectable
 	{
 	public:
-		GameObjectHandleBase()
-			: mData(bs_shared_ptr_new<GameObjectHandleData>(nullptr))
-		{ }
+		/** Number of slots in a single block of the object table. */
+		static constexpr UINT32 SLOTS_PER_BLOCK = 4096;
+
+		GameObjectHandleBase() = default;
 
 		/**
 		 * Returns true if the object the handle is pointing to has been destroyed.
@@ -64,8 +92,18 @@ namespace bs
 		 */
 		bool isDestroyed(bool checkQueued = false) const;
 
-		/**	Returns the instance ID of the object the handle is referencing. */
-		UINT64 getInstanceId() const { return mData->mPtr != nullptr ? mData->mPtr->mInstanceId : 0; }
+		/**	
+		 * Returns the instance ID of the object the handle is referencing. If the handle no longer references a valid
+		 * slot, returns the ID the handle was created with.
+		 */
+		UINT64 getInstanceId() const
+		{
+			const GameObjectSlot* slot = findSlot();
+			if(slot != nullptr && slot->instanceData != nullptr)
+				return slot->instanceData->mInstanceId;
+
+			return mInstanceId;
+		}
 
 		/**
 		 * Returns pointer to the referenced GameObject.
@@ -74,9 +112,11 @@ namespace bs
 		 */
 		GameObject* get() const
 		{
-			throwIfDestroyed();
+			GameObject* object = tryGet();
+			if(object == nullptr)
+				throwDestroyed();
 
-			return mData->mPtr->object.get();
+			return object;
 		}
 
 		/**
@@ -84,12 +124,7 @@ namespace bs
 		 *
 		 * @note	Throws exception if the GameObject was destroyed.
 		 */
-		SPtr<GameObject> getInternalPtr() const
-		{
-			throwIfDestroyed();
-
-			return mData->mPtr->object;
-		}
+		SPtr<GameObject> getInternalPtr() const;
 
 		/**
 		 * Returns pointer to the referenced GameObject.
@@ -110,12 +145,6 @@ namespace bs
 		 *  @{
 		 */
 
-		/** Returns internal handle data. */
-		const SPtr<GameObjectHandleData>& _getHandleData() const { return mData; }
-
-		/** Resolves a handle to a proper GameObject in case it was created uninitialized. */
-		void _resolve(const GameObjectHandleBase& object) {	mData->mPtr = object.mData->mPtr; }
-
 		/**	Changes the GameObject instance the handle is pointing to. */
 		void _setHandleData(const SPtr<GameObject>& object);
 
@@ -130,28 +159,58 @@ namespace bs
 
 		GameObjectHandleBase(const SPtr<GameObject>& ptr);
 
-		GameObjectHandleBase(SPtr<GameObjectHandleData> data)
-			: mData(std::move(data))
+		GameObjectHandleBase(UINT32 slot, UINT32 generation, UINT64 instanceId)
+			: mSlot(slot), mGeneration(generation), mInstanceId(instanceId)
 		{ }
 
-		GameObjectHandleBase(std::nullptr_t ptr)
-			: mData(bs_shared_ptr_new<GameObjectHandleData>(nullptr))
+		GameObjectHandleBase(std::nullptr_t)
 		{ }
 
-		/**	Throws an exception if the referenced GameObject has been destroyed. */
-		void throwIfDestroyed() const;
-		
-		/**	Invalidates the handle signifying the referenced object was destroyed. */
-		void destroy()
+		/**
+		 * Returns the slot that owns the referenced object's identity, following the forwarding slot if needed. Returns
+		 * null if the handle is empty or the slot it references was freed.
+		 */
+		const GameObjectSlot* findSlot() const
+		{
+			if(mSlot >= sNumSlots)
+				return nullptr;
+
+			const GameObjectSlot* slot = &sSlotBlocks[mSlot / SLOTS_PER_BLOCK][mSlot % SLOTS_PER_BLOCK];
+			if(slot->generation != mGeneration)
+				return nullptr;
+
+			if(slot->target != (UINT32)-1)
+				slot = &sSlotBlocks[slot->target / SLOTS_PER_BLOCK][slot->target % SLOTS_PER_BLOCK];
+
+			return slot;
+		}
+
+		/** Returns the referenced object, or null if the object was destroyed. */
+		GameObject* tryGet() const
 		{
-			// It's important not to clear mData->mPtr as some code might rely
-			// on it. (for example for restoring lost handles)
+			const GameObjectSlot* slot = findSlot();
+			return slot != nullptr ? slot->object : nullptr;
+		}
 
-			if (mData->mPtr != nullptr)
-				mData->mPtr->object = nullptr;
+		/**	Throws an exception if the referenced GameObject has been destroyed. */
+		void throwIfDestroyed() const
+		{
+			if(tryGet() == nullptr)
+				throwDestroyed();
 		}
 
-		SPtr<GameObjectHandleData> mData;
+		/**	Throws an exception notifying the caller the referenced GameObject has been destroyed. */
+		static void throwDestroyed();
+
+		UINT32 mSlot = (UINT32)-1;
+		UINT32 mGeneration = 0;
+		UINT64 mInstanceId = 0;
+
+		/** Blocks of the GameObjectManager's object table. Null if the manager isn't started. */
+		static GameObjectSlot* const* sSlotBlocks;
+
+		/** Number of slots in the object table. Zero if the manager isn't started. */
+		static UINT32 sNumSlots;
 
 		/************************************************************************/
 		/* 								RTTI		                     		*/
@@ -178,11 +237,7 @@ namespace bs
 	{
 	public:
 		/**	Constructs a new empty handle. */
-		GameObjectHandle()
-			:GameObjectHandleBase()
-		{	
-			mData = bs_shared_ptr_new<GameObjectHandleData>();
-		}
+		GameObjectHandle() = default;
 
 		/**	Copy constructor from another handle of the same type. */
 		GameObjectHandle(const GameObjectHandle<T>& ptr) = default;
@@ -193,7 +248,9 @@ namespace bs
 		/**	Invalidates the handle. */
 		GameObjectHandle<T>& operator=(std::nullptr_t ptr)
 		{ 	
-			mData = bs_shared_ptr_new<GameObjectHandleData>();
+			mSlot = (UINT32)-1;
+			mGeneration = 0;
+			mInstanceId = 0;
 
 			return *this;
 		}
@@ -211,9 +268,7 @@ namespace bs
 		 */
 		T* get() const
 		{
-			throwIfDestroyed();
-
-			return reinterpret_cast<T*>(mData->mPtr->object.get());
+			return reinterpret_cast<T*>(GameObjectHandleBase::get());
 		}
 
 		/**
@@ -223,9 +278,7 @@ namespace bs
 		 */
 		SPtr<T> getInternalPtr() const
 		{
-			throwIfDestroyed();
-
-			return std::static_pointer_cast<T>(mData->mPtr->object);
+			return std::static_pointer_cast<T>(GameObjectHandleBase::getInternalPtr());
 		}
 
 		/**
@@ -262,7 +315,7 @@ namespace bs
 		 */
 		operator int Bool_struct<T>::*() const
 		{
-			return (((mData->mPtr != nullptr) && (mData->mPtr->object != nullptr)) ? &Bool_struct<T>::_Member : 0);
+			return tryGet() != nullptr ? &Bool_struct<T>::_Member : 0;
 		}
 
 		/** @} */
@@ -274,8 +327,8 @@ namespace bs
 		template<class _Ty1>
 		friend GameObjectHandle<_Ty1> static_object_cast(const GameObjectHandleBase& other);
 
-		GameObjectHandle(SPtr<GameObjectHandleData> data)
-			:GameObjectHandleBase(std::move(data))
+		explicit GameObjectHandle(const GameObjectHandleBase& other)
+			:GameObjectHandleBase(other)
 		{ }
 	};
 
@@ -283,22 +336,21 @@ namespace bs
 	template<class _Ty1, class _Ty2>
 	GameObjectHandle<_Ty1> static_object_cast(const GameObjectHandle<_Ty2>& other)
 	{	
-		return GameObjectHandle<_Ty1>(other._getHandleData());
+		return GameObjectHandle<_Ty1>(static_cast<const GameObjectHandleBase&>(other));
 	}
 
 	/**	Casts a generic GameObject handle to a specific one . */
 	template<class T>
 	GameObjectHandle<T> static_object_cast(const GameObjectHandleBase& other)
 	{	
-		return GameObjectHandle<T>(other._getHandleData());
+		return GameObjectHandle<T>(other);
 	}
 
 	/**	Compares if two handles point to the same GameObject. */
 	template<class _Ty1, class _Ty2>
 	bool operator==(const GameObjectHandle<_Ty1>& _Left, const GameObjectHandle<_Ty2>& _Right)
 	{	
-		return (_Left.mData == nullptr && _Right.mData == nullptr) ||
-			(_Left.mData != nullptr && _Right.mData != nullptr && _Left.getInstanceId() == _Right.getInstanceId());
+		return _Left.getInstanceId() == _Right.getInstanceId();
 	}
 
 	/**	Compares if two handles point to different GameObject%s. */
@@ -5,18 +5,32 @@
 
 namespace bs
 {
+	GameObjectManager::GameObjectManager()
+	{
+		GameObjectHandleBase::sSlotBlocks = mSlotBlocks.data();
+	}
+
 	GameObjectManager::~GameObjectManager()
 	{
 		destroyQueuedObjects();
+
+		GameObjectHandleBase::sNumSlots = 0;
+		GameObjectHandleBase::sSlotBlocks = nullptr;
+
+		for(auto& block : mSlotBlocks)
+		{
+			if(block != nullptr)
+				bs_deleteN(block, SLOTS_PER_BLOCK);
+		}
 	}
 
 	GameObjectHandleBase GameObjectManager::getObject(UINT64 id) const
 	{
 		Lock lock(mMutex);
 
-		const auto iterFind = mObjects.find(id);
-		if (iterFind != mObjects.end())
-			return iterFind->second;
+		const auto iterFind = mSlotLookup.find(id);
+		if (iterFind != mSlotLookup.end())
+			return GameObjectHandleBase(iterFind->second, getSlot(iterFind->second).generation, id);
 
 		return nullptr;
 	}
@@ -25,10 +39,10 @@ namespace bs
 	{
 		Lock lock(mMutex);
 
-		const auto iterFind = mObjects.find(id);
-		if (iterFind != mObjects.end())
+		const auto iterFind = mSlotLookup.find(id);
+		if (iterFind != mSlotLookup.end())
 		{
-			object = iterFind->second;
+			object = GameObjectHandleBase(iterFind->second, getSlot(iterFind->second).generation, id);
 			return true;
 		}
 
@@ -39,7 +53,7 @@ namespace bs
 	{
 		Lock lock(mMutex);
 
-		return mObjects.find(id) != mObjects.end();
+		return mSlotLookup.find(id) != mSlotLookup.end();
 	}
 
 	void GameObjectManager::remapId(UINT64 oldId, UINT64 newId)
@@ -48,8 +62,15 @@ namespace bs
 			return;
 
 		Lock lock(mMutex);
-		mObjects[newId] = mObjects[oldId];
-		mObjects.erase(oldId);
+
+		const auto iterFind = mSlotLookup.find(oldId);
+		if (iterFind == mSlotLookup.end())
+			return;
+
+		const UINT32 slot = iterFind->second;
+		mSlotLookup.erase(iterFind);
+
+		mSlotLookup[newId] = slot;
 	}
 
 	UINT64 GameObjectManager::reserveId()
@@ -57,6 +78,13 @@ namespace bs
 		return mNextAvailableID.fetch_add(1, std::memory_order_relaxed);
 	}
 
+	UINT32 GameObjectManager::getNumObjects() const
+	{
+		Lock lock(mMutex);
+
+		return (UINT32)mSlotLookup.size();
+	}
+
 	void GameObjectManager::queueForDestroy(const GameObjectHandleBase& object)
 	{
 		if (object.isDestroyed())
@@ -79,28 +107,201 @@ namespace bs
 		const UINT64 id = mNextAvailableID.fetch_add(1, std::memory_order_relaxed);
 		object->initialize(object, id);
 
-		GameObjectHandleBase handle(object);
-		{
-			Lock lock(mMutex);
-			mObjects[id] = handle;
-		}
+		GameObjectInstanceData& instanceData = *object->mInstanceData;
+
+		Lock lock(mMutex);
+
+		const UINT32 slot = allocateSlot();
+
+		GameObjectSlot& entry = getSlot(slot);
+		entry.object = object.get();
+		entry.instanceData = &instanceData;
+
+		instanceData.mSlot = slot;
+		mSlotLookup[id] = slot;
 
-		return handle;
+		return GameObjectHandleBase(slot, entry.generation, id);
 	}
 
 	void GameObjectManager::unregisterObject(GameObjectHandleBase& object)
 	{
 		{
 			Lock lock(mMutex);
-			mObjects.erase(object->getInstanceId());
+
+			const GameObjectSlot* entry = object.findSlot();
+			if(entry != nullptr && entry->instanceData != nullptr)
+			{
+				const auto iterFind = mSlotLookup.find(entry->instanceData->mInstanceId);
+				if(iterFind != mSlotLookup.end() && iterFind->second == entry->instanceData->mSlot)
+					mSlotLookup.erase(iterFind);
+			}
 		}
 
 		onDestroyed(static_object_cast<GameObject>(object));
-		object.destroy();
+
+		SPtr<GameObject> objectPtr;
+		{
+			Lock lock(mMutex);
+
+			const GameObjectSlot* entry = object.findSlot();
+			if(entry != nullptr && entry->instanceData != nullptr)
+			{
+				getSlot(entry->instanceData->mSlot).object = nullptr;
+				objectPtr = std::move(entry->instanceData->object);
+			}
+		}
+
+		// The slot stays reserved until the instance data is destroyed, which normally happens when the object pointer
+		// is released below. It must not be released while the mutex is held, as it might free slots of other objects.
+		objectPtr = nullptr;
+	}
+
+	void GameObjectManager::_transferObject(GameObjectInstanceData& from, GameObjectInstanceData& to)
+	{
+		if(&from == &to)
+			return;
+
+		Lock lock(mMutex);
+
+		if(to.mSlot == (UINT32)-1)
+		{
+			to.mSlot = allocateSlot();
+			getSlot(to.mSlot).instanceData = &to;
+		}
+
+		GameObjectSlot& toEntry = getSlot(to.mSlot);
+		toEntry.object = from.object.get();
+
+		if(from.mSlot != (UINT32)-1)
+		{
+			GameObjectSlot& fromEntry = getSlot(from.mSlot);
+
+			// Old slot forwards to the new one, as do all the slots that were forwarding to the old slot
+			UINT32 lastForward = from.mSlot;
+			for(UINT32 forward = fromEntry.firstForward; forward != (UINT32)-1; forward = getSlot(forward).nextForward)
+			{
+				getSlot(forward).target = to.mSlot;
+				lastForward = forward;
+			}
+
+			fromEntry.nextForward = fromEntry.firstForward;
+			fromEntry.firstForward = (UINT32)-1;
+			fromEntry.target = to.mSlot;
+			fromEntry.object = nullptr;
+			fromEntry.instanceData = nullptr;
+
+			getSlot(lastForward).nextForward = toEntry.firstForward;
+			toEntry.firstForward = from.mSlot;
+
+			const auto iterFind = mSlotLookup.find(from.mInstanceId);
+			if(iterFind != mSlotLookup.end() && iterFind->second == from.mSlot)
+			{
+				mSlotLookup.erase(iterFind);
+				mSlotLookup[to.mInstanceId] = to.mSlot;
+			}
+
+			from.mSlot = (UINT32)-1;
+		}
+	}
+
+	void GameObjectManager::_releaseSlot(GameObjectInstanceData& instanceData)
+	{
+		Lock lock(mMutex);
+
+		const UINT32 slot = instanceData.mSlot;
+		if(slot >= mNumSlots || getSlot(slot).instanceData != &instanceData)
+			return;
+
+		const auto iterFind = mSlotLookup.find(instanceData.mInstanceId);
+		if(iterFind != mSlotLookup.end() && iterFind->second == slot)
+			mSlotLookup.erase(iterFind);
+
+		freeSlot(slot);
+		instanceData.mSlot = (UINT32)-1;
+	}
+
+	UINT32 GameObjectManager::allocateSlot()
+	{
+		if(!mFreeSlots.empty())
+		{
+			const UINT32 slot = mFreeSlots.back();
+			mFreeSlots.pop_back();
+
+			return slot;
+		}
+
+		const UINT32 slot = mNumSlots;
+		const UINT32 blockIdx = slot / SLOTS_PER_BLOCK;
+		if(blockIdx >= MAX_SLOT_BLOCKS)
+		{
+			BS_EXCEPT(InvalidStateException, "Maximum number of game objects reached: " +
+				toString(SLOTS_PER_BLOCK * MAX_SLOT_BLOCKS));
+		}
+
+		if(mSlotBlocks[blockIdx] == nullptr)
+			mSlotBlocks[blockIdx] = bs_newN<GameObjectSlot>(SLOTS_PER_BLOCK);
+
+		mNumSlots++;
+		GameObjectHandleBase::sNumSlots = mNumSlots;
+
+		return slot;
+	}
+
+	void GameObjectManager::freeSlot(UINT32 slot)
+	{
+		GameObjectSlot& entry = getSlot(slot);
+
+		UINT32 forward = entry.firstForward;
+		while(forward != (UINT32)-1)
+		{
+			GameObjectSlot& forwardEntry = getSlot(forward);
+			const UINT32 next = forwardEntry.nextForward;
+
+			forwardEntry = GameObjectSlot{ nullptr, nullptr, forwardEntry.generation + 1 };
+			mFreeSlots.push_back(forward);
+
+			forward = next;
+		}
+
+		entry = GameObjectSlot{ nullptr, nullptr, entry.generation + 1 };
+		mFreeSlots.push_back(slot);
+	}
+
+	GameObjectHandleBase GameObjectManager::createPlaceholder()
+	{
+		Lock lock(mMutex);
+
+		const UINT32 slot = allocateSlot();
+		return GameObjectHandleBase(slot, getSlot(slot).generation, 0);
+	}
+
+	void GameObjectManager::bindPlaceholder(const GameObjectHandleBase& placeholder, const GameObjectHandleBase& target)
+	{
+		Lock lock(mMutex);
+
+		if(placeholder.mSlot >= mNumSlots)
+			return;
+
+		GameObjectSlot& entry = getSlot(placeholder.mSlot);
+		if(entry.generation != placeholder.mGeneration || entry.target != (UINT32)-1 || entry.instanceData != nullptr)
+			return;
+
+		const GameObjectSlot* targetEntry = target.findSlot();
+		if(targetEntry == nullptr || targetEntry->instanceData == nullptr)
+		{
+			freeSlot(placeholder.mSlot);
+			return;
+		}
+
+		GameObjectSlot& ownerEntry = getSlot(targetEntry->instanceData->mSlot);
+
+		entry.target = targetEntry->instanceData->mSlot;
+		entry.nextForward = ownerEntry.firstForward;
+		ownerEntry.firstForward = placeholder.mSlot;
 	}
 
 	GameObjectDeserializationState::GameObjectDeserializationState(UINT32 options)
-		:mOptions(options)
+		:mCopies(1), mOptions(options)
 	{ }
 
 	GameObjectDeserializationState::~GameObjectDeserializationState()
@@ -113,12 +314,16 @@ namespace bs
 	{
 		for (auto& entry : mUnresolvedHandles)
 		{
+			if (entry.isBound)
+				continue;
+
 			UINT64 instanceId = entry.originalInstanceId;
 
 			bool isInternalReference = false;
 
-			const auto findIter = mIdMapping.find(instanceId);
-			if (findIter != mIdMapping.end())
+			const UnorderedMap<UINT64, UINT64>& idMapping = mCopies[entry.copyIdx].idMapping;
+			const auto findIter = idMapping.find(instanceId);
+			if (findIter != idMapping.end())
 			{
 				if ((mOptions & GODM_UseNewIds) != 0)
 					instanceId = findIter->second;
@@ -126,34 +331,19 @@ namespace bs
 				isInternalReference = true;
 			}
 
+			// If the object cannot be found the placeholder gets freed, leaving all handles referencing it as null
+			GameObjectHandleBase target;
 			if (isInternalReference)
 			{
 				const auto findIterObj = mDeserializedObjects.find(instanceId);
 
 				if (findIterObj != mDeserializedObjects.end())
-					entry.handle._resolve(findIterObj->second);
-				else
-				{
-					if ((mOptions & GODM_KeepMissing) == 0)
-						entry.handle._resolve(nullptr);
-				}
+					target = findIterObj->second;
 			}
 			else if (!isInternalReference && (mOptions & GODM_RestoreExternal) != 0)
-			{
-				HGameObject obj;
-				if(GameObjectManager::instance().tryGetObject(instanceId, obj))
-					entry.handle._resolve(obj);
-				else
-				{
-					if ((mOptions & GODM_KeepMissing) == 0)
-						entry.handle._resolve(nullptr);
-				}
-			}
-			else
-			{
-				if ((mOptions & GODM_KeepMissing) == 0)
-					entry.handle._resolve(nullptr);
-			}
+				GameObjectManager::instance().tryGetObject(instanceId, target);
+
+			GameObjectManager::instance().bindPlaceholder(entry.placeholder, target);
 		}
 
 		for (auto iter = mEndCallbacks.rbegin(); iter != mEndCallbacks.rend(); ++iter)
@@ -161,68 +351,68 @@ namespace bs
 			(*iter)();
 		}
 
-		mIdMapping.clear();
+		mCopies.clear();
+		mCopies.resize(1);
 		mUnresolvedHandles.clear();
 		mEndCallbacks.clear();
-		mUnresolvedHandleData.clear();
 		mDeserializedObjects.clear();
 	}
 
 	void GameObjectDeserializationState::registerUnresolvedHandle(UINT64 originalId, GameObjectHandleBase& object)
 	{
 		// All handles that are deserialized during a single begin/endDeserialization session pointing to the same object
-		// must share the same GameObjectHandleData as that makes certain operations in other systems much simpler.
-		// Therefore we store all the unresolved handles, and if a handle pointing to the same object was already
-		// processed, or that object was already created we replace the handle's internal GameObjectHandleData.
+		// must reference the same slot, as the handles are copied into their final location after this call and can no
+		// longer be reached. Therefore handles are pointed to a placeholder slot that is shared by all handles with the
+		// same original ID, and the placeholder is made to forward to the object once it is resolved.
+		CopyState& copy = mCopies.back();
 
-		// Update the provided handle to ensure all handles pointing to the same object share the same handle data
-		bool foundHandleData = false;
-
-		// Search object that are currently being deserialized
-		const auto iterFind = mIdMapping.find(originalId);
-		if (iterFind != mIdMapping.end())
+		// Object is already deserialized, reference it directly
+		if ((mOptions & GODM_UseNewIds) != 0)
 		{
-			const auto iterFind2 = mDeserializedObjects.find(iterFind->second);
-			if (iterFind2 != mDeserializedObjects.end())
+			const auto iterFind = copy.idMapping.find(originalId);
+			if (iterFind != copy.idMapping.end())
 			{
-				object.mData = iterFind2->second.mData;
-				foundHandleData = true;
+				const auto iterFind2 = mDeserializedObjects.find(iterFind->second);
+				if (iterFind2 != mDeserializedObjects.end())
+				{
+					object = iterFind2->second;
+					return;
+				}
 			}
 		}
 
 		// Search previously deserialized handles
-		if (!foundHandleData)
+		const auto iterFind = copy.unresolvedHandles.find(originalId);
+		if (iterFind != copy.unresolvedHandles.end())
 		{
-			auto iterFind = mUnresolvedHandleData.find(originalId);
-			if (iterFind != mUnresolvedHandleData.end())
-			{
-				object.mData = iterFind->second;
-				foundHandleData = true;
-			}
+			object = mUnresolvedHandles[iterFind->second].placeholder;
+			return;
 		}
 
-		// If still not found, this is the first such handle so register its handle data
-		if (!foundHandleData)
-			mUnresolvedHandleData[originalId] = object.mData;
+		// This is the first such handle so create a placeholder for it
+		object = GameObjectManager::instance().createPlaceholder();
 
-		mUnresolvedHandles.push_back({ originalId, object });
+		copy.unresolvedHandles[originalId] = (UINT32)mUnresolvedHandles.size();
+		mUnresolvedHandles.push_back({ originalId, (UINT32)mCopies.size() - 1, object, false });
 	}
 
 	void GameObjectDeserializationState::registerObject(UINT64 originalId, GameObjectHandleBase& object)
 	{
 		assert(originalId != 0 && "Invalid game object ID.");
 
-		const auto iterFind = mUnresolvedHandleData.find(originalId);
-		if (iterFind != mUnresolvedHandleData.end())
+		// Handles referencing the object that were deserialized before it can reference it right away
+		CopyState& copy = mCopies.back();
+		const auto iterFind = copy.unresolvedHandles.find(originalId);
+		if (iterFind != copy.unresolvedHandles.end())
 		{
-			SPtr<GameObject> ptr = object.getInternalPtr();
+			UnresolvedHandle& entry = mUnresolvedHandles[iterFind->second];
 
-			object.mData = iterFind->second;
-			object._setHandleData(ptr);
+			GameObjectManager::instance().bindPlaceholder(entry.placeholder, object);
+			entry.isBound = true;
 		}
 
 		const UINT64 newId = object->getInstanceId();
-		mIdMapping[originalId] = newId;
+		copy.idMapping[originalId] = newId;
 		mDeserializedObjects[newId] = object;
 	}
 
@@ -230,4 +420,9 @@ namespace bs
 	{
 		mEndCallbacks.push_back(callback);
 	}
+
+	void GameObjectDeserializationState::beginCopy()
+	{
+		mCopies.emplace_back();
+	}
 }
@@ -34,12 +34,23 @@ namespace bs
 	/**
 	 * Tracks GameObject creation and destructions. Also resolves GameObject references from GameObject handles.
 	 *
+	 * Registered objects are stored in a table of slots, and game object handles reference objects by slot index and
+	 * generation. A slot is owned by the object's instance data and freed when the instance data is destroyed, at which
+	 * point its generation is incremented so existing handles can no longer access it. Freed slots are reused by new
+	 * objects.
+	 *
 	 * @note	Sim thread only.
 	 */
 	class BS_CORE_EXPORT GameObjectManager : public Module<GameObjectManager>
 	{
+		/** Number of slots allocated at once. Slots are never moved once allocated. */
+		static constexpr UINT32 SLOTS_PER_BLOCK = GameObjectHandleBase::SLOTS_PER_BLOCK;
+
+		/** Maximum number of slot blocks, limiting the number of objects that can be alive at once. */
+		static constexpr UINT32 MAX_SLOT_BLOCKS = 4096;
+
 	public:
-		GameObjectManager() = default;
+		GameObjectManager();
 		~GameObjectManager();
 
 		/**
@@ -104,12 +115,75 @@ namespace bs
 		/**	Destroys any GameObjects that were queued for destruction. */
 		void destroyQueuedObjects();
 
+		/** Returns the number of currently registered objects. */
+		UINT32 getNumObjects() const;
+
 		/**	Triggered when a game object is being destroyed. */
 		Event<void(const HGameObject&)> onDestroyed;
 
+	public: // ***** INTERNAL ******
+		/** @name Internal
+		 *  @{
+		 */
+
+		/**
+		 * Moves the object registered with the @p from identity into the slot of the @p to identity. Handles
+		 * referencing the slot of either identity will reference the object, and the object can be retrieved by the ID
+		 * of the @p to identity. The slot of the @p from identity is no longer owned by it after this call.
+		 *
+		 * @note	Thread safe.
+		 */
+		void _transferObject(GameObjectInstanceData& from, GameObjectInstanceData& to);
+
+		/**
+		 * Frees the slot owned by the provided identity, along with any slots forwarding to it. Handles referencing the
+		 * freed slots will no longer be valid. Called when the identity is destroyed.
+		 *
+		 * @note	Thread safe.
+		 */
+		void _releaseSlot(GameObjectInstanceData& instanceData);
+
+		/** @} */
+
 	private:
+		friend class GameObjectDeserializationState;
+
+		/** Returns the entry in the object table at the specified index. */
+		GameObjectSlot& getSlot(UINT32 slot) const
+		{
+			return mSlotBlocks[slot / SLOTS_PER_BLOCK][slot % SLOTS_PER_BLOCK];
+		}
+
+		/** Finds a free slot in the object table, or allocates a new one. Caller must hold the mutex. */
+		UINT32 allocateSlot();
+
+		/** Frees the slot at the specified index, and any slots forwarding to it. Caller must hold the mutex. */
+		void freeSlot(UINT32 slot);
+
+		/**
+		 * Creates a handle referencing a new slot that doesn't reference any object yet. The handle can be copied
+		 * freely, and all the copies will reference the object once bindPlaceholder() is called.
+		 *
+		 * @note	Thread safe.
+		 */
+		GameObjectHandleBase createPlaceholder();
+
+		/**
+		 * Makes the slot of a handle returned by createPlaceholder() forward to the slot of the @p target handle. If
+		 * @p target doesn't reference a valid slot, the placeholder slot is freed instead, making all of its handles
+		 * invalid.
+		 *
+		 * @note	Thread safe.
+		 */
+		void bindPlaceholder(const GameObjectHandleBase& placeholder, const GameObjectHandleBase& target);
+
 		std::atomic<UINT64> mNextAvailableID = { 1 } ; // 0 is not a valid ID
-		Map<UINT64, GameObjectHandleBase> mObjects;
+
+		std::array<GameObjectSlot*, MAX_SLOT_BLOCKS> mSlotBlocks = {};
+		UINT32 mNumSlots = 0;
+		Vector<UINT32> mFreeSlots;
+		UnorderedMap<UINT64, UINT32> mSlotLookup;
+
 		Map<UINT64, GameObjectHandleBase> mQueuedForDestroy;
 
 		mutable Mutex mMutex;
@@ -119,11 +193,23 @@ namespace bs
 	class BS_CORE_EXPORT GameObjectDeserializationState
 	{
 	private:
-		/**	Contains data for an yet unresolved game object handle. */
+		/**
+		 * Contains data for an yet unresolved game object handle. All unresolved handles referencing the same original
+		 * ID in the same copy share a single placeholder slot, which is made to forward to the object once resolved.
+		 */
 		struct UnresolvedHandle
 		{
 			UINT64 originalInstanceId;
-			GameObjectHandleBase handle;
+			UINT32 copyIdx;
+			GameObjectHandleBase placeholder;
+			bool isBound;
+		};
+
+		/** Maps original IDs to deserialized objects, for a single copy of the deserialized data. */
+		struct CopyState
+		{
+			UnorderedMap<UINT64, UINT64> idMapping;
+			UnorderedMap<UINT64, UINT32> unresolvedHandles; /**< Original ID -> index into mUnresolvedHandles. */
 		};
 
 	public:
@@ -145,6 +231,13 @@ namespace bs
 		/**	Registers a callback that will be triggered when GameObject serialization ends. */
 		void registerOnDeserializationEndCallback(std::function<void()> callback);
 
+		/**
+		 * Starts deserializing another copy of the same data. Objects and handles registered after this call are mapped
+		 * separately from the ones in previous copies, even though they share the same original IDs. Handles of all the
+		 * copies still get resolved by a single call to resolve().
+		 */
+		void beginCopy();
+
 		/** Resolves all registered handles and objects, and triggers end callbacks. */
 		void resolve();
 
@@ -152,8 +245,7 @@ namespace bs
 		bool getUseNewUUIDs() const { return (mOptions & GODM_UseNewUUID) != 0; }
 
 	private:
-		UnorderedMap<UINT64, UINT64> mIdMapping;
-		UnorderedMap<UINT64, SPtr<GameObjectHandleData>> mUnresolvedHandleData;
+		Vector<CopyState> mCopies;
 		UnorderedMap<UINT64, GameObjectHandleBase> mDeserializedObjects;
 		Vector<UnresolvedHandle> mUnresolvedHandles;
 		Vector<std::function<void()>> mEndCallbacks;
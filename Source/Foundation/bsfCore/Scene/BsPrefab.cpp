@@ -149,6 +149,25 @@ namespace bs
 		return clone;
 	}
 
+	Vector<HSceneObject> Prefab::instantiate(UINT32 count) const
+	{
+		if (mRoot == nullptr)
+			return Vector<HSceneObject>();
+
+#if BS_IS_BANSHEE3D
+		if (gCoreApplication().isEditor())
+		{
+			// Update any child prefab instances in case their prefabs changed
+			_updateChildInstances();
+		}
+#endif
+
+		mRoot->mPrefabHash = mHash;
+		mRoot->mLinkId = -1;
+
+		return mRoot->cloneMultiple(count, true);
+	}
+
 	HSceneObject Prefab::_clone(bool preserveUUIDs) const
 	{
 		if (mRoot == nullptr)
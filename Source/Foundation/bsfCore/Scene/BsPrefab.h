@@ -40,6 +40,14 @@ namespace bs
 		 */
 		HSceneObject instantiate() const { return _instantiate(); }
 
+		/**
+		 * Instantiates a prefab multiple times by creating @p count instances of the prefab's scene object hierarchy.
+		 * Returned hierarchies will be parented to world root by default.
+		 *
+		 * @return	Instantiated clones of the prefab's scene object hierarchy.
+		 */
+		Vector<HSceneObject> instantiate(UINT32 count) const;
+
 		/**
 		 * Replaces the contents of this prefab with new contents from the provided object. Object will be automatically
 		 * linked to this prefab, and its previous prefab link (if any) will be broken.
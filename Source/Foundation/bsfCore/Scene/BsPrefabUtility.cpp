@@ -386,12 +386,11 @@ namespace bs
 				current->destroy(true);
 				HSceneObject newInstance = prefabLink->_clone();
 
-				// When restoring instance IDs it is important to make all the new handles point to the old GameObjectInstanceData.
-				// This is because old handles will have different GameObjectHandleData and we have no easy way of accessing it to
-				// change to which GameObjectInstanceData it points. But the GameObjectManager ensures that all handles deserialized
-				// at once (i.e. during the ::_clone() call above) will share GameObjectHandleData so we can simply replace
-				// to what they point to, affecting all of the handles to that object. (In another words, we can modify the
-				// new handles at this point, but old ones must keep referencing what they already were.)
+				// When restoring instance IDs it is important to make the new objects take over the old
+				// GameObjectInstanceData. Old handles reference the slots owned by the old instance data, and we have no
+				// easy way of accessing them to change which slot they reference. Instead the new objects are moved into
+				// the old slots, and the slots they were originally created in are made to forward to the old ones, so
+				// the handles created during the ::_clone() call above reference the same objects as the old handles.
 				impl::restoreLinkedInstanceData(newInstance, soProxy, linkedInstanceData);
 				impl::restoreUnlinkedInstanceData(newInstance, soProxy);
 
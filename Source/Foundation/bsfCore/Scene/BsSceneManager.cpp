@@ -13,6 +13,7 @@
 #include "Scene/BsSceneActor.h"
 #include "Scene/BsPrefab.h"
 #include "Physics/BsPhysics.h"
+#include "Threading/BsTaskScheduler.h"
 
 namespace bs
 {
@@ -24,6 +25,15 @@ namespace bs
 		UninitializedList = 3
 	};
 
+	enum UpdateListType
+	{
+		UpdateList = 0,
+		FixedUpdateList = 1
+	};
+
+	/** Number of components updated by a single worker, when updating components in parallel. */
+	static constexpr UINT32 PARALLEL_UPDATE_BATCH_SIZE = 256;
+
 	struct ScopeToggle
 	{
 		ScopeToggle(bool& val) :val(val) { val = true; }
@@ -42,7 +52,7 @@ namespace bs
 		: mMainScene(
 			bs_shared_ptr_new<SceneInstance>(SceneInstance::ConstructPrivately(), "Main",
 				SceneObject::createInternal("SceneRoot"),
-				gPhysics().createPhysicsScene()))
+				Physics::isStarted() ? gPhysics().createPhysicsScene() : nullptr))
 	{
 		mMainScene->mRoot->setScene(mMainScene);
 	}
@@ -439,6 +449,9 @@ namespace bs
 		list.push_back(component);
 
 		component->setSceneManagerId(encodeComponentId(idx, listType));
+
+		if(listType == ActiveList)
+			addToUpdateLists(component.get());
 	}
 
 	void SceneManager::removeFromStateList(const HComponent& component)
@@ -450,6 +463,9 @@ namespace bs
 		if(listType == 0)
 			return;
 
+		if(listType == ActiveList)
+			removeFromUpdateLists(component.get());
+
 		Vector<HComponent>& list = *mComponentsPerState[listType - 1];
 
 		UINT32 lastIdx;
@@ -517,6 +533,169 @@ namespace bs
 		mStateChanges.clear();
 	}
 
+	void SceneManager::addToUpdateLists(Component* component)
+	{
+		const UINT32 typeId = component->getRTTI()->getRTTIId();
+		const bool parallel = component->hasFlag(ComponentFlag::ParallelUpdate);
+
+		for(UINT32 i = 0; i < (UINT32)mUpdateLists.size(); i++)
+		{
+			const ComponentFlag disableFlag = i == UpdateList ? ComponentFlag::NoUpdate : ComponentFlag::NoFixedUpdate;
+			if(component->hasFlag(disableFlag))
+				continue;
+
+			ComponentUpdateList& updateList = mUpdateLists[i];
+
+			auto iterFind = updateList.bucketLookup.find(typeId);
+			if(iterFind == updateList.bucketLookup.end())
+			{
+				ComponentUpdateBucket bucket;
+				bucket.typeId = typeId;
+				bucket.priority = getComponentUpdatePriority(typeId);
+
+				updateList.buckets.push_back(bucket);
+				sortUpdateBuckets(updateList);
+
+				iterFind = updateList.bucketLookup.find(typeId);
+			}
+
+			ComponentUpdateBucket& bucket = updateList.buckets[iterFind->second];
+			Vector<Component*>& components = parallel ? bucket.parallelComponents : bucket.components;
+
+			component->setUpdateListId(i, encodeUpdateListId((UINT32)components.size(), parallel));
+			components.push_back(component);
+		}
+	}
+
+	void SceneManager::removeFromUpdateLists(Component* component)
+	{
+		for(UINT32 i = 0; i < (UINT32)mUpdateLists.size(); i++)
+		{
+			const UINT32 id = component->getUpdateListId(i);
+			if(id == (UINT32)-1)
+				continue;
+
+			UINT32 idx;
+			bool parallel;
+			decodeUpdateListId(id, idx, parallel);
+
+			ComponentUpdateList& updateList = mUpdateLists[i];
+			const UINT32 bucketIdx = updateList.bucketLookup[component->getRTTI()->getRTTIId()];
+
+			ComponentUpdateBucket& bucket = updateList.buckets[bucketIdx];
+			Vector<Component*>& components = parallel ? bucket.parallelComponents : bucket.components;
+
+			assert(components[idx] == component);
+
+			Component* last = components.back();
+			if(last != component)
+			{
+				components[idx] = last;
+				last->setUpdateListId(i, id);
+			}
+
+			components.pop_back();
+			component->setUpdateListId(i, (UINT32)-1);
+		}
+	}
+
+	void SceneManager::sortUpdateBuckets(ComponentUpdateList& list)
+	{
+		std::sort(list.buckets.begin(), list.buckets.end(),
+			[](const ComponentUpdateBucket& a, const ComponentUpdateBucket& b)
+		{
+			if(a.priority != b.priority)
+				return a.priority < b.priority;
+
+			return a.typeId < b.typeId;
+		});
+
+		list.bucketLookup.clear();
+		for(UINT32 i = 0; i < (UINT32)list.buckets.size(); i++)
+			list.bucketLookup[list.buckets[i].typeId] = i;
+	}
+
+	void SceneManager::setComponentUpdatePriority(UINT32 rttiId, INT32 priority)
+	{
+		mUpdatePriorities[rttiId] = priority;
+
+		for(auto& updateList : mUpdateLists)
+		{
+			auto iterFind = updateList.bucketLookup.find(rttiId);
+			if(iterFind == updateList.bucketLookup.end())
+				continue;
+
+			updateList.buckets[iterFind->second].priority = priority;
+			sortUpdateBuckets(updateList);
+		}
+	}
+
+	INT32 SceneManager::getComponentUpdatePriority(UINT32 rttiId) const
+	{
+		const auto iterFind = mUpdatePriorities.find(rttiId);
+		if(iterFind != mUpdatePriorities.end())
+			return iterFind->second;
+
+		return 0;
+	}
+
+	void SceneManager::updateComponents(ComponentUpdateList& list, bool fixed)
+	{
+		const bool useTasks = TaskScheduler::isStarted();
+
+		// Note: Iterating using indices and re-checking the sizes, as callbacks are allowed to destroy components
+		// immediately, which removes them from the lists
+		for(UINT32 i = 0; i < (UINT32)list.buckets.size(); i++)
+		{
+			Vector<Component*>& parallelComponents = list.buckets[i].parallelComponents;
+
+			const auto numParallel = (UINT32)parallelComponents.size();
+			if(useTasks && numParallel > PARALLEL_UPDATE_BATCH_SIZE)
+			{
+				const UINT32 numBatches = Math::divideAndRoundUp(numParallel, PARALLEL_UPDATE_BATCH_SIZE);
+
+				auto updateWorker = [&parallelComponents, numParallel, fixed](UINT32 batchIdx)
+				{
+					const UINT32 start = batchIdx * PARALLEL_UPDATE_BATCH_SIZE;
+					const UINT32 end = std::min(start + PARALLEL_UPDATE_BATCH_SIZE, numParallel);
+
+					for(UINT32 j = start; j < end; j++)
+					{
+						if(fixed)
+							parallelComponents[j]->fixedUpdate();
+						else
+							parallelComponents[j]->update();
+					}
+				};
+
+				SPtr<TaskGroup> taskGroup = TaskGroup::create("ComponentUpdate", updateWorker, numBatches,
+					TaskPriority::High);
+
+				TaskScheduler::instance().addTaskGroup(taskGroup);
+				taskGroup->wait();
+			}
+			else
+			{
+				for(UINT32 j = 0; j < (UINT32)parallelComponents.size(); j++)
+				{
+					if(fixed)
+						parallelComponents[j]->fixedUpdate();
+					else
+						parallelComponents[j]->update();
+				}
+			}
+
+			Vector<Component*>& components = list.buckets[i].components;
+			for(UINT32 j = 0; j < (UINT32)components.size(); j++)
+			{
+				if(fixed)
+					components[j]->fixedUpdate();
+				else
+					components[j]->update();
+			}
+		}
+	}
+
 
 	UINT32 SceneManager::encodeComponentId(UINT32 idx, UINT32 type)
 	{
@@ -531,6 +710,19 @@ namespace bs
 		type = id >> 30;
 	}
 
+	UINT32 SceneManager::encodeUpdateListId(UINT32 idx, bool parallel)
+	{
+		assert(idx <= (0x7FFFFFFF));
+
+		return ((parallel ? 1 : 0) << 31) | idx;
+	}
+
+	void SceneManager::decodeUpdateListId(UINT32 id, UINT32& idx, bool& parallel)
+	{
+		idx = id & 0x7FFFFFFF;
+		parallel = (id >> 31) != 0;
+	}
+
 	bool SceneManager::isComponentOfType(const HComponent& component, UINT32 rttiId)
 	{
 		return component->getRTTI()->getRTTIId() == rttiId;
@@ -540,12 +732,13 @@ namespace bs
 	{
 		processStateChanges();
 
-		// Note: Eventually perform updates based on component types and/or on component priority. Right now we just
-		// iterate in an undefined order, but it wouldn't be hard to change it.
+		{
+			ScopeToggle toggle(mDisableStateChange);
+			updateComponents(mUpdateLists[UpdateList], false);
+		}
 
-		ScopeToggle toggle(mDisableStateChange);
-		for (auto& entry : mActiveComponents)
-			entry->update();
+		// Make sure components destroyed during the update are removed from the update lists before they are freed
+		processStateChanges();
 
 		GameObjectManager::instance().destroyQueuedObjects();
 	}
@@ -555,8 +748,7 @@ namespace bs
 		processStateChanges();
 
 		ScopeToggle toggle(mDisableStateChange);
-		for (auto& entry : mActiveComponents)
-			entry->fixedUpdate();
+		updateComponents(mUpdateLists[FixedUpdateList], true);
 	}
 
 	void SceneManager::registerNewSO(const HSceneObject& node)
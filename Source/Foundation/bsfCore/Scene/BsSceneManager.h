@@ -111,6 +111,26 @@ namespace bs
 		/** Checks are the components currently in the Running state. */
 		bool isRunning() const { return mComponentState == ComponentState::Running; }
 
+		/**
+		 * Determines the order in which components of different types receive their update() and fixedUpdate() calls.
+		 * Types with lower priority are updated first, and types with the same priority are updated in the order of their
+		 * RTTI identifiers. All types have priority 0 by default.
+		 *
+		 * @param[in]	rttiId		RTTI identifier of the component type.
+		 * @param[in]	priority	Priority to assign to the component type.
+		 */
+		void setComponentUpdatePriority(UINT32 rttiId, INT32 priority);
+
+		/** @copydoc setComponentUpdatePriority(UINT32, INT32) */
+		template<class T>
+		void setComponentUpdatePriority(INT32 priority)
+		{
+			setComponentUpdatePriority(T::getRTTIStatic()->getRTTIId(), priority);
+		}
+
+		/** Returns the priority assigned with setComponentUpdatePriority(). */
+		INT32 getComponentUpdatePriority(UINT32 rttiId) const;
+
 		/**
 		 * Returns a list of all components of the specified type currently in the scene.
 		 *
@@ -161,10 +181,17 @@ namespace bs
 		/**	Notifies the scene manager that a camera either became the main camera, or has stopped being main camera. */
 		void _notifyMainCameraStateChanged(const SPtr<Camera>& camera);
 
-		/** Called every frame. Calls update methods on all scene objects and their components. */
+		/**
+		 * Called every frame. Calls update methods on all scene objects and their components. Components are updated
+		 * one type at a time, in the order determined by setComponentUpdatePriority(). Within each type, components with
+		 * the ComponentFlag::ParallelUpdate flag are updated first, in parallel, followed by the rest of the components.
+		 */
 		void _update();
 
-		/** Called at fixed time internals. Calls the fixed update method on all active components. */
+		/**
+		 * Called at fixed time internals. Calls the fixed update method on all active components, in the same order as
+		 * _update().
+		 */
 		void _fixedUpdate();
 
 		/** Updates dirty transforms on any core objects that may be tied with scene objects. */
@@ -206,6 +233,25 @@ namespace bs
 			ComponentStateEventType type;
 		};
 
+		/** Active components of a single type that receive a particular type of update call. */
+		struct ComponentUpdateBucket
+		{
+			UINT32 typeId = 0;
+			INT32 priority = 0;
+			Vector<Component*> components;
+			Vector<Component*> parallelComponents;
+		};
+
+		/**
+		 * Components that receive a particular type of update call, grouped in per-type buckets. Buckets are kept
+		 * sorted in the order they are to be updated in.
+		 */
+		struct ComponentUpdateList
+		{
+			Vector<ComponentUpdateBucket> buckets;
+			UnorderedMap<UINT32, UINT32> bucketLookup;
+		};
+
 		friend class SceneObject;
 
 		/**
@@ -236,6 +282,23 @@ namespace bs
 		/** Iterates over components that had their state modified and moves them to the appropriate state lists. */
 		void processStateChanges();
 
+		/** Registers an active component with the update lists for each of the update types it didn't opt out of. */
+		void addToUpdateLists(Component* component);
+
+		/** Removes a component from any update lists it was registered with. */
+		void removeFromUpdateLists(Component* component);
+
+		/** Sorts the buckets of the provided update list in the order they should be updated in. */
+		void sortUpdateBuckets(ComponentUpdateList& list);
+
+		/**
+		 * Calls update() or fixedUpdate() on all components in the provided update list.
+		 *
+		 * @param[in]	list		List of components to update.
+		 * @param[in]	fixed		If true fixedUpdate() is called, otherwise update() is called.
+		 */
+		void updateComponents(ComponentUpdateList& list, bool fixed);
+
 		/**
 		 * Encodes an index and a type into a single 32-bit integer. Top 2 bits represent the type, while the rest represent
 		 * the index.
@@ -245,6 +308,15 @@ namespace bs
 		/** Decodes an id encoded with encodeComponentId(). */
 		static void decodeComponentId(UINT32 id, UINT32& idx, UINT32& type);
 
+		/**
+		 * Encodes an index into a bucket of ComponentUpdateList, and a flag determining if the component is in the
+		 * parallel list, into a single 32-bit integer.
+		 */
+		static UINT32 encodeUpdateListId(UINT32 idx, bool parallel);
+
+		/** Decodes an id encoded with encodeUpdateListId(). */
+		static void decodeUpdateListId(UINT32 id, UINT32& idx, bool& parallel);
+
 		/** Checks does the specified component type match the provided RTTI id. */
 		static bool isComponentOfType(const HComponent& component, UINT32 rttiId);
 
@@ -262,6 +334,9 @@ namespace bs
 		std::array<Vector<HComponent>*, 3> mComponentsPerState =
 			{ { &mActiveComponents, &mInactiveComponents, &mUninitializedComponents } };
 
+		std::array<ComponentUpdateList, 2> mUpdateLists;
+		UnorderedMap<UINT32, INT32> mUpdatePriorities;
+
 		SPtr<RenderTarget> mMainRT;
 		HEvent mMainRTResizedConn;
 
@@ -6,6 +6,7 @@
 #include "Error/BsException.h"
 #include "Debug/BsDebug.h"
 #include "Private/RTTI/BsSceneObjectRTTI.h"
+#include "Serialization/BsMemberwiseCloner.h"
 #include "Serialization/BsBinarySerializer.h"
 #include "FileSystem/BsDataStream.h"
 #include "Scene/BsGameObjectManager.h"
@@ -763,10 +764,6 @@ namespace bs
 		else
 			_unsetFlags(SOF_DontInstantiate);
 
-		SPtr<MemoryDataStream> stream = bs_shared_ptr_new<MemoryDataStream>();
-		BinarySerializer serializer;
-		serializer.encode(this, stream);
-
 		int flags = GODM_RestoreExternal | GODM_UseNewIds;
 		if(!preserveUUIDs)
 			flags |= GODM_UseNewUUID;
@@ -774,9 +771,8 @@ namespace bs
 		CoreSerializationContext serzContext;
 		serzContext.goState = bs_shared_ptr_new<GameObjectDeserializationState>(flags);
 
-		stream->seek(0);
-		SPtr<SceneObject> cloneObj = std::static_pointer_cast<SceneObject>(
-			serializer.decode(stream, (UINT32)stream->size(), BinarySerializerFlag::None, &serzContext));
+		MemberwiseCloner cloner;
+		SPtr<SceneObject> cloneObj = std::static_pointer_cast<SceneObject>(cloner.clone(this, false, &serzContext));
 
 		if(isInstantiated)
 			_unsetFlags(SOF_DontInstantiate);
@@ -786,6 +782,53 @@ namespace bs
 		return cloneObj->mThisHandle;
 	}
 
+	Vector<HSceneObject> SceneObject::cloneMultiple(UINT32 count, bool instantiate)
+	{
+		Vector<HSceneObject> output;
+		output.reserve(count);
+
+		const bool isInstantiated = !hasFlag(SOF_DontInstantiate);
+
+		// Instantiation is handled below, once all the copies are created
+		_setFlags(SOF_DontInstantiate);
+
+		// All copies share a single deserialization state, with each copy mapping the original IDs separately. Marking
+		// the deserialization as active ensures none of the copies resolves its handles as soon as it's cloned, instead
+		// they are all resolved in a single pass once every copy exists.
+		SPtr<GameObjectDeserializationState> goState = bs_shared_ptr_new<GameObjectDeserializationState>(
+			GODM_RestoreExternal | GODM_UseNewIds | GODM_UseNewUUID);
+
+		CoreSerializationContext serzContext;
+		serzContext.goState = goState;
+		serzContext.goDeserializationActive = true;
+
+		// A single cloner reuses its internal storage between the copies
+		MemberwiseCloner cloner;
+		for(UINT32 i = 0; i < count; i++)
+		{
+			if(i > 0)
+				goState->beginCopy();
+
+			SPtr<SceneObject> cloneObj = std::static_pointer_cast<SceneObject>(cloner.clone(this, false, &serzContext));
+			output.push_back(cloneObj->mThisHandle);
+		}
+
+		if(isInstantiated)
+			_unsetFlags(SOF_DontInstantiate);
+
+		goState->resolve();
+
+		for(auto& cloneObj : output)
+		{
+			cloneObj->setActiveHierarchy(true, false);
+
+			if(instantiate)
+				cloneObj->_instantiate();
+		}
+
+		return output;
+	}
+
 	HComponent SceneObject::getComponent(RTTITypeBase* type) const
 	{
 		if(type != Component::getRTTIStatic())
@@ -832,7 +875,7 @@ namespace bs
 			if(x.isDestroyed())
 				return false;
 
-			return x._getHandleData()->mPtr->object.get() == component; }
+			return x.get() == component; }
 		);
 
 		if(iterFind != mComponents.end())
@@ -446,6 +446,16 @@ namespace bs
 		 */
 		HSceneObject clone(bool instantiate = true, bool preserveUUIDs = false);
 
+		/**
+		 * Makes @p count deep copies of this object. Game object handles of all the copies are resolved in a single pass
+		 * once every copy has been created. Each cloned game object is assigned a brand new UUID.
+		 *
+		 * @param[in]	count			Number of copies to create.
+		 * @param[in]	instantiate		If false, the cloned hierarchies will just be a memory copy, but will not be present
+		 *								in the scene or otherwise active until instantiate() is called.
+		 */
+		Vector<HSceneObject> cloneMultiple(UINT32 count, bool instantiate = true);
+
 	private:
 		SPtr<SceneInstance> mParentScene;
 		HSceneObject mParent;
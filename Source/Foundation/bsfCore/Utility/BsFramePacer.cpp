@@ -0,0 +1,113 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#include "Utility/BsFramePacer.h"
+#include "Math/BsMath.h"
+
+namespace bs
+{
+	/** Weight of the newest sample in the moving averages. */
+	static constexpr float AVERAGE_WEIGHT = 0.1f;
+
+	/** Extra time in microseconds by which the sim thread aims to finish before the core thread. */
+	static constexpr float PACING_MARGIN = 500.0f;
+
+	void FramePacer::FrameTimeAverage::addSample(UINT64 time)
+	{
+		if (!hasSamples)
+		{
+			average = (float)time;
+			deviation = 0.0f;
+			hasSamples = true;
+			return;
+		}
+
+		const float error = (float)time - average;
+		average += error * AVERAGE_WEIGHT;
+		deviation += (Math::abs(error) - deviation) * AVERAGE_WEIGHT;
+	}
+
+	void FramePacer::waitForFrameStart()
+	{
+		UINT64 startTime = getTime();
+
+		if (mFrameStep > 0)
+			startTime = std::max(startTime, mFrameStartTime + mFrameStep);
+
+		if (mHasSubmitted)
+			startTime = std::max(startTime, mLastSubmitTime + getFrameStartDelay());
+
+		waitUntil(startTime);
+		mFrameStartTime = getTime();
+	}
+
+	void FramePacer::notifySimFrameEnd()
+	{
+		mSimTime.addSample(getTime() - mFrameStartTime);
+	}
+
+	void FramePacer::notifyFrameSubmitted(UINT64 prevFrameFinishTime)
+	{
+		const UINT64 submitTime = getTime();
+
+		// Core thread starts rendering a frame as soon as it is submitted, since the threads run in lockstep
+		if (mHasSubmitted && prevFrameFinishTime > mLastSubmitTime)
+			mCoreTime.addSample(prevFrameFinishTime - mLastSubmitTime);
+
+		mInputLatency = submitTime - mFrameStartTime;
+		if (mHasSubmitted)
+			mAvgInputLatency += ((float)mInputLatency - mAvgInputLatency) * AVERAGE_WEIGHT;
+		else
+			mAvgInputLatency = (float)mInputLatency;
+
+		mLastSubmitTime = submitTime;
+		mHasSubmitted = true;
+	}
+
+	UINT64 FramePacer::getFrameStartDelay() const
+	{
+		if (!mAdaptive || !mSimTime.hasSamples || !mCoreTime.hasSamples)
+			return 0;
+
+		// Aim for the sim thread to finish before the core thread even if the sim frame runs long and the core frame
+		// runs short
+		const float shortCoreTime = mCoreTime.average - mCoreTime.deviation * 2.0f;
+		const float longSimTime = mSimTime.average + mSimTime.deviation * 2.0f;
+
+		const float delay = shortCoreTime - longSimTime - PACING_MARGIN;
+		if (delay <= 0.0f)
+			return 0;
+
+		return (UINT64)delay;
+	}
+
+	void FramePacer::waitUntil(UINT64 time)
+	{
+		UINT64 currentTime = getTime();
+		while (time > currentTime)
+		{
+			const UINT64 waitTime = time - currentTime;
+
+			// Sleep as long as the sleep won't overshoot the target time, taking into account how much longer than
+			// requested sleeps tend to take
+			const float sleepTime = (float)waitTime - mSleepOvershoot;
+			if (sleepTime >= 1000.0f)
+			{
+				const UINT32 sleepMs = (UINT32)(sleepTime / 1000.0f);
+				BS_THREAD_SLEEP(sleepMs);
+
+				const UINT64 newTime = getTime();
+				const float overshoot = std::max(0.0f, (float)(newTime - currentTime) - sleepMs * 1000.0f);
+				mSleepOvershoot += (overshoot - mSleepOvershoot) * AVERAGE_WEIGHT;
+
+				currentTime = newTime;
+			}
+			else
+			{
+				// Sleep timer granularity is too low for the remaining time, so yield until the target time is reached.
+				// Note: For mobiles where power might be more important than input latency, consider sleeping instead.
+				std::this_thread::yield();
+				currentTime = getTime();
+			}
+		}
+	}
+}
@@ -0,0 +1,111 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "BsCorePrerequisites.h"
+#include "Utility/BsTimer.h"
+
+namespace bs
+{
+	/** @addtogroup Utility-Core-Internal
+	 *  @{
+	 */
+
+	/**
+	 * Decides when the sim thread should start a new frame. Enforces an optional frame rate limit, and when the core
+	 * thread takes longer to render a frame than the sim thread takes to produce one, delays the start of the sim frame
+	 * so both threads finish at nearly the same time. This way input is sampled as late as possible, reducing the time
+	 * between input being sampled and the frame using it being submitted for rendering.
+	 *
+	 * Sim and core frame times are tracked as moving averages along with their mean deviation, and the delay is picked
+	 * so the sim thread is still likely to finish before the core thread does.
+	 *
+	 * @note	Methods are to be called from the sim thread, unless noted otherwise.
+	 */
+	class BS_CORE_EXPORT FramePacer
+	{
+	public:
+		/** Determines the minimum time between the start of two frames, in microseconds. 0 means no limit. */
+		void setFrameStep(UINT64 step) { mFrameStep = step; }
+
+		/** @copydoc setFrameStep */
+		UINT64 getFrameStep() const { return mFrameStep; }
+
+		/** Determines should the sim frame start be delayed to match the core thread frame time. */
+		void setAdaptive(bool enabled) { mAdaptive = enabled; }
+
+		/** @copydoc setAdaptive */
+		bool isAdaptive() const { return mAdaptive; }
+
+		/** Returns the current time in microseconds, as used by the pacer. Thread safe. */
+		UINT64 getTime() const { return mTimer.getMicroseconds(); }
+
+		/**
+		 * Blocks until the next sim frame should start, respecting the frame rate limit and the delay required for the
+		 * sim thread to finish together with the core thread. Should be called right before input is sampled.
+		 */
+		void waitForFrameStart();
+
+		/** Notifies the pacer the sim thread is done with its work for the frame, and is about to wait on the core thread. */
+		void notifySimFrameEnd();
+
+		/**
+		 * Notifies the pacer the current frame was submitted to the core thread.
+		 *
+		 * @param[in]	prevFrameFinishTime		Time at which the core thread finished rendering the previously submitted
+		 *										frame, as reported by getTime().
+		 */
+		void notifyFrameSubmitted(UINT64 prevFrameFinishTime);
+
+		/** Returns the amount of time the start of the next sim frame will be delayed by, in microseconds. */
+		UINT64 getFrameStartDelay() const;
+
+		/** Returns the time from the start of the last frame (when input was sampled) until its submission, in microseconds. */
+		UINT64 getInputLatency() const { return mInputLatency; }
+
+		/** Returns the moving average of the input to submit latency, in microseconds. */
+		float getAverageInputLatency() const { return mAvgInputLatency; }
+
+		/** Returns the moving average of the time the sim thread spends on a frame, in microseconds. */
+		float getAverageSimTime() const { return mSimTime.average; }
+
+		/** Returns the moving average of the time the core thread spends on a frame, in microseconds. */
+		float getAverageCoreTime() const { return mCoreTime.average; }
+
+		/**
+		 * Blocks until the specified time. Sleeps for as long as the sleep timer granularity allows for, and yields for
+		 * the remainder of the time.
+		 */
+		void waitUntil(UINT64 time);
+
+	private:
+		/** Moving average of a frame time along with its mean deviation from the average. */
+		struct FrameTimeAverage
+		{
+			/** Adds a new sample to the average. */
+			void addSample(UINT64 time);
+
+			float average = 0.0f;
+			float deviation = 0.0f;
+			bool hasSamples = false;
+		};
+
+		Timer mTimer;
+		UINT64 mFrameStep = 0;
+		bool mAdaptive = true;
+
+		UINT64 mFrameStartTime = 0;
+		UINT64 mLastSubmitTime = 0;
+		bool mHasSubmitted = false;
+
+		FrameTimeAverage mSimTime;
+		FrameTimeAverage mCoreTime;
+		UINT64 mInputLatency = 0;
+		float mAvgInputLatency = 0.0f;
+
+		// Assume a coarse sleep granularity until measured otherwise
+		float mSleepOvershoot = 1000.0f;
+	};
+
+	/** @} */
+}
@@ -0,0 +1,195 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#include "Utility/BsSystemGraph.h"
+#include "Threading/BsTaskScheduler.h"
+#include "Profiling/BsProfilerCPU.h"
+#include "Utility/BsTimer.h"
+
+namespace bs
+{
+	/** Checks if any of the entries in @p a are also present in @p b. */
+	static bool intersects(const Vector<String>& a, const Vector<String>& b)
+	{
+		for (auto& entry : a)
+		{
+			if (std::find(b.begin(), b.end(), entry) != b.end())
+				return true;
+		}
+
+		return false;
+	}
+
+	void SystemGraph::addSystem(const String& name, std::function<void()> callback, const Vector<String>& reads,
+		const Vector<String>& writes, SystemFlags flags)
+	{
+		System system;
+		system.name = name;
+		system.callback = std::move(callback);
+		system.reads = reads;
+		system.writes = writes;
+		system.flags = flags;
+
+		mSystems.push_back(std::move(system));
+		mDependenciesDirty = true;
+	}
+
+	void SystemGraph::clear()
+	{
+		mSystems.clear();
+		mDependenciesDirty = true;
+	}
+
+	const Vector<UINT32>& SystemGraph::getDependencies(UINT32 idx)
+	{
+		if (mDependenciesDirty)
+			buildDependencies();
+
+		return mSystems[idx].dependencies;
+	}
+
+	void SystemGraph::buildDependencies()
+	{
+		const UINT32 numSystems = (UINT32)mSystems.size();
+		for (auto& system : mSystems)
+		{
+			system.dependencies.clear();
+			system.dependents.clear();
+		}
+
+		for (UINT32 i = 0; i < numSystems; i++)
+		{
+			System& system = mSystems[i];
+			for (UINT32 j = 0; j < i; j++)
+			{
+				System& other = mSystems[j];
+
+				bool conflicts = intersects(system.writes, other.writes) || intersects(system.writes, other.reads) ||
+					intersects(system.reads, other.writes);
+
+				if (!conflicts)
+					continue;
+
+				system.dependencies.push_back(j);
+				other.dependents.push_back(i);
+			}
+		}
+
+		mDependenciesDirty = false;
+	}
+
+	void SystemGraph::execute()
+	{
+		if (mDependenciesDirty)
+			buildDependencies();
+
+		const UINT32 numSystems = (UINT32)mSystems.size();
+		if (numSystems == 0)
+			return;
+
+		// Length of the longest chain of work that has to follow each system, based on the timings from the last
+		// execution. Main thread systems with the longest chain are executed first, so the systems that depend on them
+		// can start as soon as possible.
+		for (UINT32 i = numSystems; i > 0; i--)
+		{
+			System& system = mSystems[i - 1];
+
+			UINT64 longestDependent = 0;
+			for (auto& dependentIdx : system.dependents)
+				longestDependent = std::max(longestDependent, mSystems[dependentIdx].criticalPath);
+
+			// Each system counts as at least a microsecond so the graph structure is respected before timings are known
+			system.criticalPath = std::max(system.duration, (UINT64)1) + longestDependent;
+		}
+
+		mUseTasks = TaskScheduler::isStarted();
+		mNumCompleted = 0;
+		mMainThreadQueue.clear();
+
+		for (auto& system : mSystems)
+			system.numPendingDependencies = (UINT32)system.dependencies.size();
+
+		{
+			Lock lock(mMutex);
+			for (UINT32 i = 0; i < numSystems; i++)
+			{
+				if (mSystems[i].dependencies.empty())
+					scheduleSystem(i);
+			}
+		}
+
+		while (true)
+		{
+			UINT32 systemIdx = (UINT32)-1;
+
+			{
+				Lock lock(mMutex);
+
+				// Lend this thread's core to the task scheduler while waiting on other systems
+				while (mMainThreadQueue.empty() && mNumCompleted < numSystems)
+				{
+					TaskScheduler::instance().addWorker();
+					mCondition.wait(lock);
+					TaskScheduler::instance().removeWorker();
+				}
+
+				if (mNumCompleted == numSystems)
+					break;
+
+				auto iterFind = std::max_element(mMainThreadQueue.begin(), mMainThreadQueue.end(),
+					[this](UINT32 a, UINT32 b)
+				{
+					return mSystems[a].criticalPath < mSystems[b].criticalPath;
+				});
+
+				systemIdx = *iterFind;
+				mMainThreadQueue.erase(iterFind);
+			}
+
+			runSystem(systemIdx);
+		}
+
+		if (ProfilerCPU::isStarted())
+		{
+			for (auto& system : mSystems)
+				gProfilerCPU().addSample(system.name.c_str(), system.duration / 1000.0);
+		}
+	}
+
+	void SystemGraph::runSystem(UINT32 idx)
+	{
+		System& system = mSystems[idx];
+
+		Timer timer;
+		system.callback();
+		system.duration = timer.getMicroseconds();
+
+		Lock lock(mMutex);
+		for (auto& dependentIdx : system.dependents)
+		{
+			System& dependent = mSystems[dependentIdx];
+
+			dependent.numPendingDependencies--;
+			if (dependent.numPendingDependencies == 0)
+				scheduleSystem(dependentIdx);
+		}
+
+		mNumCompleted++;
+		mCondition.notify_all();
+	}
+
+	void SystemGraph::scheduleSystem(UINT32 idx)
+	{
+		System& system = mSystems[idx];
+
+		if (mUseTasks && !system.flags.isSet(SystemFlag::MainThread))
+		{
+			SPtr<Task> task = Task::create(system.name, [this, idx]() { runSystem(idx); }, TaskPriority::High);
+			TaskScheduler::instance().addTask(task);
+		}
+		else
+		{
+			mMainThreadQueue.push_back(idx);
+			mCondition.notify_all();
+		}
+	}
+}
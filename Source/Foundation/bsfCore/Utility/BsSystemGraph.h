@@ -0,0 +1,111 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "BsCorePrerequisites.h"
+#include "Utility/BsFlags.h"
+
+namespace bs
+{
+	/** @addtogroup Utility-Core-Internal
+	 *  @{
+	 */
+
+	/** Flags that control how a system in a SystemGraph is executed. */
+	enum class SystemFlag
+	{
+		/** System can only be executed on the thread calling SystemGraph::execute(). */
+		MainThread = 1 << 0
+	};
+
+	typedef Flags<SystemFlag> SystemFlags;
+	BS_FLAGS_OPERATORS(SystemFlag)
+
+	/**
+	 * Executes a set of per-frame systems, running systems that don't depend on each other concurrently using the
+	 * TaskScheduler.
+	 *
+	 * Each system declares which named pieces of engine state (e.g. "Scene" or "Audio") it reads from and writes to.
+	 * A system depends on all previously added systems that write to state it accesses, or that access state it writes
+	 * to. This ensures the results are the same as when executing the systems one after another in the order they were
+	 * added, while systems with no conflicting accesses are free to overlap.
+	 *
+	 * @note	Not thread safe. Systems must be added and the graph executed from the same thread.
+	 */
+	class BS_CORE_EXPORT SystemGraph
+	{
+	public:
+		/**
+		 * Registers a new system that will get executed on every call to execute().
+		 *
+		 * @param[in]	name		Unique name of the system. Used for identifying the system in profiler reports.
+		 * @param[in]	callback	Callback that performs the system's work.
+		 * @param[in]	reads		Names of the state the system reads from.
+		 * @param[in]	writes		Names of the state the system writes to. State that is both read and written only needs
+		 *							to be listed here.
+		 * @param[in]	flags		Flags that control how the system is executed. Systems that run user code or access
+		 *							thread-unsafe state should be kept on the main thread.
+		 */
+		void addSystem(const String& name, std::function<void()> callback, const Vector<String>& reads,
+			const Vector<String>& writes, SystemFlags flags = SystemFlag::MainThread);
+
+		/** Removes all registered systems. */
+		void clear();
+
+		/**
+		 * Executes all the registered systems and blocks until they complete. Main thread systems are executed on the
+		 * calling thread, while others are queued on the TaskScheduler. Time spent in each system is reported to the
+		 * ProfilerCPU, if active.
+		 */
+		void execute();
+
+		/** Returns the number of registered systems. */
+		UINT32 getNumSystems() const { return (UINT32)mSystems.size(); }
+
+		/** Returns the name of the system at the specified index. */
+		const String& getName(UINT32 idx) const { return mSystems[idx].name; }
+
+		/** Returns indices of the systems that must complete before the system at the specified index can start. */
+		const Vector<UINT32>& getDependencies(UINT32 idx);
+
+		/** Returns the time the system at the specified index took during the last execute() call, in microseconds. */
+		UINT64 getLastDuration(UINT32 idx) const { return mSystems[idx].duration; }
+
+	private:
+		/** Information about a single registered system. */
+		struct System
+		{
+			String name;
+			std::function<void()> callback;
+			Vector<String> reads;
+			Vector<String> writes;
+			SystemFlags flags;
+
+			Vector<UINT32> dependencies;
+			Vector<UINT32> dependents;
+			UINT64 duration = 0;
+			UINT64 criticalPath = 0;
+			UINT32 numPendingDependencies = 0;
+		};
+
+		/** Determines dependencies between systems, based on their declared accesses. */
+		void buildDependencies();
+
+		/** Executes the system at the specified index and schedules any dependents that become ready. */
+		void runSystem(UINT32 idx);
+
+		/** Queues the system for execution, either on the main thread or on the TaskScheduler. */
+		void scheduleSystem(UINT32 idx);
+
+		Vector<System> mSystems;
+		bool mDependenciesDirty = false;
+		bool mUseTasks = false;
+
+		Mutex mMutex;
+		Signal mCondition;
+		Vector<UINT32> mMainThreadQueue;
+		UINT32 mNumCompleted = 0;
+	};
+
+	/** @} */
+}
@@ -11,12 +11,14 @@ namespace bs
 	CGUIWidget::CGUIWidget()
 	{
 		setFlag(ComponentFlag::AlwaysRun, true);
+		setFlag(ComponentFlag::NoFixedUpdate, true);
 	}
 
 	CGUIWidget::CGUIWidget(const HSceneObject& parent, const SPtr<Camera>& camera)
 		:Component(parent), mCamera(camera), mParentHash((UINT32)-1)
 	{
 		setFlag(ComponentFlag::AlwaysRun, true);
+		setFlag(ComponentFlag::NoFixedUpdate, true);
 
 		mInternal = GUIWidget::create(camera);
 		mOwnerTargetResizedConn = mInternal->onOwnerTargetResized.connect(
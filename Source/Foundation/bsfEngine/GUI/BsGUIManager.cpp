@@ -38,6 +38,7 @@
 #include "Managers/BsRenderStateManager.h"
 #include "Resources/BsBuiltinResources.h"
 #include "2D/BsSpriteManager.h"
+#include "Managers/BsTextureStreamingManager.h"
 
 using namespace std::placeholders;
 
@@ -1577,6 +1578,21 @@ namespace bs
 	{
 	GUISpriteParamBlockDef gGUISpriteParamBlockDef;
 
+	/**
+	 * Reports a texture drawn by the GUI to the TextureStreamingManager. GUI elements display their textures at roughly
+	 * their native size, so all of the mip levels are required.
+	 */
+	static void reportTextureUsage(const SPtr<Texture>& texture)
+	{
+		if (texture == nullptr || texture->getStreamingId() == 0)
+			return;
+
+		const TextureProperties& props = texture->getProperties();
+		const float size = (float)std::max(props.getWidth(), props.getHeight());
+
+		TextureStreamingManager::instance().notifyUsage(texture->getStreamingId(), size);
+	}
+
 	GUIRenderer::GUIRenderer()
 		:RendererExtension(RenderLocation::Overlay, 10)
 	{ }
@@ -1631,6 +1647,22 @@ namespace bs
 		float invViewportHeight = 1.0f / (camera.getViewport()->getPixelArea().height * 0.5f);
 		bool viewflipYFlip = gCaps().conventions.ndcYAxis == Conventions::Axis::Down;
 
+		// Elements in cached draw groups are reported even when the group isn't redrawn, since it keeps displaying them
+		if (TextureStreamingManager::isStarted())
+		{
+			for (auto& widget : widgetRenderData)
+			{
+				for (auto& drawGroup : widget.drawGroups)
+				{
+					for (auto& entry : drawGroup.cachedElements)
+						reportTextureUsage(entry.texture);
+
+					for (auto& entry : drawGroup.nonCachedElements)
+						reportTextureUsage(entry.texture);
+				}
+			}
+		}
+
 		RenderAPI& rapi = RenderAPI::instance();
 		for (auto& widget : widgetRenderData)
 		{
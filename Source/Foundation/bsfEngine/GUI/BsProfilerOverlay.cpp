@@ -435,6 +435,7 @@ namespace bs
 		mGPUParamBindsStr = HEString(u8"__ProfOvGpuParamBinds", u8"GPU parameter binds: {0}");
 		mGPUVertexBufferBindsStr = HEString(u8"__ProfOvVBBinds", u8"VB binds: {0}");
 		mGPUIndexBufferBindsStr = HEString(u8"__ProfOvIBBinds", u8"IB binds: {0}");
+		mGPURedundantBindsStr = HEString(u8"__ProfOvRedundantBinds", u8"Redundant binds: {0}");
 
 		mGPUFrameNumLbl = GUILabel::create(mGPUFrameNumStr, GUIOptions(GUIOption::fixedWidth(200)));
 		mGPUTimeLbl = GUILabel::create(mGPUTimeStr, GUIOptions(GUIOption::fixedWidth(200)));
@@ -454,6 +455,7 @@ namespace bs
 		mGPUParamBindsLbl = GUILabel::create(mGPUParamBindsStr, GUIOptions(GUIOption::fixedWidth(200)));
 		mGPUVertexBufferBindsLbl = GUILabel::create(mGPUVertexBufferBindsStr, GUIOptions(GUIOption::fixedWidth(200)));
 		mGPUIndexBufferBindsLbl = GUILabel::create(mGPUIndexBufferBindsStr, GUIOptions(GUIOption::fixedWidth(200)));
+		mGPURedundantBindsLbl = GUILabel::create(mGPURedundantBindsStr, GUIOptions(GUIOption::fixedWidth(200)));
 
 		mGPULayoutFrameContentsLeft->addElement(mGPUFrameNumLbl);
 		mGPULayoutFrameContentsLeft->addElement(mGPUTimeLbl);
@@ -474,6 +476,7 @@ namespace bs
 		mGPULayoutFrameContentsRight->addElement(mGPUParamBindsLbl);
 		mGPULayoutFrameContentsRight->addElement(mGPUVertexBufferBindsLbl);
 		mGPULayoutFrameContentsRight->addElement(mGPUIndexBufferBindsLbl);
+		mGPULayoutFrameContentsRight->addElement(mGPURedundantBindsLbl);
 		mGPULayoutFrameContentsRight->addNewElement<GUIFlexibleSpace>();
 
 		updateCPUSampleAreaSizes();
@@ -729,6 +732,7 @@ namespace bs
 		mGPUParamBindsStr.setParameter(0, toString(frameSample.numGpuParamBinds));
 		mGPUVertexBufferBindsStr.setParameter(0, toString(frameSample.numVertexBufferBinds));
 		mGPUIndexBufferBindsStr.setParameter(0, toString(frameSample.numIndexBufferBinds));
+		mGPURedundantBindsStr.setParameter(0, toString(frameSample.numRedundantBinds));
 
 		mGPUFrameNumLbl->setContent(mGPUFrameNumStr);
 		mGPUTimeLbl->setContent(mGPUTimeStr);
@@ -748,6 +752,7 @@ namespace bs
 		mGPUParamBindsLbl->setContent(mGPUParamBindsStr);
 		mGPUVertexBufferBindsLbl->setContent(mGPUVertexBufferBindsStr);
 		mGPUIndexBufferBindsLbl->setContent(mGPUIndexBufferBindsStr);
+		mGPURedundantBindsLbl->setContent(mGPURedundantBindsStr);
 
 		GPUSampleRowFiller sampleRowFillers[GPU_NUM_SAMPLE_COLUMNS] =
 		{
@@ -191,6 +191,7 @@ namespace bs
 		GUILabel* mGPUParamBindsLbl = nullptr;
 		GUILabel* mGPUVertexBufferBindsLbl = nullptr;
 		GUILabel* mGPUIndexBufferBindsLbl = nullptr;
+		GUILabel* mGPURedundantBindsLbl = nullptr;
 
 		HString mGPUFrameNumStr;
 		HString mGPUTimeStr;
@@ -210,6 +211,7 @@ namespace bs
 		HString mGPUParamBindsStr;
 		HString mGPUVertexBufferBindsStr;
 		HString mGPUIndexBufferBindsStr;
+		HString mGPURedundantBindsStr;
 
 		Vector<BasicRow> mBasicRows;
 		Vector<PreciseRow> mPreciseRows;
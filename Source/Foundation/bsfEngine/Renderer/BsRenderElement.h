@@ -36,8 +36,12 @@ namespace bs { namespace ct
 		/** Renderer specific value that identifies the type of this renderable element. */
 		UINT32 type = 0;
 
-		/** Executes the draw call for the render element. */
-		virtual void draw() const = 0;
+		/**
+		 * Executes the draw call for the render element.
+		 *
+		 * @param[in]	lod		Level of detail to render the mesh at. Ignored by elements without levels of detail.
+		 */
+		virtual void draw(UINT32 lod = 0) const = 0;
 
 	protected:
 		~RenderElement() = default;
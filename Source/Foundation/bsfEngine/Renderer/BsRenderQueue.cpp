@@ -26,7 +26,7 @@ namespace bs { namespace ct
 		mSortedRenderElements.clear();
 	}
 
-	void RenderQueue::add(const RenderElement* element, float distFromCamera, UINT32 techniqueIdx)
+	void RenderQueue::add(const RenderElement* element, float distFromCamera, UINT32 techniqueIdx, UINT32 lod)
 	{
 		SPtr<Material> material = element->material;
 		SPtr<Shader> shader = material->getShader();
@@ -65,6 +65,7 @@ namespace bs { namespace ct
 			sortableElem.shaderId = shaderId;
 			sortableElem.techniqueIdx = techniqueIdx;
 			sortableElem.passIdx = i;
+			sortableElem.lod = lod;
 			sortableElem.distFromCamera = distFromCamera;
 
 			mElements.push_back(element);
@@ -110,6 +111,7 @@ namespace bs { namespace ct
 				sortedElem.renderElem = renderElem;
 				sortedElem.techniqueIdx = elem.techniqueIdx;
 				sortedElem.passIdx = elem.passIdx;
+				sortedElem.lod = elem.lod;
 
 				if (prevShaderId != elem.shaderId || prevTechniqueIdx != elem.techniqueIdx ||  prevPassIdx != elem.passIdx)
 				{
@@ -132,6 +134,7 @@ namespace bs { namespace ct
 					sortedElem.renderElem = renderElem;
 					sortedElem.techniqueIdx = elem.techniqueIdx;
 					sortedElem.passIdx = j;
+					sortedElem.lod = elem.lod;
 
 					if (prevShaderId != elem.shaderId || prevTechniqueIdx != elem.techniqueIdx || prevPassIdx != j)
 					{
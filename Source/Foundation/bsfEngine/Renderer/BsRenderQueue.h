@@ -28,6 +28,7 @@ namespace bs { namespace ct
 		const RenderElement* renderElem = nullptr;
 		UINT32 passIdx = 0;
 		UINT32 techniqueIdx = 0;
+		UINT32 lod = 0;
 		bool applyPass = true;
 	};
 
@@ -47,6 +48,7 @@ namespace bs { namespace ct
 			UINT32 shaderId;
 			UINT32 techniqueIdx;
 			UINT32 passIdx;
+			UINT32 lod;
 		};
 
 	public:
@@ -60,8 +62,9 @@ namespace bs { namespace ct
 		 * @param[in]	distFromCamera	Distance of this object from the camera. Used for distance sorting.
 		 * @param[in]	techniqueIdx	Index of the technique within @p element's material that's to be used to render the
 		 *								element with.
+		 * @param[in]	lod				Level of detail to render the element's mesh at.
 		 */
-		void add(const RenderElement* element, float distFromCamera, UINT32 techniqueIdx);
+		void add(const RenderElement* element, float distFromCamera, UINT32 techniqueIdx, UINT32 lod = 0);
 
 		/**	Clears all render operations from the queue. */
 		void clear();
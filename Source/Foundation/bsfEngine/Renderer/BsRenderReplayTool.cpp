@@ -0,0 +1,222 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#include "BsApplication.h"
+#include "BsEngineConfig.h"
+#include "Resources/BsBuiltinResources.h"
+#include "Material/BsMaterial.h"
+#include "Scene/BsSceneObject.h"
+#include "Components/BsCCamera.h"
+#include "Components/BsCRenderable.h"
+#include "Components/BsCLight.h"
+#include "RenderAPI/BsRenderAPI.h"
+#include "RenderAPI/BsRenderAPICapture.h"
+#include "RenderAPI/BsRenderWindow.h"
+#include "RenderAPI/BsViewport.h"
+#include "CoreThread/BsCoreThread.h"
+#include "Math/BsRandom.h"
+#include "Utility/BsTimer.h"
+#include "FileSystem/BsFileSystem.h"
+#include "FileSystem/BsDataStream.h"
+
+/**
+ * Renders a test scene, captures all render API calls made while rendering a single frame and reports statistics about
+ * them. The captured frame is then replayed multiple times to measure the CPU cost of issuing the calls on the render
+ * API, separately from the cost of the renderer producing them.
+ *
+ * Usage: bsfRenderReplayTool [--render-api <module>] [--objects <count>] [--frames <count>] [--replays <count>]
+ *                             [--save <file>] [--load <file>]
+ *
+ * Calls are captured before they reach the render API backend, so any backend can be used. --save writes the captured
+ * frame to a file, along with descriptions of the objects it references. --load replays such a file instead of
+ * rendering the scene, recreating the objects on the selected backend, so a frame captured on one backend can be
+ * replayed on another. GPU programs are recreated from their source, and must be in a language the backend accepts.
+ */
+int main(int argc, char * argv[])
+{
+	using namespace bs;
+
+	String renderAPI = "bsfNullRenderAPI";
+	UINT32 numObjects = 1000;
+	UINT32 numWarmupFrames = 3;
+	UINT32 numReplays = 100;
+	String savePath;
+	String loadPath;
+
+	for(int i = 1; i < argc; i++)
+	{
+		if(strcmp(argv[i], "--render-api") == 0 && i + 1 < argc)
+			renderAPI = argv[++i];
+		else if(strcmp(argv[i], "--objects") == 0 && i + 1 < argc)
+			numObjects = (UINT32)atoi(argv[++i]);
+		else if(strcmp(argv[i], "--frames") == 0 && i + 1 < argc)
+			numWarmupFrames = (UINT32)atoi(argv[++i]);
+		else if(strcmp(argv[i], "--replays") == 0 && i + 1 < argc)
+			numReplays = (UINT32)atoi(argv[++i]);
+		else if(strcmp(argv[i], "--save") == 0 && i + 1 < argc)
+			savePath = argv[++i];
+		else if(strcmp(argv[i], "--load") == 0 && i + 1 < argc)
+			loadPath = argv[++i];
+		else
+		{
+			printf("Usage: bsfRenderReplayTool [--render-api <module>] [--objects <count>] [--frames <count>] "
+				"[--replays <count>] [--save <file>] [--load <file>]\n");
+			return 2;
+		}
+	}
+
+	START_UP_DESC desc;
+	desc.renderAPI = renderAPI;
+	desc.renderer = BS_RENDERER_MODULE;
+	desc.audio = BS_AUDIO_MODULE;
+	desc.physics = BS_PHYSICS_MODULE;
+
+	desc.primaryWindowDesc.videoMode = VideoMode(1280, 720);
+	desc.primaryWindowDesc.fullscreen = false;
+	desc.primaryWindowDesc.title = "bsf render replay";
+	desc.primaryWindowDesc.hidden = true;
+
+	Application::startUp(desc);
+
+	SPtr<ct::RenderAPICapture> capture;
+	if(!loadPath.empty())
+	{
+		SPtr<DataStream> stream = FileSystem::openFile(loadPath);
+		if(stream == nullptr)
+		{
+			printf("Unable to open %s.\n", loadPath.c_str());
+			Application::shutDown();
+			return 1;
+		}
+
+		// Objects referenced by the capture are created on the core thread
+		gCoreThread().queueCommand([stream, &capture]() { capture = ct::RenderAPICapture::load(stream); },
+			CTQF_InternalQueue | CTQF_BlockUntilComplete);
+
+		if(capture == nullptr)
+		{
+			printf("Unable to load a capture from %s using %s.\n", loadPath.c_str(), renderAPI.c_str());
+			Application::shutDown();
+			return 1;
+		}
+
+		gApplication().beginMainLoop();
+	}
+	else
+	{
+		// Set up the scene
+		HSceneObject cameraSO = SceneObject::create("Camera");
+		cameraSO->setPosition(Vector3(0.0f, 20.0f, 60.0f));
+		cameraSO->lookAt(Vector3::ZERO);
+
+		HCamera camera = cameraSO->addComponent<CCamera>();
+		camera->getViewport()->setTarget(gApplication().getPrimaryWindow());
+		camera->setMain(true);
+
+		HSceneObject lightSO = SceneObject::create("Light");
+		lightSO->lookAt(Vector3(-1.0f, -1.0f, -1.0f));
+
+		HLight light = lightSO->addComponent<CLight>();
+		light->setType(LightType::Directional);
+
+		HMesh mesh = gBuiltinResources().getMesh(BuiltinMesh::Box);
+		HMaterial material = Material::create(gBuiltinResources().getBuiltinShader(BuiltinShader::Standard));
+
+		Random random(1);
+		for(UINT32 i = 0; i < numObjects; i++)
+		{
+			HSceneObject objectSO = SceneObject::create("Object");
+			objectSO->setPosition(random.getPointInSphere() * 40.0f);
+
+			HRenderable renderable = objectSO->addComponent<CRenderable>();
+			renderable->setMesh(mesh);
+			renderable->setMaterial(material);
+		}
+
+		// Let the renderer create its resources before capturing, so only the steady state frame is captured
+		gApplication().beginMainLoop();
+		for(UINT32 i = 0; i < numWarmupFrames; i++)
+		{
+			gApplication().runMainLoopFrame();
+			gApplication().waitUntilFrameFinished();
+		}
+
+		capture = bs_shared_ptr_new<ct::RenderAPICapture>();
+		gCoreThread().queueCommand([capture]() { ct::RenderAPI::instance()._setCapture(capture); });
+
+		gApplication().runMainLoopFrame();
+
+		gCoreThread().queueCommand([]() { ct::RenderAPI::instance()._setCapture(nullptr); });
+		gCoreThread().submitAll(true);
+		gApplication().waitUntilFrameFinished();
+
+		if(!savePath.empty())
+		{
+			SPtr<DataStream> stream = FileSystem::createAndOpenFile(savePath);
+			if(stream != nullptr)
+			{
+				gCoreThread().queueCommand([capture, stream]() { capture->save(stream); },
+					CTQF_InternalQueue | CTQF_BlockUntilComplete);
+				stream->close();
+			}
+			else
+				printf("Unable to save the capture to %s.\n", savePath.c_str());
+		}
+	}
+
+	const ct::RenderAPICaptureStats stats = capture->getStats();
+	int exitCode = 0;
+	if(stats.numCommands == 0)
+	{
+		printf("No calls were captured using %s.\n", renderAPI.c_str());
+		exitCode = 1;
+	}
+	else
+	{
+		if(!loadPath.empty())
+			printf("Loaded frame from %s using %s:\n", loadPath.c_str(), renderAPI.c_str());
+		else
+			printf("Captured frame with %u objects using %s:\n", numObjects, renderAPI.c_str());
+
+		printf("  Commands:        %u (%u bytes, %u referenced objects)\n", stats.numCommands, capture->getSize(),
+			capture->getNumObjects());
+		printf("  Draw calls:      %u\n", stats.numDrawCalls);
+		printf("  Compute calls:   %u\n", stats.numComputeCalls);
+		printf("  Clears:          %u\n", stats.numClears);
+		printf("  State changes:   %u\n", stats.numStateChanges);
+		printf("  Redundant binds: %u\n", stats.numRedundantBinds);
+		printf("  Param binds:     %u\n", stats.numParamBinds);
+		printf("  Buffer writes:   %u (%llu bytes)\n", stats.numBufferWrites, (unsigned long long)stats.bytesUploaded);
+
+		UINT64 totalTime = 0;
+		auto replay = [capture, numReplays, &totalTime]()
+		{
+			ct::RenderAPI& rapi = ct::RenderAPI::instance();
+
+			Timer timer;
+			for(UINT32 i = 0; i < numReplays; i++)
+			{
+				capture->replay();
+				rapi.submitCommandBuffer(rapi.getMainCommandBuffer());
+			}
+
+			totalTime = timer.getMicroseconds();
+		};
+
+		gCoreThread().queueCommand(replay, CTQF_InternalQueue | CTQF_BlockUntilComplete);
+
+		if(numReplays > 0)
+		{
+			printf("Replayed %u times: %.3f ms per frame\n", numReplays,
+				totalTime / (double)numReplays / 1000.0);
+		}
+	}
+
+	// Captured objects must be released on the core thread
+	gCoreThread().queueCommand([capture]() { capture->clear(); }, CTQF_InternalQueue | CTQF_BlockUntilComplete);
+	capture = nullptr;
+
+	gApplication().endMainLoop();
+	Application::shutDown();
+
+	return exitCode;
+}
@@ -14,10 +14,17 @@ namespace bs
 
 		// Note: Ideally I want to avoid loading all materials, and instead just load those that are used.
 		Vector<RendererMaterialData>& materials = getMaterials();
-		Vector<SPtr<ct::Shader>> shaders;
+
+		// Shaders are independent of each other, so issue all the loads at once and let them run on worker threads
+		Vector<HShader> loadedShaders;
+		loadedShaders.reserve(materials.size());
 		for (auto& material : materials)
+			loadedShaders.push_back(br.getShader(material.shaderPath, true));
+
+		Vector<SPtr<ct::Shader>> shaders;
+		for (auto& shader : loadedShaders)
 		{
-			HShader shader = br.getShader(material.shaderPath);
+			shader.blockUntilLoaded();
 			if (shader.isLoaded())
 				shaders.push_back(shader->getCore());
 			else
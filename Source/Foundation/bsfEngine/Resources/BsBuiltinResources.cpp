@@ -108,16 +108,50 @@ namespace bs
 
 		gResources().registerResourceManifest(mResourceManifest);
 
-		// Load basic resources
-		mShaderSpriteText = getShader(ShaderSpriteTextFile);
-		mShaderSpriteImage = getShader(ShaderSpriteImageFile);
-		mShaderSpriteLine = getShader(ShaderSpriteLineFile);
-		mShaderDiffuse = getShader(ShaderDiffuseFile);
-		mShaderTransparent = getShader(ShaderTransparentFile);
-		mShaderParticlesUnlit = getShader(ShaderParticlesUnlitFile);
-		mShaderParticlesLit = getShader(ShaderParticlesLitFile);
-		mShaderParticlesLitOpaque = getShader(ShaderParticlesLitOpaqueFile);
-		mShaderDecal = getShader(ShaderDecalFile);
+		// Start loading all the resources up front so they are read and deserialized in parallel on worker threads.
+		// Each resource is waited on (along with its dependencies) only once it is needed.
+		mShaderSpriteText = getShader(ShaderSpriteTextFile, true);
+		mShaderSpriteImage = getShader(ShaderSpriteImageFile, true);
+		mShaderSpriteLine = getShader(ShaderSpriteLineFile, true);
+		mShaderDiffuse = getShader(ShaderDiffuseFile, true);
+		mShaderTransparent = getShader(ShaderTransparentFile, true);
+		mShaderParticlesUnlit = getShader(ShaderParticlesUnlitFile, true);
+		mShaderParticlesLit = getShader(ShaderParticlesLitFile, true);
+		mShaderParticlesLitOpaque = getShader(ShaderParticlesLitOpaqueFile, true);
+		mShaderDecal = getShader(ShaderDecalFile, true);
+
+		mWhiteSpriteTexture = getSkinTexture(WhiteTex, true);
+		mFont = gResources().loadAsync<Font>(mBuiltinDataFolder + (String(DEFAULT_FONT_NAME) + u8".asset"));
+		mSkin = gResources().loadAsync<GUISkin>(mBuiltinDataFolder + (String(GUI_SKIN_FILE) + u8".json.asset"));
+
+		struct CursorLoad
+		{
+			const String& name;
+			SPtr<PixelData>& output;
+			HTexture texture;
+		};
+
+		CursorLoad cursors[] =
+		{
+			{ CursorArrowTex, mCursorArrow, HTexture() },
+			{ CursorArrowDragTex, mCursorArrowDrag, HTexture() },
+			{ CursorArrowLeftRightTex, mCursorArrowLeftRight, HTexture() },
+			{ CursorIBeamTex, mCursorIBeam, HTexture() },
+			{ CursorDenyTex, mCursorDeny, HTexture() },
+			{ CursorWaitTex, mCursorWait, HTexture() },
+			{ CursorSizeNESWTex, mCursorSizeNESW, HTexture() },
+			{ CursorSizeNSTex, mCursorSizeNS, HTexture() },
+			{ CursorSizeNWSETex, mCursorSizeNWSE, HTexture() },
+			{ CursorSizeWETex, mCursorSizeWE, HTexture() }
+		};
+
+		for (auto& cursor : cursors)
+			cursor.texture = getCursorTexture(cursor.name, true);
+
+		Path iconPath = mBuiltinDataFolder + ICON_FOLDER;
+		iconPath.append(String(IconTextureName) + u8".asset");
+
+		HTexture iconTex = gResources().loadAsync<Texture>(iconPath);
 
 		SPtr<PixelData> dummyPixelData = PixelData::create(2, 2, 1, PF_RGBA8);
 
@@ -127,96 +161,75 @@ namespace bs
 		dummyPixelData->setColorAt(Color::Red, 1, 1);
 
 		mDummyTexture = Texture::create(dummyPixelData);
-
-		mWhiteSpriteTexture = getSkinTexture(WhiteTex);
 		mDummySpriteTexture = SpriteTexture::create(mDummyTexture);
-
-		mFont = gResources().load<Font>(mBuiltinDataFolder + (String(DEFAULT_FONT_NAME) + u8".asset"));
-		mSkin = gResources().load<GUISkin>(mBuiltinDataFolder + (String(GUI_SKIN_FILE) + u8".json.asset"));
 		mEmptySkin = GUISkin::create();
 
 		/************************************************************************/
 		/* 								CURSOR		                     		*/
 		/************************************************************************/
 
-		HTexture cursorArrowTex = getCursorTexture(CursorArrowTex);
-		HTexture cursorArrowDragTex = getCursorTexture(CursorArrowDragTex);
-		HTexture cursorArrowLeftRightTex = getCursorTexture(CursorArrowLeftRightTex);
-		HTexture cursorIBeamTex = getCursorTexture(CursorIBeamTex);
-		HTexture cursorDenyTex = getCursorTexture(CursorDenyTex);
-		HTexture cursorWaitTex = getCursorTexture(CursorWaitTex);
-		HTexture cursorSizeNESWTex = getCursorTexture(CursorSizeNESWTex);
-		HTexture cursorSizeNSTex = getCursorTexture(CursorSizeNSTex);
-		HTexture cursorSizeNWSETex = getCursorTexture(CursorSizeNWSETex);
-		HTexture cursorSizeWETex = getCursorTexture(CursorSizeWETex);
-
-		mCursorArrow = cursorArrowTex->getProperties().allocBuffer(0, 0);
-		cursorArrowTex->readData(mCursorArrow);
-
-		mCursorArrowDrag = cursorArrowDragTex->getProperties().allocBuffer(0, 0);
-		cursorArrowDragTex->readData(mCursorArrowDrag);
-
-		mCursorArrowLeftRight = cursorArrowLeftRightTex->getProperties().allocBuffer(0, 0);
-		cursorArrowLeftRightTex->readData(mCursorArrowLeftRight);
-
-		mCursorIBeam = cursorIBeamTex->getProperties().allocBuffer(0, 0);
-		cursorIBeamTex->readData(mCursorIBeam);
-
-		mCursorDeny = cursorDenyTex->getProperties().allocBuffer(0, 0);
-		cursorDenyTex->readData(mCursorDeny);
-
-		mCursorWait = cursorWaitTex->getProperties().allocBuffer(0, 0);
-		cursorWaitTex->readData(mCursorWait);
-
-		mCursorSizeNESW = cursorSizeNESWTex->getProperties().allocBuffer(0, 0);
-		cursorSizeNESWTex->readData(mCursorSizeNESW);
-
-		mCursorSizeNS = cursorSizeNSTex->getProperties().allocBuffer(0, 0);
-		cursorSizeNSTex->readData(mCursorSizeNS);
-
-		mCursorSizeNWSE = cursorSizeNWSETex->getProperties().allocBuffer(0, 0);
-		cursorSizeNWSETex->readData(mCursorSizeNWSE);
+		for (auto& cursor : cursors)
+		{
+			cursor.texture.blockUntilLoaded();
 
-		mCursorSizeWE = cursorSizeWETex->getProperties().allocBuffer(0, 0);
-		cursorSizeWETex->readData(mCursorSizeWE);
+			cursor.output = cursor.texture->getProperties().allocBuffer(0, 0);
+			cursor.texture->readData(cursor.output);
+		}
 
 		/************************************************************************/
 		/* 								ICON		                     		*/
 		/************************************************************************/
 
-		Path iconPath = mBuiltinDataFolder + ICON_FOLDER;
-		iconPath.append(String(IconTextureName) + u8".asset");
-
-		HTexture iconTex = gResources().load<Texture>(iconPath);
+		iconTex.blockUntilLoaded();
 
 		mFrameworkIcon = iconTex->getProperties().allocBuffer(0, 0);
 		iconTex->readData(mFrameworkIcon);
 
+		// Remaining resources are used by other modules right after start up, so make sure they are done loading
+		const HResource pending[] =
+		{
+			mShaderSpriteText, mShaderSpriteImage, mShaderSpriteLine, mShaderDiffuse, mShaderTransparent,
+			mShaderParticlesUnlit, mShaderParticlesLit, mShaderParticlesLitOpaque, mShaderDecal,
+			mWhiteSpriteTexture, mFont, mSkin
+		};
+
+		for (auto& resource : pending)
+			resource.blockUntilLoaded();
+
 		gCoreThread().submit(true);
 	}
 
-	HSpriteTexture BuiltinResources::getSkinTexture(const String& name) const
+	HSpriteTexture BuiltinResources::getSkinTexture(const String& name, bool async) const
 	{
 		Path texturePath = mEngineSkinSpritesFolder;
 		texturePath.append(u8"sprite_" + name + u8".asset");
 
+		if (async)
+			return gResources().loadAsync<SpriteTexture>(texturePath);
+
 		return gResources().load<SpriteTexture>(texturePath);
 	}
 
-	HShader BuiltinResources::getShader(const Path& path) const
+	HShader BuiltinResources::getShader(const Path& path, bool async) const
 	{
 		Path programPath = mEngineShaderFolder;
 		programPath.append(path);
 		programPath.setExtension(programPath.getExtension() + ".asset");
 
+		if (async)
+			return gResources().loadAsync<Shader>(programPath);
+
 		return gResources().load<Shader>(programPath);
 	}
 
-	HTexture BuiltinResources::getCursorTexture(const String& name) const
+	HTexture BuiltinResources::getCursorTexture(const String& name, bool async) const
 	{
 		Path cursorPath = mEngineCursorFolder;
 		cursorPath.append(name + u8".asset");
 
+		if (async)
+			return gResources().loadAsync<Texture>(cursorPath);
+
 		return gResources().load<Texture>(cursorPath);
 	}
 
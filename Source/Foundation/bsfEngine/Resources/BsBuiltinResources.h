@@ -126,8 +126,10 @@ namespace bs
 		 * Loads a shader at the specified path.
 		 *
 		 * @param[in]	path	Path relative to the default shader folder with no file extension.
+		 * @param[in]	async	If true the shader is loaded asynchronously, and the returned handle must be waited on
+		 *						using ResourceHandle::blockUntilLoaded() before the shader is used.
 		 */
-		HShader getShader(const Path& path) const;
+		HShader getShader(const Path& path, bool async = false) const;
 
 		/** Returns the default font used by the engine. */
 		HFont getDefaultFont() const { return mFont; }
@@ -180,11 +182,11 @@ namespace bs
 
 		static constexpr const char* GUI_SKIN_FILE = u8"GUISkin";
 	private:
-		/**	Loads a GUI skin texture with the specified filename. */
-		HSpriteTexture getSkinTexture(const String& name) const;
+		/**	Loads a GUI skin texture with the specified filename, optionally asynchronously. */
+		HSpriteTexture getSkinTexture(const String& name, bool async = false) const;
 
-		/**	Loads a cursor texture with the specified filename. */
-		HTexture getCursorTexture(const String& name) const;
+		/**	Loads a cursor texture with the specified filename, optionally asynchronously. */
+		HTexture getCursorTexture(const String& name, bool async = false) const;
 
 		HGUISkin mEmptySkin;
 		HGUISkin mSkin;
@@ -57,6 +57,8 @@ set(BS_UTILITY_INC_DEBUG
 	"bsfUtility/Debug/BsBitmapWriter.h"
 	"bsfUtility/Debug/BsDebug.h"
 	"bsfUtility/Debug/BsLog.h"
+	"bsfUtility/Debug/BsAsyncLogger.h"
+	"bsfUtility/Debug/BsStartupTrace.h"
 )
 
 set(BS_UTILITY_INC_FILESYSTEM
@@ -127,6 +129,8 @@ set(BS_UTILITY_SRC_DEBUG
 	"bsfUtility/Debug/BsBitmapWriter.cpp"
 	"bsfUtility/Debug/BsLog.cpp"
 	"bsfUtility/Debug/BsDebug.cpp"
+	"bsfUtility/Debug/BsAsyncLogger.cpp"
+	"bsfUtility/Debug/BsStartupTrace.cpp"
 )
 
 set(BS_UTILITY_INC_RTTI
@@ -214,6 +218,7 @@ set(BS_UTILITY_SRC_SERIALIZATION
 	"bsfUtility/Serialization/BsBinaryDiff.cpp"
 	"bsfUtility/Serialization/BsSerializedObject.cpp"
 	"bsfUtility/Serialization/BsBinaryCloner.cpp"
+	"bsfUtility/Serialization/BsMemberwiseCloner.cpp"
 	"bsfUtility/Serialization/BsBinaryCompare.cpp"
 	"bsfUtility/Serialization/BsIntermediateSerializer.cpp"
 )
@@ -260,6 +265,7 @@ set(BS_UTILITY_INC_SERIALIZATION
 	"bsfUtility/Serialization/BsBinaryDiff.h"
 	"bsfUtility/Serialization/BsSerializedObject.h"
 	"bsfUtility/Serialization/BsBinaryCloner.h"
+	"bsfUtility/Serialization/BsMemberwiseCloner.h"
 	"bsfUtility/Serialization/BsBinaryCompare.h"
 	"bsfUtility/Serialization/BsIntermediateSerializer.h"
 )
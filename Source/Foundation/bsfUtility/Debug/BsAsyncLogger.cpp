@@ -0,0 +1,537 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#include "Debug/BsAsyncLogger.h"
+#include "FileSystem/BsFileSystem.h"
+#include "FileSystem/BsDataStream.h"
+#include "Utility/BsBitwise.h"
+
+namespace bs
+{
+	/** Identifier of the logger whose ring buffer is cached in sThreadRingBuffer. */
+	static BS_THREADLOCAL UINT64 sThreadLoggerId = 0;
+
+	/** Ring buffer belonging to the current thread, for the logger identified by sThreadLoggerId. */
+	static BS_THREADLOCAL void* sThreadRingBuffer = nullptr;
+
+	/** Identifier of the logger whose logging thread is the current thread, or 0 if none. */
+	static BS_THREADLOCAL UINT64 sLoggingThreadLoggerId = 0;
+
+	/** Single producer, single consumer queue of log records. */
+	struct AsyncLogger::RingBuffer
+	{
+		RingBuffer(UINT32 capacity)
+			:capacity(capacity)
+		{
+			records = bs_newN<AsyncLogRecord>(capacity);
+		}
+
+		~RingBuffer()
+		{
+			bs_deleteN(records, capacity);
+		}
+
+		AsyncLogRecord* records;
+		UINT32 capacity;
+
+		/** Set when either the producer thread exited, or the logger no longer references the buffer. */
+		std::atomic<bool> orphaned{false};
+
+		std::atomic<UINT32> writeIdx{0};
+		UINT8 padding[64]; // Keeps the producer and consumer indices on separate cache lines
+		std::atomic<UINT32> readIdx{0};
+	};
+
+	/**
+	 * Ring buffers owned by the current thread, one per logger. Marks the buffers as orphaned when the thread exits so
+	 * the logging thread can release them once drained.
+	 */
+	struct ThreadRingBuffers
+	{
+		struct Entry
+		{
+			UINT64 loggerId;
+			SPtr<AsyncLogger::RingBuffer> ringBuffer;
+		};
+
+		~ThreadRingBuffers()
+		{
+			for (auto& entry : entries)
+				entry.ringBuffer->orphaned.store(true, std::memory_order_release);
+
+			sThreadLoggerId = 0;
+			sThreadRingBuffer = nullptr;
+		}
+
+		Vector<Entry> entries;
+	};
+
+	static thread_local ThreadRingBuffers sThreadRingBuffers;
+
+	bool AsyncLogRecord::writeValue(ArgType type, const void* data, UINT32 size)
+	{
+		if (truncated || (payloadSize + 1 + size) > PAYLOAD_SIZE)
+		{
+			truncated = true;
+			return false;
+		}
+
+		payload[payloadSize++] = (UINT8)type;
+		memcpy(&payload[payloadSize], data, size);
+		payloadSize += size;
+		numArgs++;
+
+		return true;
+	}
+
+	bool AsyncLogRecord::writeString(const char* data, UINT32 size)
+	{
+		const UINT32 headerSize = 1 + sizeof(UINT16);
+		if (truncated || (payloadSize + headerSize) > PAYLOAD_SIZE)
+		{
+			truncated = true;
+			return false;
+		}
+
+		UINT32 available = PAYLOAD_SIZE - payloadSize - headerSize;
+		if (size > available)
+		{
+			size = available;
+			truncated = true;
+		}
+
+		UINT16 length = (UINT16)size;
+		payload[payloadSize++] = (UINT8)ArgType::String;
+		memcpy(&payload[payloadSize], &length, sizeof(length));
+		payloadSize += sizeof(length);
+		memcpy(&payload[payloadSize], data, size);
+		payloadSize += length;
+		numArgs++;
+
+		return true;
+	}
+
+	std::atomic<UINT64> AsyncLogger::sNextId{1};
+
+	AsyncLogger::AsyncLogger(OutputCallback output)
+		:mId(sNextId.fetch_add(1)), mOutput(std::move(output))
+	{ }
+
+	AsyncLogger::~AsyncLogger()
+	{
+		shutDown();
+	}
+
+	void AsyncLogger::startUp(const AsyncLoggerDesc& desc)
+	{
+		if (isRunning())
+			return;
+
+		// New identifier, so threads don't keep using ring buffers released by the previous shut down
+		mId = sNextId.fetch_add(1);
+
+		mDesc = desc;
+		mDesc.ringBufferCapacity = Bitwise::nextPow2(std::max(desc.ringBufferCapacity, 2U));
+
+		mShutDownRequested = false;
+		mFlushRequests = 0;
+		mFlushesCompleted = 0;
+
+		if (!mDesc.filePath.isEmpty())
+		{
+			FileSystem::createDir(mDesc.filePath.getParent());
+			rotateFiles();
+		}
+
+		mThread = bs_new<Thread>([this, id = mId]()
+		{
+			sLoggingThreadLoggerId = id;
+			run();
+			sLoggingThreadLoggerId = 0;
+		});
+
+		mIsRunning.store(true, std::memory_order_release);
+	}
+
+	void AsyncLogger::shutDown()
+	{
+		if (!isRunning())
+			return;
+
+		mIsRunning.store(false, std::memory_order_release);
+
+		{
+			Lock lock(mThreadMutex);
+			mShutDownRequested = true;
+		}
+
+		mWakeSignal.notify_one();
+		mThread->join();
+		bs_delete(mThread);
+		mThread = nullptr;
+
+		if (mFile != nullptr)
+		{
+			mFile->close();
+			mFile = nullptr;
+		}
+
+		// Threads still holding on to their buffers will release them when they exit or next log a message
+		{
+			Lock lock(mRingBufferMutex);
+			for (auto& entry : mRingBuffers)
+				entry->orphaned.store(true, std::memory_order_release);
+
+			mRingBuffers.clear();
+		}
+
+		// Wake up anyone who requested a flush after the logging thread exited
+		mFlushSignal.notify_all();
+	}
+
+	void AsyncLogger::flush()
+	{
+		// The logging thread would be waiting on itself
+		if (isLoggingThread())
+			return;
+
+		Lock lock(mThreadMutex);
+		if (mThread == nullptr || mShutDownRequested)
+			return;
+
+		UINT64 request = ++mFlushRequests;
+		mWakeSignal.notify_one();
+
+		while (mFlushesCompleted < request && !mShutDownRequested)
+			mFlushSignal.wait(lock);
+	}
+
+	AsyncLogRecord* AsyncLogger::beginRecord(LogVerbosity verbosity)
+	{
+		if (!isRunning())
+			return nullptr;
+
+		if (isDirect(verbosity))
+			return &mDirectRecord;
+
+		RingBuffer* ringBuffer = getThreadRingBuffer();
+		UINT32 writeIdx = ringBuffer->writeIdx.load(std::memory_order_relaxed);
+
+		while ((writeIdx - ringBuffer->readIdx.load(std::memory_order_acquire)) >= ringBuffer->capacity)
+		{
+			// Only important messages are worth stalling the caller for
+			if ((INT32)verbosity > (INT32)LogVerbosity::Error)
+			{
+				mNumDropped.fetch_add(1, std::memory_order_relaxed);
+				return nullptr;
+			}
+
+			if (!isRunning())
+				return nullptr;
+
+			mWakeSignal.notify_one();
+			std::this_thread::yield();
+		}
+
+		return &ringBuffer->records[writeIdx & (ringBuffer->capacity - 1)];
+	}
+
+	void AsyncLogger::endRecord(LogVerbosity verbosity)
+	{
+		if (isDirect(verbosity))
+		{
+			// Copy, as the output callback could log another message and overwrite the direct record
+			AsyncLogRecord record = mDirectRecord;
+			writeRecord(record);
+
+			mNumWritten.fetch_add(1, std::memory_order_relaxed);
+			return;
+		}
+
+		RingBuffer* ringBuffer = getThreadRingBuffer();
+
+		UINT32 writeIdx = ringBuffer->writeIdx.load(std::memory_order_relaxed);
+		ringBuffer->writeIdx.store(writeIdx + 1, std::memory_order_release);
+
+		if (verbosity == LogVerbosity::Fatal)
+			flush();
+		else if (verbosity == LogVerbosity::Error)
+			mWakeSignal.notify_one();
+	}
+
+	void AsyncLogger::initRecord(AsyncLogRecord& record, LogVerbosity verbosity, UINT32 category, const char* function,
+		const char* file, UINT32 line)
+	{
+		record.function = function;
+		record.file = file;
+		record.time = std::time(nullptr);
+		record.line = line;
+		record.category = category;
+		record.verbosity = verbosity;
+		record.numArgs = 0;
+		record.truncated = false;
+		record.payloadSize = 0;
+	}
+
+	bool AsyncLogger::isLoggingThread() const
+	{
+		return sLoggingThreadLoggerId == mId;
+	}
+
+	AsyncLogger::RingBuffer* AsyncLogger::getThreadRingBuffer()
+	{
+		if (sThreadLoggerId == mId)
+			return (RingBuffer*)sThreadRingBuffer;
+
+		// Drop buffers of loggers that have since shut down
+		Vector<ThreadRingBuffers::Entry>& entries = sThreadRingBuffers.entries;
+		for (auto iter = entries.begin(); iter != entries.end();)
+		{
+			if (iter->ringBuffer->orphaned.load(std::memory_order_acquire))
+				iter = entries.erase(iter);
+			else
+				++iter;
+		}
+
+		RingBuffer* ringBuffer = nullptr;
+		for (auto& entry : entries)
+		{
+			if (entry.loggerId == mId)
+			{
+				ringBuffer = entry.ringBuffer.get();
+				break;
+			}
+		}
+
+		if (ringBuffer == nullptr)
+		{
+			SPtr<RingBuffer> newRingBuffer = bs_shared_ptr_new<RingBuffer>(mDesc.ringBufferCapacity);
+			entries.push_back({ mId, newRingBuffer });
+
+			Lock lock(mRingBufferMutex);
+			mRingBuffers.push_back(newRingBuffer);
+
+			ringBuffer = newRingBuffer.get();
+		}
+
+		sThreadLoggerId = mId;
+		sThreadRingBuffer = ringBuffer;
+
+		return ringBuffer;
+	}
+
+	void AsyncLogger::run()
+	{
+		while (true)
+		{
+			UINT64 flushRequests;
+			bool shutDownRequested;
+			{
+				Lock lock(mThreadMutex);
+				if (!mShutDownRequested && mFlushRequests == mFlushesCompleted)
+					mWakeSignal.wait_for(lock, std::chrono::milliseconds(mDesc.drainIntervalMs));
+
+				flushRequests = mFlushRequests;
+				shutDownRequested = mShutDownRequested;
+			}
+
+			drain();
+
+			{
+				Lock lock(mThreadMutex);
+				mFlushesCompleted = flushRequests;
+			}
+
+			mFlushSignal.notify_all();
+
+			if (shutDownRequested)
+				break;
+		}
+	}
+
+	UINT32 AsyncLogger::drain()
+	{
+		Vector<SPtr<RingBuffer>> ringBuffers;
+		{
+			Lock lock(mRingBufferMutex);
+			ringBuffers = mRingBuffers;
+		}
+
+		UINT32 numWritten = 0;
+		bool anyExited = false;
+		for (auto& ringBuffer : ringBuffers)
+		{
+			// Must be checked before reading the write index, so no records published before the exit are missed
+			bool exited = ringBuffer->orphaned.load(std::memory_order_acquire);
+
+			UINT32 readIdx = ringBuffer->readIdx.load(std::memory_order_relaxed);
+			UINT32 writeIdx = ringBuffer->writeIdx.load(std::memory_order_acquire);
+
+			while (readIdx != writeIdx)
+			{
+				writeRecord(ringBuffer->records[readIdx & (ringBuffer->capacity - 1)]);
+
+				readIdx++;
+				ringBuffer->readIdx.store(readIdx, std::memory_order_release);
+				numWritten++;
+			}
+
+			anyExited |= exited;
+		}
+
+		// Release buffers of threads that have exited, now that they have been fully drained
+		if (anyExited)
+		{
+			Lock lock(mRingBufferMutex);
+			for (auto iter = mRingBuffers.begin(); iter != mRingBuffers.end();)
+			{
+				RingBuffer* ringBuffer = iter->get();
+				if (ringBuffer->orphaned.load(std::memory_order_acquire) &&
+					ringBuffer->readIdx.load(std::memory_order_relaxed) ==
+					ringBuffer->writeIdx.load(std::memory_order_acquire))
+				{
+					iter = mRingBuffers.erase(iter);
+				}
+				else
+					++iter;
+			}
+		}
+
+		mNumWritten.fetch_add(numWritten, std::memory_order_relaxed);
+		return numWritten;
+	}
+
+	void AsyncLogger::writeRecord(const AsyncLogRecord& record)
+	{
+		String message = formatRecord(record);
+
+		if (mFile != nullptr)
+			writeToFile(message, record);
+
+		if (mOutput)
+			mOutput(message, record.verbosity, record.category);
+	}
+
+	String AsyncLogger::formatRecord(const AsyncLogRecord& record) const
+	{
+		UINT32 offset = 0;
+		auto readArg = [&record, &offset](String& output)
+		{
+			auto type = (AsyncLogRecord::ArgType)record.payload[offset++];
+			switch (type)
+			{
+			case AsyncLogRecord::ArgType::Int:
+			{
+				INT64 value;
+				memcpy(&value, &record.payload[offset], sizeof(value));
+				offset += sizeof(value);
+
+				output = toString(value, (unsigned short)0);
+			}
+				break;
+			case AsyncLogRecord::ArgType::UInt:
+			{
+				UINT64 value;
+				memcpy(&value, &record.payload[offset], sizeof(value));
+				offset += sizeof(value);
+
+				output = toString(value, (unsigned short)0);
+			}
+				break;
+			case AsyncLogRecord::ArgType::Float:
+			{
+				double value;
+				memcpy(&value, &record.payload[offset], sizeof(value));
+				offset += sizeof(value);
+
+				output = toString(value);
+			}
+				break;
+			case AsyncLogRecord::ArgType::Bool:
+				output = toString(record.payload[offset++] != 0);
+				break;
+			case AsyncLogRecord::ArgType::String:
+			{
+				UINT16 length;
+				memcpy(&length, &record.payload[offset], sizeof(length));
+				offset += sizeof(length);
+
+				output.assign((const char*)&record.payload[offset], length);
+				offset += length;
+			}
+				break;
+			}
+		};
+
+		UINT32 numArgs = record.numArgs;
+
+		// Format string is always stored as the first entry
+		String format;
+		if (numArgs > 0)
+		{
+			readArg(format);
+			numArgs--;
+		}
+
+		String params[AsyncLogRecord::MAX_ARGS];
+		for (UINT32 i = 0; i < numArgs; i++)
+			readArg(params[i]);
+
+		String message = StringFormat::formatParams(format.c_str(), params, numArgs);
+		if (record.truncated)
+			message += " [truncated]";
+
+		return message + "\n\t\t in " + record.function + " [" + record.file + ":" + toString(record.line) + "]\n";
+	}
+
+	void AsyncLogger::writeToFile(const String& message, const AsyncLogRecord& record)
+	{
+		String categoryName;
+		Log::getCategoryName(record.category, categoryName);
+
+		String line = toString(record.time, false, true, TimeToStringConversionType::Full) + " [" +
+			toString(record.verbosity) + "] <" + categoryName + "> | " + message;
+
+		mFile->write(line.data(), line.size());
+		mFileSize += line.size();
+
+		if (mDesc.maxFileSize > 0 && mFileSize >= mDesc.maxFileSize)
+			rotateFiles();
+	}
+
+	void AsyncLogger::rotateFiles()
+	{
+		if (mFile != nullptr)
+		{
+			mFile->close();
+			mFile = nullptr;
+		}
+
+		if (mDesc.maxRotatedFiles > 0)
+		{
+			Path oldestPath = getRotatedFilePath(mDesc.maxRotatedFiles);
+			if (FileSystem::exists(oldestPath))
+				FileSystem::remove(oldestPath);
+
+			for (UINT32 i = mDesc.maxRotatedFiles; i > 0; i--)
+			{
+				Path srcPath = getRotatedFilePath(i - 1);
+				if (FileSystem::exists(srcPath))
+					FileSystem::move(srcPath, getRotatedFilePath(i));
+			}
+		}
+
+		mFile = FileSystem::createAndOpenFile(mDesc.filePath);
+		mFileSize = 0;
+	}
+
+	Path AsyncLogger::getRotatedFilePath(UINT32 idx) const
+	{
+		if (idx == 0)
+			return mDesc.filePath;
+
+		Path path = mDesc.filePath;
+		path.setFilename(mDesc.filePath.getFilename(false) + "." + toString(idx) + mDesc.filePath.getExtension());
+
+		return path;
+	}
+}
@@ -0,0 +1,326 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "Prerequisites/BsPrerequisitesUtil.h"
+#include "Debug/BsLog.h"
+
+namespace bs
+{
+	/** @addtogroup Internal-Utility
+	 *  @{
+	 */
+
+	/** @addtogroup Debug-Internal
+	 *  @{
+	 */
+
+	/**
+	 * Compact representation of a log message as recorded by AsyncLogger. Holds everything required for formatting the
+	 * message at a later time, on a different thread.
+	 */
+	struct AsyncLogRecord
+	{
+		/** Types of arguments that can be stored in the record payload. */
+		enum class ArgType : UINT8
+		{
+			Int, UInt, Float, Bool, String
+		};
+
+		/** Size of the buffer holding the message arguments, in bytes. */
+		static constexpr UINT32 PAYLOAD_SIZE = 416;
+
+		/** Maximum number of arguments a record can hold. Matches the maximum supported by StringFormat. */
+		static constexpr UINT32 MAX_ARGS = 20;
+
+		/** Appends a fixed-size argument to the payload. Returns false if the payload doesn't have enough room. */
+		bool writeValue(ArgType type, const void* data, UINT32 size);
+
+		/** Appends a string argument to the payload. The string will be truncated if it doesn't fit. */
+		bool writeString(const char* data, UINT32 size);
+
+		const char* function;
+		const char* file;
+		std::time_t time;
+		UINT32 line;
+		UINT32 category;
+		LogVerbosity verbosity;
+		UINT8 numArgs;
+		bool truncated;
+		UINT16 payloadSize;
+		UINT8 payload[PAYLOAD_SIZE];
+	};
+
+	/** @} */
+	/** @} */
+
+	/** @addtogroup Debug
+	 *  @{
+	 */
+
+	/** Settings used for starting up an AsyncLogger. */
+	struct AsyncLoggerDesc
+	{
+		/**
+		 * Path to the file to write the log to. When the file grows past @p maxFileSize it gets renamed to
+		 * "name.1.ext" (and older files to "name.2.ext" and so on) and a new file is started. Leave empty to not write
+		 * the log to a file.
+		 */
+		Path filePath;
+
+		/** Size of the log file in bytes at which the file will be rotated. */
+		UINT64 maxFileSize = 8 * 1024 * 1024;
+
+		/** Maximum number of rotated files to keep, not counting the file currently being written to. */
+		UINT32 maxRotatedFiles = 3;
+
+		/** Number of records each logging thread can queue up before the records start getting dropped. */
+		UINT32 ringBufferCapacity = 1024;
+
+		/** Interval at which the logging thread checks for new records, in milliseconds. */
+		UINT32 drainIntervalMs = 10;
+	};
+
+	/**
+	 * Logger that moves message formatting and output off the calling thread. Each calling thread queues compact records
+	 * (verbosity, category, format string and raw arguments) into its own fixed-size ring buffer without taking any
+	 * locks. A background thread drains the buffers, formats the messages, writes them to a rotating log file and
+	 * forwards them to an optional output callback.
+	 *
+	 * If a thread's ring buffer is full, Warning and less important messages are dropped (see getNumDropped()), while
+	 * Error and Fatal messages wait until space is available. Fatal messages also block until the logger has written
+	 * out all queued messages. Error and Fatal messages logged from the logging thread itself (e.g. from the output
+	 * callback) are written out immediately instead, as that thread cannot wait on itself.
+	 *
+	 * Ring buffers are released once their thread exits and all of their records have been written out, or when the
+	 * logger shuts down.
+	 *
+	 * @note	The format string and all arguments are copied into the record. Arguments other than strings and
+	 *			arithmetic types are converted to strings on the calling thread.
+	 * @note	Thread safe.
+	 */
+	class BS_UTILITY_EXPORT AsyncLogger
+	{
+	public:
+		/** Signature of the callback triggered on the logging thread for each formatted message. */
+		using OutputCallback = std::function<void(const String& message, LogVerbosity verbosity, UINT32 category)>;
+
+		/**
+		 * Constructs a new logger. The logger will not process any messages until started.
+		 *
+		 * @param[in]	output	Optional callback to trigger for each formatted message. Called from the logging thread.
+		 */
+		AsyncLogger(OutputCallback output = nullptr);
+		~AsyncLogger();
+
+		/** Starts the background logging thread. Does nothing if the logger is already running. */
+		void startUp(const AsyncLoggerDesc& desc);
+
+		/** Writes out all queued messages and stops the background logging thread. */
+		void shutDown();
+
+		/** Checks is the logger running and accepting new messages. */
+		bool isRunning() const { return mIsRunning.load(std::memory_order_acquire); }
+
+		/**
+		 * Queues a new message for logging.
+		 *
+		 * @param[in]	verbosity	Verbosity of the message, determining its importance.
+		 * @param[in]	category	Category of the message, determining which system is it relevant to.
+		 * @param[in]	function	Name of the function the message was logged from. Must be a static string.
+		 * @param[in]	file		Name of the file the message was logged from. Must be a static string.
+		 * @param[in]	line		Line the message was logged from.
+		 * @param[in]	format		Message format string, in the same format as accepted by StringUtil::format.
+		 * @param[in]	args		Arguments to replace the identifiers in the format string with.
+		 */
+		template<UINT32 N, class... Args>
+		void log(LogVerbosity verbosity, UINT32 category, const char* function, const char* file, UINT32 line,
+			const char (&format)[N], Args&& ...args)
+		{
+			AsyncLogRecord* record = beginRecord(verbosity);
+			if (record == nullptr)
+				return;
+
+			initRecord(*record, verbosity, category, function, file, line);
+
+			// The array is not guaranteed to be a literal, so it must be copied like any other string
+			record->writeString(format, (UINT32)strnlen(format, N));
+
+			writeArgs(*record, std::forward<Args>(args)...);
+			endRecord(verbosity);
+		}
+
+		/** @copydoc log(LogVerbosity, UINT32, const char*, const char*, UINT32, const char(&)[N], Args&&...) */
+		template<class... Args>
+		void log(LogVerbosity verbosity, UINT32 category, const char* function, const char* file, UINT32 line,
+			const String& format, Args&& ...args)
+		{
+			AsyncLogRecord* record = beginRecord(verbosity);
+			if (record == nullptr)
+				return;
+
+			initRecord(*record, verbosity, category, function, file, line);
+			record->writeString(format.data(), (UINT32)format.size());
+
+			writeArgs(*record, std::forward<Args>(args)...);
+			endRecord(verbosity);
+		}
+
+		/** Blocks until all messages queued before this call have been written out. */
+		void flush();
+
+		/** Returns the number of messages that were dropped because a thread's ring buffer was full. */
+		UINT64 getNumDropped() const { return mNumDropped.load(std::memory_order_relaxed); }
+
+		/** Returns the number of messages that were formatted and written out. */
+		UINT64 getNumWritten() const { return mNumWritten.load(std::memory_order_relaxed); }
+
+	private:
+		friend struct ThreadRingBuffers;
+		struct RingBuffer;
+
+		/**
+		 * Retrieves a free record in the calling thread's ring buffer. Returns null if the logger isn't running, or if the
+		 * buffer is full and the message can be dropped. Error and Fatal messages logged from the logging thread are
+		 * instead given a record that bypasses the ring buffer.
+		 */
+		AsyncLogRecord* beginRecord(LogVerbosity verbosity);
+
+		/** Publishes the record retrieved by the last call to beginRecord() on this thread. */
+		void endRecord(LogVerbosity verbosity);
+
+		/** Checks if the calling thread is this logger's logging thread. */
+		bool isLoggingThread() const;
+
+		/** Checks should a message with the specified verbosity be written out directly instead of queued. */
+		bool isDirect(LogVerbosity verbosity) const
+		{
+			return (INT32)verbosity <= (INT32)LogVerbosity::Error && isLoggingThread();
+		}
+
+		/** Fills out the record header. */
+		static void initRecord(AsyncLogRecord& record, LogVerbosity verbosity, UINT32 category, const char* function,
+			const char* file, UINT32 line);
+
+		/** Returns the ring buffer belonging to the calling thread, creating one if needed. */
+		RingBuffer* getThreadRingBuffer();
+
+		/** Entry point for the logging thread. */
+		void run();
+
+		/** Formats and outputs all records currently present in the ring buffers. Returns the number of records written. */
+		UINT32 drain();
+
+		/** Formats a record and writes it to the log file and the output callback. */
+		void writeRecord(const AsyncLogRecord& record);
+
+		/** Formats a single record into a message. */
+		String formatRecord(const AsyncLogRecord& record) const;
+
+		/** Appends a formatted message to the log file, rotating the file if needed. */
+		void writeToFile(const String& message, const AsyncLogRecord& record);
+
+		/** Renames the current log file and any previously rotated files, then opens a new log file. */
+		void rotateFiles();
+
+		/** Returns the path of the rotated log file with the specified index. Index 0 is the active file. */
+		Path getRotatedFilePath(UINT32 idx) const;
+
+		/** Helper for writing out a variable number of arguments. */
+		static void writeArgs(AsyncLogRecord& record) { }
+
+		/** Helper for writing out a variable number of arguments. */
+		template<class T, class... Args>
+		static void writeArgs(AsyncLogRecord& record, T&& arg, Args&& ...args)
+		{
+			if (record.numArgs >= AsyncLogRecord::MAX_ARGS)
+				return;
+
+			writeArg(record, arg);
+			writeArgs(record, std::forward<Args>(args)...);
+		}
+
+		/** Writes a signed integer argument. */
+		template<class T, std::enable_if_t<std::is_integral<T>::value && std::is_signed<T>::value, int> = 0>
+		static void writeArg(AsyncLogRecord& record, T value)
+		{
+			INT64 data = (INT64)value;
+			record.writeValue(AsyncLogRecord::ArgType::Int, &data, sizeof(data));
+		}
+
+		/** Writes an unsigned integer argument. */
+		template<class T, std::enable_if_t<std::is_integral<T>::value && std::is_unsigned<T>::value &&
+			!std::is_same<T, bool>::value, int> = 0>
+		static void writeArg(AsyncLogRecord& record, T value)
+		{
+			UINT64 data = (UINT64)value;
+			record.writeValue(AsyncLogRecord::ArgType::UInt, &data, sizeof(data));
+		}
+
+		/** Writes a floating point argument. */
+		template<class T, std::enable_if_t<std::is_floating_point<T>::value, int> = 0>
+		static void writeArg(AsyncLogRecord& record, T value)
+		{
+			double data = (double)value;
+			record.writeValue(AsyncLogRecord::ArgType::Float, &data, sizeof(data));
+		}
+
+		/** Writes a boolean argument. */
+		static void writeArg(AsyncLogRecord& record, bool value)
+		{
+			UINT8 data = value ? 1 : 0;
+			record.writeValue(AsyncLogRecord::ArgType::Bool, &data, sizeof(data));
+		}
+
+		/** Writes a string argument. */
+		static void writeArg(AsyncLogRecord& record, const char* value)
+		{
+			if (value != nullptr)
+				record.writeString(value, (UINT32)strlen(value));
+			else
+				record.writeString("", 0);
+		}
+
+		/** Writes a string argument. */
+		static void writeArg(AsyncLogRecord& record, const String& value)
+		{
+			record.writeString(value.data(), (UINT32)value.size());
+		}
+
+		/** Writes an argument of any other type, by converting it to a string. */
+		template<class T, std::enable_if_t<!std::is_arithmetic<T>::value &&
+			!std::is_convertible<const T&, const char*>::value, int> = 0>
+		static void writeArg(AsyncLogRecord& record, const T& value)
+		{
+			String str = toString(value);
+			record.writeString(str.data(), (UINT32)str.size());
+		}
+
+		static std::atomic<UINT64> sNextId;
+
+		UINT64 mId;
+		OutputCallback mOutput;
+		AsyncLoggerDesc mDesc;
+
+		std::atomic<bool> mIsRunning{false};
+		std::atomic<UINT64> mNumDropped{0};
+		std::atomic<UINT64> mNumWritten{0};
+
+		Vector<SPtr<RingBuffer>> mRingBuffers;
+		mutable Mutex mRingBufferMutex;
+		AsyncLogRecord mDirectRecord;
+
+		Thread* mThread = nullptr;
+		bool mShutDownRequested = false;
+		UINT64 mFlushRequests = 0;
+		UINT64 mFlushesCompleted = 0;
+		Mutex mThreadMutex;
+		Signal mWakeSignal;
+		Signal mFlushSignal;
+
+		SPtr<DataStream> mFile;
+		UINT64 mFileSize = 0;
+	};
+
+	/** @} */
+}
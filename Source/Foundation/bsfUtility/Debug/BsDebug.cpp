@@ -45,6 +45,13 @@ namespace bs
 	BS_LOG_CATEGORY_IMPL(Generic)
 	BS_LOG_CATEGORY_IMPL(Platform)
 
+	Debug::Debug()
+		:mAsyncLogger([this](const String& message, LogVerbosity verbosity, UINT32 category)
+		{
+			log(message, verbosity, category);
+		})
+	{ }
+
 	void Debug::log(const String& message, LogVerbosity verbosity, UINT32 category)
 	{
 		if(mCustomLogCallback)
@@ -83,6 +90,16 @@ namespace bs
 		}
 	}
 
+	void Debug::startAsyncLogging(const AsyncLoggerDesc& desc)
+	{
+		mAsyncLogger.startUp(desc);
+	}
+
+	void Debug::stopAsyncLogging()
+	{
+		mAsyncLogger.shutDown();
+	}
+
 	void Debug::writeAsBMP(UINT8* rawPixels, UINT32 bytesPerPixel, UINT32 width, UINT32 height, const Path& filePath,
 		bool overwrite) const
 	{
@@ -4,6 +4,7 @@
 
 #include "Prerequisites/BsPrerequisitesUtil.h"
 #include "Debug/BsLog.h"
+#include "Debug/BsAsyncLogger.h"
 
 namespace bs
 {
@@ -28,7 +29,7 @@ namespace bs
 	class BS_UTILITY_EXPORT Debug
 	{
 	public:
-		Debug() = default;
+		Debug();
 
 		/**
 		 * Logs a new message.
@@ -42,6 +43,22 @@ namespace bs
 		/** Retrieves the Log used by the Debug instance. */
 		Log& getLog() { return mLog; }
 
+		/**
+		 * Switches BS_LOG to asynchronous mode. Messages will be queued on the calling thread and formatted, written to
+		 * the log file and added to the Log on a separate logging thread. Messages logged directly through log() are
+		 * unaffected. Use Log::setMaxEntries() to additionally limit the amount of memory used by the in-memory history.
+		 *
+		 * @note	While enabled, onLogEntryAdded is still triggered from _triggerCallbacks(), but any callback set through
+		 *			setLogCallback() will be called from the logging thread.
+		 */
+		void startAsyncLogging(const AsyncLoggerDesc& desc);
+
+		/** Writes out any queued messages and switches BS_LOG back to synchronous mode. */
+		void stopAsyncLogging();
+
+		/** Returns the logger used by BS_LOG while asynchronous logging is enabled. */
+		AsyncLogger& getAsyncLogger() { return mAsyncLogger; }
+
 		/** Converts raw pixels into a BMP image and saves it as a file */
 		void writeAsBMP(UINT8* rawPixels, UINT32 bytesPerPixel, UINT32 width, UINT32 height, const Path& filePath,
 			bool overwrite = true) const;
@@ -106,6 +123,9 @@ namespace bs
 		UINT64 mLogHash = 0;
 		Log mLog;
 		std::function<bool(const String& message, LogVerbosity verbosity, UINT32 category)> mCustomLogCallback;
+
+		// Must be last, so the logging thread is shut down before the rest of the members are destroyed
+		AsyncLogger mAsyncLogger;
 	};
 
 	/** A simpler way of accessing the Debug module. */
@@ -137,9 +157,18 @@ namespace bs
 	using namespace ::bs;																			\
 	if ((INT32)LogVerbosity::verbosity <= (INT32)BS_LOG_VERBOSITY)									\
 	{																								\
-	  gDebug().log(StringUtil::format(message, ##__VA_ARGS__) + String("\n\t\t in ") +				\
-					   __PRETTY_FUNCTION__ + " [" + __FILE__ + ":" + toString(__LINE__) + "]\n",	\
-				   LogVerbosity::verbosity, LogCategory##category::_id);							\
+	  AsyncLogger& asyncLogger = gDebug().getAsyncLogger();											\
+	  if (asyncLogger.isRunning())																	\
+	  {																								\
+		asyncLogger.log(LogVerbosity::verbosity, LogCategory##category::_id, __PRETTY_FUNCTION__,	\
+						__FILE__, __LINE__, message, ##__VA_ARGS__);								\
+	  }																								\
+	  else																							\
+	  {																								\
+		gDebug().log(StringUtil::format(message, ##__VA_ARGS__) + String("\n\t\t in ") +			\
+						 __PRETTY_FUNCTION__ + " [" + __FILE__ + ":" + toString(__LINE__) + "]\n",	\
+					 LogVerbosity::verbosity, LogCategory##category::_id);							\
+	  }																								\
 	}																								\
   } while (0)
 
@@ -17,6 +17,7 @@ namespace bs
 		RecursiveLock lock(mMutex);
 
 		mUnreadEntries.push(LogEntry(message, verbosity, category));
+		enforceMaxEntries();
 	}
 
 	void Log::clear()
@@ -35,7 +36,7 @@ namespace bs
 	{
 		RecursiveLock lock(mMutex);
 
-		Vector<LogEntry> newEntries;
+		Deque<LogEntry> newEntries;
 		for(auto& entry : mEntries)
 		{
 			if (((verbosity == LogVerbosity::Any) || entry.getVerbosity() == verbosity) &&
@@ -81,6 +82,8 @@ namespace bs
 
 	bool Log::getLastEntry(LogEntry& entry)
 	{
+		RecursiveLock lock(mMutex);
+
 		if (mEntries.size() == 0)
 			return false;
 
@@ -92,7 +95,40 @@ namespace bs
 	{
 		RecursiveLock lock(mMutex);
 
-		return mEntries;
+		return Vector<LogEntry>(mEntries.begin(), mEntries.end());
+	}
+
+	void Log::setMaxEntries(UINT32 maxEntries)
+	{
+		RecursiveLock lock(mMutex);
+
+		mMaxEntries = maxEntries;
+		enforceMaxEntries();
+	}
+
+	void Log::enforceMaxEntries()
+	{
+		if (mMaxEntries == 0)
+			return;
+
+		size_t numEntries = mEntries.size() + mUnreadEntries.size();
+		if (numEntries <= mMaxEntries)
+			return;
+
+		size_t numToRemove = numEntries - mMaxEntries;
+		while (numToRemove > 0 && !mEntries.empty())
+		{
+			mEntries.pop_front();
+			numToRemove--;
+		}
+
+		while (numToRemove > 0 && !mUnreadEntries.empty())
+		{
+			mUnreadEntries.pop();
+			numToRemove--;
+		}
+
+		mHash++;
 	}
 	
 	bool Log::_registerCategory(UINT32 id, const char* name)
@@ -96,6 +96,15 @@ namespace bs
 		/** Returns all existing log entries. */
 		Vector<LogEntry> getEntries() const;
 
+		/**
+		 * Sets the maximum number of entries (read and unread) the log will keep in memory. Once the limit is exceeded
+		 * the oldest entries are discarded. Zero means the number of entries is unbounded, which is the default.
+		 */
+		void setMaxEntries(UINT32 maxEntries);
+
+		/** @copydoc setMaxEntries */
+		UINT32 getMaxEntries() const { return mMaxEntries; }
+
 		/**
 		 * Returns the latest unread entry from the log queue, and removes the entry from the unread entries list.
 		 * 			
@@ -161,9 +170,13 @@ namespace bs
 		/** Returns all log entries, including those marked as unread. */
 		Vector<LogEntry> getAllEntries() const;
 
-		Vector<LogEntry> mEntries;
+		/** Discards the oldest entries until the total entry count fits within the limit set by setMaxEntries(). */
+		void enforceMaxEntries();
+
+		Deque<LogEntry> mEntries;
 		Queue<LogEntry> mUnreadEntries;
 		UINT64 mHash = 0;
+		UINT32 mMaxEntries = 0;
 		
 		mutable RecursiveMutex mMutex;
 
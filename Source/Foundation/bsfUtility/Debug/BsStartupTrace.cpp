@@ -0,0 +1,270 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#include "Debug/BsStartupTrace.h"
+#include "Utility/BsTimer.h"
+
+namespace bs
+{
+	/** Shared state of the start up trace. */
+	struct StartupTraceData
+	{
+		Timer timer;
+		Mutex mutex;
+		Vector<StartupEvent> events;
+		UINT32 numDropped = 0;
+		UINT64 endTime = 0;
+	};
+
+	/**
+	 * Returns the shared state of the trace. Constructed on first use so modules started during static initialization
+	 * can be traced as well.
+	 */
+	static StartupTraceData& getTraceData()
+	{
+		static StartupTraceData data;
+		return data;
+	}
+
+	/** Number of module start ups in progress on the current thread. */
+	static thread_local UINT32 sModuleDepth = 0;
+
+	/** Ensures the trace timer starts counting when the library is loaded, rather than when the first event occurs. */
+	static const bool sTraceStarted = (getTraceData(), true);
+
+	constexpr UINT32 StartupTrace::MAX_EVENTS;
+	std::atomic<bool> StartupTrace::sRecording { false };
+
+	/** Converts microseconds to milliseconds, as a floating point value suitable for the report. */
+	static double toMs(UINT64 time)
+	{
+		return time / 1000.0;
+	}
+
+	UINT64 StartupTrace::getTime()
+	{
+		return getTraceData().timer.getMicroseconds();
+	}
+
+	void StartupTrace::_beginModule()
+	{
+		sModuleDepth++;
+	}
+
+	void StartupTrace::_endModule()
+	{
+		if (sModuleDepth > 0)
+			sModuleDepth--;
+	}
+
+	void StartupTrace::record(StartupEventType type, const String& name, UINT64 startTime)
+	{
+		if (!isRecording())
+			return;
+
+		StartupTraceData& data = getTraceData();
+		const UINT64 time = data.timer.getMicroseconds();
+
+		Lock lock(data.mutex);
+		if (data.events.size() >= MAX_EVENTS)
+		{
+			data.numDropped++;
+			return;
+		}
+
+		data.events.push_back({ type, name, startTime, time - startTime, sModuleDepth });
+	}
+
+	void StartupTrace::begin()
+	{
+		StartupTraceData& data = getTraceData();
+
+		Lock lock(data.mutex);
+		data.events.clear();
+		data.numDropped = 0;
+		data.endTime = 0;
+		sRecording.store(true, std::memory_order_relaxed);
+	}
+
+	void StartupTrace::end()
+	{
+		StartupTraceData& data = getTraceData();
+
+		Lock lock(data.mutex);
+		if (!isRecording())
+			return;
+
+		data.endTime = data.timer.getMicroseconds();
+		sRecording.store(false, std::memory_order_relaxed);
+	}
+
+	Vector<StartupEvent> StartupTrace::getEvents()
+	{
+		StartupTraceData& data = getTraceData();
+
+		Lock lock(data.mutex);
+		return data.events;
+	}
+
+	UINT32 StartupTrace::getNumDropped()
+	{
+		StartupTraceData& data = getTraceData();
+
+		Lock lock(data.mutex);
+		return data.numDropped;
+	}
+
+	UINT64 StartupTrace::getTotalTime()
+	{
+		StartupTraceData& data = getTraceData();
+
+		Lock lock(data.mutex);
+		if (!isRecording())
+			return data.endTime;
+
+		return data.timer.getMicroseconds();
+	}
+
+	String StartupTrace::generateReport(UINT32 maxResources)
+	{
+		Vector<StartupEvent> events = getEvents();
+
+		Vector<const StartupEvent*> modules;
+		Vector<const StartupEvent*> resources;
+		Vector<const StartupEvent*> custom;
+		for (auto& event : events)
+		{
+			switch (event.type)
+			{
+			case StartupEventType::Module: modules.push_back(&event); break;
+			case StartupEventType::Resource: resources.push_back(&event); break;
+			case StartupEventType::Custom: custom.push_back(&event); break;
+			}
+		}
+
+		// Modules are recorded once they finish starting up, but are easier to follow in the order they were started
+		auto byStart = [](const StartupEvent* a, const StartupEvent* b) { return a->start < b->start; };
+		auto byDuration = [](const StartupEvent* a, const StartupEvent* b) { return a->duration > b->duration; };
+
+		std::stable_sort(modules.begin(), modules.end(), byStart);
+		std::stable_sort(custom.begin(), custom.end(), byStart);
+		std::stable_sort(resources.begin(), resources.end(), byDuration);
+
+		StringStream output;
+		output << std::fixed << std::setprecision(2);
+		output << "Start up trace (total: " << toMs(getTotalTime()) << " ms)\n";
+
+		auto writeEvents = [&output](const char* title, const Vector<const StartupEvent*>& list, UINT32 maxEvents)
+		{
+			if (list.empty())
+				return;
+
+			const UINT32 numEvents = std::min(maxEvents, (UINT32)list.size());
+
+			output << "\n" << title;
+			if (numEvents < list.size())
+				output << " (" << numEvents << " of " << list.size() << ")";
+
+			output << ":\n";
+			output << std::setw(12) << "Start (ms)" << std::setw(16) << "Duration (ms)" << "  Name\n";
+
+			for (UINT32 i = 0; i < numEvents; i++)
+			{
+				const StartupEvent& event = *list[i];
+				output << std::setw(12) << toMs(event.start) << std::setw(16) << toMs(event.duration) << "  ";
+				output << String(event.depth * 2, ' ') << event.name << "\n";
+			}
+		};
+
+		writeEvents("Modules", modules, std::numeric_limits<UINT32>::max());
+		writeEvents("Slowest resources", resources, maxResources);
+		writeEvents("Other", custom, std::numeric_limits<UINT32>::max());
+
+		// Nested module times are already included in their parents, and resources might have been loaded in parallel,
+		// so the totals don't necessarily add up to the total start up time
+		UINT64 moduleTime = 0;
+		for (auto& event : modules)
+		{
+			if (event->depth == 0)
+				moduleTime += event->duration;
+		}
+
+		UINT64 resourceTime = 0;
+		for (auto& event : resources)
+			resourceTime += event->duration;
+
+		output << "\nTotals:\n";
+		output << "  Modules: " << modules.size() << " started in " << toMs(moduleTime) << " ms\n";
+		output << "  Resources: " << resources.size() << " loaded in " << toMs(resourceTime) << " ms (summed across "
+			"threads)\n";
+
+		const UINT32 numDropped = getNumDropped();
+		if (numDropped > 0)
+			output << "  Dropped: " << numDropped << " events past the limit of " << MAX_EVENTS << "\n";
+
+		return output.str();
+	}
+
+	String StartupTrace::_parseTypeName(const char* signature)
+	{
+		const String input = signature;
+		String name;
+
+		// GCC and Clang list template arguments at the end of the signature, e.g. "[with T = bs::Type; ...]", while
+		// MSVC lists them in the function name, e.g. "getStartupTraceName<class bs::Type>(void)"
+		String::size_type start = input.find("T = ");
+		if (start != String::npos)
+		{
+			start += 4;
+
+			String::size_type end = start;
+			for (INT32 nesting = 0; end < input.size(); end++)
+			{
+				const char ch = input[end];
+				if (ch == '<')
+					nesting++;
+				else if (ch == '>')
+					nesting--;
+				else if (nesting == 0 && (ch == ';' || ch == ']' || ch == ','))
+					break;
+			}
+
+			name = input.substr(start, end - start);
+		}
+		else
+		{
+			static constexpr const char* FUNCTION_NAME = "getStartupTraceName<";
+
+			start = input.find(FUNCTION_NAME);
+			if (start == String::npos)
+				return input;
+
+			start += strlen(FUNCTION_NAME);
+
+			String::size_type end = start;
+			for (INT32 nesting = 0; end < input.size(); end++)
+			{
+				const char ch = input[end];
+				if (ch == '<')
+					nesting++;
+				else if (ch == '>')
+				{
+					if (nesting == 0)
+						break;
+
+					nesting--;
+				}
+			}
+
+			name = input.substr(start, end - start);
+		}
+
+		for (const char* prefix : { "class ", "struct ", "bs::" })
+		{
+			const String::size_type length = strlen(prefix);
+			if (name.compare(0, length, prefix) == 0)
+				name.erase(0, length);
+		}
+
+		return name;
+	}
+}
@@ -0,0 +1,125 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "Prerequisites/BsPrerequisitesUtil.h"
+
+namespace bs
+{
+	/** @addtogroup Debug
+	 *  @{
+	 */
+
+	/** Types of events recorded by StartupTrace. */
+	enum class StartupEventType
+	{
+		/** Start up of a Module, including construction and Module::onStartUp. */
+		Module,
+		/** Load of a single resource, including reading its data and deserializing it. */
+		Resource,
+		/** Any other event recorded by the user. */
+		Custom
+	};
+
+	/** Single timed event recorded by StartupTrace. */
+	struct StartupEvent
+	{
+		StartupEventType type;
+		String name;
+
+		/** Time at which the event started, in microseconds since the library was loaded. */
+		UINT64 start;
+
+		/** Duration of the event, in microseconds. */
+		UINT64 duration;
+
+		/** Number of module start ups the event was nested in on the thread that recorded it. */
+		UINT32 depth;
+	};
+
+	/**
+	 * Records timings of module start ups and resource loads performed during application start up, so they can be
+	 * reported and compared between runs to track down start up time regressions.
+	 *
+	 * Recording is disabled by default, and is started by calling begin() (normally by the application, if enabled
+	 * in START_UP_DESC). It stops once end() is called, normally by the application once it finishes starting up. At
+	 * most MAX_EVENTS events are kept, with further events being dropped.
+	 *
+	 * @note	Thread safe.
+	 */
+	class BS_UTILITY_EXPORT StartupTrace
+	{
+	public:
+		/** Maximum number of events recorded before any further events are dropped. */
+		static constexpr UINT32 MAX_EVENTS = 4096;
+
+		/** Checks is the trace still recording events. */
+		static bool isRecording() { return sRecording.load(std::memory_order_relaxed); }
+
+		/** Returns the current time in microseconds since the library was loaded. */
+		static UINT64 getTime();
+
+		/**
+		 * Records an event that started at the specified time and ends now. Does nothing if the trace is not
+		 * recording, or if it already holds MAX_EVENTS events.
+		 *
+		 * @param[in]	type		Type of the event.
+		 * @param[in]	name		Name identifying the event in the report.
+		 * @param[in]	startTime	Time at which the event started, as returned by getTime().
+		 */
+		static void record(StartupEventType type, const String& name, UINT64 startTime);
+
+		/**
+		 * Notifies the trace that a module start up has begun on the current thread, so events recorded until the
+		 * matching _endModule() call are nested under it in the report.
+		 */
+		static void _beginModule();
+
+		/** Notifies the trace that the module start up last started on the current thread has finished. */
+		static void _endModule();
+
+		/** Discards any previously recorded events and starts recording. */
+		static void begin();
+
+		/**
+		 * Stops recording events. Total start up time is measured from the moment the library was loaded until this
+		 * call.
+		 */
+		static void end();
+
+		/** Returns a copy of all the recorded events, in the order they finished. */
+		static Vector<StartupEvent> getEvents();
+
+		/** Returns the number of events that weren't recorded because the trace already held MAX_EVENTS events. */
+		static UINT32 getNumDropped();
+
+		/** Returns the total time spent starting up, in microseconds, or the time passed so far if still recording. */
+		static UINT64 getTotalTime();
+
+		/**
+		 * Generates a human readable report listing module start ups in the order they were started, followed by the
+		 * slowest resource loads and the totals for each event type.
+		 *
+		 * @param[in]	maxResources	Maximum number of resource loads to list individually.
+		 */
+		static String generateReport(UINT32 maxResources = 20);
+
+		/**
+		 * Extracts the name of a type from a function signature generated by the compiler for a function template
+		 * instantiated with that type, as the first template argument.
+		 */
+		static String _parseTypeName(const char* signature);
+
+	private:
+		static std::atomic<bool> sRecording;
+	};
+
+	/** Returns the name of the provided type, for use in StartupTrace events. */
+	template<class T>
+	String getStartupTraceName()
+	{
+		return StartupTrace::_parseTypeName(__PRETTY_FUNCTION__);
+	}
+
+	/** @} */
+}
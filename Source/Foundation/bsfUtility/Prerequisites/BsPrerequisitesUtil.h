@@ -89,6 +89,10 @@
  *  @{
  */
 
+/** @defgroup Debug-Internal Debug
+ *  Various debugging helpers.
+ */
+
 /** @defgroup Error-Internal Error handling
  *  Handling and reporting errors.
  */
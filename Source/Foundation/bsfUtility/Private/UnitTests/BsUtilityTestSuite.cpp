@@ -8,8 +8,19 @@
 #include "Math/BsComplex.h"
 #include "Utility/BsMinHeap.h"
 #include "Utility/BsQuadtree.h"
+#include "Utility/BsTriangulation.h"
 #include "Utility/BsBitstream.h"
 #include "Utility/BsUSPtr.h"
+#include "Utility/BsTimer.h"
+#include "Math/BsRandom.h"
+#include "Reflection/BsRTTIType.h"
+#include "RTTI/BsStdRTTI.h"
+#include "RTTI/BsStringRTTI.h"
+#include "Serialization/BsBinaryCloner.h"
+#include "Serialization/BsMemberwiseCloner.h"
+#include "Debug/BsAsyncLogger.h"
+#include "Debug/BsStartupTrace.h"
+#include "FileSystem/BsFileSystem.h"
 
 namespace bs
 {
@@ -78,6 +89,99 @@ namespace bs
 	};
 
 	typedef Quadtree<UINT32, DebugQuadtreeOptions> DebugQuadtree;
+
+	enum
+	{
+		TID_CloneTestValue = 100000,
+		TID_CloneTestObject = 100001
+	};
+
+	struct CloneTestValue : IReflectable
+	{
+		UINT32 intVal = 0;
+		Vector<float> floats;
+
+		static RTTITypeBase* getRTTIStatic();
+		RTTITypeBase* getRTTI() const override { return getRTTIStatic(); }
+	};
+
+	struct CloneTestObject : IReflectable
+	{
+		String name;
+		INT32 intVal = 0;
+		CloneTestValue value;
+		Vector<SPtr<CloneTestObject>> children;
+		SPtr<CloneTestObject> sharedRef;
+
+		static RTTITypeBase* getRTTIStatic();
+		RTTITypeBase* getRTTI() const override { return getRTTIStatic(); }
+	};
+
+	class CloneTestValueRTTI : public RTTIType<CloneTestValue, IReflectable, CloneTestValueRTTI>
+	{
+	private:
+		BS_BEGIN_RTTI_MEMBERS
+			BS_RTTI_MEMBER_PLAIN(intVal, 0)
+			BS_RTTI_MEMBER_PLAIN_ARRAY(floats, 1)
+		BS_END_RTTI_MEMBERS
+
+	public:
+		const String& getRTTIName() override
+		{
+			static String name = "CloneTestValue";
+			return name;
+		}
+
+		UINT32 getRTTIId() override { return TID_CloneTestValue; }
+		SPtr<IReflectable> newRTTIObject() override { return bs_shared_ptr_new<CloneTestValue>(); }
+	};
+
+	class CloneTestObjectRTTI : public RTTIType<CloneTestObject, IReflectable, CloneTestObjectRTTI>
+	{
+	private:
+		BS_BEGIN_RTTI_MEMBERS
+			BS_RTTI_MEMBER_PLAIN(name, 0)
+			BS_RTTI_MEMBER_PLAIN(intVal, 1)
+			BS_RTTI_MEMBER_REFL(value, 2)
+			BS_RTTI_MEMBER_REFLPTR_ARRAY(children, 3)
+			BS_RTTI_MEMBER_REFLPTR(sharedRef, 4)
+		BS_END_RTTI_MEMBERS
+
+	public:
+		const String& getRTTIName() override
+		{
+			static String name = "CloneTestObject";
+			return name;
+		}
+
+		UINT32 getRTTIId() override { return TID_CloneTestObject; }
+		SPtr<IReflectable> newRTTIObject() override { return bs_shared_ptr_new<CloneTestObject>(); }
+	};
+
+	RTTITypeBase* CloneTestValue::getRTTIStatic() { return CloneTestValueRTTI::instance(); }
+	RTTITypeBase* CloneTestObject::getRTTIStatic() { return CloneTestObjectRTTI::instance(); }
+
+	class StartupTraceInnerModule : public Module<StartupTraceInnerModule>
+	{
+	public:
+		void onStartUp() override { BS_THREAD_SLEEP(2); }
+	};
+
+	class StartupTraceOuterModule : public Module<StartupTraceOuterModule>
+	{
+	public:
+		void onStartUp() override
+		{
+			const UINT64 startTime = StartupTrace::getTime();
+			BS_THREAD_SLEEP(1);
+			StartupTrace::record(StartupEventType::Resource, "OuterResource", startTime);
+
+			StartupTraceInnerModule::startUp();
+		}
+
+		void onShutDown() override { StartupTraceInnerModule::shutDown(); }
+	};
+
 	void UtilityTestSuite::startUp()
 	{
 		SPtr<TestSuite> fileSystemTests = create<FileSystemTestSuite>();
@@ -99,6 +203,10 @@ namespace bs
 		BS_ADD_TEST(UtilityTestSuite::testQuadtree)
 		BS_ADD_TEST(UtilityTestSuite::testVarInt)
 		BS_ADD_TEST(UtilityTestSuite::testBitStream)
+		BS_ADD_TEST(UtilityTestSuite::testMemberwiseCloner)
+		BS_ADD_TEST(UtilityTestSuite::testAsyncLogger)
+		BS_ADD_TEST(UtilityTestSuite::testStartupTrace)
+		BS_ADD_TEST(UtilityTestSuite::testTetrahedralization)
 	}
 
 	void UtilityTestSuite::testBitfield()
@@ -844,4 +952,479 @@ namespace bs
 		bs.read(ulv);
 		BS_TEST_ASSERT(ulv == v11);
 	}
+
+	void UtilityTestSuite::testMemberwiseCloner()
+	{
+		static constexpr UINT32 NUM_CHILDREN = 64;
+		static constexpr UINT32 NUM_ITERATIONS = 200;
+
+		SPtr<CloneTestObject> shared = bs_shared_ptr_new<CloneTestObject>();
+		shared->name = "Shared";
+
+		SPtr<CloneTestObject> root = bs_shared_ptr_new<CloneTestObject>();
+		root->name = "Root";
+		root->intVal = -5;
+		root->value.intVal = 7;
+		root->value.floats = { 1.0f, 2.0f, 3.0f };
+		root->sharedRef = shared;
+
+		for(UINT32 i = 0; i < NUM_CHILDREN; i++)
+		{
+			SPtr<CloneTestObject> child = bs_shared_ptr_new<CloneTestObject>();
+			child->name = "Child" + toString(i);
+			child->intVal = (INT32)i;
+			child->value.floats.resize(i % 8, (float)i);
+			child->sharedRef = shared;
+
+			root->children.push_back(child);
+		}
+
+		// Deep clone
+		MemberwiseCloner cloner;
+		SPtr<CloneTestObject> clone = std::static_pointer_cast<CloneTestObject>(cloner.clone(root.get()));
+
+		BS_TEST_ASSERT(clone != nullptr && clone != root);
+		BS_TEST_ASSERT(clone->name == root->name);
+		BS_TEST_ASSERT(clone->intVal == root->intVal);
+		BS_TEST_ASSERT(clone->value.intVal == root->value.intVal);
+		BS_TEST_ASSERT(clone->value.floats == root->value.floats);
+		BS_TEST_ASSERT(clone->children.size() == NUM_CHILDREN);
+		BS_TEST_ASSERT(clone->sharedRef != nullptr && clone->sharedRef != shared);
+		BS_TEST_ASSERT(clone->sharedRef->name == shared->name);
+
+		for(UINT32 i = 0; i < NUM_CHILDREN; i++)
+		{
+			BS_TEST_ASSERT(clone->children[i] != root->children[i]);
+			BS_TEST_ASSERT(clone->children[i]->name == root->children[i]->name);
+			BS_TEST_ASSERT(clone->children[i]->value.floats == root->children[i]->value.floats);
+
+			// Object referenced from multiple places must only be cloned once
+			BS_TEST_ASSERT(clone->children[i]->sharedRef == clone->sharedRef);
+		}
+
+		BS_TEST_ASSERT(root->getRTTI()->getCompareHandler().run(*root, *clone));
+
+		// Shallow clone
+		SPtr<CloneTestObject> shallowClone = std::static_pointer_cast<CloneTestObject>(cloner.clone(root.get(), true));
+		BS_TEST_ASSERT(shallowClone->sharedRef == shared);
+		BS_TEST_ASSERT(shallowClone->children.size() == NUM_CHILDREN);
+		BS_TEST_ASSERT(shallowClone->children[0] == root->children[0]);
+		BS_TEST_ASSERT(shallowClone->value.floats == root->value.floats);
+
+		// Compare performance against the stream based cloner
+		Timer timer;
+		for(UINT32 i = 0; i < NUM_ITERATIONS; i++)
+			BinaryCloner::clone(root.get());
+
+		UINT64 binaryTime = timer.getMicroseconds();
+
+		timer.reset();
+		for(UINT32 i = 0; i < NUM_ITERATIONS; i++)
+			cloner.clone(root.get());
+
+		UINT64 memberwiseTime = timer.getMicroseconds();
+
+		BS_LOG(Info, Generic, "Cloning {0} objects {1} times. BinaryCloner: {2} us, MemberwiseCloner: {3} us",
+			NUM_CHILDREN + 2, NUM_ITERATIONS, binaryTime, memberwiseTime);
+	}
+
+	void UtilityTestSuite::testAsyncLogger()
+	{
+		static constexpr UINT32 NUM_THREADS = 4;
+		static constexpr UINT32 NUM_MESSAGES = 20000;
+
+		// Formatting and output
+		Mutex outputMutex;
+		Vector<String> messages;
+		AsyncLogger logger([&outputMutex, &messages](const String& message, LogVerbosity verbosity, UINT32 category)
+		{
+			Lock lock(outputMutex);
+			messages.push_back(message);
+		});
+
+		Path logDir = FileSystem::getTempDirectoryPath();
+		logDir.append("bsfAsyncLoggerTest/");
+
+		AsyncLoggerDesc desc;
+		desc.filePath = logDir + "Log.txt";
+		desc.maxFileSize = 4096;
+		desc.maxRotatedFiles = 2;
+		logger.startUp(desc);
+
+		String dynamicFormat = "Dynamic {0}";
+		logger.log(LogVerbosity::Warning, 0, "function", "file", 10, "Values: {0} {1} {2} {3} {4}", -5, 7U, 2.5f,
+			true, String("str"));
+		logger.log(LogVerbosity::Warning, 0, "function", "file", 11, dynamicFormat, "format");
+		logger.log(LogVerbosity::Warning, 0, "function", "file", 12, "{0}", String(1000, 'a'));
+
+		// Non-literal arrays must be copied, as they can change before the record is formatted
+		char localFormat[16] = "Local {0}";
+		logger.log(LogVerbosity::Warning, 0, "function", "file", 13, localFormat, 1);
+		strcpy(localFormat, "Changed");
+		logger.flush();
+
+		{
+			Lock lock(outputMutex);
+			BS_TEST_ASSERT(messages.size() == 4);
+			BS_TEST_ASSERT(messages[0] == StringUtil::format("Values: {0} {1} {2} {3} {4}", -5, 7U, 2.5f, true, "str") +
+				"\n\t\t in function [file:10]\n");
+			BS_TEST_ASSERT(StringUtil::startsWith(messages[1], "Dynamic format", false));
+			BS_TEST_ASSERT(StringUtil::endsWith(messages[2], "[truncated]\n\t\t in function [file:12]\n", false));
+			BS_TEST_ASSERT(StringUtil::startsWith(messages[3], "Local 1", false));
+		}
+
+		for(UINT32 i = 0; i < 200; i++)
+			logger.log(LogVerbosity::Warning, 0, "function", "file", 14, "Rotation test message number {0}", i);
+
+		logger.shutDown();
+		BS_TEST_ASSERT(logger.getNumWritten() == 204);
+		BS_TEST_ASSERT(FileSystem::isFile(logDir + "Log.txt"));
+		BS_TEST_ASSERT(FileSystem::isFile(logDir + "Log.1.txt"));
+		BS_TEST_ASSERT(FileSystem::isFile(logDir + "Log.2.txt"));
+		BS_TEST_ASSERT(!FileSystem::exists(logDir + "Log.3.txt"));
+
+		FileSystem::remove(logDir);
+
+		// Errors logged from the logging thread can't wait on it, and must be written out directly
+		AsyncLogger* nestedLogger = nullptr;
+		UINT32 numNested = 0;
+		AsyncLogger reentrantLogger([&nestedLogger, &numNested](const String& message, LogVerbosity verbosity,
+			UINT32 category)
+		{
+			if (verbosity == LogVerbosity::Warning)
+			{
+				nestedLogger->log(LogVerbosity::Error, 0, "function", "file", 20, "Nested error");
+				nestedLogger->log(LogVerbosity::Fatal, 0, "function", "file", 21, "Nested fatal");
+			}
+			else
+				numNested++;
+		});
+
+		nestedLogger = &reentrantLogger;
+		reentrantLogger.startUp(AsyncLoggerDesc());
+		reentrantLogger.log(LogVerbosity::Warning, 0, "function", "file", 22, "Outer warning");
+		reentrantLogger.flush();
+
+		BS_TEST_ASSERT(numNested == 2);
+		reentrantLogger.shutDown();
+		BS_TEST_ASSERT(reentrantLogger.getNumWritten() == 3);
+
+		// Throughput, compared against formatting and storing the message on the calling thread. Both use the same
+		// number of threads.
+		Log log;
+		log.setMaxEntries(1024);
+
+		Timer timer;
+		Vector<Thread> syncThreads;
+		for(UINT32 i = 0; i < NUM_THREADS; i++)
+		{
+			syncThreads.emplace_back([&log]()
+			{
+				for(UINT32 j = 0; j < NUM_MESSAGES; j++)
+				{
+					log.logMsg(StringUtil::format("Message {0} with value {1}", j, 1.0f) + String("\n\t\t in ") +
+						__PRETTY_FUNCTION__ + " [" + __FILE__ + ":" + toString(__LINE__) + "]\n",
+						LogVerbosity::Warning, 0);
+				}
+			});
+		}
+
+		for(auto& thread : syncThreads)
+			thread.join();
+
+		UINT64 syncTime = timer.getMicroseconds();
+
+		LogEntry entry;
+		while(log.getUnreadEntry(entry))
+		{ }
+
+		BS_TEST_ASSERT(log.getEntries().size() == 1024);
+
+		AsyncLogger throughputLogger;
+		AsyncLoggerDesc throughputDesc;
+		throughputDesc.ringBufferCapacity = 4096;
+		throughputLogger.startUp(throughputDesc);
+
+		timer.reset();
+		Vector<Thread> threads;
+		for(UINT32 i = 0; i < NUM_THREADS; i++)
+		{
+			threads.emplace_back([&throughputLogger]()
+			{
+				for(UINT32 j = 0; j < NUM_MESSAGES; j++)
+				{
+					throughputLogger.log(LogVerbosity::Warning, 0, __PRETTY_FUNCTION__, __FILE__, __LINE__,
+						"Message {0} with value {1}", j, 1.0f);
+				}
+			});
+		}
+
+		for(auto& thread : threads)
+			thread.join();
+
+		UINT64 asyncTime = timer.getMicroseconds();
+
+		throughputLogger.shutDown();
+		BS_TEST_ASSERT(throughputLogger.getNumWritten() + throughputLogger.getNumDropped() == NUM_THREADS * NUM_MESSAGES);
+
+		BS_LOG(Info, Generic, "Logging {0} messages on each of {1} threads. Synchronous: {2} us, asynchronous: {3} us, "
+			"{4} dropped", NUM_MESSAGES, NUM_THREADS, syncTime, asyncTime, throughputLogger.getNumDropped());
+	}
+
+	void UtilityTestSuite::testStartupTrace()
+	{
+		BS_TEST_ASSERT(getStartupTraceName<StartupTraceOuterModule>() == "StartupTraceOuterModule");
+		BS_TEST_ASSERT(getStartupTraceName<Vector<UINT32>>().find("vector") != String::npos);
+		BS_TEST_ASSERT(StartupTrace::_parseTypeName(
+			"class bs::String __cdecl bs::getStartupTraceName<class bs::Resources>(void)") == "Resources");
+		BS_TEST_ASSERT(StartupTrace::_parseTypeName(
+			"bs::String bs::getStartupTraceName() [T = bs::ct::Renderer]") == "ct::Renderer");
+
+		// Recording is opt-in
+		BS_TEST_ASSERT(!StartupTrace::isRecording());
+
+		StartupTrace::begin();
+		StartupTraceOuterModule::startUp();
+		StartupTrace::end();
+
+		// Events recorded after the trace ends are ignored
+		StartupTrace::record(StartupEventType::Custom, "Ignored", StartupTrace::getTime());
+		StartupTraceOuterModule::shutDown();
+
+		Vector<StartupEvent> events = StartupTrace::getEvents();
+		BS_TEST_ASSERT(events.size() == 3);
+		if(events.size() == 3)
+		{
+			// Events are stored in the order they finish
+			BS_TEST_ASSERT(events[0].type == StartupEventType::Resource && events[0].depth == 1);
+			BS_TEST_ASSERT(events[1].name == "StartupTraceInnerModule" && events[1].depth == 1);
+			BS_TEST_ASSERT(events[2].name == "StartupTraceOuterModule" && events[2].depth == 0);
+			BS_TEST_ASSERT(events[2].start <= events[0].start);
+			BS_TEST_ASSERT(events[2].duration >= events[0].duration + events[1].duration);
+			BS_TEST_ASSERT(StartupTrace::getTotalTime() >= events[2].start + events[2].duration);
+		}
+
+		const String report = StartupTrace::generateReport();
+		const String::size_type outerPos = report.find("  StartupTraceOuterModule");
+		const String::size_type innerPos = report.find("    StartupTraceInnerModule");
+		BS_TEST_ASSERT(outerPos != String::npos && innerPos != String::npos && outerPos < innerPos);
+		BS_TEST_ASSERT(report.find("OuterResource") != String::npos);
+		BS_TEST_ASSERT(report.find("Ignored") == String::npos);
+
+		// Events past the limit are dropped
+		StartupTrace::begin();
+		for(UINT32 i = 0; i < StartupTrace::MAX_EVENTS + 10; i++)
+			StartupTrace::record(StartupEventType::Custom, "Event", StartupTrace::getTime());
+
+		StartupTrace::end();
+		BS_TEST_ASSERT(StartupTrace::getEvents().size() == StartupTrace::MAX_EVENTS);
+		BS_TEST_ASSERT(StartupTrace::getNumDropped() == 10);
+		BS_TEST_ASSERT(StartupTrace::generateReport(0).find("Dropped: 10") != String::npos);
+	}
+
+	void UtilityTestSuite::testTetrahedralization()
+	{
+		static constexpr UINT32 NUM_POINTS = 2000;
+		static constexpr UINT32 NUM_TIMED_POINTS = 50000;
+		static constexpr UINT32 NUM_TIMED_CHANGES = 500;
+
+		// Checks that the tetrahedra are positively oriented, that neighbors are consistent and that the volume
+		// matches the expected volume (if provided)
+		auto isVolumeValid = [](const TetrahedronVolume& volume, const Vector<Vector3>& points, double expectedVolume)
+		{
+			auto toDouble = [&points](INT32 idx)
+			{
+				return std::array<double, 3>{ { points[idx].x, points[idx].y, points[idx].z } };
+			};
+
+			double totalVolume = 0.0;
+			for (UINT32 i = 0; i < (UINT32)volume.tetrahedra.size(); i++)
+			{
+				const Tetrahedron& tet = volume.tetrahedra[i];
+				const auto a = toDouble(tet.vertices[0]);
+				const auto b = toDouble(tet.vertices[1]);
+				const auto c = toDouble(tet.vertices[2]);
+				const auto d = toDouble(tet.vertices[3]);
+
+				const double e0[3] = { b[0] - a[0], b[1] - a[1], b[2] - a[2] };
+				const double e1[3] = { c[0] - a[0], c[1] - a[1], c[2] - a[2] };
+				const double e2[3] = { d[0] - a[0], d[1] - a[1], d[2] - a[2] };
+
+				const double det = e0[0] * (e1[1] * e2[2] - e1[2] * e2[1]) - e0[1] * (e1[0] * e2[2] - e1[2] * e2[0]) +
+					e0[2] * (e1[0] * e2[1] - e1[1] * e2[0]);
+
+				if (det < 0.0)
+					return false;
+
+				totalVolume += det / 6.0;
+
+				for (UINT32 j = 0; j < 4; j++)
+				{
+					const INT32 neighborIdx = tet.neighbors[j];
+					if (neighborIdx == -1)
+						continue;
+
+					// Neighbor must share all vertices except the opposite one, and must point back
+					const Tetrahedron& neighbor = volume.tetrahedra[neighborIdx];
+					UINT32 numShared = 0;
+					bool pointsBack = false;
+					for (UINT32 k = 0; k < 4; k++)
+					{
+						if (neighbor.neighbors[k] == (INT32)i)
+							pointsBack = true;
+
+						for (UINT32 l = 0; l < 4; l++)
+						{
+							if (l != j && neighbor.vertices[k] == tet.vertices[l])
+								numShared++;
+						}
+					}
+
+					if (numShared != 3 || !pointsBack)
+						return false;
+				}
+			}
+
+			for (auto& entry : volume.outerFaces)
+			{
+				const Tetrahedron& tet = volume.tetrahedra[entry.tetrahedron];
+				if (std::find(tet.neighbors, tet.neighbors + 4, -1) == tet.neighbors + 4)
+					return false;
+			}
+
+			return expectedVolume <= 0.0 || std::abs(totalVolume - expectedVolume) < expectedVolume * 0.0001;
+		};
+
+		// Random points in general position have a single Delaunay tetrahedralization
+		Random random(5);
+		Vector<Vector3> points(NUM_POINTS);
+		for (auto& entry : points)
+			entry = Vector3(random.getSNorm(), random.getSNorm(), random.getSNorm()) * 10.0f;
+
+		IncrementalTetrahedralization tetrahedralization;
+		for (UINT32 i = 0; i < NUM_POINTS; i++)
+			tetrahedralization.addPoint(i, points[i]);
+
+		TetrahedronVolume reference = Triangulation::tetrahedralize(points);
+		TetrahedronVolume volume = tetrahedralization.getVolume();
+		BS_TEST_ASSERT(isVolumeValid(volume, points, 0.0));
+		BS_TEST_ASSERT(volume.tetrahedra.size() == reference.tetrahedra.size());
+		BS_TEST_ASSERT(volume.outerFaces.size() == reference.outerFaces.size());
+
+		// Points added after the initial volume was generated, removed points and moved points
+		Vector<Vector3> extraPoints(NUM_POINTS / 4);
+		for (auto& entry : extraPoints)
+			entry = Vector3(random.getSNorm(), random.getSNorm(), random.getSNorm()) * 12.0f;
+
+		for (UINT32 i = 0; i < (UINT32)extraPoints.size(); i++)
+			tetrahedralization.addPoint(NUM_POINTS + i, extraPoints[i]);
+
+		Vector<Vector3> allPoints = points;
+		allPoints.insert(allPoints.end(), extraPoints.begin(), extraPoints.end());
+
+		for (UINT32 i = 0; i < NUM_POINTS; i += 3)
+			tetrahedralization.removePoint(i);
+
+		for (UINT32 i = 1; i < NUM_POINTS; i += 30)
+		{
+			allPoints[i] = Vector3(random.getSNorm(), random.getSNorm(), random.getSNorm()) * 11.0f;
+			tetrahedralization.addPoint(i, allPoints[i]);
+		}
+
+		Vector<Vector3> remainingPoints;
+		for (UINT32 i = 0; i < (UINT32)allPoints.size(); i++)
+		{
+			if (i >= NUM_POINTS || (i % 3) != 0)
+				remainingPoints.push_back(allPoints[i]);
+		}
+
+		BS_TEST_ASSERT(tetrahedralization.getNumPoints() == (UINT32)remainingPoints.size());
+
+		reference = Triangulation::tetrahedralize(remainingPoints);
+		volume = tetrahedralization.getVolume();
+		BS_TEST_ASSERT(isVolumeValid(volume, allPoints, 0.0));
+		BS_TEST_ASSERT(volume.tetrahedra.size() == reference.tetrahedra.size());
+		BS_TEST_ASSERT(volume.outerFaces.size() == reference.outerFaces.size());
+
+		// Grid points are co-spherical and co-planar, and must still fill their bounds exactly
+		static constexpr UINT32 GRID_SIZE = 8;
+		Vector<Vector3> gridPoints;
+		for (UINT32 z = 0; z < GRID_SIZE; z++)
+		{
+			for (UINT32 y = 0; y < GRID_SIZE; y++)
+			{
+				for (UINT32 x = 0; x < GRID_SIZE; x++)
+					gridPoints.push_back(Vector3((float)x, (float)y * 0.5f, (float)z));
+			}
+		}
+
+		const double gridVolume = (GRID_SIZE - 1) * (GRID_SIZE - 1) * (GRID_SIZE - 1) * 0.5;
+
+		IncrementalTetrahedralization gridTetrahedralization;
+		for (UINT32 i = 0; i < (UINT32)gridPoints.size(); i++)
+			gridTetrahedralization.addPoint(i, gridPoints[i]);
+
+		volume = gridTetrahedralization.getVolume();
+		BS_TEST_ASSERT(isVolumeValid(volume, gridPoints, gridVolume));
+
+		// Removing and restoring points, including points on the boundary, results in the same tetrahedralization
+		for (UINT32 i = 0; i < (UINT32)gridPoints.size(); i += 5)
+			gridTetrahedralization.removePoint(i);
+
+		for (UINT32 i = 0; i < (UINT32)gridPoints.size(); i += 5)
+			gridTetrahedralization.addPoint(i, gridPoints[i]);
+
+		const UINT32 numTets = (UINT32)volume.tetrahedra.size();
+		volume = gridTetrahedralization.getVolume();
+		BS_TEST_ASSERT(isVolumeValid(volume, gridPoints, gridVolume));
+		BS_TEST_ASSERT(volume.tetrahedra.size() == numTets);
+
+		// Coincident points are ignored until the other point is removed
+		gridPoints.push_back(gridPoints[10]);
+		gridTetrahedralization.addPoint((UINT32)gridPoints.size() - 1, gridPoints.back());
+		gridTetrahedralization.removePoint(10);
+
+		volume = gridTetrahedralization.getVolume();
+		BS_TEST_ASSERT(isVolumeValid(volume, gridPoints, gridVolume));
+		BS_TEST_ASSERT(gridTetrahedralization.getNumPoints() == (UINT32)gridPoints.size() - 1);
+
+		// Timing of a full rebuild compared to a small change
+		Vector<Vector3> timedPoints(NUM_TIMED_POINTS);
+		for (auto& entry : timedPoints)
+			entry = Vector3(random.getSNorm(), random.getSNorm(), random.getSNorm()) * 100.0f;
+
+		Timer timer;
+		reference = Triangulation::tetrahedralize(timedPoints);
+		const UINT64 referenceTime = timer.getMicroseconds();
+
+		timer.reset();
+		IncrementalTetrahedralization timedTetrahedralization;
+		for (UINT32 i = 0; i < NUM_TIMED_POINTS; i++)
+			timedTetrahedralization.addPoint(i, timedPoints[i]);
+
+		volume = timedTetrahedralization.getVolume();
+		const UINT64 buildTime = timer.getMicroseconds();
+
+		BS_TEST_ASSERT(isVolumeValid(volume, timedPoints, 0.0));
+
+		timer.reset();
+		for (UINT32 i = 0; i < NUM_TIMED_CHANGES; i++)
+		{
+			const UINT32 idx = (i * 7919) % NUM_TIMED_POINTS;
+			timedPoints[idx] += Vector3(random.getSNorm(), random.getSNorm(), random.getSNorm());
+			timedTetrahedralization.addPoint(idx, timedPoints[idx]);
+		}
+
+		const UINT64 updateTime = timer.getMicroseconds();
+
+		timer.reset();
+		volume = timedTetrahedralization.getVolume();
+		const UINT64 outputTime = timer.getMicroseconds();
+
+		BS_TEST_ASSERT(isVolumeValid(volume, timedPoints, 0.0));
+
+		BS_LOG(Info, Generic, "Tetrahedralizing {0} points. TetGen: {1} us, incremental: {2} us, moving {3} points: "
+			"{4} us (+{5} us output)", NUM_TIMED_POINTS, referenceTime, buildTime, NUM_TIMED_CHANGES, updateTime,
+			outputTime);
+	}
 }
@@ -23,5 +23,9 @@ namespace bs
 		void testQuadtree();
 		void testVarInt();
 		void testBitStream();
+		void testMemberwiseCloner();
+		void testAsyncLogger();
+		void testStartupTrace();
+		void testTetrahedralization();
 	};
 }
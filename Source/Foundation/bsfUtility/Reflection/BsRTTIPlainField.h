@@ -92,6 +92,21 @@ namespace bs
 		 * less bytes than its raw type, and at sub-byte increments (e.g. one bit for a boolean).
 		 */
 		virtual void arrayElemFromBuffer(RTTITypeBase* rtti, void* object, int index, Bitstream& stream, bool compress = false) = 0;
+
+		/**
+		 * Retrieves the value from the field of the source object and assigns it directly to the same field on the
+		 * destination object, without going through an intermediate buffer. Both objects must be of the type that owns
+		 * the field.
+		 */
+		virtual void copy(RTTITypeBase* srcRtti, void* srcObject, RTTITypeBase* dstRtti, void* dstObject) = 0;
+
+		/**
+		 * Retrieves the value at the specified array index from the field of the source object and assigns it directly
+		 * to the same array index on the destination object, without going through an intermediate buffer. Destination
+		 * array must already be of adequate size.
+		 */
+		virtual void arrayElemCopy(RTTITypeBase* srcRtti, void* srcObject, RTTITypeBase* dstRtti, void* dstObject,
+			int index) = 0;
 	};
 
 	/** Represents a plain class field containing a specific type. */
@@ -296,6 +311,45 @@ namespace bs
 			(rttiObject->*arraySetter)(castObject, index, value);
 		}
 
+		/** @copydoc RTTIPlainFieldBase::copy */
+		void copy(RTTITypeBase* srcRtti, void* srcObject, RTTITypeBase* dstRtti, void* dstObject) override
+		{
+			checkIsArray(false);
+			checkType<DataType>();
+
+			if(!setter)
+			{
+				BS_EXCEPT(InternalErrorException,
+					"Specified field (" + name + ") has no setter.");
+			}
+
+			InterfaceType* srcRttiObject = static_cast<InterfaceType*>(srcRtti);
+			InterfaceType* dstRttiObject = static_cast<InterfaceType*>(dstRtti);
+
+			DataType value = (srcRttiObject->*getter)(static_cast<ObjectType*>(srcObject));
+			(dstRttiObject->*setter)(static_cast<ObjectType*>(dstObject), value);
+		}
+
+		/** @copydoc RTTIPlainFieldBase::arrayElemCopy */
+		void arrayElemCopy(RTTITypeBase* srcRtti, void* srcObject, RTTITypeBase* dstRtti, void* dstObject,
+			int index) override
+		{
+			checkIsArray(true);
+			checkType<DataType>();
+
+			if(!arraySetter)
+			{
+				BS_EXCEPT(InternalErrorException,
+					"Specified field (" + name + ") has no setter.");
+			}
+
+			InterfaceType* srcRttiObject = static_cast<InterfaceType*>(srcRtti);
+			InterfaceType* dstRttiObject = static_cast<InterfaceType*>(dstRtti);
+
+			DataType value = (srcRttiObject->*arrayGetter)(static_cast<ObjectType*>(srcObject), index);
+			(dstRttiObject->*arraySetter)(static_cast<ObjectType*>(dstObject), index, value);
+		}
+
 	private:
 		union
 		{
@@ -0,0 +1,284 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#include "Serialization/BsMemberwiseCloner.h"
+#include "Reflection/BsIReflectable.h"
+#include "Reflection/BsRTTIType.h"
+#include "Reflection/BsRTTIField.h"
+#include "Reflection/BsRTTIPlainField.h"
+#include "Reflection/BsRTTIReflectableField.h"
+#include "Reflection/BsRTTIReflectablePtrField.h"
+#include "Reflection/BsRTTIManagedDataBlockField.h"
+#include "FileSystem/BsDataStream.h"
+#include "Debug/BsDebug.h"
+
+namespace bs
+{
+	MemberwiseCloner::MemberwiseCloner()
+		:mAlloc(&gFrameAlloc())
+	{ }
+
+	SPtr<IReflectable> MemberwiseCloner::clone(IReflectable* object, bool shallow, SerializationContext* context)
+	{
+		if (object == nullptr)
+			return nullptr;
+
+		mShallow = shallow;
+		mContext = context;
+		mClonedObjects.clear();
+
+		mAlloc->markFrame();
+
+		SPtr<IReflectable> clonedObj = object->getRTTI()->newRTTIObject();
+
+		// Register the root so references back to it resolve to its clone
+		ClonedObject& rootEntry = mClonedObjects[object];
+		rootEntry.clone = clonedObj;
+		rootEntry.cloneInProgress = true;
+
+		cloneObject(object, clonedObj.get());
+
+		rootEntry.cloneInProgress = false;
+		rootEntry.isCloned = true;
+
+		// Objects referenced only through weak references haven't been populated yet
+		bool foundObjectToProcess;
+		do
+		{
+			foundObjectToProcess = false;
+			for (auto& entry : mClonedObjects)
+			{
+				ClonedObject& clonedEntry = entry.second;
+				if (clonedEntry.isCloned || clonedEntry.cloneInProgress)
+					continue;
+
+				clonedEntry.cloneInProgress = true;
+				cloneObject(clonedEntry.original.get(), clonedEntry.clone.get());
+				clonedEntry.cloneInProgress = false;
+				clonedEntry.isCloned = true;
+
+				foundObjectToProcess = true;
+				break; // Need to start over as mClonedObjects was possibly modified
+			}
+		} while (foundObjectToProcess);
+
+		mClonedObjects.clear();
+		mAlloc->clear();
+
+		mContext = nullptr;
+		return clonedObj;
+	}
+
+	void MemberwiseCloner::cloneObject(IReflectable* original, IReflectable* clone)
+	{
+		FrameVector<RTTITypeBase*> cloneRttiInstances;
+
+		RTTITypeBase* cloneRtti = clone->getRTTI();
+		while (cloneRtti)
+		{
+			cloneRttiInstances.push_back(cloneRtti->_clone(*mAlloc));
+			cloneRtti = cloneRtti->getBaseClass();
+		}
+
+		// Iterate in reverse to notify base classes before derived classes, same as BinarySerializer
+		for (auto iter = cloneRttiInstances.rbegin(); iter != cloneRttiInstances.rend(); ++iter)
+			(*iter)->onDeserializationStarted(clone, mContext);
+
+		FrameStack<RTTITypeBase*> originalRttiInstances;
+
+		RTTITypeBase* originalRtti = original->getRTTI();
+		while (originalRtti)
+		{
+			RTTITypeBase* originalRttiInstance = originalRtti->_clone(*mAlloc);
+			originalRttiInstances.push(originalRttiInstance);
+
+			originalRttiInstance->onSerializationStarted(original, nullptr);
+
+			// Find the same class in the hierarchy of the cloned object. It will be missing only if the cloned object
+			// was created with a base type of the original (e.g. when cloning a value field holding a derived type).
+			UINT32 cloneRttiIdx = 0;
+			cloneRtti = clone->getRTTI();
+			while (cloneRtti != nullptr && cloneRtti != originalRtti)
+			{
+				cloneRtti = cloneRtti->getBaseClass();
+				cloneRttiIdx++;
+			}
+
+			if (cloneRtti != nullptr)
+			{
+				cloneFields(originalRtti, original, originalRttiInstance, clone, cloneRttiInstances[cloneRttiIdx]);
+			}
+
+			originalRtti = originalRtti->getBaseClass();
+		}
+
+		while (!originalRttiInstances.empty())
+		{
+			RTTITypeBase* originalRttiInstance = originalRttiInstances.top();
+			originalRttiInstance->onSerializationEnded(original, nullptr);
+			mAlloc->destruct(originalRttiInstance);
+
+			originalRttiInstances.pop();
+		}
+
+		// Note: Same as BinarySerializer, base classes are notified before derived classes
+		for (auto iter = cloneRttiInstances.rbegin(); iter != cloneRttiInstances.rend(); ++iter)
+		{
+			RTTITypeBase* cloneRttiInstance = *iter;
+
+			cloneRttiInstance->onDeserializationEnded(clone, mContext);
+			mAlloc->destruct(cloneRttiInstance);
+		}
+	}
+
+	void MemberwiseCloner::cloneFields(RTTITypeBase* rtti, IReflectable* original, RTTITypeBase* originalRtti,
+		IReflectable* clone, RTTITypeBase* cloneRtti)
+	{
+		const UINT32 numFields = rtti->getNumFields();
+		for (UINT32 i = 0; i < numFields; i++)
+		{
+			RTTIField* curGenericField = rtti->getField(i);
+			const bool weakRef = curGenericField->schema.info.flags.isSet(RTTIFieldFlag::WeakRef);
+
+			if (curGenericField->schema.isArray)
+			{
+				const UINT32 arrayNumElems = curGenericField->getArraySize(originalRtti, original);
+				curGenericField->setArraySize(cloneRtti, clone, arrayNumElems);
+
+				switch (curGenericField->schema.type)
+				{
+				case SerializableFT_ReflectablePtr:
+				{
+					auto* curField = static_cast<RTTIReflectablePtrFieldBase*>(curGenericField);
+
+					for (UINT32 arrIdx = 0; arrIdx < arrayNumElems; arrIdx++)
+					{
+						SPtr<IReflectable> childObject = curField->getArrayValue(originalRtti, original, arrIdx);
+						curField->setArrayValue(cloneRtti, clone, arrIdx, cloneReference(childObject, weakRef));
+					}
+
+					break;
+				}
+				case SerializableFT_Reflectable:
+				{
+					auto* curField = static_cast<RTTIReflectableFieldBase*>(curGenericField);
+
+					for (UINT32 arrIdx = 0; arrIdx < arrayNumElems; arrIdx++)
+					{
+						IReflectable& childObject = curField->getArrayValue(originalRtti, original, arrIdx);
+
+						SPtr<IReflectable> clonedChild = curField->newObject();
+						cloneObject(&childObject, clonedChild.get());
+
+						curField->setArrayValue(cloneRtti, clone, arrIdx, *clonedChild);
+					}
+
+					break;
+				}
+				case SerializableFT_Plain:
+				{
+					auto* curField = static_cast<RTTIPlainFieldBase*>(curGenericField);
+
+					for (UINT32 arrIdx = 0; arrIdx < arrayNumElems; arrIdx++)
+						curField->arrayElemCopy(originalRtti, original, cloneRtti, clone, arrIdx);
+
+					break;
+				}
+				default:
+					BS_LOG(Error, Serialization,
+						"Error cloning data. Encountered a type I don't know how to clone. Type: {0}, Is array: {1}",
+						curGenericField->schema.type, curGenericField->schema.isArray);
+				}
+			}
+			else
+			{
+				switch (curGenericField->schema.type)
+				{
+				case SerializableFT_ReflectablePtr:
+				{
+					auto* curField = static_cast<RTTIReflectablePtrFieldBase*>(curGenericField);
+
+					SPtr<IReflectable> childObject = curField->getValue(originalRtti, original);
+					curField->setValue(cloneRtti, clone, cloneReference(childObject, weakRef));
+
+					break;
+				}
+				case SerializableFT_Reflectable:
+				{
+					auto* curField = static_cast<RTTIReflectableFieldBase*>(curGenericField);
+					IReflectable& childObject = curField->getValue(originalRtti, original);
+
+					SPtr<IReflectable> clonedChild = curField->newObject();
+					cloneObject(&childObject, clonedChild.get());
+
+					curField->setValue(cloneRtti, clone, *clonedChild);
+					break;
+				}
+				case SerializableFT_Plain:
+				{
+					auto* curField = static_cast<RTTIPlainFieldBase*>(curGenericField);
+					curField->copy(originalRtti, original, cloneRtti, clone);
+
+					break;
+				}
+				case SerializableFT_DataBlock:
+				{
+					auto* curField = static_cast<RTTIManagedDataBlockFieldBase*>(curGenericField);
+
+					UINT32 dataBlockSize = 0;
+					SPtr<DataStream> blockStream = curField->getValue(originalRtti, original, dataBlockSize);
+
+					SPtr<MemoryDataStream> dataBlockStream = bs_shared_ptr_new<MemoryDataStream>(dataBlockSize);
+					blockStream->read(dataBlockStream->data(), dataBlockSize);
+
+					curField->setValue(cloneRtti, clone, dataBlockStream, dataBlockSize);
+					break;
+				}
+				default:
+					BS_LOG(Error, Serialization,
+						"Error cloning data. Encountered a type I don't know how to clone. Type: {0}, Is array: {1}",
+						curGenericField->schema.type, curGenericField->schema.isArray);
+				}
+			}
+		}
+	}
+
+	SPtr<IReflectable> MemberwiseCloner::cloneReference(const SPtr<IReflectable>& object, bool weakRef)
+	{
+		if (object == nullptr || mShallow)
+			return object;
+
+		auto iterFind = mClonedObjects.find(object.get());
+		if (iterFind == mClonedObjects.end())
+		{
+			ClonedObject newEntry;
+
+			// Keep a reference to the original so it isn't released (and its address re-used) during cloning
+			newEntry.original = object;
+			newEntry.clone = object->getRTTI()->newRTTIObject();
+
+			iterFind = mClonedObjects.insert(std::make_pair(object.get(), newEntry)).first;
+		}
+
+		// Note: References to map elements remain valid even if the map is modified during cloneObject()
+		ClonedObject& clonedEntry = iterFind->second;
+		if (!weakRef && !clonedEntry.isCloned)
+		{
+			if (clonedEntry.cloneInProgress)
+			{
+				BS_LOG(Warning, Serialization, "Detected a circular reference when cloning. Referenced object's fields "
+					"will be resolved in an undefined order (i.e. one of the objects will not be fully cloned when "
+					"assigned to its field). Use RTTI_Flag_WeakRef to get rid of this warning and tell the system which "
+					"of the objects is allowed to be cloned after it is assigned to its field.");
+			}
+			else
+			{
+				clonedEntry.cloneInProgress = true;
+				cloneObject(object.get(), clonedEntry.clone.get());
+				clonedEntry.cloneInProgress = false;
+				clonedEntry.isCloned = true;
+			}
+		}
+
+		return clonedEntry.clone;
+	}
+}
@@ -0,0 +1,77 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "Prerequisites/BsPrerequisitesUtil.h"
+
+namespace bs
+{
+	struct SerializationContext;
+
+	/** @addtogroup Serialization
+	 *  @{
+	 */
+
+	/**
+	 * Helper class that performs cloning of an object that implements RTTI, by walking over its RTTI fields and copying
+	 * their values directly from the original object into the new object. Unlike BinaryCloner the data never passes
+	 * through an intermediate stream, which makes it considerably faster for cloning large object hierarchies.
+	 *
+	 * Serialization callbacks are triggered on the original objects, and deserialization callbacks on the cloned objects,
+	 * in the same order as they would be triggered by BinarySerializer. This means the cloned objects end up in the same
+	 * state as if they were encoded and then decoded.
+	 *
+	 * A single cloner can be used for cloning multiple objects, in which case its internal storage is reused.
+	 */
+	class BS_UTILITY_EXPORT MemberwiseCloner
+	{
+	public:
+		MemberwiseCloner();
+
+		/**
+		 * Returns a copy of the provided object with identical data.
+		 *
+		 * @param[in]	object		Object to clone.
+		 * @param[in]	shallow		If false then all referenced objects will be cloned as well, otherwise the references
+		 *							to the original objects will be kept.
+		 * @param[in]	context		Optional object that will be passed along to the deserialization callbacks of all the
+		 *							newly created objects. Serialization callbacks of the original objects receive no
+		 *							context.
+		 */
+		SPtr<IReflectable> clone(IReflectable* object, bool shallow = false, SerializationContext* context = nullptr);
+
+	private:
+		/** Information about an object referenced through a pointer field, and its clone. */
+		struct ClonedObject
+		{
+			SPtr<IReflectable> original;
+			SPtr<IReflectable> clone;
+			bool isCloned = false;
+			bool cloneInProgress = false;
+		};
+
+		/**
+		 * Copies the values of all fields (including fields of base classes) from the original object into the
+		 * destination object. Destination object must be of the same type as the original, or one of its base types.
+		 */
+		void cloneObject(IReflectable* original, IReflectable* clone);
+
+		/** Copies values of all the fields belonging to a single class in an object's class hierarchy. */
+		void cloneFields(RTTITypeBase* rtti, IReflectable* original, RTTITypeBase* originalRtti, IReflectable* clone,
+			RTTITypeBase* cloneRtti);
+
+		/**
+		 * Returns a clone of an object referenced through a pointer field. The object is only cloned once, no matter how
+		 * many times it is referenced. If @p weakRef is true the returned object might not have its fields populated
+		 * until later.
+		 */
+		SPtr<IReflectable> cloneReference(const SPtr<IReflectable>& object, bool weakRef);
+
+		UnorderedMap<IReflectable*, ClonedObject> mClonedObjects;
+		SerializationContext* mContext = nullptr;
+		FrameAlloc* mAlloc = nullptr;
+		bool mShallow = false;
+	};
+
+	/** @} */
+}
@@ -57,12 +57,49 @@ namespace bs
 		template<class T, class... Args>
 		static BasicString<T> format(const T* source, Args&& ...args)
 		{
-			UINT32 strLength = getLength(source);
-
 			ParamData<T> parameters[MAX_PARAMS];
 			memset(parameters, 0, sizeof(parameters));
 			getParams(parameters, 0U, std::forward<Args>(args)...);
 
+			BasicString<T> outputStr = formatInternal(source, parameters);
+
+			for (UINT32 i = 0; i < MAX_PARAMS; i++)
+			{
+				if (parameters[i].buffer != nullptr)
+					bs_free(parameters[i].buffer);
+			}
+
+			return outputStr;
+		}
+
+		/**
+		 * Same as format(const T*, Args&&...) except the parameters are provided already converted to their string
+		 * representations. Parameters past the maximum parameter count are ignored.
+		 */
+		static String formatParams(const char* source, const String* params, UINT32 numParams)
+		{
+			ParamData<char> parameters[MAX_PARAMS];
+			memset(parameters, 0, sizeof(parameters));
+
+			if (numParams > MAX_PARAMS)
+				numParams = MAX_PARAMS;
+
+			for (UINT32 i = 0; i < numParams; i++)
+			{
+				parameters[i].buffer = const_cast<char*>(params[i].data());
+				parameters[i].size = (UINT32)params[i].size();
+			}
+
+			return formatInternal(source, parameters);
+		}
+
+	private:
+		/** Replaces the identifiers in @p source with the provided parameters. */
+		template<class T>
+		static BasicString<T> formatInternal(const T* source, const ParamData<T>* parameters)
+		{
+			UINT32 strLength = getLength(source);
+
 			T bracketChars[MAX_IDENTIFIER_SIZE + 1];
 			UINT32 bracketWriteIdx = 0;
 
@@ -156,16 +193,9 @@ namespace bs
 			BasicString<T> outputStr(outputBuffer, finalStringSize);
 			bs_free(outputBuffer);
 
-			for (UINT32 i = 0; i < MAX_PARAMS; i++)
-			{
-				if (parameters[i].buffer != nullptr)
-					bs_free(parameters[i].buffer);
-			}
-
 			return outputStr;
 		}
 
-	private:
 		/**
 		 * Set of methods that can be specialized so we have a generalized way for retrieving length of strings of
 		 * different types.
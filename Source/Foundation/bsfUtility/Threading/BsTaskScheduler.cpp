@@ -227,14 +227,6 @@ namespace bs
 	{
 		task->mTaskWorker();
 
-		{
-			Lock lock(mReadyMutex);
-
-			auto findIter = std::find(mActiveTasks.begin(), mActiveTasks.end(), task);
-			if (findIter != mActiveTasks.end())
-				mActiveTasks.erase(findIter);
-		}
-
 		{
 			Lock lock(mCompleteMutex);
 			task->mState.store(2);
@@ -242,10 +234,15 @@ namespace bs
 			mTaskCompleteCond.notify_all();
 		}
 
-		// Wake the main scheduler thread in case there are other tasks waiting or this task was someone's dependency
+		// Wake the main scheduler thread in case there are other tasks waiting or this task was someone's dependency.
+		// Task is removed from the active list last, as the scheduler may be destroyed as soon as the list is empty.
 		{
 			Lock lock(mReadyMutex);
 
+			auto findIter = std::find(mActiveTasks.begin(), mActiveTasks.end(), task);
+			if (findIter != mActiveTasks.end())
+				mActiveTasks.erase(findIter);
+
 			mCheckTasks = true;
 			mTaskReadyCond.notify_one();
 		}
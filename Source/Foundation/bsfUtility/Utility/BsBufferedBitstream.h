@@ -156,6 +156,9 @@ namespace bs
 
 			mBufferedRangeStart = 0;
 			mBufferedRangeEnd = (uint64_t)mLength * 8;
+
+			// Stream might not be positioned at its start
+			mMemBitstream.seek(mCursor);
 		}
 	}
 
@@ -22,6 +22,8 @@ namespace bs
 
 			if (mStream->isFile())
 				mReadBuffer = (char*)bs_alloc(32768);
+			else
+				mBufferOffset = mStream->tell(); // Memory is accessed directly, so start from the current stream position
 		}
 
 		virtual ~DataStreamSource()
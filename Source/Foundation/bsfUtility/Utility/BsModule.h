@@ -4,6 +4,7 @@
 
 #include "Prerequisites/BsPrerequisitesUtil.h"
 #include "Error/BsException.h"
+#include "Debug/BsStartupTrace.h"
 
 namespace bs
 {
@@ -68,10 +69,17 @@ namespace bs
 			if (isStartedUp())
 				BS_EXCEPT(InternalErrorException, "Trying to start an already started module.");
 
+			const UINT64 startTime = StartupTrace::getTime();
+			StartupTrace::_beginModule();
+
 			_instance() = bs_new<T>(std::forward<Args>(args)...);
 			isStartedUp() = true;
 
 			((Module*)_instance())->onStartUp();
+
+			StartupTrace::_endModule();
+			if (StartupTrace::isRecording())
+				StartupTrace::record(StartupEventType::Module, getStartupTraceName<T>(), startTime);
 		}
 
 		/**
@@ -86,10 +94,17 @@ namespace bs
 			if (isStartedUp())
 				BS_EXCEPT(InternalErrorException, "Trying to start an already started module.");
 
+			const UINT64 startTime = StartupTrace::getTime();
+			StartupTrace::_beginModule();
+
 			_instance() = bs_new<SubType>(std::forward<Args>(args)...);
 			isStartedUp() = true;
 
 			((Module*)_instance())->onStartUp();
+
+			StartupTrace::_endModule();
+			if (StartupTrace::isRecording())
+				StartupTrace::record(StartupEventType::Module, getStartupTraceName<SubType>(), startTime);
 		}
 
 		/** Shuts down this module and frees any resources it is using. */
@@ -2,6 +2,7 @@
 //*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
 #include "Utility/BsTriangulation.h"
 #include "Math/BsVector3.h"
+#include "Debug/BsDebug.h"
 
 // Third party
 #include "TetGen/tetgen.h"
@@ -89,4 +90,1075 @@ namespace bs
 
 		return volume;
 	}
+
+	namespace
+	{
+		/**
+		 * Vertices of the tetrahedron face opposite to the vertex at the same index, ordered so the opposite vertex
+		 * lies on the positive side of the face.
+		 */
+		constexpr UINT32 FACE_VERTICES[4][3] = { { 1, 3, 2 }, { 0, 2, 3 }, { 0, 3, 1 }, { 0, 1, 2 } };
+
+		/** Returns a positive value if @p d lies on the positive side of the plane formed by @p a, @p b and @p c. */
+		template<class T>
+		double orient(const T& a, const T& b, const T& c, const T& d)
+		{
+			const double bx = b.x - a.x, by = b.y - a.y, bz = b.z - a.z;
+			const double cx = c.x - a.x, cy = c.y - a.y, cz = c.z - a.z;
+			const double dx = d.x - a.x, dy = d.y - a.y, dz = d.z - a.z;
+
+			return bx * (cy * dz - cz * dy) - by * (cx * dz - cz * dx) + bz * (cx * dy - cy * dx);
+		}
+
+		/**
+		 * Returns a negative value if @p e lies within the weighted circumsphere of the positively oriented tetrahedron
+		 * formed by @p a, @p b, @p c and @p d.
+		 */
+		template<class T>
+		double insphere(const T& a, const T& b, const T& c, const T& d, const T& e)
+		{
+			const double aex = a.x - e.x, aey = a.y - e.y, aez = a.z - e.z;
+			const double bex = b.x - e.x, bey = b.y - e.y, bez = b.z - e.z;
+			const double cex = c.x - e.x, cey = c.y - e.y, cez = c.z - e.z;
+			const double dex = d.x - e.x, dey = d.y - e.y, dez = d.z - e.z;
+
+			const double ab = aex * bey - bex * aey;
+			const double bc = bex * cey - cex * bey;
+			const double cd = cex * dey - dex * cey;
+			const double da = dex * aey - aex * dey;
+			const double ac = aex * cey - cex * aey;
+			const double bd = bex * dey - dex * bey;
+
+			const double abc = aez * bc - bez * ac + cez * ab;
+			const double bcd = bez * cd - cez * bd + dez * bc;
+			const double cda = cez * da + dez * ac + aez * cd;
+			const double dab = dez * ab + aez * bd + bez * da;
+
+			const double aLift = aex * aex + aey * aey + aez * aez - (a.weight - e.weight);
+			const double bLift = bex * bex + bey * bey + bez * bez - (b.weight - e.weight);
+			const double cLift = cex * cex + cey * cey + cez * cez - (c.weight - e.weight);
+			const double dLift = dex * dex + dey * dey + dez * dez - (d.weight - e.weight);
+
+			return (dLift * abc - cLift * dab) + (bLift * cda - aLift * bcd);
+		}
+
+		/** Generates a deterministic pseudo-random value in [0, 1) range for the provided point id. */
+		double getPointWeightFactor(UINT32 id)
+		{
+			UINT32 hash = id * 0x9E3779B1U;
+			hash ^= hash >> 16;
+			hash *= 0x85EBCA6BU;
+			hash ^= hash >> 13;
+
+			return (hash & 0xFFFFFF) / (double)0x1000000;
+		}
+
+		/** Spreads the lower 10 bits of the value so there are two zero bits between each bit. */
+		UINT32 spreadBits(UINT32 value)
+		{
+			value &= 0x3FF;
+			value = (value | (value << 16)) & 0x030000FF;
+			value = (value | (value << 8)) & 0x0300F00F;
+			value = (value | (value << 4)) & 0x030C30C3;
+			value = (value | (value << 2)) & 0x09249249;
+
+			return value;
+		}
+
+		/** Sorted vertices of a tetrahedron face, used for finding matching faces. */
+		struct FaceKey
+		{
+			FaceKey(INT32 a, INT32 b, INT32 c)
+			{
+				if (a > b) std::swap(a, b);
+				if (b > c) std::swap(b, c);
+				if (a > b) std::swap(a, b);
+
+				vertices[0] = a;
+				vertices[1] = b;
+				vertices[2] = c;
+			}
+
+			bool operator<(const FaceKey& other) const
+			{
+				return std::lexicographical_compare(vertices, vertices + 3, other.vertices, other.vertices + 3);
+			}
+
+			bool operator==(const FaceKey& other) const
+			{
+				return vertices[0] == other.vertices[0] && vertices[1] == other.vertices[1] &&
+					vertices[2] == other.vertices[2];
+			}
+
+			INT32 vertices[3];
+		};
+
+		/** Checks if the two triangles have the same vertices in the same winding order. */
+		bool isSameWinding(const INT32* a, const INT32* b)
+		{
+			for (UINT32 i = 0; i < 3; i++)
+			{
+				if (a[0] == b[i] && a[1] == b[(i + 1) % 3] && a[2] == b[(i + 2) % 3])
+					return true;
+			}
+
+			return false;
+		}
+	}
+
+	void IncrementalTetrahedralization::addPoint(UINT32 id, const Vector3& position)
+	{
+		addPoint(id, position, -1.0);
+	}
+
+	void IncrementalTetrahedralization::addPoint(UINT32 id, const Vector3& position, double weight)
+	{
+		if (id >= (UINT32)mPoints.size())
+		{
+			Point emptyPoint;
+			emptyPoint.x = emptyPoint.y = emptyPoint.z = 0.0;
+			emptyPoint.weight = -1.0;
+			emptyPoint.tetrahedron = -1;
+			emptyPoint.state = PointState::None;
+
+			mPoints.resize(id + 1, emptyPoint);
+		}
+
+		if (mPoints[id].state != PointState::None)
+			removePoint(id);
+
+		Point& point = mPoints[id];
+		point.x = position.x;
+		point.y = position.y;
+		point.z = position.z;
+		point.tetrahedron = -1;
+		point.state = PointState::Pending;
+
+		// Weights are only assigned once the scale of the point set is known, see rebuild()
+		if (weight >= 0.0)
+			point.weight = weight;
+		else if (mWeightScale > 0.0)
+			point.weight = mWeightScale * getPointWeightFactor(id);
+		else
+			point.weight = -1.0;
+
+		mNumPoints++;
+
+		if (mHasTets && !insert(id))
+			rebuild();
+	}
+
+	void IncrementalTetrahedralization::removePoint(UINT32 id)
+	{
+		if (id >= (UINT32)mPoints.size())
+			return;
+
+		Point& point = mPoints[id];
+		switch (point.state)
+		{
+		case PointState::None:
+			return;
+		case PointState::Pending:
+			point.state = PointState::None;
+			break;
+		case PointState::Hidden:
+		{
+			point.state = PointState::None;
+
+			auto iterFind = std::find(mHiddenPoints.begin(), mHiddenPoints.end(), id);
+			if (iterFind != mHiddenPoints.end())
+			{
+				std::swap(*iterFind, mHiddenPoints.back());
+				mHiddenPoints.pop_back();
+			}
+		}
+			break;
+		case PointState::Inserted:
+		{
+			point.state = PointState::None;
+			mNumPoints--;
+
+			// Small sets can't be modified locally, as removing from them can leave the remaining points coplanar
+			if (mNumPoints <= 4 || !remove(id))
+			{
+				rebuild();
+				return;
+			}
+
+			// Points hidden by the removed vertex might be a part of the tetrahedralization again
+			Vector<UINT32> hiddenPoints;
+			std::swap(hiddenPoints, mHiddenPoints);
+
+			for (auto& entry : hiddenPoints)
+			{
+				mPoints[entry].state = PointState::Pending;
+				if (!insert(entry))
+				{
+					mPoints[entry].state = PointState::Hidden;
+					mHiddenPoints.push_back(entry);
+				}
+			}
+		}
+			return;
+		}
+
+		mNumPoints--;
+	}
+
+	void IncrementalTetrahedralization::clear()
+	{
+		mPoints.clear();
+		mTets.clear();
+		mTetMarks.clear();
+		mFreeTets.clear();
+		mHiddenPoints.clear();
+
+		mNumPoints = 0;
+		mMark = 0;
+		mLastTet = -1;
+		mWeightScale = 0.0;
+		mHasTets = false;
+	}
+
+	TetrahedronVolume IncrementalTetrahedralization::getVolume()
+	{
+		if (!mHasTets && mNumPoints >= 4)
+			rebuild();
+
+		TetrahedronVolume volume;
+		if (!mHasTets)
+			return volume;
+
+		// Tetrahedra outside of the convex hull are not a part of the output, instead their inner faces are output as
+		// outer faces of the volume
+		Vector<INT32> outputIndices(mTets.size(), -1);
+		UINT32 numOutputTets = 0;
+		UINT32 numOuterFaces = 0;
+		for (UINT32 i = 0; i < (UINT32)mTets.size(); i++)
+		{
+			const Tet& tet = mTets[i];
+			if (tet.vertices[0] == -1)
+				continue;
+
+			if (tet.vertices[3] == INFINITE_VERTEX)
+				numOuterFaces++;
+			else
+				outputIndices[i] = numOutputTets++;
+		}
+
+		volume.tetrahedra.resize(numOutputTets);
+		volume.outerFaces.reserve(numOuterFaces);
+
+		for (UINT32 i = 0; i < (UINT32)mTets.size(); i++)
+		{
+			const Tet& tet = mTets[i];
+			if (tet.vertices[0] == -1)
+				continue;
+
+			if (tet.vertices[3] == INFINITE_VERTEX)
+			{
+				TetrahedronFace face;
+				memcpy(face.vertices, tet.vertices, sizeof(face.vertices));
+				face.tetrahedron = outputIndices[tet.neighbors[3]];
+
+				volume.outerFaces.push_back(face);
+			}
+			else
+			{
+				Tetrahedron& output = volume.tetrahedra[outputIndices[i]];
+				for (UINT32 j = 0; j < 4; j++)
+				{
+					output.vertices[j] = tet.vertices[j];
+					output.neighbors[j] = outputIndices[tet.neighbors[j]];
+				}
+			}
+		}
+
+		return volume;
+	}
+
+	void IncrementalTetrahedralization::rebuild()
+	{
+		mTets.clear();
+		mTetMarks.clear();
+		mFreeTets.clear();
+		mHiddenPoints.clear();
+		mLastTet = -1;
+		mHasTets = false;
+
+		Vector<UINT32> points;
+		points.reserve(mNumPoints);
+
+		double minimum[3] = { std::numeric_limits<double>::max(), std::numeric_limits<double>::max(),
+			std::numeric_limits<double>::max() };
+		double maximum[3] = { -std::numeric_limits<double>::max(), -std::numeric_limits<double>::max(),
+			-std::numeric_limits<double>::max() };
+
+		for (UINT32 i = 0; i < (UINT32)mPoints.size(); i++)
+		{
+			Point& point = mPoints[i];
+			if (point.state == PointState::None)
+				continue;
+
+			point.state = PointState::Pending;
+			point.tetrahedron = -1;
+			points.push_back(i);
+
+			const double coords[3] = { point.x, point.y, point.z };
+			for (UINT32 j = 0; j < 3; j++)
+			{
+				minimum[j] = std::min(minimum[j], coords[j]);
+				maximum[j] = std::max(maximum[j], coords[j]);
+			}
+		}
+
+		if (points.size() < 4)
+			return;
+
+		double extentSqrd = 0.0;
+		for (UINT32 i = 0; i < 3; i++)
+			extentSqrd += (maximum[i] - minimum[i]) * (maximum[i] - minimum[i]);
+
+		if (extentSqrd <= 0.0)
+			return;
+
+		// Weights are small enough not to affect any well defined configuration, but large enough to resolve ties
+		// between co-spherical points consistently, ensuring each point set has a single tetrahedralization. This keeps
+		// the results of local modifications identical to the results of generating the entire set.
+		if (mWeightScale <= 0.0)
+		{
+			mWeightScale = extentSqrd * 1e-12;
+
+			for (auto& entry : points)
+			{
+				if (mPoints[entry].weight < 0.0)
+					mPoints[entry].weight = mWeightScale * getPointWeightFactor(entry);
+			}
+		}
+
+		// Insert the points in Morton order, so each point is located close to the previously inserted one
+		Vector<UINT64> sortKeys(points.size());
+		for (UINT32 i = 0; i < (UINT32)points.size(); i++)
+		{
+			const Point& point = mPoints[points[i]];
+			const double coords[3] = { point.x, point.y, point.z };
+
+			UINT32 code = 0;
+			for (UINT32 j = 0; j < 3; j++)
+			{
+				const double range = maximum[j] - minimum[j];
+				const UINT32 cell = range > 0.0 ? (UINT32)((coords[j] - minimum[j]) / range * 1023.0) : 0;
+
+				code |= spreadBits(cell) << j;
+			}
+
+			sortKeys[i] = ((UINT64)code << 32) | points[i];
+		}
+
+		std::sort(sortKeys.begin(), sortKeys.end());
+		for (UINT32 i = 0; i < (UINT32)points.size(); i++)
+			points[i] = (UINT32)(sortKeys[i] & 0xFFFFFFFF);
+
+		if (!createInitialTetrahedra(points))
+			return;
+
+		for (auto& entry : points)
+		{
+			if (mPoints[entry].state != PointState::Pending)
+				continue;
+
+			if (!insert(entry))
+			{
+				mPoints[entry].state = PointState::Hidden;
+				mHiddenPoints.push_back(entry);
+			}
+		}
+	}
+
+	bool IncrementalTetrahedralization::createInitialTetrahedra(const Vector<UINT32>& points)
+	{
+		// Find four points that aren't coplanar
+		const double lengthSqrdEps = mWeightScale;
+		const double areaSqrdEps = mWeightScale * mWeightScale;
+		const double volumeEps = std::pow(mWeightScale, 1.5);
+
+		INT32 vertices[4] = { (INT32)points[0], -1, -1, -1 };
+		const Point& a = mPoints[vertices[0]];
+		for (UINT32 i = 1; i < (UINT32)points.size(); i++)
+		{
+			const Point& point = mPoints[points[i]];
+
+			if (vertices[1] == -1)
+			{
+				const double dx = point.x - a.x, dy = point.y - a.y, dz = point.z - a.z;
+				if ((dx * dx + dy * dy + dz * dz) > lengthSqrdEps)
+					vertices[1] = points[i];
+			}
+			else if (vertices[2] == -1)
+			{
+				const Point& b = mPoints[vertices[1]];
+				const double bx = b.x - a.x, by = b.y - a.y, bz = b.z - a.z;
+				const double cx = point.x - a.x, cy = point.y - a.y, cz = point.z - a.z;
+
+				const double nx = by * cz - bz * cy, ny = bz * cx - bx * cz, nz = bx * cy - by * cx;
+				if ((nx * nx + ny * ny + nz * nz) > areaSqrdEps)
+					vertices[2] = points[i];
+			}
+			else if (std::abs(orient(a, mPoints[vertices[1]], mPoints[vertices[2]], point)) > volumeEps)
+			{
+				vertices[3] = points[i];
+				break;
+			}
+		}
+
+		if (vertices[3] == -1)
+			return false;
+
+		if (orient(mPoints[vertices[0]], mPoints[vertices[1]], mPoints[vertices[2]], mPoints[vertices[3]]) < 0.0)
+			std::swap(vertices[0], vertices[1]);
+
+		const INT32 first = allocTet();
+		memcpy(mTets[first].vertices, vertices, sizeof(vertices));
+
+		// Surround the tetrahedron with tetrahedra connecting each face to the infinite vertex
+		INT32 outerTets[4];
+		for (UINT32 i = 0; i < 4; i++)
+		{
+			const INT32 outer = allocTet();
+			Tet& tet = mTets[outer];
+
+			// Face winding is reversed, as the infinite vertex is on the other side of the face
+			tet.vertices[0] = vertices[FACE_VERTICES[i][0]];
+			tet.vertices[1] = vertices[FACE_VERTICES[i][2]];
+			tet.vertices[2] = vertices[FACE_VERTICES[i][1]];
+			tet.vertices[3] = INFINITE_VERTEX;
+			tet.neighbors[3] = first;
+
+			mTets[first].neighbors[i] = outer;
+			outerTets[i] = outer;
+		}
+
+		if (!connectNewTets(outerTets, 4))
+			return false;
+
+		for (auto& entry : vertices)
+		{
+			mPoints[entry].state = PointState::Inserted;
+			mPoints[entry].tetrahedron = first;
+		}
+
+		mLastTet = first;
+		mHasTets = true;
+
+		return true;
+	}
+
+	bool IncrementalTetrahedralization::insert(UINT32 id)
+	{
+		const INT32 start = locate(id);
+		if (start == -1)
+		{
+			mPoints[id].state = PointState::Hidden;
+			mHiddenPoints.push_back(id);
+
+			return true;
+		}
+
+		const Point& point = mPoints[id];
+
+		// Find all the tetrahedra whose circumsphere contains the point. Tetrahedra that were tested and are not in
+		// conflict are marked separately, so they aren't tested again.
+		if (mMark >= std::numeric_limits<UINT32>::max() - 2)
+		{
+			std::fill(mTetMarks.begin(), mTetMarks.end(), 0);
+			mMark = 0;
+		}
+
+		const UINT32 cavityMark = ++mMark;
+		const UINT32 outsideMark = ++mMark;
+
+		mTempCavity.clear();
+		mTempCavity.push_back(start);
+		mTetMarks[start] = cavityMark;
+
+		for (UINT32 i = 0; i < (UINT32)mTempCavity.size(); i++)
+		{
+			for (UINT32 j = 0; j < 4; j++)
+			{
+				const INT32 neighbor = mTets[mTempCavity[i]].neighbors[j];
+				if (mTetMarks[neighbor] == cavityMark || mTetMarks[neighbor] == outsideMark)
+					continue;
+
+				if (isInConflict(neighbor, point))
+				{
+					mTetMarks[neighbor] = cavityMark;
+					mTempCavity.push_back(neighbor);
+				}
+				else
+					mTetMarks[neighbor] = outsideMark;
+			}
+		}
+
+		// Every face on the cavity boundary must be visible from the point, otherwise connecting the point to the faces
+		// would result in inverted tetrahedra. This can only fail due to limited precision, in which case the cavity is
+		// grown until the condition holds.
+		for (UINT32 i = 0; i < (UINT32)mTempCavity.size(); i++)
+		{
+			for (UINT32 j = 0; j < 4; j++)
+			{
+				const Tet& tet = mTets[mTempCavity[i]];
+				const INT32 neighbor = tet.neighbors[j];
+				if (mTetMarks[neighbor] == cavityMark)
+					continue;
+
+				const INT32 v0 = tet.vertices[FACE_VERTICES[j][0]];
+				const INT32 v1 = tet.vertices[FACE_VERTICES[j][1]];
+				const INT32 v2 = tet.vertices[FACE_VERTICES[j][2]];
+				if (v0 == INFINITE_VERTEX || v1 == INFINITE_VERTEX || v2 == INFINITE_VERTEX)
+					continue;
+
+				if (orient(mPoints[v0], mPoints[v1], mPoints[v2], point) <= 0.0)
+				{
+					mTetMarks[neighbor] = cavityMark;
+					mTempCavity.push_back(neighbor);
+				}
+			}
+		}
+
+		// Connect the point with every face on the cavity boundary
+		mTempNewTets.clear();
+		for (auto& cavityTet : mTempCavity)
+		{
+			for (UINT32 j = 0; j < 4; j++)
+			{
+				const INT32 neighbor = mTets[cavityTet].neighbors[j];
+				if (mTetMarks[neighbor] == cavityMark)
+					continue;
+
+				const INT32 newTet = allocTet();
+				const Tet& source = mTets[cavityTet];
+				Tet& tet = mTets[newTet];
+
+				for (UINT32 k = 0; k < 3; k++)
+					tet.vertices[k] = source.vertices[FACE_VERTICES[j][k]];
+
+				tet.vertices[3] = (INT32)id;
+				tet.neighbors[3] = neighbor;
+
+				Tet& outerTet = mTets[neighbor];
+				for (auto& entry : outerTet.neighbors)
+				{
+					if (entry == cavityTet)
+					{
+						entry = newTet;
+						break;
+					}
+				}
+
+				mTempNewTets.push_back(newTet);
+			}
+		}
+
+		if (!connectNewTets(mTempNewTets.data(), (UINT32)mTempNewTets.size()))
+		{
+			// Restore the links to the cavity and discard the new tetrahedra. New tetrahedra were created in the same
+			// order as the cavity boundary faces are iterated in.
+			UINT32 newTetIdx = 0;
+			for (auto& cavityTet : mTempCavity)
+			{
+				for (UINT32 j = 0; j < 4; j++)
+				{
+					const INT32 neighbor = mTets[cavityTet].neighbors[j];
+					if (mTetMarks[neighbor] == cavityMark)
+						continue;
+
+					const INT32 newTet = mTempNewTets[newTetIdx++];
+					for (auto& entry : mTets[neighbor].neighbors)
+					{
+						if (entry == newTet)
+						{
+							entry = cavityTet;
+							break;
+						}
+					}
+				}
+			}
+
+			for (auto& entry : mTempNewTets)
+				freeTet(entry);
+
+			return false;
+		}
+
+		mPoints[id].state = PointState::Inserted;
+		mLastTet = mTempNewTets[0];
+
+		for (auto& entry : mTempNewTets)
+		{
+			makeCanonical(entry);
+
+			const Tet& tet = mTets[entry];
+			for (auto& vertex : tet.vertices)
+			{
+				if (vertex != INFINITE_VERTEX)
+					mPoints[vertex].tetrahedron = entry;
+			}
+
+			if (tet.vertices[3] != INFINITE_VERTEX)
+				mLastTet = entry;
+		}
+
+		// Vertices inside the cavity that aren't on its boundary are no longer a part of the tetrahedralization
+		for (auto& cavityTet : mTempCavity)
+		{
+			for (auto& vertex : mTets[cavityTet].vertices)
+			{
+				if (vertex == INFINITE_VERTEX)
+					continue;
+
+				Point& cavityPoint = mPoints[vertex];
+				if (cavityPoint.state == PointState::Inserted && mTetMarks[cavityPoint.tetrahedron] == cavityMark)
+				{
+					cavityPoint.state = PointState::Hidden;
+					mHiddenPoints.push_back(vertex);
+				}
+			}
+		}
+
+		for (auto& entry : mTempCavity)
+			freeTet(entry);
+
+		return true;
+	}
+
+	bool IncrementalTetrahedralization::remove(UINT32 id)
+	{
+		const Point& point = mPoints[id];
+
+		// Find all the tetrahedra sharing the vertex
+		if (mMark >= std::numeric_limits<UINT32>::max() - 2)
+		{
+			std::fill(mTetMarks.begin(), mTetMarks.end(), 0);
+			mMark = 0;
+		}
+
+		const UINT32 starMark = ++mMark;
+
+		mTempCavity.clear();
+		mTempCavity.push_back(point.tetrahedron);
+		mTetMarks[point.tetrahedron] = starMark;
+
+		for (UINT32 i = 0; i < (UINT32)mTempCavity.size(); i++)
+		{
+			const Tet& tet = mTets[mTempCavity[i]];
+			for (UINT32 j = 0; j < 4; j++)
+			{
+				if (tet.vertices[j] == (INT32)id)
+					continue;
+
+				const INT32 neighbor = tet.neighbors[j];
+				if (mTetMarks[neighbor] == starMark)
+					continue;
+
+				mTetMarks[neighbor] = starMark;
+				mTempCavity.push_back(neighbor);
+			}
+		}
+
+		// Faces opposite to the vertex form the boundary of the region that needs to be filled with new tetrahedra
+		struct LinkFace
+		{
+			INT32 vertices[3];
+			INT32 outerTet;
+			UINT32 outerFace;
+			INT32 localTet;
+			UINT32 localFace;
+		};
+
+		Vector<LinkFace> linkFaces;
+		linkFaces.reserve(mTempCavity.size());
+
+		Vector<INT32> linkVertices;
+		bool hasInfiniteVertex = false;
+		for (auto& entry : mTempCavity)
+		{
+			const Tet& tet = mTets[entry];
+
+			UINT32 vertexIdx = 0;
+			while (tet.vertices[vertexIdx] != (INT32)id)
+				vertexIdx++;
+
+			LinkFace face;
+			for (UINT32 j = 0; j < 3; j++)
+			{
+				const INT32 vertex = tet.vertices[FACE_VERTICES[vertexIdx][j]];
+				face.vertices[j] = vertex;
+
+				if (vertex == INFINITE_VERTEX)
+					hasInfiniteVertex = true;
+				else if (std::find(linkVertices.begin(), linkVertices.end(), vertex) == linkVertices.end())
+					linkVertices.push_back(vertex);
+			}
+
+			face.outerTet = tet.neighbors[vertexIdx];
+			face.outerFace = 0;
+			while (mTets[face.outerTet].neighbors[face.outerFace] != entry)
+				face.outerFace++;
+
+			face.localTet = -1;
+			face.localFace = 0;
+
+			linkFaces.push_back(face);
+		}
+
+		Vector<std::pair<FaceKey, UINT32>> linkFaceKeys;
+		linkFaceKeys.reserve(linkFaces.size());
+		for (UINT32 i = 0; i < (UINT32)linkFaces.size(); i++)
+		{
+			const INT32* vertices = linkFaces[i].vertices;
+			linkFaceKeys.push_back(std::make_pair(FaceKey(vertices[0], vertices[1], vertices[2]), i));
+		}
+
+		std::sort(linkFaceKeys.begin(), linkFaceKeys.end(),
+			[](const std::pair<FaceKey, UINT32>& a, const std::pair<FaceKey, UINT32>& b) { return a.first < b.first; });
+
+		auto findLinkFace = [&linkFaceKeys](const FaceKey& key) -> INT32
+		{
+			auto iterFind = std::lower_bound(linkFaceKeys.begin(), linkFaceKeys.end(), key,
+				[](const std::pair<FaceKey, UINT32>& a, const FaceKey& b) { return a.first < b; });
+
+			if (iterFind != linkFaceKeys.end() && iterFind->first == key)
+				return (INT32)iterFind->second;
+
+			return -1;
+		};
+
+		// Tetrahedralize the vertices surrounding the removed vertex. The new tetrahedra filling the region are the
+		// tetrahedra of this local tetrahedralization that lie on the inner side of the region boundary.
+		if (mScratch == nullptr)
+			mScratch = bs_unique_ptr_new<IncrementalTetrahedralization>();
+
+		IncrementalTetrahedralization& local = *mScratch;
+		local.clear();
+
+		for (UINT32 i = 0; i < (UINT32)linkVertices.size(); i++)
+		{
+			const Point& linkPoint = mPoints[linkVertices[i]];
+			local.addPoint(i, Vector3((float)linkPoint.x, (float)linkPoint.y, (float)linkPoint.z), linkPoint.weight);
+		}
+
+		local.rebuild();
+		if (!local.mHasTets || !local.mHiddenPoints.empty())
+			return false;
+
+		auto toGlobal = [&linkVertices](INT32 vertex)
+		{
+			return vertex == INFINITE_VERTEX ? INFINITE_VERTEX : linkVertices[vertex];
+		};
+
+		// Find the local tetrahedra on the inner side of each boundary face
+		const UINT32 numLocalTets = (UINT32)local.mTets.size();
+		Vector<UINT8> boundaryFaceMask(numLocalTets, 0);
+		Vector<INT32> keptTets;
+
+		for (UINT32 i = 0; i < numLocalTets; i++)
+		{
+			const Tet& tet = local.mTets[i];
+			if (tet.vertices[0] == -1)
+				continue;
+
+			for (UINT32 j = 0; j < 4; j++)
+			{
+				INT32 vertices[3];
+				for (UINT32 k = 0; k < 3; k++)
+					vertices[k] = toGlobal(tet.vertices[FACE_VERTICES[j][k]]);
+
+				const INT32 linkFaceIdx = findLinkFace(FaceKey(vertices[0], vertices[1], vertices[2]));
+				if (linkFaceIdx == -1)
+					continue;
+
+				// Same winding means the tetrahedron is on the same side of the face as the removed vertex was
+				LinkFace& linkFace = linkFaces[linkFaceIdx];
+				if (!isSameWinding(vertices, linkFace.vertices))
+					continue;
+
+				if (linkFace.localTet != -1)
+					return false;
+
+				linkFace.localTet = (INT32)i;
+				linkFace.localFace = j;
+
+				if (boundaryFaceMask[i] == 0)
+					keptTets.push_back((INT32)i);
+
+				boundaryFaceMask[i] |= 1 << j;
+			}
+		}
+
+		for (auto& entry : linkFaces)
+		{
+			if (entry.localTet == -1)
+				return false;
+		}
+
+		// Collect the rest of the local tetrahedra enclosed by the boundary
+		Vector<INT32> globalIndices(numLocalTets, -1);
+		for (auto& entry : keptTets)
+			globalIndices[entry] = 0;
+
+		for (UINT32 i = 0; i < (UINT32)keptTets.size(); i++)
+		{
+			const Tet& tet = local.mTets[keptTets[i]];
+			if (tet.vertices[3] == INFINITE_VERTEX && !hasInfiniteVertex)
+				return false;
+
+			for (UINT32 j = 0; j < 4; j++)
+			{
+				if ((boundaryFaceMask[keptTets[i]] & (1 << j)) != 0)
+					continue;
+
+				const INT32 neighbor = tet.neighbors[j];
+				if (globalIndices[neighbor] != -1)
+					continue;
+
+				// Reaching a boundary face from the inside means the boundary isn't a part of the local
+				// tetrahedralization, and the region can't be filled using it
+				INT32 vertices[3];
+				for (UINT32 k = 0; k < 3; k++)
+					vertices[k] = toGlobal(tet.vertices[FACE_VERTICES[j][k]]);
+
+				if (findLinkFace(FaceKey(vertices[0], vertices[1], vertices[2])) != -1)
+					return false;
+
+				globalIndices[neighbor] = 0;
+				keptTets.push_back(neighbor);
+			}
+		}
+
+		// Replace the tetrahedra sharing the vertex with the new ones
+		for (auto& entry : mTempCavity)
+			freeTet(entry);
+
+		for (auto& entry : keptTets)
+			globalIndices[entry] = allocTet();
+
+		mLastTet = globalIndices[keptTets[0]];
+
+		for (auto& entry : keptTets)
+		{
+			const Tet& localTet = local.mTets[entry];
+			const INT32 globalTet = globalIndices[entry];
+			Tet& tet = mTets[globalTet];
+
+			for (UINT32 j = 0; j < 4; j++)
+			{
+				tet.vertices[j] = toGlobal(localTet.vertices[j]);
+				tet.neighbors[j] = globalIndices[localTet.neighbors[j]];
+
+				if (tet.vertices[j] != INFINITE_VERTEX)
+					mPoints[tet.vertices[j]].tetrahedron = globalTet;
+			}
+
+			if (tet.vertices[3] != INFINITE_VERTEX)
+				mLastTet = globalTet;
+		}
+
+		for (auto& linkFace : linkFaces)
+		{
+			const INT32 globalTet = globalIndices[linkFace.localTet];
+
+			mTets[globalTet].neighbors[linkFace.localFace] = linkFace.outerTet;
+			mTets[linkFace.outerTet].neighbors[linkFace.outerFace] = globalTet;
+		}
+
+		return true;
+	}
+
+	INT32 IncrementalTetrahedralization::locate(UINT32 id)
+	{
+		const Point& point = mPoints[id];
+
+		// Walk from the last modified tetrahedron towards the point, crossing faces the point is on the outer side of.
+		// Faces are tested in random order, which ensures the walk terminates.
+		INT32 current = mLastTet;
+		const UINT32 maxSteps = (UINT32)mTets.size() + 16;
+
+		bool found = false;
+		for (UINT32 i = 0; i < maxSteps; i++)
+		{
+			const Tet& tet = mTets[current];
+			if (tet.vertices[3] == INFINITE_VERTEX)
+			{
+				// Point is outside of the convex hull
+				if (isInConflict(current, point))
+					found = true;
+
+				break;
+			}
+
+			mRandom ^= mRandom << 13;
+			mRandom ^= mRandom >> 17;
+			mRandom ^= mRandom << 5;
+
+			INT32 next = -1;
+			for (UINT32 j = 0; j < 4; j++)
+			{
+				const UINT32 faceIdx = (mRandom + j) & 3;
+				const UINT32* faceVertices = FACE_VERTICES[faceIdx];
+
+				const Point& a = mPoints[tet.vertices[faceVertices[0]]];
+				const Point& b = mPoints[tet.vertices[faceVertices[1]]];
+				const Point& c = mPoints[tet.vertices[faceVertices[2]]];
+
+				if (orient(a, b, c, point) < 0.0)
+				{
+					next = tet.neighbors[faceIdx];
+					break;
+				}
+			}
+
+			if (next == -1)
+			{
+				// Point is inside the tetrahedron. Points coincident with a vertex are hidden.
+				for (auto& vertex : tet.vertices)
+				{
+					const Point& other = mPoints[vertex];
+					const double dx = other.x - point.x, dy = other.y - point.y, dz = other.z - point.z;
+
+					if ((dx * dx + dy * dy + dz * dz) <= mWeightScale)
+						return -1;
+				}
+
+				return isInConflict(current, point) ? current : -1;
+			}
+
+			current = next;
+		}
+
+		if (found)
+			return current;
+
+		// Walk failed due to limited precision, fall back to testing every tetrahedron
+		for (UINT32 i = 0; i < (UINT32)mTets.size(); i++)
+		{
+			if (mTets[i].vertices[0] != -1 && isInConflict(i, point))
+				return i;
+		}
+
+		return -1;
+	}
+
+	bool IncrementalTetrahedralization::isInConflict(INT32 tet, const Point& point) const
+	{
+		const INT32* vertices = mTets[tet].vertices;
+		if (vertices[3] == INFINITE_VERTEX)
+		{
+			// Tetrahedra outside of the hull are in conflict with points on the outer side of their hull face. For
+			// points on the face plane this reduces to a test against the circle of the face, which is the same as
+			// testing against the sphere of the tetrahedron on the inner side of the face.
+			const double side = orient(mPoints[vertices[0]], mPoints[vertices[1]], mPoints[vertices[2]], point);
+			if (side != 0.0)
+				return side > 0.0;
+
+			return isInConflict(mTets[tet].neighbors[3], point);
+		}
+
+		return insphere(mPoints[vertices[0]], mPoints[vertices[1]], mPoints[vertices[2]], mPoints[vertices[3]],
+			point) < 0.0;
+	}
+
+	INT32 IncrementalTetrahedralization::allocTet()
+	{
+		INT32 tet;
+		if (!mFreeTets.empty())
+		{
+			tet = mFreeTets.back();
+			mFreeTets.pop_back();
+		}
+		else
+		{
+			tet = (INT32)mTets.size();
+			mTets.push_back(Tet());
+			mTetMarks.push_back(0);
+		}
+
+		mTetMarks[tet] = 0;
+		for (UINT32 i = 0; i < 4; i++)
+			mTets[tet].neighbors[i] = -1;
+
+		return tet;
+	}
+
+	void IncrementalTetrahedralization::freeTet(INT32 tet)
+	{
+		mTets[tet].vertices[0] = -1;
+		mFreeTets.push_back(tet);
+	}
+
+	bool IncrementalTetrahedralization::connectNewTets(const INT32* tets, UINT32 count)
+	{
+		// Faces containing the shared last vertex are matched through their other edge, encoded along with the
+		// tetrahedron and the face index
+		mTempEdges.clear();
+		for (UINT32 i = 0; i < count; i++)
+		{
+			const INT32* vertices = mTets[tets[i]].vertices;
+			for (UINT32 j = 0; j < 3; j++)
+			{
+				INT32 v0 = vertices[(j + 1) % 3];
+				INT32 v1 = vertices[(j + 2) % 3];
+				if (v0 > v1)
+					std::swap(v0, v1);
+
+				// Offset so the infinite vertex is also positive
+				const UINT64 key = ((UINT64)(UINT32)(v0 + 2) << 32) | (UINT32)(v1 + 2);
+				mTempEdges.push_back(std::make_pair(key, i * 4 + j));
+			}
+		}
+
+		std::sort(mTempEdges.begin(), mTempEdges.end());
+
+		// Edges must be shared by exactly two faces
+		for (UINT32 i = 0; i < (UINT32)mTempEdges.size(); i += 2)
+		{
+			if ((i + 1) >= (UINT32)mTempEdges.size() || mTempEdges[i].first != mTempEdges[i + 1].first)
+				return false;
+
+			if ((i + 2) < (UINT32)mTempEdges.size() && mTempEdges[i + 2].first == mTempEdges[i].first)
+				return false;
+		}
+
+		for (UINT32 i = 0; i < (UINT32)mTempEdges.size(); i += 2)
+		{
+			const UINT32 a = mTempEdges[i].second;
+			const UINT32 b = mTempEdges[i + 1].second;
+
+			mTets[tets[a / 4]].neighbors[a % 4] = tets[b / 4];
+			mTets[tets[b / 4]].neighbors[b % 4] = tets[a / 4];
+		}
+
+		return true;
+	}
+
+	void IncrementalTetrahedralization::makeCanonical(INT32 tet)
+	{
+		// Each permutation swaps two pairs of vertices, which keeps the orientation
+		static constexpr UINT32 PERMUTATIONS[3][4] = { { 3, 2, 1, 0 }, { 2, 3, 0, 1 }, { 1, 0, 3, 2 } };
+
+		Tet& data = mTets[tet];
+		for (UINT32 i = 0; i < 3; i++)
+		{
+			if (data.vertices[i] != INFINITE_VERTEX)
+				continue;
+
+			const Tet original = data;
+			for (UINT32 j = 0; j < 4; j++)
+			{
+				data.vertices[j] = original.vertices[PERMUTATIONS[i][j]];
+				data.neighbors[j] = original.neighbors[PERMUTATIONS[i][j]];
+			}
+
+			break;
+		}
+	}
 }
@@ -51,5 +51,143 @@ namespace bs
 		static TetrahedronVolume tetrahedralize(const Vector<Vector3>& points);
 	};
 
+	/**
+	 * Maintains a Delaunay tetrahedralization of a set of points that can be modified one point at a time. Adding a
+	 * point only re-tetrahedralizes the region whose circumspheres contain the point, and removing a point only
+	 * re-tetrahedralizes the tetrahedra that shared it, making small changes to large point sets much cheaper than
+	 * generating the entire set again using Triangulation::tetrahedralize().
+	 *
+	 * Points are identified using caller provided ids, which should be kept compact as internal storage grows with the
+	 * largest used id. Coincident points are accepted, but only one of them is used for the tetrahedralization until
+	 * the other is removed.
+	 *
+	 * Not thread safe, but separate instances may be used on separate threads.
+	 */
+	class BS_UTILITY_EXPORT IncrementalTetrahedralization
+	{
+	public:
+		/**
+		 * Adds a new point to the tetrahedralization. If a point with the same id already exists, it is moved to the
+		 * new position instead.
+		 *
+		 * Points added before the tetrahedralization was first generated are only recorded, and are then inserted all
+		 * at once by getVolume().
+		 */
+		void addPoint(UINT32 id, const Vector3& position);
+
+		/** Removes a point previously added through addPoint(). Does nothing if the point doesn't exist. */
+		void removePoint(UINT32 id);
+
+		/** Removes all the points. */
+		void clear();
+
+		/** Returns the number of points added to the tetrahedralization. */
+		UINT32 getNumPoints() const { return mNumPoints; }
+
+		/**
+		 * Returns the tetrahedra in the same format as Triangulation::tetrahedralize(), except that vertex indices
+		 * correspond to point ids. Returns an empty volume if there are less than four points, or if all the points are
+		 * coplanar.
+		 */
+		TetrahedronVolume getVolume();
+
+	private:
+		/** State of a point referenced by its id. */
+		enum class PointState : UINT8
+		{
+			/** Point with the id doesn't exist. */
+			None,
+			/** Point is waiting to be inserted into the tetrahedralization. */
+			Pending,
+			/** Point is a vertex of the tetrahedralization. */
+			Inserted,
+			/** Point coincides with another vertex and is not part of the tetrahedralization. */
+			Hidden
+		};
+
+		/** Information about a single point. */
+		struct Point
+		{
+			double x, y, z;
+
+			/** Tiny weight used for consistently resolving co-spherical point configurations, such as regular grids. */
+			double weight;
+
+			/** One of the tetrahedra the point is a vertex of, if inserted. */
+			INT32 tetrahedron;
+			PointState state;
+		};
+
+		/**
+		 * Tetrahedron with positive orientation (fourth vertex on the positive side of the plane formed by the first
+		 * three), using the same neighbor layout as Tetrahedron. Tetrahedra outside of the convex hull store the
+		 * INFINITE_VERTEX as their fourth vertex.
+		 */
+		struct Tet
+		{
+			INT32 vertices[4];
+			INT32 neighbors[4];
+		};
+
+		/** Adds a point with an explicit weight, otherwise same as addPoint(). */
+		void addPoint(UINT32 id, const Vector3& position, double weight);
+
+		/** Discards all the tetrahedra and inserts all the points again, sorted for locality. */
+		void rebuild();
+
+		/**
+		 * Creates the first tetrahedron, and the tetrahedra surrounding it. Returns false if all the points are
+		 * coplanar.
+		 */
+		bool createInitialTetrahedra(const Vector<UINT32>& points);
+
+		/** Inserts a point into the tetrahedralization. Returns false if the tetrahedralization needs to be rebuilt. */
+		bool insert(UINT32 id);
+
+		/** Removes a vertex from the tetrahedralization. Returns false if the tetrahedralization must be rebuilt. */
+		bool remove(UINT32 id);
+
+		/** Returns a tetrahedron in conflict with the point, or -1 if the point is hidden by another vertex. */
+		INT32 locate(UINT32 id);
+
+		/** Checks if the point lies within the (weighted) circumsphere of a tetrahedron. */
+		bool isInConflict(INT32 tet, const Point& point) const;
+
+		/** Allocates a new tetrahedron and returns its index. */
+		INT32 allocTet();
+
+		/** Releases a tetrahedron allocated with allocTet(). */
+		void freeTet(INT32 tet);
+
+		/**
+		 * Connects the faces of new tetrahedra whose last vertex is the same, which share the edges of their first
+		 * three vertices. Returns false if the edges don't form a closed surface.
+		 */
+		bool connectNewTets(const INT32* tets, UINT32 count);
+
+		/** Moves the infinite vertex of a new tetrahedron to the last position, keeping the orientation. */
+		void makeCanonical(INT32 tet);
+
+		static constexpr INT32 INFINITE_VERTEX = -2;
+
+		Vector<Point> mPoints;
+		Vector<Tet> mTets;
+		Vector<UINT32> mTetMarks;
+		Vector<INT32> mFreeTets;
+		Vector<UINT32> mHiddenPoints;
+		UINT32 mNumPoints = 0;
+		UINT32 mMark = 0;
+		INT32 mLastTet = -1;
+		double mWeightScale = 0.0;
+		UINT32 mRandom = 1;
+		bool mHasTets = false;
+
+		// Temporary buffers
+		Vector<INT32> mTempCavity;
+		Vector<INT32> mTempNewTets;
+		Vector<std::pair<UINT64, UINT32>> mTempEdges;
+		UPtr<IncrementalTetrahedralization> mScratch;
+	};
+
 	/** @} */
 }
@@ -281,6 +281,16 @@ namespace bs { namespace ct
 		case VET_COLOR_ARGB:
 		case VET_UBYTE4_NORM:
 			return DXGI_FORMAT_R8G8B8A8_UNORM;
+		case VET_UINT_10_10_10_2_NORM:
+			return DXGI_FORMAT_R10G10B10A2_UNORM;
+		case VET_HALF2:
+			return DXGI_FORMAT_R16G16_FLOAT;
+		case VET_HALF4:
+			return DXGI_FORMAT_R16G16B16A16_FLOAT;
+		case VET_USHORT2_NORM:
+			return DXGI_FORMAT_R16G16_UNORM;
+		case VET_USHORT4_NORM:
+			return DXGI_FORMAT_R16G16B16A16_UNORM;
 		case VET_FLOAT1:
 			return DXGI_FORMAT_R32_FLOAT;
 		case VET_FLOAT2:
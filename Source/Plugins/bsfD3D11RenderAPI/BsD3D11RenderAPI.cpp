@@ -174,6 +174,7 @@ namespace bs { namespace ct
 		mActiveRenderTarget = nullptr;
 		mActiveDepthStencilState = nullptr;
 		mMainCommandBuffer = nullptr;
+		mStateCache.invalidate();
 
 		RenderStateManager::shutDown();
 		RenderWindowManager::shutDown();
@@ -203,7 +204,7 @@ namespace bs { namespace ct
 		RenderAPI::destroyCore();
 	}
 
-	void D3D11RenderAPI::setGraphicsPipeline(const SPtr<GraphicsPipelineState>& pipelineState,
+	void D3D11RenderAPI::setGraphicsPipelineImpl(const SPtr<GraphicsPipelineState>& pipelineState,
 		const SPtr<CommandBuffer>& commandBuffer)
 	{
 		auto executeRef = [&](const SPtr<GraphicsPipelineState>& pipelineState)
@@ -289,13 +290,16 @@ namespace bs { namespace ct
 
 		auto execute = [=]() { executeRef(pipelineState); };
 
+		if (!mStateCache.setGraphicsPipeline(pipelineState))
+			return;
+
 		SPtr<D3D11CommandBuffer> cb = getCB(commandBuffer);
 		cb->queueCommand(execute);
 
 		BS_INC_RENDER_STAT(NumPipelineStateChanges);
 	}
 
-	void D3D11RenderAPI::setComputePipeline(const SPtr<ComputePipelineState>& pipelineState,
+	void D3D11RenderAPI::setComputePipelineImpl(const SPtr<ComputePipelineState>& pipelineState,
 		const SPtr<CommandBuffer>& commandBuffer)
 	{
 		auto executeRef = [&](const SPtr<ComputePipelineState>& pipelineState)
@@ -317,13 +321,16 @@ namespace bs { namespace ct
 
 		auto execute = [=]() { executeRef(pipelineState); };
 
+		if (!mStateCache.setComputePipeline(pipelineState))
+			return;
+
 		SPtr<D3D11CommandBuffer> cb = getCB(commandBuffer);
 		cb->queueCommand(execute);
 
 		BS_INC_RENDER_STAT(NumPipelineStateChanges);
 	}
 
-	void D3D11RenderAPI::setGpuParams(const SPtr<GpuParams>& gpuParams, const SPtr<CommandBuffer>& commandBuffer)
+	void D3D11RenderAPI::setGpuParamsImpl(const SPtr<GpuParams>& gpuParams, const SPtr<CommandBuffer>& commandBuffer)
 	{
 		auto executeRef = [&](const SPtr<GpuParams>& gpuParams)
 		{
@@ -597,13 +604,16 @@ namespace bs { namespace ct
 
 		auto execute = [=]() { executeRef(gpuParams); };
 
+		if (!mStateCache.setGpuParams(gpuParams))
+			return;
+
 		SPtr<D3D11CommandBuffer> cb = getCB(commandBuffer);
 		cb->queueCommand(execute);
 
 		BS_INC_RENDER_STAT(NumGpuParamBinds);
 	}
 
-	void D3D11RenderAPI::setViewport(const Rect2& vp, const SPtr<CommandBuffer>& commandBuffer)
+	void D3D11RenderAPI::setViewportImpl(const Rect2& vp, const SPtr<CommandBuffer>& commandBuffer)
 	{
 		auto executeRef = [&](const Rect2& vp)
 		{
@@ -615,11 +625,14 @@ namespace bs { namespace ct
 
 		auto execute = [=]() { executeRef(vp); };
 
+		if (!mStateCache.setViewport(vp))
+			return;
+
 		SPtr<D3D11CommandBuffer> cb = getCB(commandBuffer);
 		cb->queueCommand(execute);
 	}
 
-	void D3D11RenderAPI::setVertexBuffers(UINT32 index, SPtr<VertexBuffer>* buffers, UINT32 numBuffers,
+	void D3D11RenderAPI::setVertexBuffersImpl(UINT32 index, SPtr<VertexBuffer>* buffers, UINT32 numBuffers,
 		const SPtr<CommandBuffer>& commandBuffer)
 	{
 		auto executeRef = [&](UINT32 index, const SmallVector<SPtr<VertexBuffer>, 8>& buffers, UINT32 numBuffers)
@@ -658,13 +671,16 @@ namespace bs { namespace ct
 		auto execute = [executeRef, index, buffers = std::move(_buffers), numBuffers]()
 			{ executeRef(index, buffers, numBuffers); };
 
+		if (!mStateCache.setVertexBuffers(index, buffers, numBuffers))
+			return;
+
 		SPtr<D3D11CommandBuffer> cb = getCB(commandBuffer);
 		cb->queueCommand(execute);
 
 		BS_INC_RENDER_STAT(NumVertexBufferBinds);
 	}
 
-	void D3D11RenderAPI::setIndexBuffer(const SPtr<IndexBuffer>& buffer, const SPtr<CommandBuffer>& commandBuffer)
+	void D3D11RenderAPI::setIndexBufferImpl(const SPtr<IndexBuffer>& buffer, const SPtr<CommandBuffer>& commandBuffer)
 	{
 		auto executeRef = [&](const SPtr<IndexBuffer>& buffer)
 		{
@@ -685,13 +701,16 @@ namespace bs { namespace ct
 
 		auto execute = [=]() { executeRef(buffer); };
 
+		if (!mStateCache.setIndexBuffer(buffer))
+			return;
+
 		SPtr<D3D11CommandBuffer> cb = getCB(commandBuffer);
 		cb->queueCommand(execute);
 
 		BS_INC_RENDER_STAT(NumIndexBufferBinds);
 	}
 
-	void D3D11RenderAPI::setVertexDeclaration(const SPtr<VertexDeclaration>& vertexDeclaration,
+	void D3D11RenderAPI::setVertexDeclarationImpl(const SPtr<VertexDeclaration>& vertexDeclaration,
 		const SPtr<CommandBuffer>& commandBuffer)
 	{
 		auto executeRef = [&](const SPtr<VertexDeclaration>& vertexDeclaration)
@@ -703,11 +722,14 @@ namespace bs { namespace ct
 
 		auto execute = [=]() { executeRef(vertexDeclaration); };
 
+		if (!mStateCache.setVertexDeclaration(vertexDeclaration))
+			return;
+
 		SPtr<D3D11CommandBuffer> cb = getCB(commandBuffer);
 		cb->queueCommand(execute);
 	}
 
-	void D3D11RenderAPI::setDrawOperation(DrawOperationType op, const SPtr<CommandBuffer>& commandBuffer)
+	void D3D11RenderAPI::setDrawOperationImpl(DrawOperationType op, const SPtr<CommandBuffer>& commandBuffer)
 	{
 		auto executeRef = [&](DrawOperationType op)
 		{
@@ -719,11 +741,14 @@ namespace bs { namespace ct
 
 		auto execute = [=]() { executeRef(op); };
 
+		if (!mStateCache.setDrawOperation(op))
+			return;
+
 		SPtr<D3D11CommandBuffer> cb = getCB(commandBuffer);
 		cb->queueCommand(execute);
 	}
 
-	void D3D11RenderAPI::draw(UINT32 vertexOffset, UINT32 vertexCount, UINT32 instanceCount,
+	void D3D11RenderAPI::drawImpl(UINT32 vertexOffset, UINT32 vertexCount, UINT32 instanceCount,
 		const SPtr<CommandBuffer>& commandBuffer)
 	{
 		auto executeRef = [&](UINT32 vertexOffset, UINT32 vertexCount, UINT32 instanceCount)
@@ -757,7 +782,7 @@ namespace bs { namespace ct
 		BS_ADD_RENDER_STAT(NumPrimitives, primCount);
 	}
 
-	void D3D11RenderAPI::drawIndexed(UINT32 startIndex, UINT32 indexCount, UINT32 vertexOffset, UINT32 vertexCount,
+	void D3D11RenderAPI::drawIndexedImpl(UINT32 startIndex, UINT32 indexCount, UINT32 vertexOffset, UINT32 vertexCount,
 		UINT32 instanceCount, const SPtr<CommandBuffer>& commandBuffer)
 	{
 		auto executeRef = [&](UINT32 startIndex, UINT32 indexCount, UINT32 vertexOffset, UINT32 vertexCount,
@@ -792,7 +817,7 @@ namespace bs { namespace ct
 		BS_ADD_RENDER_STAT(NumPrimitives, primCount);
 	}
 
-	void D3D11RenderAPI::dispatchCompute(UINT32 numGroupsX, UINT32 numGroupsY, UINT32 numGroupsZ,
+	void D3D11RenderAPI::dispatchComputeImpl(UINT32 numGroupsX, UINT32 numGroupsY, UINT32 numGroupsZ,
 		const SPtr<CommandBuffer>& commandBuffer)
 	{
 		auto executeRef = [&](UINT32 numGroupsX, UINT32 numGroupsY, UINT32 numGroupsZ)
@@ -815,7 +840,7 @@ namespace bs { namespace ct
 		BS_INC_RENDER_STAT(NumComputeCalls);
 	}
 
-	void D3D11RenderAPI::setScissorRect(UINT32 left, UINT32 top, UINT32 right, UINT32 bottom,
+	void D3D11RenderAPI::setScissorRectImpl(UINT32 left, UINT32 top, UINT32 right, UINT32 bottom,
 		const SPtr<CommandBuffer>& commandBuffer)
 	{
 		auto executeRef = [&](UINT32 left, UINT32 top, UINT32 right, UINT32 bottom)
@@ -832,11 +857,14 @@ namespace bs { namespace ct
 
 		auto execute = [=]() { executeRef(left, top, right, bottom); };
 
+		if (!mStateCache.setScissorRect(left, top, right, bottom))
+			return;
+
 		SPtr<D3D11CommandBuffer> cb = getCB(commandBuffer);
 		cb->queueCommand(execute);
 	}
 
-	void D3D11RenderAPI::setStencilRef(UINT32 value, const SPtr<CommandBuffer>& commandBuffer)
+	void D3D11RenderAPI::setStencilRefImpl(UINT32 value, const SPtr<CommandBuffer>& commandBuffer)
 	{
 		auto executeRef = [&](UINT32 value)
 		{
@@ -852,12 +880,15 @@ namespace bs { namespace ct
 
 		auto execute = [=]() { executeRef(value); };
 
+		if (!mStateCache.setStencilRef(value))
+			return;
+
 		SPtr<D3D11CommandBuffer> cb = getCB(commandBuffer);
 		cb->queueCommand(execute);
 	}
 
-	void D3D11RenderAPI::clearViewport(UINT32 buffers, const Color& color, float depth, UINT16 stencil, UINT8 targetMask,
-		const SPtr<CommandBuffer>& commandBuffer)
+	void D3D11RenderAPI::clearViewportImpl(UINT32 buffers, const Color& color, float depth, UINT16 stencil,
+		UINT8 targetMask, const SPtr<CommandBuffer>& commandBuffer)
 	{
 		auto executeRef = [&](UINT32 buffers, const Color& color, float depth, UINT16 stencil, UINT8 targetMask)
 		{
@@ -883,16 +914,19 @@ namespace bs { namespace ct
 				notifyRenderTargetModified();
 			}
 			else
-				clearRenderTarget(buffers, color, depth, stencil, targetMask);
+				clearRenderTargetImpl(buffers, color, depth, stencil, targetMask, nullptr);
 		};
 
 		auto execute = [=]() { executeRef(buffers, color, depth, stencil, targetMask); };
 
 		SPtr<D3D11CommandBuffer> cb = getCB(commandBuffer);
 		cb->queueCommand(execute);
+
+		// Clearing a part of the target draws a quad using its own pipeline and buffers
+		mStateCache.invalidate();
 	}
 
-	void D3D11RenderAPI::clearRenderTarget(UINT32 buffers, const Color& color, float depth, UINT16 stencil,
+	void D3D11RenderAPI::clearRenderTargetImpl(UINT32 buffers, const Color& color, float depth, UINT16 stencil,
 		UINT8 targetMask, const SPtr<CommandBuffer>& commandBuffer)
 	{
 		auto executeRef = [&](UINT32 buffers, const Color& color, float depth, UINT16 stencil, UINT8 targetMask)
@@ -962,7 +996,7 @@ namespace bs { namespace ct
 		BS_INC_RENDER_STAT(NumClears);
 	}
 
-	void D3D11RenderAPI::setRenderTarget(const SPtr<RenderTarget>& target, UINT32 readOnlyFlags,
+	void D3D11RenderAPI::setRenderTargetImpl(const SPtr<RenderTarget>& target, UINT32 readOnlyFlags,
 		RenderSurfaceMask loadMask, const SPtr<CommandBuffer>& commandBuffer)
 	{
 		auto executeRef = [&](const SPtr<RenderTarget>& target, UINT32 readOnlyFlags)
@@ -1011,6 +1045,7 @@ namespace bs { namespace ct
 
 		SPtr<D3D11CommandBuffer> cb = getCB(commandBuffer);
 		cb->queueCommand(execute);
+		mStateCache.notifyRenderTargetChanged();
 
 		BS_INC_RENDER_STAT(NumRenderTargetChanges);
 	}
@@ -1025,14 +1060,14 @@ namespace bs { namespace ct
 		BS_INC_RENDER_STAT(NumPresents);
 	}
 
-	void D3D11RenderAPI::addCommands(const SPtr<CommandBuffer>& commandBuffer, const SPtr<CommandBuffer>& secondary)
+	void D3D11RenderAPI::addCommandsImpl(const SPtr<CommandBuffer>& commandBuffer, const SPtr<CommandBuffer>& secondary)
 	{
 		// We're not supporting this as we don't support command buffer command queuing at all (i.e. they are executed
 		// straight away).
 		BS_LOG(Error, RenderBackend, "Secondary command buffers not supported on DirectX 11.");
 	}
 
-	void D3D11RenderAPI::submitCommandBuffer(const SPtr<CommandBuffer>& commandBuffer, UINT32 syncMask)
+	void D3D11RenderAPI::submitCommandBufferImpl(const SPtr<CommandBuffer>& commandBuffer, UINT32 syncMask)
 	{
 		SPtr<D3D11CommandBuffer> cb = getCB(commandBuffer);
 		cb->executeCommands();
@@ -1051,6 +1086,11 @@ namespace bs { namespace ct
 		if (buffer != nullptr)
 			return std::static_pointer_cast<D3D11CommandBuffer>(buffer);
 
+		// Worker threads recording secondary command buffers redirect commands without an explicit command buffer
+		const SPtr<CommandBuffer>& threadBuffer = _getThreadCommandBuffer();
+		if (threadBuffer != nullptr)
+			return std::static_pointer_cast<D3D11CommandBuffer>(threadBuffer);
+
 		return std::static_pointer_cast<D3D11CommandBuffer>(mMainCommandBuffer);
 	}
 
@@ -72,6 +72,37 @@ namespace bs
 		return value;
 	}
 
+	/**
+	 * Appends the levels of detail requested by the import options to the mesh data, and outputs their sub-meshes to
+	 * @p desc. Returns the original mesh data if no levels of detail were requested.
+	 */
+	SPtr<MeshData> generateMeshLODs(const SPtr<MeshData>& meshData, const MeshImportOptions& importOptions,
+		MESH_DESC& desc)
+	{
+		if (importOptions.lodCount == 0)
+			return meshData;
+
+		float lodReduction = Math::clamp(importOptions.lodReduction, 0.01f, 0.99f);
+		return MeshUtility::generateLODs(meshData, desc.subMeshes, importOptions.lodCount, lodReduction, desc.lods);
+	}
+
+	/**
+	 * Quantizes the vertex data as requested by the import options, and outputs the position quantization parameters
+	 * to @p desc. Returns the original mesh data if no quantization was requested.
+	 */
+	SPtr<MeshData> quantizeMesh(const SPtr<MeshData>& meshData, const MeshImportOptions& importOptions, MESH_DESC& desc)
+	{
+		// Skinning and morph shapes operate on unquantized local space positions
+		MeshQuantizationFlags quantization = importOptions.quantization;
+		if (desc.skeleton != nullptr || desc.morphShapes != nullptr)
+			quantization.unset(MeshQuantizationFlag::Position);
+
+		if (!quantization)
+			return meshData;
+
+		return MeshUtility::quantize(meshData, quantization, desc.positionQuantization);
+	}
+
 	FBXImporter::FBXImporter()
 	{
 		mExtensions.push_back(u8"fbx");
@@ -111,7 +142,10 @@ namespace bs
 		if (meshImportOptions->cpuCached)
 			desc.usage |= MU_CPUCACHED;
 
-		SPtr<Mesh> mesh = Mesh::_createPtr(rendererMeshData->getData(), desc);
+		SPtr<MeshData> meshData = generateMeshLODs(rendererMeshData->getData(), *meshImportOptions, desc);
+		meshData = quantizeMesh(meshData, *meshImportOptions, desc);
+
+		SPtr<Mesh> mesh = Mesh::_createPtr(meshData, desc);
 
 		const String fileName = filePath.getFilename(false);
 		mesh->setName(fileName);
@@ -133,7 +167,10 @@ namespace bs
 		if (meshImportOptions->cpuCached)
 			desc.usage |= MU_CPUCACHED;
 
-		SPtr<Mesh> mesh = Mesh::_createPtr(rendererMeshData->getData(), desc);
+		SPtr<MeshData> meshData = generateMeshLODs(rendererMeshData->getData(), *meshImportOptions, desc);
+		meshData = quantizeMesh(meshData, *meshImportOptions, desc);
+
+		SPtr<Mesh> mesh = Mesh::_createPtr(meshData, desc);
 
 		const String fileName = filePath.getFilename(false);
 		mesh->setName(fileName);
@@ -234,13 +271,57 @@ namespace bs
 			convertAnimations(importedScene.clips, splits, skeleton, meshImportOptions->importRootMotion, animation);
 		}
 
-		// TODO - Later: Optimize mesh: Remove bad and degenerate polygons, weld nearby vertices, optimize for vertex cache
+		// Optimize mesh: weld identical vertices, remove degenerate triangles and reorder for vertex cache/fetch efficiency
+		MeshOptimizationFlags optimizationFlags = meshImportOptions->optimization;
+		if (rendererMeshData != nullptr && optimizationFlags != MeshOptimizationFlag::None)
+		{
+			// Vertices identical in the base shape might differ in morph shapes, so don't weld them
+			if (morphShapes != nullptr)
+				optimizationFlags.unset(MeshOptimizationFlag::WeldVertices);
+
+			Vector<UINT32> vertexRemap;
+			SPtr<MeshData> optimizedMeshData = MeshUtility::optimize(rendererMeshData->getData(), subMeshes,
+				optimizationFlags, &vertexRemap);
+
+			if (morphShapes != nullptr)
+				morphShapes = remapMorphShapes(morphShapes, vertexRemap, optimizedMeshData->getNumVertices());
+
+			rendererMeshData = RendererMeshData::create(optimizedMeshData);
+		}
 
 		shutDownSdk();
 
 		return rendererMeshData;
 	}
 
+	SPtr<MorphShapes> FBXImporter::remapMorphShapes(const SPtr<MorphShapes>& morphShapes,
+		const Vector<UINT32>& vertexRemap, UINT32 numVertices)
+	{
+		Vector<SPtr<MorphChannel>> channels;
+		for (auto& channel : morphShapes->getChannels())
+		{
+			Vector<SPtr<MorphShape>> shapes;
+			for (auto& shape : channel->getShapes())
+			{
+				Vector<MorphVertex> vertices;
+				for (auto& vertex : shape->getVertices())
+				{
+					UINT32 vertexIdx = vertexRemap[vertex.sourceIdx];
+					if (vertexIdx == (UINT32)-1)
+						continue;
+
+					vertices.push_back(MorphVertex(vertex.deltaPosition, vertex.deltaNormal, vertexIdx));
+				}
+
+				shapes.push_back(MorphShape::create(shape->getName(), shape->getWeight(), vertices));
+			}
+
+			channels.push_back(MorphChannel::create(channel->getName(), shapes));
+		}
+
+		return MorphShapes::create(channels, numVertices);
+	}
+
 	SPtr<Skeleton> FBXImporter::createSkeleton(const FBXImportScene& scene, bool sharedRoot)
 	{
 		Vector<BONE_DESC> allBones;
@@ -153,6 +153,13 @@ namespace bs
 		/** Parses the scene and generates morph shapes for the imported meshes using the imported raw data. */
 		SPtr<MorphShapes> createMorphShapes(const FBXImportScene& scene);
 
+		/**
+		 * Creates a copy of the provided morph shapes with vertex indices remapped according to @p vertexRemap, as
+		 * output by MeshUtility::optimize. Vertices mapped to (UINT32)-1 are removed.
+		 */
+		SPtr<MorphShapes> remapMorphShapes(const SPtr<MorphShapes>& morphShapes, const Vector<UINT32>& vertexRemap,
+			UINT32 numVertices);
+
 		/**	Creates an internal representation of an FBX node from an FbxNode object. */
 		FBXImportNode* createImportNode(FBXImportScene& scene, FbxNode* fbxNode, FBXImportNode* parent);
 
@@ -183,6 +183,7 @@ namespace bs
 		texDesc.hwGamma = sRGB;
 
 		SPtr<Texture> newTexture = Texture::_createPtr(texDesc);
+		newTexture->setStreamable(textureImportOptions->streamable);
 
 		UINT32 numFaces = (UINT32)faceData.size();
 		for (UINT32 i = 0; i < numFaces; i++)
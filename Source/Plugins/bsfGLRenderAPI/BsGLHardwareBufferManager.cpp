@@ -90,6 +90,9 @@ namespace bs { namespace ct
 			case VET_FLOAT3:
 			case VET_FLOAT4:
 				return GL_FLOAT;
+			case VET_HALF2:
+			case VET_HALF4:
+				return GL_HALF_FLOAT;
 			case VET_SHORT1:
 			case VET_SHORT2:
 			case VET_SHORT4:
@@ -97,6 +100,8 @@ namespace bs { namespace ct
 			case VET_USHORT1:
 			case VET_USHORT2:
 			case VET_USHORT4:
+			case VET_USHORT2_NORM:
+			case VET_USHORT4_NORM:
 				return GL_UNSIGNED_SHORT;
 			case VET_INT1:
 			case VET_INT2:
@@ -114,6 +119,8 @@ namespace bs { namespace ct
 			case VET_UBYTE4:
 			case VET_UBYTE4_NORM:
 				return GL_UNSIGNED_BYTE;
+			case VET_UINT_10_10_10_2_NORM:
+				return GL_UNSIGNED_INT_2_10_10_10_REV;
 			default:
 				return 0;
 		};
@@ -188,6 +188,8 @@ namespace bs { namespace ct
 			mGLSLProgramFactory = nullptr;
 		}
 
+		mStateCache.invalidate();
+
 		// Deleting the hardware buffer manager.  Has to be done before the mGLSupport->stop().
 		HardwareBufferManager::shutDown();
 		bs::HardwareBufferManager::shutDown();
@@ -237,7 +239,7 @@ namespace bs { namespace ct
 			bs_deleteN(mTextureInfos, mNumTextureUnits);
 	}
 
-	void GLRenderAPI::setGraphicsPipeline(const SPtr<GraphicsPipelineState>& pipelineState,
+	void GLRenderAPI::setGraphicsPipelineImpl(const SPtr<GraphicsPipelineState>& pipelineState,
 		const SPtr<CommandBuffer>& commandBuffer)
 	{
 		auto executeRef = [&](const SPtr<GraphicsPipelineState>& pipelineState)
@@ -354,13 +356,16 @@ namespace bs { namespace ct
 
 		auto execute = [=]() { executeRef(pipelineState); };
 
+		if (!mStateCache.setGraphicsPipeline(pipelineState))
+			return;
+
 		SPtr<GLCommandBuffer> cb = getCB(commandBuffer);
 		cb->queueCommand(execute);
 
 		BS_INC_RENDER_STAT(NumPipelineStateChanges);
 	}
 
-	void GLRenderAPI::setComputePipeline(const SPtr<ComputePipelineState>& pipelineState,
+	void GLRenderAPI::setComputePipelineImpl(const SPtr<ComputePipelineState>& pipelineState,
 		const SPtr<CommandBuffer>& commandBuffer)
 	{
 		auto executeRef = [&](const SPtr<ComputePipelineState>& pipelineState)
@@ -379,13 +384,16 @@ namespace bs { namespace ct
 
 		auto execute = [=]() { executeRef(pipelineState); };
 
+		if (!mStateCache.setComputePipeline(pipelineState))
+			return;
+
 		SPtr<GLCommandBuffer> cb = getCB(commandBuffer);
 		cb->queueCommand(execute);
 
 		BS_INC_RENDER_STAT(NumPipelineStateChanges);
 	}
 
-	void GLRenderAPI::setGpuParams(const SPtr<GpuParams>& gpuParams, const SPtr<CommandBuffer>& commandBuffer)
+	void GLRenderAPI::setGpuParamsImpl(const SPtr<GpuParams>& gpuParams, const SPtr<CommandBuffer>& commandBuffer)
 	{
 		auto executeRef = [&](const SPtr<GpuParams>& gpuParams)
 		{
@@ -874,13 +882,22 @@ namespace bs { namespace ct
 						}
 						else
 						{
-							const GLGpuParamBlockBuffer* glParamBlockBuffer = static_cast<const GLGpuParamBlockBuffer*>(buffer.get());
+							const GLGpuParamBlockBuffer* glParamBlockBuffer =
+								static_cast<const GLGpuParamBlockBuffer*>(buffer->getBindBuffer());
 
 							UINT32 unit = getUniformUnit(binding - 1);
 							glUniformBlockBinding(glProgram, binding - 1, unit);
 							BS_CHECK_GL_ERROR();
 
-							glBindBufferBase(GL_UNIFORM_BUFFER, unit, glParamBlockBuffer->getGLBufferId());
+							// Buffer contents might be a sub-range of a larger buffer (see GpuParamBlockArena)
+							if (glParamBlockBuffer != buffer.get())
+							{
+								glBindBufferRange(GL_UNIFORM_BUFFER, unit, glParamBlockBuffer->getGLBufferId(),
+									buffer->getBindOffset(), buffer->getSize());
+							}
+							else
+								glBindBufferBase(GL_UNIFORM_BUFFER, unit, glParamBlockBuffer->getGLBufferId());
+
 							BS_CHECK_GL_ERROR();
 						}
 					}
@@ -893,13 +910,16 @@ namespace bs { namespace ct
 
 		auto execute = [=]() { executeRef(gpuParams); };
 
+		if (!mStateCache.setGpuParams(gpuParams))
+			return;
+
 		SPtr<GLCommandBuffer> cb = getCB(commandBuffer);
 		cb->queueCommand(execute);
 
 		BS_INC_RENDER_STAT(NumGpuParamBinds);
 	}
 
-	void GLRenderAPI::setStencilRef(UINT32 stencilRefValue, const SPtr<CommandBuffer>& commandBuffer)
+	void GLRenderAPI::setStencilRefImpl(UINT32 stencilRefValue, const SPtr<CommandBuffer>& commandBuffer)
 	{
 		auto executeRef = [&](UINT32 stencilRefValue)
 		{
@@ -910,11 +930,14 @@ namespace bs { namespace ct
 
 		auto execute = [=]() { executeRef(stencilRefValue); };
 
+		if (!mStateCache.setStencilRef(stencilRefValue))
+			return;
+
 		SPtr<GLCommandBuffer> cb = getCB(commandBuffer);
 		cb->queueCommand(execute);
 	}
 
-	void GLRenderAPI::setViewport(const Rect2& area,
+	void GLRenderAPI::setViewportImpl(const Rect2& area,
 		const SPtr<CommandBuffer>& commandBuffer)
 	{
 		auto executeRef = [&](const Rect2& area)
@@ -927,11 +950,14 @@ namespace bs { namespace ct
 
 		auto execute = [=]() { executeRef(area); };
 
+		if (!mStateCache.setViewport(area))
+			return;
+
 		SPtr<GLCommandBuffer> cb = getCB(commandBuffer);
 		cb->queueCommand(execute);
 	}
 
-	void GLRenderAPI::setRenderTarget(const SPtr<RenderTarget>& target, UINT32 readOnlyFlags,
+	void GLRenderAPI::setRenderTargetImpl(const SPtr<RenderTarget>& target, UINT32 readOnlyFlags,
 		RenderSurfaceMask loadMask, const SPtr<CommandBuffer>& commandBuffer)
 	{
 		auto executeRef = [&](const SPtr<RenderTarget>& target, UINT32 readOnlyFlags)
@@ -989,11 +1015,12 @@ namespace bs { namespace ct
 
 		SPtr<GLCommandBuffer> cb = getCB(commandBuffer);
 		cb->queueCommand(execute);
+		mStateCache.notifyRenderTargetChanged();
 
 		BS_INC_RENDER_STAT(NumRenderTargetChanges);
 	}
 
-	void GLRenderAPI::setVertexBuffers(UINT32 index, SPtr<VertexBuffer>* buffers, UINT32 numBuffers,
+	void GLRenderAPI::setVertexBuffersImpl(UINT32 index, SPtr<VertexBuffer>* buffers, UINT32 numBuffers,
 		const SPtr<CommandBuffer>& commandBuffer)
 	{
 #if BS_DEBUG_MODE
@@ -1021,11 +1048,14 @@ namespace bs { namespace ct
 		auto execute = [executeRef, index, buffers = std::move(_buffers), numBuffers]()
 		{ executeRef(index, buffers, numBuffers); };
 
+		if (!mStateCache.setVertexBuffers(index, buffers, numBuffers))
+			return;
+
 		SPtr<GLCommandBuffer> cb = getCB(commandBuffer);
 		cb->queueCommand(execute);
 	}
 
-	void GLRenderAPI::setVertexDeclaration(const SPtr<VertexDeclaration>& vertexDeclaration,
+	void GLRenderAPI::setVertexDeclarationImpl(const SPtr<VertexDeclaration>& vertexDeclaration,
 		const SPtr<CommandBuffer>& commandBuffer)
 	{
 		auto executeRef = [&](const SPtr<VertexDeclaration>& vertexDeclaration)
@@ -1037,11 +1067,14 @@ namespace bs { namespace ct
 
 		auto execute = [=]() { executeRef(vertexDeclaration); };
 
+		if (!mStateCache.setVertexDeclaration(vertexDeclaration))
+			return;
+
 		SPtr<GLCommandBuffer> cb = getCB(commandBuffer);
 		cb->queueCommand(execute);
 	}
 
-	void GLRenderAPI::setDrawOperation(DrawOperationType op, const SPtr<CommandBuffer>& commandBuffer)
+	void GLRenderAPI::setDrawOperationImpl(DrawOperationType op, const SPtr<CommandBuffer>& commandBuffer)
 	{
 		auto executeRef = [&](DrawOperationType op)
 		{
@@ -1052,11 +1085,14 @@ namespace bs { namespace ct
 
 		auto execute = [=]() { executeRef(op); };
 
+		if (!mStateCache.setDrawOperation(op))
+			return;
+
 		SPtr<GLCommandBuffer> cb = getCB(commandBuffer);
 		cb->queueCommand(execute);
 	}
 
-	void GLRenderAPI::setIndexBuffer(const SPtr<IndexBuffer>& buffer, const SPtr<CommandBuffer>& commandBuffer)
+	void GLRenderAPI::setIndexBufferImpl(const SPtr<IndexBuffer>& buffer, const SPtr<CommandBuffer>& commandBuffer)
 	{
 		auto executeRef = [&](const SPtr<IndexBuffer>& buffer)
 		{
@@ -1067,11 +1103,14 @@ namespace bs { namespace ct
 
 		auto execute = [=]() { executeRef(buffer); };
 
+		if (!mStateCache.setIndexBuffer(buffer))
+			return;
+
 		SPtr<GLCommandBuffer> cb = getCB(commandBuffer);
 		cb->queueCommand(execute);
 	}
 
-	void GLRenderAPI::draw(UINT32 vertexOffset, UINT32 vertexCount, UINT32 instanceCount,
+	void GLRenderAPI::drawImpl(UINT32 vertexOffset, UINT32 vertexCount, UINT32 instanceCount,
 		const SPtr<CommandBuffer>& commandBuffer)
 	{
 		auto executeRef = [&](UINT32 vertexOffset, UINT32 vertexCount, UINT32 instanceCount)
@@ -1108,7 +1147,7 @@ namespace bs { namespace ct
 		BS_ADD_RENDER_STAT(NumPrimitives, primCount);
 	}
 
-	void GLRenderAPI::drawIndexed(UINT32 startIndex, UINT32 indexCount, UINT32 vertexOffset, UINT32 vertexCount,
+	void GLRenderAPI::drawIndexedImpl(UINT32 startIndex, UINT32 indexCount, UINT32 vertexOffset, UINT32 vertexCount,
 		UINT32 instanceCount, const SPtr<CommandBuffer>& commandBuffer)
 	{
 		auto executeRef = [&](UINT32 startIndex, UINT32 indexCount, UINT32 vertexOffset, UINT32 vertexCount,
@@ -1173,7 +1212,7 @@ namespace bs { namespace ct
 		BS_INC_RENDER_STAT(NumIndexBufferBinds);
 	}
 
-	void GLRenderAPI::dispatchCompute(UINT32 numGroupsX, UINT32 numGroupsY, UINT32 numGroupsZ,
+	void GLRenderAPI::dispatchComputeImpl(UINT32 numGroupsX, UINT32 numGroupsY, UINT32 numGroupsZ,
 		const SPtr<CommandBuffer>& commandBuffer)
 	{
 		auto executeRef = [&](UINT32 numGroupsX, UINT32 numGroupsY, UINT32 numGroupsZ)
@@ -1207,7 +1246,7 @@ namespace bs { namespace ct
 		BS_INC_RENDER_STAT(NumComputeCalls);
 	}
 
-	void GLRenderAPI::setScissorRect(UINT32 left, UINT32 top, UINT32 right, UINT32 bottom,
+	void GLRenderAPI::setScissorRectImpl(UINT32 left, UINT32 top, UINT32 right, UINT32 bottom,
 		const SPtr<CommandBuffer>& commandBuffer)
 	{
 		auto executeRef = [&](UINT32 left, UINT32 top, UINT32 right, UINT32 bottom)
@@ -1225,12 +1264,15 @@ namespace bs { namespace ct
 
 		auto execute = [=]() { executeRef(left, top, right, bottom); };
 
+		if (!mStateCache.setScissorRect(left, top, right, bottom))
+			return;
+
 		SPtr<GLCommandBuffer> cb = getCB(commandBuffer);
 		cb->queueCommand(execute);
 	}
 
-	void GLRenderAPI::clearRenderTarget(UINT32 buffers, const Color& color, float depth, UINT16 stencil, UINT8 targetMask,
-		const SPtr<CommandBuffer>& commandBuffer)
+	void GLRenderAPI::clearRenderTargetImpl(UINT32 buffers, const Color& color, float depth, UINT16 stencil,
+		UINT8 targetMask, const SPtr<CommandBuffer>& commandBuffer)
 	{
 		auto executeRef = [&](UINT32 buffers, const Color& color, float depth, UINT16 stencil, UINT8 targetMask)
 		{
@@ -1249,8 +1291,8 @@ namespace bs { namespace ct
 		cb->queueCommand(execute);
 	}
 
-	void GLRenderAPI::clearViewport(UINT32 buffers, const Color& color, float depth, UINT16 stencil, UINT8 targetMask,
-		const SPtr<CommandBuffer>& commandBuffer)
+	void GLRenderAPI::clearViewportImpl(UINT32 buffers, const Color& color, float depth, UINT16 stencil,
+		UINT8 targetMask, const SPtr<CommandBuffer>& commandBuffer)
 	{
 		auto executeRef = [&](UINT32 buffers, const Color& color, float depth, UINT16 stencil, UINT8 targetMask)
 		{
@@ -1263,6 +1305,9 @@ namespace bs { namespace ct
 
 		SPtr<GLCommandBuffer> cb = getCB(commandBuffer);
 		cb->queueCommand(execute);
+
+		// Clearing a part of the target modifies the scissor rectangle
+		mStateCache.invalidate();
 	}
 
 	void GLRenderAPI::swapBuffers(const SPtr<RenderTarget>& target, UINT32 syncMask)
@@ -1289,14 +1334,14 @@ namespace bs { namespace ct
 		BS_INC_RENDER_STAT(NumPresents);
 	}
 
-	void GLRenderAPI::addCommands(const SPtr<CommandBuffer>& commandBuffer, const SPtr<CommandBuffer>& secondary)
+	void GLRenderAPI::addCommandsImpl(const SPtr<CommandBuffer>& commandBuffer, const SPtr<CommandBuffer>& secondary)
 	{
 		// We're not supporting this as we don't support command buffer command queuing at all (i.e. they are executed
 		// straight away).
 		BS_LOG(Error, RenderBackend, "Secondary command buffers not supported on OpenGL.");
 	}
 
-	void GLRenderAPI::submitCommandBuffer(const SPtr<CommandBuffer>& commandBuffer, UINT32 syncMask)
+	void GLRenderAPI::submitCommandBufferImpl(const SPtr<CommandBuffer>& commandBuffer, UINT32 syncMask)
 	{
 		SPtr<GLCommandBuffer> cb = getCB(commandBuffer);
 		cb->executeCommands();
@@ -1315,6 +1360,11 @@ namespace bs { namespace ct
 		if (buffer != nullptr)
 			return std::static_pointer_cast<GLCommandBuffer>(buffer);
 
+		// Worker threads recording secondary command buffers redirect commands without an explicit command buffer
+		const SPtr<CommandBuffer>& threadBuffer = _getThreadCommandBuffer();
+		if (threadBuffer != nullptr)
+			return std::static_pointer_cast<GLCommandBuffer>(threadBuffer);
+
 		return std::static_pointer_cast<GLCommandBuffer>(mMainCommandBuffer);
 	}
 
@@ -1362,7 +1412,8 @@ namespace bs { namespace ct
 
 		if (!clearEntireTarget)
 		{
-			setScissorRect(clearRect.x, clearRect.y, clearRect.x + clearRect.width, clearRect.y + clearRect.height);
+			setScissorRectImpl(clearRect.x, clearRect.y, clearRect.x + clearRect.width, clearRect.y + clearRect.height,
+				nullptr);
 			setScissorTestEnable(true);
 		}
 
@@ -2362,7 +2413,7 @@ namespace bs { namespace ct
 	void GLRenderAPI::switchContext(const SPtr<GLContext>& context, const RenderWindow& window)
 	{
 		// Unbind pipeline and rebind to new context later	
-		setGraphicsPipeline(nullptr);
+		setGraphicsPipelineImpl(nullptr, nullptr);
 
 		if (mCurrentContext)
 			mCurrentContext->endCurrent();
@@ -2603,6 +2654,14 @@ namespace bs { namespace ct
 		BS_CHECK_GL_ERROR();
 
 		caps.numCombinedParamBlockBuffers = static_cast<UINT16>(combinedUniformBlockUnits);
+
+		GLint uniformBufferOffsetAlignment;
+		glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &uniformBufferOffsetAlignment);
+		BS_CHECK_GL_ERROR();
+
+		caps.setCapability(RSC_PARAM_BLOCK_OFFSETS);
+		caps.paramBlockOffsetAlignment = static_cast<UINT32>(uniformBufferOffsetAlignment);
+
 		caps.numMultiRenderTargets = 8;
 	}
 
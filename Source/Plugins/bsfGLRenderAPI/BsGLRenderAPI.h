@@ -7,6 +7,7 @@
 #include "BsGLHardwareBufferManager.h"
 #include "GLSL/BsGLSLProgramFactory.h"
 #include "Math/BsMatrix4.h"
+#include "RenderAPI/BsRenderStateCache.h"
 
 namespace bs { namespace ct
 {
@@ -26,76 +27,9 @@ namespace bs { namespace ct
 		/** @copydoc RenderAPI::getName() */
 		const StringID& getName() const override;
 
-		/** @copydoc RenderAPI::setGraphicsPipeline */
-		void setGraphicsPipeline(const SPtr<GraphicsPipelineState>& pipelineState,
-			const SPtr<CommandBuffer>& commandBuffer = nullptr) override;
-
-		/** @copydoc RenderAPI::setComputePipeline */
-		void setComputePipeline(const SPtr<ComputePipelineState>& pipelineState,
-			const SPtr<CommandBuffer>& commandBuffer = nullptr) override;
-
-		/** @copydoc RenderAPI::setGpuParams() */
-		void setGpuParams(const SPtr<GpuParams>& gpuParams,
-			const SPtr<CommandBuffer>& commandBuffer = nullptr) override;
-
-		/** @copydoc RenderAPI::setViewport() */
-		void setViewport(const Rect2& area, const SPtr<CommandBuffer>& commandBuffer = nullptr) override;
-
-		/** @copydoc RenderAPI::setScissorRect() */
-		void setScissorRect(UINT32 left, UINT32 top, UINT32 right, UINT32 bottom,
-			const SPtr<CommandBuffer>& commandBuffer = nullptr) override;
-
-		/** @copydoc RenderAPI::setStencilRef */
-		void setStencilRef(UINT32 value, const SPtr<CommandBuffer>& commandBuffer = nullptr) override;
-
-		/** @copydoc RenderAPI::setVertexBuffers() */
-		void setVertexBuffers(UINT32 index, SPtr<VertexBuffer>* buffers, UINT32 numBuffers,
-			const SPtr<CommandBuffer>& commandBuffer = nullptr) override;
-
-		/** @copydoc RenderAPI::setIndexBuffer() */
-		void setIndexBuffer(const SPtr<IndexBuffer>& buffer,
-			const SPtr<CommandBuffer>& commandBuffer = nullptr) override;
-
-		/** @copydoc RenderAPI::setVertexDeclaration() */
-		void setVertexDeclaration(const SPtr<VertexDeclaration>& vertexDeclaration,
-			const SPtr<CommandBuffer>& commandBuffer = nullptr) override;
-
-		/** @copydoc RenderAPI::setDrawOperation() */
-		void setDrawOperation(DrawOperationType op, const SPtr<CommandBuffer>& commandBuffer = nullptr) override;
-
-		/** @copydoc RenderAPI::draw() */
-		void draw(UINT32 vertexOffset, UINT32 vertexCount, UINT32 instanceCount = 0,
-			const SPtr<CommandBuffer>& commandBuffer = nullptr) override;
-
-		/** @copydoc RenderAPI::drawIndexed() */
-		void drawIndexed(UINT32 startIndex, UINT32 indexCount, UINT32 vertexOffset, UINT32 vertexCount
-			, UINT32 instanceCount = 0, const SPtr<CommandBuffer>& commandBuffer = nullptr) override;
-
-		/** @copydoc RenderAPI::dispatchCompute() */
-		void dispatchCompute(UINT32 numGroupsX, UINT32 numGroupsY = 1, UINT32 numGroupsZ = 1,
-			const SPtr<CommandBuffer>& commandBuffer = nullptr) override;
-
 		/** @copydoc RenderAPI::swapBuffers() */
 		void swapBuffers(const SPtr<RenderTarget>& target, UINT32 syncMask = 0xFFFFFFFF) override;
 
-		/** @copydoc RenderAPI::setRenderTarget() */
-		void setRenderTarget(const SPtr<RenderTarget>& target, UINT32 readOnlyFlags = 0,
-			RenderSurfaceMask loadMask = RT_NONE, const SPtr<CommandBuffer>& commandBuffer = nullptr) override;
-
-		/** @copydoc RenderAPI::clearRenderTarget() */
-		void clearRenderTarget(UINT32 buffers, const Color& color = Color::Black, float depth = 1.0f, UINT16 stencil = 0,
-			UINT8 targetMask = 0xFF, const SPtr<CommandBuffer>& commandBuffer = nullptr) override;
-
-		/** @copydoc RenderAPI::clearViewport() */
-		void clearViewport(UINT32 buffers, const Color& color = Color::Black, float depth = 1.0f, UINT16 stencil = 0,
-			UINT8 targetMask = 0xFF, const SPtr<CommandBuffer>& commandBuffer = nullptr) override;
-
-		/** @copydoc RenderAPI::addCommands() */
-		void addCommands(const SPtr<CommandBuffer>& commandBuffer, const SPtr<CommandBuffer>& secondary) override;
-
-		/** @copydoc RenderAPI::submitCommandBuffer() */
-		void submitCommandBuffer(const SPtr<CommandBuffer>& commandBuffer, UINT32 syncMask = 0xFFFFFFFF) override;
-
 		/** @copydoc RenderAPI::getMainCommandBuffer() */
 		SPtr<CommandBuffer> getMainCommandBuffer() const override;
 
@@ -119,6 +53,71 @@ namespace bs { namespace ct
 		GLSupport* getGLSupport() const { return mGLSupport; }
 
 	protected:
+		/** @copydoc RenderAPI::setGraphicsPipelineImpl */
+		void setGraphicsPipelineImpl(const SPtr<GraphicsPipelineState>& pipelineState,
+			const SPtr<CommandBuffer>& commandBuffer) override;
+
+		/** @copydoc RenderAPI::setComputePipelineImpl */
+		void setComputePipelineImpl(const SPtr<ComputePipelineState>& pipelineState,
+			const SPtr<CommandBuffer>& commandBuffer) override;
+
+		/** @copydoc RenderAPI::setGpuParamsImpl */
+		void setGpuParamsImpl(const SPtr<GpuParams>& gpuParams, const SPtr<CommandBuffer>& commandBuffer) override;
+
+		/** @copydoc RenderAPI::clearRenderTargetImpl */
+		void clearRenderTargetImpl(UINT32 buffers, const Color& color, float depth, UINT16 stencil,
+			UINT8 targetMask, const SPtr<CommandBuffer>& commandBuffer) override;
+
+		/** @copydoc RenderAPI::clearViewportImpl */
+		void clearViewportImpl(UINT32 buffers, const Color& color, float depth, UINT16 stencil,
+			UINT8 targetMask, const SPtr<CommandBuffer>& commandBuffer) override;
+
+		/** @copydoc RenderAPI::setRenderTargetImpl */
+		void setRenderTargetImpl(const SPtr<RenderTarget>& target, UINT32 readOnlyFlags,
+			RenderSurfaceMask loadMask, const SPtr<CommandBuffer>& commandBuffer) override;
+
+		/** @copydoc RenderAPI::setViewportImpl */
+		void setViewportImpl(const Rect2& area, const SPtr<CommandBuffer>& commandBuffer) override;
+
+		/** @copydoc RenderAPI::setScissorRectImpl */
+		void setScissorRectImpl(UINT32 left, UINT32 top, UINT32 right, UINT32 bottom,
+			const SPtr<CommandBuffer>& commandBuffer) override;
+
+		/** @copydoc RenderAPI::setStencilRefImpl */
+		void setStencilRefImpl(UINT32 value, const SPtr<CommandBuffer>& commandBuffer) override;
+
+		/** @copydoc RenderAPI::setVertexBuffersImpl */
+		void setVertexBuffersImpl(UINT32 index, SPtr<VertexBuffer>* buffers, UINT32 numBuffers,
+			const SPtr<CommandBuffer>& commandBuffer) override;
+
+		/** @copydoc RenderAPI::setIndexBufferImpl */
+		void setIndexBufferImpl(const SPtr<IndexBuffer>& buffer, const SPtr<CommandBuffer>& commandBuffer) override;
+
+		/** @copydoc RenderAPI::setVertexDeclarationImpl */
+		void setVertexDeclarationImpl(const SPtr<VertexDeclaration>& vertexDeclaration,
+			const SPtr<CommandBuffer>& commandBuffer) override;
+
+		/** @copydoc RenderAPI::setDrawOperationImpl */
+		void setDrawOperationImpl(DrawOperationType op, const SPtr<CommandBuffer>& commandBuffer) override;
+
+		/** @copydoc RenderAPI::drawImpl */
+		void drawImpl(UINT32 vertexOffset, UINT32 vertexCount, UINT32 instanceCount,
+			const SPtr<CommandBuffer>& commandBuffer) override;
+
+		/** @copydoc RenderAPI::drawIndexedImpl */
+		void drawIndexedImpl(UINT32 startIndex, UINT32 indexCount, UINT32 vertexOffset, UINT32 vertexCount
+			, UINT32 instanceCount, const SPtr<CommandBuffer>& commandBuffer) override;
+
+		/** @copydoc RenderAPI::dispatchComputeImpl */
+		void dispatchComputeImpl(UINT32 numGroupsX, UINT32 numGroupsY, UINT32 numGroupsZ,
+			const SPtr<CommandBuffer>& commandBuffer) override;
+
+		/** @copydoc RenderAPI::addCommandsImpl */
+		void addCommandsImpl(const SPtr<CommandBuffer>& commandBuffer, const SPtr<CommandBuffer>& secondary) override;
+
+		/** @copydoc RenderAPI::submitCommandBufferImpl */
+		void submitCommandBufferImpl(const SPtr<CommandBuffer>& commandBuffer, UINT32 syncMask) override;
+
 		/** @copydoc RenderAPI::initialize */
 		void initialize() override;
 
@@ -427,6 +426,9 @@ namespace bs { namespace ct
 		SPtr<GLContext> mCurrentContext;
 		SPtr<GLCommandBuffer> mMainCommandBuffer;
 
+		// Commands execute on the context as soon as they're queued, so the state is shared by all command buffers
+		RenderStateCache mStateCache;
+
 		bool mDrawCallInProgress = false;
 
 		UINT16 mActiveTextureUnit = -1;
@@ -174,6 +174,9 @@ namespace bs { namespace ct
 			case VET_COLOR_ABGR:
 			case VET_COLOR_ARGB:
 			case VET_UBYTE4_NORM:
+			case VET_USHORT2_NORM:
+			case VET_USHORT4_NORM:
+			case VET_UINT_10_10_10_2_NORM:
 				normalized = GL_TRUE;
 				isInteger = false;
 				break;
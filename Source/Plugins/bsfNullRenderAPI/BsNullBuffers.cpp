@@ -78,6 +78,12 @@ namespace bs { namespace ct
 		:GpuParamBlockBuffer(size, usage, deviceMask)
 	{ }
 
+	NullGpuParamBlockBuffer::~NullGpuParamBlockBuffer()
+	{
+		if(mBuffer)
+			bs_pool_delete(static_cast<NullHardwareBuffer*>(mBuffer));
+	}
+
 	void NullGpuParamBlockBuffer::initialize()
 	{
 		mBuffer = bs_pool_new<NullHardwareBuffer>(mUsage, 1, mSize);
@@ -85,6 +85,7 @@ namespace bs { namespace ct
 	{
 	public:
 		NullGpuParamBlockBuffer(UINT32 size, GpuBufferUsage usage, GpuDeviceFlags deviceMask);
+		~NullGpuParamBlockBuffer();
 
 	protected:
 		/** @copydoc GpuParamBlockBuffer::initialize */
@@ -24,6 +24,13 @@ namespace bs { namespace ct
 	/** Command buffer implementation for the null render backend. */
 	class NullCommandBuffer final : public CommandBuffer
 	{
+	public:
+		/** @copydoc CommandBuffer::getState() */
+		CommandBufferState getState() const override { return CommandBufferState::Empty; }
+
+		/** @copydoc CommandBuffer::reset() */
+		void reset() override { mStateCache.invalidate(); }
+
 	private:
 		friend class NullCommandBufferManager;
 
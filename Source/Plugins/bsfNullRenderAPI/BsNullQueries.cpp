@@ -6,8 +6,8 @@ namespace bs { namespace ct
 {
 	SPtr<EventQuery> NullQueryManager::createEventQuery(UINT32 deviceIdx) const
 	{
-		SPtr<EventQuery> query = SPtr<NullEventQuery>(bs_new<NullEventQuery>(), &QueryManager::deleteEventQuery,
-			StdAlloc<NullEventQuery>());
+		SPtr<EventQuery> query = SPtr<NullEventQuery>(bs_new<NullEventQuery>(mEventQueryLatency),
+			&QueryManager::deleteEventQuery, StdAlloc<NullEventQuery>());
 		mEventQueries.push_back(query.get());
 
 		return query;
@@ -30,4 +30,15 @@ namespace bs { namespace ct
 
 		return query;
 	}
+
+	void NullEventQuery::begin(const SPtr<CommandBuffer>& cb)
+	{
+		mReadyUpdate = QueryManager::instance().getUpdateCount() + mLatency;
+		setActive(true);
+	}
+
+	bool NullEventQuery::isReady() const
+	{
+		return QueryManager::instance().getUpdateCount() >= mReadyUpdate;
+	}
 }}
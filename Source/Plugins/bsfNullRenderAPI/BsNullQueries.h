@@ -26,19 +26,35 @@ namespace bs { namespace ct
 
 		/** @copydoc QueryManager::createOcclusionQuery */
 		SPtr<OcclusionQuery> createOcclusionQuery(bool binary, UINT32 deviceIdx = 0) const override;
+
+		/**
+		 * Sets the number of frames (calls to _update()) it takes for event queries to complete after they are begun.
+		 * Emulates the latency of a GPU running behind the CPU, so code waiting on queries can be tested without a GPU.
+		 * Only affects queries begun after the call.
+		 */
+		void setEventQueryLatency(UINT32 frames) { mEventQueryLatency = frames; }
+
+	private:
+		UINT32 mEventQueryLatency = 2;
 	};
 
 	/** @copydoc EventQuery */
 	class NullEventQuery final : public EventQuery
 	{
 	public:
-		NullEventQuery() = default;
+		NullEventQuery(UINT32 latency)
+			:mLatency(latency)
+		{ }
 
 		/** @copydoc EventQuery::begin */
-		void begin(const SPtr<CommandBuffer>& cb = nullptr) override { }
+		void begin(const SPtr<CommandBuffer>& cb = nullptr) override;
 
 		/** @copydoc EventQuery::isReady */
-		bool isReady() const override { return true; }
+		bool isReady() const override;
+
+	private:
+		UINT32 mLatency;
+		UINT64 mReadyUpdate = 0;
 	};
 
 	/** @copydoc TimerQuery */
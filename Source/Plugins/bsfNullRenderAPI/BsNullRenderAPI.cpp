@@ -57,6 +57,8 @@ namespace bs { namespace ct
 		mCurrentCapabilities->deviceName = "Null";
 		mCurrentCapabilities->renderAPIName = getName();
 		mCurrentCapabilities->deviceVendor = GPU_UNKNOWN;
+		mCurrentCapabilities->setCapability(RSC_PARAM_BLOCK_OFFSETS);
+		mCurrentCapabilities->setCapability(RSC_SECONDARY_CB);
 				
 		RenderAPI::initialize();
 	}
@@ -73,6 +75,7 @@ namespace bs { namespace ct
 		THROW_IF_NOT_CORE_THREAD;
 
 		mActiveRenderTarget = nullptr;
+		mMainCommandBuffer = nullptr;
 
 		if(mNullProgramFactory != nullptr)
 		{
@@ -93,6 +96,96 @@ namespace bs { namespace ct
 		RenderAPI::destroyCore();
 	}
 
+	void NullRenderAPI::setGraphicsPipelineImpl(const SPtr<GraphicsPipelineState>& pipelineState,
+		const SPtr<CommandBuffer>& commandBuffer)
+	{
+		getCB(commandBuffer)->_getStateCache().setGraphicsPipeline(pipelineState);
+	}
+
+	void NullRenderAPI::setComputePipelineImpl(const SPtr<ComputePipelineState>& pipelineState,
+		const SPtr<CommandBuffer>& commandBuffer)
+	{
+		getCB(commandBuffer)->_getStateCache().setComputePipeline(pipelineState);
+	}
+
+	void NullRenderAPI::setGpuParamsImpl(const SPtr<GpuParams>& gpuParams, const SPtr<CommandBuffer>& commandBuffer)
+	{
+		getCB(commandBuffer)->_getStateCache().setGpuParams(gpuParams);
+	}
+
+	void NullRenderAPI::setRenderTargetImpl(const SPtr<RenderTarget>& target, UINT32 readOnlyFlags,
+		RenderSurfaceMask loadMask, const SPtr<CommandBuffer>& commandBuffer)
+	{
+		getCB(commandBuffer)->_getStateCache().notifyRenderTargetChanged();
+	}
+
+	void NullRenderAPI::setViewportImpl(const Rect2& area, const SPtr<CommandBuffer>& commandBuffer)
+	{
+		getCB(commandBuffer)->_getStateCache().setViewport(area);
+	}
+
+	void NullRenderAPI::setScissorRectImpl(UINT32 left, UINT32 top, UINT32 right, UINT32 bottom,
+		const SPtr<CommandBuffer>& commandBuffer)
+	{
+		getCB(commandBuffer)->_getStateCache().setScissorRect(left, top, right, bottom);
+	}
+
+	void NullRenderAPI::setStencilRefImpl(UINT32 value, const SPtr<CommandBuffer>& commandBuffer)
+	{
+		getCB(commandBuffer)->_getStateCache().setStencilRef(value);
+	}
+
+	void NullRenderAPI::setVertexBuffersImpl(UINT32 index, SPtr<VertexBuffer>* buffers, UINT32 numBuffers,
+		const SPtr<CommandBuffer>& commandBuffer)
+	{
+		getCB(commandBuffer)->_getStateCache().setVertexBuffers(index, buffers, numBuffers);
+	}
+
+	void NullRenderAPI::setIndexBufferImpl(const SPtr<IndexBuffer>& buffer, const SPtr<CommandBuffer>& commandBuffer)
+	{
+		getCB(commandBuffer)->_getStateCache().setIndexBuffer(buffer);
+	}
+
+	void NullRenderAPI::setVertexDeclarationImpl(const SPtr<VertexDeclaration>& vertexDeclaration,
+		const SPtr<CommandBuffer>& commandBuffer)
+	{
+		getCB(commandBuffer)->_getStateCache().setVertexDeclaration(vertexDeclaration);
+	}
+
+	void NullRenderAPI::setDrawOperationImpl(DrawOperationType op, const SPtr<CommandBuffer>& commandBuffer)
+	{
+		getCB(commandBuffer)->_getStateCache().setDrawOperation(op);
+	}
+
+	void NullRenderAPI::addCommandsImpl(const SPtr<CommandBuffer>& commandBuffer, const SPtr<CommandBuffer>& secondary)
+	{
+		// State bound by the secondary buffer replaces the state of the primary buffer
+		getCB(commandBuffer)->_getStateCache().invalidate();
+		secondary->_getStateCache().invalidate();
+	}
+
+	void NullRenderAPI::submitCommandBufferImpl(const SPtr<CommandBuffer>& commandBuffer, UINT32 syncMask)
+	{
+		// Nothing is executed, but the buffer is considered reset once submitted so its state is no longer tracked
+		getCB(commandBuffer)->reset();
+	}
+
+	CommandBuffer* NullRenderAPI::getCB(const SPtr<CommandBuffer>& buffer)
+	{
+		if (buffer != nullptr)
+			return buffer.get();
+
+		const SPtr<CommandBuffer>& threadBuffer = _getThreadCommandBuffer();
+		if (threadBuffer != nullptr)
+			return threadBuffer.get();
+
+		// Created on first use, as the null render API can be used without being initialized (e.g. in tests)
+		if (mMainCommandBuffer == nullptr)
+			mMainCommandBuffer = CommandBuffer::create(GQT_GRAPHICS);
+
+		return mMainCommandBuffer.get();
+	}
+
 	void NullRenderAPI::convertProjectionMatrix(const Matrix4& matrix, Matrix4& dest)
 	{
 		dest = matrix;
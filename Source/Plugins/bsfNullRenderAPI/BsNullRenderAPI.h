@@ -20,85 +20,85 @@ namespace bs { namespace ct
 		/** @copydoc RenderAPI::getName */
 		const StringID& getName() const override;
 		
-		/** @copydoc RenderAPI::setGraphicsPipeline */
-		void setGraphicsPipeline(const SPtr<GraphicsPipelineState>& pipelineState,
-			const SPtr<CommandBuffer>& commandBuffer = nullptr) override { }
+		/** @copydoc RenderAPI::swapBuffers() */
+		void swapBuffers(const SPtr<RenderTarget>& target, UINT32 syncMask = 0xFFFFFFFF) override { }
 
-		/** @copydoc RenderAPI::setComputePipeline */
-		void setComputePipeline(const SPtr<ComputePipelineState>& pipelineState,
-			const SPtr<CommandBuffer>& commandBuffer = nullptr) override { }
+		/** @copydoc RenderAPI::getMainCommandBuffer() */
+		SPtr<CommandBuffer> getMainCommandBuffer() const override { return mMainCommandBuffer; }
 
-		/** @copydoc RenderAPI::setGpuParams */
-		void setGpuParams(const SPtr<GpuParams>& gpuParams,
-			const SPtr<CommandBuffer>& commandBuffer = nullptr) override { }
+		/** @copydoc RenderAPI::convertProjectionMatrix */
+		void convertProjectionMatrix(const Matrix4& matrix, Matrix4& dest) override;
 
-		/** @copydoc RenderAPI::clearRenderTarget */
-		void clearRenderTarget(UINT32 buffers, const Color& color = Color::Black, float depth = 1.0f, UINT16 stencil = 0,
-			UINT8 targetMask = 0xFF, const SPtr<CommandBuffer>& commandBuffer = nullptr) override { }
+		/** @copydoc RenderAPI::generateParamBlockDesc() */
+		GpuParamBlockDesc generateParamBlockDesc(const String& name, Vector<GpuParamDataDesc>& params) override ;
 
-		/** @copydoc RenderAPI::clearViewport */
-		void clearViewport(UINT32 buffers, const Color& color = Color::Black, float depth = 1.0f, UINT16 stencil = 0,
-			UINT8 targetMask = 0xFF, const SPtr<CommandBuffer>& commandBuffer = nullptr) override { }
+	protected:
+		friend class NullRenderAPIFactory;
 
-		/** @copydoc RenderAPI::setRenderTarget */
-		void setRenderTarget(const SPtr<RenderTarget>& target, UINT32 readOnlyFlags,
-			RenderSurfaceMask loadMask = RT_NONE, const SPtr<CommandBuffer>& commandBuffer = nullptr) override { }
+		/** @copydoc RenderAPI::setGraphicsPipelineImpl */
+		void setGraphicsPipelineImpl(const SPtr<GraphicsPipelineState>& pipelineState,
+			const SPtr<CommandBuffer>& commandBuffer) override;
 
-		/** @copydoc RenderAPI::setViewport */
-		void setViewport(const Rect2& area, const SPtr<CommandBuffer>& commandBuffer = nullptr) override { }
+		/** @copydoc RenderAPI::setComputePipelineImpl */
+		void setComputePipelineImpl(const SPtr<ComputePipelineState>& pipelineState,
+			const SPtr<CommandBuffer>& commandBuffer) override;
 
-		/** @copydoc RenderAPI::setScissorRect */
-		void setScissorRect(UINT32 left, UINT32 top, UINT32 right, UINT32 bottom,
-			const SPtr<CommandBuffer>& commandBuffer = nullptr) override { }
+		/** @copydoc RenderAPI::setGpuParamsImpl */
+		void setGpuParamsImpl(const SPtr<GpuParams>& gpuParams, const SPtr<CommandBuffer>& commandBuffer) override;
 
-		/** @copydoc RenderAPI::setStencilRef */
-		void setStencilRef(UINT32 value, const SPtr<CommandBuffer>& commandBuffer = nullptr) override { }
+		/** @copydoc RenderAPI::clearRenderTargetImpl */
+		void clearRenderTargetImpl(UINT32 buffers, const Color& color, float depth, UINT16 stencil,
+			UINT8 targetMask, const SPtr<CommandBuffer>& commandBuffer) override { }
 
-		/** @copydoc RenderAPI::setVertexBuffers */
-		void setVertexBuffers(UINT32 index, SPtr<VertexBuffer>* buffers, UINT32 numBuffers,
-			const SPtr<CommandBuffer>& commandBuffer = nullptr) override { }
+		/** @copydoc RenderAPI::clearViewportImpl */
+		void clearViewportImpl(UINT32 buffers, const Color& color, float depth, UINT16 stencil,
+			UINT8 targetMask, const SPtr<CommandBuffer>& commandBuffer) override { }
 
-		/** @copydoc RenderAPI::setIndexBuffer */
-		void setIndexBuffer(const SPtr<IndexBuffer>& buffer,
-			const SPtr<CommandBuffer>& commandBuffer = nullptr) override { }
+		/** @copydoc RenderAPI::setRenderTargetImpl */
+		void setRenderTargetImpl(const SPtr<RenderTarget>& target, UINT32 readOnlyFlags,
+			RenderSurfaceMask loadMask, const SPtr<CommandBuffer>& commandBuffer) override;
 
-		/** @copydoc RenderAPI::setVertexDeclaration */
-		void setVertexDeclaration(const SPtr<VertexDeclaration>& vertexDeclaration,
-			const SPtr<CommandBuffer>& commandBuffer = nullptr) override { }
+		/** @copydoc RenderAPI::setViewportImpl */
+		void setViewportImpl(const Rect2& area, const SPtr<CommandBuffer>& commandBuffer) override;
 
-		/** @copydoc RenderAPI::setDrawOperation */
-		void setDrawOperation(DrawOperationType op,
-			const SPtr<CommandBuffer>& commandBuffer = nullptr) override { }
+		/** @copydoc RenderAPI::setScissorRectImpl */
+		void setScissorRectImpl(UINT32 left, UINT32 top, UINT32 right, UINT32 bottom,
+			const SPtr<CommandBuffer>& commandBuffer) override;
 
-		/** @copydoc RenderAPI::draw */
-		void draw(UINT32 vertexOffset, UINT32 vertexCount, UINT32 instanceCount = 0,
-			const SPtr<CommandBuffer>& commandBuffer = nullptr) override { }
+		/** @copydoc RenderAPI::setStencilRefImpl */
+		void setStencilRefImpl(UINT32 value, const SPtr<CommandBuffer>& commandBuffer) override;
 
-		/** @copydoc RenderAPI::drawIndexed */
-		void drawIndexed(UINT32 startIndex, UINT32 indexCount, UINT32 vertexOffset, UINT32 vertexCount,
-			UINT32 instanceCount = 0, const SPtr<CommandBuffer>& commandBuffer = nullptr) override { }
+		/** @copydoc RenderAPI::setVertexBuffersImpl */
+		void setVertexBuffersImpl(UINT32 index, SPtr<VertexBuffer>* buffers, UINT32 numBuffers,
+			const SPtr<CommandBuffer>& commandBuffer) override;
 
-		/** @copydoc RenderAPI::dispatchCompute */
-		void dispatchCompute(UINT32 numGroupsX, UINT32 numGroupsY = 1, UINT32 numGroupsZ = 1,
-			const SPtr<CommandBuffer>& commandBuffer = nullptr) override { }
+		/** @copydoc RenderAPI::setIndexBufferImpl */
+		void setIndexBufferImpl(const SPtr<IndexBuffer>& buffer, const SPtr<CommandBuffer>& commandBuffer) override;
 
-		/** @copydoc RenderAPI::swapBuffers() */
-		void swapBuffers(const SPtr<RenderTarget>& target, UINT32 syncMask = 0xFFFFFFFF) override { }
+		/** @copydoc RenderAPI::setVertexDeclarationImpl */
+		void setVertexDeclarationImpl(const SPtr<VertexDeclaration>& vertexDeclaration,
+			const SPtr<CommandBuffer>& commandBuffer) override;
 
-		/** @copydoc RenderAPI::addCommands() */
-		void addCommands(const SPtr<CommandBuffer>& commandBuffer, const SPtr<CommandBuffer>& secondary) override { }
+		/** @copydoc RenderAPI::setDrawOperationImpl */
+		void setDrawOperationImpl(DrawOperationType op, const SPtr<CommandBuffer>& commandBuffer) override;
 
-		/** @copydoc RenderAPI::submitCommandBuffer() */
-		void submitCommandBuffer(const SPtr<CommandBuffer>& commandBuffer, UINT32 syncMask = 0xFFFFFFFF) override { }
+		/** @copydoc RenderAPI::drawImpl */
+		void drawImpl(UINT32 vertexOffset, UINT32 vertexCount, UINT32 instanceCount,
+			const SPtr<CommandBuffer>& commandBuffer) override { }
 
-		/** @copydoc RenderAPI::convertProjectionMatrix */
-		void convertProjectionMatrix(const Matrix4& matrix, Matrix4& dest) override;
+		/** @copydoc RenderAPI::drawIndexedImpl */
+		void drawIndexedImpl(UINT32 startIndex, UINT32 indexCount, UINT32 vertexOffset, UINT32 vertexCount,
+			UINT32 instanceCount, const SPtr<CommandBuffer>& commandBuffer) override { }
 
-		/** @copydoc RenderAPI::generateParamBlockDesc() */
-		GpuParamBlockDesc generateParamBlockDesc(const String& name, Vector<GpuParamDataDesc>& params) override ;
+		/** @copydoc RenderAPI::dispatchComputeImpl */
+		void dispatchComputeImpl(UINT32 numGroupsX, UINT32 numGroupsY, UINT32 numGroupsZ,
+			const SPtr<CommandBuffer>& commandBuffer) override { }
 
-	protected:
-		friend class NullRenderAPIFactory;
+		/** @copydoc RenderAPI::addCommandsImpl */
+		void addCommandsImpl(const SPtr<CommandBuffer>& commandBuffer, const SPtr<CommandBuffer>& secondary) override;
+
+		/** @copydoc RenderAPI::submitCommandBufferImpl */
+		void submitCommandBufferImpl(const SPtr<CommandBuffer>& commandBuffer, UINT32 syncMask) override;
 
 		/** @copydoc RenderAPI::initialize */
 		void initialize() override;
@@ -109,7 +109,14 @@ namespace bs { namespace ct
 		/** @copydoc RenderAPI::destroyCore */
 		void destroyCore() override;
 
+		/**
+		 * Returns the command buffer the commands should be recorded in. If no explicit command buffer is provided the
+		 * buffer of the current thread is used if set, or the main command buffer otherwise.
+		 */
+		CommandBuffer* getCB(const SPtr<CommandBuffer>& buffer);
+
 		NullProgramFactory* mNullProgramFactory = nullptr;
+		SPtr<CommandBuffer> mMainCommandBuffer;
 	};
 
 	/** @} */
@@ -51,9 +51,13 @@ namespace bs
 	class NullIBLUtility : public IBLUtility
 	{
 	public:
-		/** @copydoc IBLUtility::filterCubemapForSpecular */
+		/** @copydoc IBLUtility::filterCubemapForSpecular(const SPtr<Texture>&, const SPtr<Texture>&) const */
 		void filterCubemapForSpecular(const SPtr<Texture>& cubemap, const SPtr<Texture>& scratch) const override { }
 
+		/** @copydoc IBLUtility::filterCubemapForSpecular(const SPtr<Texture>&, const SPtr<Texture>&, UINT32) const */
+		void filterCubemapForSpecular(const SPtr<Texture>& cubemap, const SPtr<Texture>& scratch,
+			UINT32 step) const override { }
+
 		/** @copydoc IBLUtility::filterCubemapForIrradiance(const SPtr<Texture>&, const SPtr<Texture>&) const */
 		void filterCubemapForIrradiance(const SPtr<Texture>& cubemap, const SPtr<Texture>& output) const override { }
 
@@ -25,6 +25,7 @@
 #include "Renderer/BsRendererUtility.h"
 #include "Utility/BsRendererTextures.h"
 #include "Renderer/BsGpuResourcePool.h"
+#include "Renderer/BsGpuParamBlockArena.h"
 #include "Renderer/BsRendererManager.h"
 #include "Shading/BsShadowRendering.h"
 #include "Shading/BsStandardDeferred.h"
@@ -88,6 +89,7 @@ namespace bs { namespace ct
 		RendererUtility::startUp();
 		GpuSort::startUp();
 		GpuResourcePool::startUp();
+		GpuParamBlockArena::startUp();
 		IBLUtility::startUp<RenderBeastIBLUtility>();
 		RendererTextures::startUp(rendererTextures);
 
@@ -152,6 +154,7 @@ namespace bs { namespace ct
 
 		RendererTextures::shutDown();
 		IBLUtility::shutDown();
+		GpuParamBlockArena::shutDown();
 		GpuResourcePool::shutDown();
 		GpuSort::shutDown();
 		RendererUtility::shutDown();
@@ -297,6 +300,8 @@ namespace bs { namespace ct
 
 		ShadowRendering& shadowRenderer = mMainViewGroup->getShadowRenderer();
 		shadowRenderer.setShadowMapSize(mCoreOptions->shadowMapSize);
+
+		mMainViewGroup->setCpuLightGridBinning(mCoreOptions->cpuLightGridBinning);
 	}
 
 	ShaderExtensionPointInfo RenderBeast::getShaderExtensionPointInfo(const String& name)
@@ -376,6 +381,9 @@ namespace bs { namespace ct
 
 		const SceneInfo& sceneInfo = mScene->getSceneInfo();
 
+		// Release per-object and per-call data uploaded during the previous frame
+		GpuParamBlockArena::instance().begin();
+
 		// Note: I'm iterating over all sampler states every frame. If this ends up being a performance
 		// issue consider handling this internally in ct::Material which can only do it when sampler states
 		// are actually modified after sync
@@ -393,8 +401,14 @@ namespace bs { namespace ct
 		
 		FrameInfo frameInfo(timings, perFrameData);
 
-		// Make sure any renderer tasks finish first, as rendering might depend on them
-		processTasks(false, timings.frameIdx);
+		// Make sure any renderer tasks finish first, as rendering might depend on them. Time-sliced tasks (probe
+		// updates) only get a limited number of steps per frame, starting with the ones closest to the cameras.
+		Vector<Vector3> viewOrigins;
+		for (auto& entry : sceneInfo.views)
+			viewOrigins.push_back(entry->getProperties().viewOrigin);
+
+		PROFILE_CALL(processTasks(false, timings.frameIdx, mCoreOptions->probeUpdateBudget, viewOrigins),
+			"Renderer tasks")
 
 		// If any reflection probes were updated or added, we need to copy them over in the global reflection probe array
 		updateReflProbeArray();
@@ -782,17 +796,25 @@ namespace bs { namespace ct
 
 		Matrix4 viewOffsetMat = Matrix4::translation(-position);
 
+		const UINT32 firstFace = std::min(settings.firstFace, 6U);
+		const UINT32 numFaces = std::min(settings.numFaces, 6U - firstFace);
+		if(numFaces == 0)
+			return;
+
 		// Note: We render upside down, then flip the image vertically, which results in a horizontal flip. The horizontal
 		// flip is required due to the fact how cubemap faces are defined. Another option would be to change the view
 		// orientation matrix, but that also requires a culling mode flip which is inconvenient to do globally.
 		RendererView views[6];
-		for(UINT32 i = 0; i < 6; i++)
+		RendererView* viewPtrs[6];
+		for(UINT32 i = 0; i < numFaces; i++)
 		{
+			const UINT32 face = firstFace + i;
+
 			// Calculate view matrix
 			Vector3 forward;
 			Vector3 up = Vector3::UNIT_Y;
 
-			switch (i)
+			switch (face)
 			{
 			case CF_PositiveX:
 				forward = -Vector3::UNIT_X;
@@ -843,7 +865,7 @@ namespace bs { namespace ct
 			// Set up face render target
 			RENDER_TEXTURE_DESC cubeFaceRTDesc;
 			cubeFaceRTDesc.colorSurfaces[0].texture = cubemap;
-			cubeFaceRTDesc.colorSurfaces[0].face = i;
+			cubeFaceRTDesc.colorSurfaces[0].face = face;
 			cubeFaceRTDesc.colorSurfaces[0].numFaces = 1;
 			
 			viewDesc.target.target = RenderTexture::create(cubeFaceRTDesc);
@@ -851,11 +873,12 @@ namespace bs { namespace ct
 			views[i].setView(viewDesc);
 			views[i].setRenderSettings(renderSettings);
 			views[i].updatePerViewBuffer();
-		}
 
-		RendererView* viewPtrs[] = { &views[0], &views[1], &views[2], &views[3], &views[4], &views[5] };
+			viewPtrs[i] = &views[i];
+		}
 
-		RendererViewGroup viewGroup(viewPtrs, 6, false, mCoreOptions->shadowMapSize);
+		RendererViewGroup viewGroup(viewPtrs, numFaces, false, mCoreOptions->shadowMapSize);
+		viewGroup.setCpuLightGridBinning(mCoreOptions->cpuLightGridBinning);
 		viewGroup.determineVisibility(sceneInfo);
 
 		FrameInfo frameInfo({ 0.0f, 1.0f / 60.0f, 0 }, PerFrameData());
@@ -384,24 +384,20 @@ namespace bs { namespace ct
 
 	void RenderBeastIBLUtility::filterCubemapForSpecular(const SPtr<Texture>& cubemap, const SPtr<Texture>& scratch) const
 	{
-		auto& props = cubemap->getProperties();
-
 		SPtr<Texture> scratchCubemap = scratch;
 		if (scratchCubemap == nullptr)
-		{
-			TEXTURE_DESC cubemapDesc;
-			cubemapDesc.type = TEX_TYPE_CUBE_MAP;
-			cubemapDesc.format = props.getFormat();
-			cubemapDesc.width = props.getWidth();
-			cubemapDesc.height = props.getHeight();
-			cubemapDesc.numMips = PixelUtil::getMaxMipmaps(cubemapDesc.width, cubemapDesc.height, 1, cubemapDesc.format);
-			cubemapDesc.usage = TU_STATIC | TU_RENDERTARGET;
+			scratchCubemap = createScratchCubemap(cubemap);
 
-			scratchCubemap = Texture::create(cubemapDesc);
-		}
+		UINT32 numMips = cubemap->getProperties().getNumMipmaps() + 1;
+		for (UINT32 step = 0; step < numMips; step++)
+			filterCubemapForSpecular(cubemap, scratchCubemap, step);
+	}
 
+	void RenderBeastIBLUtility::filterCubemapForSpecular(const SPtr<Texture>& cubemap, const SPtr<Texture>& scratch,
+		UINT32 step) const
+	{
 		// We sample the cubemaps using importance sampling to generate roughness
-		UINT32 numMips = props.getNumMipmaps() + 1;
+		UINT32 numMips = cubemap->getProperties().getNumMipmaps() + 1;
 
 		// Before importance sampling the cubemaps we first create box filtered versions for each mip level. This helps fix
 		// the aliasing artifacts that would otherwise be noticeable on importance sampled cubemaps. The aliasing happens
@@ -410,27 +406,29 @@ namespace bs { namespace ct
 		//     noise, which is usually more acceptable
 		//  2. Even if we were to use fully random samples we would need a lot to avoid noticeable noise, which isn't
 		//     practical
-
-		// Copy base mip level to scratch cubemap
-		for (UINT32 face = 0; face < 6; face++)
+		if (step == 0)
 		{
-			TEXTURE_COPY_DESC copyDesc;
-			copyDesc.srcFace = face;
-			copyDesc.dstFace = face;
+			// Copy base mip level to scratch cubemap
+			for (UINT32 face = 0; face < 6; face++)
+			{
+				TEXTURE_COPY_DESC copyDesc;
+				copyDesc.srcFace = face;
+				copyDesc.dstFace = face;
 
-			cubemap->copy(scratchCubemap, copyDesc);
-		}
+				cubemap->copy(scratch, copyDesc);
+			}
 
-		// Fill out remaining scratch mip levels by downsampling
-		for (UINT32 mip = 1; mip < numMips; mip++)
-		{
-			UINT32 sourceMip = mip - 1;
-			downsampleCubemap(scratchCubemap, sourceMip, scratchCubemap, mip);
+			// Fill out remaining scratch mip levels by downsampling
+			for (UINT32 mip = 1; mip < numMips; mip++)
+			{
+				UINT32 sourceMip = mip - 1;
+				downsampleCubemap(scratch, sourceMip, scratch, mip);
+			}
 		}
-
-		// Importance sample
-		for (UINT32 mip = 1; mip < numMips; mip++)
+		else if (step < numMips)
 		{
+			// Importance sample a single mip level
+			const UINT32 mip = step;
 			for (UINT32 face = 0; face < 6; face++)
 			{
 				RENDER_TEXTURE_DESC cubeFaceRTDesc;
@@ -442,7 +440,7 @@ namespace bs { namespace ct
 				SPtr<RenderTarget> target = RenderTexture::create(cubeFaceRTDesc);
 
 				ReflectionCubeImportanceSampleMat* material = ReflectionCubeImportanceSampleMat::get();
-				material->execute(scratchCubemap, face, mip, target);
+				material->execute(scratch, face, mip, target);
 			}
 		}
 
@@ -43,6 +43,21 @@ namespace bs { namespace ct
 		 * shadows far away, but will never increase the resolution past the provided value.
 		 */
 		UINT32 shadowMapSize = 2048;
+
+		/**
+		 * If true, lights and reflection probes will be assigned to the light grid used for clustered forward rendering
+		 * on the CPU, instead of in a compute shader. This frees up GPU time at the cost of CPU time and an upload of
+		 * the grid contents every frame. Only relevant for feature sets that support clustered forward rendering.
+		 */
+		bool cpuLightGridBinning = false;
+
+		/**
+		 * Maximum number of reflection probe, light probe and skybox update steps to perform per frame. A step renders
+		 * a single cubemap face or filters a single mip level, so updates of multiple probes are spread over multiple
+		 * frames instead of causing a frame spike. Probes closest to the cameras are updated first. Set to zero to
+		 * perform all updates as soon as they are requested.
+		 */
+		UINT32 probeUpdateBudget = 6;
 	};
 
 	/** @} */
@@ -2,6 +2,11 @@
 //*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
 #include "Testing/BsTestSuite.h"
 #include "Utility/BsTextureRowAllocator.h"
+#include "Utility/BsTimer.h"
+#include "Shading/BsLightGridBinner.h"
+#include "BsRendererLight.h"
+#include "BsRendererReflectionProbe.h"
+#include "Math/BsRandom.h"
 
 namespace bs
 {
@@ -13,11 +18,13 @@ namespace bs
 
 	private:
 		void testTextureRowAllocator();
+		void testLightGridBinning();
 	};
 
 	RenderBeastTestSuite::RenderBeastTestSuite()
 	{
 		BS_ADD_TEST(RenderBeastTestSuite::testTextureRowAllocator);
+		BS_ADD_TEST(RenderBeastTestSuite::testLightGridBinning);
 	}
 
 	void RenderBeastTestSuite::testTextureRowAllocator()
@@ -71,4 +78,222 @@ namespace bs
 		auto a13 = alloc.alloc(0);
 		BS_TEST_ASSERT(a13.length == 0);
 	}
+
+	void RenderBeastTestSuite::testLightGridBinning()
+	{
+		using namespace ct;
+
+		// Grid for a 1920x1080 view, see LightGrid
+		const Vector3I gridSize(30, 17, 32);
+		const float nearPlane = 0.05f;
+		const float farPlane = 500.0f;
+
+		const Matrix4 projTransform = Matrix4::projectionPerspective(Degree(90.0f), 1920.0f / 1080.0f, nearPlane,
+			farPlane);
+		const Matrix4 viewTransform = Matrix4::view(Vector3(10.0f, 5.0f, 20.0f),
+			Quaternion(Vector3::UNIT_Y, Degree(20.0f)));
+
+		Random random(3);
+		auto generateScene = [&random](UINT32 numLights, UINT32 numProbes, Vector<LightData>& lights,
+			Vector<ReflProbeData>& probes)
+		{
+			// One directional light, followed by radial and spot lights
+			lights.resize(numLights + 1);
+			lights[0] = LightData();
+
+			for(UINT32 i = 1; i <= numLights; i++)
+			{
+				LightData& light = lights[i];
+				light = LightData();
+
+				const float attRadius = 1.0f + random.getUNorm() * 15.0f;
+				light.position = Vector3(random.getSNorm() * 200.0f, random.getSNorm() * 50.0f,
+					-random.getUNorm() * 300.0f);
+				light.direction = random.getUnitVector();
+				light.attRadiusSqrdInv = 1.0f / (attRadius * attRadius);
+				light.shiftedLightPosition = light.position;
+
+				if(i <= numLights / 2)
+					light.boundsRadius = attRadius;
+				else
+				{
+					const Radian angle = Degree(5.0f + random.getUNorm() * 80.0f);
+					light.spotAngles = Vector3(angle.valueRadians(), Math::cos(angle), 1.0f);
+
+					// Same as Light::updateBounds()
+					light.boundsRadius = attRadius * std::sqrt(Math::sqr(Math::tan(angle)) + 0.25f);
+
+					// Area spot light
+					if((i % 4) == 0)
+						light.shiftedLightPosition = light.position - light.direction * 0.5f;
+				}
+			}
+
+			probes.resize(numProbes);
+			for(UINT32 i = 0; i < numProbes; i++)
+			{
+				probes[i] = ReflProbeData();
+				probes[i].position = Vector3(random.getSNorm() * 200.0f, random.getSNorm() * 50.0f,
+					-random.getUNorm() * 300.0f);
+				probes[i].radius = 5.0f + random.getUNorm() * 25.0f;
+			}
+		};
+
+		// Compare against testing every light and probe against every cell
+		{
+			const UINT32 numLights = 400;
+			const UINT32 numProbes = 50;
+
+			Vector<LightData> lights;
+			Vector<ReflProbeData> probes;
+			generateScene(numLights, numProbes, lights, probes);
+
+			LightGridBinner binner;
+			binner.setGrid(gridSize, projTransform, nearPlane, farPlane);
+
+			LightGridLinkedLists lists;
+			binner.bin(viewTransform, lights.data(), 1, numLights / 2, numLights / 2, probes.data(), numProbes, 32,
+				lists);
+
+			LightGridCellData cellData;
+			LightGridBinner::reduce(lists, cellData);
+
+			auto intersects = [](const AABox& cell, const Vector3& center, float radius)
+			{
+				const Vector3 distances = Vector3::max(Vector3::ZERO,
+					Vector3(std::abs(center.x - cell.getCenter().x), std::abs(center.y - cell.getCenter().y),
+					std::abs(center.z - cell.getCenter().z)) - cell.getHalfSize());
+
+				return distances.squaredLength() <= radius * radius;
+			};
+
+			bool allMatch = true;
+			UINT32 numCellsWithLights = 0;
+			for(UINT32 z = 0; z < (UINT32)gridSize[2]; z++)
+			{
+				for(UINT32 y = 0; y < (UINT32)gridSize[1]; y++)
+				{
+					for(UINT32 x = 0; x < (UINT32)gridSize[0]; x++)
+					{
+						const AABox cell = binner.getCellBounds(x, y, z);
+						const UINT32 cellIdx = (z * gridSize[1] + y) * gridSize[0] + x;
+
+						Vector<UINT32> expectedLights;
+						for(UINT32 i = 1; i <= numLights; i++)
+						{
+							const LightData& light = lights[i];
+							const bool isSpot = i > numLights / 2;
+
+							if(!isSpot)
+							{
+								if(intersects(cell, viewTransform.multiplyAffine(light.position), light.boundsRadius))
+									expectedLights.push_back(i);
+
+								continue;
+							}
+
+							// Spot lights are tested using the smallest sphere enclosing the cone, and the cone itself
+							const float attRadius = 1.0f / std::sqrt(light.attRadiusSqrdInv);
+							const Vector3 origin = viewTransform.multiplyAffine(light.shiftedLightPosition);
+							const Vector3 direction =
+								Vector3::normalize(viewTransform.multiplyDirection(light.direction));
+							const float range = attRadius + light.position.distance(light.shiftedLightPosition);
+							const float cosAngle = Math::cos(light.spotAngles.x);
+							const float sinAngle = Math::sin(light.spotAngles.x);
+
+							float radius;
+							Vector3 center;
+							if(cosAngle > Math::INV_SQRT2)
+							{
+								radius = range / (2.0f * cosAngle);
+								center = origin + direction * radius;
+							}
+							else
+							{
+								radius = range * sinAngle;
+								center = origin + direction * (range * cosAngle);
+							}
+
+							if(!intersects(cell, center, radius))
+								continue;
+
+							const float cellRadius = cell.getHalfSize().length();
+							const Vector3 toCell = cell.getCenter() - origin;
+							const float axisDist = toCell.dot(direction);
+							const float perpDistSqrd = toCell.squaredLength() - axisDist * axisDist;
+							const float perpDist = std::sqrt(std::max(perpDistSqrd, 0.0f));
+							const float coneDist = perpDist * cosAngle - axisDist * sinAngle;
+
+							if(coneDist > cellRadius || axisDist > cellRadius + range || axisDist < -cellRadius)
+								continue;
+
+							expectedLights.push_back(i);
+						}
+
+						Vector<UINT32> expectedProbes;
+						for(UINT32 i = 0; i < numProbes; i++)
+						{
+							if(intersects(cell, viewTransform.multiplyAffine(probes[i].position), probes[i].radius))
+								expectedProbes.push_back(i);
+						}
+
+						const UINT32* lightRange = &cellData.lightOffsetsAndSize[cellIdx * 4];
+						const UINT32* probeRange = &cellData.probeOffsetsAndSize[cellIdx * 2];
+
+						Vector<UINT32> binnedLights(cellData.lightIndices.begin() + lightRange[0],
+							cellData.lightIndices.begin() + lightRange[0] + lightRange[1] + lightRange[2]);
+						Vector<UINT32> binnedProbes(cellData.probeIndices.begin() + probeRange[0],
+							cellData.probeIndices.begin() + probeRange[0] + probeRange[1]);
+
+						allMatch &= binnedLights == expectedLights && binnedProbes == expectedProbes;
+						if(!expectedLights.empty())
+							numCellsWithLights++;
+					}
+				}
+			}
+
+			BS_TEST_ASSERT(allMatch);
+			BS_TEST_ASSERT(numCellsWithLights > 0);
+		}
+
+		// Performance with a large number of lights
+		{
+			const UINT32 numLights = 10000;
+			const UINT32 numProbes = 200;
+
+			Vector<LightData> lights;
+			Vector<ReflProbeData> probes;
+			generateScene(numLights, numProbes, lights, probes);
+
+			LightGridBinner binner;
+			LightGridLinkedLists lists;
+			LightGridCellData cellData;
+
+			Timer timer;
+			binner.setGrid(gridSize, projTransform, nearPlane, farPlane);
+			const UINT64 setupTime = timer.getMicroseconds();
+
+			const UINT32 numIterations = 10;
+			timer.reset();
+			for(UINT32 i = 0; i < numIterations; i++)
+			{
+				binner.bin(viewTransform, lights.data(), 1, numLights / 2, numLights / 2, probes.data(), numProbes, 32,
+					lists);
+			}
+
+			const UINT64 binTime = timer.getMicroseconds() / numIterations;
+
+			timer.reset();
+			LightGridBinner::reduce(lists, cellData);
+			const UINT64 reduceTime = timer.getMicroseconds();
+
+			BS_TEST_ASSERT(!lists.lightLinks.empty());
+			BS_TEST_ASSERT(cellData.lightIndices.size() == lists.lightLinks.size());
+
+			BS_LOG(Info, Renderer, "Binning {0} lights and {1} probes into {2} light grid cells: grid setup {3} us, "
+				"binning {4} us, reduction {5} us ({6} light links, {7} probe links)", numLights, numProbes,
+				gridSize[0] * gridSize[1] * gridSize[2], setupTime, binTime, reduceTime, lists.lightLinks.size(),
+				lists.probeLinks.size());
+		}
+	}
 }
@@ -42,7 +42,7 @@ namespace bs { namespace ct
 
 			gRendererUtility().setPassParams(entry.renderElem->params, entry.passIdx);
 
-			entry.renderElem->draw();
+			entry.renderElem->draw(entry.lod);
 		}
 	}
 
@@ -146,7 +146,17 @@ namespace bs { namespace ct
 
 			mIsValid = registerNode(finalNode);
 
-			if (!mIsValid)
+			if (mIsValid)
+			{
+				// Each node's outputs live from the node's own index up to the index of the last node using them. Nodes
+				// without users (i.e. the final node) are cleared right after rendering.
+				for (UINT32 i = 0; i < (UINT32)mNodeInfos.size(); i++)
+				{
+					const UINT32 lastUseIdx = mNodeInfos[i].lastUseIdx != (UINT32)-1 ? mNodeInfos[i].lastUseIdx : i;
+					mNodeInfos[lastUseIdx].nodesToClear.add(mNodeInfos[i].node);
+				}
+			}
+			else
 				clear();
 		}
 		bs_frame_clear();
@@ -157,55 +167,45 @@ namespace bs { namespace ct
 		if (!mIsValid)
 			return;
 
-		bs_frame_mark();
-		{
-			FrameVector<const NodeInfo*> activeNodes;
+		GpuResourcePool& resPool = gGpuResourcePool();
+		resPool.resetStats();
 
-			UINT32 idx = 0;
-			for (auto& entry : mNodeInfos)
-			{
-				inputs.inputNodes = entry.inputs;
+		for (auto& entry : mNodeInfos)
+		{
+			inputs.inputNodes = entry.inputs;
 
 #if BS_PROFILING_ENABLED
-				const ProfilerString sampleName = ProfilerString("RC: ") + entry.nodeType->id.c_str();
-				BS_GPU_PROFILE_BEGIN(sampleName);
-				gProfilerCPU().beginSample(sampleName.c_str());
+			const ProfilerString sampleName = ProfilerString("RC: ") + entry.nodeType->id.c_str();
+			BS_GPU_PROFILE_BEGIN(sampleName);
+			gProfilerCPU().beginSample(sampleName.c_str());
 #endif
 
-				entry.node->render(inputs);
+			entry.node->render(inputs);
 
 #if BS_PROFILING_ENABLED
-				gProfilerCPU().endSample(sampleName.c_str());
-				BS_GPU_PROFILE_END(sampleName);
+			gProfilerCPU().endSample(sampleName.c_str());
+			BS_GPU_PROFILE_END(sampleName);
 #endif
 
-				activeNodes.push_back(&entry);
-
-				for (UINT32 i = 0; i < (UINT32)activeNodes.size(); ++i)
-				{
-					if (activeNodes[i] == nullptr)
-						continue;
-
-					if (activeNodes[i]->lastUseIdx <= idx)
-					{
-						activeNodes[i]->node->clear();
-						activeNodes[i] = nullptr;
-					}
-				}
-
-				idx++;
-			}
+			for (auto& node : entry.nodesToClear)
+				node->clear();
 		}
-		bs_frame_clear();
 
-		if (!mNodeInfos.empty())
-			mNodeInfos.back().node->clear();
+		const GpuResourcePoolStats& poolStats = resPool.getStats();
+		mMemoryStats.peakMemory = poolStats.peakUsedMemory - poolStats.baseUsedMemory;
+		mMemoryStats.requestedMemory = poolStats.requestedMemory;
+		mMemoryStats.numAliased = poolStats.numAliased;
 	}
 
 	void RenderCompositor::clear()
 	{
+		// Hand any pooled resources the nodes still reference back to the pool, so they can be reused by other views
+		// before they age out
 		for (auto& entry : mNodeInfos)
+		{
+			entry.node->clear();
 			bs_delete(entry.node);
+		}
 
 		mNodeInfos.clear();
 		mIsValid = false;
@@ -492,6 +492,7 @@ namespace bs { namespace ct
 		normalTex = nullptr;
 		roughMetalTex = nullptr;
 		idTex = nullptr;
+		velocityTex = nullptr;
 	}
 
 	SmallVector<StringID, 4> RCNodeBasePass::getDependencies(const RendererView& view)
@@ -71,10 +71,30 @@ namespace ct
 		virtual void clear() = 0;
 	};
 
+	/**
+	 * Information about the memory used by resources allocated from the GpuResourcePool during a single
+	 * RenderCompositor::execute() call. All sizes are in bytes.
+	 */
+	struct RenderCompositorMemoryStats
+	{
+		/** Largest amount of memory used by the allocated resources at the same time. */
+		UINT64 peakMemory = 0;
+
+		/** Sum of the memory of all allocated resources, as it would be if no two allocations shared a resource. */
+		UINT64 requestedMemory = 0;
+
+		/** Number of allocations that reused a resource released by an earlier node during the same execution. */
+		UINT32 numAliased = 0;
+	};
+
 	/**
 	 * Performs rendering by iterating over a hierarchy of render nodes. Each node in the hierarchy performs a specific
 	 * rendering tasks and passes its output to the dependant node. The system takes care of initializing, rendering and
 	 * cleaning up nodes automatically depending on their dependencies.
+	 *
+	 * Nodes are cleared as soon as the last node using their outputs is done rendering. This releases their resources
+	 * back to the GpuResourcePool, so nodes rendered later can reuse them, and resources of nodes whose lifetimes don't
+	 * overlap end up sharing the same memory.
 	 */
 	class RenderCompositor
 	{
@@ -89,6 +109,9 @@ namespace ct
 			NodeType* nodeType;
 			UINT32 lastUseIdx;
 			SmallVector<RenderCompositorNode*, 4> inputs;
+
+			/** Nodes whose lifetime ends once this node is done rendering. */
+			SmallVector<RenderCompositorNode*, 4> nodesToClear;
 		};
 
 	public:
@@ -108,12 +131,16 @@ namespace ct
 		/** Performs rendering using the current render node hierarchy. This is expected to be called once per frame. */
 		void execute(RenderCompositorNodeInputs& inputs) const;
 
+		/** Returns information about the memory used by the transient resources during the last execute() call. */
+		const RenderCompositorMemoryStats& getMemoryStats() const { return mMemoryStats; }
+
 	private:
 		/** Clears the render node hierarchy. */
 		void clear();
 
 		Vector<NodeInfo> mNodeInfos;
 		bool mIsValid = false;
+		mutable RenderCompositorMemoryStats mMemoryStats;
 
 		/************************************************************************/
 		/* 							NODE TYPES	                     			*/
@@ -5,12 +5,13 @@
 #include "Renderer/BsDecal.h"
 #include "Mesh/BsMesh.h"
 #include "Renderer/BsRendererUtility.h"
+#include "Renderer/BsGpuParamBlockArena.h"
 
 namespace bs { namespace ct
 {
 	DecalParamDef gDecalParamDef;
 
-	void DecalRenderElement::draw() const
+	void DecalRenderElement::draw(UINT32 lod) const
 	{
 		gRendererUtility().draw(mesh, subMesh);
 	}
@@ -69,6 +70,6 @@ namespace bs { namespace ct
 		gPerCallParamDef.gMatWorldViewProj.set(perCallParamBuffer, worldViewProjMatrix);
 
 		if(flush)
-			perCallParamBuffer->flushToGPU();
+			GpuParamBlockArena::instance().allocate(perCallParamBuffer);
 	}
 }}
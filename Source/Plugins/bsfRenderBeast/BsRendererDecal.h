@@ -84,7 +84,7 @@ namespace bs { namespace ct
 		GpuParamTexture maskInputTexture;
 
 		/** @copydoc RenderElement::draw */
-		void draw() const override;
+		void draw(UINT32 lod) const override;
 	};
 
 	 /** Contains information about a Decal, used by the Renderer. */
@@ -99,7 +99,8 @@ namespace bs { namespace ct
 		 * Updates the per-call GPU buffer according to the provided parameters.
 		 *
 		 * @param[in]	viewProj	Combined view-projection matrix of the current camera.
-		 * @param[in]	flush		True if the buffer contents should be immediately flushed to the GPU.
+		 * @param[in]	flush		True if the buffer contents should be immediately allocated from the
+		 *							GpuParamBlockArena, which uploads them to the GPU before the buffer is bound.
 		 */
 		void updatePerCallBuffer(const Matrix4& viewProj, bool flush = true) const;
 
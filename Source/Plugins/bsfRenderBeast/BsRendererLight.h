@@ -188,6 +188,12 @@ namespace ct
 
 		/** Returns a list of all visible lights of the specified type. */
 		const Vector<const RendererLight*>& getLights(LightType type) const { return mVisibleLights[(UINT32)type]; }
+
+		/**
+		 * Returns information about all visible lights, in the same order as in the light buffer: directional lights,
+		 * followed by radial lights, followed by spot lights.
+		 */
+		const Vector<LightData>& getLightData() const { return mVisibleLightData; }
 	private:
 		SPtr<GpuBuffer> mLightBuffer;
 
@@ -95,7 +95,7 @@ namespace bs { namespace ct
 		buffer->unlock();
 	}
 
-	void ParticlesRenderElement::draw() const
+	void ParticlesRenderElement::draw(UINT32 lod) const
 	{
 		if (numParticles > 0)
 		{
@@ -200,7 +200,7 @@ namespace bs { namespace ct
 		bool isValid() const { return !is3D || mesh != nullptr; }
 
 		/** @copydoc RenderElement::draw */
-		void draw() const override;
+		void draw(UINT32 lod) const override;
 	};
 
 	/** Contains information about a ParticleSystem, used by the Renderer. */
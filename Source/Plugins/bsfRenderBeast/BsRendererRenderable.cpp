@@ -2,6 +2,7 @@
 //*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
 #include "BsRendererRenderable.h"
 #include "Renderer/BsRendererUtility.h"
+#include "Renderer/BsGpuParamBlockArena.h"
 #include "Mesh/BsMesh.h"
 #include "Utility/BsBitwise.h"
 
@@ -22,12 +23,28 @@ namespace bs { namespace ct
 		gPerObjectParamDef.gLayer.set(buffer, (INT32)layer);
 	}
 
-	void RenderableElement::draw() const
+	void RenderableElement::draw(UINT32 lod) const
 	{
+		const SubMesh& lodSubMesh = lod == 0 ? subMesh : mesh->getProperties().getSubMesh(subMeshIdx, lod);
+
 		if (morphVertexDeclaration == nullptr)
-			gRendererUtility().draw(mesh, subMesh);
+			gRendererUtility().draw(mesh, lodSubMesh);
 		else
-			gRendererUtility().drawMorph(mesh, subMesh, morphShapeBuffer, morphVertexDeclaration);
+			gRendererUtility().drawMorph(mesh, lodSubMesh, morphShapeBuffer, morphVertexDeclaration);
+	}
+
+	/** Returns a transform that decodes quantized vertex positions of the renderable's mesh into mesh local space. */
+	static Matrix4 getPositionDecodeTransform(const Renderable& renderable)
+	{
+		const SPtr<Mesh>& mesh = renderable.getMesh();
+		if(mesh == nullptr)
+			return Matrix4::IDENTITY;
+
+		const PositionQuantization& quantization = mesh->getProperties().getPositionQuantization();
+		if(quantization.isIdentity())
+			return Matrix4::IDENTITY;
+
+		return quantization.getDecodeMatrix();
 	}
 
 	RendererRenderable::RendererRenderable()
@@ -41,16 +58,20 @@ namespace bs { namespace ct
 		const Matrix4 worldNoScaleTransform = renderable->getMatrixNoScale();
 		const UINT32 layer = Bitwise::mostSignificantBit(renderable->getLayer());
 
-		PerObjectBuffer::update(perObjectParamBuffer, worldTfrm, worldNoScaleTransform, prevWorldTfrm, layer);
+		// Positions are decoded by the world transform, while normals are unaffected by quantization
+		const Matrix4 decodeTransform = getPositionDecodeTransform(*renderable);
+
+		PerObjectBuffer::update(perObjectParamBuffer, worldTfrm * decodeTransform, worldNoScaleTransform,
+			prevWorldTfrm * decodeTransform, layer);
 	}
 
 	void RendererRenderable::updatePerCallBuffer(const Matrix4& viewProj, bool flush)
 	{
-		const Matrix4 worldViewProjMatrix = viewProj * renderable->getMatrix();
+		const Matrix4 worldViewProjMatrix = viewProj * renderable->getMatrix() * getPositionDecodeTransform(*renderable);
 
 		gPerCallParamDef.gMatWorldViewProj.set(perCallParamBuffer, worldViewProjMatrix);
 
 		if(flush)
-			perCallParamBuffer->flushToGPU();
+			GpuParamBlockArena::instance().allocate(perCallParamBuffer);
 	}
 }}
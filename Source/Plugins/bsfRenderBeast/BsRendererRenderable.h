@@ -58,6 +58,9 @@ namespace bs { namespace ct
 		 */
 		MaterialSamplerOverrides* samplerOverrides;
 
+		/** Index of the sub-mesh within the mesh, used for retrieving the sub-mesh at other levels of detail. */
+		UINT32 subMeshIdx = 0;
+
 		/** Identifier of the animation running on the renderable's mesh. -1 if no animation. */
 		UINT64 animationId;
 
@@ -92,7 +95,7 @@ namespace bs { namespace ct
 		mutable UINT32 morphShapeVersion;
 
 		/** @copydoc RenderElement::draw */
-		void draw() const override;
+		void draw(UINT32 lod) const override;
 	};
 
 	 /** Contains information about a Renderable, used by the Renderer. */
@@ -107,7 +110,8 @@ namespace bs { namespace ct
 		 * Updates the per-call GPU buffer according to the provided parameters.
 		 *
 		 * @param[in]	viewProj	Combined view-projection matrix of the current camera.
-		 * @param[in]	flush		True if the buffer contents should be immediately flushed to the GPU.
+		 * @param[in]	flush		True if the buffer contents should be immediately allocated from the
+		 *							GpuParamBlockArena, which uploads them to the GPU before the buffer is bound.
 		 */
 		void updatePerCallBuffer(const Matrix4& viewProj, bool flush = true);
 
@@ -18,6 +18,7 @@
 #include "Shading/BsGpuParticleSimulation.h"
 #include "Renderer/BsDecal.h"
 #include "Renderer/BsRendererUtility.h"
+#include "Renderer/BsGpuParamBlockArena.h"
 
 namespace bs {	namespace ct
 {
@@ -400,6 +401,7 @@ namespace bs {	namespace ct
 				renElement.type = (UINT32)RenderElementType::Renderable;
 				renElement.mesh = mesh;
 				renElement.subMesh = meshProps.getSubMesh(i);
+				renElement.subMeshIdx = i;
 				renElement.animType = renderable->getAnimType();
 				renElement.animationId = renderable->getAnimationId();
 				renElement.morphShapeVersion = 0;
@@ -1395,7 +1397,7 @@ namespace bs {	namespace ct
 		for (auto& element : rendererRenderable->elements)
 			element.material->updateParamsSet(element.params, element.materialAnimationTime);
 
-		mInfo.renderables[idx]->perObjectParamBuffer->flushToGPU();
+		GpuParamBlockArena::instance().allocate(mInfo.renderables[idx]->perObjectParamBuffer);
 		mInfo.renderableReady[idx] = true;
 	}
 
@@ -1418,7 +1420,7 @@ namespace bs {	namespace ct
 		ParticlesRenderElement& renElement = mInfo.particleSystems[idx].renderElement;
 		renElement.material->updateParamsSet(renElement.params, 0.0f);
 		
-		mInfo.particleSystems[idx].perObjectParamBuffer->flushToGPU();
+		GpuParamBlockArena::instance().allocate(mInfo.particleSystems[idx].perObjectParamBuffer);
 	}
 
 	void RendererScene::prepareDecal(UINT32 idx, const FrameInfo& frameInfo)
@@ -1427,7 +1429,7 @@ namespace bs {	namespace ct
 		renElement.materialAnimationTime += frameInfo.timings.timeDelta;
 		renElement.material->updateParamsSet(renElement.params, renElement.materialAnimationTime);
 		
-		mInfo.decals[idx].perObjectParamBuffer->flushToGPU();
+		GpuParamBlockArena::instance().allocate(mInfo.decals[idx].perObjectParamBuffer);
 	}
 
 	void RendererScene::updateParticleSystemBounds(const ParticlePerFrameData* particleRenderData)
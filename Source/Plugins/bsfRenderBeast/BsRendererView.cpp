@@ -3,6 +3,7 @@
 #include "BsRendererView.h"
 #include "Renderer/BsCamera.h"
 #include "Renderer/BsRenderable.h"
+#include "Mesh/BsMesh.h"
 #include "Renderer/BsRendererUtility.h"
 #include "Material/BsMaterial.h"
 #include "Material/BsShader.h"
@@ -13,6 +14,9 @@
 #include "BsRendererDecal.h"
 #include "Animation/BsAnimationManager.h"
 #include "RenderAPI/BsCommandBuffer.h"
+#include "Managers/BsTextureStreamingManager.h"
+#include "Managers/BsGpuReadbackManager.h"
+#include "Renderer/BsSkybox.h"
 
 namespace bs { namespace ct
 {
@@ -303,7 +307,7 @@ namespace bs { namespace ct
 		auto lastFinishedIter = mLuminanceUpdates.end();
 		for(auto iter = mLuminanceUpdates.begin(); iter != mLuminanceUpdates.end(); ++iter)
 		{
-			if (iter->commandBuffer->getState() == CommandBufferState::Executing)
+			if (!iter->readback.hasCompleted())
 				break;
 
 			lastFinishedIter = iter;
@@ -312,11 +316,12 @@ namespace bs { namespace ct
 		if (lastFinishedIter != mLuminanceUpdates.end())
 		{
 			// Get new luminance value
-			mPreviousEyeAdaptation = mCurrentEyeAdaptation;
-
-			PixelData data = lastFinishedIter->outputTexture->texture->lock(GBL_READ_ONLY);
-			mCurrentEyeAdaptation = data.getColorAt(0, 0).r;
-			lastFinishedIter->outputTexture->texture->unlock();
+			SPtr<PixelData> data = lastFinishedIter->readback.getReturnValue();
+			if (data != nullptr)
+			{
+				mPreviousEyeAdaptation = mCurrentEyeAdaptation;
+				mCurrentEyeAdaptation = data->getColorAt(0, 0).r;
+			}
 
 			// We've received information about eye adaptation, use that to determine if redrawing
 			// is required (technically we're drawing a few frames extra, as this information is always
@@ -349,7 +354,8 @@ namespace bs { namespace ct
 
 	void RendererView::_notifyLuminanceUpdated(UINT64 frameIdx, SPtr<CommandBuffer> cb, SPtr<PooledRenderTexture> texture) const
 	{
-		mLuminanceUpdates.emplace_back(frameIdx, cb, texture);
+		TAsyncOp<SPtr<PixelData>> readback = GpuReadbackManager::instance().readTexture(texture->texture, 0, 0, cb);
+		mLuminanceUpdates.emplace_back(frameIdx, std::move(readback));
 	}
 
 	void RendererView::determineVisible(const Vector<RendererRenderable*>& renderables, const Vector<CullInfo>& cullInfos,
@@ -521,20 +527,71 @@ namespace bs { namespace ct
 		}
 	}
 
+	/**
+	 * Reports the on-screen size of all streaming textures used by the material to the TextureStreamingManager, so it
+	 * can make sure mip levels of appropriate detail are resident.
+	 */
+	static void reportTextureUsage(const Material& material, float screenSize)
+	{
+		const SPtr<MaterialParams>& params = material._getInternalParams();
+		if (params == nullptr)
+			return;
+
+		for (UINT32 i = 0; i < params->getNumParams(); i++)
+		{
+			const MaterialParams::ParamData* paramData = params->getParamData(i);
+			if (paramData->type != MaterialParams::ParamType::Texture)
+				continue;
+
+			SPtr<Texture> texture;
+			TextureSurface surface;
+			params->getTexture(*paramData, texture, surface);
+
+			if (texture != nullptr && texture->getStreamingId() != 0)
+				TextureStreamingManager::instance().notifyUsage(texture->getStreamingId(), screenSize);
+		}
+	}
+
+	float RendererView::getTexelScreenSize(const Sphere& bounds) const
+	{
+		// Approximate the on-screen size of an object's textures with the size of the object, in pixels
+		const auto viewHeight = (float)mProperties.target.viewRect.height;
+		return std::min(getScreenSize(bounds), 1.0f) * viewHeight;
+	}
+
 	void RendererView::queueRenderElements(const SceneInfo& sceneInfo)
 	{
+		const bool streamTextures = TextureStreamingManager::isStarted();
+
 		// Queue renderables
 		for(UINT32 i = 0; i < (UINT32)sceneInfo.renderables.size(); i++)
 		{
 			if (!mVisibility.renderables[i])
 				continue;
 
-			const AABox& boundingBox = sceneInfo.renderableCullInfos[i].bounds.getBox();
+			const Bounds& bounds = sceneInfo.renderableCullInfos[i].bounds;
+			const AABox& boundingBox = bounds.getBox();
 			const float distanceToCamera = (mProperties.viewOrigin - boundingBox.getCenter()).length();
+			const float screenSize = getScreenSize(bounds.getSphere());
+
+			// Pick the level of detail based on how large the renderable is on screen
+			UINT32 lod = 0;
+			const SPtr<Mesh>& mesh = sceneInfo.renderables[i]->renderable->getMesh();
+			if (mesh != nullptr)
+			{
+				const MeshProperties& meshProps = mesh->getProperties();
+				if (meshProps.getNumLODs() > 1)
+					lod = meshProps.selectLOD(screenSize);
+			}
+
+			const float texelScreenSize = streamTextures ? getTexelScreenSize(bounds.getSphere()) : 0.0f;
 
 			bool needsVelocity = requiresVelocityWrites();
 			for (auto& renderElem : sceneInfo.renderables[i]->elements)
 			{
+				if (streamTextures)
+					reportTextureUsage(*renderElem.material, texelScreenSize);
+
 				UINT32 techniqueIdx;
 				if (needsVelocity)
 				{
@@ -549,11 +606,11 @@ namespace bs { namespace ct
 
 				// Note: I could keep renderables in multiple separate arrays, so I don't need to do the check here
 				if (shaderFlags.isSet(ShaderFlag::Transparent))
-					mTransparentQueue->add(&renderElem, distanceToCamera, techniqueIdx);
+					mTransparentQueue->add(&renderElem, distanceToCamera, techniqueIdx, lod);
 				else if (shaderFlags.isSet(ShaderFlag::Forward))
-					mForwardOpaqueQueue->add(&renderElem, distanceToCamera, techniqueIdx);
+					mForwardOpaqueQueue->add(&renderElem, distanceToCamera, techniqueIdx, lod);
 				else
-					mDeferredOpaqueQueue->add(&renderElem, distanceToCamera, techniqueIdx);
+					mDeferredOpaqueQueue->add(&renderElem, distanceToCamera, techniqueIdx, lod);
 			}
 		}
 
@@ -567,9 +624,13 @@ namespace bs { namespace ct
 			if (!renderElem.isValid())
 				continue;
 
-			const AABox& boundingBox = sceneInfo.particleSystemCullInfos[i].bounds.getBox();
+			const Bounds& bounds = sceneInfo.particleSystemCullInfos[i].bounds;
+			const AABox& boundingBox = bounds.getBox();
 			const float distanceToCamera = (mProperties.viewOrigin - boundingBox.getCenter()).length();
 
+			if (streamTextures)
+				reportTextureUsage(*renderElem.material, getTexelScreenSize(bounds.getSphere()));
+
 			ShaderFlags shaderFlags = renderElem.material->getShader()->getFlags();
 
 			if (shaderFlags.isSet(ShaderFlag::Transparent))
@@ -596,9 +657,13 @@ namespace bs { namespace ct
 			if (shaderFlags.isSetAny(ShaderFlag::Transparent | ShaderFlag::Forward))
 				continue;
 
-			const AABox& boundingBox = sceneInfo.decalCullInfos[i].bounds.getBox();
+			const Bounds& bounds = sceneInfo.decalCullInfos[i].bounds;
+			const AABox& boundingBox = bounds.getBox();
 			const float distanceToCamera = (mProperties.viewOrigin - boundingBox.getCenter()).length();
 
+			if (streamTextures)
+				reportTextureUsage(*renderElem.material, getTexelScreenSize(bounds.getSphere()));
+
 			// Check if viewer is inside the decal volume
 
 			// Extend the bounds slighty to cover the case when the viewer is outside, but the near plane is intersecting
@@ -616,12 +681,39 @@ namespace bs { namespace ct
 				mDecalQueue->add(&renderElem, distanceToCamera, techniqueIndices[(INT32)MSAAMode::Full]);
 		}
 
+		// Skybox
+		if (streamTextures && sceneInfo.skybox != nullptr && mRenderSettings->enableSkybox)
+		{
+			const SPtr<Texture>& skyTexture = sceneInfo.skybox->getTexture();
+			if (skyTexture != nullptr && skyTexture->getStreamingId() != 0)
+			{
+				// A cube face covers a 90 degree field of view, and is scaled by the projection the same as the view
+				const float faceScreenSize = mProperties.projTransform[1][1] * mProperties.target.viewRect.height;
+				TextureStreamingManager::instance().notifyUsage(skyTexture->getStreamingId(), faceScreenSize);
+			}
+		}
+
 		mForwardOpaqueQueue->sort();
 		mDeferredOpaqueQueue->sort();
 		mTransparentQueue->sort();
 		mDecalQueue->sort();
 	}
 
+	float RendererView::getScreenSize(const Sphere& bounds) const
+	{
+		// Projection matrix scales the vertical axis so it maps the view to the [-1, 1] range
+		const float projScale = mProperties.projTransform[1][1];
+
+		if (mProperties.projType == PT_ORTHOGRAPHIC)
+			return bounds.getRadius() * projScale;
+
+		const float distance = (bounds.getCenter() - mProperties.viewOrigin).length();
+		if (distance <= bounds.getRadius())
+			return std::numeric_limits<float>::infinity();
+
+		return bounds.getRadius() * projScale / distance;
+	}
+
 	Vector2 RendererView::getDeviceZToViewZ(const Matrix4& projMatrix)
 	{
 		// Returns a set of values that will transform depth buffer values (in range [0, 1]) to a distance
@@ -833,9 +925,10 @@ namespace bs { namespace ct
 	}
 
 	void RendererView::updateLightGrid(const VisibleLightData& visibleLightData,
-		const VisibleReflProbeData& visibleReflProbeData)
+		const VisibleReflProbeData& visibleReflProbeData, bool cpuBinning)
 	{
-		mLightGrid.updateGrid(*this, visibleLightData, visibleReflProbeData, !mRenderSettings->enableLighting);
+		mLightGrid.updateGrid(*this, visibleLightData, visibleReflProbeData, !mRenderSettings->enableLighting,
+			cpuBinning);
 	}
 
 	RendererViewGroup::RendererViewGroup(RendererView** views, UINT32 numViews, bool mainPass, UINT32 shadowMapSize)
@@ -951,7 +1044,7 @@ namespace bs { namespace ct
 				if (!mViews[i]->shouldDraw3D())
 					continue;
 
-				mViews[i]->updateLightGrid(mVisibleLightData, mVisibleReflProbeData);
+				mViews[i]->updateLightGrid(mVisibleLightData, mVisibleReflProbeData, mCpuLightGridBinning);
 			}
 		}
 	}
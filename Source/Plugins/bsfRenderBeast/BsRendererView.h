@@ -388,6 +388,19 @@ namespace bs { namespace ct
 		 */
 		void queueRenderElements(const SceneInfo& sceneInfo);
 
+		/**
+		 * Returns the diameter of the provided sphere when projected by this view, relative to the viewport height.
+		 * Used for selecting the level of detail to render meshes with. Returns infinity if the viewer is inside the
+		 * sphere.
+		 */
+		float getScreenSize(const Sphere& bounds) const;
+
+		/**
+		 * Returns the size in pixels that textures applied to an object with the provided bounds appear at on screen.
+		 * Reported to the TextureStreamingManager to pick the mip levels to keep resident.
+		 */
+		float getTexelScreenSize(const Sphere& bounds) const;
+
 		/** Returns the visibility mask calculated with the last call to determineVisible(). */
 		const VisibilityInfo& getVisibilityMasks() const { return mVisibility; }
 
@@ -412,8 +425,12 @@ namespace bs { namespace ct
 		 */
 		const LightGrid& getLightGrid() const { return mLightGrid; }
 
-		/** Updates the light grid used for forward rendering. */
-		void updateLightGrid(const VisibleLightData& visibleLightData, const VisibleReflProbeData& visibleReflProbeData);
+		/**
+		 * Updates the light grid used for forward rendering. If @p cpuBinning is true the grid is populated on the CPU,
+		 * otherwise a compute shader is used.
+		 */
+		void updateLightGrid(const VisibleLightData& visibleLightData, const VisibleReflProbeData& visibleReflProbeData,
+			bool cpuBinning);
 
 		/** Returns a context that reflects the state of the view as it changes during rendering. */
 		const RendererViewContext& getContext() const { return mContext; }
@@ -471,8 +488,9 @@ namespace bs { namespace ct
 		void _notifyCompositorTargetChanged(const SPtr<RenderTarget>& target) const { mContext.currentTarget = target; }
 
 		/**
-		 * Notifies the view that a new average luminance is being calculated on the provided command buffer. The results
-		 * will be read from the provided texture when the command buffer finishes executing.
+		 * Notifies the view that a new average luminance is being calculated on the provided command buffer. A readback
+		 * of the provided texture is queued on the same command buffer, and the result is picked up by
+		 * updateAsyncOperations() once the GPU finishes the readback.
 		 */
 		void _notifyLuminanceUpdated(UINT64 frameIdx, SPtr<CommandBuffer> cb, SPtr<PooledRenderTexture> texture) const;
 		
@@ -504,13 +522,12 @@ namespace bs { namespace ct
 	private:
 		struct LuminanceUpdate
 		{
-			LuminanceUpdate(UINT64 frameIdx, SPtr<CommandBuffer> commandBuffer, SPtr<PooledRenderTexture> outputTexture)
-				: frameIdx(frameIdx), commandBuffer(std::move(commandBuffer)), outputTexture(std::move(outputTexture))
+			LuminanceUpdate(UINT64 frameIdx, TAsyncOp<SPtr<PixelData>> readback)
+				: frameIdx(frameIdx), readback(std::move(readback))
 			{ }
 
 			UINT64 frameIdx;
-			SPtr<CommandBuffer> commandBuffer;
-			SPtr<PooledRenderTexture> outputTexture;
+			TAsyncOp<SPtr<PixelData>> readback;
 		};
 		
 		RendererViewProperties mProperties;
@@ -596,6 +613,12 @@ namespace bs { namespace ct
 		/** Returns the object responsible for rendering shadows for this view group. */
 		const ShadowRendering& getShadowRenderer() const { return mShadowRenderer; }
 
+		/**
+		 * Determines should lights and reflection probes be assigned to the light grid of each view on the CPU, instead
+		 * of in a compute shader. See RenderBeastOptions::cpuLightGridBinning.
+		 */
+		void setCpuLightGridBinning(bool enable) { mCpuLightGridBinning = enable; }
+
 		/**
 		 * Updates visibility information for the provided scene objects, from the perspective of all views in this group,
 		 * and updates the render queues of each individual view. Use getVisibilityInfo() to retrieve the calculated
@@ -607,6 +630,7 @@ namespace bs { namespace ct
 		Vector<RendererView*> mViews;
 		VisibilityInfo mVisibility;
 		bool mIsMainPass = false;
+		bool mCpuLightGridBinning = false;
 
 		VisibleLightData mVisibleLightData;
 		VisibleReflProbeData mVisibleReflProbeData;
@@ -34,6 +34,7 @@ set(BS_RENDERBEAST_INC_SHADING
 	"Shading/BsTiledDeferred.h"
 	"Shading/BsStandardDeferred.h"
 	"Shading/BsLightGrid.h"
+	"Shading/BsLightGridBinner.h"
 	"Shading/BsLightProbes.h"
 	"Shading/BsShadowRendering.h"
 	"Shading/BsPostProcessing.h"
@@ -44,6 +45,7 @@ set(BS_RENDERBEAST_SRC_SHADING
 	"Shading/BsTiledDeferred.cpp"
 	"Shading/BsStandardDeferred.cpp"
 	"Shading/BsLightGrid.cpp"
+	"Shading/BsLightGridBinner.cpp"
 	"Shading/BsLightProbes.cpp"
 	"Shading/BsShadowRendering.cpp"
 	"Shading/BsPostProcessing.cpp"
@@ -241,7 +241,7 @@ namespace bs { namespace ct
 	}
 
 	void LightGrid::updateGrid(const RendererView& view, const VisibleLightData& lightData, const VisibleReflProbeData& probeData,
-		bool noLighting)
+		bool noLighting, bool cpuBinning)
 	{
 		const RendererViewProperties& viewProps = view.getProperties();
 
@@ -286,6 +286,13 @@ namespace bs { namespace ct
 		gLightGridParamDefDef.gMaxNumLightsPerCell.set(mGridParamBuffer, MAX_LIGHTS_PER_CELL);
 		gLightGridParamDefDef.gGridPixelSize.set(mGridParamBuffer, Vector2I(CELL_XY_SIZE, CELL_XY_SIZE));
 
+		mUsedCPUBinning = cpuBinning;
+		if(cpuBinning)
+		{
+			binOnCPU(view, gridSize, lightData, probeData, noLighting);
+			return;
+		}
+
 		LightGridLLCreationMat* creationMat = LightGridLLCreationMat::get();
 		creationMat->setParams(gridSize, mGridParamBuffer, lightData.getLightBuffer(), probeData.getProbeBuffer());
 		creationMat->execute(view);
@@ -301,17 +308,79 @@ namespace bs { namespace ct
 		reductionMat->execute(view);
 	}
 
+	void LightGrid::binOnCPU(const RendererView& view, const Vector3I& gridSize, const VisibleLightData& lightData,
+		const VisibleReflProbeData& probeData, bool noLighting)
+	{
+		const RendererViewProperties& viewProps = view.getProperties();
+		mBinner.setGrid(gridSize, viewProps.projTransform, viewProps.nearPlane, viewProps.farPlane);
+
+		UINT32 numDirLights = 0;
+		UINT32 numRadialLights = 0;
+		UINT32 numSpotLights = 0;
+		if (!noLighting)
+		{
+			numDirLights = lightData.getNumDirLights();
+			numRadialLights = lightData.getNumRadialLights();
+			numSpotLights = lightData.getNumSpotLights();
+		}
+
+		const UINT32 numProbes = probeData.getNumProbes();
+		const ReflProbeData* probes = numProbes > 0 ? &probeData.getProbeData(0) : nullptr;
+
+		mBinner.bin(viewProps.viewTransform, lightData.getLightData().data(), numDirLights, numRadialLights,
+			numSpotLights, probes, numProbes, MAX_LIGHTS_PER_CELL, mLinkedLists);
+		LightGridBinner::reduce(mLinkedLists, mCellData);
+
+		const UINT32 numCells = gridSize[0] * gridSize[1] * gridSize[2];
+		uploadBuffer(mGridLightOffsetAndSize, BF_32X4U, mCellData.lightOffsetsAndSize.data(), numCells);
+		uploadBuffer(mGridLightIndices, BF_32X1U, mCellData.lightIndices.data(),
+			(UINT32)mCellData.lightIndices.size());
+		uploadBuffer(mGridProbeOffsetAndSize, BF_32X2U, mCellData.probeOffsetsAndSize.data(), numCells);
+		uploadBuffer(mGridProbeIndices, BF_32X1U, mCellData.probeIndices.data(),
+			(UINT32)mCellData.probeIndices.size());
+	}
+
+	void LightGrid::uploadBuffer(SPtr<GpuBuffer>& buffer, GpuBufferFormat format, const UINT32* data,
+		UINT32 numElements)
+	{
+		if (buffer == nullptr || buffer->getProperties().getElementCount() < numElements)
+		{
+			// Allocate at least one element even if empty, to avoid issues with null buffers
+			GPU_BUFFER_DESC desc;
+			desc.elementCount = std::max(numElements, 1U);
+			desc.format = format;
+			desc.usage = GBU_DYNAMIC;
+			desc.type = GBT_STANDARD;
+			desc.elementSize = 0;
+
+			buffer = GpuBuffer::create(desc);
+		}
+
+		if (numElements > 0)
+			buffer->writeData(0, numElements * bs::GpuBuffer::getFormatSize(format), data, BWT_DISCARD);
+	}
+
 	LightGridOutputs LightGrid::getOutputs() const
 	{
 		LightGridOutputs outputs;
 
-		LightGridLLReductionMat* reductionMat = LightGridLLReductionMat::get();
-		reductionMat->getOutputs(
-			outputs.gridLightOffsetsAndSize,
-			outputs.gridLightIndices,
-			outputs.gridProbeOffsetsAndSize,
-			outputs.gridProbeIndices
-		);
+		if (mUsedCPUBinning)
+		{
+			outputs.gridLightOffsetsAndSize = mGridLightOffsetAndSize;
+			outputs.gridLightIndices = mGridLightIndices;
+			outputs.gridProbeOffsetsAndSize = mGridProbeOffsetAndSize;
+			outputs.gridProbeIndices = mGridProbeIndices;
+		}
+		else
+		{
+			LightGridLLReductionMat* reductionMat = LightGridLLReductionMat::get();
+			reductionMat->getOutputs(
+				outputs.gridLightOffsetsAndSize,
+				outputs.gridLightIndices,
+				outputs.gridProbeOffsetsAndSize,
+				outputs.gridProbeIndices
+			);
+		}
 
 		outputs.gridParams = mGridParamBuffer;
 
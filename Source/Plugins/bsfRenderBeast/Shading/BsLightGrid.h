@@ -5,6 +5,7 @@
 #include "BsRenderBeastPrerequisites.h"
 #include "Renderer/BsRendererMaterial.h"
 #include "Renderer/BsParamBlocks.h"
+#include "Shading/BsLightGridBinner.h"
 
 namespace bs { namespace ct
 {
@@ -157,9 +158,13 @@ namespace bs { namespace ct
 	public:
 		LightGrid();
 
-		/** Updates the light grid from the provided view. */
+		/**
+		 * Updates the light grid from the provided view. If @p cpuBinning is true the grid is populated on the CPU using
+		 * LightGridBinner and uploaded, otherwise it is populated using LightGridLLCreationMat and
+		 * LightGridLLReductionMat.
+		 */
 		void updateGrid(const RendererView& view, const VisibleLightData& lightData, const VisibleReflProbeData& probeData,
-			bool noLighting);
+			bool noLighting, bool cpuBinning = false);
 
 		/**
 		 * Returns the buffers containing light indices per grid cell and global grid parameters. This data gets Updated on
@@ -168,7 +173,29 @@ namespace bs { namespace ct
 		LightGridOutputs getOutputs() const;
 
 	private:
+		/** Populates the grid on the CPU and uploads the results into the CPU path buffers. */
+		void binOnCPU(const RendererView& view, const Vector3I& gridSize, const VisibleLightData& lightData,
+			const VisibleReflProbeData& probeData, bool noLighting);
+
+		/**
+		 * Makes sure @p buffer can hold at least @p numElements of the specified format, and fills it with the provided
+		 * data.
+		 */
+		static void uploadBuffer(SPtr<GpuBuffer>& buffer, GpuBufferFormat format, const UINT32* data,
+			UINT32 numElements);
+
 		SPtr<GpuParamBlockBuffer> mGridParamBuffer;
+
+		// CPU binning
+		bool mUsedCPUBinning = false;
+		LightGridBinner mBinner;
+		LightGridLinkedLists mLinkedLists;
+		LightGridCellData mCellData;
+
+		SPtr<GpuBuffer> mGridLightOffsetAndSize;
+		SPtr<GpuBuffer> mGridLightIndices;
+		SPtr<GpuBuffer> mGridProbeOffsetAndSize;
+		SPtr<GpuBuffer> mGridProbeIndices;
 	};
 
 	/** @} */
@@ -0,0 +1,568 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#include "BsLightGridBinner.h"
+#include "Math/BsSIMD.h"
+#include "Threading/BsTaskScheduler.h"
+#include "BsRendererLight.h"
+#include "BsRendererReflectionProbe.h"
+
+namespace bs { namespace ct
+{
+	/** Maximum number of tasks to split the grid slices between. */
+	static constexpr UINT32 MAX_NUM_TASKS = 8;
+
+	/** Minimum number of lights and probes for binning to be split between worker threads. */
+	static constexpr UINT32 MIN_ITEMS_PER_TASK = 64;
+
+	/** Minimum number of links for the reduction to be split between worker threads. */
+	static constexpr UINT32 MIN_LINKS_PER_TASK = 4096;
+
+	/** Maximum number of cells processed by a single reduction task. */
+	static constexpr UINT32 REDUCE_CELLS_PER_TASK = 2048;
+
+	/** Center of the padding cells, chosen so they never intersect anything. */
+	static constexpr float PADDING_CELL_CENTER = 1e18f;
+
+	constexpr UINT32 LightGridBinner::NO_LINK;
+
+	/** Executes the worker for each index in [0, count), on worker threads if there is more than one. */
+	static void runTasks(const String& name, UINT32 count, const std::function<void(UINT32)>& worker)
+	{
+		if(count > 1)
+		{
+			SPtr<TaskGroup> taskGroup = TaskGroup::create(name, worker, count, TaskPriority::High);
+
+			TaskScheduler::instance().addTaskGroup(taskGroup);
+			taskGroup->wait();
+		}
+		else
+		{
+			for(UINT32 i = 0; i < count; i++)
+				worker(i);
+		}
+	}
+
+	void LightGridBinner::setGrid(const Vector3I& gridSize, const Matrix4& projTransform, float nearPlane,
+		float farPlane)
+	{
+		if(gridSize == mGridSize && projTransform == mProjTransform && nearPlane == mNearPlane && farPlane == mFarPlane)
+			return;
+
+		mGridSize = gridSize;
+		mProjTransform = projTransform;
+		mNearPlane = nearPlane;
+		mFarPlane = farPlane;
+
+		const UINT32 width = (UINT32)gridSize[0];
+		const UINT32 height = (UINT32)gridSize[1];
+		const UINT32 depth = (UINT32)gridSize[2];
+
+		mRowStride = Math::divideAndRoundUp(width, 4U) * 4;
+		const UINT32 numPaddedCells = mRowStride * height * depth;
+
+		for(UINT32 i = 0; i < 3; i++)
+		{
+			mCellCenters[i].assign(numPaddedCells, PADDING_CELL_CENTER);
+			mCellExtents[i].assign(numPaddedCells, 0.0f);
+		}
+
+		mCellRadius.assign(numPaddedCells, 0.0f);
+
+		mColumnMin.assign(width * depth, std::numeric_limits<float>::max());
+		mColumnMax.assign(width * depth, -std::numeric_limits<float>::max());
+		mRowMin.assign(height * depth, std::numeric_limits<float>::max());
+		mRowMax.assign(height * depth, -std::numeric_limits<float>::max());
+
+		// Matches calcCellAABB() in LightGridLLCreation.bsl. Bounds are calculated by transforming the corners of each
+		// cell from NDC to view space.
+		const Matrix4 invProj = projTransform.inverse();
+		const float flipY = projTransform[1][1] < 0.0f ? 1.0f : -1.0f;
+		const float depthScale = (farPlane - nearPlane) / (float)(depth * depth);
+
+		auto calcViewZ = [nearPlane, depthScale](UINT32 cellZ)
+		{
+			return -((float)(cellZ * cellZ) * depthScale + nearPlane);
+		};
+
+		auto calcNDCZ = [&projTransform](float viewZ)
+		{
+			const Vector4 clip = projTransform.multiply(Vector4(0.0f, 0.0f, viewZ, 1.0f));
+			return clip.z / clip.w;
+		};
+
+		for(UINT32 z = 0; z < depth; z++)
+		{
+			// Because we're viewing along negative Z, farther end is the minimum
+			const float viewZMin = calcViewZ(z + 1);
+			const float viewZMax = calcViewZ(z);
+
+			const float ndcZ[2] = { calcNDCZ(viewZMax), calcNDCZ(viewZMin) };
+
+			for(UINT32 y = 0; y < height; y++)
+			{
+				const float ndcY[2] =
+				{
+					((float)y * 2.0f / height - 1.0f) * flipY,
+					((float)(y + 1) * 2.0f / height - 1.0f) * flipY
+				};
+
+				for(UINT32 x = 0; x < width; x++)
+				{
+					const float ndcX[2] =
+					{
+						(float)x * 2.0f / width - 1.0f,
+						(float)(x + 1) * 2.0f / width - 1.0f
+					};
+
+					Vector2 viewMin(std::numeric_limits<float>::max(), std::numeric_limits<float>::max());
+					Vector2 viewMax(-std::numeric_limits<float>::max(), -std::numeric_limits<float>::max());
+					for(UINT32 i = 0; i < 8; i++)
+					{
+						Vector4 corner = invProj.multiply(Vector4(ndcX[i & 1], ndcY[(i >> 1) & 1], ndcZ[i >> 2], 1.0f));
+						corner.x /= corner.w;
+						corner.y /= corner.w;
+
+						viewMin.x = std::min(viewMin.x, corner.x);
+						viewMin.y = std::min(viewMin.y, corner.y);
+						viewMax.x = std::max(viewMax.x, corner.x);
+						viewMax.y = std::max(viewMax.y, corner.y);
+					}
+
+					const Vector3 extent = (Vector3(viewMax.x, viewMax.y, viewZMax) -
+						Vector3(viewMin.x, viewMin.y, viewZMin)) * 0.5f;
+					const Vector3 center = Vector3(viewMin.x, viewMin.y, viewZMin) + extent;
+
+					const UINT32 cellIdx = (z * height + y) * mRowStride + x;
+					for(UINT32 i = 0; i < 3; i++)
+					{
+						mCellCenters[i][cellIdx] = center[i];
+						mCellExtents[i][cellIdx] = extent[i];
+					}
+
+					mCellRadius[cellIdx] = extent.length();
+
+					UINT32 columnIdx = z * width + x;
+					mColumnMin[columnIdx] = std::min(mColumnMin[columnIdx], viewMin.x);
+					mColumnMax[columnIdx] = std::max(mColumnMax[columnIdx], viewMax.x);
+
+					UINT32 rowIdx = z * height + y;
+					mRowMin[rowIdx] = std::min(mRowMin[rowIdx], viewMin.y);
+					mRowMax[rowIdx] = std::max(mRowMax[rowIdx], viewMax.y);
+				}
+			}
+		}
+	}
+
+	bool LightGridBinner::findSlices(float minDepth, float maxDepth, UINT32& firstSlice, UINT32& lastSlice) const
+	{
+		if(maxDepth < mNearPlane || minDepth > mFarPlane)
+			return false;
+
+		// Inverse of the quadratic slice distribution, see calcViewZFromCellZ() in LightGridCommon.bslinc. A small
+		// tolerance is added since bounds of the neighbouring slices touch.
+		const auto numSlices = (UINT32)mGridSize[2];
+		const float scale = (float)(numSlices * numSlices) / (mFarPlane - mNearPlane);
+
+		const float first = std::sqrt(std::max(minDepth - mNearPlane, 0.0f) * scale) - 0.001f;
+		const float last = std::sqrt(std::max(maxDepth - mNearPlane, 0.0f) * scale) + 0.001f;
+
+		firstSlice = (UINT32)std::max(Math::floorToInt(first), 0);
+		lastSlice = std::min((UINT32)Math::floorToInt(last), numSlices - 1);
+
+		return firstSlice <= lastSlice;
+	}
+
+	void LightGridBinner::bin(const Matrix4& viewTransform, const LightData* lights, UINT32 numDirLights,
+		UINT32 numRadialLights, UINT32 numSpotLights, const ReflProbeData* probes, UINT32 numProbes,
+		UINT32 maxLinksPerCell, LightGridLinkedLists& output)
+	{
+		const auto numSlices = (UINT32)mGridSize[2];
+		const UINT32 numCellsPerSlice = mGridSize[0] * mGridSize[1];
+		const UINT32 numCells = numCellsPerSlice * numSlices;
+
+		output.lightHeads.assign(numCells, NO_LINK);
+		output.lightLinks.clear();
+		output.probeHeads.assign(numCells, NO_LINK);
+		output.probeLinks.clear();
+
+		if(numCells == 0)
+			return;
+
+		// Transform lights and probes to view space and determine which slices they overlap
+		mLights.clear();
+		for(UINT32 i = 0; i < numRadialLights + numSpotLights; i++)
+		{
+			const UINT32 lightIdx = numDirLights + i;
+			const LightData& light = lights[lightIdx];
+			const bool isSpot = i >= numRadialLights;
+
+			BinnedItem item;
+			item.index = lightIdx;
+			item.type = isSpot ? 2 : 1;
+
+			const float attRadius = 1.0f / std::sqrt(light.attRadiusSqrdInv);
+			if(isSpot)
+			{
+				// Cone starts at the shifted position for area spot lights, so it encloses the light's disc
+				item.coneOrigin = viewTransform.multiplyAffine(light.shiftedLightPosition);
+				item.coneDirection = Vector3::normalize(viewTransform.multiplyDirection(light.direction));
+				item.coneCos = Math::cos(light.spotAngles.x);
+				item.coneSin = Math::sin(light.spotAngles.x);
+				item.coneRange = attRadius + light.position.distance(light.shiftedLightPosition);
+
+				// Use the smallest sphere enclosing the cone, instead of the light bounds which are loose for narrow
+				// and wide cones
+				if(item.coneCos > Math::INV_SQRT2)
+				{
+					item.radius = item.coneRange / (2.0f * item.coneCos);
+					item.position = item.coneOrigin + item.coneDirection * item.radius;
+				}
+				else
+				{
+					item.radius = item.coneRange * item.coneSin;
+					item.position = item.coneOrigin + item.coneDirection * (item.coneRange * item.coneCos);
+				}
+			}
+			else
+			{
+				item.radius = light.boundsRadius;
+				item.position = viewTransform.multiplyAffine(light.position);
+			}
+
+			const float depth = -item.position.z;
+			if(!findSlices(depth - item.radius, depth + item.radius, item.firstSlice, item.lastSlice))
+				continue;
+
+			mLights.push_back(item);
+		}
+
+		mProbes.clear();
+		for(UINT32 i = 0; i < numProbes; i++)
+		{
+			BinnedItem item;
+			item.index = i;
+			item.type = 0;
+			item.radius = probes[i].radius;
+			item.position = viewTransform.multiplyAffine(probes[i].position);
+
+			const float depth = -item.position.z;
+			if(!findSlices(depth - item.radius, depth + item.radius, item.firstSlice, item.lastSlice))
+				continue;
+
+			mProbes.push_back(item);
+		}
+
+		// Each task processes an interleaved set of slices, so that slices close to the camera, which are smaller and
+		// usually contain fewer items, are evenly distributed. Tasks write heads only for cells in their own slices,
+		// and link indices are local to the task until all tasks complete.
+		const UINT32 numItems = (UINT32)(mLights.size() + mProbes.size());
+		UINT32 numTasks = 1;
+		if(TaskScheduler::isStarted())
+			numTasks = Math::clamp(numItems / MIN_ITEMS_PER_TASK, 1U, std::min(MAX_NUM_TASKS, numSlices));
+
+		mTaskOutputs.resize(numTasks);
+
+		auto worker = [this, numTasks, numCellsPerSlice, numSlices, maxLinksPerCell, &output](UINT32 taskIdx)
+		{
+			TaskOutput& taskOutput = mTaskOutputs[taskIdx];
+			taskOutput.lightLinks.clear();
+			taskOutput.probeLinks.clear();
+
+			const UINT32 numTaskSlices = Math::divideAndRoundUp(numSlices - taskIdx, numTasks);
+			const UINT32 maxLinks = numTaskSlices * numCellsPerSlice * maxLinksPerCell;
+
+			auto binItems = [this, taskIdx, numTasks, maxLinks, &taskOutput, &output](const Vector<BinnedItem>& items,
+				bool lights)
+			{
+				for(auto& item : items)
+				{
+					// First slice at or after the item's first slice that belongs to this task
+					UINT32 slice = item.firstSlice + (taskIdx + numTasks - item.firstSlice % numTasks) % numTasks;
+					for(; slice <= item.lastSlice; slice += numTasks)
+						binItem(item, slice, lights, maxLinks, taskOutput, output);
+				}
+			};
+
+			binItems(mLights, true);
+			binItems(mProbes, false);
+		};
+
+		runTasks("LightGridBinning", numTasks, worker);
+
+		// Merge the task outputs, offsetting task-local link indices
+		for(UINT32 taskIdx = 0; taskIdx < numTasks; taskIdx++)
+		{
+			const TaskOutput& taskOutput = mTaskOutputs[taskIdx];
+			const auto lightOffset = (UINT32)output.lightLinks.size();
+			const auto probeOffset = (UINT32)output.probeLinks.size();
+
+			for(UINT32 slice = taskIdx; slice < numSlices; slice += numTasks)
+			{
+				for(UINT32 i = slice * numCellsPerSlice; i < (slice + 1) * numCellsPerSlice; i++)
+				{
+					if(output.lightHeads[i] != NO_LINK)
+						output.lightHeads[i] += lightOffset;
+
+					if(output.probeHeads[i] != NO_LINK)
+						output.probeHeads[i] += probeOffset;
+				}
+			}
+
+			for(auto& entry : taskOutput.lightLinks)
+			{
+				output.lightLinks.push_back(entry);
+				if(entry.next != NO_LINK)
+					output.lightLinks.back().next += lightOffset;
+			}
+
+			for(auto& entry : taskOutput.probeLinks)
+			{
+				output.probeLinks.push_back(entry);
+				if(entry.next != NO_LINK)
+					output.probeLinks.back().next += probeOffset;
+			}
+		}
+	}
+
+	void LightGridBinner::binItem(const BinnedItem& item, UINT32 slice, bool lights, UINT32 maxLinks,
+		TaskOutput& taskOutput, LightGridLinkedLists& output) const
+	{
+		const auto width = (UINT32)mGridSize[0];
+		const auto height = (UINT32)mGridSize[1];
+
+		const float* columnMin = &mColumnMin[slice * width];
+		const float* columnMax = &mColumnMax[slice * width];
+		const float* rowMin = &mRowMin[slice * height];
+		const float* rowMax = &mRowMax[slice * height];
+
+		const simd::float32x4 zero = simd::make_float<simd::float32x4>(0.0f);
+
+		// Find the columns and rows whose bounds overlap the item bounds. This is only a conservative estimate (with a
+		// small tolerance), the exact test against each cell's bounds is performed below.
+		const float radius = item.radius * 1.001f;
+
+		UINT32 firstColumn = width;
+		UINT32 lastColumn = 0;
+		for(UINT32 x = 0; x < width; x++)
+		{
+			if(columnMax[x] >= item.position.x - radius && columnMin[x] <= item.position.x + radius)
+			{
+				firstColumn = std::min(firstColumn, x);
+				lastColumn = x;
+			}
+		}
+
+		if(firstColumn > lastColumn)
+			return;
+
+		UINT32 firstRow = height;
+		UINT32 lastRow = 0;
+		for(UINT32 y = 0; y < height; y++)
+		{
+			if(rowMax[y] >= item.position.y - radius && rowMin[y] <= item.position.y + radius)
+			{
+				firstRow = std::min(firstRow, y);
+				lastRow = y;
+			}
+		}
+
+		if(firstRow > lastRow)
+			return;
+
+		const simd::float32x4 posX = simd::load_splat<simd::float32x4>(&item.position.x);
+		const simd::float32x4 posY = simd::load_splat<simd::float32x4>(&item.position.y);
+		const simd::float32x4 posZ = simd::load_splat<simd::float32x4>(&item.position.z);
+
+		const float radiusSqrd = item.radius * item.radius;
+		const simd::float32x4 radiusSqrdVec = simd::load_splat<simd::float32x4>(&radiusSqrd);
+
+		const bool isSpot = item.type == 2;
+		for(UINT32 y = firstRow; y <= lastRow; y++)
+		{
+			const UINT32 rowStart = (slice * height + y) * mRowStride;
+			const UINT32 cellStart = (slice * height + y) * width;
+
+			// Test four cells at a time. Cells outside of the column range are tested as well, which is fine as the
+			// test is exact, and padding cells never pass it.
+			for(UINT32 x = firstColumn & ~3U; x <= lastColumn; x += 4)
+			{
+				const UINT32 idx = rowStart + x;
+
+				// Sphere vs. box test, same as in LightGridLLCreation.bsl
+				simd::float32x4 centerX = simd::load_u<simd::float32x4>(&mCellCenters[0][idx]);
+				simd::float32x4 centerY = simd::load_u<simd::float32x4>(&mCellCenters[1][idx]);
+				simd::float32x4 centerZ = simd::load_u<simd::float32x4>(&mCellCenters[2][idx]);
+
+				simd::float32x4 distX = simd::abs(simd::sub(posX, centerX));
+				simd::float32x4 distY = simd::abs(simd::sub(posY, centerY));
+				simd::float32x4 distZ = simd::abs(simd::sub(posZ, centerZ));
+
+				distX = simd::max(simd::sub(distX, simd::load_u<simd::float32x4>(&mCellExtents[0][idx])), zero);
+				distY = simd::max(simd::sub(distY, simd::load_u<simd::float32x4>(&mCellExtents[1][idx])), zero);
+				distZ = simd::max(simd::sub(distZ, simd::load_u<simd::float32x4>(&mCellExtents[2][idx])), zero);
+
+				simd::float32x4 distSqrd = simd::add(simd::add(simd::mul(distX, distX), simd::mul(distY, distY)),
+					simd::mul(distZ, distZ));
+
+				simd::uint32x4 mask = simd::bit_cast<simd::uint32x4>(simd::cmp_le(distSqrd, radiusSqrdVec));
+				if(!simd::test_bits_any(mask))
+					continue;
+
+				if(isSpot)
+				{
+					// Cone vs. sphere test, using the cell's bounding sphere
+					simd::float32x4 cellRadius = simd::load_u<simd::float32x4>(&mCellRadius[idx]);
+
+					simd::float32x4 toCellX = simd::sub(centerX, simd::load_splat<simd::float32x4>(&item.coneOrigin.x));
+					simd::float32x4 toCellY = simd::sub(centerY, simd::load_splat<simd::float32x4>(&item.coneOrigin.y));
+					simd::float32x4 toCellZ = simd::sub(centerZ, simd::load_splat<simd::float32x4>(&item.coneOrigin.z));
+
+					simd::float32x4 lengthSqrd = simd::add(simd::add(simd::mul(toCellX, toCellX),
+						simd::mul(toCellY, toCellY)), simd::mul(toCellZ, toCellZ));
+
+					// Distance along the cone axis
+					simd::float32x4 axisDist = simd::add(simd::add(
+						simd::mul(toCellX, simd::load_splat<simd::float32x4>(&item.coneDirection.x)),
+						simd::mul(toCellY, simd::load_splat<simd::float32x4>(&item.coneDirection.y))),
+						simd::mul(toCellZ, simd::load_splat<simd::float32x4>(&item.coneDirection.z)));
+
+					// Distance from the cone surface
+					simd::float32x4 perpDist = simd::sqrt(simd::max(
+						simd::sub(lengthSqrd, simd::mul(axisDist, axisDist)), zero));
+					simd::float32x4 coneDist = simd::sub(
+						simd::mul(perpDist, simd::load_splat<simd::float32x4>(&item.coneCos)),
+						simd::mul(axisDist, simd::load_splat<simd::float32x4>(&item.coneSin)));
+
+					simd::float32x4 maxAxisDist = simd::add(cellRadius,
+						simd::load_splat<simd::float32x4>(&item.coneRange));
+
+					simd::uint32x4 culled = simd::bit_or(simd::bit_or(
+						simd::bit_cast<simd::uint32x4>(simd::cmp_gt(coneDist, cellRadius)),
+						simd::bit_cast<simd::uint32x4>(simd::cmp_gt(axisDist, maxAxisDist))),
+						simd::bit_cast<simd::uint32x4>(simd::cmp_lt(axisDist, simd::neg(cellRadius))));
+
+					mask = simd::bit_andnot(mask, culled);
+					if(!simd::test_bits_any(mask))
+						continue;
+				}
+
+				SIMDPP_ALIGN(16) UINT32 passed[4];
+				simd::store(passed, mask);
+
+				for(UINT32 i = 0; i < 4; i++)
+				{
+					if(passed[i] == 0)
+						continue;
+
+					const UINT32 cellIdx = cellStart + x + i;
+					if(lights)
+					{
+						if(taskOutput.lightLinks.size() >= maxLinks)
+							continue;
+
+						UINT32& head = output.lightHeads[cellIdx];
+						taskOutput.lightLinks.push_back({ item.index, item.type, head, 0 });
+						head = (UINT32)taskOutput.lightLinks.size() - 1;
+					}
+					else
+					{
+						if(taskOutput.probeLinks.size() >= maxLinks)
+							continue;
+
+						UINT32& head = output.probeHeads[cellIdx];
+						taskOutput.probeLinks.push_back({ item.index, head });
+						head = (UINT32)taskOutput.probeLinks.size() - 1;
+					}
+				}
+			}
+		}
+	}
+
+	void LightGridBinner::reduce(const LightGridLinkedLists& lists, LightGridCellData& output)
+	{
+		const auto numCells = (UINT32)lists.lightHeads.size();
+
+		output.lightOffsetsAndSize.resize(numCells * 4);
+		output.lightIndices.resize(lists.lightLinks.size());
+		output.probeOffsetsAndSize.resize(numCells * 2);
+		output.probeIndices.resize(lists.probeLinks.size());
+
+		UINT32 numTasks = 1;
+		if(TaskScheduler::isStarted() && lists.lightLinks.size() + lists.probeLinks.size() >= MIN_LINKS_PER_TASK)
+			numTasks = std::max(Math::divideAndRoundUp(numCells, REDUCE_CELLS_PER_TASK), 1U);
+
+		const UINT32 cellsPerTask = Math::divideAndRoundUp(numCells, numTasks);
+
+		// Count the entries in each cell
+		auto countWorker = [numCells, cellsPerTask, &lists, &output](UINT32 taskIdx)
+		{
+			const UINT32 end = std::min((taskIdx + 1) * cellsPerTask, numCells);
+			for(UINT32 i = taskIdx * cellsPerTask; i < end; i++)
+			{
+				UINT32 numRadialLights = 0;
+				UINT32 numSpotLights = 0;
+				for(UINT32 link = lists.lightHeads[i]; link != NO_LINK; link = lists.lightLinks[link].next)
+				{
+					if(lists.lightLinks[link].type == 1)
+						numRadialLights++;
+					else
+						numSpotLights++;
+				}
+
+				output.lightOffsetsAndSize[i * 4 + 1] = numRadialLights;
+				output.lightOffsetsAndSize[i * 4 + 2] = numSpotLights;
+				output.lightOffsetsAndSize[i * 4 + 3] = 0;
+
+				UINT32 numProbes = 0;
+				for(UINT32 link = lists.probeHeads[i]; link != NO_LINK; link = lists.probeLinks[link].next)
+					numProbes++;
+
+				output.probeOffsetsAndSize[i * 2 + 1] = numProbes;
+			}
+		};
+
+		// Write the indices. Lists are formed in reverse, so indices are written in reverse in order to restore the
+		// original order, where radial lights come first.
+		auto writeWorker = [numCells, cellsPerTask, &lists, &output](UINT32 taskIdx)
+		{
+			const UINT32 end = std::min((taskIdx + 1) * cellsPerTask, numCells);
+			for(UINT32 i = taskIdx * cellsPerTask; i < end; i++)
+			{
+				const UINT32* lightRange = &output.lightOffsetsAndSize[i * 4];
+				UINT32 writeIdx = lightRange[0] + lightRange[1] + lightRange[2];
+				for(UINT32 link = lists.lightHeads[i]; link != NO_LINK; link = lists.lightLinks[link].next)
+					output.lightIndices[--writeIdx] = lists.lightLinks[link].index;
+
+				const UINT32* probeRange = &output.probeOffsetsAndSize[i * 2];
+				writeIdx = probeRange[0] + probeRange[1];
+				for(UINT32 link = lists.probeHeads[i]; link != NO_LINK; link = lists.probeLinks[link].next)
+					output.probeIndices[--writeIdx] = lists.probeLinks[link].index;
+			}
+		};
+
+		runTasks("LightGridReduction", numTasks, countWorker);
+
+		UINT32 lightOffset = 0;
+		UINT32 probeOffset = 0;
+		for(UINT32 i = 0; i < numCells; i++)
+		{
+			output.lightOffsetsAndSize[i * 4 + 0] = lightOffset;
+			lightOffset += output.lightOffsetsAndSize[i * 4 + 1] + output.lightOffsetsAndSize[i * 4 + 2];
+
+			output.probeOffsetsAndSize[i * 2 + 0] = probeOffset;
+			probeOffset += output.probeOffsetsAndSize[i * 2 + 1];
+		}
+
+		runTasks("LightGridReduction", numTasks, writeWorker);
+	}
+
+	AABox LightGridBinner::getCellBounds(UINT32 x, UINT32 y, UINT32 z) const
+	{
+		const UINT32 idx = (z * mGridSize[1] + y) * mRowStride + x;
+
+		Vector3 center(mCellCenters[0][idx], mCellCenters[1][idx], mCellCenters[2][idx]);
+		Vector3 extent(mCellExtents[0][idx], mCellExtents[1][idx], mCellExtents[2][idx]);
+
+		return AABox(center - extent, center + extent);
+	}
+}}
@@ -0,0 +1,197 @@
+//************************************ bs::framework - Copyright 2018 Marko Pintera **************************************//
+//*********** Licensed under the MIT license. See LICENSE.md for full terms. This notice is not to be removed. ***********//
+#pragma once
+
+#include "BsRenderBeastPrerequisites.h"
+#include "Math/BsMatrix4.h"
+#include "Math/BsVector3I.h"
+#include "Math/BsAABox.h"
+
+namespace bs { namespace ct
+{
+	struct LightData;
+	struct ReflProbeData;
+
+	/** @addtogroup RenderBeast
+	 *  @{
+	 */
+
+	/** A single entry in a per-cell linked list of lights, in the layout used by LightGridLLCreationMat. */
+	struct LightGridLightLink
+	{
+		/** Index of the light in the light buffer. */
+		UINT32 index;
+
+		/** Type of the light, 1 for radial and 2 for spot lights. */
+		UINT32 type;
+
+		/** Index of the next link in the same cell, or LightGridBinner::NO_LINK if this is the last link. */
+		UINT32 next;
+
+		UINT32 padding;
+	};
+
+	/** A single entry in a per-cell linked list of reflection probes, in the layout used by LightGridLLCreationMat. */
+	struct LightGridProbeLink
+	{
+		/** Index of the reflection probe in the probe buffer. */
+		UINT32 index;
+
+		/** Index of the next link in the same cell, or LightGridBinner::NO_LINK if this is the last link. */
+		UINT32 next;
+	};
+
+	/**
+	 * Linked lists containing lights and reflection probes affecting each light grid cell, as output by
+	 * LightGridLLCreationMat. Cells are indexed as (z * height + y) * width + x.
+	 */
+	struct LightGridLinkedLists
+	{
+		/** Index of the first light link for each cell, or LightGridBinner::NO_LINK if the cell has no lights. */
+		Vector<UINT32> lightHeads;
+
+		/** Light links referenced by @p lightHeads. */
+		Vector<LightGridLightLink> lightLinks;
+
+		/** Index of the first probe link for each cell, or LightGridBinner::NO_LINK if the cell has no probes. */
+		Vector<UINT32> probeHeads;
+
+		/** Probe links referenced by @p probeHeads. */
+		Vector<LightGridProbeLink> probeLinks;
+	};
+
+	/**
+	 * Sequential light and reflection probe indices for each light grid cell, as output by LightGridLLReductionMat and
+	 * described by LightGridOutputs.
+	 */
+	struct LightGridCellData
+	{
+		/** Four entries per cell: offset into @p lightIndices, number of radial lights, number of spot lights and 0. */
+		Vector<UINT32> lightOffsetsAndSize;
+
+		/** Light indices for all cells. Radial lights are placed before spot lights within each cell. */
+		Vector<UINT32> lightIndices;
+
+		/** Two entries per cell: offset into @p probeIndices and number of reflection probes. */
+		Vector<UINT32> probeOffsetsAndSize;
+
+		/** Reflection probe indices for all cells. */
+		Vector<UINT32> probeIndices;
+	};
+
+	/**
+	 * Assigns lights and reflection probes to the cells of the light grid on the CPU, as an alternative to
+	 * LightGridLLCreationMat and LightGridLLReductionMat. Cells are set up the same way as in the shaders: the view
+	 * frustum is split in tiles in screen space and in slices quadratically distributed between the near and the far
+	 * plane, and each cell is represented by a view space bounding box.
+	 *
+	 * Each light is only tested against cells within its depth and screen extents. Light spheres are tested against
+	 * four cells at a time using SIMD, and spot lights are additionally tested against their cone. The grid slices are
+	 * split between worker threads.
+	 */
+	class LightGridBinner
+	{
+	public:
+		/** Value marking the end of a linked list. */
+		static constexpr UINT32 NO_LINK = 0xFFFFFFFF;
+
+		/**
+		 * Sets up the grid cells. Cells are only recalculated if the grid size or the projection changed since the last
+		 * call.
+		 *
+		 * @param[in]	gridSize		Number of cells in X, Y and Z directions.
+		 * @param[in]	projTransform	Projection matrix of the view.
+		 * @param[in]	nearPlane		Distance to the near plane of the view.
+		 * @param[in]	farPlane		Distance to the far plane of the view.
+		 */
+		void setGrid(const Vector3I& gridSize, const Matrix4& projTransform, float nearPlane, float farPlane);
+
+		/**
+		 * Assigns lights and reflection probes to grid cells. setGrid() must be called first.
+		 *
+		 * @param[in]	viewTransform	View matrix of the view.
+		 * @param[in]	lights			Lights in the same layout as the light buffer: directional lights, followed by
+		 *								radial lights, followed by spot lights. Only radial and spot lights are assigned.
+		 * @param[in]	numDirLights	Number of directional lights at the start of @p lights.
+		 * @param[in]	numRadialLights	Number of radial lights following the directional lights.
+		 * @param[in]	numSpotLights	Number of spot lights following the radial lights.
+		 * @param[in]	probes			Reflection probes in the same layout as the reflection probe buffer.
+		 * @param[in]	numProbes		Number of entries in @p probes.
+		 * @param[in]	maxLinksPerCell	Determines the total number of links allowed in each of the lists, equal to
+		 *								this value multiplied by the number of cells. Any links over the limit are
+		 *								dropped.
+		 * @param[out]	output			Per-cell linked lists of lights and reflection probes.
+		 */
+		void bin(const Matrix4& viewTransform, const LightData* lights, UINT32 numDirLights, UINT32 numRadialLights,
+			UINT32 numSpotLights, const ReflProbeData* probes, UINT32 numProbes, UINT32 maxLinksPerCell,
+			LightGridLinkedLists& output);
+
+		/**
+		 * Converts the linked lists output by bin() (or LightGridLLCreationMat) into sequential per-cell arrays, the
+		 * same as LightGridLLReductionMat does.
+		 */
+		static void reduce(const LightGridLinkedLists& lists, LightGridCellData& output);
+
+		/** Returns the view space bounds of the cell at the specified position. Only valid after setGrid(). */
+		AABox getCellBounds(UINT32 x, UINT32 y, UINT32 z) const;
+
+	private:
+		/** Information about a light or a probe, in view space, used during binning. */
+		struct BinnedItem
+		{
+			Vector3 position;
+			float radius;
+			UINT32 index;
+			UINT32 type;
+			UINT32 firstSlice;
+			UINT32 lastSlice;
+
+			// Spot lights only
+			Vector3 coneOrigin;
+			Vector3 coneDirection;
+			float coneCos;
+			float coneSin;
+			float coneRange;
+		};
+
+		/** Links output by a single task, for the slices it processes. */
+		struct TaskOutput
+		{
+			Vector<LightGridLightLink> lightLinks;
+			Vector<LightGridProbeLink> probeLinks;
+		};
+
+		/**
+		 * Determines the range of grid slices overlapping the provided depth range. Returns false if the range doesn't
+		 * overlap any slice.
+		 */
+		bool findSlices(float minDepth, float maxDepth, UINT32& firstSlice, UINT32& lastSlice) const;
+
+		/** Assigns an item to the cells of a single slice, appending the links to the provided task output. */
+		void binItem(const BinnedItem& item, UINT32 slice, bool lights, UINT32 maxLinks, TaskOutput& taskOutput,
+			LightGridLinkedLists& output) const;
+
+		Vector3I mGridSize = Vector3I(0, 0, 0);
+		Matrix4 mProjTransform = Matrix4::ZERO;
+		float mNearPlane = 0.0f;
+		float mFarPlane = 0.0f;
+
+		// Cell bounds, as separate arrays per component. Each row of cells is padded to a multiple of four cells.
+		UINT32 mRowStride = 0;
+		Vector<float> mCellCenters[3];
+		Vector<float> mCellExtents[3];
+		Vector<float> mCellRadius;
+
+		// Union of cell bounds for each column and row in a slice
+		Vector<float> mColumnMin;
+		Vector<float> mColumnMax;
+		Vector<float> mRowMin;
+		Vector<float> mRowMax;
+
+		Vector<BinnedItem> mLights;
+		Vector<BinnedItem> mProbes;
+		Vector<TaskOutput> mTaskOutputs;
+	};
+
+	/** @} */
+}}
@@ -11,6 +11,7 @@
 #include "Renderer/BsRendererUtility.h"
 #include "Renderer/BsSkybox.h"
 #include "Utility/BsRendererTextures.h"
+#include "Threading/BsTaskScheduler.h"
 
 namespace bs { namespace ct
 {
@@ -204,27 +205,17 @@ namespace bs { namespace ct
 		}
 	};
 
-	/** Information about a single tetrahedron, for use on the GPU. */
-	struct TetrahedronDataGPU
-	{
-		UINT32 indices[4];
-		Vector2I offsets[4];
-		Matrix3x4 transform;
-	};
-
-	/** Information about a single tetrahedron face, for use on the GPU. */
-	struct TetrahedronFaceDataGPU
-	{
-		Vector4 corners[3];
-		Vector4 normals[3];
-		UINT32 isQuadratic;
-		float padding[3];
-	};
-
 	LightProbes::LightProbes()
 		:mTetrahedronVolumeDirty(false), mMaxCoefficientRows(0), mMaxTetrahedra(0), mMaxFaces(0), mNumValidTetrahedra(0)
 	{ }
 
+	LightProbes::~LightProbes()
+	{
+		// Worker thread references the tetrahedralization
+		if (mBuild != nullptr)
+			mBuild->task->wait();
+	}
+
 	void LightProbes::notifyAdded(LightProbeVolume* volume)
 	{
 		UINT32 handle = (UINT32)mVolumes.size();
@@ -251,6 +242,13 @@ namespace bs { namespace ct
 	{
 		UINT32 handle = volume->getRendererId();
 
+		// Remove the volume's probes from the tetrahedralization on the next build
+		for (auto& entry : mVolumes[handle].points)
+		{
+			mRemovedPointIds.push_back(entry.second.id);
+			mFreePointIds.push_back(entry.second.id);
+		}
+
 		LightProbeVolume* lastVolume = mVolumes.back().volume;
 		UINT32 lastHandle = lastVolume->getRendererId();
 		
@@ -269,312 +267,347 @@ namespace bs { namespace ct
 
 	void LightProbes::updateProbes()
 	{
-		if (!mTetrahedronVolumeDirty)
-			return;
-
-		// Move all coefficients into the global buffer
-		UINT32 numRows = 0;
-		for(auto& entry : mVolumes)
+		// Keep using the current data until the build running on the worker finishes. Any changes made in the meantime
+		// remain dirty and are handled by the next build.
+		if (mBuild != nullptr)
 		{
-			SPtr<Texture> localTexture = entry.volume->getCoefficientsTexture();
-			numRows += localTexture->getProperties().getHeight();
+			if (!mBuild->task->isComplete())
+				return;
+
+			finishBuild();
 		}
 
-		if(numRows > mMaxCoefficientRows)
-			resizeCoefficientTexture(numRows + 4);
+		if (!mTetrahedronVolumeDirty)
+			return;
 
-		UINT32 rowIdx = 0;
-		for(auto& entry : mVolumes)
-		{
-			TEXTURE_COPY_DESC copyDesc;
-			copyDesc.dstPosition = Vector3I(0, rowIdx, 0);
+		startBuild();
+	}
 
-			SPtr<Texture> localTexture = entry.volume->getCoefficientsTexture();
-			localTexture->copy(mProbeCoefficientsGPU, copyDesc);
-			
-			rowIdx += localTexture->getProperties().getHeight();
-		}
+	void LightProbes::startBuild()
+	{
+		SPtr<TetrahedronBuild> build = bs_shared_ptr_new<TetrahedronBuild>();
+		build->removedPoints = std::move(mRemovedPointIds);
+		mRemovedPointIds.clear();
 
-		// Gather all positions
+		// Find probes that were added, moved or removed since the last build, and the current locations of their
+		// coefficients
+		mUpdateIdx++;
+
+		bool layoutChanged = false;
 		UINT32 bufferOffset = 0;
-		rowIdx = 0;
 		for(auto& entry : mVolumes)
 		{
 			const Vector<LightProbeInfo>& infos = entry.volume->getLightProbeInfos();
 			const Vector<Vector3>& positions = entry.volume->getLightProbePositions();
 
-			UINT32 numProbes = entry.volume->getNumActiveProbes();
-
-			if (numProbes == 0)
-				continue;
+			build->coefficients.push_back(entry.volume->getCoefficientsTexture());
 
-			const Transform& tfrm = entry.volume->getTransform();
-			Vector3 offset = tfrm.getPosition();
-			Quaternion rotation = tfrm.getRotation();
-
-			for (UINT32 i = 0; i < numProbes; i++)
+			UINT32 numProbes = entry.volume->getNumActiveProbes();
+			if (entry.isDirty)
 			{
-				Vector3 localPos = positions[i];
-				Vector3 transformedPos = rotation.rotate(localPos) + offset;
-				mTempTetrahedronPositions.push_back(transformedPos);
+				const Transform& tfrm = entry.volume->getTransform();
+				Vector3 offset = tfrm.getPosition();
+				Quaternion rotation = tfrm.getRotation();
 
-				mTempTetrahedronBufferIndices.push_back(bufferOffset + infos[i].bufferIdx);
+				entry.pointIds.resize(numProbes);
+				for (UINT32 i = 0; i < numProbes; i++)
+				{
+					Vector3 transformedPos = rotation.rotate(positions[i]) + offset;
 
-				Vector2I offset = IBLUtility::getSHCoeffXYFromIdx(infos[i].bufferIdx, 3);
-				mTempTetrahedronBufferOffsets.push_back(offset);
-			}
+					auto iterFind = entry.points.find(infos[i].handle);
+					if (iterFind == entry.points.end())
+					{
+						ProbePoint point;
+						point.position = transformedPos;
 
-			SPtr<Texture> localTexture = entry.volume->getCoefficientsTexture();
-			rowIdx += localTexture->getProperties().getHeight();
-			bufferOffset += (UINT32)positions.size();
-		}
+						if (!mFreePointIds.empty())
+						{
+							point.id = mFreePointIds.back();
+							mFreePointIds.pop_back();
+						}
+						else
+						{
+							point.id = (UINT32)mPointPositions.size();
+
+							mPointPositions.push_back(Vector3::ZERO);
+							mPointBufferIndices.push_back(-1);
+							mPointBufferOffsets.push_back(Vector2I(-1, -1));
+						}
 
-		mTetrahedronInfos.clear();
+						iterFind = entry.points.insert(std::make_pair(infos[i].handle, point)).first;
+						build->addedPoints.push_back(std::make_pair(point.id, transformedPos));
+					}
+					else if (iterFind->second.position != transformedPos)
+					{
+						// Adding an existing point moves it
+						iterFind->second.position = transformedPos;
+						build->addedPoints.push_back(std::make_pair(iterFind->second.id, transformedPos));
+					}
 
-		Vector<TetrahedronFaceData> outerFaces;
-		generateTetrahedronData(mTempTetrahedronPositions, mTetrahedronInfos, outerFaces, true);
+					iterFind->second.updateIdx = mUpdateIdx;
+					entry.pointIds[i] = iterFind->second.id;
+					mPointPositions[iterFind->second.id] = transformedPos;
+				}
 
-		// Find valid tetrahedrons
-		UINT32 numTetrahedra = (UINT32)mTetrahedronInfos.size();
+				// Probes no longer active in the volume
+				for (auto iter = entry.points.begin(); iter != entry.points.end();)
+				{
+					if (iter->second.updateIdx != mUpdateIdx)
+					{
+						build->removedPoints.push_back(iter->second.id);
+						mFreePointIds.push_back(iter->second.id);
 
-		bool* validTets = (bool*)bs_stack_alloc(sizeof(bool) * numTetrahedra);
-		mNumValidTetrahedra = 0;
-		for (UINT32 i = 0; i < (UINT32)mTetrahedronInfos.size(); i++)
-		{
-			const TetrahedronData& entry = mTetrahedronInfos[i];
+						iter = entry.points.erase(iter);
+					}
+					else
+						++iter;
+				}
 
-			const Vector3& P1 = mTempTetrahedronPositions[entry.volume.vertices[0]];
-			const Vector3& P2 = mTempTetrahedronPositions[entry.volume.vertices[1]];
-			const Vector3& P3 = mTempTetrahedronPositions[entry.volume.vertices[2]];
-			const Vector3& P4 = mTempTetrahedronPositions[entry.volume.vertices[3]];
+				entry.isDirty = false;
+			}
 
-			Vector3 E1 = P1 - P4;
-			Vector3 E2 = P2 - P4;
-			Vector3 E3 = P3 - P4;
+			for (UINT32 i = 0; i < numProbes; i++)
+			{
+				const UINT32 pointId = entry.pointIds[i];
+				const UINT32 bufferIdx = bufferOffset + infos[i].bufferIdx;
+				const Vector2I bufferXY = IBLUtility::getSHCoeffXYFromIdx(infos[i].bufferIdx, 3);
 
-			// If tetrahedron is co-planar just ignore it, shader will use some other nearby one instead. We can't
-			// handle coplanar tetrahedrons because the matrix is not invertible, and for nearly co-planar ones the
-			// math breaks down because of precision issues.
-			validTets[i] = fabs(Vector3::dot(Vector3::normalize(Vector3::cross(E1, E2)), E3)) > 0.0001f;
+				if (mPointBufferIndices[pointId] != bufferIdx || mPointBufferOffsets[pointId] != bufferXY)
+				{
+					mPointBufferIndices[pointId] = bufferIdx;
+					mPointBufferOffsets[pointId] = bufferXY;
+					layoutChanged = true;
+				}
+			}
 
-			if (validTets[i])
-				mNumValidTetrahedra++;
+			bufferOffset += (UINT32)positions.size();
 		}
 
-		UINT32 numValidFaces = 0;
-		for(auto& entry : outerFaces)
+		mTetrahedronVolumeDirty = false;
+
+		// If only the coefficients changed, the current tetrahedron data remains valid
+		if (build->addedPoints.empty() && build->removedPoints.empty() && !layoutChanged)
 		{
-			if (validTets[entry.tetrahedron])
-				numValidFaces++;
+			copyCoefficients(build->coefficients);
+			return;
 		}
 
-		// Generate a mesh out of all the tetrahedron triangles
-		// Note: Currently the entire volume is rendered as a single large mesh, which will isn't optimal as we can't
-		// perform frustum culling. A better option would be to split the mesh into multiple smaller volumes, do
-		// frustum culling and possibly even sort by distance from camera.
-		UINT32 numVertices = mNumValidTetrahedra * 4 * 3 + numValidFaces * 9 * 3;
-
-		SPtr<VertexDataDesc> vertexDesc = bs_shared_ptr_new<VertexDataDesc>();
-		vertexDesc->addVertElem(VET_FLOAT3, VES_POSITION);
-		vertexDesc->addVertElem(VET_UINT1, VES_TEXCOORD);
-
-		SPtr<MeshData> meshData = MeshData::create(numVertices, numVertices, vertexDesc);
-		auto posIter = meshData->getVec3DataIter(VES_POSITION);
-		auto idIter = meshData->getDWORDDataIter(VES_TEXCOORD);
-		UINT32* indices = meshData->getIndices32();
+		build->positions = mPointPositions;
+		build->bufferIndices = mPointBufferIndices;
+		build->bufferOffsets = mPointBufferOffsets;
 
-		// Insert inner tetrahedron triangles
-		UINT32 tetIdx = 0;
-		for (UINT32 i = 0; i < (UINT32)mTetrahedronInfos.size(); i++)
+		TetrahedronBuild* buildPtr = build.get();
+		build->task = Task::create("LightProbeTetrahedralization", [this, buildPtr]()
 		{
-			if (!validTets[i])
-				continue;
+			executeBuild(*buildPtr);
+		});
 
-			const Tetrahedron& volume = mTetrahedronInfos[i].volume;
+		mBuild = build;
+		TaskScheduler::instance().addTask(build->task);
+	}
 
-			Vector3 center(BsZero);
-			for(UINT32 j = 0; j < 4; j++)
-				center += mTempTetrahedronPositions[volume.vertices[j]];
+	void LightProbes::executeBuild(TetrahedronBuild& build)
+	{
+		// Apply the changes to the tetrahedralization. Removals go first, as ids of removed points can be reused by
+		// added points.
+		for (auto& entry : build.removedPoints)
+			mTetrahedralization.removePoint(entry);
 
-			center /= 4.0f;
+		for (auto& entry : build.addedPoints)
+			mTetrahedralization.addPoint(entry.first, entry.second);
 
-			static const UINT32 Permutations[4][3] =
-			{
-				{ 0, 1, 2 },
-				{ 0, 1, 3 },
-				{ 0, 2, 3 },
-				{ 1, 2, 3 }
-			};
+		// Temporary data is allocated using the frame allocator of the worker thread
+		bs_frame_mark();
+		{
+			TetrahedronVolume volume = mTetrahedralization.getVolume();
 
-			for(UINT32 j = 0; j < 4; j++)
-			{
-				Vector3 A = mTempTetrahedronPositions[volume.vertices[Permutations[j][0]]];
-				Vector3 B = mTempTetrahedronPositions[volume.vertices[Permutations[j][1]]];
-				Vector3 C = mTempTetrahedronPositions[volume.vertices[Permutations[j][2]]];
+			Vector<Vector3>& positions = build.positions;
+			Vector<TetrahedronData> tetrahedra;
+			Vector<TetrahedronFaceData> outerFaces;
+			generateTetrahedronData(volume, positions, tetrahedra, outerFaces, true);
 
-				// Make sure the triangle is clockwise, facing away from the center
-				Vector3 e0 = A - C;
-				Vector3 e1 = B - C;
+			// Find valid tetrahedrons
+			UINT32 numTetrahedra = (UINT32)tetrahedra.size();
 
-				Vector3 normal = e0.cross(e1);
-				if (normal.dot(A - center) > 0.0f)
-					std::swap(B, C);
+			Vector<bool> validTets(numTetrahedra);
+			UINT32 numValidTetrahedra = 0;
+			for (UINT32 i = 0; i < numTetrahedra; i++)
+			{
+				const TetrahedronData& entry = tetrahedra[i];
 
-				posIter.addValue(A);
-				posIter.addValue(B);
-				posIter.addValue(C);
+				const Vector3& P1 = positions[entry.volume.vertices[0]];
+				const Vector3& P2 = positions[entry.volume.vertices[1]];
+				const Vector3& P3 = positions[entry.volume.vertices[2]];
+				const Vector3& P4 = positions[entry.volume.vertices[3]];
 
-				idIter.addValue(tetIdx);
-				idIter.addValue(tetIdx);
-				idIter.addValue(tetIdx);
+				Vector3 E1 = P1 - P4;
+				Vector3 E2 = P2 - P4;
+				Vector3 E3 = P3 - P4;
 
-				indices[0] = tetIdx * 4 * 3 + j * 3 + 0;
-				indices[1] = tetIdx * 4 * 3 + j * 3 + 1;
-				indices[2] = tetIdx * 4 * 3 + j * 3 + 2;
+				// If tetrahedron is co-planar just ignore it, shader will use some other nearby one instead. We can't
+				// handle coplanar tetrahedrons because the matrix is not invertible, and for nearly co-planar ones the
+				// math breaks down because of precision issues.
+				validTets[i] = fabs(Vector3::dot(Vector3::normalize(Vector3::cross(E1, E2)), E3)) > 0.0001f;
 
-				indices += 3;
+				if (validTets[i])
+					numValidTetrahedra++;
 			}
 
-			tetIdx++;
-		}
+			UINT32 numValidFaces = 0;
+			for(auto& entry : outerFaces)
+			{
+				if (validTets[entry.tetrahedron])
+					numValidFaces++;
+			}
 
-		// Generate an edge map for outer faces (required for step below)
-		struct Edge
-		{
-			UINT32 vertInner[2];
-			UINT32 vertOuter[2];
-			UINT32 face[2];
-		};
+			// Generate a mesh out of all the tetrahedron triangles
+			// Note: Currently the entire volume is rendered as a single large mesh, which will isn't optimal as we
+			// can't perform frustum culling. A better option would be to split the mesh into multiple smaller volumes,
+			// do frustum culling and possibly even sort by distance from camera.
+			UINT32 numVertices = numValidTetrahedra * 4 * 3 + numValidFaces * 9 * 3;
+
+			SPtr<VertexDataDesc> vertexDesc = bs_shared_ptr_new<VertexDataDesc>();
+			vertexDesc->addVertElem(VET_FLOAT3, VES_POSITION);
+			vertexDesc->addVertElem(VET_UINT1, VES_TEXCOORD);
+
+			build.meshData = MeshData::create(numVertices, numVertices, vertexDesc);
+			SPtr<MeshData> meshData = build.meshData;
+			auto posIter = meshData->getVec3DataIter(VES_POSITION);
+			auto idIter = meshData->getDWORDDataIter(VES_TEXCOORD);
+			UINT32* indices = meshData->getIndices32();
+
+			// Insert inner tetrahedron triangles
+			UINT32 tetIdx = 0;
+			for (UINT32 i = 0; i < (UINT32)tetrahedra.size(); i++)
+			{
+				if (!validTets[i])
+					continue;
 
-		FrameUnorderedMap<std::pair<INT32, INT32>, Edge, pair_hash> edgeMap;
-		for(UINT32 i = 0; i < (UINT32)outerFaces.size(); i++)
-		{
-			if (!validTets[outerFaces[i].tetrahedron])
-				continue;
+				const Tetrahedron& volume = tetrahedra[i].volume;
 
-			for (UINT32 j = 0; j < 3; ++j)
-			{
-				UINT32 v0 = outerFaces[i].innerVertices[j];
-				UINT32 v1 = outerFaces[i].innerVertices[(j + 1) % 3];
+				Vector3 center(BsZero);
+				for(UINT32 j = 0; j < 4; j++)
+					center += positions[volume.vertices[j]];
 
-				// Keep the same ordering so other faces can find the same edge
-				if (v0 > v1)
-					std::swap(v0, v1);
+				center /= 4.0f;
 
-				auto iterFind = edgeMap.find(std::make_pair((INT32)v0, (INT32)v1));
-				if (iterFind != edgeMap.end())
+				static const UINT32 Permutations[4][3] =
 				{
-					iterFind->second.face[1] = i;
-				}
-				else
-				{
-					Edge edge;
-					edge.vertInner[0] = outerFaces[i].innerVertices[j];
-					edge.vertInner[1] = outerFaces[i].innerVertices[(j + 1) % 3];
-					edge.vertOuter[0] = outerFaces[i].outerVertices[j];
-					edge.vertOuter[1] = outerFaces[i].outerVertices[(j + 1) % 3];
-					edge.face[0] = i;
-					edge.face[1] = -1;
-
-					edgeMap.insert(std::make_pair(std::make_pair((INT32)v0, (INT32)v1), edge));
-				}
-			}
-		}
+					{ 0, 1, 2 },
+					{ 0, 1, 3 },
+					{ 0, 2, 3 },
+					{ 1, 2, 3 }
+				};
 
-		// Generate front and back triangles for extruded outer faces
-		UINT32 faceIdx = 0;
-		for(UINT32 i = 0; i < (UINT32)outerFaces.size(); i++)
-		{
-			if (!validTets[outerFaces[i].tetrahedron])
-				continue;
+				for(UINT32 j = 0; j < 4; j++)
+				{
+					Vector3 A = positions[volume.vertices[Permutations[j][0]]];
+					Vector3 B = positions[volume.vertices[Permutations[j][1]]];
+					Vector3 C = positions[volume.vertices[Permutations[j][2]]];
 
-			const TetrahedronFaceData& entry = outerFaces[i];
+					// Make sure the triangle is clockwise, facing away from the center
+					Vector3 e0 = A - C;
+					Vector3 e1 = B - C;
 
-			static const UINT32 Permutations[2][3] = { {0, 1, 2 }, { 3, 4, 5} };
+					Vector3 normal = e0.cross(e1);
+					if (normal.dot(A - center) > 0.0f)
+						std::swap(B, C);
 
-			// Make sure the triangle is clockwise, facing away from the center
-			Vector3 center(BsZero);
-			for (UINT32 k = 0; k < 3; k++)
-			{
-				center += mTempTetrahedronPositions[entry.innerVertices[k]];
-				center += mTempTetrahedronPositions[entry.outerVertices[k]];
-			}
+					posIter.addValue(A);
+					posIter.addValue(B);
+					posIter.addValue(C);
 
-			center /= 6.0f;
+					idIter.addValue(tetIdx);
+					idIter.addValue(tetIdx);
+					idIter.addValue(tetIdx);
 
-			for(UINT32 j = 0; j < 2; ++j)
-			{
-				UINT32 idxA = Permutations[j][0];
-				UINT32 idxB = Permutations[j][1];
-				UINT32 idxC = Permutations[j][2];
+					indices[0] = tetIdx * 4 * 3 + j * 3 + 0;
+					indices[1] = tetIdx * 4 * 3 + j * 3 + 1;
+					indices[2] = tetIdx * 4 * 3 + j * 3 + 2;
 
-				idxA = idxA > 2 ? entry.outerVertices[idxA - 3] : entry.innerVertices[idxA];
-				idxB = idxB > 2 ? entry.outerVertices[idxB - 3] : entry.innerVertices[idxB];
-				idxC = idxC > 2 ? entry.outerVertices[idxC - 3] : entry.innerVertices[idxC];
-				
-				Vector3 A = mTempTetrahedronPositions[idxA];
-				Vector3 B = mTempTetrahedronPositions[idxB];
-				Vector3 C = mTempTetrahedronPositions[idxC];
+					indices += 3;
+				}
 
-				Vector3 e0 = A - C;
-				Vector3 e1 = B - C;
+				tetIdx++;
+			}
 
-				Vector3 normal = e0.cross(e1);
-				if (normal.dot(A - center) > 0.0f)
-					std::swap(A, B);
+			// Generate an edge map for outer faces (required for step below)
+			struct Edge
+			{
+				UINT32 vertInner[2];
+				UINT32 vertOuter[2];
+				UINT32 face[2];
+			};
 
-				posIter.addValue(A);
-				posIter.addValue(B);
-				posIter.addValue(C);
+			FrameUnorderedMap<std::pair<INT32, INT32>, Edge, pair_hash> edgeMap;
+			for(UINT32 i = 0; i < (UINT32)outerFaces.size(); i++)
+			{
+				if (!validTets[outerFaces[i].tetrahedron])
+					continue;
 
-				idIter.addValue(tetIdx + faceIdx);
-				idIter.addValue(tetIdx + faceIdx);
-				idIter.addValue(tetIdx + faceIdx);
+				for (UINT32 j = 0; j < 3; ++j)
+				{
+					UINT32 v0 = outerFaces[i].innerVertices[j];
+					UINT32 v1 = outerFaces[i].innerVertices[(j + 1) % 3];
 
-				indices[0] = tetIdx * 4 * 3 + faceIdx * 2 * 3 + j * 3 + 0;
-				indices[1] = tetIdx * 4 * 3 + faceIdx * 2 * 3 + j * 3 + 1;
-				indices[2] = tetIdx * 4 * 3 + faceIdx * 2 * 3 + j * 3 + 2;
+					// Keep the same ordering so other faces can find the same edge
+					if (v0 > v1)
+						std::swap(v0, v1);
 
-				indices += 3;
+					auto iterFind = edgeMap.find(std::make_pair((INT32)v0, (INT32)v1));
+					if (iterFind != edgeMap.end())
+					{
+						iterFind->second.face[1] = i;
+					}
+					else
+					{
+						Edge edge;
+						edge.vertInner[0] = outerFaces[i].innerVertices[j];
+						edge.vertInner[1] = outerFaces[i].innerVertices[(j + 1) % 3];
+						edge.vertOuter[0] = outerFaces[i].outerVertices[j];
+						edge.vertOuter[1] = outerFaces[i].outerVertices[(j + 1) % 3];
+						edge.face[0] = i;
+						edge.face[1] = -1;
+
+						edgeMap.insert(std::make_pair(std::make_pair((INT32)v0, (INT32)v1), edge));
+					}
+				}
 			}
 
-			faceIdx++;
-		}
+			// Generate front and back triangles for extruded outer faces
+			UINT32 faceIdx = 0;
+			for(UINT32 i = 0; i < (UINT32)outerFaces.size(); i++)
+			{
+				if (!validTets[outerFaces[i].tetrahedron])
+					continue;
 
-		// Generate sides for extruded outer faces
-		UINT32 sideIdx = 0;
-		for(auto& entry : edgeMap)
-		{
-			const Edge& edge = entry.second;
+				const TetrahedronFaceData& entry = outerFaces[i];
 
-			for (UINT32 i = 0; i < 2; i++)
-			{
-				const TetrahedronFaceData& face = outerFaces[edge.face[i]];
+				static const UINT32 Permutations[2][3] = { {0, 1, 2 }, { 3, 4, 5} };
 
 				// Make sure the triangle is clockwise, facing away from the center
 				Vector3 center(BsZero);
 				for (UINT32 k = 0; k < 3; k++)
 				{
-					center += mTempTetrahedronPositions[face.innerVertices[k]];
-					center += mTempTetrahedronPositions[face.outerVertices[k]];
+					center += positions[entry.innerVertices[k]];
+					center += positions[entry.outerVertices[k]];
 				}
 
 				center /= 6.0f;
 
-				static const UINT32 Permutations[2][3] = { {0, 1, 2 }, { 1, 2, 3} };
 				for(UINT32 j = 0; j < 2; ++j)
 				{
 					UINT32 idxA = Permutations[j][0];
 					UINT32 idxB = Permutations[j][1];
 					UINT32 idxC = Permutations[j][2];
 
-					idxA = idxA > 1 ? edge.vertOuter[idxA - 2] : edge.vertInner[idxA];
-					idxB = idxB > 1 ? edge.vertOuter[idxB - 2] : edge.vertInner[idxB];
-					idxC = idxC > 1 ? edge.vertOuter[idxC - 2] : edge.vertInner[idxC];
-					
-					Vector3 A = mTempTetrahedronPositions[idxA];
-					Vector3 B = mTempTetrahedronPositions[idxB];
-					Vector3 C = mTempTetrahedronPositions[idxC];
+					idxA = idxA > 2 ? entry.outerVertices[idxA - 3] : entry.innerVertices[idxA];
+					idxB = idxB > 2 ? entry.outerVertices[idxB - 3] : entry.innerVertices[idxB];
+					idxC = idxC > 2 ? entry.outerVertices[idxC - 3] : entry.innerVertices[idxC];
+				
+					Vector3 A = positions[idxA];
+					Vector3 B = positions[idxB];
+					Vector3 C = positions[idxC];
 
 					Vector3 e0 = A - C;
 					Vector3 e1 = B - C;
@@ -587,173 +620,244 @@ namespace bs { namespace ct
 					posIter.addValue(B);
 					posIter.addValue(C);
 
-					idIter.addValue(tetIdx + edge.face[i]);
-					idIter.addValue(tetIdx + edge.face[i]);
-					idIter.addValue(tetIdx + edge.face[i]);
+					idIter.addValue(tetIdx + faceIdx);
+					idIter.addValue(tetIdx + faceIdx);
+					idIter.addValue(tetIdx + faceIdx);
 
-					indices[0] = tetIdx * 4 * 3 + faceIdx * 2 * 3 + sideIdx * 2 * 3 + j * 3 + 0;
-					indices[1] = tetIdx * 4 * 3 + faceIdx * 2 * 3 + sideIdx * 2 * 3 + j * 3 + 1;
-					indices[2] = tetIdx * 4 * 3 + faceIdx * 2 * 3 + sideIdx * 2 * 3 + j * 3 + 2;
+					indices[0] = tetIdx * 4 * 3 + faceIdx * 2 * 3 + j * 3 + 0;
+					indices[1] = tetIdx * 4 * 3 + faceIdx * 2 * 3 + j * 3 + 1;
+					indices[2] = tetIdx * 4 * 3 + faceIdx * 2 * 3 + j * 3 + 2;
 
 					indices += 3;
 				}
 
-				sideIdx++;
+				faceIdx++;
 			}
-		}
 
-		// Generate "caps" on the end of the extruded volume
-		UINT32 capIdx = 0;
-		for(UINT32 i = 0; i < (UINT32)outerFaces.size(); i++)
-		{
-			if (!validTets[outerFaces[i].tetrahedron])
-				continue;
+			// Generate sides for extruded outer faces
+			UINT32 sideIdx = 0;
+			for(auto& entry : edgeMap)
+			{
+				const Edge& edge = entry.second;
 
-			const TetrahedronFaceData& entry = outerFaces[i];
+				for (UINT32 i = 0; i < 2; i++)
+				{
+					const TetrahedronFaceData& face = outerFaces[edge.face[i]];
 
-			Vector3 A = mTempTetrahedronPositions[entry.outerVertices[0]];
-			Vector3 B = mTempTetrahedronPositions[entry.outerVertices[1]];
-			Vector3 C = mTempTetrahedronPositions[entry.outerVertices[2]];
+					// Make sure the triangle is clockwise, facing away from the center
+					Vector3 center(BsZero);
+					for (UINT32 k = 0; k < 3; k++)
+					{
+						center += positions[face.innerVertices[k]];
+						center += positions[face.outerVertices[k]];
+					}
 
-			// Make sure the triangle is clockwise, facing toward the center
-			const Tetrahedron& tet = mTetrahedronInfos[entry.tetrahedron].volume;
+					center /= 6.0f;
 
-			Vector3 center(BsZero);
-			for(UINT32 j = 0; j < 4; j++)
-				center += mTempTetrahedronPositions[tet.vertices[j]];
+					static const UINT32 Permutations[2][3] = { {0, 1, 2 }, { 1, 2, 3} };
+					for(UINT32 j = 0; j < 2; ++j)
+					{
+						UINT32 idxA = Permutations[j][0];
+						UINT32 idxB = Permutations[j][1];
+						UINT32 idxC = Permutations[j][2];
 
-			center /= 4.0f;
+						idxA = idxA > 1 ? edge.vertOuter[idxA - 2] : edge.vertInner[idxA];
+						idxB = idxB > 1 ? edge.vertOuter[idxB - 2] : edge.vertInner[idxB];
+						idxC = idxC > 1 ? edge.vertOuter[idxC - 2] : edge.vertInner[idxC];
+					
+						Vector3 A = positions[idxA];
+						Vector3 B = positions[idxB];
+						Vector3 C = positions[idxC];
 
-			Vector3 e0 = A - C;
-			Vector3 e1 = B - C;
+						Vector3 e0 = A - C;
+						Vector3 e1 = B - C;
 
-			Vector3 normal = e0.cross(e1);
-			if (normal.dot(A - center) < 0.0f)
-				std::swap(B, C);
+						Vector3 normal = e0.cross(e1);
+						if (normal.dot(A - center) > 0.0f)
+							std::swap(A, B);
 
-			posIter.addValue(A);
-			posIter.addValue(B);
-			posIter.addValue(C);
+						posIter.addValue(A);
+						posIter.addValue(B);
+						posIter.addValue(C);
 
-			idIter.addValue(-1);
-			idIter.addValue(-1);
-			idIter.addValue(-1);
+						idIter.addValue(tetIdx + edge.face[i]);
+						idIter.addValue(tetIdx + edge.face[i]);
+						idIter.addValue(tetIdx + edge.face[i]);
 
-			indices[0] = tetIdx * 4 * 3 + faceIdx * 8 * 3 + capIdx * 3 + 0;
-			indices[1] = tetIdx * 4 * 3 + faceIdx * 8 * 3 + capIdx * 3 + 1;
-			indices[2] = tetIdx * 4 * 3 + faceIdx * 8 * 3 + capIdx * 3 + 2;
+						indices[0] = tetIdx * 4 * 3 + faceIdx * 2 * 3 + sideIdx * 2 * 3 + j * 3 + 0;
+						indices[1] = tetIdx * 4 * 3 + faceIdx * 2 * 3 + sideIdx * 2 * 3 + j * 3 + 1;
+						indices[2] = tetIdx * 4 * 3 + faceIdx * 2 * 3 + sideIdx * 2 * 3 + j * 3 + 2;
 
-			indices += 3;
-			capIdx++;
-		}
+						indices += 3;
+					}
 
-		mVolumeMesh = Mesh::create(meshData);
+					sideIdx++;
+				}
+			}
 
-		// Map vertices to actual SH coefficient indices, and write GPU buffer with tetrahedron information
-		if ((mNumValidTetrahedra + numValidFaces) > mMaxTetrahedra)
-		{
-			UINT32 newSize = Math::divideAndRoundUp(mNumValidTetrahedra + numValidFaces, 64U) * 64U;
-			resizeTetrahedronBuffer(newSize);
-		}
+			// Generate "caps" on the end of the extruded volume
+			UINT32 capIdx = 0;
+			for(UINT32 i = 0; i < (UINT32)outerFaces.size(); i++)
+			{
+				if (!validTets[outerFaces[i].tetrahedron])
+					continue;
 
-		TetrahedronDataGPU* dst = (TetrahedronDataGPU*)mTetrahedronInfosGPU->lock(0, mTetrahedronInfosGPU->getSize(),
-			GBL_WRITE_ONLY_DISCARD);
+				const TetrahedronFaceData& entry = outerFaces[i];
 
-		// Write inner tetrahedron data
-		for (UINT32 i = 0; i < (UINT32)mTetrahedronInfos.size(); i++)
-		{
-			if (!validTets[i])
-				continue;
+				Vector3 A = positions[entry.outerVertices[0]];
+				Vector3 B = positions[entry.outerVertices[1]];
+				Vector3 C = positions[entry.outerVertices[2]];
 
-			TetrahedronData& entry = mTetrahedronInfos[i];
+				// Make sure the triangle is clockwise, facing toward the center
+				const Tetrahedron& tet = tetrahedra[entry.tetrahedron].volume;
 
-			Vector2I offsets[4];
-			for(UINT32 j = 0; j < 4; ++j)
-			{
-				entry.volume.vertices[j] = mTempTetrahedronBufferIndices[entry.volume.vertices[j]];
-				offsets[j] = mTempTetrahedronBufferOffsets[entry.volume.vertices[j]];
-			}
+				Vector3 center(BsZero);
+				for(UINT32 j = 0; j < 4; j++)
+					center += positions[tet.vertices[j]];
 
-			memcpy(dst->indices, entry.volume.vertices, sizeof(UINT32) * 4);
-			memcpy(dst->offsets, &offsets, sizeof(offsets));
-			memcpy(&dst->transform, &entry.transform, sizeof(float) * 12);
+				center /= 4.0f;
 
-			dst++;
-		}
+				Vector3 e0 = A - C;
+				Vector3 e1 = B - C;
 
-		// Write extruded face data
-		for (UINT32 i = 0; i < (UINT32)outerFaces.size(); i++)
-		{
-			if (!validTets[outerFaces[i].tetrahedron])
-				continue;
+				Vector3 normal = e0.cross(e1);
+				if (normal.dot(A - center) < 0.0f)
+					std::swap(B, C);
+
+				posIter.addValue(A);
+				posIter.addValue(B);
+				posIter.addValue(C);
+
+				idIter.addValue(-1);
+				idIter.addValue(-1);
+				idIter.addValue(-1);
+
+				indices[0] = tetIdx * 4 * 3 + faceIdx * 8 * 3 + capIdx * 3 + 0;
+				indices[1] = tetIdx * 4 * 3 + faceIdx * 8 * 3 + capIdx * 3 + 1;
+				indices[2] = tetIdx * 4 * 3 + faceIdx * 8 * 3 + capIdx * 3 + 2;
 
-			const TetrahedronFaceData& entry = outerFaces[i];
+				indices += 3;
+				capIdx++;
+			}
 
-			UINT32 indices[4];
-			Vector2I offsets[4];
-			for(UINT32 j = 0; j < 3; j++)
+			// Map vertices to actual SH coefficient indices, and generate GPU data with tetrahedron information
+			build.numValidTetrahedra = numValidTetrahedra;
+			build.tetrahedra.resize(numValidTetrahedra + numValidFaces);
+			build.faces.resize(numValidFaces);
+
+			// Write inner tetrahedron data
+			TetrahedronDataGPU* dst = build.tetrahedra.data();
+			for (UINT32 i = 0; i < numTetrahedra; i++)
 			{
-				indices[j] = mTempTetrahedronBufferIndices[entry.innerVertices[j]];
-				offsets[j] = mTempTetrahedronBufferOffsets[entry.innerVertices[j]];
+				if (!validTets[i])
+					continue;
+
+				const TetrahedronData& entry = tetrahedra[i];
+				for(UINT32 j = 0; j < 4; ++j)
+				{
+					dst->indices[j] = build.bufferIndices[entry.volume.vertices[j]];
+					dst->offsets[j] = build.bufferOffsets[entry.volume.vertices[j]];
+				}
+
+				memcpy(&dst->transform, &entry.transform, sizeof(float) * 12);
+				dst++;
 			}
 
-			indices[3] = -1;
+			// Write extruded face data
+			TetrahedronFaceDataGPU* faceDst = build.faces.data();
+			for (UINT32 i = 0; i < (UINT32)outerFaces.size(); i++)
+			{
+				if (!validTets[outerFaces[i].tetrahedron])
+					continue;
 
-			memcpy(dst->indices, indices, sizeof(UINT32) * 4);
-			memcpy(dst->offsets, offsets, sizeof(offsets));
-			memcpy(&dst->transform, &entry.transform, sizeof(float) * 12);
+				const TetrahedronFaceData& entry = outerFaces[i];
+				for(UINT32 j = 0; j < 3; j++)
+				{
+					dst->indices[j] = build.bufferIndices[entry.innerVertices[j]];
+					dst->offsets[j] = build.bufferOffsets[entry.innerVertices[j]];
 
-			dst++;
-		}
+					faceDst->corners[j] = positions[entry.innerVertices[j]];
+					faceDst->normals[j] = entry.normals[j];
+				}
 
-		mTetrahedronInfosGPU->unlock();
+				dst->indices[3] = -1;
+				dst->offsets[3] = Vector2I::ZERO;
+				memcpy(&dst->transform, &entry.transform, sizeof(float) * 12);
 
-		// Write data specific to faces
-		if (numValidFaces > mMaxFaces)
-		{
-			UINT32 newSize = Math::divideAndRoundUp(numValidFaces, 64U) * 64U;
-			resizeTetrahedronFaceBuffer(newSize);
+				faceDst->isQuadratic = entry.quadratic ? 1 : 0;
+
+				dst++;
+				faceDst++;
+			}
 		}
+		bs_frame_clear();
+	}
 
-		TetrahedronFaceDataGPU* faceDst = (TetrahedronFaceDataGPU*)mTetrahedronFaceInfosGPU->lock(0,
-			mTetrahedronFaceInfosGPU->getSize(), GBL_WRITE_ONLY_DISCARD);
+	void LightProbes::finishBuild()
+	{
+		TetrahedronBuild& build = *mBuild;
 
-		for (UINT32 i = 0; i < (UINT32)outerFaces.size(); i++)
-		{
-			if (!validTets[outerFaces[i].tetrahedron])
-				continue;
+		copyCoefficients(build.coefficients);
 
-			const TetrahedronFaceData& entry = outerFaces[i];
+		mNumValidTetrahedra = build.numValidTetrahedra;
+		mVolumeMesh = build.numValidTetrahedra > 0 ? Mesh::create(build.meshData) : nullptr;
 
-			for (UINT32 j = 0; j < 3; j++)
-			{
-				faceDst->corners[j] = mTempTetrahedronPositions[entry.innerVertices[j]];
-				faceDst->normals[j] = entry.normals[j];
-			}
+		const UINT32 numTetrahedra = (UINT32)build.tetrahedra.size();
+		if (numTetrahedra > mMaxTetrahedra)
+		{
+			UINT32 newSize = Math::divideAndRoundUp(numTetrahedra, 64U) * 64U;
+			resizeTetrahedronBuffer(newSize);
+		}
 
-			faceDst->isQuadratic = entry.quadratic ? 1 : 0;
-			faceDst++;
+		if (numTetrahedra > 0)
+		{
+			void* dst = mTetrahedronInfosGPU->lock(0, mTetrahedronInfosGPU->getSize(), GBL_WRITE_ONLY_DISCARD);
+			memcpy(dst, build.tetrahedra.data(), numTetrahedra * sizeof(TetrahedronDataGPU));
+			mTetrahedronInfosGPU->unlock();
 		}
 
-		mTetrahedronFaceInfosGPU->unlock();
+		const UINT32 numFaces = (UINT32)build.faces.size();
+		if (numFaces > mMaxFaces)
+		{
+			UINT32 newSize = Math::divideAndRoundUp(numFaces, 64U) * 64U;
+			resizeTetrahedronFaceBuffer(newSize);
+		}
 
-		bs_stack_free(validTets);
+		if (numFaces > 0)
+		{
+			void* dst = mTetrahedronFaceInfosGPU->lock(0, mTetrahedronFaceInfosGPU->getSize(), GBL_WRITE_ONLY_DISCARD);
+			memcpy(dst, build.faces.data(), numFaces * sizeof(TetrahedronFaceDataGPU));
+			mTetrahedronFaceInfosGPU->unlock();
+		}
 
-		mTempTetrahedronPositions.clear();
-		mTempTetrahedronBufferIndices.clear();
-		mTetrahedronVolumeDirty = false;
+		mBuild = nullptr;
 	}
 
-	bool LightProbes::hasAnyProbes() const
+	void LightProbes::copyCoefficients(const Vector<SPtr<Texture>>& textures)
 	{
-		for(auto& entry : mVolumes)
+		// Move all coefficients into the global buffer
+		UINT32 numRows = 0;
+		for(auto& entry : textures)
+			numRows += entry->getProperties().getHeight();
+
+		if(numRows > mMaxCoefficientRows)
+			resizeCoefficientTexture(numRows + 4);
+
+		UINT32 rowIdx = 0;
+		for(auto& entry : textures)
 		{
-			UINT32 numProbes = entry.volume->getNumActiveProbes();
-			if (numProbes > 0)
-				return true;
+			TEXTURE_COPY_DESC copyDesc;
+			copyDesc.dstPosition = Vector3I(0, rowIdx, 0);
+
+			entry->copy(mProbeCoefficientsGPU, copyDesc);
+			
+			rowIdx += entry->getProperties().getHeight();
 		}
+	}
 
-		return false;
+	bool LightProbes::hasAnyProbes() const
+	{
+		return mVolumeMesh != nullptr;
 	}
 
 	LightProbesInfo LightProbes::getInfo() const
@@ -814,13 +918,11 @@ namespace bs { namespace ct
 		mMaxCoefficientRows = numRows;
 	}
 
-	void LightProbes::generateTetrahedronData(Vector<Vector3>& positions, Vector<TetrahedronData>& tetrahedra,
-		Vector<TetrahedronFaceData>& faces,	bool generateExtrapolationVolume)
+	void LightProbes::generateTetrahedronData(TetrahedronVolume& volume, Vector<Vector3>& positions,
+		Vector<TetrahedronData>& tetrahedra, Vector<TetrahedronFaceData>& faces, bool generateExtrapolationVolume)
 	{
 		bs_frame_mark();
 		{
-			TetrahedronVolume volume = Triangulation::tetrahedralize(positions);
-
 			if (generateExtrapolationVolume)
 			{
 				// Add geometry so we can handle the case when the interpolation position falls outside of the tetrahedra
@@ -177,9 +177,43 @@ namespace bs { namespace ct
 		UINT32 numTetrahedra;
 	};
 
-	/** Handles any pre-processing for light (irradiance) probe lighting. */
+	/** Information about a single tetrahedron, for use on the GPU. */
+	struct TetrahedronDataGPU
+	{
+		UINT32 indices[4];
+		Vector2I offsets[4];
+		Matrix3x4 transform;
+	};
+
+	/** Information about a single tetrahedron face, for use on the GPU. */
+	struct TetrahedronFaceDataGPU
+	{
+		Vector4 corners[3];
+		Vector4 normals[3];
+		UINT32 isQuadratic;
+		float padding[3];
+	};
+
+	/**
+	 * Handles any pre-processing for light (irradiance) probe lighting.
+	 *
+	 * Probe positions are kept in a persistent tetrahedralization that is modified only by the probes that were added,
+	 * removed or moved since the last update. The modification and the generation of the GPU data runs on a worker
+	 * thread, during which the previously generated data remains in use.
+	 */
 	class LightProbes
 	{
+		/** Information about a light probe that was provided to the tetrahedralization. */
+		struct ProbePoint
+		{
+			/** Identifier of the probe's point in the tetrahedralization. */
+			UINT32 id;
+			/** World position of the probe at the time it was provided to the tetrahedralization. */
+			Vector3 position;
+			/** Index of the last update the probe was found active in. */
+			UINT32 updateIdx;
+		};
+
 		/** Internal information about a single light probe volume. */
 		struct VolumeInfo
 		{
@@ -187,6 +221,36 @@ namespace bs { namespace ct
 			LightProbeVolume* volume;
 			/** Remains true as long as there are dirty probes in the volume. */
 			bool isDirty;
+			/** Tetrahedralization points of all active probes in the volume, mapped by probe handle. */
+			UnorderedMap<UINT32, ProbePoint> points;
+			/** Tetrahedralization point ids of the active probes, in the same order as probes in the volume. */
+			Vector<UINT32> pointIds;
+		};
+
+		/**
+		 * Changes to apply to the tetrahedralization on a worker thread, along with a snapshot of the probe data
+		 * required for generating the GPU data, and the generated data itself.
+		 */
+		struct TetrahedronBuild
+		{
+			Vector<UINT32> removedPoints;
+			Vector<std::pair<UINT32, Vector3>> addedPoints;
+
+			/** World positions of the probes, indexed by point id. */
+			Vector<Vector3> positions;
+			/** Indices of the probe coefficients in the coefficient buffer, indexed by point id. */
+			Vector<UINT32> bufferIndices;
+			/** Locations of the probe coefficients in the coefficient texture, indexed by point id. */
+			Vector<Vector2I> bufferOffsets;
+			/** Per-volume coefficient textures, matching the layout of the buffer indices. */
+			Vector<SPtr<Texture>> coefficients;
+
+			SPtr<MeshData> meshData;
+			Vector<TetrahedronDataGPU> tetrahedra;
+			Vector<TetrahedronFaceDataGPU> faces;
+			UINT32 numValidTetrahedra = 0;
+
+			SPtr<Task> task;
 		};
 
 		/**
@@ -215,6 +279,7 @@ namespace bs { namespace ct
 		};
 	public:
 		LightProbes();
+		~LightProbes();
 
 		/** Notifies sthe manager that the provided light probe volume has been added. */
 		void notifyAdded(LightProbeVolume* volume);
@@ -225,10 +290,14 @@ namespace bs { namespace ct
 		/** Notifies the manager that all the probes in the provided volume have been removed. */
 		void notifyRemoved(LightProbeVolume* volume);
 
-		/** Updates light probe tetrahedron data after probes changed (added/removed/moved). */
+		/**
+		 * Updates light probe tetrahedron data after probes changed (added/removed/moved). Tetrahedron data is
+		 * generated asynchronously, and the data returned by getInfo() is only replaced by a call to this method
+		 * after the generation finishes.
+		 */
 		void updateProbes();
 
-		/** Returns true if there are any registered light probes. */
+		/** Returns true if the data returned by getInfo() contains any light probes. */
 		bool hasAnyProbes() const;
 
 		/**
@@ -240,12 +309,27 @@ namespace bs { namespace ct
 
 	private:
 		/**
-		 * Perform tetrahedrization of the provided point list, and outputs a list of tetrahedrons and outer faces of the
-		 * volume. Each entry contains connections to nearby tetrahedrons/faces, as well as a matrix that can be used for
-		 * calculating barycentric coordinates within the tetrahedron (or projected triangle barycentric coordinates for
-		 * faces).
+		 * Records changes to probes in dirty volumes and starts generating new tetrahedron data on a worker thread.
+		 * If probe positions and their coefficient locations didn't change, only the coefficients are updated.
+		 */
+		void startBuild();
+
+		/** Replaces the current tetrahedron data with the data generated by the last started build. */
+		void finishBuild();
+
+		/** Applies the changes in the build to the tetrahedralization and generates the data. Runs on a worker. */
+		void executeBuild(TetrahedronBuild& build);
+
+		/** Copies the provided per-volume coefficient textures into the global coefficient texture. */
+		void copyCoefficients(const Vector<SPtr<Texture>>& textures);
+
+		/**
+		 * Outputs a list of tetrahedrons and outer faces of the provided tetrahedron volume. Each entry contains
+		 * connections to nearby tetrahedrons/faces, as well as a matrix that can be used for calculating barycentric
+		 * coordinates within the tetrahedron (or projected triangle barycentric coordinates for faces).
 		 *
-		 * @param[in,out]	positions					A set of positions to generate the tetrahedra from. If
+		 * @param[in]		volume						Tetrahedralization of the positions.
+		 * @param[in,out]	positions					A set of positions the tetrahedra were generated from. If
 		 *												@p generateExtrapolationVolume is enabled then this array will be
 		 *												appended with new vertices forming that volume.
 		 * @param[out]		tetrahedra					A list of generated tetrahedra and relevant data.
@@ -253,8 +337,9 @@ namespace bs { namespace ct
 		 * @param[in]		generateExtrapolationVolume	If true, the tetrahedron volume will be surrounded with points
 		 *												at "infinity" (technically just far away).
 		 */
-		void generateTetrahedronData(Vector<Vector3>& positions, Vector<TetrahedronData>& tetrahedra,
-			Vector<TetrahedronFaceData>& faces, bool generateExtrapolationVolume = false);
+		static void generateTetrahedronData(TetrahedronVolume& volume, Vector<Vector3>& positions,
+			Vector<TetrahedronData>& tetrahedra, Vector<TetrahedronFaceData>& faces,
+			bool generateExtrapolationVolume = false);
 
 		/** Resizes the GPU buffer used for holding tetrahedron data, to the specified size (in number of tetraheda). */
 		void resizeTetrahedronBuffer(UINT32 count);
@@ -275,18 +360,24 @@ namespace bs { namespace ct
 		UINT32 mMaxTetrahedra;
 		UINT32 mMaxFaces;
 
-		Vector<TetrahedronData> mTetrahedronInfos;
-
 		SPtr<Texture> mProbeCoefficientsGPU;
 		SPtr<GpuBuffer> mTetrahedronInfosGPU;
 		SPtr<GpuBuffer> mTetrahedronFaceInfosGPU;
 		SPtr<Mesh> mVolumeMesh;
 		UINT32 mNumValidTetrahedra;
 
-		// Temporary buffers
-		Vector<Vector3> mTempTetrahedronPositions;
-		Vector<UINT32> mTempTetrahedronBufferIndices;
-		Vector<Vector2I> mTempTetrahedronBufferOffsets;
+		// Only accessed from the worker thread while a build is running
+		IncrementalTetrahedralization mTetrahedralization;
+
+		// Probe points, as last provided to the tetrahedralization
+		Vector<Vector3> mPointPositions;
+		Vector<UINT32> mPointBufferIndices;
+		Vector<Vector2I> mPointBufferOffsets;
+		Vector<UINT32> mFreePointIds;
+		Vector<UINT32> mRemovedPointIds;
+		UINT32 mUpdateIdx = 0;
+
+		SPtr<TetrahedronBuild> mBuild;
 	};
 
 	/** @} */
@@ -2698,6 +2698,8 @@ namespace bs { namespace ct
 
 		UINT32 queueFamily = mDevice.getQueueFamily(mType);
 		mBuffer = pool.getBuffer(queueFamily, mIsSecondary);
+
+		mStateCache.invalidate();
 	}
 
 	void VulkanCommandBuffer::submit(UINT32 syncMask)
@@ -2743,6 +2745,8 @@ namespace bs { namespace ct
 			mBuffer->submit(mQueue, mQueueIdx, syncMask);
 			mDevice.refreshStates(false);
 		}
+
+		mStateCache.invalidate();
 	}
 
 	CommandBufferState VulkanCommandBuffer::getState() const
@@ -612,9 +612,19 @@ namespace bs { namespace ct
 		for (UINT32 i = 0; i < numParamBlocks; i++)
 		{
 			VulkanBuffer* resource = nullptr;
+			VkDeviceSize offset = 0;
+			VkDeviceSize range = VK_WHOLE_SIZE;
 			if (mParamBlockBuffers[i] != nullptr)
 			{
-				VulkanGpuParamBlockBuffer* element = static_cast<VulkanGpuParamBlockBuffer*>(mParamBlockBuffers[i].get());
+				// Buffer contents might be a sub-range of a larger buffer (see GpuParamBlockArena)
+				const GpuParamBlockBuffer* bindBuffer = mParamBlockBuffers[i]->getBindBuffer();
+				if (bindBuffer != mParamBlockBuffers[i].get())
+				{
+					offset = mParamBlockBuffers[i]->getBindOffset();
+					range = mParamBlockBuffers[i]->getSize();
+				}
+
+				auto* element = static_cast<const VulkanGpuParamBlockBuffer*>(bindBuffer);
 				resource = element->getResource(deviceIdx);
 			}
 
@@ -648,6 +658,15 @@ namespace bs { namespace ct
 
 				mSetsDirty[set] = true;
 			}
+
+			VkDescriptorBufferInfo& bufferInfo = perDeviceData.perSetData[set].writeInfos[bindingIdx].buffer;
+			if(bufferInfo.offset != offset || bufferInfo.range != range)
+			{
+				bufferInfo.offset = offset;
+				bufferInfo.range = range;
+
+				mSetsDirty[set] = true;
+			}
 		}
 
 		for (UINT32 i = 0; i < numBuffers; i++)
@@ -368,10 +368,13 @@ namespace bs { namespace ct
 		RenderAPI::destroyCore();
 	}
 
-	void VulkanRenderAPI::setGraphicsPipeline(const SPtr<GraphicsPipelineState>& pipelineState,
+	void VulkanRenderAPI::setGraphicsPipelineImpl(const SPtr<GraphicsPipelineState>& pipelineState,
 		const SPtr<CommandBuffer>& commandBuffer)
 	{
 		VulkanCommandBuffer* cb = getCB(commandBuffer);
+		if (!cb->_getStateCache().setGraphicsPipeline(pipelineState))
+			return;
+
 		VulkanCmdBuffer* vkCB = cb->getInternal();
 
 		vkCB->setPipelineState(pipelineState);
@@ -379,10 +382,13 @@ namespace bs { namespace ct
 		BS_INC_RENDER_STAT(NumPipelineStateChanges);
 	}
 
-	void VulkanRenderAPI::setComputePipeline(const SPtr<ComputePipelineState>& pipelineState,
+	void VulkanRenderAPI::setComputePipelineImpl(const SPtr<ComputePipelineState>& pipelineState,
 		const SPtr<CommandBuffer>& commandBuffer)
 	{
 		VulkanCommandBuffer* cb = getCB(commandBuffer);
+		if (!cb->_getStateCache().setComputePipeline(pipelineState))
+			return;
+
 		VulkanCmdBuffer* vkCB = cb->getInternal();
 
 		vkCB->setPipelineState(pipelineState);
@@ -390,9 +396,12 @@ namespace bs { namespace ct
 		BS_INC_RENDER_STAT(NumPipelineStateChanges);
 	}
 
-	void VulkanRenderAPI::setGpuParams(const SPtr<GpuParams>& gpuParams, const SPtr<CommandBuffer>& commandBuffer)
+	void VulkanRenderAPI::setGpuParamsImpl(const SPtr<GpuParams>& gpuParams, const SPtr<CommandBuffer>& commandBuffer)
 	{
 		VulkanCommandBuffer* cb = getCB(commandBuffer);
+		if (!cb->_getStateCache().setGpuParams(gpuParams))
+			return;
+
 		VulkanCmdBuffer* vkCB = cb->getInternal();
 
 		UINT32 globalQueueIdx = CommandSyncMask::getGlobalQueueIdx(cb->getType(), cb->getQueueIdx());
@@ -418,18 +427,24 @@ namespace bs { namespace ct
 		BS_INC_RENDER_STAT(NumGpuParamBinds);
 	}
 
-	void VulkanRenderAPI::setViewport(const Rect2& vp, const SPtr<CommandBuffer>& commandBuffer)
+	void VulkanRenderAPI::setViewportImpl(const Rect2& vp, const SPtr<CommandBuffer>& commandBuffer)
 	{
 		VulkanCommandBuffer* cb = getCB(commandBuffer);
+		if (!cb->_getStateCache().setViewport(vp))
+			return;
+
 		VulkanCmdBuffer* vkCB = cb->getInternal();
 
 		vkCB->setViewport(vp);
 	}
 
-	void VulkanRenderAPI::setVertexBuffers(UINT32 index, SPtr<VertexBuffer>* buffers, UINT32 numBuffers,
+	void VulkanRenderAPI::setVertexBuffersImpl(UINT32 index, SPtr<VertexBuffer>* buffers, UINT32 numBuffers,
 		const SPtr<CommandBuffer>& commandBuffer)
 	{
 		VulkanCommandBuffer* cb = getCB(commandBuffer);
+		if (!cb->_getStateCache().setVertexBuffers(index, buffers, numBuffers))
+			return;
+
 		VulkanCmdBuffer* vkCB = cb->getInternal();
 
 		vkCB->setVertexBuffers(index, buffers, numBuffers);
@@ -437,9 +452,12 @@ namespace bs { namespace ct
 		BS_INC_RENDER_STAT(NumVertexBufferBinds);
 	}
 
-	void VulkanRenderAPI::setIndexBuffer(const SPtr<IndexBuffer>& buffer, const SPtr<CommandBuffer>& commandBuffer)
+	void VulkanRenderAPI::setIndexBufferImpl(const SPtr<IndexBuffer>& buffer, const SPtr<CommandBuffer>& commandBuffer)
 	{
 		VulkanCommandBuffer* cb = getCB(commandBuffer);
+		if (!cb->_getStateCache().setIndexBuffer(buffer))
+			return;
+
 		VulkanCmdBuffer* vkCB = cb->getInternal();
 
 		vkCB->setIndexBuffer(buffer);
@@ -447,24 +465,30 @@ namespace bs { namespace ct
 		BS_INC_RENDER_STAT(NumIndexBufferBinds);
 	}
 
-	void VulkanRenderAPI::setVertexDeclaration(const SPtr<VertexDeclaration>& vertexDeclaration,
+	void VulkanRenderAPI::setVertexDeclarationImpl(const SPtr<VertexDeclaration>& vertexDeclaration,
 		const SPtr<CommandBuffer>& commandBuffer)
 	{
 		VulkanCommandBuffer* cb = getCB(commandBuffer);
+		if (!cb->_getStateCache().setVertexDeclaration(vertexDeclaration))
+			return;
+
 		VulkanCmdBuffer* vkCB = cb->getInternal();
 
 		vkCB->setVertexDeclaration(vertexDeclaration);
 	}
 
-	void VulkanRenderAPI::setDrawOperation(DrawOperationType op, const SPtr<CommandBuffer>& commandBuffer)
+	void VulkanRenderAPI::setDrawOperationImpl(DrawOperationType op, const SPtr<CommandBuffer>& commandBuffer)
 	{
 		VulkanCommandBuffer* cb = getCB(commandBuffer);
+		if (!cb->_getStateCache().setDrawOperation(op))
+			return;
+
 		VulkanCmdBuffer* vkCB = cb->getInternal();
 
 		vkCB->setDrawOp(op);
 	}
 
-	void VulkanRenderAPI::draw(UINT32 vertexOffset, UINT32 vertexCount, UINT32 instanceCount,
+	void VulkanRenderAPI::drawImpl(UINT32 vertexOffset, UINT32 vertexCount, UINT32 instanceCount,
 		const SPtr<CommandBuffer>& commandBuffer)
 	{
 		UINT32 primCount = 0;
@@ -479,7 +503,7 @@ namespace bs { namespace ct
 		BS_ADD_RENDER_STAT(NumPrimitives, primCount);
 	}
 
-	void VulkanRenderAPI::drawIndexed(UINT32 startIndex, UINT32 indexCount, UINT32 vertexOffset, UINT32 vertexCount,
+	void VulkanRenderAPI::drawIndexedImpl(UINT32 startIndex, UINT32 indexCount, UINT32 vertexOffset, UINT32 vertexCount,
 		UINT32 instanceCount, const SPtr<CommandBuffer>& commandBuffer)
 	{
 		UINT32 primCount = 0;
@@ -494,7 +518,7 @@ namespace bs { namespace ct
 		BS_ADD_RENDER_STAT(NumPrimitives, primCount);
 	}
 
-	void VulkanRenderAPI::dispatchCompute(UINT32 numGroupsX, UINT32 numGroupsY, UINT32 numGroupsZ,
+	void VulkanRenderAPI::dispatchComputeImpl(UINT32 numGroupsX, UINT32 numGroupsY, UINT32 numGroupsZ,
 		const SPtr<CommandBuffer>& commandBuffer)
 	{
 		VulkanCommandBuffer* cb = getCB(commandBuffer);
@@ -505,26 +529,32 @@ namespace bs { namespace ct
 		BS_INC_RENDER_STAT(NumComputeCalls);
 	}
 
-	void VulkanRenderAPI::setScissorRect(UINT32 left, UINT32 top, UINT32 right, UINT32 bottom,
+	void VulkanRenderAPI::setScissorRectImpl(UINT32 left, UINT32 top, UINT32 right, UINT32 bottom,
 		const SPtr<CommandBuffer>& commandBuffer)
 	{
 		VulkanCommandBuffer* cb = getCB(commandBuffer);
+		if (!cb->_getStateCache().setScissorRect(left, top, right, bottom))
+			return;
+
 		VulkanCmdBuffer* vkCB = cb->getInternal();
 
 		Rect2I area(left, top, right - left, bottom - top);
 		vkCB->setScissorRect(area);
 	}
 
-	void VulkanRenderAPI::setStencilRef(UINT32 value, const SPtr<CommandBuffer>& commandBuffer)
+	void VulkanRenderAPI::setStencilRefImpl(UINT32 value, const SPtr<CommandBuffer>& commandBuffer)
 	{
 		VulkanCommandBuffer* cb = getCB(commandBuffer);
+		if (!cb->_getStateCache().setStencilRef(value))
+			return;
+
 		VulkanCmdBuffer* vkCB = cb->getInternal();
 
 		vkCB->setStencilRef(value);
 	}
 
-	void VulkanRenderAPI::clearViewport(UINT32 buffers, const Color& color, float depth, UINT16 stencil, UINT8 targetMask,
-		const SPtr<CommandBuffer>& commandBuffer)
+	void VulkanRenderAPI::clearViewportImpl(UINT32 buffers, const Color& color, float depth, UINT16 stencil,
+		UINT8 targetMask, const SPtr<CommandBuffer>& commandBuffer)
 	{
 		VulkanCommandBuffer* cb = getCB(commandBuffer);
 		VulkanCmdBuffer* vkCB = cb->getInternal();
@@ -534,7 +564,7 @@ namespace bs { namespace ct
 		BS_INC_RENDER_STAT(NumClears);
 	}
 
-	void VulkanRenderAPI::clearRenderTarget(UINT32 buffers, const Color& color, float depth, UINT16 stencil,
+	void VulkanRenderAPI::clearRenderTargetImpl(UINT32 buffers, const Color& color, float depth, UINT16 stencil,
 		UINT8 targetMask, const SPtr<CommandBuffer>& commandBuffer)
 	{
 		VulkanCommandBuffer* cb = getCB(commandBuffer);
@@ -545,13 +575,14 @@ namespace bs { namespace ct
 		BS_INC_RENDER_STAT(NumClears);
 	}
 
-	void VulkanRenderAPI::setRenderTarget(const SPtr<RenderTarget>& target, UINT32 readOnlyFlags,
+	void VulkanRenderAPI::setRenderTargetImpl(const SPtr<RenderTarget>& target, UINT32 readOnlyFlags,
 		RenderSurfaceMask loadMask, const SPtr<CommandBuffer>& commandBuffer)
 	{
 		VulkanCommandBuffer* cb = getCB(commandBuffer);
 		VulkanCmdBuffer* vkCB = cb->getInternal();
 
 		vkCB->setRenderTarget(target, readOnlyFlags, loadMask);
+		cb->_getStateCache().notifyRenderTargetChanged();
 		
 		BS_INC_RENDER_STAT(NumRenderTargetChanges);
 	}
@@ -570,12 +601,13 @@ namespace bs { namespace ct
 		BS_INC_RENDER_STAT(NumPresents);
 	}
 
-	void VulkanRenderAPI::addCommands(const SPtr<CommandBuffer>& commandBuffer, const SPtr<CommandBuffer>& secondary)
+	void VulkanRenderAPI::addCommandsImpl(const SPtr<CommandBuffer>& commandBuffer, const SPtr<CommandBuffer>& secondary)
 	{
-		BS_EXCEPT(NotImplementedException, "Secondary command buffers not implemented");
+		// Not supported yet, RSC_SECONDARY_CB is not reported so callers record directly into the primary buffer
+		BS_LOG(Error, RenderBackend, "Secondary command buffers not supported on Vulkan.");
 	}
 
-	void VulkanRenderAPI::submitCommandBuffer(const SPtr<CommandBuffer>& commandBuffer, UINT32 syncMask)
+	void VulkanRenderAPI::submitCommandBufferImpl(const SPtr<CommandBuffer>& commandBuffer, UINT32 syncMask)
 	{
 		THROW_IF_NOT_CORE_THREAD;
 
@@ -706,6 +738,7 @@ namespace bs { namespace ct
 			caps.setCapability(RSC_TEXTURE_VIEWS);
 			caps.setCapability(RSC_RENDER_TARGET_LAYERS);
 			caps.setCapability(RSC_MULTI_THREADED_CB);
+			caps.setCapability(RSC_PARAM_BLOCK_OFFSETS);
 
 			caps.conventions.ndcYAxis = Conventions::Axis::Down;
 			caps.conventions.matrixOrder = Conventions::MatrixOrder::ColumnMajor;
@@ -720,6 +753,7 @@ namespace bs { namespace ct
 			caps.numGpuParamBlockBuffersPerStage[GPT_FRAGMENT_PROGRAM] = deviceLimits.maxPerStageDescriptorUniformBuffers;
 			caps.numGpuParamBlockBuffersPerStage[GPT_VERTEX_PROGRAM] = deviceLimits.maxPerStageDescriptorUniformBuffers;
 			caps.numGpuParamBlockBuffersPerStage[GPT_COMPUTE_PROGRAM] = deviceLimits.maxPerStageDescriptorUniformBuffers;
+			caps.paramBlockOffsetAlignment = (UINT32)deviceLimits.minUniformBufferOffsetAlignment;
 
 			caps.numLoadStoreTextureUnitsPerStage[GPT_FRAGMENT_PROGRAM] = deviceLimits.maxPerStageDescriptorStorageImages;
 			caps.numLoadStoreTextureUnitsPerStage[GPT_COMPUTE_PROGRAM] = deviceLimits.maxPerStageDescriptorStorageImages;
@@ -775,6 +809,11 @@ namespace bs { namespace ct
 		if (buffer != nullptr)
 			return static_cast<VulkanCommandBuffer*>(buffer.get());
 
+		// Worker threads recording secondary command buffers redirect commands without an explicit command buffer
+		const SPtr<CommandBuffer>& threadBuffer = _getThreadCommandBuffer();
+		if (threadBuffer != nullptr)
+			return static_cast<VulkanCommandBuffer*>(threadBuffer.get());
+
 		return static_cast<VulkanCommandBuffer*>(mMainCommandBuffer.get());
 	}
 
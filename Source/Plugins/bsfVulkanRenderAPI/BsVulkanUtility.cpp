@@ -283,6 +283,11 @@ namespace bs { namespace ct
 			lookup[VET_COLOR_ABGR] = VK_FORMAT_R8G8B8A8_UNORM;
 			lookup[VET_COLOR_ARGB] = VK_FORMAT_R8G8B8A8_UNORM;
 			lookup[VET_UBYTE4_NORM] = VK_FORMAT_R8G8B8A8_UNORM;
+			lookup[VET_UINT_10_10_10_2_NORM] = VK_FORMAT_A2B10G10R10_UNORM_PACK32;
+			lookup[VET_HALF2] = VK_FORMAT_R16G16_SFLOAT;
+			lookup[VET_HALF4] = VK_FORMAT_R16G16B16A16_SFLOAT;
+			lookup[VET_USHORT2_NORM] = VK_FORMAT_R16G16_UNORM;
+			lookup[VET_USHORT4_NORM] = VK_FORMAT_R16G16B16A16_UNORM;
 			lookup[VET_FLOAT1] = VK_FORMAT_R32_SFLOAT;
 			lookup[VET_FLOAT2] = VK_FORMAT_R32G32_SFLOAT;
 			lookup[VET_FLOAT3] = VK_FORMAT_R32G32B32_SFLOAT;